@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2026, Ashok P. Nadkarni
+ * All rights reserved.
+ *
+ * See the file LICENSE for license
+ *
+ * Microbenchmarks for the Tclh hot paths. Each benchmark runs its
+ * operation in a calibrated loop and reports ns/op, ops/sec and, where a
+ * byte count is meaningful, MB/s. On x86 the TSC is sampled as well so
+ * cycles/op can be compared across machines with different clocks. Pass
+ * --json for machine readable output suitable for diffing between runs.
+ */
+
+#define TCLH_EMBEDDER "tclhbench"
+#define TCLH_IMPL
+#include "tclhBase.h"
+#include "tclhLifo.h"
+#include "tclhAtom.h"
+#include "tclhObj.h"
+#include "tclhPointer.h"
+#include "tclhNamespace.h"
+#include "tclhCmd.h"
+#include "tclhEncoding.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+# define BENCH_HAVE_CYCLES 1
+static unsigned long long BenchCycles(void)
+{
+    unsigned int lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((unsigned long long)hi << 32) | lo;
+}
+#endif
+
+static double BenchNowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1e9 * ts.tv_sec + ts.tv_nsec;
+}
+
+/* Shared state set up once and used by the benchmark bodies below */
+static Tcl_Interp *gInterp;
+static Tclh_LibContext *gCtx;
+static Tcl_Size gParam; /* Size parameter for parameterized benchmarks */
+
+#define BENCH_MIN_TIME_NS 1e8 /* Calibrate until a run takes this long */
+#define BENCH_REPEATS 3       /* Timed runs per benchmark; best is taken */
+
+typedef struct BenchDef {
+    const char *name;
+    void (*setupP)(void);       /* May be NULL */
+    void (*opsP)(Tcl_Size);     /* Runs the operation the given number of times */
+    void (*teardownP)(void);    /* May be NULL */
+    Tcl_Size param;             /* Stored into gParam before setup */
+    double bytesPerOp;          /* Non-0 enables MB/s reporting */
+} BenchDef;
+
+/*
+ * Lifo allocation.
+ */
+static Tclh_Lifo gLifo;
+
+static void LifoSetup(void)
+{
+    if (Tclh_LifoInit(&gLifo, NULL, NULL, 8000, TCLH_LIFO_PANIC_ON_FAIL)
+        != TCLH_LIFO_E_SUCCESS) {
+        fprintf(stderr, "Tclh_LifoInit failed\n");
+        exit(1);
+    }
+}
+
+static void LifoTeardown(void)
+{
+    Tclh_LifoClose(&gLifo);
+}
+
+static void LifoAllocOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    Tclh_LifoMark mark = Tclh_LifoPushMark(&gLifo);
+    for (i = 0; i < iters; ++i) {
+        (void)Tclh_LifoAllocMin(&gLifo, 64, NULL);
+        if ((i & 1023) == 1023) { /* Bound pool growth */
+            Tclh_LifoPopMark(mark);
+            mark = Tclh_LifoPushMark(&gLifo);
+        }
+    }
+    Tclh_LifoPopMark(mark);
+}
+
+static void LifoMarkOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    for (i = 0; i < iters; ++i) {
+        Tclh_LifoMark mark = Tclh_LifoPushMark(&gLifo);
+        (void)Tclh_LifoAllocMin(&gLifo, 64, NULL);
+        Tclh_LifoPopMark(mark);
+    }
+}
+
+/*
+ * Pointer registry. Parameterized on the number of pre-registered
+ * pointers so probe behavior at different registry sizes is visible.
+ */
+TCLH_INLINE void *BenchPtr(Tcl_Size i)
+{
+    return (void *)(intptr_t)(0x10000 + 16 * i);
+}
+
+static void PointerSetup(void)
+{
+    Tcl_Size i;
+    for (i = 0; i < gParam; ++i) {
+        if (Tclh_PointerRegister(gInterp, gCtx, BenchPtr(i), NULL, NULL)
+            != TCL_OK) {
+            fprintf(stderr, "pointer setup failed\n");
+            exit(1);
+        }
+    }
+}
+
+static void PointerTeardown(void)
+{
+    Tcl_Size i;
+    for (i = 0; i < gParam; ++i)
+        (void)Tclh_PointerUnregister(gInterp, gCtx, BenchPtr(i));
+}
+
+static void PointerRegisterOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    void *extraP = BenchPtr(gParam); /* Not in the seeded set */
+    for (i = 0; i < iters; ++i) {
+        (void)Tclh_PointerRegister(gInterp, gCtx, extraP, NULL, NULL);
+        (void)Tclh_PointerUnregister(gInterp, gCtx, extraP);
+    }
+}
+
+static void PointerVerifyOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    for (i = 0; i < iters; ++i)
+        (void)Tclh_PointerVerify(gInterp, gCtx, BenchPtr(i % gParam));
+}
+
+static void PointerEnumerateOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    for (i = 0; i < iters; ++i) {
+        Tcl_Obj *listObj = Tclh_PointerEnumerate(gInterp, gCtx, NULL);
+        Tcl_IncrRefCount(listObj);
+        Tcl_DecrRefCount(listObj);
+    }
+}
+
+/*
+ * Atom registry.
+ */
+static void AtomSetup(void)
+{
+    (void)Tclh_AtomGet(gInterp, gCtx, "tclhbench_hit_atom");
+}
+
+static void AtomHitOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    for (i = 0; i < iters; ++i)
+        (void)Tclh_AtomGet(gInterp, gCtx, "tclhbench_hit_atom");
+}
+
+static void AtomMissOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    char name[64];
+    static unsigned long gen;
+    for (i = 0; i < iters; ++i) {
+        snprintf(name, sizeof(name), "tclhbench_miss_%lu", gen++);
+        (void)Tclh_AtomGet(gInterp, gCtx, name);
+    }
+}
+
+/*
+ * Obj to native integer conversions - int rep, wide rep and the packed
+ * bignum rep fast path.
+ */
+static Tcl_Obj *gIntObj;
+static Tcl_Obj *gWideObj;
+static Tcl_Obj *gBignumObj;
+
+static void ObjSetup(void)
+{
+    Tcl_WideInt wide;
+    Tcl_WideUInt uwide;
+    gIntObj    = Tcl_NewIntObj(12345);
+    gWideObj   = Tcl_NewWideIntObj((Tcl_WideInt)1 << 40);
+    gBignumObj = Tcl_NewStringObj("18446744073709551615", -1); /* 2^64-1 */
+    Tcl_IncrRefCount(gIntObj);
+    Tcl_IncrRefCount(gWideObj);
+    Tcl_IncrRefCount(gBignumObj);
+    /* Force the reps once so the loops measure rep reads, not parsing */
+    if (Tclh_ObjToWideInt(gInterp, gWideObj, &wide) != TCL_OK
+        || Tclh_ObjToULongLong(gInterp, gBignumObj, &uwide) != TCL_OK) {
+        fprintf(stderr, "obj setup failed\n");
+        exit(1);
+    }
+}
+
+static void ObjTeardown(void)
+{
+    Tcl_DecrRefCount(gIntObj);
+    Tcl_DecrRefCount(gWideObj);
+    Tcl_DecrRefCount(gBignumObj);
+}
+
+static void ObjToIntOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    int value;
+    for (i = 0; i < iters; ++i)
+        (void)Tclh_ObjToInt(gInterp, gIntObj, &value);
+}
+
+static void ObjToWideOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    Tcl_WideInt value;
+    for (i = 0; i < iters; ++i)
+        (void)Tclh_ObjToWideInt(gInterp, gWideObj, &value);
+}
+
+static void ObjToBignumOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    Tcl_WideUInt value;
+    for (i = 0; i < iters; ++i)
+        (void)Tclh_ObjToULongLong(gInterp, gBignumObj, &value);
+}
+
+/*
+ * Encoding conversion. Parameterized on source length; the encoding name
+ * is smuggled through the benchmark definition in gEncodingName.
+ */
+static const char *gEncodingName;
+static Tcl_Encoding gEncoding;
+static char *gEncSrcP;
+static char gEncDst[4 * 4096 + 8];
+
+static void EncodingSetup(void)
+{
+    Tcl_Size i;
+    gEncoding = Tcl_GetEncoding(gInterp, gEncodingName);
+    if (gEncoding == NULL) {
+        fprintf(stderr, "no %s encoding\n", gEncodingName);
+        exit(1);
+    }
+    gEncSrcP = malloc(gParam + 1);
+    for (i = 0; i < gParam; ++i)
+        gEncSrcP[i] = 'a' + (i % 26);
+    gEncSrcP[gParam] = '\0';
+}
+
+static void EncodingTeardown(void)
+{
+    Tcl_FreeEncoding(gEncoding);
+    free(gEncSrcP);
+}
+
+static void EncodingOps(Tcl_Size iters)
+{
+    Tcl_Size i, read, wrote, chars;
+    for (i = 0; i < iters; ++i) {
+        (void)Tclh_UtfToExternal(gInterp,
+                                 gEncoding,
+                                 gEncSrcP,
+                                 gParam,
+                                 0,
+                                 NULL,
+                                 gEncDst,
+                                 sizeof(gEncDst),
+                                 &read,
+                                 &wrote,
+                                 &chars);
+    }
+}
+
+/*
+ * Subcommand dispatch.
+ */
+static Tclh_SubCommand gSubCommands[] = {
+    {"create", 0, 0, "", NULL, 0},
+    {"configure", 0, 0, "", NULL, 0},
+    {"cget", 0, 0, "", NULL, 0},
+    {"destroy", 0, 0, "", NULL, 0},
+    {"info", 0, 0, "", NULL, 0},
+    {"invoke", 0, 0, "", NULL, 0},
+    {"names", 0, 0, "", NULL, 0},
+    {"trace", 0, 0, "", NULL, 0},
+    {NULL, 0, 0, NULL, NULL, 0},
+};
+#define NUM_SUBCOMMANDS 8
+static Tcl_Obj *gSubCmdObjs[NUM_SUBCOMMANDS];
+
+static void SubCommandSetup(void)
+{
+    Tcl_Size i;
+    for (i = 0; i < NUM_SUBCOMMANDS; ++i) {
+        gSubCmdObjs[i] = Tcl_NewStringObj(gSubCommands[i].cmdName, -1);
+        Tcl_IncrRefCount(gSubCmdObjs[i]);
+    }
+}
+
+static void SubCommandTeardown(void)
+{
+    Tcl_Size i;
+    for (i = 0; i < NUM_SUBCOMMANDS; ++i)
+        Tcl_DecrRefCount(gSubCmdObjs[i]);
+}
+
+static void SubCommandOps(Tcl_Size iters)
+{
+    Tcl_Size i;
+    int index;
+    for (i = 0; i < iters; ++i) {
+        (void)Tclh_SubCommandNameToIndex(gInterp,
+                                         gSubCmdObjs[i % NUM_SUBCOMMANDS],
+                                         gSubCommands,
+                                         &index);
+    }
+}
+
+static const BenchDef gBenchDefs[] = {
+    {"lifo-alloc-min", LifoSetup, LifoAllocOps, LifoTeardown, 0, 0},
+    {"lifo-mark-push-pop", LifoSetup, LifoMarkOps, LifoTeardown, 0, 0},
+    {"pointer-register-100", PointerSetup, PointerRegisterOps, PointerTeardown, 100, 0},
+    {"pointer-register-10k", PointerSetup, PointerRegisterOps, PointerTeardown, 10000, 0},
+    {"pointer-register-100k", PointerSetup, PointerRegisterOps, PointerTeardown, 100000, 0},
+    {"pointer-verify-100", PointerSetup, PointerVerifyOps, PointerTeardown, 100, 0},
+    {"pointer-verify-10k", PointerSetup, PointerVerifyOps, PointerTeardown, 10000, 0},
+    {"pointer-verify-100k", PointerSetup, PointerVerifyOps, PointerTeardown, 100000, 0},
+    {"pointer-enumerate-100", PointerSetup, PointerEnumerateOps, PointerTeardown, 100, 0},
+    {"pointer-enumerate-10k", PointerSetup, PointerEnumerateOps, PointerTeardown, 10000, 0},
+    {"atom-get-hit", AtomSetup, AtomHitOps, NULL, 0, 0},
+    {"atom-get-miss", NULL, AtomMissOps, NULL, 0, 0},
+    {"obj-to-int", ObjSetup, ObjToIntOps, ObjTeardown, 0, 0},
+    {"obj-to-wide", ObjSetup, ObjToWideOps, ObjTeardown, 0, 0},
+    {"obj-to-ulonglong-bignum", ObjSetup, ObjToBignumOps, ObjTeardown, 0, 0},
+    {"utf-to-utf8-16b", EncodingSetup, EncodingOps, EncodingTeardown, 16, 16},
+    {"utf-to-utf8-4kb", EncodingSetup, EncodingOps, EncodingTeardown, 4096, 4096},
+    {"utf-to-iso8859-1-16b", EncodingSetup, EncodingOps, EncodingTeardown, 16, 16},
+    {"utf-to-iso8859-1-4kb", EncodingSetup, EncodingOps, EncodingTeardown, 4096, 4096},
+    {"subcommand-lookup", SubCommandSetup, SubCommandOps, SubCommandTeardown, 0, 0},
+};
+#define NUM_BENCHDEFS ((int)(sizeof(gBenchDefs) / sizeof(gBenchDefs[0])))
+
+typedef struct BenchResult {
+    double nsPerOp;
+    double cyclesPerOp; /* 0 when the TSC is unavailable */
+} BenchResult;
+
+static BenchResult BenchRun(const BenchDef *defP)
+{
+    BenchResult result;
+    Tcl_Size iters = 1;
+    double elapsed = 0;
+    int repeat;
+
+    gParam = defP->param;
+    /* Benchmarks that build on a specific encoding stash its name */
+    if (defP->opsP == EncodingOps)
+        gEncodingName =
+            strncmp(defP->name, "utf-to-utf8", 11) == 0 ? "utf-8" : "iso8859-1";
+    if (defP->setupP)
+        defP->setupP();
+
+    /* Calibrate the iteration count to a measurable run time */
+    for (;;) {
+        double begin = BenchNowNs();
+        defP->opsP(iters);
+        elapsed = BenchNowNs() - begin;
+        if (elapsed >= BENCH_MIN_TIME_NS)
+            break;
+        if (elapsed < BENCH_MIN_TIME_NS / 100)
+            iters *= 10;
+        else
+            iters *= 2;
+    }
+    result.nsPerOp     = elapsed / iters;
+    result.cyclesPerOp = 0;
+    for (repeat = 1; repeat < BENCH_REPEATS; ++repeat) {
+        double begin = BenchNowNs();
+#ifdef BENCH_HAVE_CYCLES
+        unsigned long long beginCycles = BenchCycles();
+#endif
+        defP->opsP(iters);
+#ifdef BENCH_HAVE_CYCLES
+        double cycles = (double)(BenchCycles() - beginCycles) / iters;
+        if (result.cyclesPerOp == 0 || cycles < result.cyclesPerOp)
+            result.cyclesPerOp = cycles;
+#endif
+        elapsed = BenchNowNs() - begin;
+        if (elapsed / iters < result.nsPerOp)
+            result.nsPerOp = elapsed / iters;
+    }
+
+    if (defP->teardownP)
+        defP->teardownP();
+    return result;
+}
+
+int
+main(int argc, char **argv)
+{
+    int jsonMode = 0;
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0)
+            jsonMode = 1;
+        else {
+            fprintf(stderr, "Usage: %s ?--json?\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Tcl_FindExecutable(NULL);
+    gInterp = Tcl_CreateInterp();
+    if (Tclh_LibInit(gInterp, &gCtx) != TCL_OK
+        || Tclh_ObjLibInit(gInterp, gCtx) != TCL_OK
+        || Tclh_PointerLibInit(gInterp, gCtx) != TCL_OK
+        || Tclh_AtomLibInit(gInterp, gCtx) != TCL_OK
+        || Tclh_CmdLibInit(gInterp, gCtx) != TCL_OK
+        || Tclh_EncodingLibInit(gInterp, gCtx) != TCL_OK) {
+        fprintf(stderr, "Tclh initialization failed\n");
+        return 1;
+    }
+
+    if (jsonMode) {
+        printf("{\n  \"tcl_version\": \"%d.%d\",\n  \"benchmarks\": [\n",
+               TCL_MAJOR_VERSION,
+               TCL_MINOR_VERSION);
+    }
+    else {
+        printf("%-26s %12s %14s %10s %10s\n",
+               "benchmark", "ns/op", "ops/sec", "cycles/op", "MB/s");
+    }
+    for (i = 0; i < NUM_BENCHDEFS; ++i) {
+        const BenchDef *defP = &gBenchDefs[i];
+        BenchResult result = BenchRun(defP);
+        double opsPerSec = 1e9 / result.nsPerOp;
+        if (jsonMode) {
+            printf("    {\"name\": \"%s\", \"ns_per_op\": %.2f, "
+                   "\"ops_per_sec\": %.0f",
+                   defP->name,
+                   result.nsPerOp,
+                   opsPerSec);
+            if (result.cyclesPerOp != 0)
+                printf(", \"cycles_per_op\": %.1f", result.cyclesPerOp);
+            if (defP->bytesPerOp != 0)
+                printf(", \"mb_per_sec\": %.1f",
+                       defP->bytesPerOp * opsPerSec / 1e6);
+            printf("}%s\n", i == NUM_BENCHDEFS - 1 ? "" : ",");
+        }
+        else {
+            printf("%-26s %12.2f %14.0f", defP->name, result.nsPerOp, opsPerSec);
+            if (result.cyclesPerOp != 0)
+                printf(" %10.1f", result.cyclesPerOp);
+            else
+                printf(" %10s", "-");
+            if (defP->bytesPerOp != 0)
+                printf(" %10.1f", defP->bytesPerOp * opsPerSec / 1e6);
+            printf("\n");
+        }
+        fflush(stdout);
+    }
+    if (jsonMode)
+        printf("  ]\n}\n");
+
+    Tcl_DeleteInterp(gInterp);
+    return 0;
+}
@@ -15,8 +15,30 @@
  * Provides a facility to allow frequently used string values to be shared by
  * allocation of a single Tcl_Obj.
  *
+ * By default the registry grows without bound, every distinct atomized
+ * string being pinned for the life of the interpreter. Applications that
+ * atomize dynamically generated strings can place a cap on the registry
+ * with <Tclh_AtomRegistryLimit> in which case least recently used atoms
+ * with no external references are evicted to stay within the cap. Usage
+ * counters for sizing the cap are available through
+ * <Tclh_AtomRegistryStatsGet>.
  */
 
+/* Typedef: Tclh_AtomRegistryStats
+ * Usage counters for an interpreter's atom registry.
+ *
+ * numHits - number of <Tclh_AtomGet> calls that found an existing atom.
+ * numMisses - number of calls that had to create a new atom.
+ * numEvictions - number of atoms evicted to enforce the registry cap.
+ * numEntries - current number of atoms in the registry.
+ */
+typedef struct Tclh_AtomRegistryStats {
+    unsigned long numHits;
+    unsigned long numMisses;
+    unsigned long numEvictions;
+    Tcl_Size numEntries;
+} Tclh_AtomRegistryStats;
+
 /* Function: Tclh_AtomLibInit
  * Must be called to initialize the Atom module before any of
  * the other functions in the module.
@@ -66,9 +88,116 @@ TCLH_LOCAL Tclh_ReturnCode Tclh_AtomLibInit(Tcl_Interp *interp,
 TCLH_LOCAL Tcl_Obj *
 Tclh_AtomGet(Tcl_Interp *interp, Tclh_LibContext *ctx, const char *str);
 
+/* Function: Tclh_AtomInternShared
+ * Interns a string in a process-wide shared atom table.
+ *
+ * Parameters:
+ * str - the string value to intern.
+ *
+ * The returned pointer refers to a copy of the string that is shared by
+ * all interpreters and threads in the process and is valid for the life
+ * of the process. Passing the same string value from any thread will
+ * always return the same pointer so interned strings may be compared
+ * for equality by comparing pointers. The string storage is allocated
+ * only once no matter how many interpreters make use of it.
+ *
+ * The intent is that hot strings be interned once, with the returned
+ * pointer then passed to <Tclh_AtomGetInterned> which maps it to a
+ * per-interpreter Tcl_Obj with a single pointer-keyed probe, bypassing
+ * both string hashing and any locking. The process-wide table itself is
+ * protected by a mutex but that is only contended when a string is
+ * interned, not on subsequent use.
+ *
+ * Returns:
+ * Pointer to the shared copy of the string. The function will panic on
+ * memory allocation failure.
+ */
+TCLH_LOCAL const char *Tclh_AtomInternShared(const char *str);
+
+/* Function: Tclh_AtomRegistryLimit
+ * Places a cap on the number of atoms in the interpreter's registry.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ * maxEntries - maximum number of atoms to retain. Pass 0 to remove the
+ *    cap (the default).
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * When the registry holds maxEntries atoms and a new atom is added, the
+ * least recently used atoms whose only reference is the one held by the
+ * registry itself are evicted. Atoms with external references are never
+ * evicted so the registry may exceed the cap if all atoms are externally
+ * referenced.
+ *
+ * Returns:
+ * TCL_OK    - Cap was set.
+ * TCL_ERROR - Failure. An error message is left in the interpreter result.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_AtomRegistryLimit(Tcl_Interp *interp,
+                                                  Tclh_LibContext *tclhCtxP,
+                                                  Tcl_Size maxEntries);
+
+/* Function: Tclh_AtomRegistryStatsGet
+ * Retrieves usage counters for the interpreter's atom registry.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ * statsP - location to store the counters.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Returns:
+ * TCL_OK    - Counters were stored in statsP.
+ * TCL_ERROR - Failure. An error message is left in the interpreter result.
+ */
+TCLH_LOCAL Tclh_ReturnCode
+Tclh_AtomRegistryStatsGet(Tcl_Interp *interp,
+                          Tclh_LibContext *tclhCtxP,
+                          Tclh_AtomRegistryStats *statsP);
+
+/* Function: Tclh_AtomGetInterned
+ * Returns a Tcl_Obj wrapping a string interned via <Tclh_AtomInternShared>.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ * internedStr - a string pointer returned by <Tclh_AtomInternShared>.
+ *    Passing any other pointer will result in duplicated entries at best.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Unlike <Tclh_AtomGet>, the look up is keyed on the interned pointer
+ * itself and involves neither locks nor string hashing making it suitable
+ * for strings resolved at high frequency. Since Tcl_Obj values cannot be
+ * shared across threads, the returned Tcl_Obj is still owned by the passed
+ * interpreter's registry; only the backing string storage is shared
+ * process-wide. The same rules with respect to reference counts as for
+ * <Tclh_AtomGet> apply.
+ *
+ * Returns:
+ * Pointer to a Tcl_Obj containing the value. The function will panic on
+ * memory allocation failure.
+ */
+TCLH_LOCAL Tcl_Obj *Tclh_AtomGetInterned(Tcl_Interp *interp,
+                                         Tclh_LibContext *tclhCtxP,
+                                         const char *internedStr);
+
 #ifdef TCLH_SHORTNAMES
 #define AtomLibInit Tclh_AtomLibInit
 #define AtomGet     Tclh_AtomGet
+#define AtomInternShared Tclh_AtomInternShared
+#define AtomGetInterned  Tclh_AtomGetInterned
+#define AtomRegistryLimit    Tclh_AtomRegistryLimit
+#define AtomRegistryStatsGet Tclh_AtomRegistryStatsGet
 #endif
 
 #ifdef TCLH_IMPL
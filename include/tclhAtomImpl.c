@@ -7,24 +7,119 @@
 
 #include "tclhAtom.h"
 
+/*
+ * Process-wide table of interned strings shared across all interpreters
+ * and threads. Keys are the string values; entry values are unused since
+ * the hash entry's own key storage serves as the canonical shared copy.
+ * Entries are never deleted; the table lives for the life of the process
+ * which is the whole point - interned strings are stable pointers.
+ * The mutex protects table modification and lookup. Callers are expected
+ * to intern once and thereafter use the returned pointer so the mutex is
+ * not on any hot path.
+ */
+TCL_DECLARE_MUTEX(gAtomSharedMutex)
+static Tcl_HashTable gAtomSharedTable;
+static int gAtomSharedTableInitialized;
+
+/*
+ * The registry maps string values to Tcl_Obj's wrapping them. Each hash
+ * value is a TclhAtomRecord holding the Tcl_Obj and a use stamp taken
+ * from the registry's useClock, used to approximate LRU order when the
+ * registry is capped.
+ */
+typedef struct TclhAtomRecord {
+    Tcl_Obj *objP;
+    unsigned long lastUse;
+} TclhAtomRecord;
+
+typedef struct TclhAtomRegistry {
+    Tcl_HashTable table;     /* Maps string value -> TclhAtomRecord */
+    Tcl_Size maxEntries;     /* Cap on table entries. 0 -> unbounded */
+    Tcl_Size numEntries;     /* Current number of entries */
+    unsigned long useClock;  /* Incremented on every look up */
+    Tclh_AtomRegistryStats stats;
+} TclhAtomRegistry;
+
 static void
 TclhCleanupAtomRegistry(ClientData clientData, Tcl_Interp *interp)
 {
-    Tcl_HashTable *registryP = (Tcl_HashTable *)clientData;
+    TclhAtomRegistry *registryP = (TclhAtomRegistry *)clientData;
     TCLH_ASSERT(registryP);
 
     Tcl_HashEntry *he;
     Tcl_HashSearch hSearch;
 
-    for (he = Tcl_FirstHashEntry(registryP, &hSearch); he != NULL;
+    for (he = Tcl_FirstHashEntry(&registryP->table, &hSearch); he != NULL;
          he = Tcl_NextHashEntry(&hSearch)) {
-        Tcl_Obj *objP = (Tcl_Obj *)Tcl_GetHashValue(he);
-        Tcl_DecrRefCount(objP);
+        TclhAtomRecord *recP = (TclhAtomRecord *)Tcl_GetHashValue(he);
+        Tcl_DecrRefCount(recP->objP);
+        Tcl_Free((void *)recP);
     }
-    Tcl_DeleteHashTable(registryP);
+    Tcl_DeleteHashTable(&registryP->table);
     Tcl_Free((void *)registryP);
 }
 
+/*
+ * Evicts atoms to bring the registry within its cap. Only atoms whose
+ * sole reference is the registry's own are candidates. Atoms not used
+ * within the last maxEntries look ups are evicted; if that yields
+ * nothing, the least recently used candidate is evicted to guarantee
+ * progress. Candidates with external references are left alone so the
+ * registry may remain above the cap.
+ */
+static void
+TclhAtomRegistryEvict(TclhAtomRegistry *registryP)
+{
+    Tcl_HashEntry *he;
+    Tcl_HashSearch hSearch;
+    Tcl_HashEntry *oldestHe = NULL;
+    unsigned long oldestUse = 0;
+    unsigned long cutoff;
+    int evicted            = 0;
+
+    TCLH_ASSERT(registryP->maxEntries > 0);
+
+    if (registryP->useClock > (unsigned long)registryP->maxEntries)
+        cutoff = registryP->useClock - registryP->maxEntries;
+    else
+        cutoff = 0;
+
+    for (he = Tcl_FirstHashEntry(&registryP->table, &hSearch); he != NULL;
+         he = Tcl_NextHashEntry(&hSearch)) {
+        TclhAtomRecord *recP = (TclhAtomRecord *)Tcl_GetHashValue(he);
+        if (recP == NULL) {
+            /*
+             * Entry just created by the caller in Tclh_AtomGet; its value
+             * has not been set yet. Not an eviction candidate.
+             */
+            continue;
+        }
+        if (!Tcl_IsShared(recP->objP)) {
+            /* Registry holds the only reference. Candidate for eviction. */
+            if (recP->lastUse < cutoff) {
+                Tcl_DecrRefCount(recP->objP);
+                Tcl_Free((void *)recP);
+                Tcl_DeleteHashEntry(he);
+                registryP->numEntries -= 1;
+                registryP->stats.numEvictions += 1;
+                evicted = 1;
+            }
+            else if (oldestHe == NULL || recP->lastUse < oldestUse) {
+                oldestHe  = he;
+                oldestUse = recP->lastUse;
+            }
+        }
+    }
+    if (!evicted && oldestHe) {
+        TclhAtomRecord *recP = (TclhAtomRecord *)Tcl_GetHashValue(oldestHe);
+        Tcl_DecrRefCount(recP->objP);
+        Tcl_Free((void *)recP);
+        Tcl_DeleteHashEntry(oldestHe);
+        registryP->numEntries -= 1;
+        registryP->stats.numEvictions += 1;
+    }
+}
+
 Tclh_ReturnCode
 Tclh_AtomLibInit(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
 {
@@ -41,11 +136,12 @@ Tclh_AtomLibInit(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
     if (tclhCtxP->atomRegistryP)
         return TCL_OK; /* Already done */
 
-    Tcl_HashTable *htP =
-        (Tcl_HashTable *)Tcl_Alloc(sizeof(*tclhCtxP->atomRegistryP));
-    Tcl_InitHashTable(htP, TCL_STRING_KEYS);
-    Tcl_CallWhenDeleted(interp, TclhCleanupAtomRegistry, htP);
-    tclhCtxP->atomRegistryP = htP;
+    TclhAtomRegistry *registryP =
+        (TclhAtomRegistry *)Tcl_Alloc(sizeof(*registryP));
+    memset(registryP, 0, sizeof(*registryP));
+    Tcl_InitHashTable(&registryP->table, TCL_STRING_KEYS);
+    Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupAtomRegistry, registryP);
+    tclhCtxP->atomRegistryP = registryP;
 
     return TCL_OK;
 }
@@ -66,16 +162,152 @@ Tclh_AtomGet(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP, const char *str)
             interp, NULL, "Internal error: Tclh context not initialized.");
         return NULL;
     }
-    Tcl_HashTable *htP = tclhCtxP->atomRegistryP;
+    TclhAtomRegistry *registryP = tclhCtxP->atomRegistryP;
+    TclhAtomRecord *recP;
+    Tcl_HashEntry *he;
+    int new_entry;
+
+    registryP->useClock += 1;
+    he = Tcl_CreateHashEntry(&registryP->table, str, &new_entry);
+    if (new_entry) {
+        registryP->stats.numMisses += 1;
+        TCLH_INSTRUMENT_INCR(&tclhCtxP->instrument, atomMisses);
+        if (registryP->maxEntries
+            && registryP->numEntries >= registryP->maxEntries)
+            TclhAtomRegistryEvict(registryP);
+        recP = (TclhAtomRecord *)Tcl_Alloc(sizeof(*recP));
+        recP->objP = Tcl_NewStringObj(str, -1);
+        Tcl_IncrRefCount(recP->objP);
+        Tcl_SetHashValue(he, recP);
+        registryP->numEntries += 1;
+    } else {
+        registryP->stats.numHits += 1;
+        TCLH_INSTRUMENT_INCR(&tclhCtxP->instrument, atomHits);
+        recP = (TclhAtomRecord *)Tcl_GetHashValue(he);
+    }
+    recP->lastUse = registryP->useClock;
+    return recP->objP;
+}
+
+Tclh_ReturnCode
+Tclh_AtomRegistryLimit(Tcl_Interp *interp,
+                       Tclh_LibContext *tclhCtxP,
+                       Tcl_Size maxEntries)
+{
+    Tclh_ReturnCode ret;
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return TCL_ERROR;
+        ret = Tclh_LibInit(interp, &tclhCtxP);
+        if (ret != TCL_OK)
+            return ret;
+    }
+    if (tclhCtxP->atomRegistryP == NULL) {
+        return Tclh_ErrorGeneric(
+            interp, NULL, "Internal error: Tclh context not initialized.");
+    }
+    if (maxEntries < 0)
+        return Tclh_ErrorRange(interp, NULL, 0, TCL_SIZE_MAX);
+    TclhAtomRegistry *registryP = tclhCtxP->atomRegistryP;
+    registryP->maxEntries       = maxEntries;
+    if (maxEntries && registryP->numEntries > maxEntries)
+        TclhAtomRegistryEvict(registryP);
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_AtomRegistryStatsGet(Tcl_Interp *interp,
+                          Tclh_LibContext *tclhCtxP,
+                          Tclh_AtomRegistryStats *statsP)
+{
+    Tclh_ReturnCode ret;
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return TCL_ERROR;
+        ret = Tclh_LibInit(interp, &tclhCtxP);
+        if (ret != TCL_OK)
+            return ret;
+    }
+    if (tclhCtxP->atomRegistryP == NULL) {
+        return Tclh_ErrorGeneric(
+            interp, NULL, "Internal error: Tclh context not initialized.");
+    }
+    *statsP            = tclhCtxP->atomRegistryP->stats;
+    statsP->numEntries = tclhCtxP->atomRegistryP->numEntries;
+    return TCL_OK;
+}
+
+const char *
+Tclh_AtomInternShared(const char *str)
+{
     Tcl_HashEntry *he;
+    const char *internedStr;
     int new_entry;
-    he = Tcl_CreateHashEntry(htP, str, &new_entry);
+
+    Tcl_MutexLock(&gAtomSharedMutex);
+    if (!gAtomSharedTableInitialized) {
+        Tcl_InitHashTable(&gAtomSharedTable, TCL_STRING_KEYS);
+        gAtomSharedTableInitialized = 1;
+    }
+    he = Tcl_CreateHashEntry(&gAtomSharedTable, str, &new_entry);
+    /* The entry's key storage is the canonical process-lifetime copy */
+    internedStr = (const char *)Tcl_GetHashKey(&gAtomSharedTable, he);
+    Tcl_MutexUnlock(&gAtomSharedMutex);
+    return internedStr;
+}
+
+static void
+TclhCleanupAtomShims(ClientData clientData, Tcl_Interp *interp)
+{
+    Tcl_HashTable *shimsP = (Tcl_HashTable *)clientData;
+    TCLH_ASSERT(shimsP);
+
+    Tcl_HashEntry *he;
+    Tcl_HashSearch hSearch;
+
+    for (he = Tcl_FirstHashEntry(shimsP, &hSearch); he != NULL;
+         he = Tcl_NextHashEntry(&hSearch)) {
+        Tcl_Obj *objP = (Tcl_Obj *)Tcl_GetHashValue(he);
+        Tcl_DecrRefCount(objP);
+    }
+    Tcl_DeleteHashTable(shimsP);
+    Tcl_Free((void *)shimsP);
+}
+
+Tcl_Obj *
+Tclh_AtomGetInterned(Tcl_Interp *interp,
+                     Tclh_LibContext *tclhCtxP,
+                     const char *internedStr)
+{
+    Tclh_ReturnCode ret;
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return NULL;
+        ret = Tclh_LibInit(interp, &tclhCtxP);
+        if (ret != TCL_OK)
+            return NULL;
+    }
+    if (tclhCtxP->atomShimsP == NULL) {
+        /*
+         * The shim table is keyed on the interned string's address, not
+         * its content, so look ups are a single pointer-hash probe with
+         * no string compare.
+         */
+        Tcl_HashTable *htP =
+            (Tcl_HashTable *)Tcl_Alloc(sizeof(*tclhCtxP->atomShimsP));
+        Tcl_InitHashTable(htP, TCL_ONE_WORD_KEYS);
+        Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupAtomShims, htP);
+        tclhCtxP->atomShimsP = htP;
+    }
+    Tcl_HashEntry *he;
+    int new_entry;
+    he = Tcl_CreateHashEntry(tclhCtxP->atomShimsP, internedStr, &new_entry);
     if (new_entry) {
-        Tcl_Obj *objP = Tcl_NewStringObj(str, -1);
+        Tcl_Obj *objP = Tcl_NewStringObj(internedStr, -1);
         Tcl_IncrRefCount(objP);
         Tcl_SetHashValue(he, objP);
         return objP;
     } else {
-        return (Tcl_Obj *) Tcl_GetHashValue(he);
+        return (Tcl_Obj *)Tcl_GetHashValue(he);
     }
-}
\ No newline at end of file
+}
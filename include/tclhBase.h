@@ -93,6 +93,16 @@
 #endif
 #endif
 
+#ifndef TCLH_THREAD_LOCAL
+#ifdef _MSC_VER
+# define TCLH_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+# define TCLH_THREAD_LOCAL __thread
+#else
+# define TCLH_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
 #ifndef TCLH_PANIC
 #define TCLH_PANIC Tcl_Panic
 #endif
@@ -140,6 +150,100 @@
 #endif
 #endif
 
+/*
+ * TCLH_INSTRUMENT may be defined by the embedder (like TCLH_IMPL and
+ * TCLH_SHORTNAMES) to compile lightweight usage counters and clock tick
+ * accumulators into the hot paths of the library - pointer registry
+ * probes, lifo chunk allocations and memory high water marks, atom
+ * hits and misses, encoding bytes converted and bignum fallbacks in
+ * the integer conversions. The counters are aggregated per Tclh context
+ * in a <Tclh_InstrumentStats> and exported through a *tclh::stats*
+ * command registered in the interpreter for scraping from scripts.
+ * When the macro is not defined, none of the counters exist and the
+ * instrumentation macros below compile to nothing.
+ */
+#ifdef TCLH_INSTRUMENT
+
+/* Typedef: Tclh_InstrumentStats
+ * Usage counters compiled into the library when *TCLH_INSTRUMENT* is
+ * defined. One instance is embedded in each <Tclh_LibContext> and its
+ * fields are returned as a dictionary by the *tclh::stats* command.
+ * The number of pointer registry collisions is the difference between
+ * pointerProbes and pointerLookups.
+ */
+typedef struct Tclh_InstrumentStats {
+    Tcl_WideUInt pointerLookups; /* Pointer registry look ups */
+    Tcl_WideUInt pointerProbes;  /* Table slots examined across look ups */
+    Tcl_WideUInt pointerRegistrations; /* New pointer registrations */
+    Tcl_WideUInt lifoChunkAllocs;   /* Chunks obtained from the allocator */
+    Tcl_WideUInt lifoChunkRecycles; /* Chunks reused off the free list */
+    Tcl_WideUInt lifoAllocedBytes;  /* Bytes currently held in chunks */
+    Tcl_WideUInt lifoHwmBytes;      /* High water mark of lifoAllocedBytes */
+    Tcl_WideUInt atomHits;   /* Atom look ups that found an existing atom */
+    Tcl_WideUInt atomMisses; /* Atom look ups that created a new atom */
+    Tcl_WideUInt encToExternalBytes; /* Source bytes encoded to external form */
+    Tcl_WideUInt encFromExternalBytes; /* Source bytes decoded from external
+                                          form */
+    Tcl_WideUInt encCycles;        /* Clock ticks spent in conversions */
+    Tcl_WideUInt bignumFallbacks;  /* Integer conversions that went through
+                                      the bignum slow path */
+} Tclh_InstrumentStats;
+
+/*
+ * Reads the processor cycle counter where one is available, falling
+ * back to microseconds elsewhere. Only relative differences between
+ * values on the same thread are meaningful.
+ */
+TCLH_INLINE Tcl_WideUInt Tclh_InstrumentClock(void) {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_AMD64))
+    return (Tcl_WideUInt)__rdtsc();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    unsigned int lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((Tcl_WideUInt)hi << 32) | lo;
+#elif defined(__GNUC__) && defined(__aarch64__)
+    Tcl_WideUInt cnt;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(cnt));
+    return cnt;
+#else
+    Tcl_Time now;
+    Tcl_GetTime(&now);
+    return ((Tcl_WideUInt)now.sec * 1000000) + now.usec;
+#endif
+}
+
+/*
+ * TCLH_INSTRUMENT_ONLY compiles its argument only in instrumented
+ * builds and is used for declarations and updates of local counters.
+ * TCLH_INSTRUMENT_ADD/TCLH_INSTRUMENT_INCR bump a field in a
+ * Tclh_InstrumentStats, tolerating a NULL stats pointer. The
+ * ENTER/LEAVE pair brackets a section whose elapsed clock ticks are to
+ * be accumulated into a field.
+ */
+# define TCLH_INSTRUMENT_ONLY(expr_) expr_
+# define TCLH_INSTRUMENT_ADD(statsP_, field_, count_)          \
+    do {                                                       \
+        Tclh_InstrumentStats *tclhInstrStatsP_ = (statsP_);    \
+        if (tclhInstrStatsP_)                                  \
+            tclhInstrStatsP_->field_ += (count_);              \
+    } while (0)
+# define TCLH_INSTRUMENT_INCR(statsP_, field_) \
+    TCLH_INSTRUMENT_ADD(statsP_, field_, 1)
+# define TCLH_INSTRUMENT_ENTER(ticks_) \
+    Tcl_WideUInt ticks_ = Tclh_InstrumentClock()
+# define TCLH_INSTRUMENT_LEAVE(statsP_, field_, ticks_) \
+    TCLH_INSTRUMENT_ADD(statsP_, field_, Tclh_InstrumentClock() - (ticks_))
+
+#else /* ! TCLH_INSTRUMENT */
+
+# define TCLH_INSTRUMENT_ONLY(expr_)
+# define TCLH_INSTRUMENT_ADD(statsP_, field_, count_) (void)0
+# define TCLH_INSTRUMENT_INCR(statsP_, field_) (void)0
+# define TCLH_INSTRUMENT_ENTER(ticks_)
+# define TCLH_INSTRUMENT_LEAVE(statsP_, field_, ticks_) (void)0
+
+#endif /* TCLH_INSTRUMENT */
+
 /* Typedef: Tclh_LibContext
  *
  * This is a handle to a context internally maintained by the Tclh library
@@ -618,6 +722,58 @@ TCLH_LOCAL Tclh_ReturnCode Tclh_ErrorEncodingFromUtf8(Tcl_Interp *ip,
 Tclh_ReturnCode
 Tclh_ErrorErrnoError(Tcl_Interp *interp, int err, const char *message);
 
+/* Function: Tclh_ErrorDeferredMode
+ * Enables or disables deferred error reporting for a Tclh context.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL if tclhCtxP is not NULL.
+ * tclhCtxP - Tclh context. May be NULL in which case the context
+ *    associated with the interpreter is used.
+ * enable - non-0 to enable deferred mode, 0 to disable it.
+ *
+ * In deferred mode, the <Tclh_ErrorWrongType>, <Tclh_ErrorExists>,
+ * <Tclh_ErrorNotFound>, <Tclh_ErrorOperFailed> and <Tclh_ErrorInvalidValue>
+ * reporters do not format an error message or set the *errorCode*. They
+ * record a compact descriptor on the context, leave the interpreter result
+ * empty and return *TCL_ERROR* as usual. This avoids all allocation and
+ * formatting on code paths that probe for values and discard failures.
+ * When a failure is to be actually reported, <Tclh_ErrorDeferredReport>
+ * formats the recorded error into the interpreter.
+ *
+ * The string arguments passed to the above reporters while deferred mode
+ * is in effect must remain valid until the error is reported or the next
+ * error is recorded; in practice they should be string literals. Reporters
+ * not listed above, including the *Str variants, format eagerly as always.
+ *
+ * Returns:
+ * The previous deferred mode setting, 0 or 1.
+ */
+TCLH_LOCAL int Tclh_ErrorDeferredMode(Tcl_Interp *interp,
+                                      Tclh_LibContext *tclhCtxP,
+                                      int enable);
+
+/* Function: Tclh_ErrorDeferredReport
+ * Formats the error recorded in deferred mode into the interpreter.
+ *
+ * Parameters:
+ * interp - Tcl interpreter in which to report the error. May be NULL if
+ *    tclhCtxP is not NULL.
+ * tclhCtxP - Tclh context. May be NULL in which case the context
+ *    associated with the interpreter is used.
+ *
+ * Builds the message and *errorCode* for the last error recorded while
+ * deferred mode was in effect, exactly as the originating reporter would
+ * have in eager mode, and clears the recorded descriptor. If no error is
+ * recorded, the interpreter result is left untouched so the call is safe
+ * on error paths that may also receive eagerly reported errors.
+ *
+ * Returns:
+ * TCL_ERROR - Always returns this value so caller can just pass on the return
+ *             value from this function.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_ErrorDeferredReport(Tcl_Interp *interp,
+                                                    Tclh_LibContext *tclhCtxP);
+
 #ifdef _WIN32
 /* Function: Tclh_ErrorWindowsError
  * Reports a Windows error code message.
@@ -656,6 +812,8 @@ TCLH_LOCAL Tclh_ReturnCode Tclh_ErrorWindowsError(Tcl_Interp *interp,
 #define ErrorRange      Tclh_ErrorRange
 #define ErrorEncodingFromUtf8 Tclh_ErrorEncodingFromUtf8
 #define ErrorErrnoError Tclh_ErrorErrnoError
+#define ErrorDeferredMode Tclh_ErrorDeferredMode
+#define ErrorDeferredReport Tclh_ErrorDeferredReport
 #ifdef _WIN32
 #define ErrorWindowsError Tclh_ErrorWindowsError
 #endif
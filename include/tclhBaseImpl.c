@@ -8,15 +8,48 @@
 #include "tclhBase.h"
 
 typedef struct TclhPointerRegistry TclhPointerRegistry;
+typedef struct TclhAtomRegistry TclhAtomRegistry;
+typedef struct TclhBignumPool TclhBignumPool;
+typedef struct TclhObjPool TclhObjPool;
+typedef struct TclhPendingError TclhPendingError;
 struct Tclh_LibContext {
     Tcl_Interp *interp;
     TclhPointerRegistry *pointerRegistryP; /* PointerLib */
-    Tcl_HashTable *atomRegistryP;          /* AtomLib */
+    TclhAtomRegistry *atomRegistryP;       /* AtomLib */
+    Tcl_HashTable *atomShimsP;             /* AtomLib - per-interp Tcl_Obj
+                                              shims for shared atoms */
+    struct Tclh_Lifo *scratchLifoP;        /* LifoLib - lazily created scratch
+                                              pool. See Tclh_LibScratchLifo */
+    Tcl_HashTable *encCacheP;              /* EncodingLib - encoding name to
+                                              Tclh_CachedEncoding descriptor */
+    TclhBignumPool *bignumPoolP;           /* ObjLib - lazily created mp_int
+                                              scratch pool. See
+                                              Tclh_BignumPoolCheckout */
+    TclhObjPool *objPoolP;                 /* ObjLib - recycled Tcl_Obj cache.
+                                              See Tclh_ObjPoolAlloc */
+    Tcl_HashTable *errnoCacheP;            /* BaseLib - errno value to
+                                              prebuilt error message objs */
+    TclhPendingError *pendingErrorP;       /* BaseLib - deferred error
+                                              descriptor. See
+                                              Tclh_ErrorDeferredMode */
 #if defined(_WIN32)
     Tcl_Encoding encWinChar;               /* EncodingLib */
 #endif
+#ifdef TCLH_INSTRUMENT
+    Tclh_InstrumentStats instrument;       /* Hot path usage counters. See
+                                              the tclh::stats command */
+#endif
+    unsigned int modInitMask;              /* TCLH_MODINIT_* bits below */
 };
 
+/*
+ * Bits in modInitMask recording which modules have completed their one-time
+ * per-interp initialization, so repeated XxxLibInit calls reduce to a single
+ * branch. Modules whose whole state is a lazily created registry pointer
+ * (pointer, atom) just test that pointer instead.
+ */
+#define TCLH_MODINIT_OBJ 0x1u
+
 char *TclhPrintAddress(const void *address, char *buf, int buflen);
 
 #ifndef TCLH_LIB_CONTEXT_NAME
@@ -24,10 +57,27 @@ char *TclhPrintAddress(const void *address, char *buf, int buflen);
 # define TCLH_LIB_CONTEXT_NAME "TclhLibContext"
 #endif
 
+/*
+ * One-entry cache in front of the assoc data lookup in Tclh_LibInit which
+ * is a string-keyed hash lookup inside Tcl and shows up in profiles because
+ * nearly every entry point accepting a NULL context goes through it. An
+ * interpreter is only ever used from the thread that created it, so the
+ * cache is per-thread, needs no locking, and the deletion callback that
+ * invalidates it always runs on the caching thread.
+ */
+static TCLH_THREAD_LOCAL struct TclhCtxCache {
+    Tcl_Interp *interp;
+    Tclh_LibContext *ctxP;
+} gTclhCtxCache;
+
 static void
 TclhCleanupLib(ClientData clientData, Tcl_Interp *interp)
 {
     Tclh_LibContext *ctxP = (Tclh_LibContext *)clientData;
+    if (gTclhCtxCache.ctxP == ctxP) {
+        gTclhCtxCache.interp = NULL;
+        gTclhCtxCache.ctxP   = NULL;
+    }
     /*
      * Note the CONTENT of ctxP is the responsibility of each module.
      * We do not clean that up here.
@@ -35,11 +85,71 @@ TclhCleanupLib(ClientData clientData, Tcl_Interp *interp)
     Tcl_Free((void *)ctxP);
 }
 
+#ifdef TCLH_INSTRUMENT
+/*
+ * Implements the tclh::stats command registered when a Tclh context is
+ * created. Returns the <Tclh_InstrumentStats> counters of the
+ * interpreter's context as a dictionary. "tclh::stats reset" zeroes the
+ * counters.
+ */
+static int
+TclhStatsObjCmd(ClientData clientData,
+                Tcl_Interp *ip,
+                int objc,
+                Tcl_Obj *const objv[])
+{
+    Tclh_LibContext *ctxP        = (Tclh_LibContext *)clientData;
+    Tclh_InstrumentStats *statsP = &ctxP->instrument;
+    Tcl_Obj *dictObj;
+
+    if (objc > 2) {
+        Tcl_WrongNumArgs(ip, 1, objv, "?reset?");
+        return TCL_ERROR;
+    }
+    if (objc == 2) {
+        if (strcmp(Tcl_GetString(objv[1]), "reset"))
+            return Tclh_ErrorInvalidValue(ip, objv[1], "Must be \"reset\".");
+        memset(statsP, 0, sizeof(*statsP));
+        return TCL_OK;
+    }
+
+    dictObj = Tcl_NewDictObj();
+#define ADDSTAT(field_)                           \
+    Tcl_DictObjPut(NULL,                          \
+                   dictObj,                       \
+                   Tcl_NewStringObj(#field_, -1), \
+                   Tcl_NewWideIntObj((Tcl_WideInt)statsP->field_))
+    ADDSTAT(pointerLookups);
+    ADDSTAT(pointerProbes);
+    ADDSTAT(pointerRegistrations);
+    ADDSTAT(lifoChunkAllocs);
+    ADDSTAT(lifoChunkRecycles);
+    ADDSTAT(lifoAllocedBytes);
+    ADDSTAT(lifoHwmBytes);
+    ADDSTAT(atomHits);
+    ADDSTAT(atomMisses);
+    ADDSTAT(encToExternalBytes);
+    ADDSTAT(encFromExternalBytes);
+    ADDSTAT(encCycles);
+    ADDSTAT(bignumFallbacks);
+#undef ADDSTAT
+    Tcl_SetObjResult(ip, dictObj);
+    return TCL_OK;
+}
+#endif /* TCLH_INSTRUMENT */
+
 Tclh_ReturnCode
 Tclh_LibInit(Tcl_Interp *interp, Tclh_LibContext **tclhCtxPP)
 {
     Tclh_LibContext *ctxP;
     const char *const ctxName = TCLH_LIB_CONTEXT_NAME;
+
+    if (gTclhCtxCache.interp == interp && gTclhCtxCache.ctxP != NULL) {
+        if (tclhCtxPP)
+            *tclhCtxPP = gTclhCtxCache.ctxP;
+        return TCL_OK;
+    }
+
     ctxP = (Tclh_LibContext *)Tcl_GetAssocData(interp, ctxName, NULL);
 
     if (ctxP == NULL) {
@@ -47,6 +157,10 @@ Tclh_LibInit(Tcl_Interp *interp, Tclh_LibContext **tclhCtxPP)
         memset(ctxP, 0, sizeof(*ctxP));
         ctxP->interp = interp;
         Tcl_SetAssocData(interp, ctxName, TclhCleanupLib, ctxP);
+#ifdef TCLH_INSTRUMENT
+        Tcl_CreateObjCommand(
+            interp, "tclh::stats", TclhStatsObjCmd, ctxP, NULL);
+#endif
 
         /* Assumes Tcl stubs init already done but not tommath */
 #if defined(USE_TCL_STUBS) && defined(TCLH_USE_TCL_TOMMATH)
@@ -56,6 +170,8 @@ Tclh_LibInit(Tcl_Interp *interp, Tclh_LibContext **tclhCtxPP)
         }
 #endif
     }
+    gTclhCtxCache.interp = interp;
+    gTclhCtxCache.ctxP   = ctxP;
     if (tclhCtxPP)
         *tclhCtxPP = ctxP;
     return TCL_OK;
@@ -101,6 +217,160 @@ TclhRecordError(Tcl_Interp *interp, const char *code, Tcl_Obj *msgObj)
     return TCL_ERROR;
 }
 
+/*
+ * Deferred error reporting. When enabled on a context through
+ * Tclh_ErrorDeferredMode, the reporters taking Tcl_Obj operands do not
+ * format a message or build an errorCode list. They record the handful of
+ * values needed to do so later and leave the interp result empty, so
+ * callers that probe and swallow failures pay for no allocation or
+ * formatting. Tclh_ErrorDeferredReport materializes the recorded error
+ * when a failure is actually surfaced. The *Str reporter variants keep
+ * eager behavior as their char pointers may reference transient buffers.
+ */
+enum TclhDeferredErrorKind {
+    TCLH_DEFERRED_NONE = 0,
+    TCLH_DEFERRED_WRONG_TYPE,
+    TCLH_DEFERRED_EXISTS,
+    TCLH_DEFERRED_NOT_FOUND,
+    TCLH_DEFERRED_OPER_FAILED,
+    TCLH_DEFERRED_INVALID_VALUE
+};
+struct TclhPendingError {
+    enum TclhDeferredErrorKind kind; /* TCLH_DEFERRED_NONE -> none pending */
+    int enabled;                     /* Deferred mode on/off */
+    const char *strs[2];             /* type/oper and trailing message.
+                                        Must outlive the report */
+    Tcl_Obj *operandObj;             /* Retained operand. May be NULL */
+};
+
+static void
+TclhDeferredErrorClear(TclhPendingError *pendingP)
+{
+    if (pendingP->operandObj) {
+        Tcl_DecrRefCount(pendingP->operandObj);
+        pendingP->operandObj = NULL;
+    }
+    pendingP->kind = TCLH_DEFERRED_NONE;
+}
+
+static void
+TclhCleanupDeferredError(ClientData clientData, Tcl_Interp *interp)
+{
+    TclhPendingError *pendingP = (TclhPendingError *)clientData;
+    TclhDeferredErrorClear(pendingP);
+    Tcl_Free((void *)pendingP);
+}
+
+/* Returns the pending error state if deferred mode is active, else NULL */
+static TclhPendingError *
+TclhDeferredErrorState(Tcl_Interp *interp)
+{
+    Tclh_LibContext *ctxP;
+    if (interp == NULL || Tclh_LibInit(interp, &ctxP) != TCL_OK)
+        return NULL;
+    if (ctxP->pendingErrorP == NULL || !ctxP->pendingErrorP->enabled)
+        return NULL;
+    return ctxP->pendingErrorP;
+}
+
+static Tclh_ReturnCode
+TclhDeferError(Tcl_Interp *interp,
+               TclhPendingError *pendingP,
+               enum TclhDeferredErrorKind kind,
+               const char *s0,
+               const char *s1,
+               Tcl_Obj *operandObj)
+{
+    TclhDeferredErrorClear(pendingP); /* Drop any prior swallowed error */
+    pendingP->kind       = kind;
+    pendingP->strs[0]    = s0;
+    pendingP->strs[1]    = s1;
+    pendingP->operandObj = operandObj;
+    if (operandObj)
+        Tcl_IncrRefCount(operandObj);
+    Tcl_ResetResult(interp);
+    return TCL_ERROR;
+}
+
+int
+Tclh_ErrorDeferredMode(Tcl_Interp *interp,
+                       Tclh_LibContext *tclhCtxP,
+                       int enable)
+{
+    int previous;
+    if (tclhCtxP == NULL) {
+        if (interp == NULL || Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return 0;
+    }
+    if (tclhCtxP->pendingErrorP == NULL) {
+        TclhPendingError *pendingP;
+        if (!enable)
+            return 0;
+        pendingP = (TclhPendingError *)Tcl_Alloc(sizeof(*pendingP));
+        memset(pendingP, 0, sizeof(*pendingP));
+        tclhCtxP->pendingErrorP = pendingP;
+        Tcl_CallWhenDeleted(
+            tclhCtxP->interp, TclhCleanupDeferredError, pendingP);
+    }
+    previous = tclhCtxP->pendingErrorP->enabled;
+    tclhCtxP->pendingErrorP->enabled = (enable != 0);
+    if (!enable)
+        TclhDeferredErrorClear(tclhCtxP->pendingErrorP);
+    return previous;
+}
+
+Tclh_ReturnCode
+Tclh_ErrorDeferredReport(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    TclhPendingError *pendingP;
+    enum TclhDeferredErrorKind kind;
+    const char *s0;
+    const char *s1;
+    Tcl_Obj *operandObj;
+
+    if (tclhCtxP == NULL) {
+        if (interp == NULL || Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return TCL_ERROR;
+    }
+    if (interp == NULL)
+        interp = tclhCtxP->interp;
+    pendingP = tclhCtxP->pendingErrorP;
+    if (pendingP == NULL || pendingP->kind == TCLH_DEFERRED_NONE)
+        return TCL_ERROR; /* Nothing recorded. Result left as is */
+
+    kind = pendingP->kind;
+    s0   = pendingP->strs[0];
+    s1   = pendingP->strs[1];
+    operandObj = pendingP->operandObj; /* We hold its pending reference */
+    pendingP->operandObj = NULL;
+    pendingP->kind       = TCLH_DEFERRED_NONE;
+    /* Re-dispatch through the eager reporters to do the formatting */
+    pendingP->enabled = 0;
+    switch (kind) {
+    case TCLH_DEFERRED_WRONG_TYPE:
+        Tclh_ErrorWrongType(interp, operandObj, s0);
+        break;
+    case TCLH_DEFERRED_EXISTS:
+        Tclh_ErrorExists(interp, s0, operandObj, s1);
+        break;
+    case TCLH_DEFERRED_NOT_FOUND:
+        Tclh_ErrorNotFound(interp, s0, operandObj, s1);
+        break;
+    case TCLH_DEFERRED_OPER_FAILED:
+        Tclh_ErrorOperFailed(interp, s0, operandObj, s1);
+        break;
+    case TCLH_DEFERRED_INVALID_VALUE:
+        Tclh_ErrorInvalidValue(interp, operandObj, s0);
+        break;
+    default:
+        break; /* Not reached */
+    }
+    pendingP->enabled = 1;
+    if (operandObj)
+        Tcl_DecrRefCount(operandObj);
+    return TCL_ERROR;
+}
+
 Tclh_ReturnCode
 Tclh_ErrorGeneric(Tcl_Interp *interp, const char *code, const char *message)
 {
@@ -115,6 +385,11 @@ Tclh_ReturnCode
 Tclh_ErrorWrongType(Tcl_Interp *interp, Tcl_Obj *argObj, const char *message)
 {
     Tcl_Obj *msgObj;
+    TclhPendingError *pendingP = TclhDeferredErrorState(interp);
+    if (pendingP) {
+        return TclhDeferError(
+            interp, pendingP, TCLH_DEFERRED_WRONG_TYPE, message, NULL, argObj);
+    }
     if (message == NULL)
         message = "";
     if (argObj) {
@@ -134,6 +409,11 @@ Tclh_ErrorExists(Tcl_Interp *interp,
                  const char *message)
 {
     Tcl_Obj *msgObj;
+    TclhPendingError *pendingP = TclhDeferredErrorState(interp);
+    if (pendingP) {
+        return TclhDeferError(
+            interp, pendingP, TCLH_DEFERRED_EXISTS, type, message, searchObj);
+    }
     if (type == NULL)
         type = "Object";
     const char *sep;
@@ -160,6 +440,11 @@ Tclh_ErrorNotFound(Tcl_Interp *interp,
                    Tcl_Obj *searchObj,
                    const char *message)
 {
+    TclhPendingError *pendingP = TclhDeferredErrorState(interp);
+    if (pendingP) {
+        return TclhDeferError(
+            interp, pendingP, TCLH_DEFERRED_NOT_FOUND, type, message, searchObj);
+    }
     return Tclh_ErrorNotFoundStr(
         interp, type, searchObj ? Tcl_GetString(searchObj) : NULL, message);
 }
@@ -199,6 +484,15 @@ Tclh_ErrorOperFailed(Tcl_Interp *interp,
 {
     Tcl_Obj *msgObj;
     const char *operand;
+    TclhPendingError *pendingP = TclhDeferredErrorState(interp);
+    if (pendingP) {
+        return TclhDeferError(interp,
+                              pendingP,
+                              TCLH_DEFERRED_OPER_FAILED,
+                              oper,
+                              message,
+                              operandObj);
+    }
     operand = operandObj == NULL ? "object" : Tcl_GetString(operandObj);
     const char *sep;
     if (message == NULL)
@@ -237,6 +531,15 @@ Tclh_ErrorInvalidValue(Tcl_Interp *interp,
                        Tcl_Obj *badArgObj,
                        const char *message)
 {
+    TclhPendingError *pendingP = TclhDeferredErrorState(interp);
+    if (pendingP) {
+        return TclhDeferError(interp,
+                              pendingP,
+                              TCLH_DEFERRED_INVALID_VALUE,
+                              message,
+                              NULL,
+                              badArgObj);
+    }
     return Tclh_ErrorInvalidValueStr(
         interp, badArgObj ? Tcl_GetString(badArgObj) : NULL, message);
 }
@@ -409,6 +712,62 @@ Tclh_ErrorEncodingFromUtf8(Tcl_Interp *ip,
  */
 #include "errnoname.c"
 
+/*
+ * errnoname() is a huge switch. The common low errno range is served from a
+ * direct-indexed table built once on first use so lookup is a bounds check
+ * and a load. Values outside the range (e.g. negative getaddrinfo codes)
+ * fall through to the switch. Note the vendored array variant of errnoname
+ * (ERRNONAME_SAFE_TO_USE_ARRAY) cannot be used as those negative codes make
+ * its designated initializers invalid on common platforms.
+ */
+#define TCLH_ERRNO_TABLE_SIZE 160
+static const char *gErrnoNames[TCLH_ERRNO_TABLE_SIZE];
+static volatile int gErrnoNamesReady;
+TCL_DECLARE_MUTEX(gErrnoNamesMutex)
+
+static const char *
+TclhErrnoName(int err)
+{
+    if (err < 0 || err >= TCLH_ERRNO_TABLE_SIZE)
+        return errnoname(err);
+    if (!gErrnoNamesReady) {
+        int i;
+        Tcl_MutexLock(&gErrnoNamesMutex);
+        if (!gErrnoNamesReady) {
+            for (i = 0; i < TCLH_ERRNO_TABLE_SIZE; ++i)
+                gErrnoNames[i] = errnoname(i);
+            gErrnoNamesReady = 1;
+        }
+        Tcl_MutexUnlock(&gErrnoNamesMutex);
+    }
+    return gErrnoNames[err];
+}
+
+/* Per-context cache of fully built errno error objs. See Tclh_ErrorErrnoError */
+typedef struct TclhErrnoCacheEntry {
+    Tcl_Obj *errorCodeObj;      /* Five element errorCode list */
+    Tcl_Obj *msgObj;            /* strerror text, set as the result */
+} TclhErrnoCacheEntry;
+
+static void
+TclhCleanupErrnoCache(ClientData clientData, Tcl_Interp *interp)
+{
+    Tcl_HashTable *htP = (Tcl_HashTable *)clientData;
+    Tcl_HashEntry *heP;
+    Tcl_HashSearch search;
+
+    for (heP = Tcl_FirstHashEntry(htP, &search); heP;
+         heP = Tcl_NextHashEntry(&search)) {
+        TclhErrnoCacheEntry *entryP =
+            (TclhErrnoCacheEntry *)Tcl_GetHashValue(heP);
+        Tcl_DecrRefCount(entryP->errorCodeObj);
+        Tcl_DecrRefCount(entryP->msgObj);
+        Tcl_Free((void *)entryP);
+    }
+    Tcl_DeleteHashTable(htP);
+    Tcl_Free((void *)htP);
+}
+
 Tclh_ReturnCode
 Tclh_ErrorErrnoError(Tcl_Interp *interp,
                      int err,
@@ -419,10 +778,39 @@ Tclh_ErrorErrnoError(Tcl_Interp *interp,
         char buf[256];
         char *bufP;
         const char *errnoSym;
+        Tcl_HashEntry *heP = NULL;
+
+        /*
+         * Without a caller message the report for a given errno is always
+         * the same, so reporting frequent expected failures (EAGAIN and
+         * friends) reuses shared prebuilt objs and allocates nothing.
+         */
+        if (message == NULL) {
+            Tclh_LibContext *ctxP;
+            if (Tclh_LibInit(interp, &ctxP) == TCL_OK) {
+                int isNew;
+                if (ctxP->errnoCacheP == NULL) {
+                    ctxP->errnoCacheP =
+                        (Tcl_HashTable *)Tcl_Alloc(sizeof(*ctxP->errnoCacheP));
+                    Tcl_InitHashTable(ctxP->errnoCacheP, TCL_ONE_WORD_KEYS);
+                    Tcl_CallWhenDeleted(
+                        interp, TclhCleanupErrnoCache, ctxP->errnoCacheP);
+                }
+                heP = Tcl_CreateHashEntry(
+                    ctxP->errnoCacheP, (char *)(intptr_t)err, &isNew);
+                if (!isNew) {
+                    TclhErrnoCacheEntry *entryP =
+                        (TclhErrnoCacheEntry *)Tcl_GetHashValue(heP);
+                    Tcl_SetObjErrorCode(interp, entryP->errorCodeObj);
+                    Tcl_SetObjResult(interp, entryP->msgObj);
+                    return TCL_ERROR;
+                }
+            }
+        }
 
         objs[0] = Tcl_NewStringObj("CFFI", 4);
         objs[1] = Tcl_NewStringObj("ERRNO", 5);
-        errnoSym = errnoname(err);
+        errnoSym = TclhErrnoName(err);
         if (errnoSym)
             objs[2] = Tcl_NewStringObj(errnoSym, -1);
         else
@@ -454,8 +842,19 @@ Tclh_ErrorErrnoError(Tcl_Interp *interp,
         if (message)
             Tcl_AppendToObj(objs[4], " ", 1);
         Tcl_AppendToObj(objs[4], bufP, -1);
-        Tcl_SetObjErrorCode(interp, Tcl_NewListObj(5, objs));
+        Tcl_Obj *errorCodeObj = Tcl_NewListObj(5, objs);
+        Tcl_SetObjErrorCode(interp, errorCodeObj);
         Tcl_SetObjResult(interp, objs[4]);
+
+        if (heP) {
+            TclhErrnoCacheEntry *entryP =
+                (TclhErrnoCacheEntry *)Tcl_Alloc(sizeof(*entryP));
+            entryP->errorCodeObj = errorCodeObj;
+            Tcl_IncrRefCount(errorCodeObj);
+            entryP->msgObj = objs[4];
+            Tcl_IncrRefCount(objs[4]);
+            Tcl_SetHashValue(heP, entryP);
+        }
     }
     return TCL_ERROR;
 }
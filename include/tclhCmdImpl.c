@@ -7,12 +7,137 @@
 
 #include "tclhCmd.h"
 
+/*
+ * Exact-match index for subcommand tables. Tcl_GetIndexFromObjStruct's miss
+ * path is a linear prefix-matching scan over the whole table which shows up
+ * in dispatch profiles for large ensembles whenever callers pass fresh name
+ * objects. Since subcommand tables are required to be static (see the
+ * function docs), an open-addressing index hashing the name length plus a
+ * few bytes is built per table on first lookup. Build time searches for a
+ * seed placing every name in its home slot so the usual case is a single
+ * probe; tables are per-thread to avoid locking and freed at thread exit.
+ * Prefix abbreviations and the error message still go through
+ * Tcl_GetIndexFromObjStruct.
+ */
+typedef struct TclhSubCommandMap {
+    const Tclh_SubCommand *tableP;  /* Key. The static subcommand table */
+    struct TclhSubCommandMap *nextP;
+    unsigned int seed;
+    int mask;                       /* Size of slots[] - 1. Power of 2 */
+    short slots[1];                 /* mask+1 entries. -1 means empty, else
+                                       index into tableP */
+} TclhSubCommandMap;
+
+static TCLH_THREAD_LOCAL TclhSubCommandMap *gSubCommandMaps;
+
+TCLH_INLINE unsigned int
+TclhSubCommandHash(const char *name, size_t len, unsigned int seed)
+{
+    unsigned int h = seed ^ (unsigned int)len;
+    if (len) {
+        h = h * 31 + (unsigned char)name[0];
+        h = h * 31 + (unsigned char)name[len - 1];
+        h = h * 31 + (unsigned char)name[len >> 1];
+    }
+    return h;
+}
+
+static void
+TclhSubCommandMapsFree(ClientData clientData)
+{
+    TclhSubCommandMap *mapP = gSubCommandMaps;
+    gSubCommandMaps = NULL;
+    while (mapP) {
+        TclhSubCommandMap *nextP = mapP->nextP;
+        Tcl_Free((void *)mapP);
+        mapP = nextP;
+    }
+}
+
+static TclhSubCommandMap *
+TclhSubCommandMapGet(const Tclh_SubCommand *cmdTableP)
+{
+    TclhSubCommandMap *mapP;
+    int numCmds, numSlots, i;
+    unsigned int seed;
+
+    for (mapP = gSubCommandMaps; mapP; mapP = mapP->nextP) {
+        if (mapP->tableP == cmdTableP)
+            return mapP;
+    }
+
+    for (numCmds = 0; cmdTableP[numCmds].cmdName; ++numCmds)
+        ;
+    for (numSlots = 8; numSlots < 2 * numCmds; numSlots *= 2)
+        ;
+    mapP = (TclhSubCommandMap *)Tcl_Alloc(
+        sizeof(*mapP) + (numSlots - 1) * sizeof(mapP->slots[0]));
+    mapP->tableP = cmdTableP;
+    mapP->mask   = numSlots - 1;
+
+    /*
+     * Look for a seed that gives every name its own home slot so lookups
+     * are a single probe. Distinct names can hash identically (same length
+     * and sampled bytes) in which case no seed works; settle for linear
+     * probing from the last seed - lookups below handle both layouts.
+     */
+    for (seed = 0; seed < 32; ++seed) {
+        int collided = 0;
+        memset(mapP->slots, 0xff, numSlots * sizeof(mapP->slots[0]));
+        for (i = 0; i < numCmds; ++i) {
+            const char *name = cmdTableP[i].cmdName;
+            unsigned int h =
+                TclhSubCommandHash(name, strlen(name), seed) & mapP->mask;
+            if (mapP->slots[h] >= 0) {
+                collided = 1;
+                while (mapP->slots[h] >= 0)
+                    h = (h + 1) & mapP->mask;
+            }
+            mapP->slots[h] = (short)i;
+        }
+        if (!collided)
+            break;
+    }
+    mapP->seed = seed < 32 ? seed : 31;
+
+    if (gSubCommandMaps == NULL)
+        Tcl_CreateThreadExitHandler(TclhSubCommandMapsFree, NULL);
+    mapP->nextP     = gSubCommandMaps;
+    gSubCommandMaps = mapP;
+    return mapP;
+}
+
+/* Returns 1 with *indexP set on an exact match, 0 otherwise */
+static int
+TclhSubCommandFindExact(Tcl_Obj *nameObj,
+                        const Tclh_SubCommand *cmdTableP,
+                        int *indexP)
+{
+    TclhSubCommandMap *mapP = TclhSubCommandMapGet(cmdTableP);
+    Tcl_Size nameLen;
+    const char *nameP = Tcl_GetStringFromObj(nameObj, &nameLen);
+    unsigned int h =
+        TclhSubCommandHash(nameP, (size_t)nameLen, mapP->seed) & mapP->mask;
+    while (mapP->slots[h] >= 0) {
+        const char *cmdName = cmdTableP[mapP->slots[h]].cmdName;
+        if (cmdName[0] == nameP[0] && strcmp(cmdName, nameP) == 0) {
+            *indexP = mapP->slots[h];
+            return 1;
+        }
+        h = (h + 1) & mapP->mask;
+    }
+    return 0;
+}
+
 Tclh_ReturnCode
 Tclh_SubCommandNameToIndex(Tcl_Interp *ip,
                            Tcl_Obj *nameObj,
                            Tclh_SubCommand *cmdTableP,
                            int *indexP)
 {
+    if (TclhSubCommandFindExact(nameObj, cmdTableP, indexP))
+        return TCL_OK;
+    /* Not an exact match. Abbreviation or error - take the generic path. */
     return Tcl_GetIndexFromObjStruct(
         ip, nameObj, cmdTableP, sizeof(*cmdTableP), "subcommand", 0, indexP);
 }
@@ -28,9 +153,10 @@ Tclh_SubCommandLookup(Tcl_Interp *ip,
     if (objc < 2) {
         return Tclh_ErrorNumArgs(ip, 1, objv, "subcommand ?arg ...?");
     }
-    if (Tcl_GetIndexFromObjStruct(
-            ip, objv[1], cmdTableP, sizeof(*cmdTableP), "subcommand", 0, indexP)
-        != TCL_OK)
+    if (!TclhSubCommandFindExact(objv[1], cmdTableP, indexP)
+        && Tcl_GetIndexFromObjStruct(
+               ip, objv[1], cmdTableP, sizeof(*cmdTableP), "subcommand", 0, indexP)
+               != TCL_OK)
         return TCL_ERROR;
 
     cmdTableP += *indexP;
@@ -60,6 +186,76 @@ struct OptionDescriptor {
 };
 
 
+/*
+ * The compiled option descriptors are followed in the same allocation by a
+ * small open-addressing index mapping option names to descriptor indices so
+ * matching an argument is a hash probe instead of a linear walk over all
+ * options. Radio options are matched by their choice names, not the option
+ * name, so they are left out of the index and searched linearly on a miss.
+ */
+struct OptionIndex {
+    unsigned int seed;          /* Hash seed. See TclhSubCommandHash */
+    int mask;                   /* Size of slots[] - 1. Power of 2 */
+    short slots[1];             /* -1 means empty, else descriptor index */
+};
+
+static int
+ParseargsIndexNumSlots(Tcl_Size nopts)
+{
+    int numSlots = 8;
+    while (numSlots < 2 * nopts)
+        numSlots *= 2;
+    return numSlots;
+}
+
+TCLH_INLINE size_t ParseargsOptBlockSize(Tcl_Size nopts) {
+    return nopts * sizeof(struct OptionDescriptor)
+           + sizeof(struct OptionIndex)
+           + (ParseargsIndexNumSlots(nopts) - 1) * sizeof(short);
+}
+
+TCLH_INLINE struct OptionIndex *
+ParseargsOptIndex(struct OptionDescriptor *optsP, Tcl_Size nopts) {
+    return (struct OptionIndex *)(optsP + nopts);
+}
+
+static void
+ParseargsBuildIndex(struct OptionDescriptor *optsP, Tcl_Size nopts)
+{
+    struct OptionIndex *indexP = ParseargsOptIndex(optsP, nopts);
+    int numSlots = ParseargsIndexNumSlots(nopts);
+    unsigned int seed;
+    Tcl_Size j;
+
+    indexP->mask = numSlots - 1;
+    /*
+     * Prefer a seed placing every name in its home slot so the usual case
+     * is a single probe; if names collide for every seed, settle for
+     * linear probing from the last one.
+     */
+    for (seed = 0; seed < 32; ++seed) {
+        int collided = 0;
+        memset(indexP->slots, 0xff, numSlots * sizeof(short));
+        for (j = 0; j < nopts; ++j) {
+            unsigned int h;
+            if (optsP[j].type == OPT_RADIO)
+                continue;
+            h = TclhSubCommandHash(
+                    Tcl_GetString(optsP[j].name), optsP[j].name_len, seed)
+                & indexP->mask;
+            if (indexP->slots[h] >= 0) {
+                collided = 1;
+                while (indexP->slots[h] >= 0)
+                    h = (h + 1) & indexP->mask;
+            }
+            indexP->slots[h] = (short)j;
+        }
+        if (!collided)
+            break;
+    }
+    indexP->seed = seed < 32 ? seed : 31;
+}
+
 static int SetParseargsOptFromAny(Tcl_Interp *interp, Tcl_Obj *objP);
 static void DupParseargsOpt(Tcl_Obj *srcP, Tcl_Obj *dstP);
 static void FreeParseargsOpt(Tcl_Obj *objP);
@@ -155,10 +351,16 @@ static void DupParseargsOpt(Tcl_Obj *srcP, Tcl_Obj *dstP)
         return;
     }
 
-    doptsP = (struct OptionDescriptor *) Tcl_Alloc(srcP->internalRep.ptrAndLongRep.value * sizeof(*doptsP));
+    doptsP = (struct OptionDescriptor *)Tcl_Alloc(
+        ParseargsOptBlockSize(srcP->internalRep.ptrAndLongRep.value));
     dstP->internalRep.ptrAndLongRep.ptr = doptsP;
     i = srcP->internalRep.ptrAndLongRep.value;
     dstP->internalRep.ptrAndLongRep.value = i;
+    /* Copy the name index trailing the descriptors. See ParseargsBuildIndex */
+    memcpy(ParseargsOptIndex(doptsP, i),
+           ParseargsOptIndex(soptsP, i),
+           sizeof(struct OptionIndex)
+               + (ParseargsIndexNumSlots(i) - 1) * sizeof(short));
     while (i--) {
         if ((doptsP->name = soptsP->name) != NULL)
             Tcl_IncrRefCount(doptsP->name);
@@ -192,7 +394,9 @@ static int SetParseargsOptFromAny(Tcl_Interp *interp, Tcl_Obj *objP)
         /* Will not fit in int rep ulong type */
 
     } 
-    optsP = nopts ? (struct OptionDescriptor *) Tcl_Alloc(nopts * sizeof(*optsP)) : NULL;
+    optsP = nopts ? (struct OptionDescriptor *)Tcl_Alloc(
+                ParseargsOptBlockSize(nopts))
+                  : NULL;
 
     for (k = 0; k < nopts ; ++k) {
         Tcl_Obj **elems;
@@ -271,6 +475,9 @@ static int SetParseargsOptFromAny(Tcl_Interp *interp, Tcl_Obj *objP)
         }
     }
     
+    if (nopts)
+        ParseargsBuildIndex(optsP, nopts);
+
     /* OK, options are in order. Convert the passed object's internal rep */
     if (objP->typePtr && objP->typePtr->freeIntRepProc) {
         objP->typePtr->freeIntRepProc(objP);
@@ -379,6 +586,9 @@ Tclh_ReturnCode Tclh_ParseargsProc(
     Tcl_Obj *zeroObj = NULL;
     Tcl_Obj *oneObj = NULL;
     Tcl_Obj *emptyObj = NULL;
+#ifdef TCLH_LIFO_E_SUCCESS
+    Tclh_LifoMark mark = NULL;
+#endif
     int status;
 
     /* Oof, ugly, yes. Unnecessary, indeed. Microoptimzation, that too */
@@ -401,8 +611,29 @@ Tclh_ReturnCode Tclh_ParseargsProc(
     nopts = objv[2]->internalRep.ptrAndLongRep.value;
 
     if (nopts > PARSEARGS_STATIC) {
-        valuesP = (Tcl_Obj **) Tcl_Alloc(nopts * sizeof(*valuesP));
-        retP = (Tcl_Obj **)Tcl_Alloc(2*nopts*sizeof(*retP));
+#ifdef TCLH_LIFO_E_SUCCESS
+        /*
+         * Carve the per-parse arrays from the context scratch pool when the
+         * embedder has included the Lifo module - a single mark pop below
+         * releases them instead of a heap round trip per parse.
+         */
+        mark = Tclh_LibScratchPush(interp, NULL);
+        if (mark) {
+            valuesP = (Tcl_Obj **)Tclh_LifoAlloc(
+                Tclh_LibScratchLifo(interp, NULL), 3 * nopts * sizeof(*valuesP));
+            if (valuesP)
+                retP = valuesP + nopts;
+            else {
+                Tclh_LibScratchPop(mark);
+                mark = NULL;
+            }
+        }
+        if (valuesP == NULL)
+#endif
+        {
+            valuesP = (Tcl_Obj **)Tcl_Alloc(nopts * sizeof(*valuesP));
+            retP    = (Tcl_Obj **)Tcl_Alloc(2 * nopts * sizeof(*retP));
+        }
     } else {
         valuesP = values;
         retP = retObjs;
@@ -463,20 +694,33 @@ Tclh_ReturnCode Tclh_ParseargsProc(
             break;
         }
 
-        /* Check against each option in turn */
+        /* Probe the compiled name index for an exact option match */
         radioOpt = NULL;
-        for (j = 0; j < nopts; ++j) {
-            if (opts[j].type != OPT_RADIO) {
-                if (opts[j].name_len == (argp_len-1) &&
-                    opts[j].first == argp[1] &&
-                    ! Tcl_UtfNcmp(Tcl_GetString(opts[j].name), argp+1, (argp_len-1))) {
-                    break;          /* Match ! */
+        j = nopts;              /* Assume no match */
+        if (nopts > 0) {
+            struct OptionIndex *indexP = ParseargsOptIndex(opts, nopts);
+            unsigned int h =
+                TclhSubCommandHash(argp + 1, argp_len - 1, indexP->seed)
+                & indexP->mask;
+            int slot;
+            while ((slot = indexP->slots[h]) >= 0) {
+                if (opts[slot].name_len == (argp_len-1) &&
+                    opts[slot].first == argp[1] &&
+                    ! Tcl_UtfNcmp(Tcl_GetString(opts[slot].name), argp+1, (argp_len-1))) {
+                    j = slot;   /* Match ! */
+                    break;
                 }
-            } else {
-                /* OPT_RADIO - search radio choices */
+                h = (h + 1) & indexP->mask;
+            }
+        }
+        if (j == nopts) {
+            /* Not an option name. Radio options match their choice names. */
+            for (j = 0; j < nopts; ++j) {
                 Tcl_Size choice, nchoices;
                 Tcl_Obj **choices;
-                if (opts[j].valid_values && 
+                if (opts[j].type != OPT_RADIO)
+                    continue;
+                if (opts[j].valid_values &&
                     Tcl_ListObjGetElements(NULL, opts[j].valid_values, &nchoices, &choices) == TCL_OK) {
                     for (choice = 0; choice < nchoices; ++choice) {
                         if (!strcmp(argp+1, Tcl_GetString(choices[choice]))) {
@@ -736,11 +980,18 @@ Tclh_ReturnCode Tclh_ParseargsProc(
     status = TCL_OK;
     
 vamoose: /* status should be TCL_OK or TCL_ERROR */
-    
-    if (valuesP && valuesP != values)
-        Tcl_Free((char *) valuesP);
-    if (retP && retP != retObjs)
-        Tcl_Free((char *)retP);
+
+#ifdef TCLH_LIFO_E_SUCCESS
+    if (mark)
+        Tclh_LibScratchPop(mark);
+    else
+#endif
+    {
+        if (valuesP && valuesP != values)
+            Tcl_Free((char *) valuesP);
+        if (retP && retP != retObjs)
+            Tcl_Free((char *)retP);
+    }
     if (zeroObj)
         Tcl_DecrRefCount(zeroObj);
     if (oneObj)
@@ -146,13 +146,231 @@ int Tclh_UtfToExternalAlloc(Tcl_Interp *interp,
                               Tcl_Size *numBytesOutP,
                               Tcl_Size *errorLocPtr);
 
+/* Typedef: Tclh_CachedEncoding
+ * Describes an encoding cached in a Tclh context by
+ * <Tclh_GetCachedEncoding>. The descriptor and the encoding handle it
+ * holds are owned by the context and remain valid until the interpreter
+ * is deleted. The *encoding* field may be passed to any function taking
+ * a Tcl_Encoding without further lookup; it must not be passed to
+ * Tcl_FreeEncoding.
+ */
+typedef struct Tclh_CachedEncoding {
+    Tcl_Encoding encoding; /* Encoding handle. Owned by the cache */
+    Tcl_Size nulLength;    /* Bytes in the encoding's terminating nul */
+    Tcl_Size charWidth;    /* Bytes per encoded character if the encoding
+                              is fixed width, 0 if variable width */
+} Tclh_CachedEncoding;
+
+/* Function: Tclh_GetCachedEncoding
+ * Returns a cached descriptor for an encoding given its name.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ * encName - name of the encoding as accepted by Tcl_GetEncoding
+ *
+ * The first call for a given name looks the encoding up through
+ * Tcl_GetEncoding and measures its terminating nul length and character
+ * width. Subsequent calls return the cached descriptor with a single
+ * hash probe, avoiding the mutex Tcl's encoding lookup takes on every
+ * call. The cache, and the encodings it holds, are released when the
+ * interpreter is deleted.
+ *
+ * Returns:
+ * Pointer to the descriptor, or NULL if the encoding name is unknown
+ * with an error message left in the interpreter.
+ */
+const Tclh_CachedEncoding *Tclh_GetCachedEncoding(Tcl_Interp *interp,
+                                                  Tclh_LibContext *tclhCtxP,
+                                                  const char *encName);
+
+/*
+ * Encoding streams convert data incrementally, a chunk at a time, carrying
+ * the encoder state across calls. They are intended for payloads that are
+ * too large to hold in memory in both encodings at once, or that arrive
+ * piecemeal, e.g. from a channel. Converted output is staged in two
+ * alternating internal buffers so the chunk returned by one feed remains
+ * valid while the next chunk is being converted into the other buffer.
+ */
+
+/* Enum: Tclh_EncodingDirection
+ * Direction of conversion for an encoding stream.
+ *
+ * TCLH_ENCODING_EXTERNALTOUTF - external encoding to Tcl internal UTF-8
+ * TCLH_ENCODING_UTFTOEXTERNAL - Tcl internal UTF-8 to external encoding
+ */
+typedef enum Tclh_EncodingDirection {
+    TCLH_ENCODING_EXTERNALTOUTF,
+    TCLH_ENCODING_UTFTOEXTERNAL
+} Tclh_EncodingDirection;
+
+/* Default size in bytes of each encoding stream staging buffer */
+#define TCLH_ENCODING_STREAM_BUFFER_SIZE 65536
+
+/* Struct: Tclh_EncodingStream
+ * Holds the state of an incremental encoding conversion. Treat as opaque;
+ * initialize with <Tclh_EncodingStreamInit> and dispose of with
+ * <Tclh_EncodingStreamClose>.
+ */
+typedef struct Tclh_EncodingStream {
+    Tcl_Encoding encoding;    /* Target encoding. Owned by the caller */
+    Tcl_EncodingState state;  /* Encoder state carried across feeds */
+    char *stagingP;           /* Two staging buffers for converted output */
+    Tcl_Size stagingCapacity; /* Capacity of each staging buffer */
+    int flags;                /* TCL_ENCODING_PROFILE_* flags */
+    Tclh_EncodingDirection direction;
+    int activeBuf;            /* Staging buffer the next feed writes (0/1) */
+    int started;              /* TCL_ENCODING_START has been consumed */
+    int finished;             /* TCL_ENCODING_END has been processed */
+    Tcl_Size carryLen;        /* Number of bytes pending in carry[] */
+    char carry[16];           /* Partial sequence spanning a feed boundary */
+} Tclh_EncodingStream;
+
+/* Function: Tclh_EncodingStreamInit
+ * Initializes an encoding stream for incremental conversion.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * streamP - stream to initialize
+ * encoding - Tcl encoding to convert to or from. The caller retains
+ *    ownership and must keep it alive until the stream is closed.
+ * direction - direction of conversion
+ * flags - TCL_ENCODING_PROFILE_* flags applied to every conversion.
+ *    TCL_ENCODING_START and TCL_ENCODING_END are managed by the stream
+ *    itself and ignored if passed.
+ * bufferSize - size in bytes of each of the two staging buffers. Pass 0
+ *    for the default <TCLH_ENCODING_STREAM_BUFFER_SIZE>.
+ *
+ * An initialized stream must be disposed of with
+ * <Tclh_EncodingStreamClose>.
+ *
+ * Returns:
+ * TCL_OK on success, TCL_ERROR on allocation failure.
+ */
+Tclh_ReturnCode Tclh_EncodingStreamInit(Tcl_Interp *interp,
+                                        Tclh_EncodingStream *streamP,
+                                        Tcl_Encoding encoding,
+                                        Tclh_EncodingDirection direction,
+                                        int flags,
+                                        Tcl_Size bufferSize);
+
+/* Function: Tclh_EncodingStreamFeed
+ * Converts one chunk of an incremental conversion.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * streamP - stream initialized with <Tclh_EncodingStreamInit>
+ * srcP - chunk of data to convert. May be NULL if srcLen is 0.
+ * srcLen - length of the chunk. If negative, srcP must be nul terminated.
+ * final - non-zero if this chunk ends the input. The converter is then
+ *    allowed to flush any pending encoder state.
+ * srcReadP - location to store the number of source bytes consumed.
+ *    May be NULL.
+ * outPP - location to store a pointer to the converted output. The
+ *    pointer is into one of the stream's staging buffers and remains
+ *    valid only until the feed after the next one. May be NULL.
+ * outLenP - location to store the length in bytes of the converted
+ *    output. May be NULL.
+ *
+ * A partial multibyte sequence at the end of a chunk is retained inside
+ * the stream and completed by the following feed; such bytes are reported
+ * as consumed. If the staging buffer fills before the whole chunk is
+ * converted, TCL_CONVERT_NOSPACE is returned and the caller should
+ * consume the output and feed the remaining bytes again with the same
+ * *final* value, repeating until TCL_OK is returned. Once a feed with
+ * *final* set returns TCL_OK the stream is finished and must not be fed
+ * again.
+ *
+ * Returns:
+ * TCL_OK, or one of the TCL_CONVERT_* status codes as for
+ * Tcl_ExternalToUtf.
+ */
+int Tclh_EncodingStreamFeed(Tcl_Interp *interp,
+                            Tclh_EncodingStream *streamP,
+                            const char *srcP,
+                            Tcl_Size srcLen,
+                            int final,
+                            Tcl_Size *srcReadP,
+                            char **outPP,
+                            Tcl_Size *outLenP);
+
+/* Function: Tclh_EncodingStreamCopyChannel
+ * Converts the remaining content of a channel onto another channel.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * streamP - stream initialized with <Tclh_EncodingStreamInit>
+ * inChannel - channel to read from. Should be in blocking mode and
+ *    configured with the binary encoding.
+ * outChannel - channel to write converted output to. Should be
+ *    configured with the binary encoding.
+ * numBytesOutP - location to store the total number of converted bytes
+ *    written. May be NULL.
+ *
+ * The data is pumped a staging buffer at a time so memory use is bounded
+ * by the stream buffer size irrespective of the payload size.
+ *
+ * Returns:
+ * TCL_OK on success, TCL_ERROR on a conversion or I/O error with an
+ * error message in the interpreter.
+ */
+Tclh_ReturnCode Tclh_EncodingStreamCopyChannel(Tcl_Interp *interp,
+                                               Tclh_EncodingStream *streamP,
+                                               Tcl_Channel inChannel,
+                                               Tcl_Channel outChannel,
+                                               Tcl_Size *numBytesOutP);
+
+/* Function: Tclh_EncodingStreamClose
+ * Releases the resources held by an encoding stream.
+ *
+ * Parameters:
+ * streamP - stream to close. The stream must not be used again except to
+ *    reinitialize it. The encoding passed at initialization is not freed.
+ */
+void Tclh_EncodingStreamClose(Tclh_EncodingStream *streamP);
+
 #ifdef TCLH_LIFO_E_SUCCESS /* Only define if Lifo module is available */
 
+/* Function: Tclh_EncodingStreamFeedToBuffer
+ * Converts one chunk of an incremental conversion, appending the output
+ * to a Tclh_LifoBuffer.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL.
+ * streamP - stream initialized with <Tclh_EncodingStreamInit>
+ * srcP - chunk of data to convert. May be NULL if srcLen is 0.
+ * srcLen - length of the chunk. If negative, srcP must be nul terminated.
+ * final - non-zero if this chunk ends the input
+ * bufP - buffer to append converted output to
+ *
+ * This is a convenience wrapper that loops <Tclh_EncodingStreamFeed>
+ * until the whole chunk is consumed so TCL_CONVERT_NOSPACE never
+ * surfaces for staging buffer exhaustion.
+ *
+ * The *tclhLifo.h* file must be included before *tclhEncoding.h*
+ * for this function to be present.
+ *
+ * Returns:
+ * TCL_OK, or one of the TCL_CONVERT_* status codes as for
+ * Tcl_ExternalToUtf.
+ */
+int Tclh_EncodingStreamFeedToBuffer(Tcl_Interp *interp,
+                                    Tclh_EncodingStream *streamP,
+                                    const char *srcP,
+                                    Tcl_Size srcLen,
+                                    int final,
+                                    Tclh_LifoBuffer *bufP);
+
 /* Function: Tclh_UtfToExternalLifo
  * Transforms Tcl's internal UTF-8 encoded data to the given encoding
  *
  * Parameters:
- * memlifoP - The Tclh_MemLifo from which to allocate memory.
+ * memlifoP - The Tclh_MemLifo from which to allocate memory. May be NULL
+ *    to allocate from the context scratch pool (<Tclh_LibScratchLifo>) in
+ *    which case the caller should bracket the call and use of the output
+ *    with <Tclh_LibScratchPush> and <Tclh_LibScratchPop>.
  * numBytesOutP - location to store number of bytes copied to the buffer
  *    not counting the terminating nul bytes. May be NULL.
  *
@@ -173,6 +391,29 @@ int Tclh_UtfToExternalLifo(Tcl_Interp *ip,
                            Tcl_Size *numBytesOutP,
                            Tcl_Size *errorLocPtr);
 
+/* Function: Tclh_UtfToExternalLifoCached
+ * Transforms Tcl's internal UTF-8 encoded data to a cached encoding.
+ *
+ * Parameters:
+ * encP - cached encoding descriptor returned by <Tclh_GetCachedEncoding>
+ *
+ * The remaining parameters are as for <Tclh_UtfToExternalLifo>. This
+ * variant uses the nul length stored in the descriptor instead of
+ * probing the encoding on every call.
+ *
+ * The *tclhLifo.h* file must be included before *tclhEncoding.h*
+ * for this function to be present.
+ */
+int Tclh_UtfToExternalLifoCached(Tcl_Interp *ip,
+                                 const Tclh_CachedEncoding *encP,
+                                 const char *fromP,
+                                 Tcl_Size fromLen,
+                                 int flags,
+                                 Tclh_Lifo *memlifoP,
+                                 char **outPP,
+                                 Tcl_Size *numBytesOutP,
+                                 Tcl_Size *errorLocPtr);
+
 #endif
 
 /* Function: Tclh_ObjToMultiSzLifo
@@ -182,7 +423,10 @@ int Tclh_UtfToExternalLifo(Tcl_Interp *ip,
  * tclhCtxP - Tclh context. May be NULL in which case a temporary Tcl_Encoding
  *    context is used.
  * encoding - Tcl encoding
- * memLifoP - The memlifo from which to allocate memory
+ * memLifoP - The memlifo from which to allocate memory. May be NULL to
+ *    allocate from the context scratch pool (<Tclh_LibScratchLifo>) in
+ *    which case the caller should bracket the call and use of the output
+ *    with <Tclh_LibScratchPush> and <Tclh_LibScratchPop>.
  * objP - *Tcl_Obj* containing list of strings
  * flags - TCL_ENCODING_PROFILE_* flags
  * numElemsP - output location to hold the number of strings. May be NULL.
@@ -270,6 +514,38 @@ WCHAR *Tclh_ObjToWinCharsAlloc(Tclh_LibContext *tclhCtxP,
                                Tcl_Obj *objP,
                                Tcl_Size *numCharsP);
 
+/* Function: Tclh_ObjToWinCharsCached
+ * Returns the WCHAR rendering of a Tcl_Obj value, caching it in the
+ * value's internal representation.
+ *
+ * Parameters:
+ * tclhCtxP - Tclh context. May be NULL in which case a temporary Tcl_Encoding
+ *    context is used.
+ * objP - *Tcl_Obj* to be converted
+ * numCharsP - output location to hold the length (in number of characters,
+ *     not bytes) of the string. May be NULL. The length does not
+ *     include the terminating nul WCHAR.
+ *
+ * The first call converts the value's string representation and stores
+ * the result in the Tcl_Obj's internal representation. Later calls on the
+ * unchanged value return the cached rendering with no conversion or
+ * allocation. Any modification of the value replaces its internal
+ * representation and thereby drops the cache, so a changed value is
+ * reconverted on the next call.
+ *
+ * If the Tcl version supports encoding profiles, the encoding is converted
+ * using the replace profile.
+ *
+ * Returns:
+ * Pointer to a nul-terminated WCHAR string owned by the Tcl_Obj, or NULL
+ * on conversion failure. The pointer is valid only as long as the Tcl_Obj
+ * is alive and its internal representation unchanged. Callers must not
+ * free or modify it.
+ */
+const WCHAR *Tclh_ObjToWinCharsCached(Tclh_LibContext *tclhCtxP,
+                                      Tcl_Obj *objP,
+                                      Tcl_Size *numCharsP);
+
 #ifdef TCLH_LIFO_E_SUCCESS /* Only define if Lifo module is available */
 
 /* Function: Tclh_ObjToWinCharsLifo
@@ -345,10 +621,18 @@ Tcl_Obj *Tclh_ObjFromWinCharsMulti(Tclh_LibContext *tclhCtxP,
 # define ExternalToUtf Tclh_ExternalToUtf
 # define UtfToExternal Tclh_UtfToExternal
 # define ExternalToUtfAlloc Tclh_ExternalToUtfAlloc
+# define GetCachedEncoding Tclh_GetCachedEncoding
+# define UtfToExternalLifoCached Tclh_UtfToExternalLifoCached
+# define EncodingStreamInit Tclh_EncodingStreamInit
+# define EncodingStreamFeed Tclh_EncodingStreamFeed
+# define EncodingStreamFeedToBuffer Tclh_EncodingStreamFeedToBuffer
+# define EncodingStreamCopyChannel Tclh_EncodingStreamCopyChannel
+# define EncodingStreamClose Tclh_EncodingStreamClose
 # define UtfToExternalLifo Tclh_UtfToExternalLifo
 # define ObjToMultiSzLifo Tclh_ObjToMultiSzLifo
 # ifdef _WIN32
 #  define ObjFromWinChars Tclh_ObjFromWinChars
+#  define ObjToWinCharsCached Tclh_ObjToWinCharsCached
 #  define ObjToWinCharsLifo Tclh_ObjToWinCharsLifo
 #  define ObjToWinCharsMultiLifo Tclh_ObjToWinCharsMultiLifo
 # endif
@@ -247,6 +247,17 @@ Tclh_UtfToExternal(Tcl_Interp *interp,
 }
 #endif
 
+#ifdef TCLH_INSTRUMENT
+/* Resolves the stats sink of interp's Tclh context. NULL if no interp. */
+static Tclh_InstrumentStats *TclhEncInstrument(Tcl_Interp *interp)
+{
+    Tclh_LibContext *ctxP = NULL;
+    if (interp == NULL || Tclh_LibInit(interp, &ctxP) != TCL_OK)
+        return NULL;
+    return &ctxP->instrument;
+}
+#endif
+
 int
 Tclh_ExternalToUtfAlloc(
     Tcl_Interp *interp,
@@ -260,6 +271,7 @@ Tclh_ExternalToUtfAlloc(
 {
     Tcl_DString ds;
     int ret;
+    TCLH_INSTRUMENT_ENTER(instrTicks);
 
 #ifdef TCLH_TCL87API
     ret = Tcl_ExternalToUtfDStringEx(
@@ -294,6 +306,15 @@ Tclh_ExternalToUtfAlloc(
         *bufPP = ds.string;
     }
     /* !!! ds fields are garbage at this point do NOT access!!!! */
+#ifdef TCLH_INSTRUMENT
+    {
+        Tclh_InstrumentStats *statsP = TclhEncInstrument(interp);
+        TCLH_INSTRUMENT_ADD(statsP,
+                            encFromExternalBytes,
+                            srcLen < 0 ? strlen(src) : (size_t)srcLen);
+        TCLH_INSTRUMENT_LEAVE(statsP, encCycles, instrTicks);
+    }
+#endif
     return ret;
 }
 
@@ -310,6 +331,7 @@ Tclh_UtfToExternalAlloc(
 {
     Tcl_DString ds;
     int ret;
+    TCLH_INSTRUMENT_ENTER(instrTicks);
 
 #ifdef TCLH_TCL87API
     ret = Tcl_UtfToExternalDStringEx(
@@ -349,11 +371,444 @@ Tclh_UtfToExternalAlloc(
         *bufPP = ds.string;
     }
     /* !!! ds fields are garbage at this point do NOT access!!!! */
+#ifdef TCLH_INSTRUMENT
+    {
+        Tclh_InstrumentStats *statsP = TclhEncInstrument(interp);
+        TCLH_INSTRUMENT_ADD(statsP,
+                            encToExternalBytes,
+                            srcLen < 0 ? strlen(src) : (size_t)srcLen);
+        TCLH_INSTRUMENT_LEAVE(statsP, encCycles, instrTicks);
+    }
+#endif
     return ret;
 }
 
+static void
+TclhCleanupEncodingCache(ClientData clientData, Tcl_Interp *interp)
+{
+    Tcl_HashTable *cacheP = (Tcl_HashTable *)clientData;
+    TCLH_ASSERT(cacheP);
+
+    Tcl_HashEntry *he;
+    Tcl_HashSearch hSearch;
+
+    for (he = Tcl_FirstHashEntry(cacheP, &hSearch); he != NULL;
+         he = Tcl_NextHashEntry(&hSearch)) {
+        Tclh_CachedEncoding *encP = (Tclh_CachedEncoding *)Tcl_GetHashValue(he);
+        Tcl_FreeEncoding(encP->encoding);
+        Tcl_Free((void *)encP);
+    }
+    Tcl_DeleteHashTable(cacheP);
+    Tcl_Free((void *)cacheP);
+}
+
+/* Returns the bytes per encoded character for a probe string, 0 on failure */
+static Tcl_Size
+TclhEncodingProbeWidth(Tcl_Encoding encoding,
+                       const char *utf8P,
+                       Tcl_Size utf8Len)
+{
+    char buf[32];
+    Tcl_Size srcRead, dstWrote, dstChars;
+    int status;
+
+    status = Tclh_UtfToExternal(NULL,
+                                encoding,
+                                utf8P,
+                                utf8Len,
+#ifdef TCLH_TCL87API
+                                TCL_ENCODING_PROFILE_REPLACE |
+#endif
+                                    TCL_ENCODING_START | TCL_ENCODING_END,
+                                NULL,
+                                buf,
+                                sizeof(buf),
+                                &srcRead,
+                                &dstWrote,
+                                &dstChars);
+    if (status != TCL_OK || srcRead != utf8Len || dstChars <= 0
+        || (dstWrote % dstChars) != 0)
+        return 0;
+    return dstWrote / dstChars;
+}
+
+const Tclh_CachedEncoding *
+Tclh_GetCachedEncoding(Tcl_Interp *interp,
+                       Tclh_LibContext *tclhCtxP,
+                       const char *encName)
+{
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return NULL;
+        if (Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return NULL;
+    }
+    if (tclhCtxP->encCacheP == NULL) {
+        Tcl_HashTable *htP =
+            (Tcl_HashTable *)Tcl_Alloc(sizeof(*tclhCtxP->encCacheP));
+        Tcl_InitHashTable(htP, TCL_STRING_KEYS);
+        Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupEncodingCache, htP);
+        tclhCtxP->encCacheP = htP;
+    }
+    Tcl_HashEntry *he;
+    int new_entry;
+    he = Tcl_CreateHashEntry(tclhCtxP->encCacheP, encName, &new_entry);
+    if (!new_entry)
+        return (const Tclh_CachedEncoding *)Tcl_GetHashValue(he);
+
+    Tcl_Encoding encoding =
+        Tcl_GetEncoding(interp ? interp : tclhCtxP->interp, encName);
+    if (encoding == NULL) {
+        Tcl_DeleteHashEntry(he);
+        return NULL;
+    }
+
+    Tclh_CachedEncoding *encP =
+        (Tclh_CachedEncoding *)Tcl_Alloc(sizeof(*encP));
+    encP->encoding  = encoding;
+    encP->nulLength = Tclh_GetEncodingNulLength(encoding);
+
+    /*
+     * Probe with characters of increasing UTF-8 length. The encoding is
+     * deemed fixed width only if every probe encodes to the same number
+     * of bytes per character.
+     */
+    static const struct {
+        const char *utf8;
+        Tcl_Size len;
+    } probes[] = {
+        {"A", 1},
+        {"\xC3\xA9", 2},     /* U+00E9 */
+        {"\xE4\xB8\x80", 3}, /* U+4E00 */
+#if TCL_UTF_MAX < 4
+        {"\xED\xA0\x81\xED\xB0\x80", 6}, /* U+10400 as surrogate pair */
+#else
+        {"\xF0\x90\x90\x80", 4}, /* U+10400 */
+#endif
+    };
+    Tcl_Size width =
+        TclhEncodingProbeWidth(encoding, probes[0].utf8, probes[0].len);
+    int i;
+    for (i = 1; width != 0 && i < (int)(sizeof(probes) / sizeof(probes[0]));
+         ++i) {
+        if (TclhEncodingProbeWidth(encoding, probes[i].utf8, probes[i].len)
+            != width)
+            width = 0;
+    }
+    encP->charWidth = width;
+
+    Tcl_SetHashValue(he, encP);
+    return encP;
+}
+
+Tclh_ReturnCode
+Tclh_EncodingStreamInit(Tcl_Interp *interp,
+                        Tclh_EncodingStream *streamP,
+                        Tcl_Encoding encoding,
+                        Tclh_EncodingDirection direction,
+                        int flags,
+                        Tcl_Size bufferSize)
+{
+    if (bufferSize <= 0)
+        bufferSize = TCLH_ENCODING_STREAM_BUFFER_SIZE;
+    else if (bufferSize < 64)
+        bufferSize = 64; /* Tcl encoders need room for at least one sequence */
+
+    memset(streamP, 0, sizeof(*streamP));
+    streamP->encoding  = encoding;
+    streamP->direction = direction;
+    streamP->flags     = flags & ~(TCL_ENCODING_START | TCL_ENCODING_END);
+    streamP->stagingCapacity = bufferSize;
+    streamP->stagingP = Tcl_AttemptAlloc(2 * bufferSize);
+    if (streamP->stagingP == NULL) {
+        return Tclh_ErrorAllocation(
+            interp, "buffer", "Allocation of encoding stream buffers failed.");
+    }
+    return TCL_OK;
+}
+
+void
+Tclh_EncodingStreamClose(Tclh_EncodingStream *streamP)
+{
+    if (streamP->stagingP) {
+        Tcl_Free(streamP->stagingP);
+        streamP->stagingP = NULL;
+    }
+}
+
+/* Runs one conversion call for a stream, managing the START/END flags */
+static int
+TclhEncodingStreamConvert(Tcl_Interp *ip,
+                          Tclh_EncodingStream *streamP,
+                          const char *srcP,
+                          Tcl_Size srcLen,
+                          int endFlag,
+                          char *dstP,
+                          Tcl_Size dstCapacity,
+                          Tcl_Size *srcReadP,
+                          Tcl_Size *dstWroteP)
+{
+    int flags = streamP->flags;
+    int status;
+
+    if (!streamP->started)
+        flags |= TCL_ENCODING_START;
+    if (endFlag)
+        flags |= TCL_ENCODING_END;
+    if (streamP->direction == TCLH_ENCODING_EXTERNALTOUTF) {
+        status = Tclh_ExternalToUtf(ip,
+                                    streamP->encoding,
+                                    srcP,
+                                    srcLen,
+                                    flags,
+                                    &streamP->state,
+                                    dstP,
+                                    dstCapacity,
+                                    srcReadP,
+                                    dstWroteP,
+                                    NULL);
+    }
+    else {
+        status = Tclh_UtfToExternal(ip,
+                                    streamP->encoding,
+                                    srcP,
+                                    srcLen,
+                                    flags,
+                                    &streamP->state,
+                                    dstP,
+                                    dstCapacity,
+                                    srcReadP,
+                                    dstWroteP,
+                                    NULL);
+    }
+    streamP->started = 1;
+    return status;
+}
+
+int
+Tclh_EncodingStreamFeed(Tcl_Interp *interp,
+                        Tclh_EncodingStream *streamP,
+                        const char *srcP,
+                        Tcl_Size srcLen,
+                        int final,
+                        Tcl_Size *srcReadP,
+                        char **outPP,
+                        Tcl_Size *outLenP)
+{
+    char *dstP =
+        streamP->stagingP + (streamP->activeBuf * streamP->stagingCapacity);
+    Tcl_Size dstCapacity = streamP->stagingCapacity;
+    Tcl_Size dstUsed     = 0;
+    Tcl_Size srcRead     = 0;
+    int status           = TCL_OK;
+
+    TCLH_ASSERT(streamP->stagingP);
+    TCLH_ASSERT(!streamP->finished);
+
+    if (srcLen < 0)
+        srcLen = Tclh_strlen(srcP);
+
+    /*
+     * A partial sequence straddling the previous feed boundary has to be
+     * completed first. Bytes moved into the carry count as consumed from
+     * the source; the converter resumes the sequence from the carry.
+     */
+    if (streamP->carryLen > 0) {
+        Tcl_Size topUp = (Tcl_Size)sizeof(streamP->carry) - streamP->carryLen;
+        Tcl_Size carryRead, wrote;
+        if (topUp > srcLen)
+            topUp = srcLen;
+        memcpy(streamP->carry + streamP->carryLen, srcP, topUp);
+        streamP->carryLen += topUp;
+        srcRead = topUp;
+        status  = TclhEncodingStreamConvert(interp,
+                                            streamP,
+                                            streamP->carry,
+                                            streamP->carryLen,
+                                            final && srcRead == srcLen,
+                                            dstP,
+                                            dstCapacity,
+                                            &carryRead,
+                                            &wrote);
+        dstUsed = wrote;
+        if (carryRead < streamP->carryLen) {
+            memmove(streamP->carry,
+                    streamP->carry + carryRead,
+                    streamP->carryLen - carryRead);
+        }
+        streamP->carryLen -= carryRead;
+        switch (status) {
+        case TCL_CONVERT_MULTIBYTE:
+            if (streamP->carryLen == sizeof(streamP->carry)
+                && srcRead < srcLen) {
+                /* Sequence longer than the carry. No real encoding does this */
+                goto done;
+            }
+            status = TCL_OK;
+            if (srcRead == srcLen)
+                goto done; /* Rest of the sequence awaited from next feed */
+            break;
+        case TCL_OK:
+            if (final && srcRead == srcLen) {
+                /* END was passed above. Do not run the converter again */
+                streamP->finished = 1;
+                goto done;
+            }
+            break;
+        default:
+            /* TCL_CONVERT_NOSPACE, TCL_CONVERT_SYNTAX, TCL_CONVERT_UNKNOWN */
+            goto done;
+        }
+    }
+
+    /*
+     * Convert directly from the caller's buffer. A final feed always makes
+     * the call, even with no input, so the encoder can flush its state.
+     */
+    if (srcRead < srcLen || final) {
+        Tcl_Size read, wrote;
+        status = TclhEncodingStreamConvert(interp,
+                                           streamP,
+                                           srcP + srcRead,
+                                           srcLen - srcRead,
+                                           final,
+                                           dstP + dstUsed,
+                                           dstCapacity - dstUsed,
+                                           &read,
+                                           &wrote);
+        srcRead += read;
+        dstUsed += wrote;
+        if (status == TCL_CONVERT_MULTIBYTE && !final) {
+            /* Retain the trailing partial sequence until the next feed */
+            Tcl_Size tailLen = srcLen - srcRead;
+            if (tailLen <= (Tcl_Size)sizeof(streamP->carry)) {
+                memcpy(streamP->carry, srcP + srcRead, tailLen);
+                streamP->carryLen = tailLen;
+                srcRead           = srcLen;
+                status            = TCL_OK;
+            }
+        }
+        if (status == TCL_OK && final && srcRead == srcLen)
+            streamP->finished = 1;
+    }
+
+done:
+    if (srcReadP)
+        *srcReadP = srcRead;
+    if (outPP)
+        *outPP = dstP;
+    if (outLenP)
+        *outLenP = dstUsed;
+    /* Flip buffers so the returned chunk stays valid across the next feed */
+    streamP->activeBuf ^= 1;
+    return status;
+}
+
+Tclh_ReturnCode
+Tclh_EncodingStreamCopyChannel(Tcl_Interp *interp,
+                               Tclh_EncodingStream *streamP,
+                               Tcl_Channel inChannel,
+                               Tcl_Channel outChannel,
+                               Tcl_Size *numBytesOutP)
+{
+    char *readBufP;
+    Tcl_Size numOut = 0;
+    int final       = 0;
+    int status      = TCL_OK;
+
+    readBufP = Tcl_Alloc(streamP->stagingCapacity);
+    while (!streamP->finished) {
+        Tcl_Size numRead;
+        Tcl_Size fed = 0;
+
+        numRead = Tcl_ReadRaw(inChannel, readBufP, streamP->stagingCapacity);
+        if (numRead < 0) {
+            Tclh_ErrorOperFailed(
+                interp, "read", NULL, Tcl_ErrnoMsg(Tcl_GetErrno()));
+            status = TCL_ERROR;
+            break;
+        }
+        final = Tcl_Eof(inChannel) != 0;
+        do {
+            char *outP;
+            Tcl_Size chunkRead, outLen;
+            status = Tclh_EncodingStreamFeed(interp,
+                                             streamP,
+                                             readBufP + fed,
+                                             numRead - fed,
+                                             final,
+                                             &chunkRead,
+                                             &outP,
+                                             &outLen);
+            fed += chunkRead;
+            if (outLen > 0) {
+                if (Tcl_WriteRaw(outChannel, outP, outLen) < 0) {
+                    Tclh_ErrorOperFailed(
+                        interp, "write", NULL, Tcl_ErrnoMsg(Tcl_GetErrno()));
+                    status = TCL_ERROR;
+                    break;
+                }
+                numOut += outLen;
+            }
+        } while (status == TCL_CONVERT_NOSPACE);
+        if (status != TCL_OK)
+            break;
+    }
+    Tcl_Free(readBufP);
+
+    if (status != TCL_OK && status != TCL_ERROR) {
+        /* A TCL_CONVERT_* code from the converter itself */
+        if (streamP->direction == TCLH_ENCODING_UTFTOEXTERNAL)
+            Tclh_ErrorEncodingFromUtf8(interp, status, NULL, 0);
+        else
+            Tclh_ErrorInvalidValueStr(
+                interp, NULL, "Encoded data invalid or truncated.");
+        status = TCL_ERROR;
+    }
+    if (numBytesOutP)
+        *numBytesOutP = numOut;
+    return status;
+}
+
 #ifdef TCLH_LIFO_E_SUCCESS
 
+int
+Tclh_EncodingStreamFeedToBuffer(Tcl_Interp *interp,
+                                Tclh_EncodingStream *streamP,
+                                const char *srcP,
+                                Tcl_Size srcLen,
+                                int final,
+                                Tclh_LifoBuffer *bufP)
+{
+    Tcl_Size srcRead = 0;
+    int status;
+
+    if (srcLen < 0)
+        srcLen = Tclh_strlen(srcP);
+
+    do {
+        char *outP;
+        Tcl_Size chunkRead, outLen;
+        status = Tclh_EncodingStreamFeed(interp,
+                                         streamP,
+                                         srcP + srcRead,
+                                         srcLen - srcRead,
+                                         final,
+                                         &chunkRead,
+                                         &outP,
+                                         &outLen);
+        srcRead += chunkRead;
+        if (outLen > 0
+            && Tclh_LifoBufferAppend(bufP, outP, outLen)
+                   != TCLH_LIFO_E_SUCCESS) {
+            Tclh_ErrorAllocation(
+                interp, "buffer", "Allocation of encoding stream output failed.");
+            return TCL_CONVERT_NOSPACE;
+        }
+    } while (status == TCL_CONVERT_NOSPACE);
+    return status;
+}
+
 typedef struct UtfToExternalLifoContext {
     Tcl_Encoding encoding;
     Tcl_Size nulLength;
@@ -499,21 +954,33 @@ alloc_fail:
     return TCL_CONVERT_NOSPACE;
 }
 
-int
-Tclh_UtfToExternalLifo(Tcl_Interp *ip,
-                       Tcl_Encoding encoding,
-                       const char *fromP,
-                       Tcl_Size fromLen,
-                       int flags,
-                       Tclh_Lifo *memlifoP,
-                       char **outPP,
-                       Tcl_Size *numBytesOutP,
-                       Tcl_Size *errorLocPtr)
+static int
+TclhUtfToExternalLifo(Tcl_Interp *ip,
+                      Tcl_Encoding encoding,
+                      Tcl_Size nulLength,
+                      const char *fromP,
+                      Tcl_Size fromLen,
+                      int flags,
+                      Tclh_Lifo *memlifoP,
+                      char **outPP,
+                      Tcl_Size *numBytesOutP,
+                      Tcl_Size *errorLocPtr)
 {
     UtfToExternalLifoContext encCtx;
 
+    if (memlifoP == NULL) {
+        memlifoP = Tclh_LibScratchLifo(ip, NULL);
+        if (memlifoP == NULL) {
+            *outPP = NULL;
+            if (numBytesOutP)
+                *numBytesOutP = 0;
+            return Tclh_ErrorAllocation(
+                ip, "Tclh_Lifo", "Could not obtain context scratch pool.");
+        }
+    }
+
     encCtx.encoding = encoding;
-    encCtx.nulLength = Tclh_GetEncodingNulLength(encoding);
+    encCtx.nulLength = nulLength;
     encCtx.memlifoP  = memlifoP;
     encCtx.bufSize   = 256;
     encCtx.bufP      = Tclh_LifoAlloc(memlifoP, encCtx.bufSize);
@@ -533,6 +1000,52 @@ Tclh_UtfToExternalLifo(Tcl_Interp *ip,
     return status;
 }
 
+int
+Tclh_UtfToExternalLifo(Tcl_Interp *ip,
+                       Tcl_Encoding encoding,
+                       const char *fromP,
+                       Tcl_Size fromLen,
+                       int flags,
+                       Tclh_Lifo *memlifoP,
+                       char **outPP,
+                       Tcl_Size *numBytesOutP,
+                       Tcl_Size *errorLocPtr)
+{
+    return TclhUtfToExternalLifo(ip,
+                                 encoding,
+                                 Tclh_GetEncodingNulLength(encoding),
+                                 fromP,
+                                 fromLen,
+                                 flags,
+                                 memlifoP,
+                                 outPP,
+                                 numBytesOutP,
+                                 errorLocPtr);
+}
+
+int
+Tclh_UtfToExternalLifoCached(Tcl_Interp *ip,
+                             const Tclh_CachedEncoding *encP,
+                             const char *fromP,
+                             Tcl_Size fromLen,
+                             int flags,
+                             Tclh_Lifo *memlifoP,
+                             char **outPP,
+                             Tcl_Size *numBytesOutP,
+                             Tcl_Size *errorLocPtr)
+{
+    return TclhUtfToExternalLifo(ip,
+                                 encP->encoding,
+                                 encP->nulLength,
+                                 fromP,
+                                 fromLen,
+                                 flags,
+                                 memlifoP,
+                                 outPP,
+                                 numBytesOutP,
+                                 errorLocPtr);
+}
+
 void *
 Tclh_ObjToMultiSzLifo(Tclh_LibContext *tclhCtxP,
                       Tcl_Encoding encoding,
@@ -549,6 +1062,15 @@ Tclh_ObjToMultiSzLifo(Tclh_LibContext *tclhCtxP,
     if (Tcl_ListObjLength(ip, objP, &numElems) != TCL_OK)
         return NULL;
 
+    if (memlifoP == NULL) {
+        memlifoP = Tclh_LibScratchLifo(ip, tclhCtxP);
+        if (memlifoP == NULL) {
+            Tclh_ErrorAllocation(
+                ip, "Tclh_Lifo", "Could not obtain context scratch pool.");
+            return NULL;
+        }
+    }
+
     encCtx.encoding = encoding;
     encCtx.nulLength = Tclh_GetEncodingNulLength(encoding);
     encCtx.memlifoP  = memlifoP;
@@ -602,8 +1124,105 @@ Tclh_ObjToMultiSzLifo(Tclh_LibContext *tclhCtxP,
 
 #endif /* TCLH_LIFO_E_SUCCESS */
 
+/*
+ * ASCII fast path kernels for UTF-8 <-> UTF-16 conversion. The vast
+ * majority of strings crossing the system API boundary (file names in
+ * particular) are pure ASCII for which Tcl's generic encoding
+ * machinery, working a code point at a time, is needless overhead.
+ * ASCII widens and narrows losslessly, so the converters below copy the
+ * leading ASCII run 16 characters per iteration where SSE2 is available
+ * and byte wise otherwise, and the callers fall back to the encoding
+ * machinery the moment a non-ASCII unit is seen. The kernels are
+ * platform neutral; only the WinChars wrappers below use them today.
+ */
+#if defined(__SSE2__) \
+    || (defined(_MSC_VER) \
+        && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+# define TCLH_ASCII_SIMD 1
+# include <emmintrin.h>
+#endif
+
+/*
+ * Widens the leading ASCII run of srcP into 16-bit units in dstP,
+ * converting at most dstCapacity characters. Returns the number of
+ * characters converted; the input is all-ASCII and fully converted iff
+ * that equals srcLen (srcLen must be non-negative and <= dstCapacity
+ * for such a check).
+ */
+TCLH_INLINE Tcl_Size
+TclhUtf8AsciiToUtf16(const char *srcP,
+                     Tcl_Size srcLen,
+                     unsigned short *dstP,
+                     Tcl_Size dstCapacity)
+{
+    const unsigned char *s = (const unsigned char *)srcP;
+    Tcl_Size n             = srcLen < dstCapacity ? srcLen : dstCapacity;
+    Tcl_Size i             = 0;
+
+#ifdef TCLH_ASCII_SIMD
+    const __m128i zero = _mm_setzero_si128();
+    while (i + 16 <= n) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(s + i));
+        if (_mm_movemask_epi8(bytes))
+            break; /* Non-ASCII in this chunk. Scalar loop mops up */
+        _mm_storeu_si128((__m128i *)(dstP + i),
+                         _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i *)(dstP + i + 8),
+                         _mm_unpackhi_epi8(bytes, zero));
+        i += 16;
+    }
+#endif
+    while (i < n && s[i] < 0x80) {
+        dstP[i] = s[i];
+        ++i;
+    }
+    return i;
+}
+
+/*
+ * Narrows the leading ASCII run of 16-bit units in srcP into dstP which
+ * must have room for srcLen bytes. Returns the number of characters
+ * converted; the input was all-ASCII iff that equals srcLen.
+ */
+TCLH_INLINE Tcl_Size
+TclhUtf16AsciiToUtf8(const unsigned short *srcP, Tcl_Size srcLen, char *dstP)
+{
+    Tcl_Size i = 0;
+
+#ifdef TCLH_ASCII_SIMD
+    /*
+     * A unit is eligible iff 1 <= unit <= 0x7f. U+0000 must be excluded
+     * even though it is ASCII because Tcl's modified UTF-8 string reps
+     * encode it as 0xC0 0x80, never as a raw 0x00 byte.
+     */
+    const __m128i nonAscii = _mm_set1_epi16((short)0xff80);
+    const __m128i zero     = _mm_setzero_si128();
+    while (i + 16 <= srcLen) {
+        __m128i lo   = _mm_loadu_si128((const __m128i *)(srcP + i));
+        __m128i hi   = _mm_loadu_si128((const __m128i *)(srcP + i + 8));
+        __m128i okLo = _mm_andnot_si128(
+            _mm_cmpeq_epi16(lo, zero),
+            _mm_cmpeq_epi16(_mm_and_si128(lo, nonAscii), zero));
+        __m128i okHi = _mm_andnot_si128(
+            _mm_cmpeq_epi16(hi, zero),
+            _mm_cmpeq_epi16(_mm_and_si128(hi, nonAscii), zero));
+        if (_mm_movemask_epi8(_mm_and_si128(okLo, okHi)) != 0xffff)
+            break; /* Non-ASCII or NUL in this chunk. Scalar loop mops up */
+        _mm_storeu_si128((__m128i *)(dstP + i), _mm_packus_epi16(lo, hi));
+        i += 16;
+    }
+#endif
+    while (i < srcLen && (unsigned short)(srcP[i] - 1) < 0x7f) {
+        dstP[i] = (char)srcP[i];
+        ++i;
+    }
+    return i;
+}
+
 #ifdef _WIN32
 
+#include <wchar.h> /* wcslen */
+
 static void
 TclhCleanupEncodings(ClientData clientData, Tcl_Interp *interp)
 {
@@ -639,6 +1258,23 @@ Tcl_Encoding TclhGetUtf16Encoding(Tclh_LibContext *tclhCtxP)
 Tcl_Obj *
 Tclh_ObjFromWinChars(Tclh_LibContext *tclhCtxP, WCHAR *wsP, Tcl_Size numChars)
 {
+    if (wsP == NULL) {
+        return Tcl_NewObj(); /* Like Tcl_NewUnicodeObj */
+    }
+    if (numChars < 0)
+        numChars = (Tcl_Size)wcslen(wsP);
+    /* All-ASCII input narrows directly, bypassing the encoding machinery */
+    if (numChars > 0) {
+        char *asciiP    = Tcl_Alloc(numChars);
+        Tcl_Size nAscii = TclhUtf16AsciiToUtf8(
+            (const unsigned short *)wsP, numChars, asciiP);
+        if (nAscii == numChars) {
+            Tcl_Obj *objP = Tcl_NewStringObj(asciiP, numChars);
+            Tcl_Free(asciiP);
+            return objP;
+        }
+        Tcl_Free(asciiP);
+    }
 #if TCL_UTF_MAX < 4
     return Tcl_NewUnicodeObj(wsP, numChars);
 #else
@@ -647,10 +1283,7 @@ Tclh_ObjFromWinChars(Tclh_LibContext *tclhCtxP, WCHAR *wsP, Tcl_Size numChars)
     enc = TclhGetUtf16Encoding(tclhCtxP);
     TCLH_ASSERT(enc);
 
-    if (wsP == NULL) {
-        return Tcl_NewObj(); /* Like Tcl_NewUnicodeObj */
-    }
-    /* 
+    /*
      * Note we do not use Tcl_Char16ToUtfDString because of its shortcomings
      * with respect to encoding errors and overallocation of memory.
      */
@@ -688,6 +1321,21 @@ Tclh_UtfToWinChars(Tclh_LibContext *tclhCtxP,
     Tcl_Encoding enc;
     int ret;
 
+    /* All-ASCII input that fits with its terminator widens directly.
+     * Exact-fit input, partial conversions, buffer overflows and
+     * non-ASCII input take the encoding path for its error semantics
+     * (it reserves room for the terminating nul and reports
+     * TCL_CONVERT_NOSPACE), so the output is always terminated. */
+    Tcl_Size len = srcLen < 0 ? (Tcl_Size)strlen(srcP) : srcLen;
+    if (len < dstCapacity
+        && TclhUtf8AsciiToUtf16(srcP, len, (unsigned short *)dstP, dstCapacity)
+               == len) {
+        dstP[len] = 0;
+        if (numCharsP)
+            *numCharsP = len;
+        return TCL_OK;
+    }
+
     enc = TclhGetUtf16Encoding(tclhCtxP);
     TCLH_ASSERT(enc);
 
@@ -720,9 +1368,6 @@ Tclh_ObjToWinCharsAlloc(Tclh_LibContext *tclhCtxP,
 {
     Tcl_Encoding enc;
 
-    enc = TclhGetUtf16Encoding(tclhCtxP);
-    TCLH_ASSERT(enc);
-
     Tcl_Size numBytes;
     Tcl_Size fromLen;
     const char *fromP;
@@ -730,6 +1375,21 @@ Tclh_ObjToWinCharsAlloc(Tclh_LibContext *tclhCtxP,
     int ret;
 
     fromP = Tcl_GetStringFromObj(objP, &fromLen);
+
+    /* All-ASCII input widens directly, bypassing the encoding machinery */
+    wsP = (WCHAR *)Tcl_Alloc((fromLen + 1) * sizeof(WCHAR));
+    if (TclhUtf8AsciiToUtf16(fromP, fromLen, (unsigned short *)wsP, fromLen)
+        == fromLen) {
+        wsP[fromLen] = 0;
+        if (numCharsP)
+            *numCharsP = fromLen;
+        return wsP;
+    }
+    Tcl_Free((void *)wsP);
+
+    enc = TclhGetUtf16Encoding(tclhCtxP);
+    TCLH_ASSERT(enc);
+
     ret   = Tclh_UtfToExternalAlloc(tclhCtxP ? tclhCtxP->interp : NULL,
                                  enc,
                                  fromP,
@@ -752,6 +1412,76 @@ Tclh_ObjToWinCharsAlloc(Tclh_LibContext *tclhCtxP,
     return wsP;
 }
 
+/*
+ * WinChars is a Tcl "type" caching the WCHAR rendering of a value so
+ * repeated conversions of the same unchanged Tcl_Obj (file paths and
+ * registry keys being the common case) do not redo the encoding work.
+ * Tcl_Obj.internalRep.twoPtrValue.ptr1 holds the nul-terminated WCHAR
+ * buffer allocated with Tcl_Alloc and ptr2 its length in characters.
+ * The value's string rep is generated before the cache is attached and
+ * is never invalidated by this type, so the cache is never the only
+ * representation; any modification of the value replaces the internal
+ * rep and thereby drops the cache.
+ */
+static void FreeWinCharsType(Tcl_Obj *objP);
+static void DupWinCharsType(Tcl_Obj *srcP, Tcl_Obj *dstP);
+
+static struct Tcl_ObjType gWinCharsType = {
+    "TclhWinChars",
+    FreeWinCharsType,
+    DupWinCharsType,
+    NULL, /* String rep is always present, never regenerated from the cache */
+    NULL,
+};
+TCLH_INLINE WCHAR *WinCharsValueGet(Tcl_Obj *objP) {
+    return (WCHAR *)objP->internalRep.twoPtrValue.ptr1;
+}
+TCLH_INLINE Tcl_Size WinCharsLengthGet(Tcl_Obj *objP) {
+    return (Tcl_Size)(intptr_t)objP->internalRep.twoPtrValue.ptr2;
+}
+
+static void
+FreeWinCharsType(Tcl_Obj *objP)
+{
+    Tcl_Free(objP->internalRep.twoPtrValue.ptr1);
+    objP->internalRep.twoPtrValue.ptr1 = NULL;
+    objP->typePtr = NULL;
+}
+
+static void
+DupWinCharsType(Tcl_Obj *srcP, Tcl_Obj *dstP)
+{
+    Tcl_Size numChars = WinCharsLengthGet(srcP);
+    WCHAR *wsP = (WCHAR *)Tcl_Alloc((numChars + 1) * sizeof(WCHAR));
+    memcpy(wsP, WinCharsValueGet(srcP), (numChars + 1) * sizeof(WCHAR));
+    dstP->typePtr = &gWinCharsType;
+    dstP->internalRep.twoPtrValue.ptr1 = wsP;
+    dstP->internalRep.twoPtrValue.ptr2 = srcP->internalRep.twoPtrValue.ptr2;
+}
+
+const WCHAR *
+Tclh_ObjToWinCharsCached(Tclh_LibContext *tclhCtxP,
+                         Tcl_Obj *objP,
+                         Tcl_Size *numCharsP)
+{
+    if (objP->typePtr != &gWinCharsType) {
+        Tcl_Size numChars;
+        WCHAR *wsP = Tclh_ObjToWinCharsAlloc(tclhCtxP, objP, &numChars);
+        if (wsP == NULL)
+            return NULL;
+        /* The conversion above generated the string rep the value keeps */
+        TCLH_ASSERT(objP->bytes);
+        if (objP->typePtr && objP->typePtr->freeIntRepProc)
+            objP->typePtr->freeIntRepProc(objP);
+        objP->typePtr = &gWinCharsType;
+        objP->internalRep.twoPtrValue.ptr1 = wsP;
+        objP->internalRep.twoPtrValue.ptr2 = (void *)(intptr_t)numChars;
+    }
+    if (numCharsP)
+        *numCharsP = WinCharsLengthGet(objP);
+    return WinCharsValueGet(objP);
+}
+
 #ifdef TCLH_LIFO_E_SUCCESS
 WCHAR *Tclh_ObjToWinCharsLifo(Tclh_LibContext *tclhCtxP,
                               Tclh_Lifo *memLifoP,
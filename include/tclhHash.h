@@ -104,6 +104,67 @@ Tclh_HashIterate(Tcl_HashTable *htP,
                  int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData),
                  ClientData fnData);
 
+/* Function: Tclh_HashIterateRange
+ * Invokes a specified function on all entries in a span of hash buckets
+ *
+ * Parameters:
+ * htP - hash table
+ * firstBucket - index of the first bucket in the span
+ * numBuckets - number of buckets in the span. Buckets past the end of the
+ *    table are ignored.
+ * fnP - function to call for each entry
+ * fnData - any value to pass to fnP
+ *
+ * Like <Tclh_HashIterate> but restricted to the given bucket span so
+ * scans of large tables can be partitioned. The callback follows the same
+ * rules: it must not modify the table except for optionally deleting the
+ * passed entry, and returning 0 terminates the iteration. Note the
+ * distribution of entries over buckets changes whenever the table is
+ * rehashed, so a partitioning is only valid while no entries are added.
+ *
+ * Returns:
+ * Returns *1* if the iteration terminated normally with all entries in the
+ * span processed, and *0* if it was terminated by the callback returning *0*.
+ */
+TCLH_LOCAL Tclh_Bool
+Tclh_HashIterateRange(Tcl_HashTable *htP,
+                      Tcl_Size firstBucket,
+                      Tcl_Size numBuckets,
+                      int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData),
+                      ClientData fnData);
+
+/* Function: Tclh_HashIterateParallel
+ * Invokes a function on all entries in a hash table using multiple threads
+ *
+ * Parameters:
+ * htP - hash table
+ * fnP - function to call for each entry
+ * numShards - number of shards to partition the table into. Values less
+ *    than 2 result in a plain sequential iteration.
+ * shardFnData - array of numShards values, one passed to fnP for entries
+ *    in the corresponding shard. May be NULL in which case fnP receives
+ *    NULL.
+ *
+ * The table's buckets are divided into numShards contiguous spans, each
+ * iterated on its own thread with <Tclh_HashIterateRange>. The call
+ * returns after all shards complete. Unlike <Tclh_HashIterate>, callbacks
+ * run concurrently and must not modify the table at all, not even to
+ * delete the passed entry; each shard has its own context so results can
+ * be accumulated without synchronization and combined by the caller
+ * afterward. Shards whose threads cannot be created are iterated on the
+ * calling thread instead.
+ *
+ * Returns:
+ * Returns *1* if the iteration terminated normally with all entries
+ * processed, and *0* if any shard was terminated by its callback
+ * returning *0*. Other shards still run to completion.
+ */
+TCLH_LOCAL Tclh_Bool
+Tclh_HashIterateParallel(Tcl_HashTable *htP,
+                         int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData),
+                         Tcl_Size numShards,
+                         ClientData *shardFnData);
+
 /* Function: Tclh_HashLookup
  * Retrieves the value associated with a key in a hash table.
  *
@@ -133,12 +194,225 @@ Tclh_HashLookup(Tcl_HashTable *htP, const void *key, ClientData *valueP);
 TCLH_LOCAL Tclh_ReturnCode
 Tclh_HashRemove(Tcl_HashTable *htP, const void *key, ClientData *valueP);
 
+/* Section: Flat hash tables
+ *
+ * A second table implementation for maps keyed by 64-bit integers or
+ * pointers. Unlike Tcl_HashTable, which allocates a heap entry per key and
+ * chains them off buckets, these tables use flat open addressing - one
+ * control byte and one inline key/value pair per slot in contiguous
+ * arrays - so inserts do not allocate and lookups probe a control byte
+ * group instead of chasing pointers. The helper API mirrors the
+ * Tcl_HashTable wrappers above so callers migrate by changing the table
+ * type.
+ *
+ * Tables are not thread safe and entries are stored in no particular
+ * order. Pointer keys should be converted with <Tclh_FlatHashPtrKey>.
+ */
+
+/* Struct: Tclh_FlatHashEntry
+ * An entry in a flat hash table holding the key and associated value.
+ * Callers may read and write *value* directly; *key* must not be modified.
+ */
+typedef struct Tclh_FlatHashEntry {
+    Tcl_WideUInt key;
+    ClientData value;
+} Tclh_FlatHashEntry;
+
+/* Struct: Tclh_FlatHashTable
+ * A flat open addressing hash table. Treat as opaque; initialize with
+ * <Tclh_FlatHashInit> and release with <Tclh_FlatHashFree>.
+ */
+typedef struct Tclh_FlatHashTable {
+    unsigned char *ctrlP;          /* Control byte per slot */
+    Tclh_FlatHashEntry *entriesP;  /* Key/value pair per slot */
+    Tcl_Size capacity;             /* Number of slots. Always a power of 2 */
+    Tcl_Size count;                /* Number of live entries */
+    Tcl_Size used;                 /* Live entries plus tombstones */
+} Tclh_FlatHashTable;
+
+/* Function: Tclh_FlatHashPtrKey
+ * Converts a pointer to a flat hash table key.
+ *
+ * Parameters:
+ * ptr - pointer to use as a key. May be NULL.
+ *
+ * Returns:
+ * The key corresponding to the pointer.
+ */
+TCLH_INLINE Tcl_WideUInt Tclh_FlatHashPtrKey(const void *ptr)
+{
+    return (Tcl_WideUInt)(uintptr_t)ptr;
+}
+
+/* Function: Tclh_FlatHashInit
+ * Initializes a flat hash table.
+ *
+ * Parameters:
+ * fhtP - table to initialize
+ *
+ * No slots are allocated until the first insert or an explicit
+ * <Tclh_FlatHashReserve>.
+ */
+TCLH_LOCAL void Tclh_FlatHashInit(Tclh_FlatHashTable *fhtP);
+
+/* Function: Tclh_FlatHashFree
+ * Releases all storage held by a flat hash table.
+ *
+ * Parameters:
+ * fhtP - table to free
+ *
+ * The table is reset to the initialized empty state and may be reused.
+ * Values are not released; that is the caller's responsibility.
+ */
+TCLH_LOCAL void Tclh_FlatHashFree(Tclh_FlatHashTable *fhtP);
+
+/* Function: Tclh_FlatHashSize
+ * Returns the number of entries in a flat hash table.
+ *
+ * Parameters:
+ * fhtP - the table
+ *
+ * Returns:
+ * Number of entries in the table.
+ */
+TCLH_INLINE Tcl_Size Tclh_FlatHashSize(Tclh_FlatHashTable *fhtP)
+{
+    return fhtP->count;
+}
+
+/* Function: Tclh_FlatHashReserve
+ * Reserves capacity for a number of entries.
+ *
+ * Parameters:
+ * ip - interpreter for error messages. May be NULL.
+ * fhtP - the table
+ * count - number of entries the table should hold without rehashing
+ *
+ * Bulk loads should reserve up front so the table is sized and rehashed
+ * once instead of repeatedly growing.
+ *
+ * Returns:
+ * TCL_OK on success, TCL_ERROR if the requested size is not supportable.
+ */
+TCLH_LOCAL Tclh_ReturnCode
+Tclh_FlatHashReserve(Tcl_Interp *ip, Tclh_FlatHashTable *fhtP, Tcl_Size count);
+
+/* Function: Tclh_FlatHashAdd
+ * Adds an entry to a flat hash table.
+ *
+ * Parameters:
+ * ip - interpreter. May be NULL if error messages not desired.
+ * fhtP - the table
+ * key - key to add
+ * value - value to associate with the key
+ *
+ * An error is returned if the entry already exists.
+ *
+ * Returns:
+ * TCL_OK on success, TCL_ERROR on failure.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_FlatHashAdd(Tcl_Interp *ip,
+                                            Tclh_FlatHashTable *fhtP,
+                                            Tcl_WideUInt key,
+                                            ClientData value);
+
+/* Function: Tclh_FlatHashAddOrReplace
+ * Adds or replaces an entry in a flat hash table.
+ *
+ * Parameters:
+ * ip - interpreter. May be NULL if error messages not desired.
+ * fhtP - the table
+ * key - key to add
+ * value - value to associate with the key
+ * oldValueP - location to store old value if an existing entry was replaced.
+ *    May be *NULL*.
+ * newEntryP - location to store 1 if a new entry was added and 0 if an
+ *    existing entry was replaced. May be *NULL*.
+ *
+ * If an existing entry was replaced, the value previously associated
+ * with the key is returned in *oldValueP*.
+ *
+ * Returns:
+ * TCL_OK on success, TCL_ERROR if a needed resize failed.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_FlatHashAddOrReplace(Tcl_Interp *ip,
+                                                     Tclh_FlatHashTable *fhtP,
+                                                     Tcl_WideUInt key,
+                                                     ClientData value,
+                                                     ClientData *oldValueP,
+                                                     int *newEntryP);
+
+/* Function: Tclh_FlatHashLookup
+ * Retrieves the value associated with a key in a flat hash table.
+ *
+ * Parameters:
+ * fhtP - the table
+ * key - key to look up
+ * valueP - location to store the value. May be NULL if only existence
+ *    is being checked.
+ *
+ * Returns:
+ * *TCL_OK* if found, *TCL_ERROR* on failure.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_FlatHashLookup(Tclh_FlatHashTable *fhtP,
+                                               Tcl_WideUInt key,
+                                               ClientData *valueP);
+
+/* Function: Tclh_FlatHashRemove
+ * Removes an entry from a flat hash table, returning its value.
+ *
+ * Parameters:
+ * fhtP - the table
+ * key - key to remove
+ * valueP - location to store the value. May be NULL if not of interest.
+ *
+ * Returns:
+ * *TCL_OK* if key existed in table, *TCL_ERROR* otherwise.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_FlatHashRemove(Tclh_FlatHashTable *fhtP,
+                                               Tcl_WideUInt key,
+                                               ClientData *valueP);
+
+/* Function: Tclh_FlatHashIterate
+ * Invokes a specified function on all entries in a flat hash table
+ *
+ * Parameters:
+ * fhtP - the table
+ * fnP - function to call for each entry
+ * fnData - any value to pass to fnP
+ *
+ * The callback function *fnP* is passed a pointer to the table, the entry
+ * and an opaque client value. It may modify the entry value but must not
+ * otherwise modify the table. The iteration will terminate if the callback
+ * function returns 0.
+ *
+ * Returns:
+ * Returns *1* if the iteration terminated normally with all entries processed,
+ * and *0* if it was terminated by the callback returning *0*.
+ */
+TCLH_LOCAL Tclh_Bool Tclh_FlatHashIterate(
+    Tclh_FlatHashTable *fhtP,
+    int (*fnP)(Tclh_FlatHashTable *, Tclh_FlatHashEntry *, ClientData),
+    ClientData fnData);
+
 #ifdef TCLH_SHORTNAMES
 #define HashAdd          Tclh_HashAdd
 #define HashAddOrReplace Tclh_HashAddOrReplace
 #define HashIterate      Tclh_HashIterate
+#define HashIterateRange Tclh_HashIterateRange
+#define HashIterateParallel Tclh_HashIterateParallel
 #define HashLookup       Tclh_HashLookup
 #define HashRemove       Tclh_HashRemove
+#define FlatHashPtrKey       Tclh_FlatHashPtrKey
+#define FlatHashInit         Tclh_FlatHashInit
+#define FlatHashFree         Tclh_FlatHashFree
+#define FlatHashSize         Tclh_FlatHashSize
+#define FlatHashReserve      Tclh_FlatHashReserve
+#define FlatHashAdd          Tclh_FlatHashAdd
+#define FlatHashAddOrReplace Tclh_FlatHashAddOrReplace
+#define FlatHashLookup       Tclh_FlatHashLookup
+#define FlatHashRemove       Tclh_FlatHashRemove
+#define FlatHashIterate      Tclh_FlatHashIterate
 #endif
 
 #ifdef TCLH_IMPL
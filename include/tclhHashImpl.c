@@ -81,4 +81,367 @@ Tclh_HashIterate(Tcl_HashTable *htP,
             return 0;
     }
     return 1;
+}
+
+Tclh_Bool
+Tclh_HashIterateRange(Tcl_HashTable *htP,
+                      Tcl_Size firstBucket,
+                      Tcl_Size numBuckets,
+                      int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData),
+                      ClientData fnData)
+{
+    Tcl_Size bucket, endBucket;
+
+    endBucket = firstBucket + numBuckets;
+    if (endBucket > (Tcl_Size)htP->numBuckets)
+        endBucket = (Tcl_Size)htP->numBuckets;
+    for (bucket = firstBucket; bucket < endBucket; ++bucket) {
+        Tcl_HashEntry *heP = htP->buckets[bucket];
+        while (heP) {
+            /* Grab the link first so the callback may delete the entry */
+            Tcl_HashEntry *nextP = heP->nextPtr;
+            if (fnP(htP, heP, fnData) == 0)
+                return 0;
+            heP = nextP;
+        }
+    }
+    return 1;
+}
+
+typedef struct TclhHashShard {
+    Tcl_HashTable *htP;
+    int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData);
+    ClientData fnData;
+    Tcl_Size firstBucket;
+    Tcl_Size numBuckets;
+    int completed; /* 0 if the shard's callback terminated the iteration */
+} TclhHashShard;
+
+static Tcl_ThreadCreateType
+TclhHashShardProc(ClientData clientData)
+{
+    TclhHashShard *shardP = (TclhHashShard *)clientData;
+    shardP->completed = Tclh_HashIterateRange(shardP->htP,
+                                              shardP->firstBucket,
+                                              shardP->numBuckets,
+                                              shardP->fnP,
+                                              shardP->fnData);
+    TCL_THREAD_CREATE_RETURN;
+}
+
+Tclh_Bool
+Tclh_HashIterateParallel(Tcl_HashTable *htP,
+                         int (*fnP)(Tcl_HashTable *, Tcl_HashEntry *, ClientData),
+                         Tcl_Size numShards,
+                         ClientData *shardFnData)
+{
+    TclhHashShard *shardsP;
+    Tcl_ThreadId *tidsP;
+    Tcl_Size shard, tableBuckets;
+    Tclh_Bool completed = 1;
+
+    if (numShards < 2) {
+        return Tclh_HashIterate(htP, fnP, shardFnData ? shardFnData[0] : NULL);
+    }
+    tableBuckets = (Tcl_Size)htP->numBuckets;
+    if (numShards > tableBuckets)
+        numShards = tableBuckets;
+
+    shardsP = (TclhHashShard *)Tcl_Alloc(
+        numShards * (sizeof(TclhHashShard) + sizeof(Tcl_ThreadId)));
+    tidsP = (Tcl_ThreadId *)(shardsP + numShards);
+    for (shard = 0; shard < numShards; ++shard) {
+        Tcl_Size firstBucket = (shard * tableBuckets) / numShards;
+        Tcl_Size endBucket   = ((shard + 1) * tableBuckets) / numShards;
+        shardsP[shard].htP         = htP;
+        shardsP[shard].fnP         = fnP;
+        shardsP[shard].fnData      = shardFnData ? shardFnData[shard] : NULL;
+        shardsP[shard].firstBucket = firstBucket;
+        shardsP[shard].numBuckets  = endBucket - firstBucket;
+        shardsP[shard].completed   = 1;
+        tidsP[shard]               = NULL;
+    }
+    /* Shard 0 runs on the calling thread, as do shards whose thread could
+     * not be created (e.g. Tcl built without threads) */
+    for (shard = 1; shard < numShards; ++shard) {
+        if (Tcl_CreateThread(&tidsP[shard],
+                             TclhHashShardProc,
+                             &shardsP[shard],
+                             TCL_THREAD_STACK_DEFAULT,
+                             TCL_THREAD_JOINABLE) != TCL_OK) {
+            tidsP[shard] = NULL;
+            TclhHashShardProc(&shardsP[shard]);
+        }
+    }
+    TclhHashShardProc(&shardsP[0]);
+    for (shard = 1; shard < numShards; ++shard) {
+        if (tidsP[shard]) {
+            int ignored;
+            Tcl_JoinThread(tidsP[shard], &ignored);
+        }
+    }
+    for (shard = 0; shard < numShards; ++shard) {
+        if (!shardsP[shard].completed)
+            completed = 0;
+    }
+    Tcl_Free((void *)shardsP);
+    return completed;
+}
+
+/*
+ * Flat hash tables. Each slot has a control byte in a contiguous array -
+ * FLATHASH_EMPTY, FLATHASH_DELETED (tombstone), or the low 7 bits of the
+ * key hash for an occupied slot, always with the high bit clear. Probing
+ * scans the control bytes a group (64-bit word) at a time using the usual
+ * SWAR zero-byte finder as a filter, so most slots are rejected without
+ * ever touching the entry array, and a group containing an empty byte
+ * ends an unsuccessful search. Slots are kept at most 7/8 full.
+ */
+#define FLATHASH_GROUP   8
+#define FLATHASH_EMPTY   0x80u
+#define FLATHASH_DELETED 0x81u
+#define FLATHASH_MINSIZE 16
+#define FLATHASH_LSB     0x0101010101010101ull
+#define FLATHASH_MSB     0x8080808080808080ull
+
+/* Mixer from splitmix64. Sequential ids must spread over all slot groups */
+TCLH_INLINE Tcl_WideUInt FlatHashMix(Tcl_WideUInt key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ull;
+    key ^= key >> 33;
+    return key;
+}
+
+/* Returns non-0 if any control byte in the group equals byte */
+TCLH_INLINE Tcl_WideUInt FlatHashGroupHas(const unsigned char *ctrlP,
+                                                 unsigned char byte)
+{
+    Tcl_WideUInt w;
+    memcpy(&w, ctrlP, sizeof(w));
+    w ^= FLATHASH_LSB * byte;
+    return (w - FLATHASH_LSB) & ~w & FLATHASH_MSB;
+}
+
+void
+Tclh_FlatHashInit(Tclh_FlatHashTable *fhtP)
+{
+    memset(fhtP, 0, sizeof(*fhtP));
+}
+
+void
+Tclh_FlatHashFree(Tclh_FlatHashTable *fhtP)
+{
+    if (fhtP->ctrlP)
+        Tcl_Free((void *)fhtP->ctrlP);
+    Tclh_FlatHashInit(fhtP);
+}
+
+static Tclh_FlatHashEntry *
+FlatHashFind(Tclh_FlatHashTable *fhtP, Tcl_WideUInt key)
+{
+    Tcl_WideUInt hash;
+    unsigned char h2;
+    Tcl_Size nGroups, group;
+
+    if (fhtP->count == 0)
+        return NULL;
+    hash    = FlatHashMix(key);
+    h2      = hash & 0x7f;
+    nGroups = fhtP->capacity / FLATHASH_GROUP;
+    group   = (Tcl_Size)((hash >> 7) & (nGroups - 1));
+    for (;;) {
+        const unsigned char *ctrlP = fhtP->ctrlP + group * FLATHASH_GROUP;
+        int i;
+        if (FlatHashGroupHas(ctrlP, h2)) {
+            for (i = 0; i < FLATHASH_GROUP; ++i) {
+                if (ctrlP[i] == h2) {
+                    Tclh_FlatHashEntry *entryP =
+                        &fhtP->entriesP[group * FLATHASH_GROUP + i];
+                    if (entryP->key == key)
+                        return entryP;
+                }
+            }
+        }
+        if (FlatHashGroupHas(ctrlP, FLATHASH_EMPTY))
+            return NULL; /* Insertion would have stopped here */
+        group = (group + 1) & (nGroups - 1);
+    }
+}
+
+/*
+ * Places key into a table known to have a free slot and no entry for key.
+ * Returns the slot index.
+ */
+static Tcl_Size
+FlatHashPlace(Tclh_FlatHashTable *fhtP, Tcl_WideUInt key)
+{
+    Tcl_WideUInt hash = FlatHashMix(key);
+    unsigned char h2  = hash & 0x7f;
+    Tcl_Size nGroups  = fhtP->capacity / FLATHASH_GROUP;
+    Tcl_Size group    = (Tcl_Size)((hash >> 7) & (nGroups - 1));
+    for (;;) {
+        unsigned char *ctrlP = fhtP->ctrlP + group * FLATHASH_GROUP;
+        int i;
+        for (i = 0; i < FLATHASH_GROUP; ++i) {
+            if (ctrlP[i] & 0x80) { /* Empty or tombstone */
+                Tcl_Size slot = group * FLATHASH_GROUP + i;
+                if (ctrlP[i] == FLATHASH_EMPTY)
+                    fhtP->used += 1; /* Tombstones already counted */
+                ctrlP[i] = h2;
+                fhtP->entriesP[slot].key = key;
+                fhtP->count += 1;
+                return slot;
+            }
+        }
+        group = (group + 1) & (nGroups - 1);
+    }
+}
+
+static Tclh_ReturnCode
+FlatHashResize(Tcl_Interp *ip, Tclh_FlatHashTable *fhtP, Tcl_Size numEntries)
+{
+    Tclh_FlatHashTable old = *fhtP;
+    Tcl_Size capacity, slot;
+
+    /* Smallest power of 2 with numEntries at most 7/8 of it */
+    capacity = FLATHASH_MINSIZE;
+    while (numEntries * 8 > capacity * 7) {
+        if (capacity > TCL_SIZE_MAX / (2 * (Tcl_Size)sizeof(Tclh_FlatHashEntry)))
+            return Tclh_ErrorAllocation(ip, "Flat hash table", NULL);
+        capacity *= 2;
+    }
+    fhtP->ctrlP = (unsigned char *)Tcl_Alloc(
+        capacity * (1 + sizeof(Tclh_FlatHashEntry)));
+    fhtP->entriesP = (Tclh_FlatHashEntry *)(fhtP->ctrlP + capacity);
+    fhtP->capacity = capacity;
+    fhtP->count    = 0;
+    fhtP->used     = 0;
+    memset(fhtP->ctrlP, FLATHASH_EMPTY, capacity);
+
+    for (slot = 0; slot < old.capacity; ++slot) {
+        if ((old.ctrlP[slot] & 0x80) == 0) {
+            Tcl_Size newSlot = FlatHashPlace(fhtP, old.entriesP[slot].key);
+            fhtP->entriesP[newSlot].value = old.entriesP[slot].value;
+        }
+    }
+    if (old.ctrlP)
+        Tcl_Free((void *)old.ctrlP);
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_FlatHashReserve(Tcl_Interp *ip, Tclh_FlatHashTable *fhtP, Tcl_Size count)
+{
+    if (count < fhtP->count)
+        count = fhtP->count;
+    if (count * 8 <= fhtP->capacity * 7 && fhtP->used == fhtP->count)
+        return TCL_OK; /* Already large enough and no tombstones */
+    return FlatHashResize(ip, fhtP, count);
+}
+
+/*
+ * Makes room for one more entry. Grows the table, or just rehashes at the
+ * same size when it is mostly tombstones rather than live entries.
+ */
+static Tclh_ReturnCode
+FlatHashMakeRoom(Tcl_Interp *ip, Tclh_FlatHashTable *fhtP)
+{
+    if ((fhtP->used + 1) * 8 <= fhtP->capacity * 7)
+        return TCL_OK;
+    return FlatHashResize(ip,
+                          fhtP,
+                          fhtP->count * 2 >= fhtP->capacity ? fhtP->count * 2
+                                                            : fhtP->count + 1);
+}
+
+Tclh_ReturnCode
+Tclh_FlatHashAdd(Tcl_Interp *ip,
+                 Tclh_FlatHashTable *fhtP,
+                 Tcl_WideUInt key,
+                 ClientData value)
+{
+    Tcl_Size slot;
+    if (FlatHashFind(fhtP, key))
+        return Tclh_ErrorExists(ip, "Key", NULL, NULL);
+    if (FlatHashMakeRoom(ip, fhtP) != TCL_OK)
+        return TCL_ERROR;
+    slot = FlatHashPlace(fhtP, key);
+    fhtP->entriesP[slot].value = value;
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_FlatHashAddOrReplace(Tcl_Interp *ip,
+                          Tclh_FlatHashTable *fhtP,
+                          Tcl_WideUInt key,
+                          ClientData value,
+                          ClientData *oldValueP,
+                          int *newEntryP)
+{
+    Tclh_FlatHashEntry *entryP = FlatHashFind(fhtP, key);
+    Tcl_Size slot;
+    if (entryP) {
+        if (oldValueP)
+            *oldValueP = entryP->value;
+        entryP->value = value;
+        if (newEntryP)
+            *newEntryP = 0;
+        return TCL_OK;
+    }
+    if (FlatHashMakeRoom(ip, fhtP) != TCL_OK)
+        return TCL_ERROR;
+    slot = FlatHashPlace(fhtP, key);
+    fhtP->entriesP[slot].value = value;
+    if (newEntryP)
+        *newEntryP = 1;
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_FlatHashLookup(Tclh_FlatHashTable *fhtP,
+                    Tcl_WideUInt key,
+                    ClientData *valueP)
+{
+    Tclh_FlatHashEntry *entryP = FlatHashFind(fhtP, key);
+    if (entryP) {
+        if (valueP)
+            *valueP = entryP->value;
+        return TCL_OK;
+    }
+    return TCL_ERROR;
+}
+
+Tclh_ReturnCode
+Tclh_FlatHashRemove(Tclh_FlatHashTable *fhtP,
+                    Tcl_WideUInt key,
+                    ClientData *valueP)
+{
+    Tclh_FlatHashEntry *entryP = FlatHashFind(fhtP, key);
+    if (entryP) {
+        if (valueP)
+            *valueP = entryP->value;
+        fhtP->ctrlP[entryP - fhtP->entriesP] = FLATHASH_DELETED;
+        fhtP->count -= 1;
+        return TCL_OK;
+    }
+    return TCL_ERROR;
+}
+
+Tclh_Bool
+Tclh_FlatHashIterate(
+    Tclh_FlatHashTable *fhtP,
+    int (*fnP)(Tclh_FlatHashTable *, Tclh_FlatHashEntry *, ClientData),
+    ClientData fnData)
+{
+    Tcl_Size slot;
+    for (slot = 0; slot < fhtP->capacity; ++slot) {
+        if ((fhtP->ctrlP[slot] & 0x80) == 0) {
+            if (fnP(fhtP, &fhtP->entriesP[slot], fnData) == 0)
+                return 0;
+        }
+    }
+    return 1;
 }
\ No newline at end of file
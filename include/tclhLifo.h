@@ -17,12 +17,23 @@ typedef size_t Tclh_LifoUSizeT;
 #define TCLH_LIFO_SIZE_MODIFIER "z"
 
 typedef struct Tclh_Lifo Tclh_Lifo;
+typedef struct Tclh_LifoChunk Tclh_LifoChunk;
 typedef struct Tclh_LifoMarkInfo Tclh_LifoMarkInfo;
 typedef Tclh_LifoMarkInfo *Tclh_LifoMark;
 
 typedef void *Tclh_LifoAllocFn(size_t sz);
 typedef void Tclh_LifoFreeFn(void *p);
 
+/*
+ * Allocator variants that are passed a caller-supplied context in
+ * addition to the size. See <Tclh_LifoInitEx>.
+ */
+typedef void *Tclh_LifoAllocDataFn(size_t sz, void *allocData);
+typedef void Tclh_LifoFreeDataFn(void *p, void *allocData);
+
+/* Max number of retired chunks kept for recycling in a pool */
+#define TCLH_LIFO_FREELIST_MAX 8
+
 struct Tclh_Lifo {
     Tclh_LifoMark lifo_top_mark; /* Topmost mark */
     Tclh_LifoMark lifo_bot_mark; /* Bottommost mark */
@@ -31,7 +42,27 @@ struct Tclh_Lifo {
                                   of the alignment size */
     Tclh_LifoAllocFn *lifo_allocFn;
     Tclh_LifoFreeFn *lifo_freeFn;
+    Tclh_LifoAllocDataFn *lifo_allocExFn; /* Contextual allocator. When
+                                             non-NULL, used in preference
+                                             to lifo_allocFn */
+    Tclh_LifoFreeDataFn *lifo_freeExFn;
+    void *lifo_allocData;       /* Passed to the contextual allocator */
+    Tclh_LifoChunk *lifo_free_chunks; /* List of retired chunks kept
+                                         for recycling */
+    int lifo_free_count; /* Number of chunks on lifo_free_chunks */
+    Tclh_LifoUSizeT lifo_alignment; /* Alignment guaranteed for every
+                                       allocation from the pool */
 #define TCLH_LIFO_PANIC_ON_FAIL 0x1
+#define TCLH_LIFO_ALIGN64       0x2
+#ifdef TCLH_INSTRUMENT
+    Tclh_InstrumentStats *lifo_statsP; /* Sink for chunk allocation counters
+                                          and memory high water marks. NULL
+                                          (no counting) after init; may be
+                                          pointed at any Tclh_InstrumentStats
+                                          by the embedder. The scratch pool
+                                          of a Tclh context counts into that
+                                          context's stats. */
+#endif
     int32_t lifo_magic; /* Only used in debug mode */
 #define TCLH_LIFO_MAGIC 0xb92c610a
     int lifo_flags;
@@ -70,6 +101,41 @@ TCLH_LIFO_EXTERN int Tclh_LifoInit(Tclh_Lifo *lifoP,
                                Tclh_LifoUSizeT chunkSz,
                                int flags);
 
+/* Function: Tclh_LifoInitEx
+ * Create a Last-In-First-Out memory pool with a contextual allocator
+ *
+ * Parameters:
+ * lifoP - Memory pool to initialize
+ * allocFunc - function to use to allocate chunks. Called with the
+ *             requested size and the allocData value so the embedder can
+ *             implement placement policies such as allocating from
+ *             NUMA-node-local or huge-page backed memory for the thread
+ *             owning the pool. Must return memory aligned appropriately
+ *             for the platform. A default allocator is used if NULL.
+ * freeFunc - function to free memory allocated by allocFunc. Can be NULL
+ *            iff allocFunc is NULL.
+ * allocData - context passed through to allocFunc and freeFunc.
+ * chunkSz - Default size of usable space when allocating a chunk (does
+ *           not include the chunk header). This is only a hint and may be
+ *           adjusted to a minimum or maximum size.
+ * flags - See TCLH_LIFO_F_* definitions
+ *
+ * This behaves exactly as <Tclh_LifoInit> except that the allocation and
+ * free functions receive the caller-supplied allocData context with every
+ * call. Passing the TCLH_LIFO_ALIGN64 flag (to either initializer) makes
+ * every allocation from the pool, including the first allocation in each
+ * chunk, 64-byte aligned.
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or a TCLH_LIFO_E_* error code.
+ */
+TCLH_LIFO_EXTERN int Tclh_LifoInitEx(Tclh_Lifo *lifoP,
+                                     Tclh_LifoAllocDataFn *allocFunc,
+                                     Tclh_LifoFreeDataFn *freeFunc,
+                                     void *allocData,
+                                     Tclh_LifoUSizeT chunkSz,
+                                     int flags);
+
 /* Function: Tclh_LifoClose
  * Frees up resources associated with a LIFO memory pool.
  *
@@ -125,6 +191,30 @@ TCLH_INLINE void* Tclh_LifoAlloc(Tclh_Lifo *l, Tclh_LifoUSizeT numBytes) {
     return Tclh_LifoAllocMin(l, numBytes, NULL);
 }
 
+/* Function: Tclh_LifoAllocAligned
+ * Allocate memory with a specified alignment from a LIFO memory pool
+ *
+ * Parameters:
+ * lifoP - memory pool
+ * numBytes - number of bytes to allocate
+ * alignment - required alignment. Must be a power of 2.
+ *
+ * Allocates memory from a LIFO memory pool such that the returned
+ * pointer is a multiple of alignment. This permits placement of SIMD
+ * vectors, cache line padded structures and the like without manual
+ * over-allocation and pointer fix up. Note the returned pointer is not
+ * necessarily the start of the underlying block so the
+ * Tclh_LifoExpandLast family of functions must not be used on it.
+ *
+ * Returns:
+ * Returns pointer to allocated memory on success. On failure, including
+ * an invalid alignment value, returns a NULL pointer unless
+ * TCLH_LIFO_PANIC_ON_FAIL is set for the pool, in which case it panics.
+ */
+TCLH_LIFO_EXTERN void *Tclh_LifoAllocAligned(Tclh_Lifo *lifoP,
+                                             Tclh_LifoUSizeT numBytes,
+                                             Tclh_LifoUSizeT alignment);
+
 /* Function: Tclh_LifoPushFrameMin
  * Allocate a software stack frame in a LIFO memory pool
  *
@@ -328,8 +418,237 @@ Tclh_LifoShrinkLast(Tclh_Lifo *lifoP, Tclh_LifoUSizeT decr, int dontMove);
 TCLH_LIFO_EXTERN void *
 Tclh_LifoResizeLast(Tclh_Lifo *lifoP, Tclh_LifoUSizeT newSz, int dontMove);
 
+/* Function: Tclh_LifoTrim
+ * Releases retired chunks cached in a LIFO memory pool.
+ *
+ * Parameters:
+ * lifoP - memory pool
+ *
+ * When a mark is popped, up to TCLH_LIFO_FREELIST_MAX chunks are retained
+ * on a freelist and recycled on subsequent allocations so that steady
+ * state mark push/pop cycles do not round-trip through the allocator.
+ * This function returns all such cached chunks to the allocator. It may
+ * be called under memory pressure; allocated memory and marks are not
+ * affected.
+ */
+TCLH_LIFO_EXTERN void Tclh_LifoTrim(Tclh_Lifo *lifoP);
+
 TCLH_LIFO_EXTERN int Tclh_LifoValidate(Tclh_Lifo *l);
 
+/* Section: Context scratch pool
+ *
+ * The Tclh context owns a lazily created LIFO memory pool for transient
+ * allocations whose lifetime is bracketed within a single command
+ * invocation. Since a Tcl interpreter, and hence its Tclh context, is
+ * confined to one thread, the pool needs no locking. Callers that would
+ * otherwise initialize and close a private pool per call can instead
+ * push a mark on entry and pop it on exit, reusing the context pool's
+ * warm chunks across calls.
+ */
+
+/* Function: Tclh_LibScratchLifo
+ * Returns the scratch LIFO memory pool for the Tclh context.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * The pool is created on first use and freed when the interpreter is
+ * deleted. Callers must observe the usual mark discipline, normally via
+ * <Tclh_LibScratchPush> and <Tclh_LibScratchPop>, and must not call
+ * <Tclh_LifoClose> on the returned pool.
+ *
+ * Returns:
+ * Pointer to the scratch pool or NULL on failure.
+ */
+TCLH_LIFO_EXTERN Tclh_Lifo *Tclh_LibScratchLifo(Tcl_Interp *interp,
+                                                Tclh_LibContext *tclhCtxP);
+
+/* Function: Tclh_LibScratchPush
+ * Marks the state of the context scratch pool.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Intended to be called on entry to a command implementation with the
+ * matching <Tclh_LibScratchPop> called on exit, releasing all scratch
+ * allocations made in between.
+ *
+ * Returns:
+ * On success, returns a handle for the mark. On failure returns NULL.
+ */
+TCLH_LIFO_EXTERN Tclh_LifoMark Tclh_LibScratchPush(Tcl_Interp *interp,
+                                                   Tclh_LibContext *tclhCtxP);
+
+/* Function: Tclh_LibScratchPop
+ * Releases scratch pool allocations made since the matching mark.
+ *
+ * Parameters:
+ * mark - mark returned by <Tclh_LibScratchPush>.
+ */
+TCLH_INLINE void Tclh_LibScratchPop(Tclh_LifoMark mark) {
+    Tclh_LifoPopMark(mark);
+}
+
+/* Section: Lifo buffers
+ *
+ * A Tclh_LifoBuffer accumulates a variable length result through
+ * amortized-doubling appends and hands the final contiguous content to
+ * a Tcl_Obj without a terminal copy. Unlike repeated calls to
+ * <Tclh_LifoExpandLast>, which re-verify the last-allocation invariants
+ * on every call and still require copying into a Tcl_Obj at the end,
+ * the buffer tracks its own capacity so the append fast path is a
+ * bounds check and a memcpy, and the content is grown directly inside
+ * the representation that the detached Tcl_Obj will own. Pool chunks
+ * cannot be adopted by a Tcl_Obj through public Tcl interfaces which is
+ * why buffers are not carved from the lifo chunks themselves.
+ */
+typedef struct Tclh_LifoBuffer {
+    Tcl_Obj *objP;   /* Byte array buffers grow inside this unshared
+                        Tcl_Obj. NULL for string buffers */
+    char *bytes;     /* Base of the accumulation storage */
+    Tclh_LifoUSizeT used;     /* Bytes of content */
+    Tclh_LifoUSizeT capacity; /* Bytes of storage */
+} Tclh_LifoBuffer;
+
+/* Function: Tclh_LifoBufferInit
+ * Initializes a buffer that detaches to a Tcl string value.
+ *
+ * Parameters:
+ * bufP - buffer to initialize
+ * initialCapacity - hint for initial storage size in bytes. May be 0.
+ *
+ * The buffer content is expected to be valid UTF-8 in Tcl's internal
+ * form when detached. A buffer must be disposed of with exactly one of
+ * <Tclh_LifoBufferDetachToObj> or <Tclh_LifoBufferFree>.
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or TCLH_LIFO_E_NOMEMORY.
+ */
+TCLH_LIFO_EXTERN int Tclh_LifoBufferInit(Tclh_LifoBuffer *bufP,
+                                         Tclh_LifoUSizeT initialCapacity);
+
+/* Function: Tclh_LifoBufferInitForByteArray
+ * Initializes a buffer that detaches to a Tcl byte array value.
+ *
+ * Parameters:
+ * bufP - buffer to initialize
+ * initialCapacity - hint for initial storage size in bytes. May be 0.
+ *
+ * Appended content grows directly inside an unshared byte array Tcl_Obj
+ * so detaching is free of copies. A buffer must be disposed of with
+ * exactly one of <Tclh_LifoBufferDetachToObj> or <Tclh_LifoBufferFree>.
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or TCLH_LIFO_E_NOMEMORY.
+ */
+TCLH_LIFO_EXTERN int
+Tclh_LifoBufferInitForByteArray(Tclh_LifoBuffer *bufP,
+                                Tclh_LifoUSizeT initialCapacity);
+
+/* Function: Tclh_LifoBufferGrow
+ * Grows a buffer's storage to accommodate additional content.
+ *
+ * Parameters:
+ * bufP - buffer to grow
+ * numBytes - number of additional bytes of content to accommodate
+ *
+ * This is primarily an internal helper for the <Tclh_LifoBufferAppend>
+ * slow path but may be called directly to reserve space ahead of a
+ * sequence of appends. Storage grows by at least doubling so a series
+ * of appends is amortized linear.
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or TCLH_LIFO_E_NOMEMORY. On failure the
+ * buffer content is unchanged and the buffer remains valid.
+ */
+TCLH_LIFO_EXTERN int Tclh_LifoBufferGrow(Tclh_LifoBuffer *bufP,
+                                         Tclh_LifoUSizeT numBytes);
+
+/* Function: Tclh_LifoBufferAppend
+ * Appends bytes to a buffer.
+ *
+ * Parameters:
+ * bufP - buffer
+ * srcP - bytes to append
+ * len - number of bytes to append
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or TCLH_LIFO_E_NOMEMORY. On failure the
+ * buffer content is unchanged and the buffer remains valid.
+ */
+TCLH_INLINE int
+Tclh_LifoBufferAppend(Tclh_LifoBuffer *bufP, const void *srcP, Tclh_LifoUSizeT len)
+{
+    if (len > bufP->capacity - bufP->used) {
+        int ret = Tclh_LifoBufferGrow(bufP, len);
+        if (ret != TCLH_LIFO_E_SUCCESS)
+            return ret;
+    }
+    memcpy(bufP->bytes + bufP->used, srcP, len);
+    bufP->used += len;
+    return TCLH_LIFO_E_SUCCESS;
+}
+
+/* Function: Tclh_LifoBufferAppendUniChars
+ * Appends an array of Tcl_UniChar values to a buffer.
+ *
+ * Parameters:
+ * bufP - buffer
+ * uniP - Tcl_UniChar values to append
+ * count - number of Tcl_UniChar values to append
+ *
+ * The values are appended in their native in-memory form without
+ * transformation. It is the caller's responsibility to ensure the final
+ * content is appropriate for the kind of Tcl_Obj the buffer will be
+ * detached to.
+ *
+ * Returns:
+ * Returns TCLH_LIFO_E_SUCCESS or TCLH_LIFO_E_NOMEMORY.
+ */
+TCLH_INLINE int Tclh_LifoBufferAppendUniChars(Tclh_LifoBuffer *bufP,
+                                              const Tcl_UniChar *uniP,
+                                              Tclh_LifoUSizeT count)
+{
+    return Tclh_LifoBufferAppend(bufP, uniP, count * sizeof(Tcl_UniChar));
+}
+
+/* Function: Tclh_LifoBufferDetachToObj
+ * Hands a buffer's content to a Tcl_Obj without copying.
+ *
+ * Parameters:
+ * bufP - buffer to detach. The buffer must not be used again except to
+ *    reinitialize it.
+ *
+ * For byte array buffers the accumulated representation becomes the
+ * returned Tcl_Obj's internal rep; for string buffers the storage is
+ * handed over as the Tcl_Obj's string rep. In neither case is the
+ * content copied.
+ *
+ * Returns:
+ * Pointer to a Tcl_Obj with a reference count of zero containing the
+ * buffer content. Panics on memory allocation failure.
+ */
+TCLH_LIFO_EXTERN Tcl_Obj *Tclh_LifoBufferDetachToObj(Tclh_LifoBuffer *bufP);
+
+/* Function: Tclh_LifoBufferFree
+ * Discards a buffer and its content without detaching.
+ *
+ * Parameters:
+ * bufP - buffer to discard. The buffer must not be used again except to
+ *    reinitialize it.
+ */
+TCLH_LIFO_EXTERN void Tclh_LifoBufferFree(Tclh_LifoBuffer *bufP);
+
 #ifdef TCLH_IMPL
 #include "tclhLifoImpl.c"
 #endif
@@ -29,15 +29,35 @@
 
 #define PTRDIFF(end_, start_) ((Tclh_LifoUSizeT)((char*)(end_)-(char*)(start_)))
 
+/*
+ * Variants of the above that use the pool's configured alignment
+ * (lifo_alignment) instead of the platform default. The configured
+ * alignment is always a power-of-2 multiple of ALIGNMENT so these are
+ * at least as strict as their compile time counterparts.
+ */
+#define POOLROUNDUP(l_, x_) \
+    (((l_)->lifo_alignment - 1 + (x_)) & (~(intptr_t)((l_)->lifo_alignment - 1)))
+#define POOLROUNDDOWN(l_, x_) \
+    ((~(intptr_t)((l_)->lifo_alignment - 1)) & (x_))
+#define POOLALIGNPTR(l_, base_, offset_, type_)                                \
+    (type_) POOLROUNDUP(l_, (offset_) + (intptr_t)(base_))
+/*
+ * Extra bytes needed in a sized chunk so the first allocation can be
+ * moved up to the pool alignment without overrunning the chunk. Zero
+ * for pools with default alignment.
+ */
+#define POOLSLACK(l_)                                                          \
+    ((l_)->lifo_alignment > ALIGNMENT ? (l_)->lifo_alignment - ALIGNMENT : 0)
+
 /*
 Each region is composed of a linked list of contiguous chunks of memory. Each
 chunk is prefixed by a descriptor which is also used to link the chunks.
 */
-typedef struct Tclh_LifoChunk {
+struct Tclh_LifoChunk {
     TLH_ALIGN(16)
     struct Tclh_LifoChunk *lc_prev; /* Pointer to next chunk */
     void *               lc_end;  /* One beyond end of chunk */
-} Tclh_LifoChunk;
+};
 #define TCLH_LIFO_CHUNK_HEADER_ROUNDED (ROUNDUP(sizeof(Tclh_LifoChunk)))
 #define TCLH_LIFO_MAX_ALLOC (TCL_SIZE_MAX - TCLH_LIFO_CHUNK_HEADER_ROUNDED)
 
@@ -80,31 +100,125 @@ typedef struct Tclh_LifoMarkInfo {
     void *        lm_freeptr;    /* Ptr to unused space */
 } Tclh_LifoMarkInfo;
 
-int
-Tclh_LifoInit(Tclh_Lifo *l,
-            Tclh_LifoAllocFn *allocFunc,
-            Tclh_LifoFreeFn *freeFunc,
-            Tclh_LifoUSizeT chunk_sz,
-            int flags)
+/* Dispatch to the contextual allocator if one was configured */
+TCLH_INLINE void *TclhLifoRawAlloc(Tclh_Lifo *l, size_t sz) {
+    return l->lifo_allocExFn ? l->lifo_allocExFn(sz, l->lifo_allocData)
+                             : l->lifo_allocFn(sz);
+}
+
+TCLH_INLINE void TclhLifoRawFree(Tclh_Lifo *l, void *p) {
+    if (l->lifo_freeExFn)
+        l->lifo_freeExFn(p, l->lifo_allocData);
+    else
+        l->lifo_freeFn(p);
+}
+
+/*
+ * Allocates a chunk of at least chunk_sz total bytes (header included),
+ * preferring a recycled chunk from the pool's freelist. On success the
+ * returned chunk has lc_end set; lc_prev is left for the caller to link.
+ * Returns NULL on allocation failure.
+ */
+static Tclh_LifoChunk *
+TclhLifoAllocChunk(Tclh_Lifo *l, Tclh_LifoUSizeT chunk_sz)
 {
-    Tclh_LifoChunk *    c;
-    Tclh_LifoMark m;
+    Tclh_LifoChunk *c;
+    Tclh_LifoChunk **cPP;
+
+    for (cPP = &l->lifo_free_chunks; (c = *cPP) != NULL; cPP = &c->lc_prev) {
+        if (PTRDIFF(c->lc_end, c) >= chunk_sz) {
+            *cPP = c->lc_prev;
+            l->lifo_free_count -= 1;
+            TCLH_INSTRUMENT_INCR(l->lifo_statsP, lifoChunkRecycles);
+            return c;
+        }
+    }
+    c = TclhLifoRawAlloc(l, chunk_sz);
+    if (c) {
+        c->lc_end = ADDPTR(c, chunk_sz, void *);
+#ifdef TCLH_INSTRUMENT
+        if (l->lifo_statsP) {
+            l->lifo_statsP->lifoChunkAllocs += 1;
+            l->lifo_statsP->lifoAllocedBytes += chunk_sz;
+            if (l->lifo_statsP->lifoAllocedBytes
+                > l->lifo_statsP->lifoHwmBytes)
+                l->lifo_statsP->lifoHwmBytes =
+                    l->lifo_statsP->lifoAllocedBytes;
+        }
+#endif
+    }
+    return c;
+}
 
-    if (allocFunc == NULL) {
-        allocFunc = malloc;
-        freeFunc  = free;
-    } else {
-        if (freeFunc == NULL)
-            return TCLH_LIFO_E_INVALID_PARAM;
+/*
+ * Returns a chunk or big block to the pool, retaining it on the
+ * freelist for recycling when there is room. Oversized chunks go back
+ * to the allocator so the freelist does not pin large amounts of
+ * memory.
+ */
+static void
+TclhLifoFreeChunk(Tclh_Lifo *l, Tclh_LifoChunk *c)
+{
+    Tclh_LifoUSizeT sz = PTRDIFF(c->lc_end, c);
+    if (l->lifo_free_count < TCLH_LIFO_FREELIST_MAX
+        && sz <= (2 * l->lifo_chunk_size)) {
+        c->lc_prev          = l->lifo_free_chunks;
+        l->lifo_free_chunks = c;
+        l->lifo_free_count += 1;
+    }
+    else {
+#ifdef TCLH_INSTRUMENT
+        /*
+         * Chunks allocated before a stats sink was attached (e.g. the
+         * initial chunk) were never counted so clamp rather than wrap.
+         */
+        if (l->lifo_statsP) {
+            if (l->lifo_statsP->lifoAllocedBytes >= sz)
+                l->lifo_statsP->lifoAllocedBytes -= sz;
+            else
+                l->lifo_statsP->lifoAllocedBytes = 0;
+        }
+#endif
+        TclhLifoRawFree(l, c);
+    }
+}
+
+void
+Tclh_LifoTrim(Tclh_Lifo *l)
+{
+    Tclh_LifoChunk *c, *nextC;
+
+    for (c = l->lifo_free_chunks; c; c = nextC) {
+        nextC = c->lc_prev;
+        TclhLifoRawFree(l, c);
     }
+    l->lifo_free_chunks = NULL;
+    l->lifo_free_count  = 0;
+}
+
+static int
+TclhLifoInitCommon(Tclh_Lifo *l, Tclh_LifoUSizeT chunk_sz, int flags)
+{
+    Tclh_LifoChunk *    c;
+    Tclh_LifoMark m;
 
     if (chunk_sz < 8000)
         chunk_sz = 8000;
 
     chunk_sz = ROUNDUP(chunk_sz);
 
+    l->lifo_chunk_size = chunk_sz;
+    l->lifo_free_chunks = NULL;
+    l->lifo_free_count  = 0;
+    l->lifo_alignment = (flags & TCLH_LIFO_ALIGN64) ? 64 : ALIGNMENT;
+    l->lifo_flags = flags;
+    l->lifo_magic = TCLH_LIFO_MAGIC;
+#ifdef TCLH_INSTRUMENT
+    l->lifo_statsP = NULL;
+#endif
+
     /* Allocate a chunk and allocate space for the lifo descriptor from it */
-    c = allocFunc(chunk_sz);
+    c = TclhLifoRawAlloc(l, chunk_sz);
     if (c == 0) {
         if (flags & TCLH_LIFO_PANIC_ON_FAIL)
             TCLH_PANIC("Could not initialize memlifo");
@@ -114,19 +228,13 @@ Tclh_LifoInit(Tclh_Lifo *l,
     c->lc_prev = NULL;
     c->lc_end  = ADDPTR(c, chunk_sz, void *);
 
-    l->lifo_allocFn = allocFunc;
-    l->lifo_freeFn  = freeFunc;
-    l->lifo_chunk_size = chunk_sz;
-    l->lifo_flags = flags;
-    l->lifo_magic = TCLH_LIFO_MAGIC;
-
     /* Allocate mark from chunk itself */
     m = ALIGNPTR(c, sizeof(*c), Tclh_LifoMarkInfo *);
 
     m->lm_magic = TCLH_LIFO_MARK_MAGIC;
     m->lm_seq   = 1;
 
-    m->lm_freeptr = ALIGNPTR(m, sizeof(*m), void *);
+    m->lm_freeptr = POOLALIGNPTR(l, m, sizeof(*m), void *);
     m->lm_lifo    = l;
     m->lm_prev = m; /* Point back to itself. Effectively will never be popped */
     m->lm_big_blocks = 0;
@@ -139,6 +247,52 @@ Tclh_LifoInit(Tclh_Lifo *l,
     return TCLH_LIFO_E_SUCCESS;
 }
 
+int
+Tclh_LifoInit(Tclh_Lifo *l,
+            Tclh_LifoAllocFn *allocFunc,
+            Tclh_LifoFreeFn *freeFunc,
+            Tclh_LifoUSizeT chunk_sz,
+            int flags)
+{
+    if (allocFunc == NULL) {
+        allocFunc = malloc;
+        freeFunc  = free;
+    } else {
+        if (freeFunc == NULL)
+            return TCLH_LIFO_E_INVALID_PARAM;
+    }
+
+    l->lifo_allocFn   = allocFunc;
+    l->lifo_freeFn    = freeFunc;
+    l->lifo_allocExFn = NULL;
+    l->lifo_freeExFn  = NULL;
+    l->lifo_allocData = NULL;
+
+    return TclhLifoInitCommon(l, chunk_sz, flags);
+}
+
+int
+Tclh_LifoInitEx(Tclh_Lifo *l,
+                Tclh_LifoAllocDataFn *allocFunc,
+                Tclh_LifoFreeDataFn *freeFunc,
+                void *allocData,
+                Tclh_LifoUSizeT chunk_sz,
+                int flags)
+{
+    if (allocFunc == NULL)
+        return Tclh_LifoInit(l, NULL, NULL, chunk_sz, flags);
+    if (freeFunc == NULL)
+        return TCLH_LIFO_E_INVALID_PARAM;
+
+    l->lifo_allocFn   = NULL;
+    l->lifo_freeFn    = NULL;
+    l->lifo_allocExFn = allocFunc;
+    l->lifo_freeExFn  = freeFunc;
+    l->lifo_allocData = allocData;
+
+    return TclhLifoInitCommon(l, chunk_sz, flags);
+}
+
 void
 Tclh_LifoClose(Tclh_Lifo *l)
 {
@@ -151,8 +305,11 @@ Tclh_LifoClose(Tclh_Lifo *l)
     TCLH_ASSERT(l->lifo_bot_mark);
     TCLH_ASSERT(l->lifo_bot_mark->lm_chunks);
 
+    /* Release any chunks cached for recycling */
+    Tclh_LifoTrim(l);
+
     /* Finally free the chunk containing the bottom mark */
-    l->lifo_freeFn(l->lifo_bot_mark->lm_chunks);
+    TclhLifoRawFree(l, l->lifo_bot_mark->lm_chunks);
     memset(l, 0, sizeof(*l));
 }
 
@@ -163,7 +320,7 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
     Tclh_LifoUSizeT     chunk_sz;
     void *            p;
 
-    sz = ROUNDUP(sz);
+    sz = POOLROUNDUP(l, sz);
     if (sz == 0 || sz > TCLH_LIFO_MAX_ALLOC) {
         if (l->lifo_flags & TCLH_LIFO_PANIC_ON_FAIL)
             Tcl_Panic("Attempt to allocate %" TCLH_LIFO_SIZE_MODIFIER "u bytes for memlifo", sz);
@@ -232,9 +389,9 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
             chunk_sz = l->lifo_chunk_size;
 
         TCLH_ASSERT(ROUNDED(chunk_sz));
-        chunk_sz += TCLH_LIFO_CHUNK_HEADER_ROUNDED;
+        chunk_sz += TCLH_LIFO_CHUNK_HEADER_ROUNDED + POOLSLACK(l);
 
-        c = l->lifo_allocFn(chunk_sz);
+        c = TclhLifoAllocChunk(l, chunk_sz);
         if (c == 0) {
             if (l->lifo_flags & TCLH_LIFO_PANIC_ON_FAIL)
                 Tcl_Panic("Attempt to allocate %" TCLH_LIFO_SIZE_MODIFIER
@@ -243,13 +400,11 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
             return 0;
         }
 
-        c->lc_end = ADDPTR(c, chunk_sz, void *);
-
         c->lc_prev   = m->lm_chunks; /* Place on the list of chunks */
         m->lm_chunks = c;
 
-        m->lm_last_alloc = ALIGNPTR(c, sizeof(*c), void *);
-        m->lm_freeptr    = ALIGNPTR(m->lm_last_alloc, sz, void *);
+        m->lm_last_alloc = POOLALIGNPTR(l, c, sizeof(*c), void *);
+        m->lm_freeptr    = POOLALIGNPTR(l, m->lm_last_alloc, sz, void *);
         /* Notice that when we have to allocate a new chunk, we do not
          * give more than caller asked (modulo some rounding)
          */
@@ -258,17 +413,16 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
     }
     else {
         /* Allocate a separate big block. */
-        chunk_sz = sz + TCLH_LIFO_CHUNK_HEADER_ROUNDED;
+        chunk_sz = sz + TCLH_LIFO_CHUNK_HEADER_ROUNDED + POOLSLACK(l);
         TCLH_ASSERT(ROUNDED(chunk_sz));
 
-        c = (Tclh_LifoChunk *)l->lifo_allocFn(chunk_sz);
+        c = TclhLifoAllocChunk(l, chunk_sz);
         if (c == 0) {
             if (l->lifo_flags & TCLH_LIFO_PANIC_ON_FAIL)
                 Tcl_Panic("Attempt to allocate %" TCLH_LIFO_SIZE_MODIFIER "u bytes for memlifo",
                           chunk_sz);
             return NULL;
         }
-        c->lc_end = ADDPTR(c, chunk_sz, void *);
 
         c->lc_prev = m->lm_big_blocks; /* Place on the list of big blocks */
         m->lm_big_blocks = c;
@@ -276,7 +430,7 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
          * Note we do not modify m->m_freeptr since it still refers to
          * the current "mainstream" chunk.
          */
-        m->lm_last_alloc = ALIGNPTR(c, sizeof(*c), void *);
+        m->lm_last_alloc = POOLALIGNPTR(l, c, sizeof(*c), void *);
         if (actual_szP) {
             *actual_szP = PTRDIFF(c->lc_end, m->lm_last_alloc);
         }
@@ -285,6 +439,33 @@ void* Tclh_LifoAllocMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *actua
     return m->lm_last_alloc;
 }
 
+void *
+Tclh_LifoAllocAligned(Tclh_Lifo *l,
+                      Tclh_LifoUSizeT nbytes,
+                      Tclh_LifoUSizeT alignment)
+{
+    void *p;
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        if (l->lifo_flags & TCLH_LIFO_PANIC_ON_FAIL)
+            Tcl_Panic("Invalid alignment %" TCLH_LIFO_SIZE_MODIFIER
+                      "u for memlifo allocation",
+                      alignment);
+        return NULL;
+    }
+
+    /* Every allocation is already aligned to the pool alignment */
+    if (alignment <= l->lifo_alignment)
+        return Tclh_LifoAllocMin(l, nbytes, NULL);
+
+    /* Over-allocate so the pointer can be moved up to the alignment */
+    p = Tclh_LifoAllocMin(l, nbytes + alignment - l->lifo_alignment, NULL);
+    if (p == NULL)
+        return NULL;
+    return (void *)(((intptr_t)p + (intptr_t)(alignment - 1))
+                    & ~(intptr_t)(alignment - 1));
+}
+
 Tclh_LifoMark
 Tclh_LifoPushMark(Tclh_Lifo *l)
 {
@@ -302,7 +483,7 @@ Tclh_LifoPushMark(Tclh_Lifo *l)
      * Check for common case first - enough space in current chunk to
      * hold the mark.
      */
-    mark_sz = ROUNDUP(sizeof(Tclh_LifoMarkInfo));
+    mark_sz = POOLROUNDUP(l, sizeof(Tclh_LifoMarkInfo));
     p = ADDPTR(m->lm_freeptr, mark_sz, void *); /* Potential end of mark */
     if (p > (void *)m->lm_chunks                /* Ensure no wrap-around! */
         && p <= m->lm_chunks->lc_end) {
@@ -317,7 +498,7 @@ Tclh_LifoPushMark(Tclh_Lifo *l)
 	     * would change the state of the previous mark.
 	     */
         TCLH_ASSERT(l->lifo_chunk_size);
-        c = l->lifo_allocFn(l->lifo_chunk_size);
+        c = TclhLifoAllocChunk(l, l->lifo_chunk_size);
         if (c == 0) {
             if (l->lifo_flags & TCLH_LIFO_PANIC_ON_FAIL)
                 Tcl_Panic("Attempt to allocate %" TCLH_LIFO_SIZE_MODIFIER
@@ -325,7 +506,6 @@ Tclh_LifoPushMark(Tclh_Lifo *l)
                           l->lifo_chunk_size);
             return 0;
         }
-        c->lc_end = ADDPTR(c, l->lifo_chunk_size, void *);
 
         /*
          * Place on the list of chunks. Note however, that we do NOT
@@ -335,7 +515,7 @@ Tclh_LifoPushMark(Tclh_Lifo *l)
         c->lc_prev = m->lm_chunks; /* Place on the list of chunks */
         n = ALIGNPTR(c, sizeof(*c), Tclh_LifoMarkInfo *);
         n->lm_chunks = c;
-        n->lm_freeptr = ALIGNPTR(n, sizeof(*n), void *);
+        n->lm_freeptr = POOLALIGNPTR(l, n, sizeof(*n), void *);
     }
 
 #ifdef TCLH_LIFO_DEBUG
@@ -381,19 +561,21 @@ Tclh_LifoPopMark(Tclh_LifoMark m)
         while (c1 != end) {
             TCLH_ASSERT(c1);
             c2 = c1->lc_prev;
-            l->lifo_freeFn(c1);
+            TclhLifoFreeChunk(l, c1);
             c1 = c2;
         }
 
         /* Free up chunks. Once chunks are freed up, do NOT access m since
-         * it might have been freed as well.
+         * it might have been freed as well. Chunks are routed through the
+         * freelist so the next push/alloc cycle can recycle them without
+         * a trip through the allocator.
          */
         c1  = m->lm_chunks;
         end = n->lm_chunks;
         while (c1 != end) {
             TCLH_ASSERT(c1);
             c2 = c1->lc_prev;
-            l->lifo_freeFn(c1);
+            TclhLifoFreeChunk(l, c1);
             c1 = c2;
         }
     }
@@ -429,8 +611,8 @@ void *Tclh_LifoPushFrameMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *a
      * the add and a single compare.
      */
     TCLH_ASSERT(ALIGNED(m->lm_freeptr));
-    sz    = ROUNDUP(sz);
-    total = sz + ROUNDUP(sizeof(*m));             /* Note: ROUNDUP separately */
+    sz    = POOLROUNDUP(l, sz);
+    total = sz + POOLROUNDUP(l, sizeof(*m));      /* Note: ROUNDUP separately */
     p     = ADDPTR(m->lm_freeptr, total, void *); /* Potential end of mark */
     if (p > (void *)m->lm_chunks                  /* Ensure no wrap-around! */
         && p <= m->lm_chunks->lc_end) {
@@ -443,7 +625,7 @@ void *Tclh_LifoPushFrameMin(Tclh_Lifo *l, Tclh_LifoUSizeT sz, Tclh_LifoUSizeT *a
 #endif
         n->lm_prev       = m;
         n->lm_lifo       = l;
-        n->lm_last_alloc = ALIGNPTR(n, sizeof(*n), void *);
+        n->lm_last_alloc = POOLALIGNPTR(l, n, sizeof(*n), void *);
         /*
          * If actual_szP is non-NULL, caller wants to allocate at least sz
          * but as much as possible without allocating a new chunk
@@ -487,7 +669,7 @@ Tclh_LifoExpandLast(Tclh_Lifo *l, Tclh_LifoUSizeT incr, int fix)
         return Tclh_LifoAlloc(l, incr);
     }
 
-    incr = ROUNDUP(incr);
+    incr = POOLROUNDUP(l, incr);
 
     /*
      * Fast path. Allocation can be satisfied in place if the last
@@ -495,7 +677,7 @@ Tclh_LifoExpandLast(Tclh_Lifo *l, Tclh_LifoUSizeT incr, int fix)
      * current chunk
      */
     is_big_block
-        = (p == ADDPTR(m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
+        = (p == POOLALIGNPTR(l, m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
     if ((!is_big_block)
         && (PTRDIFF(m->lm_chunks->lc_end, m->lm_freeptr) >= incr)) {
         m->lm_freeptr = ADDPTR(m->lm_freeptr, incr, void *);
@@ -508,8 +690,7 @@ Tclh_LifoExpandLast(Tclh_Lifo *l, Tclh_LifoUSizeT incr, int fix)
 
     /* Need to allocate new block and copy to it. */
     if (is_big_block)
-        old_sz = PTRDIFF(m->lm_big_blocks->lc_end, m->lm_big_blocks)
-               - TCLH_LIFO_CHUNK_HEADER_ROUNDED;
+        old_sz = PTRDIFF(m->lm_big_blocks->lc_end, m->lm_last_alloc);
     else
         old_sz = PTRDIFF(m->lm_freeptr, m->lm_last_alloc);
 
@@ -529,19 +710,18 @@ Tclh_LifoExpandLast(Tclh_Lifo *l, Tclh_LifoUSizeT incr, int fix)
          * m. Note we do not need to update previous marks since only topmost
          * mark could point to allocations after the top mark.
          */
-        chunk_sz = sz + ROUNDUP(sizeof(Tclh_LifoChunk));
+        chunk_sz = sz + ROUNDUP(sizeof(Tclh_LifoChunk)) + POOLSLACK(l);
         TCLH_ASSERT(ROUNDED(chunk_sz));
-        c = (Tclh_LifoChunk *)l->lifo_allocFn(chunk_sz);
+        c = TclhLifoAllocChunk(l, chunk_sz);
         if (c == NULL)
             return NULL;
 
-        c->lc_end = ADDPTR(c, chunk_sz, void *);
-        p2        = ADDPTR(c, sizeof(*c), void *);
+        p2        = POOLALIGNPTR(l, c, sizeof(*c), void *);
         memcpy(p2, p, old_sz);
 
         /* Place on the list of big blocks, unlinking previous block */
         c->lc_prev = m->lm_big_blocks->lc_prev;
-        l->lifo_freeFn(m->lm_big_blocks);
+        TclhLifoFreeChunk(l, m->lm_big_blocks);
         m->lm_big_blocks = c;
         /*
          * Note we do not modify m->m_freeptr since it still refers to
@@ -576,11 +756,11 @@ Tclh_LifoShrinkLast(Tclh_Lifo *l, Tclh_LifoUSizeT decr, int fix)
         return 0;
 
     is_big_block = (m->lm_last_alloc
-                    == ADDPTR(m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
+                    == POOLALIGNPTR(l, m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
     if (!is_big_block) {
         old_sz = PTRDIFF(m->lm_freeptr, m->lm_last_alloc);
         /* do a size check but ignore if invalid */
-        decr = ROUNDDOWN(decr);
+        decr = POOLROUNDDOWN(l, decr);
         if (decr <= old_sz)
             m->lm_freeptr = SUBPTR(m->lm_freeptr, decr, void *);
     } else {
@@ -602,16 +782,15 @@ Tclh_LifoResizeLast(Tclh_Lifo *l, Tclh_LifoUSizeT new_sz, int fix)
         return 0;
 
     is_big_block = (m->lm_last_alloc
-                    == ADDPTR(m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
+                    == POOLALIGNPTR(l, m->lm_big_blocks, sizeof(Tclh_LifoChunk), void *));
 
     /*
      * Special fast path when allocation is not a big block and can be
      * done from current chunk
      */
-    new_sz = ROUNDUP(new_sz);
+    new_sz = POOLROUNDUP(l, new_sz);
     if (is_big_block) {
-        old_sz = PTRDIFF(m->lm_big_blocks->lc_end, m->lm_big_blocks)
-               - TCLH_LIFO_CHUNK_HEADER_ROUNDED;
+        old_sz = PTRDIFF(m->lm_big_blocks->lc_end, m->lm_last_alloc);
     } else {
         old_sz = PTRDIFF(m->lm_freeptr, m->lm_last_alloc);
         if (new_sz <= old_sz) {
@@ -662,9 +841,10 @@ Tclh_LifoValidate(Tclh_Lifo *l)
                 /* last alloc is not in chunk. See if it is a big block */
                 if (m->lm_big_blocks == NULL
                     || (m->lm_last_alloc
-                        != ADDPTR(m->lm_big_blocks,
-                                  ROUNDUP(sizeof(Tclh_LifoChunk)),
-                                  void *))) {
+                        != POOLALIGNPTR(l,
+                                        m->lm_big_blocks,
+                                        sizeof(Tclh_LifoChunk),
+                                        void *))) {
                     /* Not a big block allocation */
                     return -9;
                 }
@@ -686,6 +866,164 @@ Tclh_LifoValidate(Tclh_Lifo *l)
     return 0;
 }
 
+#define TCLH_LIFO_SCRATCH_CHUNK_SIZE 8000
+
+static void
+TclhCleanupScratchLifo(ClientData clientData, Tcl_Interp *interp)
+{
+    Tclh_Lifo *lifoP = (Tclh_Lifo *)clientData;
+    Tclh_LifoClose(lifoP);
+    Tcl_Free((void *)lifoP);
+}
+
+Tclh_Lifo *
+Tclh_LibScratchLifo(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return NULL;
+        if (Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return NULL;
+    }
+    if (tclhCtxP->scratchLifoP == NULL) {
+        Tclh_Lifo *lifoP = (Tclh_Lifo *)Tcl_Alloc(sizeof(*lifoP));
+        if (Tclh_LifoInit(lifoP, NULL, NULL, TCLH_LIFO_SCRATCH_CHUNK_SIZE, 0)
+            != TCLH_LIFO_E_SUCCESS) {
+            Tcl_Free((void *)lifoP);
+            return NULL;
+        }
+#ifdef TCLH_INSTRUMENT
+        lifoP->lifo_statsP = &tclhCtxP->instrument;
+#endif
+        Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupScratchLifo, lifoP);
+        tclhCtxP->scratchLifoP = lifoP;
+    }
+    return tclhCtxP->scratchLifoP;
+}
+
+Tclh_LifoMark
+Tclh_LibScratchPush(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    Tclh_Lifo *lifoP = Tclh_LibScratchLifo(interp, tclhCtxP);
+    if (lifoP == NULL)
+        return NULL;
+    return Tclh_LifoPushMark(lifoP);
+}
+
+#define TCLH_LIFO_BUFFER_MIN_CAPACITY 64
+
+int
+Tclh_LifoBufferInit(Tclh_LifoBuffer *bufP, Tclh_LifoUSizeT initialCapacity)
+{
+    if (initialCapacity < TCLH_LIFO_BUFFER_MIN_CAPACITY)
+        initialCapacity = TCLH_LIFO_BUFFER_MIN_CAPACITY;
+    if (initialCapacity > TCL_SIZE_MAX)
+        return TCLH_LIFO_E_NOMEMORY;
+    bufP->objP  = NULL;
+    bufP->bytes = Tcl_AttemptAlloc(initialCapacity);
+    if (bufP->bytes == NULL)
+        return TCLH_LIFO_E_NOMEMORY;
+    bufP->used     = 0;
+    bufP->capacity = initialCapacity;
+    return TCLH_LIFO_E_SUCCESS;
+}
+
+int
+Tclh_LifoBufferInitForByteArray(Tclh_LifoBuffer *bufP,
+                                Tclh_LifoUSizeT initialCapacity)
+{
+    if (initialCapacity < TCLH_LIFO_BUFFER_MIN_CAPACITY)
+        initialCapacity = TCLH_LIFO_BUFFER_MIN_CAPACITY;
+    if (initialCapacity > TCL_SIZE_MAX)
+        return TCLH_LIFO_E_NOMEMORY;
+    bufP->objP = Tcl_NewByteArrayObj((unsigned char *)"", 0);
+    bufP->bytes =
+        (char *)Tcl_SetByteArrayLength(bufP->objP, (Tcl_Size)initialCapacity);
+    bufP->used     = 0;
+    bufP->capacity = initialCapacity;
+    return TCLH_LIFO_E_SUCCESS;
+}
+
+int
+Tclh_LifoBufferGrow(Tclh_LifoBuffer *bufP, Tclh_LifoUSizeT numBytes)
+{
+    Tclh_LifoUSizeT required, newCapacity;
+
+    if (numBytes > ((Tclh_LifoUSizeT)TCL_SIZE_MAX - bufP->used))
+        return TCLH_LIFO_E_NOMEMORY;
+    required = bufP->used + numBytes;
+    if (required <= bufP->capacity)
+        return TCLH_LIFO_E_SUCCESS;
+
+    /* At least double so sequences of appends are amortized linear */
+    newCapacity = bufP->capacity;
+    do {
+        if (newCapacity > ((Tclh_LifoUSizeT)TCL_SIZE_MAX / 2)) {
+            newCapacity = required;
+            break;
+        }
+        newCapacity *= 2;
+    } while (newCapacity < required);
+
+    if (bufP->objP) {
+        /* The obj is unshared by construction so the rep may be grown
+         * in place. Note the rep storage may move. */
+        bufP->bytes =
+            (char *)Tcl_SetByteArrayLength(bufP->objP, (Tcl_Size)newCapacity);
+    }
+    else {
+        char *newBytes = Tcl_AttemptRealloc(bufP->bytes, newCapacity);
+        if (newBytes == NULL)
+            return TCLH_LIFO_E_NOMEMORY;
+        bufP->bytes = newBytes;
+    }
+    bufP->capacity = newCapacity;
+    return TCLH_LIFO_E_SUCCESS;
+}
+
+Tcl_Obj *
+Tclh_LifoBufferDetachToObj(Tclh_LifoBuffer *bufP)
+{
+    Tcl_Obj *objP;
+
+    if (bufP->objP) {
+        /* Trim the representation to the content; storage is retained */
+        objP = bufP->objP;
+        Tcl_SetByteArrayLength(objP, (Tcl_Size)bufP->used);
+    }
+    else {
+        char *bytes;
+        /* Ensure room for the terminating nul, then return the slack */
+        if (bufP->used >= bufP->capacity
+            && Tclh_LifoBufferGrow(bufP, 1) != TCLH_LIFO_E_SUCCESS)
+            TCLH_PANIC("Could not grow buffer for string terminator.");
+        bytes = Tcl_AttemptRealloc(bufP->bytes, bufP->used + 1);
+        if (bytes == NULL)
+            bytes = bufP->bytes; /* Shrink failed. Keep the larger block */
+        bytes[bufP->used] = '\0';
+        /* Hand over the storage as the new obj's string rep */
+        objP = Tcl_NewObj();
+        TCLH_ASSERT(objP->typePtr == NULL);
+        objP->bytes  = bytes;
+        objP->length = (Tcl_Size)bufP->used;
+    }
+    memset(bufP, 0, sizeof(*bufP));
+    return objP;
+}
+
+void
+Tclh_LifoBufferFree(Tclh_LifoBuffer *bufP)
+{
+    if (bufP->objP) {
+        /* Incr/Decr dance to dispose of the unreferenced obj */
+        Tcl_IncrRefCount(bufP->objP);
+        Tcl_DecrRefCount(bufP->objP);
+    }
+    else if (bufP->bytes)
+        Tcl_Free(bufP->bytes);
+    memset(bufP, 0, sizeof(*bufP));
+}
+
 #ifdef TBD
 #define STRING_LITERAL_OBJ(s) Tcl_NewStringObj(s, sizeof(s) - 1)
 int
@@ -81,11 +81,16 @@ TCLH_INLINE int Tclh_NsIsFQN(const char *nsP)
  * not already a FQN.
  *
  * The returned *Tcl_Obj* may be the same as *nameObj* if it is already
- * fully qualified or a newly allocated one. In either case, no changes in
+ * fully qualified or a possibly shared one. In either case, no changes in
  * reference counts is done and left to the caller. In particular, when
  * releasing the Tcl_Obj, caller must increment the reference count before
  * decrementing it to correctly handle the case where the existing object
- * is returned.
+ * is returned. The returned object must not be modified.
+ *
+ * The qualified result is cached on *nameObj*'s internal representation
+ * along with the qualifying namespace name, so repeated qualification of
+ * the same object in the same namespace returns the cached object without
+ * allocating.
  *
  * Returns:
  * A *Tcl_Obj* containing the fully qualified name.
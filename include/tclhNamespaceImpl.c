@@ -14,6 +14,52 @@ int Tclh_NsLibInit(Tcl_Interp *ip, Tclh_LibContext *tclhCtxP) {
     return TCL_OK; /* Must have been already initialized */
 }
 
+/*
+ * Qualification cache attached to a name obj's internal rep. Commands
+ * qualify the same few name objs against the same namespace over and over;
+ * the cache holds the previously built qualified obj along with the
+ * namespace name it was qualified against, so a repeat qualification is a
+ * string compare and a pointer return instead of an allocation. The name
+ * obj's string rep is never invalidated so no update proc is needed.
+ */
+typedef struct TclhNsQualifyCache {
+    Tcl_Obj *fqnObj; /* Qualified name. Holds a reference */
+    char *nsNameP;   /* Namespace used to qualify. Tcl_Alloc'ed copy */
+} TclhNsQualifyCache;
+
+static void
+NsQualifyCacheFree(Tcl_Obj *objP)
+{
+    TclhNsQualifyCache *cacheP =
+        (TclhNsQualifyCache *)objP->internalRep.twoPtrValue.ptr1;
+    Tcl_DecrRefCount(cacheP->fqnObj);
+    Tcl_Free(cacheP->nsNameP);
+    Tcl_Free((void *)cacheP);
+}
+
+static void
+NsQualifyCacheDup(Tcl_Obj *srcObj, Tcl_Obj *dstObj)
+{
+    TclhNsQualifyCache *srcCacheP =
+        (TclhNsQualifyCache *)srcObj->internalRep.twoPtrValue.ptr1;
+    TclhNsQualifyCache *cacheP =
+        (TclhNsQualifyCache *)Tcl_Alloc(sizeof(*cacheP));
+    cacheP->fqnObj = srcCacheP->fqnObj;
+    Tcl_IncrRefCount(cacheP->fqnObj);
+    cacheP->nsNameP = Tcl_Alloc(strlen(srcCacheP->nsNameP) + 1);
+    strcpy(cacheP->nsNameP, srcCacheP->nsNameP);
+    dstObj->internalRep.twoPtrValue.ptr1 = cacheP;
+    dstObj->typePtr = srcObj->typePtr;
+}
+
+static struct Tcl_ObjType gNsQualifyCacheType = {
+    "TclhNsQualifyCache",
+    NsQualifyCacheFree,
+    NsQualifyCacheDup,
+    NULL,
+    NULL,
+};
+
 Tcl_Obj *
 Tclh_NsQualifyNameObj(Tcl_Interp *ip, Tcl_Obj *nameObj, const char *defaultNsP)
 {
@@ -21,6 +67,7 @@ Tclh_NsQualifyNameObj(Tcl_Interp *ip, Tcl_Obj *nameObj, const char *defaultNsP)
     Tcl_Namespace *nsP;
     Tcl_Obj *fqnObj;
     Tcl_Size nameLen;
+    TclhNsQualifyCache *cacheP;
 
     nameP = Tcl_GetStringFromObj(nameObj, &nameLen);
     if (Tclh_NsIsFQN(nameP))
@@ -32,11 +79,36 @@ Tclh_NsQualifyNameObj(Tcl_Interp *ip, Tcl_Obj *nameObj, const char *defaultNsP)
         defaultNsP = nsP->fullName;
     }
 
+    if (nameObj->typePtr == &gNsQualifyCacheType) {
+        cacheP = (TclhNsQualifyCache *)nameObj->internalRep.twoPtrValue.ptr1;
+        if (!strcmp(cacheP->nsNameP, defaultNsP))
+            return cacheP->fqnObj; /* Same name, same namespace */
+    }
+
     fqnObj = Tcl_NewStringObj(defaultNsP, -1);
     /* Append '::' only if not global namespace else we'll get :::: */
     if (!Tclh_NsIsGlobalNs(defaultNsP))
         Tcl_AppendToObj(fqnObj, "::", 2);
     Tcl_AppendToObj(fqnObj, nameP, nameLen);
+
+    /* Cache for the next qualification of this obj */
+    if (nameObj->typePtr == &gNsQualifyCacheType) {
+        cacheP = (TclhNsQualifyCache *)nameObj->internalRep.twoPtrValue.ptr1;
+        Tcl_DecrRefCount(cacheP->fqnObj);
+        Tcl_Free(cacheP->nsNameP);
+    }
+    else {
+        if (nameObj->typePtr && nameObj->typePtr->freeIntRepProc)
+            nameObj->typePtr->freeIntRepProc(nameObj);
+        cacheP = (TclhNsQualifyCache *)Tcl_Alloc(sizeof(*cacheP));
+        nameObj->internalRep.twoPtrValue.ptr1 = cacheP;
+        nameObj->typePtr = &gNsQualifyCacheType;
+    }
+    cacheP->fqnObj = fqnObj;
+    Tcl_IncrRefCount(fqnObj);
+    cacheP->nsNameP = Tcl_Alloc(strlen(defaultNsP) + 1);
+    strcpy(cacheP->nsNameP, defaultNsP);
+
     return fqnObj;
 }
 
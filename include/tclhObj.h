@@ -424,6 +424,194 @@ TCLH_LOCAL Tclh_ReturnCode Tclh_ObjToDouble(Tcl_Interp *interp,
                                             Tcl_Obj *obj,
                                             double *ptr);
 
+/* Function: Tclh_ObjListToIntArray
+ * Converts a Tcl_Obj list into a C array of *int* values in one pass.
+ *
+ * Parameters:
+ * interp - Interpreter for error messages. May be NULL.
+ * listObj - *Tcl_Obj* containing the list
+ * capacity - number of elements the output array can hold
+ * valuesP - output array
+ * countP - location to store the number of elements in the list. May be
+ *    NULL. This is stored even when the capacity is insufficient so the
+ *    caller can resize and retry.
+ * errorIndexP - location to store the index of the first element that
+ *    failed conversion. May be NULL. Not modified on success or on a
+ *    capacity or list format error.
+ *
+ * Unlike an elementwise loop over <Tclh_ObjToInt>, the conversion checks
+ * each element's internal representation first, reading already-numeric
+ * elements directly, parses plain decimal string elements without
+ * shimmering them, and only falls back to the generic conversion (and
+ * its error checking) for the rest.
+ *
+ * Returns:
+ * TCL_OK on success. Otherwise TCL_ERROR with an error message in the
+ * interpreter; if the failure was an element conversion, the element
+ * index is stored in *errorIndexP*.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_ObjListToIntArray(Tcl_Interp *interp,
+                                                  Tcl_Obj *listObj,
+                                                  Tcl_Size capacity,
+                                                  int *valuesP,
+                                                  Tcl_Size *countP,
+                                                  Tcl_Size *errorIndexP);
+
+/* Function: Tclh_ObjListToWideArray
+ * Converts a Tcl_Obj list into a C array of *Tcl_WideInt* values in one
+ * pass.
+ *
+ * Parameters are as for <Tclh_ObjListToIntArray> except that *valuesP*
+ * is an array of *Tcl_WideInt*.
+ *
+ * Returns:
+ * TCL_OK on success. Otherwise TCL_ERROR with an error message in the
+ * interpreter; if the failure was an element conversion, the element
+ * index is stored in *errorIndexP*.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_ObjListToWideArray(Tcl_Interp *interp,
+                                                   Tcl_Obj *listObj,
+                                                   Tcl_Size capacity,
+                                                   Tcl_WideInt *valuesP,
+                                                   Tcl_Size *countP,
+                                                   Tcl_Size *errorIndexP);
+
+/* Function: Tclh_ObjListToDoubleArray
+ * Converts a Tcl_Obj list into a C array of *double* values in one pass.
+ *
+ * Parameters are as for <Tclh_ObjListToIntArray> except that *valuesP*
+ * is an array of *double*.
+ *
+ * Returns:
+ * TCL_OK on success. Otherwise TCL_ERROR with an error message in the
+ * interpreter; if the failure was an element conversion, the element
+ * index is stored in *errorIndexP*.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_ObjListToDoubleArray(Tcl_Interp *interp,
+                                                     Tcl_Obj *listObj,
+                                                     Tcl_Size capacity,
+                                                     double *valuesP,
+                                                     Tcl_Size *countP,
+                                                     Tcl_Size *errorIndexP);
+
+/* Function: Tclh_ObjFromIntArray
+ * Returns a Tcl_Obj list wrapping a C array of *int* values.
+ *
+ * Parameters:
+ * count - number of elements in the array
+ * valuesP - array of values to be wrapped
+ *
+ * Returns:
+ * A pointer to a Tcl_Obj with a zero reference count.
+ */
+TCLH_LOCAL Tcl_Obj *Tclh_ObjFromIntArray(Tcl_Size count, const int *valuesP);
+
+/* Function: Tclh_BignumPoolCheckout
+ * Checks out a pre-initialized *mp_int* from the context's scratch pool.
+ *
+ * Every mp_init/mp_clear pair is a heap allocation round trip. Code doing
+ * repeated tommath arithmetic can instead check out an initialized *mp_int*
+ * from a small per-interpreter pool; released entries retain their digit
+ * storage so steady-state use does not allocate. The checked out *mp_int*
+ * holds the value 0.
+ *
+ * Parameters:
+ * interp - Tcl interpreter for error messages. May be NULL if not available.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ *
+ * The returned *mp_int* must be returned to the pool by passing it to
+ * <Tclh_BignumPoolRelease> and must not be passed to *mp_clear*.
+ *
+ * Returns:
+ * Pointer to an initialized *mp_int* or NULL on failure with an error
+ * recorded in the interpreter.
+ */
+TCLH_LOCAL mp_int *
+Tclh_BignumPoolCheckout(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP);
+
+/* Function: Tclh_BignumPoolRelease
+ * Returns a *mp_int* checked out with <Tclh_BignumPoolCheckout> to the pool.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL if not available.
+ * tclhCtxP - Tclh context. Must correspond to the arguments passed to the
+ *    matching <Tclh_BignumPoolCheckout> call.
+ * bigP - the checked out *mp_int*.
+ */
+TCLH_LOCAL void Tclh_BignumPoolRelease(Tcl_Interp *interp,
+                                       Tclh_LibContext *tclhCtxP,
+                                       mp_int *bigP);
+
+/* Function: Tclh_ObjPoolAlloc
+ * Returns an unshared *Tcl_Obj* from the context's recycling pool.
+ *
+ * Construction of large transient results churns short-lived objs through
+ * the allocator. The pool keeps a per-interpreter stack of recycled objs;
+ * an allocation pops one, falling back to *Tcl_NewObj* when the pool is
+ * empty. Pooled objs are refilled by <Tclh_ObjPoolRelease> on code paths
+ * that would otherwise free them.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL if tclhCtxP is not NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *    the Tclh context associated with the interpreter is used after
+ *    initialization if necessary.
+ *
+ * Unlike *Tcl_NewObj* the returned obj already holds one reference owned
+ * by the caller. Dispose of it either with <Tclh_ObjPoolRelease> or, if it
+ * has been handed off (e.g. added to a list), with *Tcl_DecrRefCount*.
+ *
+ * Returns:
+ * Pointer to an unshared empty *Tcl_Obj* holding one reference.
+ */
+TCLH_LOCAL Tcl_Obj *
+Tclh_ObjPoolAlloc(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP);
+
+/* Function: Tclh_ObjPoolRelease
+ * Returns a *Tcl_Obj* reference to the context's recycling pool.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL if tclhCtxP is not NULL.
+ * tclhCtxP - Tclh context. May be NULL in which case the context
+ *    associated with the interpreter is used.
+ * objP - the obj whose reference is being given up. May be NULL.
+ *
+ * Gives up one reference to *objP*. If the obj is otherwise unreferenced
+ * it is reset to empty and retained for a future <Tclh_ObjPoolAlloc>
+ * rather than freed; shared objs just have their reference count
+ * decremented. May be passed any obj holding a caller reference, not only
+ * those from <Tclh_ObjPoolAlloc>.
+ */
+TCLH_LOCAL void Tclh_ObjPoolRelease(Tcl_Interp *interp,
+                                    Tclh_LibContext *tclhCtxP,
+                                    Tcl_Obj *objP);
+
+/* Function: Tclh_ObjPoolNewIntObjs
+ * Fills an array with integer *Tcl_Obj*s drawn from the recycling pool.
+ *
+ * Parameters:
+ * interp - Tcl interpreter. May be NULL if tclhCtxP is not NULL.
+ * tclhCtxP - Tclh context. May be NULL in which case the context
+ *    associated with the interpreter is used.
+ * count - number of values
+ * valuesP - array of *count* integer values
+ * objv - array of *count* locations to store the created objs
+ *
+ * Recycled objs are refilled in place, so a burst building a large list
+ * result allocates only for objs the pool cannot supply. As with
+ * <Tclh_ObjPoolAlloc>, each returned obj holds one caller-owned reference.
+ *
+ * Returns:
+ * TCL_OK - Success.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_ObjPoolNewIntObjs(Tcl_Interp *interp,
+                                                  Tclh_LibContext *tclhCtxP,
+                                                  Tcl_Size count,
+                                                  const int *valuesP,
+                                                  Tcl_Obj **objv);
+
 /* Function: Tclh_ObjGetBytesByRef
  * Retrieves a reference to the byte array in a Tcl_Obj.
  *
@@ -541,6 +729,15 @@ TCLH_INLINE Tcl_Obj* Tclh_ObjFromDString(Tcl_DString *dsP) {
 #define ObjToULongLong Tclh_ObjToULongLong
 #define ObjToFloat Tclh_ObjToFloat
 #define ObjToDouble Tclh_ObjToDouble
+#define ObjListToIntArray Tclh_ObjListToIntArray
+#define ObjListToWideArray Tclh_ObjListToWideArray
+#define ObjListToDoubleArray Tclh_ObjListToDoubleArray
+#define ObjFromIntArray Tclh_ObjFromIntArray
+#define BignumPoolCheckout Tclh_BignumPoolCheckout
+#define BignumPoolRelease Tclh_BignumPoolRelease
+#define ObjPoolAlloc      Tclh_ObjPoolAlloc
+#define ObjPoolRelease    Tclh_ObjPoolRelease
+#define ObjPoolNewIntObjs Tclh_ObjPoolNewIntObjs
 #define ObjArrayIncrRef Tclh_ObjArrayIncrRef
 #define ObjArrayDecrRef Tclh_ObjArrayDecrRef
 #define ObjFromAddress Tclh_ObjFromAddress
@@ -19,9 +19,11 @@ Tclh_ObjLibInit(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
     Tcl_Obj *objP;
 
     if (tclhCtxP == NULL) {
-        if (Tclh_LibInit(interp, NULL) != TCL_OK)
+        if (Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
             return TCL_ERROR;
     }
+    if (tclhCtxP->modInitMask & TCLH_MODINIT_OBJ)
+        return TCL_OK; /* Already done */
 
     gTclIntType = Tcl_GetObjType("int");
     if (gTclIntType == NULL) {
@@ -65,6 +67,7 @@ Tclh_ObjLibInit(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
         Tcl_DecrRefCount(objP);
     }
 
+    tclhCtxP->modInitMask |= TCLH_MODINIT_OBJ;
     return TCL_OK;
 }
 
@@ -89,6 +92,29 @@ Tclh_GetObjTypeDescriptor(const char *typename)
     return Tcl_GetObjType(typename);
 }
 
+/* Accessors for already-numeric internal reps, checked via the g* types */
+#if TCL_MAJOR_VERSION >= 9
+/* All integers use the wide rep */
+# define TclhObjIntValue(objP) ((Tcl_WideInt)(objP)->internalRep.wideValue)
+#else
+# define TclhObjIntValue(objP) ((Tcl_WideInt)(objP)->internalRep.longValue)
+#endif
+#define TclhObjWideValue(objP) ((Tcl_WideInt)(objP)->internalRep.wideValue)
+
+/*
+ * Retrieves the sign of an obj known to hold a bignum internal rep without
+ * the mp_init/mp_clear heap round trip that Tcl_GetBignumFromObj incurs.
+ * Tcl packs small bignums directly into the rep - digit array in ptr,
+ * (sign<<30)|(alloc<<15)|used in value - and stores a pointer to a heap
+ * mp_int with value (unsigned long)-1 when the value does not fit. The
+ * layout is unchanged from Tcl 8.6 through 9. Returns MP_ZPOS or MP_NEG.
+ */
+TCLH_INLINE int TclhBignumSign(Tcl_Obj *objP) {
+    if (objP->internalRep.ptrAndLongRep.value == (unsigned long)-1)
+        return ((const mp_int *)objP->internalRep.ptrAndLongRep.ptr)->sign;
+    return (int)((objP->internalRep.ptrAndLongRep.value >> 30) & 0x1);
+}
+
 Tclh_ReturnCode
 Tclh_ObjToRangedInt(Tcl_Interp *interp,
                     Tcl_Obj *obj,
@@ -225,12 +251,34 @@ Tcl_Obj *Tclh_ObjFromULong(unsigned long ul)
         return Tclh_ObjFromULongLong(ul);
 }
 
+#ifdef TCLH_INSTRUMENT
+/* Resolves the stats sink of interp's Tclh context. NULL if no interp. */
+static Tclh_InstrumentStats *TclhObjInstrument(Tcl_Interp *interp)
+{
+    Tclh_LibContext *ctxP = NULL;
+    if (interp == NULL || Tclh_LibInit(interp, &ctxP) != TCL_OK)
+        return NULL;
+    return &ctxP->instrument;
+}
+#endif
+
 Tclh_ReturnCode
 Tclh_ObjToWideInt(Tcl_Interp *interp, Tcl_Obj *objP, Tcl_WideInt *wideP)
 {
     /* TODO - can we just use Tcl_GetWideIntFromObj in Tcl9? Does it error if > WIDE_MAX? */
     int ret;
     Tcl_WideInt wide;
+
+    /* Already a 64-bit rep? Avoids the call and the bignum checks below. */
+    if (objP->typePtr == gTclIntType) {
+        *wideP = TclhObjIntValue(objP);
+        return TCL_OK;
+    }
+    if (objP->typePtr == gTclWideIntType) {
+        *wideP = TclhObjWideValue(objP);
+        return TCL_OK;
+    }
+
     ret = Tcl_GetWideIntFromObj(interp, objP, &wide);
     if (ret != TCL_OK)
         return ret;
@@ -254,18 +302,26 @@ Tclh_ObjToWideInt(Tcl_Interp *interp, Tcl_Obj *objP, Tcl_WideInt *wideP)
         && objP->typePtr != gTclBooleanType
         && objP->typePtr != gTclDoubleType) {
         /* Was it an integer overflow */
-        mp_int temp;
-        ret = Tcl_GetBignumFromObj(interp, objP, &temp);
-        if (ret == TCL_OK) {
-            if ((wide >= 0 && temp.sign == MP_NEG)
-                || (wide < 0 && temp.sign != MP_NEG)) {
-                Tcl_SetResult(interp,
-                              "Integer magnitude too large to represent.",
-                              TCL_STATIC);
-                ret = TCL_ERROR;
-            }
+        int sign;
+        TCLH_INSTRUMENT_INCR(TclhObjInstrument(interp), bignumFallbacks);
+        if (objP->typePtr == gTclBignumType) {
+            sign = TclhBignumSign(objP); /* No tommath allocation trip */
+        }
+        else {
+            mp_int temp;
+            ret = Tcl_GetBignumFromObj(interp, objP, &temp);
+            if (ret != TCL_OK)
+                return ret;
+            sign = temp.sign;
             mp_clear(&temp);
         }
+        if ((wide >= 0 && sign == MP_NEG)
+            || (wide < 0 && sign != MP_NEG)) {
+            Tcl_SetResult(interp,
+                          "Integer magnitude too large to represent.",
+                          TCL_STATIC);
+            ret = TCL_ERROR;
+        }
     }
 
     if (ret == TCL_OK)
@@ -289,6 +345,16 @@ Tclh_ObjToULongLong(Tcl_Interp *interp, Tcl_Obj *objP, unsigned long long *ullP)
 
     TCLH_ASSERT(sizeof(unsigned long long) == sizeof(Tcl_WideInt));
 
+    /* Already a 64-bit rep? Avoids the call and the bignum checks below. */
+    if (objP->typePtr == gTclIntType || objP->typePtr == gTclWideIntType) {
+        wide = objP->typePtr == gTclIntType ? TclhObjIntValue(objP)
+                                            : TclhObjWideValue(objP);
+        if (wide < 0)
+            goto negative_error;
+        *ullP = (unsigned long long)wide;
+        return TCL_OK;
+    }
+
     /* Tcl_GetWideInt will happily return overflows as negative numbers */
     ret = Tcl_GetWideIntFromObj(interp, objP, &wide);
     if (ret != TCL_OK)
@@ -319,22 +385,29 @@ Tclh_ObjToULongLong(Tcl_Interp *interp, Tcl_Obj *objP, unsigned long long *ullP)
     }
     else {
         /* Was it an integer overflow */
-        mp_int temp;
-        ret = Tcl_GetBignumFromObj(interp, objP, &temp);
-        if (ret == TCL_OK) {
-            int sign = temp.sign;
+        int sign;
+        TCLH_INSTRUMENT_INCR(TclhObjInstrument(interp), bignumFallbacks);
+        if (objP->typePtr == gTclBignumType) {
+            sign = TclhBignumSign(objP); /* No tommath allocation trip */
+        }
+        else {
+            mp_int temp;
+            ret = Tcl_GetBignumFromObj(interp, objP, &temp);
+            if (ret != TCL_OK)
+                return ret;
+            sign = temp.sign;
             mp_clear(&temp);
-            if (sign == MP_NEG)
-                goto negative_error;
-            /*
-             * Note Tcl_Tcl_GWIFO already takes care of overflows that do not
-             * fit in Tcl_WideInt width. So we need not worry about that.
-             * The overflow case is where a positive value is returned as
-             * negative by Tcl_GWIFO; that is also taken care of by the
-             * assignment below.
-             */
-            *ullP = (unsigned long long)wide;
         }
+        if (sign == MP_NEG)
+            goto negative_error;
+        /*
+         * Note Tcl_Tcl_GWIFO already takes care of overflows that do not
+         * fit in Tcl_WideInt width. So we need not worry about that.
+         * The overflow case is where a positive value is returned as
+         * negative by Tcl_GWIFO; that is also taken care of by the
+         * assignment below.
+         */
+        *ullP = (unsigned long long)wide;
     }
 
     return ret;
@@ -371,6 +444,429 @@ Tclh_ObjToDouble(Tcl_Interp *interp, Tcl_Obj *objP, double *dblP)
     return Tcl_GetDoubleFromObj(interp, objP, dblP);
 }
 
+/*
+ * Batch list conversion kernels. Converting a large list elementwise
+ * through Tclh_ObjToInt and friends pays for a type dispatch, function
+ * call and error path setup per element. The kernels below hoist the
+ * internal rep checks into the loop, read already-numeric elements
+ * directly, and parse plain decimal strings eight digits at a time
+ * without shimmering the element. Anything else - hex, octal, bignums,
+ * whitespace - falls back to the generic conversions which also provide
+ * the error message.
+ */
+
+/* The eight-digits-at-a-time parse relies on little endian byte order */
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) \
+    || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+# define TCLH_SWAR_LE 1
+#endif
+
+#ifdef TCLH_SWAR_LE
+TCLH_INLINE int TclhAllEightDigits(uint64_t chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ull)
+            | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+           == 0x3333333333333333ull;
+}
+TCLH_INLINE uint32_t TclhParseEightDigits(uint64_t chunk) {
+    const uint64_t mask = 0x000000FF000000FFull;
+    const uint64_t mul1 = 0x000F424000000064ull; /* 100 + (1000000 << 32) */
+    const uint64_t mul2 = 0x0000271000000001ull; /* 1 + (10000 << 32) */
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8); /* Adjacent digit pairs */
+    chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)chunk;
+}
+#endif
+
+/*
+ * Parses a string holding a plain decimal integer. Returns 1 on success
+ * storing the value in *wideP, 0 if the string needs the generic
+ * conversion path (non-decimal forms, surrounding whitespace, possible
+ * overflow, Tcl's leading-zero octal quirk).
+ */
+static int
+TclhParseDecimal(const char *s, Tcl_Size len, Tcl_WideInt *wideP)
+{
+    const char *end = s + len;
+    Tcl_WideUInt value = 0;
+    int negative = 0;
+
+    if (len == 0)
+        return 0;
+    if (*s == '-' || *s == '+') {
+        negative = (*s == '-');
+        ++s;
+    }
+    if (s == end || (end - s) > 19)
+        return 0; /* Empty or potential overflow/bignum */
+    if (s[0] == '0' && (end - s) > 1)
+        return 0; /* Leading zeros parse as octal in some Tcl versions */
+
+#ifdef TCLH_SWAR_LE
+    while ((end - s) >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, s, sizeof(chunk));
+        if (!TclhAllEightDigits(chunk))
+            return 0;
+        value = value * 100000000u + TclhParseEightDigits(chunk);
+        s += 8;
+    }
+#endif
+    while (s < end) {
+        unsigned int digit = (unsigned char)*s - '0';
+        if (digit > 9)
+            return 0;
+        value = value * 10 + digit;
+        ++s;
+    }
+    /* 19 digits cannot overflow unsigned, but may overflow signed */
+    if (value > (Tcl_WideUInt)INT64_MAX + (negative ? 1 : 0))
+        return 0;
+    *wideP = (Tcl_WideInt)(negative ? 0 - value : value);
+    return 1;
+}
+
+/* Core of the integer array kernels. Returns TCL_OK or error at *iP */
+static Tclh_ReturnCode
+TclhListElemToWide(Tcl_Interp *interp, Tcl_Obj *objP, Tcl_WideInt *wideP)
+{
+    if (objP->typePtr == gTclIntType)
+        *wideP = TclhObjIntValue(objP);
+    else if (objP->typePtr == gTclWideIntType)
+        *wideP = TclhObjWideValue(objP);
+    else if (objP->bytes == NULL
+             || !TclhParseDecimal(objP->bytes, objP->length, wideP))
+        return Tclh_ObjToWideInt(interp, objP, wideP);
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_ObjListToIntArray(Tcl_Interp *interp,
+                       Tcl_Obj *listObj,
+                       Tcl_Size capacity,
+                       int *valuesP,
+                       Tcl_Size *countP,
+                       Tcl_Size *errorIndexP)
+{
+    Tcl_Obj **objs;
+    Tcl_Size nobjs, i;
+
+    if (Tcl_ListObjGetElements(interp, listObj, &nobjs, &objs) != TCL_OK)
+        return TCL_ERROR;
+    if (countP)
+        *countP = nobjs;
+    if (nobjs > capacity) {
+        return Tclh_ErrorInvalidValue(
+            interp, NULL, "List length exceeds array capacity.");
+    }
+    for (i = 0; i < nobjs; ++i) {
+        Tcl_WideInt wide;
+        if (TclhListElemToWide(interp, objs[i], &wide) != TCL_OK)
+            goto conversion_error;
+        if (wide < INT_MIN || wide > INT_MAX) {
+            Tclh_ErrorRange(interp, objs[i], INT_MIN, INT_MAX);
+            goto conversion_error;
+        }
+        valuesP[i] = (int)wide;
+    }
+    return TCL_OK;
+
+conversion_error:
+    if (errorIndexP)
+        *errorIndexP = i;
+    return TCL_ERROR;
+}
+
+Tclh_ReturnCode
+Tclh_ObjListToWideArray(Tcl_Interp *interp,
+                        Tcl_Obj *listObj,
+                        Tcl_Size capacity,
+                        Tcl_WideInt *valuesP,
+                        Tcl_Size *countP,
+                        Tcl_Size *errorIndexP)
+{
+    Tcl_Obj **objs;
+    Tcl_Size nobjs, i;
+
+    if (Tcl_ListObjGetElements(interp, listObj, &nobjs, &objs) != TCL_OK)
+        return TCL_ERROR;
+    if (countP)
+        *countP = nobjs;
+    if (nobjs > capacity) {
+        return Tclh_ErrorInvalidValue(
+            interp, NULL, "List length exceeds array capacity.");
+    }
+    for (i = 0; i < nobjs; ++i) {
+        if (TclhListElemToWide(interp, objs[i], &valuesP[i]) != TCL_OK) {
+            if (errorIndexP)
+                *errorIndexP = i;
+            return TCL_ERROR;
+        }
+    }
+    return TCL_OK;
+}
+
+Tclh_ReturnCode
+Tclh_ObjListToDoubleArray(Tcl_Interp *interp,
+                          Tcl_Obj *listObj,
+                          Tcl_Size capacity,
+                          double *valuesP,
+                          Tcl_Size *countP,
+                          Tcl_Size *errorIndexP)
+{
+    Tcl_Obj **objs;
+    Tcl_Size nobjs, i;
+
+    if (Tcl_ListObjGetElements(interp, listObj, &nobjs, &objs) != TCL_OK)
+        return TCL_ERROR;
+    if (countP)
+        *countP = nobjs;
+    if (nobjs > capacity) {
+        return Tclh_ErrorInvalidValue(
+            interp, NULL, "List length exceeds array capacity.");
+    }
+    for (i = 0; i < nobjs; ++i) {
+        Tcl_Obj *objP = objs[i];
+        if (objP->typePtr == gTclDoubleType)
+            valuesP[i] = objP->internalRep.doubleValue;
+        else if (objP->typePtr == gTclIntType)
+            valuesP[i] = (double)TclhObjIntValue(objP);
+        else if (objP->typePtr == gTclWideIntType)
+            valuesP[i] = (double)TclhObjWideValue(objP);
+        else if (Tcl_GetDoubleFromObj(interp, objP, &valuesP[i]) != TCL_OK) {
+            if (errorIndexP)
+                *errorIndexP = i;
+            return TCL_ERROR;
+        }
+    }
+    return TCL_OK;
+}
+
+Tcl_Obj *
+Tclh_ObjFromIntArray(Tcl_Size count, const int *valuesP)
+{
+    Tcl_Obj **objs;
+    Tcl_Obj *listObj;
+    Tcl_Size i;
+
+    if (count <= 0)
+        return Tcl_NewListObj(0, NULL);
+    objs = (Tcl_Obj **)Tcl_Alloc(count * sizeof(Tcl_Obj *));
+    for (i = 0; i < count; ++i)
+        objs[i] = Tcl_NewIntObj(valuesP[i]);
+    listObj = Tcl_NewListObj(count, objs);
+    Tcl_Free((void *)objs);
+    return listObj;
+}
+
+/*
+ * mp_int scratch pool. mp_init/mp_clear is a heap allocation round trip;
+ * the pool below keeps a few initialized mp_int structures per interpreter
+ * whose digit storage is retained across checkouts so repeated tommath
+ * arithmetic stops allocating in steady state. Slots are initialized on
+ * first use; checkouts beyond the pool size fall back to a heap mp_int
+ * which Tclh_BignumPoolRelease recognizes by address and frees.
+ */
+#define TCLH_BIGNUM_POOL_SIZE 4
+typedef struct TclhBignumPool {
+    unsigned char initedMask; /* Bit i set -> bigs[i] has been mp_init'ed */
+    unsigned char inUseMask;  /* Bit i set -> bigs[i] is checked out */
+    mp_int bigs[TCLH_BIGNUM_POOL_SIZE];
+} TclhBignumPool;
+
+static void
+TclhCleanupBignumPool(ClientData clientData, Tcl_Interp *interp)
+{
+    TclhBignumPool *poolP = (TclhBignumPool *)clientData;
+    int i;
+    for (i = 0; i < TCLH_BIGNUM_POOL_SIZE; ++i) {
+        if (poolP->initedMask & (1 << i))
+            mp_clear(&poolP->bigs[i]);
+    }
+    Tcl_Free((void *)poolP);
+}
+
+mp_int *
+Tclh_BignumPoolCheckout(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    TclhBignumPool *poolP;
+    mp_int *bigP;
+    int i;
+
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return NULL;
+        if (Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return NULL;
+    }
+    poolP = tclhCtxP->bignumPoolP;
+    if (poolP == NULL) {
+        poolP = (TclhBignumPool *)Tcl_Alloc(sizeof(*poolP));
+        poolP->initedMask = 0;
+        poolP->inUseMask  = 0;
+        tclhCtxP->bignumPoolP = poolP;
+        Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupBignumPool, poolP);
+    }
+    for (i = 0; i < TCLH_BIGNUM_POOL_SIZE; ++i) {
+        if (poolP->inUseMask & (1 << i))
+            continue;
+        bigP = &poolP->bigs[i];
+        if (poolP->initedMask & (1 << i))
+            mp_zero(bigP); /* Value reset, digit storage retained */
+        else {
+            if (mp_init(bigP) != MP_OKAY) {
+                Tclh_ErrorAllocation(interp, "mp_int", NULL);
+                return NULL;
+            }
+            poolP->initedMask |= (1 << i);
+        }
+        poolP->inUseMask |= (1 << i);
+        return bigP;
+    }
+    /* Pool exhausted. */
+    bigP = (mp_int *)Tcl_Alloc(sizeof(*bigP));
+    if (mp_init(bigP) != MP_OKAY) {
+        Tcl_Free((void *)bigP);
+        Tclh_ErrorAllocation(interp, "mp_int", NULL);
+        return NULL;
+    }
+    return bigP;
+}
+
+void
+Tclh_BignumPoolRelease(Tcl_Interp *interp,
+                       Tclh_LibContext *tclhCtxP,
+                       mp_int *bigP)
+{
+    TclhBignumPool *poolP;
+
+    if (bigP == NULL)
+        return;
+    if (tclhCtxP == NULL && interp != NULL)
+        (void)Tclh_LibInit(interp, &tclhCtxP);
+    poolP = tclhCtxP ? tclhCtxP->bignumPoolP : NULL;
+    if (poolP && bigP >= &poolP->bigs[0]
+        && bigP < &poolP->bigs[TCLH_BIGNUM_POOL_SIZE]) {
+        poolP->inUseMask &= (unsigned char)~(1 << (bigP - &poolP->bigs[0]));
+        return;
+    }
+    /* Heap fallback from an exhausted pool */
+    mp_clear(bigP);
+    Tcl_Free((void *)bigP);
+}
+
+/*
+ * Tcl_Obj recycling pool. Building large transient results churns
+ * short-lived objs through the allocator; the pool below keeps a stack of
+ * unshared objs, each holding one reference, so burst construction pops
+ * and refills objs instead of allocating. Objs handed to Tcl (e.g. as
+ * list elements) are freed by Tcl when their refcount drops to zero and
+ * so must come from Tcl's own allocator; the pool therefore recycles
+ * Tcl-allocated objs rather than carving them out of private slabs.
+ */
+#define TCLH_OBJ_POOL_MAX 1024 /* Max objs retained in the pool */
+typedef struct TclhObjPool {
+    Tcl_Obj **objsP;   /* Stack of free objs, each holding one reference */
+    Tcl_Size count;    /* Number of objs in the stack */
+    Tcl_Size capacity; /* Allocated size of objsP */
+} TclhObjPool;
+
+static void
+TclhCleanupObjPool(ClientData clientData, Tcl_Interp *interp)
+{
+    TclhObjPool *poolP = (TclhObjPool *)clientData;
+    Tcl_Size i;
+    for (i = 0; i < poolP->count; ++i)
+        Tcl_DecrRefCount(poolP->objsP[i]);
+    if (poolP->objsP)
+        Tcl_Free((void *)poolP->objsP);
+    Tcl_Free((void *)poolP);
+}
+
+static TclhObjPool *
+TclhObjPoolGet(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    TclhObjPool *poolP;
+
+    if (tclhCtxP == NULL) {
+        if (interp == NULL)
+            return NULL;
+        if (Tclh_LibInit(interp, &tclhCtxP) != TCL_OK)
+            return NULL;
+    }
+    poolP = tclhCtxP->objPoolP;
+    if (poolP == NULL) {
+        poolP = (TclhObjPool *)Tcl_Alloc(sizeof(*poolP));
+        poolP->objsP    = NULL;
+        poolP->count    = 0;
+        poolP->capacity = 0;
+        tclhCtxP->objPoolP = poolP;
+        Tcl_CallWhenDeleted(tclhCtxP->interp, TclhCleanupObjPool, poolP);
+    }
+    return poolP;
+}
+
+Tcl_Obj *
+Tclh_ObjPoolAlloc(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
+{
+    TclhObjPool *poolP = TclhObjPoolGet(interp, tclhCtxP);
+    Tcl_Obj *objP;
+
+    if (poolP && poolP->count > 0)
+        return poolP->objsP[--poolP->count];
+    objP = Tcl_NewObj();
+    Tcl_IncrRefCount(objP);
+    return objP;
+}
+
+void
+Tclh_ObjPoolRelease(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP, Tcl_Obj *objP)
+{
+    TclhObjPool *poolP;
+
+    if (objP == NULL)
+        return;
+    poolP = TclhObjPoolGet(interp, tclhCtxP);
+    if (poolP == NULL || Tcl_IsShared(objP) || poolP->count >= TCLH_OBJ_POOL_MAX) {
+        Tcl_DecrRefCount(objP);
+        return;
+    }
+    if (poolP->count == poolP->capacity) {
+        poolP->capacity = poolP->capacity ? 2 * poolP->capacity : 64;
+        poolP->objsP    = (Tcl_Obj **)Tcl_Realloc(
+            (void *)poolP->objsP, poolP->capacity * sizeof(Tcl_Obj *));
+    }
+    /* Reset to an empty obj so large reps are not retained in the pool */
+    Tcl_SetStringObj(objP, "", 0);
+    poolP->objsP[poolP->count++] = objP;
+}
+
+Tclh_ReturnCode
+Tclh_ObjPoolNewIntObjs(Tcl_Interp *interp,
+                       Tclh_LibContext *tclhCtxP,
+                       Tcl_Size count,
+                       const int *valuesP,
+                       Tcl_Obj **objv)
+{
+    TclhObjPool *poolP = TclhObjPoolGet(interp, tclhCtxP);
+    Tcl_Size i = 0;
+
+    if (poolP) {
+        /* Refill recycled objs in place; they are unshared by contract */
+        while (i < count && poolP->count > 0) {
+            Tcl_Obj *objP = poolP->objsP[--poolP->count];
+            Tcl_SetWideIntObj(objP, valuesP[i]);
+            objv[i] = objP;
+            ++i;
+        }
+    }
+    for (; i < count; ++i) {
+        objv[i] = Tcl_NewWideIntObj(valuesP[i]);
+        Tcl_IncrRefCount(objv[i]);
+    }
+    return TCL_OK;
+}
+
 Tclh_ReturnCode
 Tclh_ObjToFloat(Tcl_Interp *interp, Tcl_Obj *objP, float *fltP)
 {
@@ -291,6 +291,128 @@ Tclh_PointerInvalidateTagged(Tcl_Interp *interp,
                        const void *pointer,
                        Tclh_PointerTypeTag expected_tag);
 
+/* Function: Tclh_PointerInvalidateTag
+ * Removes all pointers registered with a given tag from the pointer
+ * registration database.
+ *
+ * Parameters:
+ * interp   - Tcl interpreter in which the pointers are to be unregistered.
+ *           May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *            the Tclh context associated with the interpreter is used.
+ * tag      - Type tag for the pointers. If NULL or empty, only pointers
+ *            registered without a tag are invalidated.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Pointers registered with exactly the passed tag become invalid (as
+ * defined by Tclh_PointerVerifyTagged) irrespective of their reference
+ * counts. The cost is proportional to the number of pointers registered
+ * with the tag, not the size of the registry.
+ *
+ * Returns:
+ * TCL_OK    - The pointers were successfully invalidated.
+ * TCL_ERROR - The Tclh context could not be obtained.
+ */
+TCLH_LOCAL Tclh_ReturnCode
+Tclh_PointerInvalidateTag(Tcl_Interp *interp,
+                          Tclh_LibContext *tclhCtxP,
+                          Tclh_PointerTypeTag tag);
+
+/* Function: Tclh_PointerRegisterBatch
+ * Registers an array of pointer values as being "valid".
+ *
+ * Parameters:
+ * interp  - Tcl interpreter in which the pointers are to be registered.
+ *           May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *            the Tclh context associated with the interpreter is used.
+ * nPointers - Number of pointer values in the pointers array.
+ * pointers - Array of pointer values to be registered.
+ * tag     - Type tag for the pointers. Pass NULL or 0 for typeless pointers.
+ * objPP   - if not NULL, a pointer to a new Tcl_Obj holding the list of
+ *           pointer representations is stored here on success. The Tcl_Obj
+ *           has a reference count of 0.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Each pointer is registered as by <Tclh_PointerRegister> but the registry
+ * is fetched and grown to its final capacity only once so the cost is
+ * amortized over the batch. If registration of a pointer fails, pointers
+ * earlier in the array remain registered.
+ *
+ * Returns:
+ * TCL_OK    - all pointers were successfully registered
+ * TCL_ERROR - registration of a pointer failed. An error message is stored
+ *             in the interpreter.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_PointerRegisterBatch(Tcl_Interp *interp,
+                                                     Tclh_LibContext *tclhCtxP,
+                                                     Tcl_Size nPointers,
+                                                     void *const pointers[],
+                                                     Tclh_PointerTypeTag tag,
+                                                     Tcl_Obj **objPP);
+
+/* Function: Tclh_PointerUnregisterBatch
+ * Unregisters an array of previously registered pointers.
+ *
+ * Parameters:
+ * interp   - Tcl interpreter in which the pointers are to be unregistered.
+ *           May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *            the Tclh context associated with the interpreter is used.
+ * nPointers - Number of pointer values in the pointers array.
+ * pointers - Array of pointer values to be unregistered.
+ * expected_tag - Type tag for the pointers.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Each pointer is unregistered as by <Tclh_PointerUnregisterTagged> with
+ * the registry fetched only once for the batch. If unregistration of a
+ * pointer fails, pointers earlier in the array remain unregistered.
+ *
+ * Returns:
+ * TCL_OK    - All pointers were successfully unregistered.
+ * TCL_ERROR - A pointer was not registered or was registered with a
+ *             different type. An error message is left in interp.
+ */
+TCLH_LOCAL Tclh_ReturnCode
+Tclh_PointerUnregisterBatch(Tcl_Interp *interp,
+                            Tclh_LibContext *tclhCtxP,
+                            Tcl_Size nPointers,
+                            void *const pointers[],
+                            Tclh_PointerTypeTag expected_tag);
+
+/* Function: Tclh_PointerInvalidateBatch
+ * Removes an array of pointers from the pointer registration database.
+ *
+ * Parameters:
+ * interp   - Tcl interpreter in which the pointers are to be unregistered.
+ *           May be NULL.
+ * tclhCtxP - Tclh context as returned by <Tclh_LibInit> to use. If NULL,
+ *            the Tclh context associated with the interpreter is used.
+ * nPointers - Number of pointer values in the pointers array.
+ * pointers - Array of pointer values to be invalidated.
+ * expected_tag - Type tag for the pointers.
+ *
+ * At least one of interp and tclhCtxP must be non-NULL.
+ *
+ * Each pointer is invalidated as by <Tclh_PointerInvalidateTagged> with
+ * the registry fetched only once for the batch. Pointers that are not
+ * registered are ignored without error.
+ *
+ * Returns:
+ * TCL_OK    - The pointers were successfully invalidated.
+ * TCL_ERROR - A pointer was registered with a different type.
+ *             An error message is left in interp.
+ */
+TCLH_LOCAL Tclh_ReturnCode
+Tclh_PointerInvalidateBatch(Tcl_Interp *interp,
+                            Tclh_LibContext *tclhCtxP,
+                            Tcl_Size nPointers,
+                            void *const pointers[],
+                            Tclh_PointerTypeTag expected_tag);
+
 /* Function: Tclh_PointerRegistered
  * Verifies that the passed pointer is registered as a valid pointer.
  *
@@ -822,11 +944,139 @@ Tclh_ErrorPointerObjRegistration(Tcl_Interp *interp,
                               Tcl_Obj *ptrObj,
                               Tclh_PointerRegistrationStatus regStatus);
 
+/* Section: Shared Pointer Registry
+ *
+ * The registry described above is tied to one interpreter. Handles
+ * produced in a worker thread can therefore not be verified in a
+ * sibling interpreter without re-registration. The shared pointer
+ * registry is an opt-in, process-wide registry for such handles. It is
+ * independent of the per-interpreter registries; a pointer registered
+ * in one is invisible to the other.
+ *
+ * Registration, unregistration and invalidation take a short
+ * process-wide lock. Verification is lock-free: readers validate a
+ * sequence-stamped snapshot of the registry and retry if a writer
+ * intervened, so any number of threads can validate handles
+ * concurrently without serializing.
+ *
+ * Because Tcl_Obj values must not be shared across threads, tags in the
+ * shared registry are held as interned strings (see
+ * <Tclh_AtomInternShared>) and compared by string value. Tag subtyping
+ * defined through <Tclh_PointerSubtagDefine> does not apply; tags must
+ * match exactly. Registrations are always counted, as by
+ * <Tclh_PointerRegisterCounted>.
+ */
+
+/* Function: Tclh_SharedPointerRegister
+ * Registers a pointer value in the process-wide shared registry.
+ *
+ * Parameters:
+ * interp  - Interpreter for error messages. May be NULL.
+ * pointer - Pointer value to be registered.
+ * tag     - Type tag for the pointer. Pass NULL or 0 for typeless pointers.
+ *           Only the string value is relevant and need not come from the
+ *           same interpreter or thread as prior registrations.
+ * objPP   - if not NULL, a pointer to a new Tcl_Obj holding the pointer
+ *           representation is stored here on success. The Tcl_Obj has
+ *           a reference count of 0 and belongs to the calling thread.
+ *
+ * Registrations are counted; the pointer remains registered until
+ * unregistered as many times as it was registered. Registering a
+ * pointer that is already registered with a different tag is an error.
+ *
+ * Returns:
+ * TCL_OK    - pointer was successfully registered
+ * TCL_ERROR - pointer registration failed. An error message is stored in
+ *             the interpreter.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_SharedPointerRegister(Tcl_Interp *interp,
+                                                      void *pointer,
+                                                      Tclh_PointerTypeTag tag,
+                                                      Tcl_Obj **objPP);
+
+/* Function: Tclh_SharedPointerUnregister
+ * Unregisters a pointer from the process-wide shared registry.
+ *
+ * Parameters:
+ * interp  - Interpreter for error messages. May be NULL.
+ * pointer - Pointer value to be unregistered.
+ * tag     - Type tag for the pointer. Pass NULL to skip tag checking.
+ *
+ * The registration count is decremented and the pointer becomes invalid
+ * (as defined by <Tclh_SharedPointerVerify>) when it reaches zero.
+ *
+ * Returns:
+ * TCL_OK    - The pointer was successfully unregistered.
+ * TCL_ERROR - The pointer was not registered or was registered with a
+ *             different tag. An error message is left in interp.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_SharedPointerUnregister(Tcl_Interp *interp,
+                                                        const void *pointer,
+                                                        Tclh_PointerTypeTag tag);
+
+/* Function: Tclh_SharedPointerInvalidate
+ * Removes a pointer from the process-wide shared registry irrespective
+ * of its registration count.
+ *
+ * Parameters:
+ * interp  - Interpreter for error messages. May be NULL.
+ * pointer - Pointer value to be invalidated.
+ * tag     - Type tag for the pointer. Pass NULL to skip tag checking.
+ *
+ * Returns:
+ * TCL_OK    - The pointer was invalidated or was not registered in the
+ *             first place.
+ * TCL_ERROR - The pointer was registered with a different tag.
+ *             An error message is left in interp.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_SharedPointerInvalidate(Tcl_Interp *interp,
+                                                        const void *pointer,
+                                                        Tclh_PointerTypeTag tag);
+
+/* Function: Tclh_SharedPointerVerify
+ * Verifies that a pointer is registered in the process-wide shared
+ * registry, without taking any lock.
+ *
+ * Parameters:
+ * interp  - Interpreter for error messages. May be NULL.
+ * pointer - Pointer value to be verified.
+ * tag     - Type tag for the pointer. Pass NULL to skip tag checking.
+ *
+ * May be called concurrently from any number of threads.
+ *
+ * Returns:
+ * TCL_OK    - The pointer is registered with a matching tag.
+ * TCL_ERROR - The pointer is not registered or is registered with a
+ *             different tag. An error message is left in interp.
+ */
+TCLH_LOCAL Tclh_ReturnCode Tclh_SharedPointerVerify(Tcl_Interp *interp,
+                                                    const void *pointer,
+                                                    Tclh_PointerTypeTag tag);
+
+/* Function: Tclh_SharedPointerRegistered
+ * Checks whether a pointer is registered in the process-wide shared
+ * registry, without taking any lock.
+ *
+ * Parameters:
+ * pointer - Pointer value to be checked.
+ *
+ * May be called concurrently from any number of threads.
+ *
+ * Returns:
+ * 1    - The pointer is registered.
+ * 0    - The pointer is not registered.
+ */
+TCLH_LOCAL int Tclh_SharedPointerRegistered(const void *pointer);
+
 #ifdef TCLH_SHORTNAMES
 #define PointerLibInit            Tclh_PointerLibInit
 #define PointerLibFinit           Tclh_PointerLibFinit
 #define PointerRegister           Tclh_PointerRegister
+#define PointerRegisterBatch      Tclh_PointerRegisterBatch
 #define PointerUnregister         Tclh_PointerUnregister
+#define PointerUnregisterBatch    Tclh_PointerUnregisterBatch
+#define PointerInvalidateBatch    Tclh_PointerInvalidateBatch
+#define PointerInvalidateTag      Tclh_PointerInvalidateTag
 #define PointerRegistered         Tclh_PointerRegistered
 #define PointerRegistrationAffirm Tclh_PointerRegistrationAffirm
 #define PointerVerify             Tclh_PointerVerify
@@ -848,6 +1098,11 @@ Tclh_ErrorPointerObjRegistration(Tcl_Interp *interp,
 #define PointerInvalidate         Tclh_PointerInvalidate
 #define PointerObjDissect         Tclh_PointerObjDissect
 #define PointerObjInfo            Tclh_PointerObjInfo
+#define SharedPointerRegister     Tclh_SharedPointerRegister
+#define SharedPointerUnregister   Tclh_SharedPointerUnregister
+#define SharedPointerInvalidate   Tclh_SharedPointerInvalidate
+#define SharedPointerVerify       Tclh_SharedPointerVerify
+#define SharedPointerRegistered   Tclh_SharedPointerRegistered
 #define ErrorPointerNull          Tclh_ErrorPointerNull
 #define ErrorPointerObjType       Tclh_ErrorPointerObjType
 #define ErrorPointerObjRegistration  Tclh_ErrorPointerObjRegistration
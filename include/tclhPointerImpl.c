@@ -25,15 +25,300 @@ typedef enum Tclh_PointerRegistrationType {
  */
 typedef struct TclhPointerRecord {
     Tcl_Obj *tagObj;            /* Identifies the "type". May be NULL */
+    const void *pv;             /* The registered pointer value */
+    /*
+     * Links in the list of records registered with the same tag (the
+     * untagged list if tagObj is NULL). See TclhPointerRecordTagLink.
+     */
+    struct TclhPointerRecord *tagNextP;
+    struct TclhPointerRecord **tagPrevNextP; /* Link field pointing here */
     int nRefs;                  /* Number of references to the pointer */
 #define TCLH_POINTER_NREFS_MAX INT_MAX
 } TclhPointerRecord;
 
+/*
+ * The pointers table is a purpose-built open addressing hash table
+ * rather than a Tcl_HashTable. Pointer keys are fixed width and hash
+ * with a single multiply, so the bucket chains of Tcl_HashTable cost
+ * more in dependent cache misses than the generality buys. Linear
+ * probing over a flat slot array touches a single cache line for most
+ * look ups. Deletion compacts the probe sequence by backward shifting
+ * so no tombstones accumulate to lengthen later probes.
+ */
+typedef struct TclhPointerTableSlot {
+    const void *key;         /* Pointer value. NULL indicates a free slot */
+    TclhPointerRecord *recP; /* Registration record for the pointer */
+} TclhPointerTableSlot;
+
+typedef struct TclhPointerTable {
+    TclhPointerTableSlot *slotsP;
+    size_t numEntries;       /* Number of occupied slots */
+    size_t numSlots;         /* Total slots. Always a power of 2 */
+#ifdef TCLH_INSTRUMENT
+    Tclh_InstrumentStats *instrP; /* Sink for look up and probe counters.
+                                     NULL -> no counting */
+#endif
+} TclhPointerTable;
+
+#define TCLH_POINTER_TABLE_MIN_SLOTS 64
+
+TCLH_INLINE size_t TclhPointerHashIndex(const void *key, size_t mask) {
+    /* Fibonacci hashing, multiplier is 2^64/phi (2^32/phi on 32-bit) */
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    uintptr_t h = (uintptr_t)key * (uintptr_t)0x9E3779B97F4A7C15u;
+    return ((size_t)(h >> 32)) & mask;
+#else
+    uintptr_t h = (uintptr_t)key * (uintptr_t)0x9E3779B9u;
+    return ((size_t)(h >> 16)) & mask;
+#endif
+}
+
+static void
+TclhPointerTableInit(TclhPointerTable *tableP, size_t sizeHint)
+{
+    size_t numSlots = TCLH_POINTER_TABLE_MIN_SLOTS;
+    /* Table is kept at most 2/3 full */
+    while (numSlots < sizeHint + (sizeHint / 2))
+        numSlots *= 2;
+    tableP->slotsP =
+        (TclhPointerTableSlot *)Tcl_Alloc(numSlots * sizeof(*tableP->slotsP));
+    memset(tableP->slotsP, 0, numSlots * sizeof(*tableP->slotsP));
+    tableP->numEntries = 0;
+    tableP->numSlots   = numSlots;
+#ifdef TCLH_INSTRUMENT
+    tableP->instrP = NULL;
+#endif
+}
+
+static void
+TclhPointerTableFree(TclhPointerTable *tableP)
+{
+    Tcl_Free((void *)tableP->slotsP);
+    tableP->slotsP     = NULL;
+    tableP->numEntries = 0;
+    tableP->numSlots   = 0;
+}
+
+static TclhPointerRecord *
+TclhPointerTableFind(TclhPointerTable *tableP, const void *key)
+{
+    size_t mask              = tableP->numSlots - 1;
+    size_t i                 = TclhPointerHashIndex(key, mask);
+    TclhPointerRecord *recP  = NULL;
+    TCLH_INSTRUMENT_ONLY(size_t probes = 1);
+
+    while (tableP->slotsP[i].key) {
+        if (tableP->slotsP[i].key == key) {
+            recP = tableP->slotsP[i].recP;
+            break;
+        }
+        TCLH_INSTRUMENT_ONLY(probes += 1);
+        i = (i + 1) & mask;
+    }
+    TCLH_INSTRUMENT_INCR(tableP->instrP, pointerLookups);
+    TCLH_INSTRUMENT_ADD(tableP->instrP, pointerProbes, probes);
+    return recP;
+}
+
+static void
+TclhPointerTableResize(TclhPointerTable *tableP, size_t numSlots)
+{
+    TclhPointerTableSlot *oldSlotsP = tableP->slotsP;
+    size_t oldNumSlots              = tableP->numSlots;
+    size_t mask                     = numSlots - 1;
+    size_t i;
+
+    TCLH_ASSERT(3 * tableP->numEntries <= 2 * numSlots);
+
+    tableP->slotsP =
+        (TclhPointerTableSlot *)Tcl_Alloc(numSlots * sizeof(*tableP->slotsP));
+    memset(tableP->slotsP, 0, numSlots * sizeof(*tableP->slotsP));
+    tableP->numSlots = numSlots;
+    for (i = 0; i < oldNumSlots; ++i) {
+        size_t j;
+        if (oldSlotsP[i].key == NULL)
+            continue;
+        j = TclhPointerHashIndex(oldSlotsP[i].key, mask);
+        while (tableP->slotsP[j].key)
+            j = (j + 1) & mask;
+        tableP->slotsP[j] = oldSlotsP[i];
+    }
+    Tcl_Free((void *)oldSlotsP);
+}
+
+/* Grows the table so numAdditional entries can be added without a resize */
+static void
+TclhPointerTableReserve(TclhPointerTable *tableP, size_t numAdditional)
+{
+    size_t numSlots = tableP->numSlots;
+
+    while (3 * (tableP->numEntries + numAdditional) > 2 * numSlots)
+        numSlots *= 2;
+    if (numSlots != tableP->numSlots)
+        TclhPointerTableResize(tableP, numSlots);
+}
+
+static TclhPointerRecord **
+TclhPointerTableAdd(TclhPointerTable *tableP, const void *key, int *newEntryP)
+{
+    size_t mask;
+    size_t i;
+
+    /* Keep the table at most 2/3 full */
+    if (3 * (tableP->numEntries + 1) > 2 * tableP->numSlots)
+        TclhPointerTableResize(tableP, 2 * tableP->numSlots);
+
+    mask = tableP->numSlots - 1;
+    i    = TclhPointerHashIndex(key, mask);
+    {
+        TCLH_INSTRUMENT_ONLY(size_t probes = 1);
+        while (tableP->slotsP[i].key) {
+            if (tableP->slotsP[i].key == key) {
+                TCLH_INSTRUMENT_INCR(tableP->instrP, pointerLookups);
+                TCLH_INSTRUMENT_ADD(tableP->instrP, pointerProbes, probes);
+                *newEntryP = 0;
+                return &tableP->slotsP[i].recP;
+            }
+            TCLH_INSTRUMENT_ONLY(probes += 1);
+            i = (i + 1) & mask;
+        }
+        TCLH_INSTRUMENT_INCR(tableP->instrP, pointerLookups);
+        TCLH_INSTRUMENT_ADD(tableP->instrP, pointerProbes, probes);
+        TCLH_INSTRUMENT_INCR(tableP->instrP, pointerRegistrations);
+    }
+    tableP->slotsP[i].key  = key;
+    tableP->slotsP[i].recP = NULL;
+    tableP->numEntries += 1;
+    *newEntryP = 1;
+    return &tableP->slotsP[i].recP;
+}
+
+static void
+TclhPointerTableDelete(TclhPointerTable *tableP, const void *key)
+{
+    size_t mask = tableP->numSlots - 1;
+    size_t i    = TclhPointerHashIndex(key, mask);
+    size_t j;
+
+    while (tableP->slotsP[i].key != key) {
+        if (tableP->slotsP[i].key == NULL)
+            return; /* Not present */
+        i = (i + 1) & mask;
+    }
+    /*
+     * Backward shift any entries that probed past the vacated slot so
+     * the probe sequences stay unbroken without tombstones. An entry at
+     * j may be moved into the hole at i if its home slot precedes i in
+     * the (cyclic) probe order.
+     */
+    j = i;
+    while (1) {
+        size_t home;
+        j = (j + 1) & mask;
+        if (tableP->slotsP[j].key == NULL)
+            break;
+        home = TclhPointerHashIndex(tableP->slotsP[j].key, mask);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            tableP->slotsP[i] = tableP->slotsP[j];
+            i = j;
+        }
+    }
+    tableP->slotsP[i].key  = NULL;
+    tableP->slotsP[i].recP = NULL;
+    tableP->numEntries -= 1;
+}
+
+/*
+ * Successful verifications are remembered in a small direct mapped
+ * cache stamped with the registry generation. The outcome of a
+ * verification depends only on the pointer value, the tag and the
+ * registry state, so re-verifying a handle that is passed in
+ * repeatedly - the common pattern in tight call loops - reduces to two
+ * loads and a compare instead of a registry probe. The generation is
+ * bumped by any operation that can invalidate a prior positive
+ * verification: unregistration, invalidation, a registration that
+ * overwrites an existing tag, a cast, or a change to the castables
+ * table. Fresh registrations need no bump since a missing pointer can
+ * never have been cached as verified.
+ */
+#define TCLH_POINTER_VCACHE_SIZE 256 /* Must be power of 2 */
+typedef struct TclhPointerVCacheEntry {
+    const void *pv;              /* Pointer value verified. NULL if unused */
+    Tclh_PointerTypeTag tagObj;  /* Tag verified against (same Tcl_Obj).
+                                    Holds a reference so the identity test
+                                    on a hit cannot be fooled by the obj
+                                    allocator reusing a freed address */
+    unsigned long generation;    /* Registry generation at verification */
+} TclhPointerVCacheEntry;
+
 typedef struct TclhPointerRegistry {
-    Tcl_HashTable pointers;/* Table of registered pointers */
+    TclhPointerTable pointers;/* Table of registered pointers */
     Tcl_HashTable castables;/* Table of permitted casts subclass -> class */
+    Tcl_HashTable tagIndex; /* Tag string -> list of records with that tag */
+    TclhPointerRecord *untaggedRecordsP; /* List of records without a tag */
+    unsigned long generation; /* Bumped when a verification may be stale */
+    TclhPointerVCacheEntry vcache[TCLH_POINTER_VCACHE_SIZE];
 } TclhPointerRegistry;
 
+/*
+ * Records are threaded on a doubly linked list per tag, hanging off
+ * tagIndex keyed by the tag string, so enumerating or invalidating the
+ * pointers of one tag costs a walk of its members rather than of the
+ * whole registry. The backlink is a pointer to the link field of the
+ * predecessor so unlinking needs no head special case. Index entries
+ * whose list has emptied are left in place; they are bounded by the
+ * number of distinct tags ever registered.
+ */
+static void
+TclhPointerRecordTagLink(TclhPointerRegistry *registryP,
+                         TclhPointerRecord *ptrRecP)
+{
+    TclhPointerRecord **headPP;
+
+    if (ptrRecP->tagObj == NULL)
+        headPP = &registryP->untaggedRecordsP;
+    else {
+        int isNew;
+        Tcl_HashEntry *he = Tcl_CreateHashEntry(
+            &registryP->tagIndex, Tcl_GetString(ptrRecP->tagObj), &isNew);
+        if (isNew)
+            Tcl_SetHashValue(he, NULL);
+        headPP = (TclhPointerRecord **)&he->clientData;
+    }
+    ptrRecP->tagNextP     = *headPP;
+    ptrRecP->tagPrevNextP = headPP;
+    if (ptrRecP->tagNextP)
+        ptrRecP->tagNextP->tagPrevNextP = &ptrRecP->tagNextP;
+    *headPP = ptrRecP;
+}
+
+static void
+TclhPointerRecordTagUnlink(TclhPointerRecord *ptrRecP)
+{
+    *ptrRecP->tagPrevNextP = ptrRecP->tagNextP;
+    if (ptrRecP->tagNextP)
+        ptrRecP->tagNextP->tagPrevNextP = ptrRecP->tagPrevNextP;
+}
+
+static TclhPointerRecord *
+TclhPointerTagRecords(TclhPointerRegistry *registryP, Tclh_PointerTypeTag tag)
+{
+    Tcl_HashEntry *he =
+        Tcl_FindHashEntry(&registryP->tagIndex, Tcl_GetString(tag));
+    return he ? (TclhPointerRecord *)Tcl_GetHashValue(he) : NULL;
+}
+
+TCLH_INLINE TclhPointerVCacheEntry *
+TclhPointerVCacheSlot(TclhPointerRegistry *registryP, const void *pointer) {
+    return &registryP->vcache[TclhPointerHashIndex(
+        pointer, TCLH_POINTER_VCACHE_SIZE - 1)];
+}
+
+/* Invalidates ALL cached verifications in the registry */
+TCLH_INLINE void TclhPointerVCacheInvalidate(TclhPointerRegistry *registryP) {
+    registryP->generation += 1;
+}
+
 /*
  * Pointer is a Tcl "type" whose internal representation is stored
  * as the pointer value and an associated C pointer/handle type.
@@ -83,12 +368,19 @@ TclhCleanupPointerRegistry(ClientData clientData, Tcl_Interp *interp)
     Tcl_HashTable *hTblPtr;
     Tcl_HashEntry *he;
     Tcl_HashSearch hSearch;
-    hTblPtr = &registryP->pointers;
-    for (he = Tcl_FirstHashEntry(hTblPtr, &hSearch); he != NULL;
-         he = Tcl_NextHashEntry(&hSearch)) {
-        TclhPointerRecordFree((TclhPointerRecord *)Tcl_GetHashValue(he));
+    TclhPointerTableSlot *slotP = registryP->pointers.slotsP;
+    TclhPointerTableSlot *endP  = slotP + registryP->pointers.numSlots;
+    int i;
+    for (; slotP < endP; ++slotP) {
+        if (slotP->key)
+            TclhPointerRecordFree(slotP->recP);
+    }
+    TclhPointerTableFree(&registryP->pointers);
+
+    for (i = 0; i < TCLH_POINTER_VCACHE_SIZE; ++i) {
+        if (registryP->vcache[i].tagObj)
+            Tcl_DecrRefCount(registryP->vcache[i].tagObj);
     }
-    Tcl_DeleteHashTable(&registryP->pointers);
 
     hTblPtr = &registryP->castables;
     for (he = Tcl_FirstHashEntry(hTblPtr, &hSearch); he != NULL;
@@ -100,6 +392,9 @@ TclhCleanupPointerRegistry(ClientData clientData, Tcl_Interp *interp)
     }
     Tcl_DeleteHashTable(&registryP->castables);
 
+    /* Records in the tag index were freed in the slot loop above */
+    Tcl_DeleteHashTable(&registryP->tagIndex);
+
     Tcl_Free((void *)registryP);
 }
 
@@ -137,8 +432,13 @@ Tclh_PointerLibInit(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP)
 
     TclhPointerRegistry *registryP;
     registryP = (TclhPointerRegistry *)Tcl_Alloc(sizeof(*registryP));
-    Tcl_InitHashTable(&registryP->pointers, TCL_ONE_WORD_KEYS);
+    memset(registryP, 0, sizeof(*registryP)); /* generation, vcache */
+    TclhPointerTableInit(&registryP->pointers, 0);
+#ifdef TCLH_INSTRUMENT
+    registryP->pointers.instrP = &tclhCtxP->instrument;
+#endif
     Tcl_InitHashTable(&registryP->castables, TCL_STRING_KEYS);
+    Tcl_InitHashTable(&registryP->tagIndex, TCL_STRING_KEYS);
     Tcl_CallWhenDeleted(interp, TclhCleanupPointerRegistry, registryP);
     tclhCtxP->pointerRegistryP = registryP;
 
@@ -497,7 +797,91 @@ TclhPointerRecordFree(TclhPointerRecord *ptrRecP)
     Tcl_Free((void *)ptrRecP);
 }
 
-Tclh_ReturnCode
+static void
+TclhPointerRecordUpdate(TclhPointerRegistry *registryP,
+                        TclhPointerRecord **recPP,
+                        int newEntry,
+                        const void *pointer,
+                        Tclh_PointerTypeTag tag,
+                        Tclh_PointerRegistrationType registration)
+{
+    TclhPointerRecord *ptrRecP;
+
+    if (newEntry) {
+        ptrRecP = (TclhPointerRecord *)Tcl_Alloc(sizeof(*ptrRecP));
+        ptrRecP->pv = pointer;
+        if (tag && registration != TCLH_PINNED_POINTER) {
+            Tcl_IncrRefCount(tag);
+            ptrRecP->tagObj = tag;
+        }
+        else
+            ptrRecP->tagObj = NULL;
+        /* -1 => uncounted pointer (only single reference allowed) */
+        switch (registration) {
+            case TCLH_UNCOUNTED_POINTER:
+                ptrRecP->nRefs = -1;
+                break;
+            case TCLH_COUNTED_POINTER:
+                ptrRecP->nRefs = 1;
+                break;
+            case TCLH_PINNED_POINTER:
+                ptrRecP->nRefs = TCLH_POINTER_NREFS_MAX;
+                break;
+        }
+        TclhPointerRecordTagLink(registryP, ptrRecP);
+        *recPP = ptrRecP;
+    } else {
+        ptrRecP = *recPP;
+        /* Note pinned pointers are unaffected */
+        if (ptrRecP->nRefs != TCLH_POINTER_NREFS_MAX) {
+            /*
+             * If new registration is pinned, it takes precedence
+             * Tags are immaterial in this case
+             */
+            if (registration == TCLH_PINNED_POINTER) {
+                if (ptrRecP->tagObj) {
+                    Tcl_DecrRefCount(ptrRecP->tagObj);
+                    ptrRecP->tagObj = NULL;
+                    TclhPointerRecordTagUnlink(ptrRecP);
+                    TclhPointerRecordTagLink(registryP, ptrRecP);
+                    TclhPointerVCacheInvalidate(registryP);
+                }
+                ptrRecP->nRefs = TCLH_POINTER_NREFS_MAX;
+            }
+            else {
+                /* If the existing tag is compatible AND registration type is same
+                    */
+                int tagCompatible =
+                    PointerTypeCompatible(registryP, tag, ptrRecP->tagObj);
+                if (tagCompatible && registration == TCLH_UNCOUNTED_POINTER && ptrRecP->nRefs < 0) {
+                    /* Tag compatible and both are uncounted */
+                    /* Nothing to do, ref count unchanged */
+                }
+                else if (tagCompatible
+                         && registration == TCLH_COUNTED_POINTER
+                         && ptrRecP->nRefs > 0) {
+                    /* Tag compatible and counted */
+                    ptrRecP->nRefs += 1;
+                }
+                else {
+                    /* Incompatible tags or different registration. Overwrite */
+                    if (tag)
+                        Tcl_IncrRefCount(tag);
+                    if (ptrRecP->tagObj)
+                        Tcl_IncrRefCount(ptrRecP->tagObj);
+                    ptrRecP->tagObj = tag;
+                    ptrRecP->nRefs =
+                        registration == TCLH_UNCOUNTED_POINTER ? -1 : 1;
+                    TclhPointerRecordTagUnlink(ptrRecP);
+                    TclhPointerRecordTagLink(registryP, ptrRecP);
+                    TclhPointerVCacheInvalidate(registryP);
+                }
+            }
+        }
+    }
+}
+
+static Tclh_ReturnCode
 TclhPointerRegister(Tcl_Interp *interp,
                     Tclh_LibContext *tclhCtxP,
                     void *pointer,
@@ -509,88 +893,16 @@ TclhPointerRegister(Tcl_Interp *interp,
     if (registryP == NULL)
         return TCL_ERROR;
 
-    Tcl_HashTable *hTblPtr;
-    Tcl_HashEntry *he;
+    TclhPointerRecord **recPP;
     int            newEntry;
-    TclhPointerRecord *ptrRecP;
 
     if (pointer == NULL)
         return Tclh_ErrorPointerNull(interp);
 
-    hTblPtr   = &registryP->pointers;
-    he = Tcl_CreateHashEntry(hTblPtr, pointer, &newEntry);
-
-    if (he) {
-        if (newEntry) {
-            ptrRecP = (TclhPointerRecord *)Tcl_Alloc(sizeof(*ptrRecP));
-            if (tag && registration != TCLH_PINNED_POINTER) {
-                Tcl_IncrRefCount(tag);
-                ptrRecP->tagObj = tag;
-            }
-            else
-                ptrRecP->tagObj = NULL;
-            /* -1 => uncounted pointer (only single reference allowed) */
-            switch (registration) {
-                case TCLH_UNCOUNTED_POINTER:
-                    ptrRecP->nRefs = -1;
-                    break;
-                case TCLH_COUNTED_POINTER:
-                    ptrRecP->nRefs = 1;
-                    break;
-                case TCLH_PINNED_POINTER:
-                    ptrRecP->nRefs = TCLH_POINTER_NREFS_MAX;
-                    break;
-            }
-            Tcl_SetHashValue(he, ptrRecP);
-        } else {
-            ptrRecP = Tcl_GetHashValue(he);
-            /* Note pinned pointers are unaffected */
-            if (ptrRecP->nRefs != TCLH_POINTER_NREFS_MAX) {
-                /*
-                 * If new registration is pinned, it takes precedence
-                 * Tags are immaterial in this case
-                 */
-                if (registration == TCLH_PINNED_POINTER) {
-                    if (ptrRecP->tagObj) {
-                        Tcl_DecrRefCount(ptrRecP->tagObj);
-                        ptrRecP->tagObj = NULL;
-                    }
-                    ptrRecP->nRefs = TCLH_POINTER_NREFS_MAX;
-                }
-                else {
-                    /* If the existing tag is compatible AND registration type is same
-                        */
-                    int tagCompatible =
-                        PointerTypeCompatible(registryP, tag, ptrRecP->tagObj);
-                    if (tagCompatible && registration == TCLH_UNCOUNTED_POINTER && ptrRecP->nRefs < 0) {
-                        /* Tag compatible and both are uncounted */
-                        /* Nothing to do, ref count unchanged */
-                    }
-                    else if (tagCompatible
-                             && registration == TCLH_COUNTED_POINTER
-                             && ptrRecP->nRefs > 0) {
-                        /* Tag compatible and counted */
-                        ptrRecP->nRefs += 1;
-                    }
-                    else {
-                        /* Incompatible tags or different registration. Overwrite */
-                        if (tag)
-                            Tcl_IncrRefCount(tag);
-                        if (ptrRecP->tagObj)
-                            Tcl_IncrRefCount(ptrRecP->tagObj);
-                        ptrRecP->tagObj = tag;
-                        ptrRecP->nRefs =
-                            registration == TCLH_UNCOUNTED_POINTER ? -1 : 1;
-                    }
-                }
-            }
-        }
-        if (objPP)
-            *objPP = Tclh_PointerWrap(pointer, tag);
-    } else {
-        TCLH_PANIC("Failed to allocate hash table entry.");
-        return TCL_ERROR; /* NOT REACHED but keep compiler happy */
-    }
+    recPP = TclhPointerTableAdd(&registryP->pointers, pointer, &newEntry);
+    TclhPointerRecordUpdate(registryP, recPP, newEntry, pointer, tag, registration);
+    if (objPP)
+        *objPP = Tclh_PointerWrap(pointer, tag);
     return TCL_OK;
 }
 
@@ -627,6 +939,54 @@ Tclh_PointerRegisterPinned(Tcl_Interp *interp,
         interp, tclhCtxP, pointer, tag, objPP, TCLH_PINNED_POINTER);
 }
 
+Tclh_ReturnCode
+Tclh_PointerRegisterBatch(Tcl_Interp *interp,
+                          Tclh_LibContext *tclhCtxP,
+                          Tcl_Size nPointers,
+                          void *const pointers[],
+                          Tclh_PointerTypeTag tag,
+                          Tcl_Obj **objPP)
+{
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+
+    Tcl_Obj **objs = NULL;
+    Tcl_Size i;
+
+    /* Grow the table upfront so per-entry additions never rehash */
+    TclhPointerTableReserve(&registryP->pointers, nPointers);
+
+    if (objPP)
+        objs = (Tcl_Obj **)Tcl_Alloc(nPointers * sizeof(Tcl_Obj *));
+
+    for (i = 0; i < nPointers; ++i) {
+        TclhPointerRecord **recPP;
+        int newEntry;
+
+        if (pointers[i] == NULL) {
+            if (objs) {
+                while (i-- > 0) {
+                    Tcl_IncrRefCount(objs[i]);
+                    Tcl_DecrRefCount(objs[i]);
+                }
+                Tcl_Free((void *)objs);
+            }
+            return Tclh_ErrorPointerNull(interp);
+        }
+        recPP = TclhPointerTableAdd(&registryP->pointers, pointers[i], &newEntry);
+        TclhPointerRecordUpdate(
+            registryP, recPP, newEntry, pointers[i], tag, TCLH_UNCOUNTED_POINTER);
+        if (objs)
+            objs[i] = Tclh_PointerWrap(pointers[i], tag);
+    }
+    if (objPP) {
+        *objPP = Tcl_NewListObj(nPointers, objs);
+        Tcl_Free((void *)objs);
+    }
+    return TCL_OK;
+}
+
 static int
 PointerTypeCompatible(TclhPointerRegistry *registryP,
                       Tclh_PointerTypeTag tag,
@@ -668,16 +1028,17 @@ Tclh_PointerUnregister(Tcl_Interp *interp,
     if (registryP == NULL)
         return TCL_ERROR;
 
-    Tcl_HashEntry *he;
+    TclhPointerRecord *ptrRecP;
 
-    he = Tcl_FindHashEntry(&registryP->pointers, pointer);
-    if (he) {
-        TclhPointerRecord *ptrRecP = Tcl_GetHashValue(he);
+    ptrRecP = TclhPointerTableFind(&registryP->pointers, pointer);
+    if (ptrRecP) {
         /* Pinned pointers stay pinned */
         if (ptrRecP->nRefs != TCLH_POINTER_NREFS_MAX) {
             if (ptrRecP->nRefs <= 1) {
+                TclhPointerRecordTagUnlink(ptrRecP);
                 TclhPointerRecordFree(ptrRecP);
-                Tcl_DeleteHashEntry(he);
+                TclhPointerTableDelete(&registryP->pointers, pointer);
+                TclhPointerVCacheInvalidate(registryP);
             }
         else {
             ptrRecP->nRefs -= 1;
@@ -691,20 +1052,23 @@ Tclh_PointerUnregister(Tcl_Interp *interp,
 
 static Tclh_ReturnCode
 PointerVerifyOrUnregisterTagged(Tcl_Interp *interp,
-                                Tclh_LibContext *tclhCtxP,
+                                TclhPointerRegistry *registryP,
                                 const void *pointer,
                                 Tclh_PointerTypeTag tag,
                                 int unrefCount)
 {
-    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
-    if (registryP == NULL)
-        return TCL_ERROR;
+    TclhPointerRecord *ptrRecP;
+    TclhPointerVCacheEntry *entryP = TclhPointerVCacheSlot(registryP, pointer);
 
-    Tcl_HashEntry *he;
+    if (unrefCount == 0) {
+        /* Pure verification. Check the cache of past verifications. */
+        if (entryP->pv == pointer && entryP->tagObj == tag
+            && entryP->generation == registryP->generation)
+            return TCL_OK;
+    }
 
-    he = Tcl_FindHashEntry(&registryP->pointers, pointer);
-    if (he) {
-        TclhPointerRecord *ptrRecP = Tcl_GetHashValue(he);
+    ptrRecP = TclhPointerTableFind(&registryP->pointers, pointer);
+    if (ptrRecP) {
         if (!PointerTypeCompatible(registryP, tag, ptrRecP->tagObj)) {
             return PointerTypeMismatchError(interp, tag, ptrRecP->tagObj);
         }
@@ -712,15 +1076,28 @@ PointerVerifyOrUnregisterTagged(Tcl_Interp *interp,
             if (ptrRecP->nRefs == TCLH_POINTER_NREFS_MAX) {
                 /* Pinned pointers only affected if ref decrement is MAX */
                 if (unrefCount == TCLH_POINTER_NREFS_MAX) {
+                    TclhPointerRecordTagUnlink(ptrRecP);
                     TclhPointerRecordFree(ptrRecP);
-                    Tcl_DeleteHashEntry(he);
+                    TclhPointerTableDelete(&registryP->pointers, pointer);
+                    TclhPointerVCacheInvalidate(registryP);
                 }
             } else if (ptrRecP->nRefs <= unrefCount) {
+                TclhPointerRecordTagUnlink(ptrRecP);
                 TclhPointerRecordFree(ptrRecP);
-                Tcl_DeleteHashEntry(he);
+                TclhPointerTableDelete(&registryP->pointers, pointer);
+                TclhPointerVCacheInvalidate(registryP);
             } else {
                 ptrRecP->nRefs -= unrefCount;
             }
+        } else {
+            /* Remember the verification for repeat passing of the handle */
+            if (tag)
+                Tcl_IncrRefCount(tag);
+            if (entryP->tagObj)
+                Tcl_DecrRefCount(entryP->tagObj);
+            entryP->pv         = pointer;
+            entryP->tagObj     = tag;
+            entryP->generation = registryP->generation;
         }
         return TCL_OK;
     }
@@ -736,7 +1113,31 @@ Tclh_PointerUnregisterTagged(Tcl_Interp *interp,
                        const void *pointer,
                        Tclh_PointerTypeTag tag)
 {
-    return PointerVerifyOrUnregisterTagged(interp, tclhCtxP, pointer, tag, 1);
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+    return PointerVerifyOrUnregisterTagged(interp, registryP, pointer, tag, 1);
+}
+
+Tclh_ReturnCode
+Tclh_PointerUnregisterBatch(Tcl_Interp *interp,
+                            Tclh_LibContext *tclhCtxP,
+                            Tcl_Size nPointers,
+                            void *const pointers[],
+                            Tclh_PointerTypeTag tag)
+{
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+
+    Tcl_Size i;
+    for (i = 0; i < nPointers; ++i) {
+        Tclh_ReturnCode ret =
+            PointerVerifyOrUnregisterTagged(interp, registryP, pointers[i], tag, 1);
+        if (ret != TCL_OK)
+            return ret;
+    }
+    return TCL_OK;
 }
 
 Tclh_ReturnCode
@@ -745,8 +1146,32 @@ Tclh_PointerInvalidateTagged(Tcl_Interp *interp,
                        const void *pointer,
                        Tclh_PointerTypeTag tag)
 {
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
     return PointerVerifyOrUnregisterTagged(
-        interp, tclhCtxP, pointer, tag, TCLH_POINTER_NREFS_MAX);
+        interp, registryP, pointer, tag, TCLH_POINTER_NREFS_MAX);
+}
+
+Tclh_ReturnCode
+Tclh_PointerInvalidateBatch(Tcl_Interp *interp,
+                            Tclh_LibContext *tclhCtxP,
+                            Tcl_Size nPointers,
+                            void *const pointers[],
+                            Tclh_PointerTypeTag tag)
+{
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+
+    Tcl_Size i;
+    for (i = 0; i < nPointers; ++i) {
+        Tclh_ReturnCode ret = PointerVerifyOrUnregisterTagged(
+            interp, registryP, pointers[i], tag, TCLH_POINTER_NREFS_MAX);
+        if (ret != TCL_OK)
+            return ret;
+    }
+    return TCL_OK;
 }
 
 Tcl_Obj *
@@ -759,12 +1184,9 @@ Tclh_PointerEnumerate(Tcl_Interp *interp,
             return Tcl_NewObj();
     }
 
-    Tcl_HashEntry *he;
-    Tcl_HashSearch hSearch;
-    Tcl_HashTable *hTblPtr;
     Tcl_Obj *resultObj = Tcl_NewListObj(0, NULL);
 
-    /* 
+    /*
      * If tag NULL, match all
      * If tag specified and not "", match the tag
      * If tag is "", match only those without a tag
@@ -779,29 +1201,83 @@ Tclh_PointerEnumerate(Tcl_Interp *interp,
         if (len == 0)
             tag = NULL;
     }
-    /* Now tag == NULL -> only match records without a tag */
-    hTblPtr   = &registryP->pointers;
-    for (he = Tcl_FirstHashEntry(hTblPtr, &hSearch);
-         he != NULL; he = Tcl_NextHashEntry(&hSearch)) {
-        void *pv                   = Tcl_GetHashKey(hTblPtr, he);
-        TclhPointerRecord *ptrRecP = Tcl_GetHashValue(he);
-        if (getAll || (tag == ptrRecP->tagObj)
-            || (tag != NULL
-                && PointerTypeMatchesExpected(ptrRecP->tagObj, tag))) {
+    if (getAll) {
+        TclhPointerTableSlot *slotP = registryP->pointers.slotsP;
+        TclhPointerTableSlot *endP  = slotP + registryP->pointers.numSlots;
+        for (; slotP < endP; ++slotP) {
+            if (slotP->key == NULL)
+                continue;
+            Tcl_ListObjAppendElement(
+                NULL,
+                resultObj,
+                Tclh_PointerWrap((void *)slotP->key, slotP->recP->tagObj));
+        }
+    } else {
+        /* Walk just the members of the tag, not the whole registry */
+        TclhPointerRecord *ptrRecP = tag ? TclhPointerTagRecords(registryP, tag)
+                                         : registryP->untaggedRecordsP;
+        for (; ptrRecP; ptrRecP = ptrRecP->tagNextP) {
             Tcl_ListObjAppendElement(
-                NULL, resultObj, Tclh_PointerWrap(pv, ptrRecP->tagObj));
+                NULL,
+                resultObj,
+                Tclh_PointerWrap((void *)ptrRecP->pv, ptrRecP->tagObj));
         }
     }
     return resultObj;
 }
 
+Tclh_ReturnCode
+Tclh_PointerInvalidateTag(Tcl_Interp *interp,
+                          Tclh_LibContext *tclhCtxP,
+                          Tclh_PointerTypeTag tag)
+{
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+
+    /* A NULL or empty tag invalidates only the untagged pointers */
+    if (tag) {
+        Tcl_Size len;
+        (void)Tcl_GetStringFromObj(tag, &len);
+        if (len == 0)
+            tag = NULL;
+        else {
+            TclhPointerRecord *ptrRecP = TclhPointerTagRecords(registryP, tag);
+            while (ptrRecP) {
+                TclhPointerRecord *nextP = ptrRecP->tagNextP;
+                TclhPointerTableDelete(&registryP->pointers, ptrRecP->pv);
+                TclhPointerRecordTagUnlink(ptrRecP);
+                TclhPointerRecordFree(ptrRecP);
+                ptrRecP = nextP;
+            }
+            TclhPointerVCacheInvalidate(registryP);
+            return TCL_OK;
+        }
+    }
+    if (tag == NULL) {
+        TclhPointerRecord *ptrRecP = registryP->untaggedRecordsP;
+        while (ptrRecP) {
+            TclhPointerRecord *nextP = ptrRecP->tagNextP;
+            TclhPointerTableDelete(&registryP->pointers, ptrRecP->pv);
+            TclhPointerRecordFree(ptrRecP);
+            ptrRecP = nextP;
+        }
+        registryP->untaggedRecordsP = NULL;
+        TclhPointerVCacheInvalidate(registryP);
+    }
+    return TCL_OK;
+}
+
 Tclh_ReturnCode
 Tclh_PointerVerifyTagged(Tcl_Interp *interp,
                    Tclh_LibContext *tclhCtxP,
                    const void *pointer,
                    Tclh_PointerTypeTag tag)
 {
-    return PointerVerifyOrUnregisterTagged(interp, tclhCtxP, pointer, tag, 0);
+    TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
+    if (registryP == NULL)
+        return TCL_ERROR;
+    return PointerVerifyOrUnregisterTagged(interp, registryP, pointer, tag, 0);
 }
 
 Tclh_ReturnCode
@@ -933,8 +1409,10 @@ Tclh_PointerSubtagDefine(Tcl_Interp *interp,
         return TCL_OK; /* Same tag */
     tclResult = Tclh_HashAdd(
         interp, &registryP->castables, subtag, supertagObj);
-    if (tclResult == TCL_OK)
+    if (tclResult == TCL_OK) {
         Tcl_IncrRefCount(supertagObj);/* Since added to hash table */
+        TclhPointerVCacheInvalidate(registryP);
+    }
     return tclResult;
 }
 
@@ -956,6 +1434,7 @@ Tclh_PointerSubtagRemove(Tcl_Interp *interp,
             if (objP)
                 Tcl_DecrRefCount(objP);
             Tcl_DeleteHashEntry(he);
+            TclhPointerVCacheInvalidate(registryP);
         }
     }
     return TCL_OK;
@@ -1014,10 +1493,9 @@ Tclh_PointerCast(Tcl_Interp *interp,
     /* Validate that if registered, it is registered correctly. */
     TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
     if (registryP) {
-        TclhPointerRecord *ptrRecP = NULL;
-        Tcl_HashEntry *he = Tcl_FindHashEntry(&registryP->pointers, pv);
-        if (he) {
-            ptrRecP = Tcl_GetHashValue(he);
+        TclhPointerRecord *ptrRecP =
+            TclhPointerTableFind(&registryP->pointers, pv);
+        if (ptrRecP) {
             if (!PointerTypeCompatible(registryP, oldTag, ptrRecP->tagObj)
                 && !PointerTypeCompatible(registryP, ptrRecP->tagObj, oldTag)) {
                 return PointerTypeMismatchError(interp, oldTag, ptrRecP->tagObj);
@@ -1035,8 +1513,11 @@ Tclh_PointerCast(Tcl_Interp *interp,
             ptrRecP->tagObj = newTag;
             if (newTag)
                 Tcl_IncrRefCount(newTag);
+            TclhPointerRecordTagUnlink(ptrRecP);
+            TclhPointerRecordTagLink(registryP, ptrRecP);
             if (tempTag)
                 Tcl_DecrRefCount(tempTag); /* AFTER incr-ing newTag */
+            TclhPointerVCacheInvalidate(registryP);
         }
     }
 
@@ -1111,14 +1592,13 @@ PointerRegistrationStatus(TclhPointerRegistry *registryP,
                           void *pv,
                           Tclh_PointerTypeTag tag)
 {
-    Tcl_HashEntry *he;
+    TclhPointerRecord *ptrRecP;
 
-    he = Tcl_FindHashEntry(&registryP->pointers, pv);
-    if (he == NULL) {
+    ptrRecP = TclhPointerTableFind(&registryP->pointers, pv);
+    if (ptrRecP == NULL) {
         return TCLH_POINTER_REGISTRATION_MISSING;
     }
     else {
-        TclhPointerRecord *ptrRecP = Tcl_GetHashValue(he);
         switch (PointerTagCompare(registryP, tag, ptrRecP->tagObj)) {
         case TCLH_TAG_RELATION_EQUAL:
             return TCLH_POINTER_REGISTRATION_OK;
@@ -1138,9 +1618,7 @@ Tclh_PointerRegistered(Tcl_Interp *interp, Tclh_LibContext *tclhCtxP, const void
     TclhPointerRegistry *registryP = TclhPointerGetRegistry(interp, tclhCtxP);
     if (registryP == NULL)
         return 0;
-    Tcl_HashEntry *he;
-    he = Tcl_FindHashEntry(&registryP->pointers, pv);
-    return he != NULL;
+    return TclhPointerTableFind(&registryP->pointers, pv) != NULL;
 }
 
 Tclh_ReturnCode
@@ -1220,16 +1698,15 @@ Tclh_PointerObjInfo(Tcl_Interp *interp,
 
     pv = PointerValueGet(ptrObj);
 
-    Tcl_HashEntry *he;
+    TclhPointerRecord *ptrRecP;
 
     infoObjs[2] = Tcl_NewStringObj("Registration", 12);
-    he = Tcl_FindHashEntry(&registryP->pointers, pv);
-    if (he == NULL) {
+    ptrRecP = TclhPointerTableFind(&registryP->pointers, pv);
+    if (ptrRecP == NULL) {
         infoObjs[3] = Tcl_NewStringObj("none", 4);
         nInfoObjs   = 4;
     }
     else {
-        TclhPointerRecord *ptrRecP = Tcl_GetHashValue(he);
         if (ptrRecP->nRefs < 0)
             infoObjs[3] = Tcl_NewStringObj("safe", 4);
         else if (ptrRecP->nRefs == TCLH_POINTER_NREFS_MAX)
@@ -1255,4 +1732,333 @@ Tclh_PointerObjInfo(Tcl_Interp *interp,
     }
 
     return Tcl_NewListObj(nInfoObjs, infoObjs);
-}
\ No newline at end of file
+}
+
+/*
+ * Shared pointer registry implementation.
+ *
+ * One process-wide registry independent of the per-interp registries
+ * above. Writers serialize on a mutex and bracket their mutations with
+ * increments of a sequence counter (odd while a mutation is in
+ * progress). Readers probe the table without any lock and accept a
+ * result only if the sequence was even and unchanged across the probe,
+ * retrying otherwise.
+ *
+ * For the unlocked probes to be safe the memory a reader may touch must
+ * never be returned to the allocator while the registry lives:
+ * - Tag strings are interned via Tclh_AtomInternShared and are
+ *   immortal by design.
+ * - Records displaced by unregistration are kept on a free list for
+ *   reuse rather than freed. A reader that catches a recycled record
+ *   sees the sequence change and retries.
+ * - Slot arrays displaced by a resize are retired on a list rather
+ *   than freed. Their total is bounded by twice the largest table size.
+ */
+typedef struct TclhSharedPointerRecord {
+    const char *tagP; /* Interned tag string. NULL if untagged */
+    struct TclhSharedPointerRecord *nextFreeP; /* Link on the free list */
+    int nRefs;        /* Number of references to the pointer */
+} TclhSharedPointerRecord;
+
+typedef struct TclhSharedRetiredSlots {
+    struct TclhSharedRetiredSlots *nextP;
+    TclhPointerTableSlot *slotsP;
+} TclhSharedRetiredSlots;
+
+TCL_DECLARE_MUTEX(gSharedPointerMutex)
+static struct TclhSharedPointerRegistry {
+    TclhPointerTable pointers; /* Slot recP fields actually hold
+                                  TclhSharedPointerRecord pointers */
+    volatile unsigned long seq; /* Odd while a writer is mutating */
+    TclhSharedPointerRecord *freeRecordsP;
+    TclhSharedRetiredSlots *retiredSlotsP;
+} gSharedPointers;
+
+#if defined(_MSC_VER)
+#define TclhSharedPointerFence() MemoryBarrier()
+#else
+#define TclhSharedPointerFence() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+static void
+TclhSharedPointerWriteBegin(void)
+{
+    Tcl_MutexLock(&gSharedPointerMutex);
+    gSharedPointers.seq += 1;
+    TclhSharedPointerFence(); /* Order the bump before the mutations */
+}
+
+static void
+TclhSharedPointerWriteEnd(void)
+{
+    TclhSharedPointerFence(); /* Order the mutations before the bump */
+    gSharedPointers.seq += 1;
+    Tcl_MutexUnlock(&gSharedPointerMutex);
+}
+
+/* Like TclhPointerTableResize but retires the old slot array */
+static void
+TclhSharedPointerTableResize(size_t numSlots)
+{
+    TclhPointerTable *tableP   = &gSharedPointers.pointers;
+    TclhPointerTableSlot *oldSlotsP = tableP->slotsP;
+    size_t oldNumSlots              = tableP->numSlots;
+    size_t mask                     = numSlots - 1;
+    size_t i;
+
+    tableP->slotsP =
+        (TclhPointerTableSlot *)Tcl_Alloc(numSlots * sizeof(*tableP->slotsP));
+    memset(tableP->slotsP, 0, numSlots * sizeof(*tableP->slotsP));
+    tableP->numSlots = numSlots;
+    for (i = 0; i < oldNumSlots; ++i) {
+        size_t j;
+        if (oldSlotsP[i].key == NULL)
+            continue;
+        j = TclhPointerHashIndex(oldSlotsP[i].key, mask);
+        while (tableP->slotsP[j].key)
+            j = (j + 1) & mask;
+        tableP->slotsP[j] = oldSlotsP[i];
+    }
+    if (oldSlotsP) {
+        TclhSharedRetiredSlots *retiredP =
+            (TclhSharedRetiredSlots *)Tcl_Alloc(sizeof(*retiredP));
+        retiredP->slotsP = oldSlotsP;
+        retiredP->nextP  = gSharedPointers.retiredSlotsP;
+        gSharedPointers.retiredSlotsP = retiredP;
+    }
+}
+
+/* Caller must hold the write lock */
+static TclhPointerRecord **
+TclhSharedPointerTableAdd(const void *pointer, int *newEntryP)
+{
+    TclhPointerTable *tableP = &gSharedPointers.pointers;
+
+    if (tableP->numSlots == 0)
+        TclhSharedPointerTableResize(TCLH_POINTER_TABLE_MIN_SLOTS);
+    else if (3 * (tableP->numEntries + 1) > 2 * tableP->numSlots)
+        TclhSharedPointerTableResize(2 * tableP->numSlots);
+    return TclhPointerTableAdd(tableP, pointer, newEntryP);
+}
+
+/*
+ * Interns the tag of a registration request. NULL and empty tags both
+ * map to an untagged registration.
+ */
+static const char *
+TclhSharedPointerTagIntern(Tclh_PointerTypeTag tagObj)
+{
+    Tcl_Size len;
+    const char *s;
+
+    if (tagObj == NULL)
+        return NULL;
+    s = Tcl_GetStringFromObj(tagObj, &len);
+    if (len == 0)
+        return NULL;
+    return Tclh_AtomInternShared(s);
+}
+
+/*
+ * Lock-free look up of a pointer. Returns 1 and stores the registered
+ * tag (NULL if untagged) if the pointer is found, else returns 0.
+ */
+static int
+TclhSharedPointerFind(const void *pointer, const char **tagPP)
+{
+    unsigned long s0, s1;
+    const char *tagP;
+    int found;
+
+    for (;;) {
+        s0 = gSharedPointers.seq;
+        TclhSharedPointerFence();
+        TclhPointerTableSlot *slotsP = gSharedPointers.pointers.slotsP;
+        size_t numSlots              = gSharedPointers.pointers.numSlots;
+        /*
+         * Re-check the sequence before probing so slotsP and numSlots
+         * are known to be a consistent pair. A resize publishes the new
+         * array and the new size as separate stores; pairing the old
+         * array with the new, larger size would probe past the end of
+         * the old allocation and dereference garbage record pointers.
+         */
+        TclhSharedPointerFence();
+        if ((s0 & 1) || gSharedPointers.seq != s0)
+            continue;
+        found = 0;
+        tagP  = NULL;
+        if (slotsP != NULL) {
+            size_t mask   = numSlots - 1;
+            size_t i      = TclhPointerHashIndex(pointer, mask);
+            size_t probes = 0;
+            /* Bound probes; a torn snapshot must not loop forever */
+            while (probes++ < numSlots) {
+                const void *key = slotsP[i].key;
+                if (key == NULL)
+                    break;
+                if (key == pointer) {
+                    TclhSharedPointerRecord *recP =
+                        (TclhSharedPointerRecord *)(void *)slotsP[i].recP;
+                    if (recP) {
+                        found = 1;
+                        tagP  = recP->tagP;
+                    }
+                    break;
+                }
+                i = (i + 1) & mask;
+            }
+        }
+        TclhSharedPointerFence();
+        s1 = gSharedPointers.seq;
+        if (s1 == s0)
+            break;
+    }
+    if (tagPP)
+        *tagPP = tagP;
+    return found;
+}
+
+static Tclh_ReturnCode
+TclhSharedPointerTagMismatchError(Tcl_Interp *interp,
+                                  Tclh_PointerTypeTag tagObj,
+                                  const char *registeredTagP)
+{
+    Tcl_Obj *registeredTagObj =
+        registeredTagP ? Tcl_NewStringObj(registeredTagP, -1) : NULL;
+    return PointerTypeMismatchError(interp, tagObj, registeredTagObj);
+}
+
+Tclh_ReturnCode
+Tclh_SharedPointerRegister(Tcl_Interp *interp,
+                           void *pointer,
+                           Tclh_PointerTypeTag tag,
+                           Tcl_Obj **objPP)
+{
+    const char *tagP;
+    const char *registeredTagP = NULL;
+    int mismatch = 0;
+
+    if (pointer == NULL)
+        return Tclh_ErrorPointerNull(interp);
+    tagP = TclhSharedPointerTagIntern(tag);
+
+    TclhSharedPointerWriteBegin();
+    TclhPointerRecord **recPP;
+    TclhSharedPointerRecord *recP;
+    int newEntry;
+    recPP = TclhSharedPointerTableAdd(pointer, &newEntry);
+    if (newEntry) {
+        recP = gSharedPointers.freeRecordsP;
+        if (recP)
+            gSharedPointers.freeRecordsP = recP->nextFreeP;
+        else
+            recP = (TclhSharedPointerRecord *)Tcl_Alloc(sizeof(*recP));
+        recP->tagP      = tagP;
+        recP->nextFreeP = NULL;
+        recP->nRefs     = 1;
+        *recPP = (TclhPointerRecord *)(void *)recP;
+    } else {
+        recP = (TclhSharedPointerRecord *)(void *)*recPP;
+        if (recP->tagP == tagP)
+            recP->nRefs += 1;
+        else {
+            mismatch       = 1;
+            registeredTagP = recP->tagP;
+        }
+    }
+    TclhSharedPointerWriteEnd();
+
+    if (mismatch)
+        return TclhSharedPointerTagMismatchError(interp, tag, registeredTagP);
+    if (objPP)
+        *objPP = Tclh_PointerWrap(pointer, tag);
+    return TCL_OK;
+}
+
+/* Common unregister/invalidate. unrefCount semantics as for the
+ * per-interp PointerVerifyOrUnregisterTagged. */
+static Tclh_ReturnCode
+TclhSharedPointerRemove(Tcl_Interp *interp,
+                        const void *pointer,
+                        Tclh_PointerTypeTag tag,
+                        int unrefCount)
+{
+    const char *tagP           = TclhSharedPointerTagIntern(tag);
+    const char *registeredTagP = NULL;
+    enum { REMOVE_OK, REMOVE_MISSING, REMOVE_MISMATCH } status = REMOVE_OK;
+
+    TclhSharedPointerWriteBegin();
+    TclhSharedPointerRecord *recP = (TclhSharedPointerRecord *)(void *)
+        TclhPointerTableFind(&gSharedPointers.pointers, pointer);
+    if (recP == NULL)
+        status = REMOVE_MISSING;
+    else if (tagP != NULL && recP->tagP != tagP) {
+        status         = REMOVE_MISMATCH;
+        registeredTagP = recP->tagP;
+    } else if (recP->nRefs <= unrefCount) {
+        TclhPointerTableDelete(&gSharedPointers.pointers, pointer);
+        recP->nextFreeP = gSharedPointers.freeRecordsP;
+        gSharedPointers.freeRecordsP = recP;
+    } else
+        recP->nRefs -= unrefCount;
+    TclhSharedPointerWriteEnd();
+
+    switch (status) {
+    case REMOVE_MISSING:
+        if (unrefCount == TCLH_POINTER_NREFS_MAX)
+            return TCL_OK; /* Invalidate, no error if not registered */
+        return PointerNotRegisteredError(
+            interp, pointer, tag, TCLH_POINTER_REGISTRATION_MISSING);
+    case REMOVE_MISMATCH:
+        return TclhSharedPointerTagMismatchError(interp, tag, registeredTagP);
+    default:
+        return TCL_OK;
+    }
+}
+
+Tclh_ReturnCode
+Tclh_SharedPointerUnregister(Tcl_Interp *interp,
+                             const void *pointer,
+                             Tclh_PointerTypeTag tag)
+{
+    return TclhSharedPointerRemove(interp, pointer, tag, 1);
+}
+
+Tclh_ReturnCode
+Tclh_SharedPointerInvalidate(Tcl_Interp *interp,
+                             const void *pointer,
+                             Tclh_PointerTypeTag tag)
+{
+    return TclhSharedPointerRemove(
+        interp, pointer, tag, TCLH_POINTER_NREFS_MAX);
+}
+
+Tclh_ReturnCode
+Tclh_SharedPointerVerify(Tcl_Interp *interp,
+                         const void *pointer,
+                         Tclh_PointerTypeTag tag)
+{
+    const char *registeredTagP;
+
+    if (pointer == NULL)
+        return Tclh_ErrorPointerNull(interp);
+    if (!TclhSharedPointerFind(pointer, &registeredTagP))
+        return PointerNotRegisteredError(
+            interp, pointer, tag, TCLH_POINTER_REGISTRATION_MISSING);
+    if (tag != NULL) {
+        /* Compare by value, not interning, to stay off the atom lock */
+        Tcl_Size len;
+        const char *s = Tcl_GetStringFromObj(tag, &len);
+        if (len != 0
+            && (registeredTagP == NULL || strcmp(s, registeredTagP) != 0))
+            return TclhSharedPointerTagMismatchError(
+                interp, tag, registeredTagP);
+    }
+    return TCL_OK;
+}
+
+int
+Tclh_SharedPointerRegistered(const void *pointer)
+{
+    return TclhSharedPointerFind(pointer, NULL);
+}
@@ -30,6 +30,28 @@
  */
 Tcl_Obj *Tclh_UuidNewObj ();
 
+/* Function: Tclh_UuidNewObjs
+ * Generates a batch of new UUIDs. The UUIDs are not guaranteed to be
+ * cryptographically secure.
+ *
+ * Parameters:
+ * interp - interpreter for error messages. May be NULL.
+ * count  - number of UUIDs to generate.
+ * objv   - array of *count* locations to store the generated Tcl_Obj
+ *          wrappers.
+ *
+ * Amortizes the cost of the system entropy source over the batch by
+ * pulling a single block of randomness and stamping the version and
+ * variant bits on each UUID, rather than making one generator trip per
+ * UUID as <Tclh_UuidNewObj> does.
+ *
+ * Returns:
+ * TCL_OK    - Success, *count* wrapped UUIDs stored in *objv*.
+ * TCL_ERROR - Failure, error message stored in interp.
+ */
+Tclh_ReturnCode
+Tclh_UuidNewObjs(Tcl_Interp *interp, Tcl_Size count, Tcl_Obj **objv);
+
 /* Function: Tclh_UuidWrap
  * Wraps a Tclh_UUID as a Tcl_Obj.
  *
@@ -79,6 +101,7 @@ Tclh_Bool Tclh_UuidIsObjIntrep (Tcl_Obj *objP);
 
 #ifdef TCLH_SHORTNAMES
 #define UuidNewObj Tclh_UuidNewObj
+#define UuidNewObjs Tclh_UuidNewObjs
 #define UuidWrap   Tclh_UuidWrap
 #define UuidUnwrap Tclh_UuidUnwrap
 #define UuidIsObjIntrep tclh_UuidIsObjIntrep
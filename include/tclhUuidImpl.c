@@ -48,24 +48,49 @@ static void FreeUuidObj(Tcl_Obj *objP)
     IntrepSetUuid(objP, NULL);
 }
 
-static void StringFromUuidObj(Tcl_Obj *objP)
+/*
+ * Formats a UUID into the standard 36 character lowercase form plus a
+ * terminating nul. A pair lookup table converts a byte to both its hex
+ * digits in one load, avoiding per-nibble shifts and branches. On Windows
+ * the first three fields are stored native endian and must be emitted
+ * byte reversed; elsewhere uuid_t is already in string byte order.
+ */
+static void TclhUuidFormat(const Tclh_UUID *uuidP, char *bufP)
 {
+    static const char hexPairs[] =
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+        "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+        "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+        "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+        "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+        "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+        "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+        "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+    static const unsigned char byteOrder[16] =
 #ifdef _WIN32
-    UUID *uuidP = IntrepGetUuid(objP);
-    unsigned char *uuidStr;
-    Tcl_Size  len;
-    if (UuidToStringA(uuidP, &uuidStr) != RPC_S_OK) {
-        TCLH_PANIC("Out of memory stringifying UUID.");
-    }
-    len          = Tclh_strlen((char *)uuidStr);
-    objP->bytes  = Tclh_strdupn((char *)uuidStr, len);
-    objP->length = len;
-    RpcStringFreeA(&uuidStr);
+        {3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15};
 #else
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+#endif
+    const unsigned char *bytes = (const unsigned char *)uuidP;
+    int i, pos;
+
+    for (i = 0, pos = 0; i < 16; ++i) {
+        const char *pairP = &hexPairs[2 * bytes[byteOrder[i]]];
+        bufP[pos]     = pairP[0];
+        bufP[pos + 1] = pairP[1];
+        pos += 2;
+        if (i == 3 || i == 5 || i == 7 || i == 9)
+            bufP[pos++] = '-';
+    }
+    bufP[36] = '\0';
+}
+
+static void StringFromUuidObj(Tcl_Obj *objP)
+{
     objP->bytes = ckalloc(37); /* Number of bytes for string rep */
     objP->length = 36;         /* Not counting terminating \0 */
-    uuid_unparse_lower(IntrepGetUuid(objP)->bytes, objP->bytes);
-#endif
+    TclhUuidFormat(IntrepGetUuid(objP), objP->bytes);
 }
 
 static int  SetUuidObjFromAny(Tcl_Obj *objP)
@@ -147,4 +172,53 @@ Tcl_Obj *Tclh_UuidNewObj (Tcl_Interp *ip)
     IntrepSetUuid(objP, uuidP);
     objP->typePtr = &gUuidVtbl;
     return objP;
+}
+
+#ifndef _WIN32
+/* Fills bufP with system entropy. Returns 0 on success, -1 on failure */
+static int TclhUuidRandomBytes(unsigned char *bufP, size_t nbytes)
+{
+    FILE *fP = fopen("/dev/urandom", "rb");
+    size_t nread;
+
+    if (fP == NULL)
+        return -1;
+    nread = fread(bufP, 1, nbytes, fP);
+    fclose(fP);
+    return nread == nbytes ? 0 : -1;
+}
+#endif /* _WIN32 */
+
+Tclh_ReturnCode
+Tclh_UuidNewObjs(Tcl_Interp *interp, Tcl_Size count, Tcl_Obj **objv)
+{
+    Tcl_Size i;
+
+    if (count <= 0)
+        return TCL_OK;
+#ifdef _WIN32
+    /* UuidCreate does not pay a generator round trip per call. Just loop */
+    for (i = 0; i < count; ++i)
+        objv[i] = Tclh_UuidNewObj(interp);
+#else
+    if (count > (Tcl_Size)(TCL_SIZE_MAX / sizeof(Tclh_UUID)))
+        return Tclh_ErrorAllocation(interp, "UUID batch", NULL);
+    unsigned char *blockP = (unsigned char *)ckalloc(count * sizeof(Tclh_UUID));
+    if (TclhUuidRandomBytes(blockP, count * sizeof(Tclh_UUID)) != 0) {
+        /* No usable entropy device. Generate one at a time as before */
+        ckfree(blockP);
+        for (i = 0; i < count; ++i)
+            objv[i] = Tclh_UuidNewObj(interp);
+        return TCL_OK;
+    }
+    for (i = 0; i < count; ++i) {
+        unsigned char *bytes = blockP + i * sizeof(Tclh_UUID);
+        /* Stamp as a version 4 (random) UUID, RFC 4122 variant */
+        bytes[6] = (bytes[6] & 0x0f) | 0x40;
+        bytes[8] = (bytes[8] & 0x3f) | 0x80;
+        objv[i] = Tclh_UuidWrap((const Tclh_UUID *)bytes);
+    }
+    ckfree(blockP);
+#endif /* _WIN32 */
+    return TCL_OK;
 }
\ No newline at end of file
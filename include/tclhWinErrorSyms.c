@@ -8,3202 +8,7085 @@
 #ifndef WINERRORSYMS_C
 #define WINERRORSYMS_C
 
+/*
+ * Win32 error code to symbol mapping. The codes are kept sorted for binary
+ * search, with a parallel array of offsets into a single contiguous string
+ * blob holding the nul-terminated symbol names - no per-entry pointers to
+ * relocate at load and good locality during lookup bursts. A third array
+ * lists entry indices in symbol name order for the reverse lookup. All
+ * three are derived from the same entry list; keep the codes sorted when
+ * adding entries.
+ */
+
+static const DWORD gWinErrorCodes[] = {
+    0, /* ERROR_SUCCESS */
+    1, /* ERROR_INVALID_FUNCTION */
+    2, /* ERROR_FILE_NOT_FOUND */
+    3, /* ERROR_PATH_NOT_FOUND */
+    4, /* ERROR_TOO_MANY_OPEN_FILES */
+    5, /* ERROR_ACCESS_DENIED */
+    6, /* ERROR_INVALID_HANDLE */
+    7, /* ERROR_ARENA_TRASHED */
+    8, /* ERROR_NOT_ENOUGH_MEMORY */
+    9, /* ERROR_INVALID_BLOCK */
+    10, /* ERROR_BAD_ENVIRONMENT */
+    11, /* ERROR_BAD_FORMAT */
+    12, /* ERROR_INVALID_ACCESS */
+    13, /* ERROR_INVALID_DATA */
+    14, /* ERROR_OUTOFMEMORY */
+    15, /* ERROR_INVALID_DRIVE */
+    16, /* ERROR_CURRENT_DIRECTORY */
+    17, /* ERROR_NOT_SAME_DEVICE */
+    18, /* ERROR_NO_MORE_FILES */
+    19, /* ERROR_WRITE_PROTECT */
+    20, /* ERROR_BAD_UNIT */
+    21, /* ERROR_NOT_READY */
+    22, /* ERROR_BAD_COMMAND */
+    23, /* ERROR_CRC */
+    24, /* ERROR_BAD_LENGTH */
+    25, /* ERROR_SEEK */
+    26, /* ERROR_NOT_DOS_DISK */
+    27, /* ERROR_SECTOR_NOT_FOUND */
+    28, /* ERROR_OUT_OF_PAPER */
+    29, /* ERROR_WRITE_FAULT */
+    30, /* ERROR_READ_FAULT */
+    31, /* ERROR_GEN_FAILURE */
+    32, /* ERROR_SHARING_VIOLATION */
+    33, /* ERROR_LOCK_VIOLATION */
+    34, /* ERROR_WRONG_DISK */
+    36, /* ERROR_SHARING_BUFFER_EXCEEDED */
+    38, /* ERROR_HANDLE_EOF */
+    39, /* ERROR_HANDLE_DISK_FULL */
+    50, /* ERROR_NOT_SUPPORTED */
+    51, /* ERROR_REM_NOT_LIST */
+    52, /* ERROR_DUP_NAME */
+    53, /* ERROR_BAD_NETPATH */
+    54, /* ERROR_NETWORK_BUSY */
+    55, /* ERROR_DEV_NOT_EXIST */
+    56, /* ERROR_TOO_MANY_CMDS */
+    57, /* ERROR_ADAP_HDW_ERR */
+    58, /* ERROR_BAD_NET_RESP */
+    59, /* ERROR_UNEXP_NET_ERR */
+    60, /* ERROR_BAD_REM_ADAP */
+    61, /* ERROR_PRINTQ_FULL */
+    62, /* ERROR_NO_SPOOL_SPACE */
+    63, /* ERROR_PRINT_CANCELLED */
+    64, /* ERROR_NETNAME_DELETED */
+    65, /* ERROR_NETWORK_ACCESS_DENIED */
+    66, /* ERROR_BAD_DEV_TYPE */
+    67, /* ERROR_BAD_NET_NAME */
+    68, /* ERROR_TOO_MANY_NAMES */
+    69, /* ERROR_TOO_MANY_SESS */
+    70, /* ERROR_SHARING_PAUSED */
+    71, /* ERROR_REQ_NOT_ACCEP */
+    72, /* ERROR_REDIR_PAUSED */
+    80, /* ERROR_FILE_EXISTS */
+    82, /* ERROR_CANNOT_MAKE */
+    83, /* ERROR_FAIL_I24 */
+    84, /* ERROR_OUT_OF_STRUCTURES */
+    85, /* ERROR_ALREADY_ASSIGNED */
+    86, /* ERROR_INVALID_PASSWORD */
+    87, /* ERROR_INVALID_PARAMETER */
+    88, /* ERROR_NET_WRITE_FAULT */
+    89, /* ERROR_NO_PROC_SLOTS */
+    100, /* ERROR_TOO_MANY_SEMAPHORES */
+    101, /* ERROR_EXCL_SEM_ALREADY_OWNED */
+    102, /* ERROR_SEM_IS_SET */
+    103, /* ERROR_TOO_MANY_SEM_REQUESTS */
+    104, /* ERROR_INVALID_AT_INTERRUPT_TIME */
+    105, /* ERROR_SEM_OWNER_DIED */
+    106, /* ERROR_SEM_USER_LIMIT */
+    107, /* ERROR_DISK_CHANGE */
+    108, /* ERROR_DRIVE_LOCKED */
+    109, /* ERROR_BROKEN_PIPE */
+    110, /* ERROR_OPEN_FAILED */
+    111, /* ERROR_BUFFER_OVERFLOW */
+    112, /* ERROR_DISK_FULL */
+    113, /* ERROR_NO_MORE_SEARCH_HANDLES */
+    114, /* ERROR_INVALID_TARGET_HANDLE */
+    117, /* ERROR_INVALID_CATEGORY */
+    118, /* ERROR_INVALID_VERIFY_SWITCH */
+    119, /* ERROR_BAD_DRIVER_LEVEL */
+    120, /* ERROR_CALL_NOT_IMPLEMENTED */
+    121, /* ERROR_SEM_TIMEOUT */
+    122, /* ERROR_INSUFFICIENT_BUFFER */
+    123, /* ERROR_INVALID_NAME */
+    124, /* ERROR_INVALID_LEVEL */
+    125, /* ERROR_NO_VOLUME_LABEL */
+    126, /* ERROR_MOD_NOT_FOUND */
+    127, /* ERROR_PROC_NOT_FOUND */
+    128, /* ERROR_WAIT_NO_CHILDREN */
+    129, /* ERROR_CHILD_NOT_COMPLETE */
+    130, /* ERROR_DIRECT_ACCESS_HANDLE */
+    131, /* ERROR_NEGATIVE_SEEK */
+    132, /* ERROR_SEEK_ON_DEVICE */
+    133, /* ERROR_IS_JOIN_TARGET */
+    134, /* ERROR_IS_JOINED */
+    135, /* ERROR_IS_SUBSTED */
+    136, /* ERROR_NOT_JOINED */
+    137, /* ERROR_NOT_SUBSTED */
+    138, /* ERROR_JOIN_TO_JOIN */
+    139, /* ERROR_SUBST_TO_SUBST */
+    140, /* ERROR_JOIN_TO_SUBST */
+    141, /* ERROR_SUBST_TO_JOIN */
+    142, /* ERROR_BUSY_DRIVE */
+    143, /* ERROR_SAME_DRIVE */
+    144, /* ERROR_DIR_NOT_ROOT */
+    145, /* ERROR_DIR_NOT_EMPTY */
+    146, /* ERROR_IS_SUBST_PATH */
+    147, /* ERROR_IS_JOIN_PATH */
+    148, /* ERROR_PATH_BUSY */
+    149, /* ERROR_IS_SUBST_TARGET */
+    150, /* ERROR_SYSTEM_TRACE */
+    151, /* ERROR_INVALID_EVENT_COUNT */
+    152, /* ERROR_TOO_MANY_MUXWAITERS */
+    153, /* ERROR_INVALID_LIST_FORMAT */
+    154, /* ERROR_LABEL_TOO_LONG */
+    155, /* ERROR_TOO_MANY_TCBS */
+    156, /* ERROR_SIGNAL_REFUSED */
+    157, /* ERROR_DISCARDED */
+    158, /* ERROR_NOT_LOCKED */
+    159, /* ERROR_BAD_THREADID_ADDR */
+    160, /* ERROR_BAD_ARGUMENTS */
+    161, /* ERROR_BAD_PATHNAME */
+    162, /* ERROR_SIGNAL_PENDING */
+    164, /* ERROR_MAX_THRDS_REACHED */
+    167, /* ERROR_LOCK_FAILED */
+    170, /* ERROR_BUSY */
+    171, /* ERROR_DEVICE_SUPPORT_IN_PROGRESS */
+    173, /* ERROR_CANCEL_VIOLATION */
+    174, /* ERROR_ATOMIC_LOCKS_NOT_SUPPORTED */
+    180, /* ERROR_INVALID_SEGMENT_NUMBER */
+    182, /* ERROR_INVALID_ORDINAL */
+    183, /* ERROR_ALREADY_EXISTS */
+    186, /* ERROR_INVALID_FLAG_NUMBER */
+    187, /* ERROR_SEM_NOT_FOUND */
+    188, /* ERROR_INVALID_STARTING_CODESEG */
+    189, /* ERROR_INVALID_STACKSEG */
+    190, /* ERROR_INVALID_MODULETYPE */
+    191, /* ERROR_INVALID_EXE_SIGNATURE */
+    192, /* ERROR_EXE_MARKED_INVALID */
+    193, /* ERROR_BAD_EXE_FORMAT */
+    194, /* ERROR_ITERATED_DATA_EXCEEDS_64k */
+    195, /* ERROR_INVALID_MINALLOCSIZE */
+    196, /* ERROR_DYNLINK_FROM_INVALID_RING */
+    197, /* ERROR_IOPL_NOT_ENABLED */
+    198, /* ERROR_INVALID_SEGDPL */
+    199, /* ERROR_AUTODATASEG_EXCEEDS_64k */
+    200, /* ERROR_RING2SEG_MUST_BE_MOVABLE */
+    201, /* ERROR_RELOC_CHAIN_XEEDS_SEGLIM */
+    202, /* ERROR_INFLOOP_IN_RELOC_CHAIN */
+    203, /* ERROR_ENVVAR_NOT_FOUND */
+    205, /* ERROR_NO_SIGNAL_SENT */
+    206, /* ERROR_FILENAME_EXCED_RANGE */
+    207, /* ERROR_RING2_STACK_IN_USE */
+    208, /* ERROR_META_EXPANSION_TOO_LONG */
+    209, /* ERROR_INVALID_SIGNAL_NUMBER */
+    210, /* ERROR_THREAD_1_INACTIVE */
+    212, /* ERROR_LOCKED */
+    214, /* ERROR_TOO_MANY_MODULES */
+    215, /* ERROR_NESTING_NOT_ALLOWED */
+    216, /* ERROR_EXE_MACHINE_TYPE_MISMATCH */
+    217, /* ERROR_EXE_CANNOT_MODIFY_SIGNED_BINARY */
+    218, /* ERROR_EXE_CANNOT_MODIFY_STRONG_SIGNED_BINARY */
+    220, /* ERROR_FILE_CHECKED_OUT */
+    221, /* ERROR_CHECKOUT_REQUIRED */
+    222, /* ERROR_BAD_FILE_TYPE */
+    223, /* ERROR_FILE_TOO_LARGE */
+    224, /* ERROR_FORMS_AUTH_REQUIRED */
+    225, /* ERROR_VIRUS_INFECTED */
+    226, /* ERROR_VIRUS_DELETED */
+    229, /* ERROR_PIPE_LOCAL */
+    230, /* ERROR_BAD_PIPE */
+    231, /* ERROR_PIPE_BUSY */
+    232, /* ERROR_NO_DATA */
+    233, /* ERROR_PIPE_NOT_CONNECTED */
+    234, /* ERROR_MORE_DATA */
+    235, /* ERROR_NO_WORK_DONE */
+    240, /* ERROR_VC_DISCONNECTED */
+    254, /* ERROR_INVALID_EA_NAME */
+    255, /* ERROR_EA_LIST_INCONSISTENT */
+    258, /* WAIT_TIMEOUT */
+    259, /* ERROR_NO_MORE_ITEMS */
+    266, /* ERROR_CANNOT_COPY */
+    267, /* ERROR_DIRECTORY */
+    275, /* ERROR_EAS_DIDNT_FIT */
+    276, /* ERROR_EA_FILE_CORRUPT */
+    277, /* ERROR_EA_TABLE_FULL */
+    278, /* ERROR_INVALID_EA_HANDLE */
+    282, /* ERROR_EAS_NOT_SUPPORTED */
+    288, /* ERROR_NOT_OWNER */
+    298, /* ERROR_TOO_MANY_POSTS */
+    299, /* ERROR_PARTIAL_COPY */
+    300, /* ERROR_OPLOCK_NOT_GRANTED */
+    301, /* ERROR_INVALID_OPLOCK_PROTOCOL */
+    302, /* ERROR_DISK_TOO_FRAGMENTED */
+    303, /* ERROR_DELETE_PENDING */
+    304, /* ERROR_INCOMPATIBLE_WITH_GLOBAL_SHORT_NAME_REGISTRY_SETTING */
+    305, /* ERROR_SHORT_NAMES_NOT_ENABLED_ON_VOLUME */
+    306, /* ERROR_SECURITY_STREAM_IS_INCONSISTENT */
+    307, /* ERROR_INVALID_LOCK_RANGE */
+    308, /* ERROR_IMAGE_SUBSYSTEM_NOT_PRESENT */
+    309, /* ERROR_NOTIFICATION_GUID_ALREADY_DEFINED */
+    310, /* ERROR_INVALID_EXCEPTION_HANDLER */
+    311, /* ERROR_DUPLICATE_PRIVILEGES */
+    312, /* ERROR_NO_RANGES_PROCESSED */
+    313, /* ERROR_NOT_ALLOWED_ON_SYSTEM_FILE */
+    314, /* ERROR_DISK_RESOURCES_EXHAUSTED */
+    315, /* ERROR_INVALID_TOKEN */
+    316, /* ERROR_DEVICE_FEATURE_NOT_SUPPORTED */
+    317, /* ERROR_MR_MID_NOT_FOUND */
+    318, /* ERROR_SCOPE_NOT_FOUND */
+    319, /* ERROR_UNDEFINED_SCOPE */
+    320, /* ERROR_INVALID_CAP */
+    321, /* ERROR_DEVICE_UNREACHABLE */
+    322, /* ERROR_DEVICE_NO_RESOURCES */
+    323, /* ERROR_DATA_CHECKSUM_ERROR */
+    324, /* ERROR_INTERMIXED_KERNEL_EA_OPERATION */
+    326, /* ERROR_FILE_LEVEL_TRIM_NOT_SUPPORTED */
+    327, /* ERROR_OFFSET_ALIGNMENT_VIOLATION */
+    328, /* ERROR_INVALID_FIELD_IN_PARAMETER_LIST */
+    329, /* ERROR_OPERATION_IN_PROGRESS */
+    330, /* ERROR_BAD_DEVICE_PATH */
+    331, /* ERROR_TOO_MANY_DESCRIPTORS */
+    332, /* ERROR_SCRUB_DATA_DISABLED */
+    333, /* ERROR_NOT_REDUNDANT_STORAGE */
+    334, /* ERROR_RESIDENT_FILE_NOT_SUPPORTED */
+    335, /* ERROR_COMPRESSED_FILE_NOT_SUPPORTED */
+    336, /* ERROR_DIRECTORY_NOT_SUPPORTED */
+    337, /* ERROR_NOT_READ_FROM_COPY */
+    338, /* ERROR_FT_WRITE_FAILURE */
+    339, /* ERROR_FT_DI_SCAN_REQUIRED */
+    340, /* ERROR_INVALID_KERNEL_INFO_VERSION */
+    341, /* ERROR_INVALID_PEP_INFO_VERSION */
+    342, /* ERROR_OBJECT_NOT_EXTERNALLY_BACKED */
+    343, /* ERROR_EXTERNAL_BACKING_PROVIDER_UNKNOWN */
+    344, /* ERROR_COMPRESSION_NOT_BENEFICIAL */
+    345, /* ERROR_STORAGE_TOPOLOGY_ID_MISMATCH */
+    346, /* ERROR_BLOCKED_BY_PARENTAL_CONTROLS */
+    347, /* ERROR_BLOCK_TOO_MANY_REFERENCES */
+    348, /* ERROR_MARKED_TO_DISALLOW_WRITES */
+    349, /* ERROR_ENCLAVE_FAILURE */
+    350, /* ERROR_FAIL_NOACTION_REBOOT */
+    351, /* ERROR_FAIL_SHUTDOWN */
+    352, /* ERROR_FAIL_RESTART */
+    353, /* ERROR_MAX_SESSIONS_REACHED */
+    354, /* ERROR_NETWORK_ACCESS_DENIED_EDP */
+    355, /* ERROR_DEVICE_HINT_NAME_BUFFER_TOO_SMALL */
+    356, /* ERROR_EDP_POLICY_DENIES_OPERATION */
+    357, /* ERROR_EDP_DPL_POLICY_CANT_BE_SATISFIED */
+    358, /* ERROR_CLOUD_FILE_SYNC_ROOT_METADATA_CORRUPT */
+    359, /* ERROR_DEVICE_IN_MAINTENANCE */
+    360, /* ERROR_NOT_SUPPORTED_ON_DAX */
+    361, /* ERROR_DAX_MAPPING_EXISTS */
+    362, /* ERROR_CLOUD_FILE_PROVIDER_NOT_RUNNING */
+    363, /* ERROR_CLOUD_FILE_METADATA_CORRUPT */
+    364, /* ERROR_CLOUD_FILE_METADATA_TOO_LARGE */
+    365, /* ERROR_CLOUD_FILE_PROPERTY_BLOB_TOO_LARGE */
+    366, /* ERROR_CLOUD_FILE_PROPERTY_BLOB_CHECKSUM_MISMATCH */
+    367, /* ERROR_CHILD_PROCESS_BLOCKED */
+    368, /* ERROR_STORAGE_LOST_DATA_PERSISTENCE */
+    369, /* ERROR_FILE_SYSTEM_VIRTUALIZATION_UNAVAILABLE */
+    370, /* ERROR_FILE_SYSTEM_VIRTUALIZATION_METADATA_CORRUPT */
+    371, /* ERROR_FILE_SYSTEM_VIRTUALIZATION_BUSY */
+    372, /* ERROR_FILE_SYSTEM_VIRTUALIZATION_PROVIDER_UNKNOWN */
+    373, /* ERROR_GDI_HANDLE_LEAK */
+    374, /* ERROR_CLOUD_FILE_TOO_MANY_PROPERTY_BLOBS */
+    375, /* ERROR_CLOUD_FILE_PROPERTY_VERSION_NOT_SUPPORTED */
+    376, /* ERROR_NOT_A_CLOUD_FILE */
+    377, /* ERROR_CLOUD_FILE_NOT_IN_SYNC */
+    378, /* ERROR_CLOUD_FILE_ALREADY_CONNECTED */
+    379, /* ERROR_CLOUD_FILE_NOT_SUPPORTED */
+    380, /* ERROR_CLOUD_FILE_INVALID_REQUEST */
+    381, /* ERROR_CLOUD_FILE_READ_ONLY_VOLUME */
+    382, /* ERROR_CLOUD_FILE_CONNECTED_PROVIDER_ONLY */
+    383, /* ERROR_CLOUD_FILE_VALIDATION_FAILED */
+    384, /* ERROR_SMB1_NOT_AVAILABLE */
+    385, /* ERROR_FILE_SYSTEM_VIRTUALIZATION_INVALID_OPERATION */
+    386, /* ERROR_CLOUD_FILE_AUTHENTICATION_FAILED */
+    387, /* ERROR_CLOUD_FILE_INSUFFICIENT_RESOURCES */
+    388, /* ERROR_CLOUD_FILE_NETWORK_UNAVAILABLE */
+    389, /* ERROR_CLOUD_FILE_UNSUCCESSFUL */
+    390, /* ERROR_CLOUD_FILE_NOT_UNDER_SYNC_ROOT */
+    391, /* ERROR_CLOUD_FILE_IN_USE */
+    392, /* ERROR_CLOUD_FILE_PINNED */
+    393, /* ERROR_CLOUD_FILE_REQUEST_ABORTED */
+    394, /* ERROR_CLOUD_FILE_PROPERTY_CORRUPT */
+    395, /* ERROR_CLOUD_FILE_ACCESS_DENIED */
+    396, /* ERROR_CLOUD_FILE_INCOMPATIBLE_HARDLINKS */
+    397, /* ERROR_CLOUD_FILE_PROPERTY_LOCK_CONFLICT */
+    398, /* ERROR_CLOUD_FILE_REQUEST_CANCELED */
+    399, /* ERROR_EXTERNAL_SYSKEY_NOT_SUPPORTED */
+    400, /* ERROR_THREAD_MODE_ALREADY_BACKGROUND */
+    401, /* ERROR_THREAD_MODE_NOT_BACKGROUND */
+    402, /* ERROR_PROCESS_MODE_ALREADY_BACKGROUND */
+    403, /* ERROR_PROCESS_MODE_NOT_BACKGROUND */
+    404, /* ERROR_CLOUD_FILE_PROVIDER_TERMINATED */
+    405, /* ERROR_NOT_A_CLOUD_SYNC_ROOT */
+    406, /* ERROR_FILE_PROTECTED_UNDER_DPL */
+    407, /* ERROR_VOLUME_NOT_CLUSTER_ALIGNED */
+    408, /* ERROR_NO_PHYSICALLY_ALIGNED_FREE_SPACE_FOUND */
+    409, /* ERROR_APPX_FILE_NOT_ENCRYPTED */
+    410, /* ERROR_RWRAW_ENCRYPTED_FILE_NOT_ENCRYPTED */
+    411, /* ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILEOFFSET */
+    412, /* ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILERANGE */
+    413, /* ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_PARAMETER */
+    414, /* ERROR_LINUX_SUBSYSTEM_NOT_PRESENT */
+    415, /* ERROR_FT_READ_FAILURE */
+    416, /* ERROR_STORAGE_RESERVE_ID_INVALID */
+    417, /* ERROR_STORAGE_RESERVE_DOES_NOT_EXIST */
+    418, /* ERROR_STORAGE_RESERVE_ALREADY_EXISTS */
+    419, /* ERROR_STORAGE_RESERVE_NOT_EMPTY */
+    420, /* ERROR_NOT_A_DAX_VOLUME */
+    421, /* ERROR_NOT_DAX_MAPPABLE */
+    422, /* ERROR_TIME_SENSITIVE_THREAD */
+    423, /* ERROR_DPL_NOT_SUPPORTED_FOR_USER */
+    424, /* ERROR_CASE_DIFFERING_NAMES_IN_DIR */
+    425, /* ERROR_FILE_NOT_SUPPORTED */
+    426, /* ERROR_CLOUD_FILE_REQUEST_TIMEOUT */
+    427, /* ERROR_NO_TASK_QUEUE */
+    428, /* ERROR_SRC_SRV_DLL_LOAD_FAILED */
+    429, /* ERROR_NOT_SUPPORTED_WITH_BTT */
+    430, /* ERROR_ENCRYPTION_DISABLED */
+    431, /* ERROR_ENCRYPTING_METADATA_DISALLOWED */
+    432, /* ERROR_CANT_CLEAR_ENCRYPTION_FLAG */
+    433, /* ERROR_NO_SUCH_DEVICE */
+    434, /* ERROR_CLOUD_FILE_DEHYDRATION_DISALLOWED */
+    435, /* ERROR_FILE_SNAP_IN_PROGRESS */
+    436, /* ERROR_FILE_SNAP_USER_SECTION_NOT_SUPPORTED */
+    437, /* ERROR_FILE_SNAP_MODIFY_NOT_SUPPORTED */
+    438, /* ERROR_FILE_SNAP_IO_NOT_COORDINATED */
+    439, /* ERROR_FILE_SNAP_UNEXPECTED_ERROR */
+    440, /* ERROR_FILE_SNAP_INVALID_PARAMETER */
+    441, /* ERROR_UNSATISFIED_DEPENDENCIES */
+    442, /* ERROR_CASE_SENSITIVE_PATH */
+    443, /* ERROR_UNEXPECTED_NTCACHEMANAGER_ERROR */
+    444, /* ERROR_LINUX_SUBSYSTEM_UPDATE_REQUIRED */
+    445, /* ERROR_DLP_POLICY_WARNS_AGAINST_OPERATION */
+    446, /* ERROR_DLP_POLICY_DENIES_OPERATION */
+    447, /* ERROR_SECURITY_DENIES_OPERATION */
+    448, /* ERROR_UNTRUSTED_MOUNT_POINT */
+    449, /* ERROR_DLP_POLICY_SILENTLY_FAIL */
+    450, /* ERROR_CAPAUTHZ_NOT_DEVUNLOCKED */
+    451, /* ERROR_CAPAUTHZ_CHANGE_TYPE */
+    452, /* ERROR_CAPAUTHZ_NOT_PROVISIONED */
+    453, /* ERROR_CAPAUTHZ_NOT_AUTHORIZED */
+    454, /* ERROR_CAPAUTHZ_NO_POLICY */
+    455, /* ERROR_CAPAUTHZ_DB_CORRUPTED */
+    456, /* ERROR_CAPAUTHZ_SCCD_INVALID_CATALOG */
+    457, /* ERROR_CAPAUTHZ_SCCD_NO_AUTH_ENTITY */
+    458, /* ERROR_CAPAUTHZ_SCCD_PARSE_ERROR */
+    459, /* ERROR_CAPAUTHZ_SCCD_DEV_MODE_REQUIRED */
+    460, /* ERROR_CAPAUTHZ_SCCD_NO_CAPABILITY_MATCH */
+    470, /* ERROR_CIMFS_IMAGE_CORRUPT */
+    471, /* ERROR_CIMFS_IMAGE_VERSION_NOT_SUPPORTED */
+    472, /* ERROR_STORAGE_STACK_ACCESS_DENIED */
+    473, /* ERROR_INSUFFICIENT_VIRTUAL_ADDR_RESOURCES */
+    474, /* ERROR_INDEX_OUT_OF_BOUNDS */
+    480, /* ERROR_PNP_QUERY_REMOVE_DEVICE_TIMEOUT */
+    481, /* ERROR_PNP_QUERY_REMOVE_RELATED_DEVICE_TIMEOUT */
+    482, /* ERROR_PNP_QUERY_REMOVE_UNRELATED_DEVICE_TIMEOUT */
+    483, /* ERROR_DEVICE_HARDWARE_ERROR */
+    487, /* ERROR_INVALID_ADDRESS */
+    488, /* ERROR_HAS_SYSTEM_CRITICAL_FILES */
+    489, /* ERROR_ENCRYPTED_FILE_NOT_SUPPORTED */
+    490, /* ERROR_SPARSE_FILE_NOT_SUPPORTED */
+    491, /* ERROR_PAGEFILE_NOT_SUPPORTED */
+    492, /* ERROR_VOLUME_NOT_SUPPORTED */
+    493, /* ERROR_NOT_SUPPORTED_WITH_BYPASSIO */
+    494, /* ERROR_NO_BYPASSIO_DRIVER_SUPPORT */
+    495, /* ERROR_NOT_SUPPORTED_WITH_ENCRYPTION */
+    496, /* ERROR_NOT_SUPPORTED_WITH_COMPRESSION */
+    497, /* ERROR_NOT_SUPPORTED_WITH_REPLICATION */
+    498, /* ERROR_NOT_SUPPORTED_WITH_DEDUPLICATION */
+    499, /* ERROR_NOT_SUPPORTED_WITH_AUDITING */
+    500, /* ERROR_USER_PROFILE_LOAD */
+    501, /* ERROR_SESSION_KEY_TOO_SHORT */
+    502, /* ERROR_ACCESS_DENIED_APPDATA */
+    503, /* ERROR_NOT_SUPPORTED_WITH_MONITORING */
+    504, /* ERROR_NOT_SUPPORTED_WITH_SNAPSHOT */
+    505, /* ERROR_NOT_SUPPORTED_WITH_VIRTUALIZATION */
+    506, /* ERROR_BYPASSIO_FLT_NOT_SUPPORTED */
+    507, /* ERROR_DEVICE_RESET_REQUIRED */
+    508, /* ERROR_VOLUME_WRITE_ACCESS_DENIED */
+    534, /* ERROR_ARITHMETIC_OVERFLOW */
+    535, /* ERROR_PIPE_CONNECTED */
+    536, /* ERROR_PIPE_LISTENING */
+    537, /* ERROR_VERIFIER_STOP */
+    538, /* ERROR_ABIOS_ERROR */
+    539, /* ERROR_WX86_WARNING */
+    540, /* ERROR_WX86_ERROR */
+    541, /* ERROR_TIMER_NOT_CANCELED */
+    542, /* ERROR_UNWIND */
+    543, /* ERROR_BAD_STACK */
+    544, /* ERROR_INVALID_UNWIND_TARGET */
+    545, /* ERROR_INVALID_PORT_ATTRIBUTES */
+    546, /* ERROR_PORT_MESSAGE_TOO_LONG */
+    547, /* ERROR_INVALID_QUOTA_LOWER */
+    548, /* ERROR_DEVICE_ALREADY_ATTACHED */
+    549, /* ERROR_INSTRUCTION_MISALIGNMENT */
+    550, /* ERROR_PROFILING_NOT_STARTED */
+    551, /* ERROR_PROFILING_NOT_STOPPED */
+    552, /* ERROR_COULD_NOT_INTERPRET */
+    553, /* ERROR_PROFILING_AT_LIMIT */
+    554, /* ERROR_CANT_WAIT */
+    555, /* ERROR_CANT_TERMINATE_SELF */
+    556, /* ERROR_UNEXPECTED_MM_CREATE_ERR */
+    557, /* ERROR_UNEXPECTED_MM_MAP_ERROR */
+    558, /* ERROR_UNEXPECTED_MM_EXTEND_ERR */
+    559, /* ERROR_BAD_FUNCTION_TABLE */
+    560, /* ERROR_NO_GUID_TRANSLATION */
+    561, /* ERROR_INVALID_LDT_SIZE */
+    563, /* ERROR_INVALID_LDT_OFFSET */
+    564, /* ERROR_INVALID_LDT_DESCRIPTOR */
+    565, /* ERROR_TOO_MANY_THREADS */
+    566, /* ERROR_THREAD_NOT_IN_PROCESS */
+    567, /* ERROR_PAGEFILE_QUOTA_EXCEEDED */
+    568, /* ERROR_LOGON_SERVER_CONFLICT */
+    569, /* ERROR_SYNCHRONIZATION_REQUIRED */
+    570, /* ERROR_NET_OPEN_FAILED */
+    571, /* ERROR_IO_PRIVILEGE_FAILED */
+    572, /* ERROR_CONTROL_C_EXIT */
+    573, /* ERROR_MISSING_SYSTEMFILE */
+    574, /* ERROR_UNHANDLED_EXCEPTION */
+    575, /* ERROR_APP_INIT_FAILURE */
+    576, /* ERROR_PAGEFILE_CREATE_FAILED */
+    577, /* ERROR_INVALID_IMAGE_HASH */
+    578, /* ERROR_NO_PAGEFILE */
+    579, /* ERROR_ILLEGAL_FLOAT_CONTEXT */
+    580, /* ERROR_NO_EVENT_PAIR */
+    581, /* ERROR_DOMAIN_CTRLR_CONFIG_ERROR */
+    582, /* ERROR_ILLEGAL_CHARACTER */
+    583, /* ERROR_UNDEFINED_CHARACTER */
+    584, /* ERROR_FLOPPY_VOLUME */
+    585, /* ERROR_BIOS_FAILED_TO_CONNECT_INTERRUPT */
+    586, /* ERROR_BACKUP_CONTROLLER */
+    587, /* ERROR_MUTANT_LIMIT_EXCEEDED */
+    588, /* ERROR_FS_DRIVER_REQUIRED */
+    589, /* ERROR_CANNOT_LOAD_REGISTRY_FILE */
+    590, /* ERROR_DEBUG_ATTACH_FAILED */
+    591, /* ERROR_SYSTEM_PROCESS_TERMINATED */
+    592, /* ERROR_DATA_NOT_ACCEPTED */
+    593, /* ERROR_VDM_HARD_ERROR */
+    594, /* ERROR_DRIVER_CANCEL_TIMEOUT */
+    595, /* ERROR_REPLY_MESSAGE_MISMATCH */
+    596, /* ERROR_LOST_WRITEBEHIND_DATA */
+    597, /* ERROR_CLIENT_SERVER_PARAMETERS_INVALID */
+    598, /* ERROR_NOT_TINY_STREAM */
+    599, /* ERROR_STACK_OVERFLOW_READ */
+    600, /* ERROR_CONVERT_TO_LARGE */
+    601, /* ERROR_FOUND_OUT_OF_SCOPE */
+    602, /* ERROR_ALLOCATE_BUCKET */
+    603, /* ERROR_MARSHALL_OVERFLOW */
+    604, /* ERROR_INVALID_VARIANT */
+    605, /* ERROR_BAD_COMPRESSION_BUFFER */
+    606, /* ERROR_AUDIT_FAILED */
+    607, /* ERROR_TIMER_RESOLUTION_NOT_SET */
+    608, /* ERROR_INSUFFICIENT_LOGON_INFO */
+    609, /* ERROR_BAD_DLL_ENTRYPOINT */
+    610, /* ERROR_BAD_SERVICE_ENTRYPOINT */
+    611, /* ERROR_IP_ADDRESS_CONFLICT1 */
+    612, /* ERROR_IP_ADDRESS_CONFLICT2 */
+    613, /* ERROR_REGISTRY_QUOTA_LIMIT */
+    614, /* ERROR_NO_CALLBACK_ACTIVE */
+    615, /* ERROR_PWD_TOO_SHORT */
+    616, /* ERROR_PWD_TOO_RECENT */
+    617, /* ERROR_PWD_HISTORY_CONFLICT */
+    618, /* ERROR_UNSUPPORTED_COMPRESSION */
+    619, /* ERROR_INVALID_HW_PROFILE */
+    620, /* ERROR_INVALID_PLUGPLAY_DEVICE_PATH */
+    621, /* ERROR_QUOTA_LIST_INCONSISTENT */
+    622, /* ERROR_EVALUATION_EXPIRATION */
+    623, /* ERROR_ILLEGAL_DLL_RELOCATION */
+    624, /* ERROR_DLL_INIT_FAILED_LOGOFF */
+    625, /* ERROR_VALIDATE_CONTINUE */
+    626, /* ERROR_NO_MORE_MATCHES */
+    627, /* ERROR_RANGE_LIST_CONFLICT */
+    628, /* ERROR_SERVER_SID_MISMATCH */
+    629, /* ERROR_CANT_ENABLE_DENY_ONLY */
+    630, /* ERROR_FLOAT_MULTIPLE_FAULTS */
+    631, /* ERROR_FLOAT_MULTIPLE_TRAPS */
+    632, /* ERROR_NOINTERFACE */
+    633, /* ERROR_DRIVER_FAILED_SLEEP */
+    634, /* ERROR_CORRUPT_SYSTEM_FILE */
+    635, /* ERROR_COMMITMENT_MINIMUM */
+    636, /* ERROR_PNP_RESTART_ENUMERATION */
+    637, /* ERROR_SYSTEM_IMAGE_BAD_SIGNATURE */
+    638, /* ERROR_PNP_REBOOT_REQUIRED */
+    639, /* ERROR_INSUFFICIENT_POWER */
+    640, /* ERROR_MULTIPLE_FAULT_VIOLATION */
+    641, /* ERROR_SYSTEM_SHUTDOWN */
+    642, /* ERROR_PORT_NOT_SET */
+    643, /* ERROR_DS_VERSION_CHECK_FAILURE */
+    644, /* ERROR_RANGE_NOT_FOUND */
+    646, /* ERROR_NOT_SAFE_MODE_DRIVER */
+    647, /* ERROR_FAILED_DRIVER_ENTRY */
+    648, /* ERROR_DEVICE_ENUMERATION_ERROR */
+    649, /* ERROR_MOUNT_POINT_NOT_RESOLVED */
+    650, /* ERROR_INVALID_DEVICE_OBJECT_PARAMETER */
+    651, /* ERROR_MCA_OCCURED */
+    652, /* ERROR_DRIVER_DATABASE_ERROR */
+    653, /* ERROR_SYSTEM_HIVE_TOO_LARGE */
+    654, /* ERROR_DRIVER_FAILED_PRIOR_UNLOAD */
+    655, /* ERROR_VOLSNAP_PREPARE_HIBERNATE */
+    656, /* ERROR_HIBERNATION_FAILURE */
+    657, /* ERROR_PWD_TOO_LONG */
+    665, /* ERROR_FILE_SYSTEM_LIMITATION */
+    668, /* ERROR_ASSERTION_FAILURE */
+    669, /* ERROR_ACPI_ERROR */
+    670, /* ERROR_WOW_ASSERTION */
+    671, /* ERROR_PNP_BAD_MPS_TABLE */
+    672, /* ERROR_PNP_TRANSLATION_FAILED */
+    673, /* ERROR_PNP_IRQ_TRANSLATION_FAILED */
+    674, /* ERROR_PNP_INVALID_ID */
+    675, /* ERROR_WAKE_SYSTEM_DEBUGGER */
+    676, /* ERROR_HANDLES_CLOSED */
+    677, /* ERROR_EXTRANEOUS_INFORMATION */
+    678, /* ERROR_RXACT_COMMIT_NECESSARY */
+    679, /* ERROR_MEDIA_CHECK */
+    680, /* ERROR_GUID_SUBSTITUTION_MADE */
+    681, /* ERROR_STOPPED_ON_SYMLINK */
+    682, /* ERROR_LONGJUMP */
+    683, /* ERROR_PLUGPLAY_QUERY_VETOED */
+    684, /* ERROR_UNWIND_CONSOLIDATE */
+    685, /* ERROR_REGISTRY_HIVE_RECOVERED */
+    686, /* ERROR_DLL_MIGHT_BE_INSECURE */
+    687, /* ERROR_DLL_MIGHT_BE_INCOMPATIBLE */
+    688, /* ERROR_DBG_EXCEPTION_NOT_HANDLED */
+    689, /* ERROR_DBG_REPLY_LATER */
+    690, /* ERROR_DBG_UNABLE_TO_PROVIDE_HANDLE */
+    691, /* ERROR_DBG_TERMINATE_THREAD */
+    692, /* ERROR_DBG_TERMINATE_PROCESS */
+    693, /* ERROR_DBG_CONTROL_C */
+    694, /* ERROR_DBG_PRINTEXCEPTION_C */
+    695, /* ERROR_DBG_RIPEXCEPTION */
+    696, /* ERROR_DBG_CONTROL_BREAK */
+    697, /* ERROR_DBG_COMMAND_EXCEPTION */
+    698, /* ERROR_OBJECT_NAME_EXISTS */
+    699, /* ERROR_THREAD_WAS_SUSPENDED */
+    700, /* ERROR_IMAGE_NOT_AT_BASE */
+    701, /* ERROR_RXACT_STATE_CREATED */
+    702, /* ERROR_SEGMENT_NOTIFICATION */
+    703, /* ERROR_BAD_CURRENT_DIRECTORY */
+    704, /* ERROR_FT_READ_RECOVERY_FROM_BACKUP */
+    705, /* ERROR_FT_WRITE_RECOVERY */
+    706, /* ERROR_IMAGE_MACHINE_TYPE_MISMATCH */
+    707, /* ERROR_RECEIVE_PARTIAL */
+    708, /* ERROR_RECEIVE_EXPEDITED */
+    709, /* ERROR_RECEIVE_PARTIAL_EXPEDITED */
+    710, /* ERROR_EVENT_DONE */
+    711, /* ERROR_EVENT_PENDING */
+    712, /* ERROR_CHECKING_FILE_SYSTEM */
+    713, /* ERROR_FATAL_APP_EXIT */
+    714, /* ERROR_PREDEFINED_HANDLE */
+    715, /* ERROR_WAS_UNLOCKED */
+    716, /* ERROR_SERVICE_NOTIFICATION */
+    717, /* ERROR_WAS_LOCKED */
+    718, /* ERROR_LOG_HARD_ERROR */
+    719, /* ERROR_ALREADY_WIN32 */
+    720, /* ERROR_IMAGE_MACHINE_TYPE_MISMATCH_EXE */
+    721, /* ERROR_NO_YIELD_PERFORMED */
+    722, /* ERROR_TIMER_RESUME_IGNORED */
+    723, /* ERROR_ARBITRATION_UNHANDLED */
+    724, /* ERROR_CARDBUS_NOT_SUPPORTED */
+    725, /* ERROR_MP_PROCESSOR_MISMATCH */
+    726, /* ERROR_HIBERNATED */
+    727, /* ERROR_RESUME_HIBERNATION */
+    728, /* ERROR_FIRMWARE_UPDATED */
+    729, /* ERROR_DRIVERS_LEAKING_LOCKED_PAGES */
+    730, /* ERROR_WAKE_SYSTEM */
+    731, /* ERROR_WAIT_1 */
+    732, /* ERROR_WAIT_2 */
+    733, /* ERROR_WAIT_3 */
+    734, /* ERROR_WAIT_63 */
+    735, /* ERROR_ABANDONED_WAIT_0 */
+    736, /* ERROR_ABANDONED_WAIT_63 */
+    737, /* ERROR_USER_APC */
+    738, /* ERROR_KERNEL_APC */
+    739, /* ERROR_ALERTED */
+    740, /* ERROR_ELEVATION_REQUIRED */
+    741, /* ERROR_REPARSE */
+    742, /* ERROR_OPLOCK_BREAK_IN_PROGRESS */
+    743, /* ERROR_VOLUME_MOUNTED */
+    744, /* ERROR_RXACT_COMMITTED */
+    745, /* ERROR_NOTIFY_CLEANUP */
+    746, /* ERROR_PRIMARY_TRANSPORT_CONNECT_FAILED */
+    747, /* ERROR_PAGE_FAULT_TRANSITION */
+    748, /* ERROR_PAGE_FAULT_DEMAND_ZERO */
+    749, /* ERROR_PAGE_FAULT_COPY_ON_WRITE */
+    750, /* ERROR_PAGE_FAULT_GUARD_PAGE */
+    751, /* ERROR_PAGE_FAULT_PAGING_FILE */
+    752, /* ERROR_CACHE_PAGE_LOCKED */
+    753, /* ERROR_CRASH_DUMP */
+    754, /* ERROR_BUFFER_ALL_ZEROS */
+    755, /* ERROR_REPARSE_OBJECT */
+    756, /* ERROR_RESOURCE_REQUIREMENTS_CHANGED */
+    757, /* ERROR_TRANSLATION_COMPLETE */
+    758, /* ERROR_NOTHING_TO_TERMINATE */
+    759, /* ERROR_PROCESS_NOT_IN_JOB */
+    760, /* ERROR_PROCESS_IN_JOB */
+    761, /* ERROR_VOLSNAP_HIBERNATE_READY */
+    762, /* ERROR_FSFILTER_OP_COMPLETED_SUCCESSFULLY */
+    763, /* ERROR_INTERRUPT_VECTOR_ALREADY_CONNECTED */
+    764, /* ERROR_INTERRUPT_STILL_CONNECTED */
+    765, /* ERROR_WAIT_FOR_OPLOCK */
+    766, /* ERROR_DBG_EXCEPTION_HANDLED */
+    767, /* ERROR_DBG_CONTINUE */
+    768, /* ERROR_CALLBACK_POP_STACK */
+    769, /* ERROR_COMPRESSION_DISABLED */
+    770, /* ERROR_CANTFETCHBACKWARDS */
+    771, /* ERROR_CANTSCROLLBACKWARDS */
+    772, /* ERROR_ROWSNOTRELEASED */
+    773, /* ERROR_BAD_ACCESSOR_FLAGS */
+    774, /* ERROR_ERRORS_ENCOUNTERED */
+    775, /* ERROR_NOT_CAPABLE */
+    776, /* ERROR_REQUEST_OUT_OF_SEQUENCE */
+    777, /* ERROR_VERSION_PARSE_ERROR */
+    778, /* ERROR_BADSTARTPOSITION */
+    779, /* ERROR_MEMORY_HARDWARE */
+    780, /* ERROR_DISK_REPAIR_DISABLED */
+    781, /* ERROR_INSUFFICIENT_RESOURCE_FOR_SPECIFIED_SHARED_SECTION_SIZE */
+    782, /* ERROR_SYSTEM_POWERSTATE_TRANSITION */
+    783, /* ERROR_SYSTEM_POWERSTATE_COMPLEX_TRANSITION */
+    784, /* ERROR_MCA_EXCEPTION */
+    785, /* ERROR_ACCESS_AUDIT_BY_POLICY */
+    786, /* ERROR_ACCESS_DISABLED_NO_SAFER_UI_BY_POLICY */
+    787, /* ERROR_ABANDON_HIBERFILE */
+    788, /* ERROR_LOST_WRITEBEHIND_DATA_NETWORK_DISCONNECTED */
+    789, /* ERROR_LOST_WRITEBEHIND_DATA_NETWORK_SERVER_ERROR */
+    790, /* ERROR_LOST_WRITEBEHIND_DATA_LOCAL_DISK_ERROR */
+    791, /* ERROR_BAD_MCFG_TABLE */
+    792, /* ERROR_DISK_REPAIR_REDIRECTED */
+    793, /* ERROR_DISK_REPAIR_UNSUCCESSFUL */
+    794, /* ERROR_CORRUPT_LOG_OVERFULL */
+    795, /* ERROR_CORRUPT_LOG_CORRUPTED */
+    796, /* ERROR_CORRUPT_LOG_UNAVAILABLE */
+    797, /* ERROR_CORRUPT_LOG_DELETED_FULL */
+    798, /* ERROR_CORRUPT_LOG_CLEARED */
+    799, /* ERROR_ORPHAN_NAME_EXHAUSTED */
+    800, /* ERROR_OPLOCK_SWITCHED_TO_NEW_HANDLE */
+    801, /* ERROR_CANNOT_GRANT_REQUESTED_OPLOCK */
+    802, /* ERROR_CANNOT_BREAK_OPLOCK */
+    803, /* ERROR_OPLOCK_HANDLE_CLOSED */
+    804, /* ERROR_NO_ACE_CONDITION */
+    805, /* ERROR_INVALID_ACE_CONDITION */
+    806, /* ERROR_FILE_HANDLE_REVOKED */
+    807, /* ERROR_IMAGE_AT_DIFFERENT_BASE */
+    808, /* ERROR_ENCRYPTED_IO_NOT_POSSIBLE */
+    809, /* ERROR_FILE_METADATA_OPTIMIZATION_IN_PROGRESS */
+    810, /* ERROR_QUOTA_ACTIVITY */
+    811, /* ERROR_HANDLE_REVOKED */
+    812, /* ERROR_CALLBACK_INVOKE_INLINE */
+    813, /* ERROR_CPU_SET_INVALID */
+    814, /* ERROR_ENCLAVE_NOT_TERMINATED */
+    815, /* ERROR_ENCLAVE_VIOLATION */
+    816, /* ERROR_SERVER_TRANSPORT_CONFLICT */
+    817, /* ERROR_CERTIFICATE_VALIDATION_PREFERENCE_CONFLICT */
+    818, /* ERROR_FT_READ_FROM_COPY_FAILURE */
+    819, /* ERROR_SECTION_DIRECT_MAP_ONLY */
+    994, /* ERROR_EA_ACCESS_DENIED */
+    995, /* ERROR_OPERATION_ABORTED */
+    996, /* ERROR_IO_INCOMPLETE */
+    997, /* ERROR_IO_PENDING */
+    998, /* ERROR_NOACCESS */
+    999, /* ERROR_SWAPERROR */
+    1001, /* ERROR_STACK_OVERFLOW */
+    1002, /* ERROR_INVALID_MESSAGE */
+    1003, /* ERROR_CAN_NOT_COMPLETE */
+    1004, /* ERROR_INVALID_FLAGS */
+    1005, /* ERROR_UNRECOGNIZED_VOLUME */
+    1006, /* ERROR_FILE_INVALID */
+    1007, /* ERROR_FULLSCREEN_MODE */
+    1008, /* ERROR_NO_TOKEN */
+    1009, /* ERROR_BADDB */
+    1010, /* ERROR_BADKEY */
+    1011, /* ERROR_CANTOPEN */
+    1012, /* ERROR_CANTREAD */
+    1013, /* ERROR_CANTWRITE */
+    1014, /* ERROR_REGISTRY_RECOVERED */
+    1015, /* ERROR_REGISTRY_CORRUPT */
+    1016, /* ERROR_REGISTRY_IO_FAILED */
+    1017, /* ERROR_NOT_REGISTRY_FILE */
+    1018, /* ERROR_KEY_DELETED */
+    1019, /* ERROR_NO_LOG_SPACE */
+    1020, /* ERROR_KEY_HAS_CHILDREN */
+    1021, /* ERROR_CHILD_MUST_BE_VOLATILE */
+    1022, /* ERROR_NOTIFY_ENUM_DIR */
+    1051, /* ERROR_DEPENDENT_SERVICES_RUNNING */
+    1052, /* ERROR_INVALID_SERVICE_CONTROL */
+    1053, /* ERROR_SERVICE_REQUEST_TIMEOUT */
+    1054, /* ERROR_SERVICE_NO_THREAD */
+    1055, /* ERROR_SERVICE_DATABASE_LOCKED */
+    1056, /* ERROR_SERVICE_ALREADY_RUNNING */
+    1057, /* ERROR_INVALID_SERVICE_ACCOUNT */
+    1058, /* ERROR_SERVICE_DISABLED */
+    1059, /* ERROR_CIRCULAR_DEPENDENCY */
+    1060, /* ERROR_SERVICE_DOES_NOT_EXIST */
+    1061, /* ERROR_SERVICE_CANNOT_ACCEPT_CTRL */
+    1062, /* ERROR_SERVICE_NOT_ACTIVE */
+    1063, /* ERROR_FAILED_SERVICE_CONTROLLER_CONNECT */
+    1064, /* ERROR_EXCEPTION_IN_SERVICE */
+    1065, /* ERROR_DATABASE_DOES_NOT_EXIST */
+    1066, /* ERROR_SERVICE_SPECIFIC_ERROR */
+    1067, /* ERROR_PROCESS_ABORTED */
+    1068, /* ERROR_SERVICE_DEPENDENCY_FAIL */
+    1069, /* ERROR_SERVICE_LOGON_FAILED */
+    1070, /* ERROR_SERVICE_START_HANG */
+    1071, /* ERROR_INVALID_SERVICE_LOCK */
+    1072, /* ERROR_SERVICE_MARKED_FOR_DELETE */
+    1073, /* ERROR_SERVICE_EXISTS */
+    1074, /* ERROR_ALREADY_RUNNING_LKG */
+    1075, /* ERROR_SERVICE_DEPENDENCY_DELETED */
+    1076, /* ERROR_BOOT_ALREADY_ACCEPTED */
+    1077, /* ERROR_SERVICE_NEVER_STARTED */
+    1078, /* ERROR_DUPLICATE_SERVICE_NAME */
+    1079, /* ERROR_DIFFERENT_SERVICE_ACCOUNT */
+    1080, /* ERROR_CANNOT_DETECT_DRIVER_FAILURE */
+    1081, /* ERROR_CANNOT_DETECT_PROCESS_ABORT */
+    1082, /* ERROR_NO_RECOVERY_PROGRAM */
+    1083, /* ERROR_SERVICE_NOT_IN_EXE */
+    1084, /* ERROR_NOT_SAFEBOOT_SERVICE */
+    1100, /* ERROR_END_OF_MEDIA */
+    1101, /* ERROR_FILEMARK_DETECTED */
+    1102, /* ERROR_BEGINNING_OF_MEDIA */
+    1103, /* ERROR_SETMARK_DETECTED */
+    1104, /* ERROR_NO_DATA_DETECTED */
+    1105, /* ERROR_PARTITION_FAILURE */
+    1106, /* ERROR_INVALID_BLOCK_LENGTH */
+    1107, /* ERROR_DEVICE_NOT_PARTITIONED */
+    1108, /* ERROR_UNABLE_TO_LOCK_MEDIA */
+    1109, /* ERROR_UNABLE_TO_UNLOAD_MEDIA */
+    1110, /* ERROR_MEDIA_CHANGED */
+    1111, /* ERROR_BUS_RESET */
+    1112, /* ERROR_NO_MEDIA_IN_DRIVE */
+    1113, /* ERROR_NO_UNICODE_TRANSLATION */
+    1114, /* ERROR_DLL_INIT_FAILED */
+    1115, /* ERROR_SHUTDOWN_IN_PROGRESS */
+    1116, /* ERROR_NO_SHUTDOWN_IN_PROGRESS */
+    1117, /* ERROR_IO_DEVICE */
+    1118, /* ERROR_SERIAL_NO_DEVICE */
+    1119, /* ERROR_IRQ_BUSY */
+    1120, /* ERROR_MORE_WRITES */
+    1121, /* ERROR_COUNTER_TIMEOUT */
+    1122, /* ERROR_FLOPPY_ID_MARK_NOT_FOUND */
+    1123, /* ERROR_FLOPPY_WRONG_CYLINDER */
+    1124, /* ERROR_FLOPPY_UNKNOWN_ERROR */
+    1125, /* ERROR_FLOPPY_BAD_REGISTERS */
+    1126, /* ERROR_DISK_RECALIBRATE_FAILED */
+    1127, /* ERROR_DISK_OPERATION_FAILED */
+    1128, /* ERROR_DISK_RESET_FAILED */
+    1129, /* ERROR_EOM_OVERFLOW */
+    1130, /* ERROR_NOT_ENOUGH_SERVER_MEMORY */
+    1131, /* ERROR_POSSIBLE_DEADLOCK */
+    1132, /* ERROR_MAPPED_ALIGNMENT */
+    1140, /* ERROR_SET_POWER_STATE_VETOED */
+    1141, /* ERROR_SET_POWER_STATE_FAILED */
+    1142, /* ERROR_TOO_MANY_LINKS */
+    1150, /* ERROR_OLD_WIN_VERSION */
+    1151, /* ERROR_APP_WRONG_OS */
+    1152, /* ERROR_SINGLE_INSTANCE_APP */
+    1153, /* ERROR_RMODE_APP */
+    1154, /* ERROR_INVALID_DLL */
+    1155, /* ERROR_NO_ASSOCIATION */
+    1156, /* ERROR_DDE_FAIL */
+    1157, /* ERROR_DLL_NOT_FOUND */
+    1158, /* ERROR_NO_MORE_USER_HANDLES */
+    1159, /* ERROR_MESSAGE_SYNC_ONLY */
+    1160, /* ERROR_SOURCE_ELEMENT_EMPTY */
+    1161, /* ERROR_DESTINATION_ELEMENT_FULL */
+    1162, /* ERROR_ILLEGAL_ELEMENT_ADDRESS */
+    1163, /* ERROR_MAGAZINE_NOT_PRESENT */
+    1164, /* ERROR_DEVICE_REINITIALIZATION_NEEDED */
+    1165, /* ERROR_DEVICE_REQUIRES_CLEANING */
+    1166, /* ERROR_DEVICE_DOOR_OPEN */
+    1167, /* ERROR_DEVICE_NOT_CONNECTED */
+    1168, /* ERROR_NOT_FOUND */
+    1169, /* ERROR_NO_MATCH */
+    1170, /* ERROR_SET_NOT_FOUND */
+    1171, /* ERROR_POINT_NOT_FOUND */
+    1172, /* ERROR_NO_TRACKING_SERVICE */
+    1173, /* ERROR_NO_VOLUME_ID */
+    1175, /* ERROR_UNABLE_TO_REMOVE_REPLACED */
+    1176, /* ERROR_UNABLE_TO_MOVE_REPLACEMENT */
+    1177, /* ERROR_UNABLE_TO_MOVE_REPLACEMENT_2 */
+    1178, /* ERROR_JOURNAL_DELETE_IN_PROGRESS */
+    1179, /* ERROR_JOURNAL_NOT_ACTIVE */
+    1180, /* ERROR_POTENTIAL_FILE_FOUND */
+    1181, /* ERROR_JOURNAL_ENTRY_DELETED */
+    1184, /* ERROR_PARTITION_TERMINATING */
+    1190, /* ERROR_SHUTDOWN_IS_SCHEDULED */
+    1191, /* ERROR_SHUTDOWN_USERS_LOGGED_ON */
+    1192, /* ERROR_SHUTDOWN_DISKS_NOT_IN_MAINTENANCE_MODE */
+    1200, /* ERROR_BAD_DEVICE */
+    1201, /* ERROR_CONNECTION_UNAVAIL */
+    1202, /* ERROR_DEVICE_ALREADY_REMEMBERED */
+    1203, /* ERROR_NO_NET_OR_BAD_PATH */
+    1204, /* ERROR_BAD_PROVIDER */
+    1205, /* ERROR_CANNOT_OPEN_PROFILE */
+    1206, /* ERROR_BAD_PROFILE */
+    1207, /* ERROR_NOT_CONTAINER */
+    1208, /* ERROR_EXTENDED_ERROR */
+    1209, /* ERROR_INVALID_GROUPNAME */
+    1210, /* ERROR_INVALID_COMPUTERNAME */
+    1211, /* ERROR_INVALID_EVENTNAME */
+    1212, /* ERROR_INVALID_DOMAINNAME */
+    1213, /* ERROR_INVALID_SERVICENAME */
+    1214, /* ERROR_INVALID_NETNAME */
+    1215, /* ERROR_INVALID_SHARENAME */
+    1216, /* ERROR_INVALID_PASSWORDNAME */
+    1217, /* ERROR_INVALID_MESSAGENAME */
+    1218, /* ERROR_INVALID_MESSAGEDEST */
+    1219, /* ERROR_SESSION_CREDENTIAL_CONFLICT */
+    1220, /* ERROR_REMOTE_SESSION_LIMIT_EXCEEDED */
+    1221, /* ERROR_DUP_DOMAINNAME */
+    1222, /* ERROR_NO_NETWORK */
+    1223, /* ERROR_CANCELLED */
+    1224, /* ERROR_USER_MAPPED_FILE */
+    1225, /* ERROR_CONNECTION_REFUSED */
+    1226, /* ERROR_GRACEFUL_DISCONNECT */
+    1227, /* ERROR_ADDRESS_ALREADY_ASSOCIATED */
+    1228, /* ERROR_ADDRESS_NOT_ASSOCIATED */
+    1229, /* ERROR_CONNECTION_INVALID */
+    1230, /* ERROR_CONNECTION_ACTIVE */
+    1231, /* ERROR_NETWORK_UNREACHABLE */
+    1232, /* ERROR_HOST_UNREACHABLE */
+    1233, /* ERROR_PROTOCOL_UNREACHABLE */
+    1234, /* ERROR_PORT_UNREACHABLE */
+    1235, /* ERROR_REQUEST_ABORTED */
+    1236, /* ERROR_CONNECTION_ABORTED */
+    1237, /* ERROR_RETRY */
+    1238, /* ERROR_CONNECTION_COUNT_LIMIT */
+    1239, /* ERROR_LOGIN_TIME_RESTRICTION */
+    1240, /* ERROR_LOGIN_WKSTA_RESTRICTION */
+    1241, /* ERROR_INCORRECT_ADDRESS */
+    1242, /* ERROR_ALREADY_REGISTERED */
+    1243, /* ERROR_SERVICE_NOT_FOUND */
+    1244, /* ERROR_NOT_AUTHENTICATED */
+    1245, /* ERROR_NOT_LOGGED_ON */
+    1246, /* ERROR_CONTINUE */
+    1247, /* ERROR_ALREADY_INITIALIZED */
+    1248, /* ERROR_NO_MORE_DEVICES */
+    1249, /* ERROR_NO_SUCH_SITE */
+    1250, /* ERROR_DOMAIN_CONTROLLER_EXISTS */
+    1251, /* ERROR_ONLY_IF_CONNECTED */
+    1252, /* ERROR_OVERRIDE_NOCHANGES */
+    1253, /* ERROR_BAD_USER_PROFILE */
+    1254, /* ERROR_NOT_SUPPORTED_ON_SBS */
+    1255, /* ERROR_SERVER_SHUTDOWN_IN_PROGRESS */
+    1256, /* ERROR_HOST_DOWN */
+    1257, /* ERROR_NON_ACCOUNT_SID */
+    1258, /* ERROR_NON_DOMAIN_SID */
+    1259, /* ERROR_APPHELP_BLOCK */
+    1260, /* ERROR_ACCESS_DISABLED_BY_POLICY */
+    1261, /* ERROR_REG_NAT_CONSUMPTION */
+    1262, /* ERROR_CSCSHARE_OFFLINE */
+    1263, /* ERROR_PKINIT_FAILURE */
+    1264, /* ERROR_SMARTCARD_SUBSYSTEM_FAILURE */
+    1265, /* ERROR_DOWNGRADE_DETECTED */
+    1271, /* ERROR_MACHINE_LOCKED */
+    1272, /* ERROR_SMB_GUEST_LOGON_BLOCKED */
+    1273, /* ERROR_CALLBACK_SUPPLIED_INVALID_DATA */
+    1274, /* ERROR_SYNC_FOREGROUND_REFRESH_REQUIRED */
+    1275, /* ERROR_DRIVER_BLOCKED */
+    1276, /* ERROR_INVALID_IMPORT_OF_NON_DLL */
+    1277, /* ERROR_ACCESS_DISABLED_WEBBLADE */
+    1278, /* ERROR_ACCESS_DISABLED_WEBBLADE_TAMPER */
+    1279, /* ERROR_RECOVERY_FAILURE */
+    1280, /* ERROR_ALREADY_FIBER */
+    1281, /* ERROR_ALREADY_THREAD */
+    1282, /* ERROR_STACK_BUFFER_OVERRUN */
+    1283, /* ERROR_PARAMETER_QUOTA_EXCEEDED */
+    1284, /* ERROR_DEBUGGER_INACTIVE */
+    1285, /* ERROR_DELAY_LOAD_FAILED */
+    1286, /* ERROR_VDM_DISALLOWED */
+    1287, /* ERROR_UNIDENTIFIED_ERROR */
+    1288, /* ERROR_INVALID_CRUNTIME_PARAMETER */
+    1289, /* ERROR_BEYOND_VDL */
+    1290, /* ERROR_INCOMPATIBLE_SERVICE_SID_TYPE */
+    1291, /* ERROR_DRIVER_PROCESS_TERMINATED */
+    1292, /* ERROR_IMPLEMENTATION_LIMIT */
+    1293, /* ERROR_PROCESS_IS_PROTECTED */
+    1294, /* ERROR_SERVICE_NOTIFY_CLIENT_LAGGING */
+    1295, /* ERROR_DISK_QUOTA_EXCEEDED */
+    1296, /* ERROR_CONTENT_BLOCKED */
+    1297, /* ERROR_INCOMPATIBLE_SERVICE_PRIVILEGE */
+    1298, /* ERROR_APP_HANG */
+    1299, /* ERROR_INVALID_LABEL */
+    1300, /* ERROR_NOT_ALL_ASSIGNED */
+    1301, /* ERROR_SOME_NOT_MAPPED */
+    1302, /* ERROR_NO_QUOTAS_FOR_ACCOUNT */
+    1303, /* ERROR_LOCAL_USER_SESSION_KEY */
+    1304, /* ERROR_NULL_LM_PASSWORD */
+    1305, /* ERROR_UNKNOWN_REVISION */
+    1306, /* ERROR_REVISION_MISMATCH */
+    1307, /* ERROR_INVALID_OWNER */
+    1308, /* ERROR_INVALID_PRIMARY_GROUP */
+    1309, /* ERROR_NO_IMPERSONATION_TOKEN */
+    1310, /* ERROR_CANT_DISABLE_MANDATORY */
+    1311, /* ERROR_NO_LOGON_SERVERS */
+    1312, /* ERROR_NO_SUCH_LOGON_SESSION */
+    1313, /* ERROR_NO_SUCH_PRIVILEGE */
+    1314, /* ERROR_PRIVILEGE_NOT_HELD */
+    1315, /* ERROR_INVALID_ACCOUNT_NAME */
+    1316, /* ERROR_USER_EXISTS */
+    1317, /* ERROR_NO_SUCH_USER */
+    1318, /* ERROR_GROUP_EXISTS */
+    1319, /* ERROR_NO_SUCH_GROUP */
+    1320, /* ERROR_MEMBER_IN_GROUP */
+    1321, /* ERROR_MEMBER_NOT_IN_GROUP */
+    1322, /* ERROR_LAST_ADMIN */
+    1323, /* ERROR_WRONG_PASSWORD */
+    1324, /* ERROR_ILL_FORMED_PASSWORD */
+    1325, /* ERROR_PASSWORD_RESTRICTION */
+    1326, /* ERROR_LOGON_FAILURE */
+    1327, /* ERROR_ACCOUNT_RESTRICTION */
+    1328, /* ERROR_INVALID_LOGON_HOURS */
+    1329, /* ERROR_INVALID_WORKSTATION */
+    1330, /* ERROR_PASSWORD_EXPIRED */
+    1331, /* ERROR_ACCOUNT_DISABLED */
+    1332, /* ERROR_NONE_MAPPED */
+    1333, /* ERROR_TOO_MANY_LUIDS_REQUESTED */
+    1334, /* ERROR_LUIDS_EXHAUSTED */
+    1335, /* ERROR_INVALID_SUB_AUTHORITY */
+    1336, /* ERROR_INVALID_ACL */
+    1337, /* ERROR_INVALID_SID */
+    1338, /* ERROR_INVALID_SECURITY_DESCR */
+    1340, /* ERROR_BAD_INHERITANCE_ACL */
+    1341, /* ERROR_SERVER_DISABLED */
+    1342, /* ERROR_SERVER_NOT_DISABLED */
+    1343, /* ERROR_INVALID_ID_AUTHORITY */
+    1344, /* ERROR_ALLOTTED_SPACE_EXCEEDED */
+    1345, /* ERROR_INVALID_GROUP_ATTRIBUTES */
+    1346, /* ERROR_BAD_IMPERSONATION_LEVEL */
+    1347, /* ERROR_CANT_OPEN_ANONYMOUS */
+    1348, /* ERROR_BAD_VALIDATION_CLASS */
+    1349, /* ERROR_BAD_TOKEN_TYPE */
+    1350, /* ERROR_NO_SECURITY_ON_OBJECT */
+    1351, /* ERROR_CANT_ACCESS_DOMAIN_INFO */
+    1352, /* ERROR_INVALID_SERVER_STATE */
+    1353, /* ERROR_INVALID_DOMAIN_STATE */
+    1354, /* ERROR_INVALID_DOMAIN_ROLE */
+    1355, /* ERROR_NO_SUCH_DOMAIN */
+    1356, /* ERROR_DOMAIN_EXISTS */
+    1357, /* ERROR_DOMAIN_LIMIT_EXCEEDED */
+    1358, /* ERROR_INTERNAL_DB_CORRUPTION */
+    1359, /* ERROR_INTERNAL_ERROR */
+    1360, /* ERROR_GENERIC_NOT_MAPPED */
+    1361, /* ERROR_BAD_DESCRIPTOR_FORMAT */
+    1362, /* ERROR_NOT_LOGON_PROCESS */
+    1363, /* ERROR_LOGON_SESSION_EXISTS */
+    1364, /* ERROR_NO_SUCH_PACKAGE */
+    1365, /* ERROR_BAD_LOGON_SESSION_STATE */
+    1366, /* ERROR_LOGON_SESSION_COLLISION */
+    1367, /* ERROR_INVALID_LOGON_TYPE */
+    1368, /* ERROR_CANNOT_IMPERSONATE */
+    1369, /* ERROR_RXACT_INVALID_STATE */
+    1370, /* ERROR_RXACT_COMMIT_FAILURE */
+    1371, /* ERROR_SPECIAL_ACCOUNT */
+    1372, /* ERROR_SPECIAL_GROUP */
+    1373, /* ERROR_SPECIAL_USER */
+    1374, /* ERROR_MEMBERS_PRIMARY_GROUP */
+    1375, /* ERROR_TOKEN_ALREADY_IN_USE */
+    1376, /* ERROR_NO_SUCH_ALIAS */
+    1377, /* ERROR_MEMBER_NOT_IN_ALIAS */
+    1378, /* ERROR_MEMBER_IN_ALIAS */
+    1379, /* ERROR_ALIAS_EXISTS */
+    1380, /* ERROR_LOGON_NOT_GRANTED */
+    1381, /* ERROR_TOO_MANY_SECRETS */
+    1382, /* ERROR_SECRET_TOO_LONG */
+    1383, /* ERROR_INTERNAL_DB_ERROR */
+    1384, /* ERROR_TOO_MANY_CONTEXT_IDS */
+    1385, /* ERROR_LOGON_TYPE_NOT_GRANTED */
+    1386, /* ERROR_NT_CROSS_ENCRYPTION_REQUIRED */
+    1387, /* ERROR_NO_SUCH_MEMBER */
+    1388, /* ERROR_INVALID_MEMBER */
+    1389, /* ERROR_TOO_MANY_SIDS */
+    1390, /* ERROR_LM_CROSS_ENCRYPTION_REQUIRED */
+    1391, /* ERROR_NO_INHERITANCE */
+    1392, /* ERROR_FILE_CORRUPT */
+    1393, /* ERROR_DISK_CORRUPT */
+    1394, /* ERROR_NO_USER_SESSION_KEY */
+    1395, /* ERROR_LICENSE_QUOTA_EXCEEDED */
+    1396, /* ERROR_WRONG_TARGET_NAME */
+    1397, /* ERROR_MUTUAL_AUTH_FAILED */
+    1398, /* ERROR_TIME_SKEW */
+    1399, /* ERROR_CURRENT_DOMAIN_NOT_ALLOWED */
+    1400, /* ERROR_INVALID_WINDOW_HANDLE */
+    1401, /* ERROR_INVALID_MENU_HANDLE */
+    1402, /* ERROR_INVALID_CURSOR_HANDLE */
+    1403, /* ERROR_INVALID_ACCEL_HANDLE */
+    1404, /* ERROR_INVALID_HOOK_HANDLE */
+    1405, /* ERROR_INVALID_DWP_HANDLE */
+    1406, /* ERROR_TLW_WITH_WSCHILD */
+    1407, /* ERROR_CANNOT_FIND_WND_CLASS */
+    1408, /* ERROR_WINDOW_OF_OTHER_THREAD */
+    1409, /* ERROR_HOTKEY_ALREADY_REGISTERED */
+    1410, /* ERROR_CLASS_ALREADY_EXISTS */
+    1411, /* ERROR_CLASS_DOES_NOT_EXIST */
+    1412, /* ERROR_CLASS_HAS_WINDOWS */
+    1413, /* ERROR_INVALID_INDEX */
+    1414, /* ERROR_INVALID_ICON_HANDLE */
+    1415, /* ERROR_PRIVATE_DIALOG_INDEX */
+    1416, /* ERROR_LISTBOX_ID_NOT_FOUND */
+    1417, /* ERROR_NO_WILDCARD_CHARACTERS */
+    1418, /* ERROR_CLIPBOARD_NOT_OPEN */
+    1419, /* ERROR_HOTKEY_NOT_REGISTERED */
+    1420, /* ERROR_WINDOW_NOT_DIALOG */
+    1421, /* ERROR_CONTROL_ID_NOT_FOUND */
+    1422, /* ERROR_INVALID_COMBOBOX_MESSAGE */
+    1423, /* ERROR_WINDOW_NOT_COMBOBOX */
+    1424, /* ERROR_INVALID_EDIT_HEIGHT */
+    1425, /* ERROR_DC_NOT_FOUND */
+    1426, /* ERROR_INVALID_HOOK_FILTER */
+    1427, /* ERROR_INVALID_FILTER_PROC */
+    1428, /* ERROR_HOOK_NEEDS_HMOD */
+    1429, /* ERROR_GLOBAL_ONLY_HOOK */
+    1430, /* ERROR_JOURNAL_HOOK_SET */
+    1431, /* ERROR_HOOK_NOT_INSTALLED */
+    1432, /* ERROR_INVALID_LB_MESSAGE */
+    1433, /* ERROR_SETCOUNT_ON_BAD_LB */
+    1434, /* ERROR_LB_WITHOUT_TABSTOPS */
+    1435, /* ERROR_DESTROY_OBJECT_OF_OTHER_THREAD */
+    1436, /* ERROR_CHILD_WINDOW_MENU */
+    1437, /* ERROR_NO_SYSTEM_MENU */
+    1438, /* ERROR_INVALID_MSGBOX_STYLE */
+    1439, /* ERROR_INVALID_SPI_VALUE */
+    1440, /* ERROR_SCREEN_ALREADY_LOCKED */
+    1441, /* ERROR_HWNDS_HAVE_DIFF_PARENT */
+    1442, /* ERROR_NOT_CHILD_WINDOW */
+    1443, /* ERROR_INVALID_GW_COMMAND */
+    1444, /* ERROR_INVALID_THREAD_ID */
+    1445, /* ERROR_NON_MDICHILD_WINDOW */
+    1446, /* ERROR_POPUP_ALREADY_ACTIVE */
+    1447, /* ERROR_NO_SCROLLBARS */
+    1448, /* ERROR_INVALID_SCROLLBAR_RANGE */
+    1449, /* ERROR_INVALID_SHOWWIN_COMMAND */
+    1450, /* ERROR_NO_SYSTEM_RESOURCES */
+    1451, /* ERROR_NONPAGED_SYSTEM_RESOURCES */
+    1452, /* ERROR_PAGED_SYSTEM_RESOURCES */
+    1453, /* ERROR_WORKING_SET_QUOTA */
+    1454, /* ERROR_PAGEFILE_QUOTA */
+    1455, /* ERROR_COMMITMENT_LIMIT */
+    1456, /* ERROR_MENU_ITEM_NOT_FOUND */
+    1457, /* ERROR_INVALID_KEYBOARD_HANDLE */
+    1458, /* ERROR_HOOK_TYPE_NOT_ALLOWED */
+    1459, /* ERROR_REQUIRES_INTERACTIVE_WINDOWSTATION */
+    1460, /* ERROR_TIMEOUT */
+    1461, /* ERROR_INVALID_MONITOR_HANDLE */
+    1462, /* ERROR_INCORRECT_SIZE */
+    1463, /* ERROR_SYMLINK_CLASS_DISABLED */
+    1464, /* ERROR_SYMLINK_NOT_SUPPORTED */
+    1465, /* ERROR_XML_PARSE_ERROR */
+    1466, /* ERROR_XMLDSIG_ERROR */
+    1467, /* ERROR_RESTART_APPLICATION */
+    1468, /* ERROR_WRONG_COMPARTMENT */
+    1469, /* ERROR_AUTHIP_FAILURE */
+    1470, /* ERROR_NO_NVRAM_RESOURCES */
+    1471, /* ERROR_NOT_GUI_PROCESS */
+    1500, /* ERROR_EVENTLOG_FILE_CORRUPT */
+    1501, /* ERROR_EVENTLOG_CANT_START */
+    1502, /* ERROR_LOG_FILE_FULL */
+    1503, /* ERROR_EVENTLOG_FILE_CHANGED */
+    1504, /* ERROR_CONTAINER_ASSIGNED */
+    1505, /* ERROR_JOB_NO_CONTAINER */
+    1550, /* ERROR_INVALID_TASK_NAME */
+    1551, /* ERROR_INVALID_TASK_INDEX */
+    1552, /* ERROR_THREAD_ALREADY_IN_TASK */
+    1601, /* ERROR_INSTALL_SERVICE_FAILURE */
+    1602, /* ERROR_INSTALL_USEREXIT */
+    1603, /* ERROR_INSTALL_FAILURE */
+    1604, /* ERROR_INSTALL_SUSPEND */
+    1605, /* ERROR_UNKNOWN_PRODUCT */
+    1606, /* ERROR_UNKNOWN_FEATURE */
+    1607, /* ERROR_UNKNOWN_COMPONENT */
+    1608, /* ERROR_UNKNOWN_PROPERTY */
+    1609, /* ERROR_INVALID_HANDLE_STATE */
+    1610, /* ERROR_BAD_CONFIGURATION */
+    1611, /* ERROR_INDEX_ABSENT */
+    1612, /* ERROR_INSTALL_SOURCE_ABSENT */
+    1613, /* ERROR_INSTALL_PACKAGE_VERSION */
+    1614, /* ERROR_PRODUCT_UNINSTALLED */
+    1615, /* ERROR_BAD_QUERY_SYNTAX */
+    1616, /* ERROR_INVALID_FIELD */
+    1617, /* ERROR_DEVICE_REMOVED */
+    1618, /* ERROR_INSTALL_ALREADY_RUNNING */
+    1619, /* ERROR_INSTALL_PACKAGE_OPEN_FAILED */
+    1620, /* ERROR_INSTALL_PACKAGE_INVALID */
+    1621, /* ERROR_INSTALL_UI_FAILURE */
+    1622, /* ERROR_INSTALL_LOG_FAILURE */
+    1623, /* ERROR_INSTALL_LANGUAGE_UNSUPPORTED */
+    1624, /* ERROR_INSTALL_TRANSFORM_FAILURE */
+    1625, /* ERROR_INSTALL_PACKAGE_REJECTED */
+    1626, /* ERROR_FUNCTION_NOT_CALLED */
+    1627, /* ERROR_FUNCTION_FAILED */
+    1628, /* ERROR_INVALID_TABLE */
+    1629, /* ERROR_DATATYPE_MISMATCH */
+    1630, /* ERROR_UNSUPPORTED_TYPE */
+    1631, /* ERROR_CREATE_FAILED */
+    1632, /* ERROR_INSTALL_TEMP_UNWRITABLE */
+    1633, /* ERROR_INSTALL_PLATFORM_UNSUPPORTED */
+    1634, /* ERROR_INSTALL_NOTUSED */
+    1635, /* ERROR_PATCH_PACKAGE_OPEN_FAILED */
+    1636, /* ERROR_PATCH_PACKAGE_INVALID */
+    1637, /* ERROR_PATCH_PACKAGE_UNSUPPORTED */
+    1638, /* ERROR_PRODUCT_VERSION */
+    1639, /* ERROR_INVALID_COMMAND_LINE */
+    1640, /* ERROR_INSTALL_REMOTE_DISALLOWED */
+    1641, /* ERROR_SUCCESS_REBOOT_INITIATED */
+    1642, /* ERROR_PATCH_TARGET_NOT_FOUND */
+    1643, /* ERROR_PATCH_PACKAGE_REJECTED */
+    1644, /* ERROR_INSTALL_TRANSFORM_REJECTED */
+    1645, /* ERROR_INSTALL_REMOTE_PROHIBITED */
+    1646, /* ERROR_PATCH_REMOVAL_UNSUPPORTED */
+    1647, /* ERROR_UNKNOWN_PATCH */
+    1648, /* ERROR_PATCH_NO_SEQUENCE */
+    1649, /* ERROR_PATCH_REMOVAL_DISALLOWED */
+    1650, /* ERROR_INVALID_PATCH_XML */
+    1651, /* ERROR_PATCH_MANAGED_ADVERTISED_PRODUCT */
+    1652, /* ERROR_INSTALL_SERVICE_SAFEBOOT */
+    1653, /* ERROR_FAIL_FAST_EXCEPTION */
+    1654, /* ERROR_INSTALL_REJECTED */
+    1655, /* ERROR_DYNAMIC_CODE_BLOCKED */
+    1656, /* ERROR_NOT_SAME_OBJECT */
+    1657, /* ERROR_STRICT_CFG_VIOLATION */
+    1660, /* ERROR_SET_CONTEXT_DENIED */
+    1661, /* ERROR_CROSS_PARTITION_VIOLATION */
+    1662, /* ERROR_RETURN_ADDRESS_HIJACK_ATTEMPT */
+    1784, /* ERROR_INVALID_USER_BUFFER */
+    1785, /* ERROR_UNRECOGNIZED_MEDIA */
+    1786, /* ERROR_NO_TRUST_LSA_SECRET */
+    1787, /* ERROR_NO_TRUST_SAM_ACCOUNT */
+    1788, /* ERROR_TRUSTED_DOMAIN_FAILURE */
+    1789, /* ERROR_TRUSTED_RELATIONSHIP_FAILURE */
+    1790, /* ERROR_TRUST_FAILURE */
+    1792, /* ERROR_NETLOGON_NOT_STARTED */
+    1793, /* ERROR_ACCOUNT_EXPIRED */
+    1794, /* ERROR_REDIRECTOR_HAS_OPEN_HANDLES */
+    1795, /* ERROR_PRINTER_DRIVER_ALREADY_INSTALLED */
+    1796, /* ERROR_UNKNOWN_PORT */
+    1797, /* ERROR_UNKNOWN_PRINTER_DRIVER */
+    1798, /* ERROR_UNKNOWN_PRINTPROCESSOR */
+    1799, /* ERROR_INVALID_SEPARATOR_FILE */
+    1800, /* ERROR_INVALID_PRIORITY */
+    1801, /* ERROR_INVALID_PRINTER_NAME */
+    1802, /* ERROR_PRINTER_ALREADY_EXISTS */
+    1803, /* ERROR_INVALID_PRINTER_COMMAND */
+    1804, /* ERROR_INVALID_DATATYPE */
+    1805, /* ERROR_INVALID_ENVIRONMENT */
+    1807, /* ERROR_NOLOGON_INTERDOMAIN_TRUST_ACCOUNT */
+    1808, /* ERROR_NOLOGON_WORKSTATION_TRUST_ACCOUNT */
+    1809, /* ERROR_NOLOGON_SERVER_TRUST_ACCOUNT */
+    1810, /* ERROR_DOMAIN_TRUST_INCONSISTENT */
+    1811, /* ERROR_SERVER_HAS_OPEN_HANDLES */
+    1812, /* ERROR_RESOURCE_DATA_NOT_FOUND */
+    1813, /* ERROR_RESOURCE_TYPE_NOT_FOUND */
+    1814, /* ERROR_RESOURCE_NAME_NOT_FOUND */
+    1815, /* ERROR_RESOURCE_LANG_NOT_FOUND */
+    1816, /* ERROR_NOT_ENOUGH_QUOTA */
+    1901, /* ERROR_INVALID_TIME */
+    1902, /* ERROR_INVALID_FORM_NAME */
+    1903, /* ERROR_INVALID_FORM_SIZE */
+    1904, /* ERROR_ALREADY_WAITING */
+    1905, /* ERROR_PRINTER_DELETED */
+    1906, /* ERROR_INVALID_PRINTER_STATE */
+    1907, /* ERROR_PASSWORD_MUST_CHANGE */
+    1908, /* ERROR_DOMAIN_CONTROLLER_NOT_FOUND */
+    1909, /* ERROR_ACCOUNT_LOCKED_OUT */
+    1919, /* ERROR_NO_SITENAME */
+    1920, /* ERROR_CANT_ACCESS_FILE */
+    1921, /* ERROR_CANT_RESOLVE_FILENAME */
+    1930, /* ERROR_KM_DRIVER_BLOCKED */
+    1931, /* ERROR_CONTEXT_EXPIRED */
+    1932, /* ERROR_PER_USER_TRUST_QUOTA_EXCEEDED */
+    1933, /* ERROR_ALL_USER_TRUST_QUOTA_EXCEEDED */
+    1934, /* ERROR_USER_DELETE_TRUST_QUOTA_EXCEEDED */
+    1935, /* ERROR_AUTHENTICATION_FIREWALL_FAILED */
+    1936, /* ERROR_REMOTE_PRINT_CONNECTIONS_BLOCKED */
+    1937, /* ERROR_NTLM_BLOCKED */
+    1938, /* ERROR_PASSWORD_CHANGE_REQUIRED */
+    1939, /* ERROR_LOST_MODE_LOGON_RESTRICTION */
+    2000, /* ERROR_INVALID_PIXEL_FORMAT */
+    2001, /* ERROR_BAD_DRIVER */
+    2002, /* ERROR_INVALID_WINDOW_STYLE */
+    2003, /* ERROR_METAFILE_NOT_SUPPORTED */
+    2004, /* ERROR_TRANSFORM_NOT_SUPPORTED */
+    2005, /* ERROR_CLIPPING_NOT_SUPPORTED */
+    2010, /* ERROR_INVALID_CMM */
+    2011, /* ERROR_INVALID_PROFILE */
+    2012, /* ERROR_TAG_NOT_FOUND */
+    2013, /* ERROR_TAG_NOT_PRESENT */
+    2014, /* ERROR_DUPLICATE_TAG */
+    2015, /* ERROR_PROFILE_NOT_ASSOCIATED_WITH_DEVICE */
+    2016, /* ERROR_PROFILE_NOT_FOUND */
+    2017, /* ERROR_INVALID_COLORSPACE */
+    2018, /* ERROR_ICM_NOT_ENABLED */
+    2019, /* ERROR_DELETING_ICM_XFORM */
+    2020, /* ERROR_INVALID_TRANSFORM */
+    2021, /* ERROR_COLORSPACE_MISMATCH */
+    2022, /* ERROR_INVALID_COLORINDEX */
+    2023, /* ERROR_PROFILE_DOES_NOT_MATCH_DEVICE */
+    2108, /* ERROR_CONNECTED_OTHER_PASSWORD */
+    2109, /* ERROR_CONNECTED_OTHER_PASSWORD_DEFAULT */
+    2202, /* ERROR_BAD_USERNAME */
+    2250, /* ERROR_NOT_CONNECTED */
+    2401, /* ERROR_OPEN_FILES */
+    2402, /* ERROR_ACTIVE_CONNECTIONS */
+    2404, /* ERROR_DEVICE_IN_USE */
+    3000, /* ERROR_UNKNOWN_PRINT_MONITOR */
+    3001, /* ERROR_PRINTER_DRIVER_IN_USE */
+    3002, /* ERROR_SPOOL_FILE_NOT_FOUND */
+    3003, /* ERROR_SPL_NO_STARTDOC */
+    3004, /* ERROR_SPL_NO_ADDJOB */
+    3005, /* ERROR_PRINT_PROCESSOR_ALREADY_INSTALLED */
+    3006, /* ERROR_PRINT_MONITOR_ALREADY_INSTALLED */
+    3007, /* ERROR_INVALID_PRINT_MONITOR */
+    3008, /* ERROR_PRINT_MONITOR_IN_USE */
+    3009, /* ERROR_PRINTER_HAS_JOBS_QUEUED */
+    3010, /* ERROR_SUCCESS_REBOOT_REQUIRED */
+    3011, /* ERROR_SUCCESS_RESTART_REQUIRED */
+    3012, /* ERROR_PRINTER_NOT_FOUND */
+    3013, /* ERROR_PRINTER_DRIVER_WARNED */
+    3014, /* ERROR_PRINTER_DRIVER_BLOCKED */
+    3015, /* ERROR_PRINTER_DRIVER_PACKAGE_IN_USE */
+    3016, /* ERROR_CORE_DRIVER_PACKAGE_NOT_FOUND */
+    3017, /* ERROR_FAIL_REBOOT_REQUIRED */
+    3018, /* ERROR_FAIL_REBOOT_INITIATED */
+    3019, /* ERROR_PRINTER_DRIVER_DOWNLOAD_NEEDED */
+    3020, /* ERROR_PRINT_JOB_RESTART_REQUIRED */
+    3021, /* ERROR_INVALID_PRINTER_DRIVER_MANIFEST */
+    3022, /* ERROR_PRINTER_NOT_SHAREABLE */
+    3050, /* ERROR_REQUEST_PAUSED */
+    3060, /* ERROR_APPEXEC_CONDITION_NOT_SATISFIED */
+    3061, /* ERROR_APPEXEC_HANDLE_INVALIDATED */
+    3062, /* ERROR_APPEXEC_INVALID_HOST_GENERATION */
+    3063, /* ERROR_APPEXEC_UNEXPECTED_PROCESS_REGISTRATION */
+    3064, /* ERROR_APPEXEC_INVALID_HOST_STATE */
+    3065, /* ERROR_APPEXEC_NO_DONOR */
+    3066, /* ERROR_APPEXEC_HOST_ID_MISMATCH */
+    3067, /* ERROR_APPEXEC_UNKNOWN_USER */
+    3068, /* ERROR_APPEXEC_APP_COMPAT_BLOCK */
+    3069, /* ERROR_APPEXEC_CALLER_WAIT_TIMEOUT */
+    3070, /* ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_TERMINATION */
+    3071, /* ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_LICENSING */
+    3072, /* ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_RESOURCES */
+    3080, /* ERROR_VRF_VOLATILE_CFG_AND_IO_ENABLED */
+    3081, /* ERROR_VRF_VOLATILE_NOT_STOPPABLE */
+    3082, /* ERROR_VRF_VOLATILE_SAFE_MODE */
+    3083, /* ERROR_VRF_VOLATILE_NOT_RUNNABLE_SYSTEM */
+    3084, /* ERROR_VRF_VOLATILE_NOT_SUPPORTED_RULECLASS */
+    3085, /* ERROR_VRF_VOLATILE_PROTECTED_DRIVER */
+    3086, /* ERROR_VRF_VOLATILE_NMI_REGISTERED */
+    3087, /* ERROR_VRF_VOLATILE_SETTINGS_CONFLICT */
+    3190, /* ERROR_DIF_IOCALLBACK_NOT_REPLACED */
+    3191, /* ERROR_DIF_LIVEDUMP_LIMIT_EXCEEDED */
+    3192, /* ERROR_DIF_VOLATILE_SECTION_NOT_LOCKED */
+    3193, /* ERROR_DIF_VOLATILE_DRIVER_HOTPATCHED */
+    3194, /* ERROR_DIF_VOLATILE_INVALID_INFO */
+    3195, /* ERROR_DIF_VOLATILE_DRIVER_IS_NOT_RUNNING */
+    3196, /* ERROR_DIF_VOLATILE_PLUGIN_IS_NOT_RUNNING */
+    3197, /* ERROR_DIF_VOLATILE_PLUGIN_CHANGE_NOT_ALLOWED */
+    3198, /* ERROR_DIF_VOLATILE_NOT_ALLOWED */
+    3199, /* ERROR_DIF_BINDING_API_NOT_FOUND */
+    3950, /* ERROR_IO_REISSUE_AS_CACHED */
+    4000, /* ERROR_WINS_INTERNAL */
+    4001, /* ERROR_CAN_NOT_DEL_LOCAL_WINS */
+    4002, /* ERROR_STATIC_INIT */
+    4003, /* ERROR_INC_BACKUP */
+    4004, /* ERROR_FULL_BACKUP */
+    4005, /* ERROR_REC_NON_EXISTENT */
+    4006, /* ERROR_RPL_NOT_ALLOWED */
+    4100, /* ERROR_DHCP_ADDRESS_CONFLICT */
+    4200, /* ERROR_WMI_GUID_NOT_FOUND */
+    4201, /* ERROR_WMI_INSTANCE_NOT_FOUND */
+    4202, /* ERROR_WMI_ITEMID_NOT_FOUND */
+    4203, /* ERROR_WMI_TRY_AGAIN */
+    4204, /* ERROR_WMI_DP_NOT_FOUND */
+    4205, /* ERROR_WMI_UNRESOLVED_INSTANCE_REF */
+    4206, /* ERROR_WMI_ALREADY_ENABLED */
+    4207, /* ERROR_WMI_GUID_DISCONNECTED */
+    4208, /* ERROR_WMI_SERVER_UNAVAILABLE */
+    4209, /* ERROR_WMI_DP_FAILED */
+    4210, /* ERROR_WMI_INVALID_MOF */
+    4211, /* ERROR_WMI_INVALID_REGINFO */
+    4212, /* ERROR_WMI_ALREADY_DISABLED */
+    4213, /* ERROR_WMI_READ_ONLY */
+    4214, /* ERROR_WMI_SET_FAILURE */
+    4250, /* ERROR_NOT_APPCONTAINER */
+    4251, /* ERROR_APPCONTAINER_REQUIRED */
+    4252, /* ERROR_NOT_SUPPORTED_IN_APPCONTAINER */
+    4253, /* ERROR_INVALID_PACKAGE_SID_LENGTH */
+    4300, /* ERROR_INVALID_MEDIA */
+    4301, /* ERROR_INVALID_LIBRARY */
+    4302, /* ERROR_INVALID_MEDIA_POOL */
+    4303, /* ERROR_DRIVE_MEDIA_MISMATCH */
+    4304, /* ERROR_MEDIA_OFFLINE */
+    4305, /* ERROR_LIBRARY_OFFLINE */
+    4306, /* ERROR_EMPTY */
+    4307, /* ERROR_NOT_EMPTY */
+    4308, /* ERROR_MEDIA_UNAVAILABLE */
+    4309, /* ERROR_RESOURCE_DISABLED */
+    4310, /* ERROR_INVALID_CLEANER */
+    4311, /* ERROR_UNABLE_TO_CLEAN */
+    4312, /* ERROR_OBJECT_NOT_FOUND */
+    4313, /* ERROR_DATABASE_FAILURE */
+    4314, /* ERROR_DATABASE_FULL */
+    4315, /* ERROR_MEDIA_INCOMPATIBLE */
+    4316, /* ERROR_RESOURCE_NOT_PRESENT */
+    4317, /* ERROR_INVALID_OPERATION */
+    4318, /* ERROR_MEDIA_NOT_AVAILABLE */
+    4319, /* ERROR_DEVICE_NOT_AVAILABLE */
+    4320, /* ERROR_REQUEST_REFUSED */
+    4321, /* ERROR_INVALID_DRIVE_OBJECT */
+    4322, /* ERROR_LIBRARY_FULL */
+    4323, /* ERROR_MEDIUM_NOT_ACCESSIBLE */
+    4324, /* ERROR_UNABLE_TO_LOAD_MEDIUM */
+    4325, /* ERROR_UNABLE_TO_INVENTORY_DRIVE */
+    4326, /* ERROR_UNABLE_TO_INVENTORY_SLOT */
+    4327, /* ERROR_UNABLE_TO_INVENTORY_TRANSPORT */
+    4328, /* ERROR_TRANSPORT_FULL */
+    4329, /* ERROR_CONTROLLING_IEPORT */
+    4330, /* ERROR_UNABLE_TO_EJECT_MOUNTED_MEDIA */
+    4331, /* ERROR_CLEANER_SLOT_SET */
+    4332, /* ERROR_CLEANER_SLOT_NOT_SET */
+    4333, /* ERROR_CLEANER_CARTRIDGE_SPENT */
+    4334, /* ERROR_UNEXPECTED_OMID */
+    4335, /* ERROR_CANT_DELETE_LAST_ITEM */
+    4336, /* ERROR_MESSAGE_EXCEEDS_MAX_SIZE */
+    4337, /* ERROR_VOLUME_CONTAINS_SYS_FILES */
+    4338, /* ERROR_INDIGENOUS_TYPE */
+    4339, /* ERROR_NO_SUPPORTING_DRIVES */
+    4340, /* ERROR_CLEANER_CARTRIDGE_INSTALLED */
+    4341, /* ERROR_IEPORT_FULL */
+    4350, /* ERROR_FILE_OFFLINE */
+    4351, /* ERROR_REMOTE_STORAGE_NOT_ACTIVE */
+    4352, /* ERROR_REMOTE_STORAGE_MEDIA_ERROR */
+    4390, /* ERROR_NOT_A_REPARSE_POINT */
+    4391, /* ERROR_REPARSE_ATTRIBUTE_CONFLICT */
+    4392, /* ERROR_INVALID_REPARSE_DATA */
+    4393, /* ERROR_REPARSE_TAG_INVALID */
+    4394, /* ERROR_REPARSE_TAG_MISMATCH */
+    4395, /* ERROR_REPARSE_POINT_ENCOUNTERED */
+    4400, /* ERROR_APP_DATA_NOT_FOUND */
+    4401, /* ERROR_APP_DATA_EXPIRED */
+    4402, /* ERROR_APP_DATA_CORRUPT */
+    4403, /* ERROR_APP_DATA_LIMIT_EXCEEDED */
+    4404, /* ERROR_APP_DATA_REBOOT_REQUIRED */
+    4420, /* ERROR_SECUREBOOT_ROLLBACK_DETECTED */
+    4421, /* ERROR_SECUREBOOT_POLICY_VIOLATION */
+    4422, /* ERROR_SECUREBOOT_INVALID_POLICY */
+    4423, /* ERROR_SECUREBOOT_POLICY_PUBLISHER_NOT_FOUND */
+    4424, /* ERROR_SECUREBOOT_POLICY_NOT_SIGNED */
+    4425, /* ERROR_SECUREBOOT_NOT_ENABLED */
+    4426, /* ERROR_SECUREBOOT_FILE_REPLACED */
+    4427, /* ERROR_SECUREBOOT_POLICY_NOT_AUTHORIZED */
+    4428, /* ERROR_SECUREBOOT_POLICY_UNKNOWN */
+    4429, /* ERROR_SECUREBOOT_POLICY_MISSING_ANTIROLLBACKVERSION */
+    4430, /* ERROR_SECUREBOOT_PLATFORM_ID_MISMATCH */
+    4431, /* ERROR_SECUREBOOT_POLICY_ROLLBACK_DETECTED */
+    4432, /* ERROR_SECUREBOOT_POLICY_UPGRADE_MISMATCH */
+    4433, /* ERROR_SECUREBOOT_REQUIRED_POLICY_FILE_MISSING */
+    4434, /* ERROR_SECUREBOOT_NOT_BASE_POLICY */
+    4435, /* ERROR_SECUREBOOT_NOT_SUPPLEMENTAL_POLICY */
+    4440, /* ERROR_OFFLOAD_READ_FLT_NOT_SUPPORTED */
+    4441, /* ERROR_OFFLOAD_WRITE_FLT_NOT_SUPPORTED */
+    4442, /* ERROR_OFFLOAD_READ_FILE_NOT_SUPPORTED */
+    4443, /* ERROR_OFFLOAD_WRITE_FILE_NOT_SUPPORTED */
+    4444, /* ERROR_ALREADY_HAS_STREAM_ID */
+    4445, /* ERROR_SMR_GARBAGE_COLLECTION_REQUIRED */
+    4446, /* ERROR_WOF_WIM_HEADER_CORRUPT */
+    4447, /* ERROR_WOF_WIM_RESOURCE_TABLE_CORRUPT */
+    4448, /* ERROR_WOF_FILE_RESOURCE_TABLE_CORRUPT */
+    4449, /* ERROR_OBJECT_IS_IMMUTABLE */
+    4500, /* ERROR_VOLUME_NOT_SIS_ENABLED */
+    4550, /* ERROR_SYSTEM_INTEGRITY_ROLLBACK_DETECTED */
+    4551, /* ERROR_SYSTEM_INTEGRITY_POLICY_VIOLATION */
+    4552, /* ERROR_SYSTEM_INTEGRITY_INVALID_POLICY */
+    4553, /* ERROR_SYSTEM_INTEGRITY_POLICY_NOT_SIGNED */
+    4554, /* ERROR_SYSTEM_INTEGRITY_TOO_MANY_POLICIES */
+    4555, /* ERROR_SYSTEM_INTEGRITY_SUPPLEMENTAL_POLICY_NOT_AUTHORIZED */
+    4556, /* ERROR_SYSTEM_INTEGRITY_REPUTATION_MALICIOUS */
+    4557, /* ERROR_SYSTEM_INTEGRITY_REPUTATION_PUA */
+    4558, /* ERROR_SYSTEM_INTEGRITY_REPUTATION_DANGEROUS_EXT */
+    4559, /* ERROR_SYSTEM_INTEGRITY_REPUTATION_OFFLINE */
+    4560, /* ERROR_VSM_NOT_INITIALIZED */
+    4561, /* ERROR_VSM_DMA_PROTECTION_NOT_IN_USE */
+    4570, /* ERROR_PLATFORM_MANIFEST_NOT_AUTHORIZED */
+    4571, /* ERROR_PLATFORM_MANIFEST_INVALID */
+    4572, /* ERROR_PLATFORM_MANIFEST_FILE_NOT_AUTHORIZED */
+    4573, /* ERROR_PLATFORM_MANIFEST_CATALOG_NOT_AUTHORIZED */
+    4574, /* ERROR_PLATFORM_MANIFEST_BINARY_ID_NOT_FOUND */
+    4575, /* ERROR_PLATFORM_MANIFEST_NOT_ACTIVE */
+    4576, /* ERROR_PLATFORM_MANIFEST_NOT_SIGNED */
+    5001, /* ERROR_DEPENDENT_RESOURCE_EXISTS */
+    5002, /* ERROR_DEPENDENCY_NOT_FOUND */
+    5003, /* ERROR_DEPENDENCY_ALREADY_EXISTS */
+    5004, /* ERROR_RESOURCE_NOT_ONLINE */
+    5005, /* ERROR_HOST_NODE_NOT_AVAILABLE */
+    5006, /* ERROR_RESOURCE_NOT_AVAILABLE */
+    5007, /* ERROR_RESOURCE_NOT_FOUND */
+    5008, /* ERROR_SHUTDOWN_CLUSTER */
+    5009, /* ERROR_CANT_EVICT_ACTIVE_NODE */
+    5010, /* ERROR_OBJECT_ALREADY_EXISTS */
+    5011, /* ERROR_OBJECT_IN_LIST */
+    5012, /* ERROR_GROUP_NOT_AVAILABLE */
+    5013, /* ERROR_GROUP_NOT_FOUND */
+    5014, /* ERROR_GROUP_NOT_ONLINE */
+    5015, /* ERROR_HOST_NODE_NOT_RESOURCE_OWNER */
+    5016, /* ERROR_HOST_NODE_NOT_GROUP_OWNER */
+    5017, /* ERROR_RESMON_CREATE_FAILED */
+    5018, /* ERROR_RESMON_ONLINE_FAILED */
+    5019, /* ERROR_RESOURCE_ONLINE */
+    5020, /* ERROR_QUORUM_RESOURCE */
+    5021, /* ERROR_NOT_QUORUM_CAPABLE */
+    5022, /* ERROR_CLUSTER_SHUTTING_DOWN */
+    5023, /* ERROR_INVALID_STATE */
+    5024, /* ERROR_RESOURCE_PROPERTIES_STORED */
+    5025, /* ERROR_NOT_QUORUM_CLASS */
+    5026, /* ERROR_CORE_RESOURCE */
+    5027, /* ERROR_QUORUM_RESOURCE_ONLINE_FAILED */
+    5028, /* ERROR_QUORUMLOG_OPEN_FAILED */
+    5029, /* ERROR_CLUSTERLOG_CORRUPT */
+    5030, /* ERROR_CLUSTERLOG_RECORD_EXCEEDS_MAXSIZE */
+    5031, /* ERROR_CLUSTERLOG_EXCEEDS_MAXSIZE */
+    5032, /* ERROR_CLUSTERLOG_CHKPOINT_NOT_FOUND */
+    5033, /* ERROR_CLUSTERLOG_NOT_ENOUGH_SPACE */
+    5034, /* ERROR_QUORUM_OWNER_ALIVE */
+    5035, /* ERROR_NETWORK_NOT_AVAILABLE */
+    5036, /* ERROR_NODE_NOT_AVAILABLE */
+    5037, /* ERROR_ALL_NODES_NOT_AVAILABLE */
+    5038, /* ERROR_RESOURCE_FAILED */
+    5039, /* ERROR_CLUSTER_INVALID_NODE */
+    5040, /* ERROR_CLUSTER_NODE_EXISTS */
+    5041, /* ERROR_CLUSTER_JOIN_IN_PROGRESS */
+    5042, /* ERROR_CLUSTER_NODE_NOT_FOUND */
+    5043, /* ERROR_CLUSTER_LOCAL_NODE_NOT_FOUND */
+    5044, /* ERROR_CLUSTER_NETWORK_EXISTS */
+    5045, /* ERROR_CLUSTER_NETWORK_NOT_FOUND */
+    5046, /* ERROR_CLUSTER_NETINTERFACE_EXISTS */
+    5047, /* ERROR_CLUSTER_NETINTERFACE_NOT_FOUND */
+    5048, /* ERROR_CLUSTER_INVALID_REQUEST */
+    5049, /* ERROR_CLUSTER_INVALID_NETWORK_PROVIDER */
+    5050, /* ERROR_CLUSTER_NODE_DOWN */
+    5051, /* ERROR_CLUSTER_NODE_UNREACHABLE */
+    5052, /* ERROR_CLUSTER_NODE_NOT_MEMBER */
+    5053, /* ERROR_CLUSTER_JOIN_NOT_IN_PROGRESS */
+    5054, /* ERROR_CLUSTER_INVALID_NETWORK */
+    5056, /* ERROR_CLUSTER_NODE_UP */
+    5057, /* ERROR_CLUSTER_IPADDR_IN_USE */
+    5058, /* ERROR_CLUSTER_NODE_NOT_PAUSED */
+    5059, /* ERROR_CLUSTER_NO_SECURITY_CONTEXT */
+    5060, /* ERROR_CLUSTER_NETWORK_NOT_INTERNAL */
+    5061, /* ERROR_CLUSTER_NODE_ALREADY_UP */
+    5062, /* ERROR_CLUSTER_NODE_ALREADY_DOWN */
+    5063, /* ERROR_CLUSTER_NETWORK_ALREADY_ONLINE */
+    5064, /* ERROR_CLUSTER_NETWORK_ALREADY_OFFLINE */
+    5065, /* ERROR_CLUSTER_NODE_ALREADY_MEMBER */
+    5066, /* ERROR_CLUSTER_LAST_INTERNAL_NETWORK */
+    5067, /* ERROR_CLUSTER_NETWORK_HAS_DEPENDENTS */
+    5068, /* ERROR_INVALID_OPERATION_ON_QUORUM */
+    5069, /* ERROR_DEPENDENCY_NOT_ALLOWED */
+    5070, /* ERROR_CLUSTER_NODE_PAUSED */
+    5071, /* ERROR_NODE_CANT_HOST_RESOURCE */
+    5072, /* ERROR_CLUSTER_NODE_NOT_READY */
+    5073, /* ERROR_CLUSTER_NODE_SHUTTING_DOWN */
+    5074, /* ERROR_CLUSTER_JOIN_ABORTED */
+    5075, /* ERROR_CLUSTER_INCOMPATIBLE_VERSIONS */
+    5076, /* ERROR_CLUSTER_MAXNUM_OF_RESOURCES_EXCEEDED */
+    5077, /* ERROR_CLUSTER_SYSTEM_CONFIG_CHANGED */
+    5078, /* ERROR_CLUSTER_RESOURCE_TYPE_NOT_FOUND */
+    5079, /* ERROR_CLUSTER_RESTYPE_NOT_SUPPORTED */
+    5080, /* ERROR_CLUSTER_RESNAME_NOT_FOUND */
+    5081, /* ERROR_CLUSTER_NO_RPC_PACKAGES_REGISTERED */
+    5082, /* ERROR_CLUSTER_OWNER_NOT_IN_PREFLIST */
+    5083, /* ERROR_CLUSTER_DATABASE_SEQMISMATCH */
+    5084, /* ERROR_RESMON_INVALID_STATE */
+    5085, /* ERROR_CLUSTER_GUM_NOT_LOCKER */
+    5086, /* ERROR_QUORUM_DISK_NOT_FOUND */
+    5087, /* ERROR_DATABASE_BACKUP_CORRUPT */
+    5088, /* ERROR_CLUSTER_NODE_ALREADY_HAS_DFS_ROOT */
+    5089, /* ERROR_RESOURCE_PROPERTY_UNCHANGEABLE */
+    5090, /* ERROR_NO_ADMIN_ACCESS_POINT */
+    5890, /* ERROR_CLUSTER_MEMBERSHIP_INVALID_STATE */
+    5891, /* ERROR_CLUSTER_QUORUMLOG_NOT_FOUND */
+    5892, /* ERROR_CLUSTER_MEMBERSHIP_HALT */
+    5893, /* ERROR_CLUSTER_INSTANCE_ID_MISMATCH */
+    5894, /* ERROR_CLUSTER_NETWORK_NOT_FOUND_FOR_IP */
+    5895, /* ERROR_CLUSTER_PROPERTY_DATA_TYPE_MISMATCH */
+    5896, /* ERROR_CLUSTER_EVICT_WITHOUT_CLEANUP */
+    5897, /* ERROR_CLUSTER_PARAMETER_MISMATCH */
+    5898, /* ERROR_NODE_CANNOT_BE_CLUSTERED */
+    5899, /* ERROR_CLUSTER_WRONG_OS_VERSION */
+    5900, /* ERROR_CLUSTER_CANT_CREATE_DUP_CLUSTER_NAME */
+    5901, /* ERROR_CLUSCFG_ALREADY_COMMITTED */
+    5902, /* ERROR_CLUSCFG_ROLLBACK_FAILED */
+    5903, /* ERROR_CLUSCFG_SYSTEM_DISK_DRIVE_LETTER_CONFLICT */
+    5904, /* ERROR_CLUSTER_OLD_VERSION */
+    5905, /* ERROR_CLUSTER_MISMATCHED_COMPUTER_ACCT_NAME */
+    5906, /* ERROR_CLUSTER_NO_NET_ADAPTERS */
+    5907, /* ERROR_CLUSTER_POISONED */
+    5908, /* ERROR_CLUSTER_GROUP_MOVING */
+    5909, /* ERROR_CLUSTER_RESOURCE_TYPE_BUSY */
+    5910, /* ERROR_RESOURCE_CALL_TIMED_OUT */
+    5911, /* ERROR_INVALID_CLUSTER_IPV6_ADDRESS */
+    5912, /* ERROR_CLUSTER_INTERNAL_INVALID_FUNCTION */
+    5913, /* ERROR_CLUSTER_PARAMETER_OUT_OF_BOUNDS */
+    5914, /* ERROR_CLUSTER_PARTIAL_SEND */
+    5915, /* ERROR_CLUSTER_REGISTRY_INVALID_FUNCTION */
+    5916, /* ERROR_CLUSTER_INVALID_STRING_TERMINATION */
+    5917, /* ERROR_CLUSTER_INVALID_STRING_FORMAT */
+    5918, /* ERROR_CLUSTER_DATABASE_TRANSACTION_IN_PROGRESS */
+    5919, /* ERROR_CLUSTER_DATABASE_TRANSACTION_NOT_IN_PROGRESS */
+    5920, /* ERROR_CLUSTER_NULL_DATA */
+    5921, /* ERROR_CLUSTER_PARTIAL_READ */
+    5922, /* ERROR_CLUSTER_PARTIAL_WRITE */
+    5923, /* ERROR_CLUSTER_CANT_DESERIALIZE_DATA */
+    5924, /* ERROR_DEPENDENT_RESOURCE_PROPERTY_CONFLICT */
+    5925, /* ERROR_CLUSTER_NO_QUORUM */
+    5926, /* ERROR_CLUSTER_INVALID_IPV6_NETWORK */
+    5927, /* ERROR_CLUSTER_INVALID_IPV6_TUNNEL_NETWORK */
+    5928, /* ERROR_QUORUM_NOT_ALLOWED_IN_THIS_GROUP */
+    5929, /* ERROR_DEPENDENCY_TREE_TOO_COMPLEX */
+    5930, /* ERROR_EXCEPTION_IN_RESOURCE_CALL */
+    5931, /* ERROR_CLUSTER_RHS_FAILED_INITIALIZATION */
+    5932, /* ERROR_CLUSTER_NOT_INSTALLED */
+    5933, /* ERROR_CLUSTER_RESOURCES_MUST_BE_ONLINE_ON_THE_SAME_NODE */
+    5934, /* ERROR_CLUSTER_MAX_NODES_IN_CLUSTER */
+    5935, /* ERROR_CLUSTER_TOO_MANY_NODES */
+    5936, /* ERROR_CLUSTER_OBJECT_ALREADY_USED */
+    5937, /* ERROR_NONCORE_GROUPS_FOUND */
+    5938, /* ERROR_FILE_SHARE_RESOURCE_CONFLICT */
+    5939, /* ERROR_CLUSTER_EVICT_INVALID_REQUEST */
+    5940, /* ERROR_CLUSTER_SINGLETON_RESOURCE */
+    5941, /* ERROR_CLUSTER_GROUP_SINGLETON_RESOURCE */
+    5942, /* ERROR_CLUSTER_RESOURCE_PROVIDER_FAILED */
+    5943, /* ERROR_CLUSTER_RESOURCE_CONFIGURATION_ERROR */
+    5944, /* ERROR_CLUSTER_GROUP_BUSY */
+    5945, /* ERROR_CLUSTER_NOT_SHARED_VOLUME */
+    5946, /* ERROR_CLUSTER_INVALID_SECURITY_DESCRIPTOR */
+    5947, /* ERROR_CLUSTER_SHARED_VOLUMES_IN_USE */
+    5948, /* ERROR_CLUSTER_USE_SHARED_VOLUMES_API */
+    5949, /* ERROR_CLUSTER_BACKUP_IN_PROGRESS */
+    5950, /* ERROR_NON_CSV_PATH */
+    5951, /* ERROR_CSV_VOLUME_NOT_LOCAL */
+    5952, /* ERROR_CLUSTER_WATCHDOG_TERMINATING */
+    5953, /* ERROR_CLUSTER_RESOURCE_VETOED_MOVE_INCOMPATIBLE_NODES */
+    5954, /* ERROR_CLUSTER_INVALID_NODE_WEIGHT */
+    5955, /* ERROR_CLUSTER_RESOURCE_VETOED_CALL */
+    5956, /* ERROR_RESMON_SYSTEM_RESOURCES_LACKING */
+    5957, /* ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_DESTINATION */
+    5958, /* ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_SOURCE */
+    5959, /* ERROR_CLUSTER_GROUP_QUEUED */
+    5960, /* ERROR_CLUSTER_RESOURCE_LOCKED_STATUS */
+    5961, /* ERROR_CLUSTER_SHARED_VOLUME_FAILOVER_NOT_ALLOWED */
+    5962, /* ERROR_CLUSTER_NODE_DRAIN_IN_PROGRESS */
+    5963, /* ERROR_CLUSTER_DISK_NOT_CONNECTED */
+    5964, /* ERROR_DISK_NOT_CSV_CAPABLE */
+    5965, /* ERROR_RESOURCE_NOT_IN_AVAILABLE_STORAGE */
+    5966, /* ERROR_CLUSTER_SHARED_VOLUME_REDIRECTED */
+    5967, /* ERROR_CLUSTER_SHARED_VOLUME_NOT_REDIRECTED */
+    5968, /* ERROR_CLUSTER_CANNOT_RETURN_PROPERTIES */
+    5969, /* ERROR_CLUSTER_RESOURCE_CONTAINS_UNSUPPORTED_DIFF_AREA_FOR_SHARED_VOLUMES */
+    5970, /* ERROR_CLUSTER_RESOURCE_IS_IN_MAINTENANCE_MODE */
+    5971, /* ERROR_CLUSTER_AFFINITY_CONFLICT */
+    5972, /* ERROR_CLUSTER_RESOURCE_IS_REPLICA_VIRTUAL_MACHINE */
+    5973, /* ERROR_CLUSTER_UPGRADE_INCOMPATIBLE_VERSIONS */
+    5974, /* ERROR_CLUSTER_UPGRADE_FIX_QUORUM_NOT_SUPPORTED */
+    5975, /* ERROR_CLUSTER_UPGRADE_RESTART_REQUIRED */
+    5976, /* ERROR_CLUSTER_UPGRADE_IN_PROGRESS */
+    5977, /* ERROR_CLUSTER_UPGRADE_INCOMPLETE */
+    5978, /* ERROR_CLUSTER_NODE_IN_GRACE_PERIOD */
+    5979, /* ERROR_CLUSTER_CSV_IO_PAUSE_TIMEOUT */
+    5980, /* ERROR_NODE_NOT_ACTIVE_CLUSTER_MEMBER */
+    5981, /* ERROR_CLUSTER_RESOURCE_NOT_MONITORED */
+    5982, /* ERROR_CLUSTER_RESOURCE_DOES_NOT_SUPPORT_UNMONITORED */
+    5983, /* ERROR_CLUSTER_RESOURCE_IS_REPLICATED */
+    5984, /* ERROR_CLUSTER_NODE_ISOLATED */
+    5985, /* ERROR_CLUSTER_NODE_QUARANTINED */
+    5986, /* ERROR_CLUSTER_DATABASE_UPDATE_CONDITION_FAILED */
+    5987, /* ERROR_CLUSTER_SPACE_DEGRADED */
+    5988, /* ERROR_CLUSTER_TOKEN_DELEGATION_NOT_SUPPORTED */
+    5989, /* ERROR_CLUSTER_CSV_INVALID_HANDLE */
+    5990, /* ERROR_CLUSTER_CSV_SUPPORTED_ONLY_ON_COORDINATOR */
+    5991, /* ERROR_GROUPSET_NOT_AVAILABLE */
+    5992, /* ERROR_GROUPSET_NOT_FOUND */
+    5993, /* ERROR_GROUPSET_CANT_PROVIDE */
+    5994, /* ERROR_CLUSTER_FAULT_DOMAIN_PARENT_NOT_FOUND */
+    5995, /* ERROR_CLUSTER_FAULT_DOMAIN_INVALID_HIERARCHY */
+    5996, /* ERROR_CLUSTER_FAULT_DOMAIN_FAILED_S2D_VALIDATION */
+    5997, /* ERROR_CLUSTER_FAULT_DOMAIN_S2D_CONNECTIVITY_LOSS */
+    5998, /* ERROR_CLUSTER_INVALID_INFRASTRUCTURE_FILESERVER_NAME */
+    5999, /* ERROR_CLUSTERSET_MANAGEMENT_CLUSTER_UNREACHABLE */
+    6000, /* ERROR_ENCRYPTION_FAILED */
+    6001, /* ERROR_DECRYPTION_FAILED */
+    6002, /* ERROR_FILE_ENCRYPTED */
+    6003, /* ERROR_NO_RECOVERY_POLICY */
+    6004, /* ERROR_NO_EFS */
+    6005, /* ERROR_WRONG_EFS */
+    6006, /* ERROR_NO_USER_KEYS */
+    6007, /* ERROR_FILE_NOT_ENCRYPTED */
+    6008, /* ERROR_NOT_EXPORT_FORMAT */
+    6009, /* ERROR_FILE_READ_ONLY */
+    6010, /* ERROR_DIR_EFS_DISALLOWED */
+    6011, /* ERROR_EFS_SERVER_NOT_TRUSTED */
+    6012, /* ERROR_BAD_RECOVERY_POLICY */
+    6013, /* ERROR_EFS_ALG_BLOB_TOO_BIG */
+    6014, /* ERROR_VOLUME_NOT_SUPPORT_EFS */
+    6015, /* ERROR_EFS_DISABLED */
+    6016, /* ERROR_EFS_VERSION_NOT_SUPPORT */
+    6017, /* ERROR_CS_ENCRYPTION_INVALID_SERVER_RESPONSE */
+    6018, /* ERROR_CS_ENCRYPTION_UNSUPPORTED_SERVER */
+    6019, /* ERROR_CS_ENCRYPTION_EXISTING_ENCRYPTED_FILE */
+    6020, /* ERROR_CS_ENCRYPTION_NEW_ENCRYPTED_FILE */
+    6021, /* ERROR_CS_ENCRYPTION_FILE_NOT_CSE */
+    6022, /* ERROR_ENCRYPTION_POLICY_DENIES_OPERATION */
+    6023, /* ERROR_WIP_ENCRYPTION_FAILED */
+    6118, /* ERROR_NO_BROWSER_SERVERS_FOUND */
+    6250, /* ERROR_CLUSTER_OBJECT_IS_CLUSTER_SET_VM */
+    6600, /* ERROR_LOG_SECTOR_INVALID */
+    6601, /* ERROR_LOG_SECTOR_PARITY_INVALID */
+    6602, /* ERROR_LOG_SECTOR_REMAPPED */
+    6603, /* ERROR_LOG_BLOCK_INCOMPLETE */
+    6604, /* ERROR_LOG_INVALID_RANGE */
+    6605, /* ERROR_LOG_BLOCKS_EXHAUSTED */
+    6606, /* ERROR_LOG_READ_CONTEXT_INVALID */
+    6607, /* ERROR_LOG_RESTART_INVALID */
+    6608, /* ERROR_LOG_BLOCK_VERSION */
+    6609, /* ERROR_LOG_BLOCK_INVALID */
+    6610, /* ERROR_LOG_READ_MODE_INVALID */
+    6611, /* ERROR_LOG_NO_RESTART */
+    6612, /* ERROR_LOG_METADATA_CORRUPT */
+    6613, /* ERROR_LOG_METADATA_INVALID */
+    6614, /* ERROR_LOG_METADATA_INCONSISTENT */
+    6615, /* ERROR_LOG_RESERVATION_INVALID */
+    6616, /* ERROR_LOG_CANT_DELETE */
+    6617, /* ERROR_LOG_CONTAINER_LIMIT_EXCEEDED */
+    6618, /* ERROR_LOG_START_OF_LOG */
+    6619, /* ERROR_LOG_POLICY_ALREADY_INSTALLED */
+    6620, /* ERROR_LOG_POLICY_NOT_INSTALLED */
+    6621, /* ERROR_LOG_POLICY_INVALID */
+    6622, /* ERROR_LOG_POLICY_CONFLICT */
+    6623, /* ERROR_LOG_PINNED_ARCHIVE_TAIL */
+    6624, /* ERROR_LOG_RECORD_NONEXISTENT */
+    6625, /* ERROR_LOG_RECORDS_RESERVED_INVALID */
+    6626, /* ERROR_LOG_SPACE_RESERVED_INVALID */
+    6627, /* ERROR_LOG_TAIL_INVALID */
+    6628, /* ERROR_LOG_FULL */
+    6629, /* ERROR_COULD_NOT_RESIZE_LOG */
+    6630, /* ERROR_LOG_MULTIPLEXED */
+    6631, /* ERROR_LOG_DEDICATED */
+    6632, /* ERROR_LOG_ARCHIVE_NOT_IN_PROGRESS */
+    6633, /* ERROR_LOG_ARCHIVE_IN_PROGRESS */
+    6634, /* ERROR_LOG_EPHEMERAL */
+    6635, /* ERROR_LOG_NOT_ENOUGH_CONTAINERS */
+    6636, /* ERROR_LOG_CLIENT_ALREADY_REGISTERED */
+    6637, /* ERROR_LOG_CLIENT_NOT_REGISTERED */
+    6638, /* ERROR_LOG_FULL_HANDLER_IN_PROGRESS */
+    6639, /* ERROR_LOG_CONTAINER_READ_FAILED */
+    6640, /* ERROR_LOG_CONTAINER_WRITE_FAILED */
+    6641, /* ERROR_LOG_CONTAINER_OPEN_FAILED */
+    6642, /* ERROR_LOG_CONTAINER_STATE_INVALID */
+    6643, /* ERROR_LOG_STATE_INVALID */
+    6644, /* ERROR_LOG_PINNED */
+    6645, /* ERROR_LOG_METADATA_FLUSH_FAILED */
+    6646, /* ERROR_LOG_INCONSISTENT_SECURITY */
+    6647, /* ERROR_LOG_APPENDED_FLUSH_FAILED */
+    6648, /* ERROR_LOG_PINNED_RESERVATION */
+    6700, /* ERROR_INVALID_TRANSACTION */
+    6701, /* ERROR_TRANSACTION_NOT_ACTIVE */
+    6702, /* ERROR_TRANSACTION_REQUEST_NOT_VALID */
+    6703, /* ERROR_TRANSACTION_NOT_REQUESTED */
+    6704, /* ERROR_TRANSACTION_ALREADY_ABORTED */
+    6705, /* ERROR_TRANSACTION_ALREADY_COMMITTED */
+    6706, /* ERROR_TM_INITIALIZATION_FAILED */
+    6707, /* ERROR_RESOURCEMANAGER_READ_ONLY */
+    6708, /* ERROR_TRANSACTION_NOT_JOINED */
+    6709, /* ERROR_TRANSACTION_SUPERIOR_EXISTS */
+    6710, /* ERROR_CRM_PROTOCOL_ALREADY_EXISTS */
+    6711, /* ERROR_TRANSACTION_PROPAGATION_FAILED */
+    6712, /* ERROR_CRM_PROTOCOL_NOT_FOUND */
+    6713, /* ERROR_TRANSACTION_INVALID_MARSHALL_BUFFER */
+    6714, /* ERROR_CURRENT_TRANSACTION_NOT_VALID */
+    6715, /* ERROR_TRANSACTION_NOT_FOUND */
+    6716, /* ERROR_RESOURCEMANAGER_NOT_FOUND */
+    6717, /* ERROR_ENLISTMENT_NOT_FOUND */
+    6718, /* ERROR_TRANSACTIONMANAGER_NOT_FOUND */
+    6719, /* ERROR_TRANSACTIONMANAGER_NOT_ONLINE */
+    6720, /* ERROR_TRANSACTIONMANAGER_RECOVERY_NAME_COLLISION */
+    6721, /* ERROR_TRANSACTION_NOT_ROOT */
+    6722, /* ERROR_TRANSACTION_OBJECT_EXPIRED */
+    6723, /* ERROR_TRANSACTION_RESPONSE_NOT_ENLISTED */
+    6724, /* ERROR_TRANSACTION_RECORD_TOO_LONG */
+    6725, /* ERROR_IMPLICIT_TRANSACTION_NOT_SUPPORTED */
+    6726, /* ERROR_TRANSACTION_INTEGRITY_VIOLATED */
+    6727, /* ERROR_TRANSACTIONMANAGER_IDENTITY_MISMATCH */
+    6728, /* ERROR_RM_CANNOT_BE_FROZEN_FOR_SNAPSHOT */
+    6729, /* ERROR_TRANSACTION_MUST_WRITETHROUGH */
+    6730, /* ERROR_TRANSACTION_NO_SUPERIOR */
+    6731, /* ERROR_HEURISTIC_DAMAGE_POSSIBLE */
+    6800, /* ERROR_TRANSACTIONAL_CONFLICT */
+    6801, /* ERROR_RM_NOT_ACTIVE */
+    6802, /* ERROR_RM_METADATA_CORRUPT */
+    6803, /* ERROR_DIRECTORY_NOT_RM */
+    6805, /* ERROR_TRANSACTIONS_UNSUPPORTED_REMOTE */
+    6806, /* ERROR_LOG_RESIZE_INVALID_SIZE */
+    6807, /* ERROR_OBJECT_NO_LONGER_EXISTS */
+    6808, /* ERROR_STREAM_MINIVERSION_NOT_FOUND */
+    6809, /* ERROR_STREAM_MINIVERSION_NOT_VALID */
+    6810, /* ERROR_MINIVERSION_INACCESSIBLE_FROM_SPECIFIED_TRANSACTION */
+    6811, /* ERROR_CANT_OPEN_MINIVERSION_WITH_MODIFY_INTENT */
+    6812, /* ERROR_CANT_CREATE_MORE_STREAM_MINIVERSIONS */
+    6814, /* ERROR_REMOTE_FILE_VERSION_MISMATCH */
+    6815, /* ERROR_HANDLE_NO_LONGER_VALID */
+    6816, /* ERROR_NO_TXF_METADATA */
+    6817, /* ERROR_LOG_CORRUPTION_DETECTED */
+    6818, /* ERROR_CANT_RECOVER_WITH_HANDLE_OPEN */
+    6819, /* ERROR_RM_DISCONNECTED */
+    6820, /* ERROR_ENLISTMENT_NOT_SUPERIOR */
+    6821, /* ERROR_RECOVERY_NOT_NEEDED */
+    6822, /* ERROR_RM_ALREADY_STARTED */
+    6823, /* ERROR_FILE_IDENTITY_NOT_PERSISTENT */
+    6824, /* ERROR_CANT_BREAK_TRANSACTIONAL_DEPENDENCY */
+    6825, /* ERROR_CANT_CROSS_RM_BOUNDARY */
+    6826, /* ERROR_TXF_DIR_NOT_EMPTY */
+    6827, /* ERROR_INDOUBT_TRANSACTIONS_EXIST */
+    6828, /* ERROR_TM_VOLATILE */
+    6829, /* ERROR_ROLLBACK_TIMER_EXPIRED */
+    6830, /* ERROR_TXF_ATTRIBUTE_CORRUPT */
+    6831, /* ERROR_EFS_NOT_ALLOWED_IN_TRANSACTION */
+    6832, /* ERROR_TRANSACTIONAL_OPEN_NOT_ALLOWED */
+    6833, /* ERROR_LOG_GROWTH_FAILED */
+    6834, /* ERROR_TRANSACTED_MAPPING_UNSUPPORTED_REMOTE */
+    6835, /* ERROR_TXF_METADATA_ALREADY_PRESENT */
+    6836, /* ERROR_TRANSACTION_SCOPE_CALLBACKS_NOT_SET */
+    6837, /* ERROR_TRANSACTION_REQUIRED_PROMOTION */
+    6838, /* ERROR_CANNOT_EXECUTE_FILE_IN_TRANSACTION */
+    6839, /* ERROR_TRANSACTIONS_NOT_FROZEN */
+    6840, /* ERROR_TRANSACTION_FREEZE_IN_PROGRESS */
+    6841, /* ERROR_NOT_SNAPSHOT_VOLUME */
+    6842, /* ERROR_NO_SAVEPOINT_WITH_OPEN_FILES */
+    6843, /* ERROR_DATA_LOST_REPAIR */
+    6844, /* ERROR_SPARSE_NOT_ALLOWED_IN_TRANSACTION */
+    6845, /* ERROR_TM_IDENTITY_MISMATCH */
+    6846, /* ERROR_FLOATED_SECTION */
+    6847, /* ERROR_CANNOT_ACCEPT_TRANSACTED_WORK */
+    6848, /* ERROR_CANNOT_ABORT_TRANSACTIONS */
+    6849, /* ERROR_BAD_CLUSTERS */
+    6850, /* ERROR_COMPRESSION_NOT_ALLOWED_IN_TRANSACTION */
+    6851, /* ERROR_VOLUME_DIRTY */
+    6852, /* ERROR_NO_LINK_TRACKING_IN_TRANSACTION */
+    6853, /* ERROR_OPERATION_NOT_SUPPORTED_IN_TRANSACTION */
+    6854, /* ERROR_EXPIRED_HANDLE */
+    6855, /* ERROR_TRANSACTION_NOT_ENLISTED */
+    7001, /* ERROR_CTX_WINSTATION_NAME_INVALID */
+    7002, /* ERROR_CTX_INVALID_PD */
+    7003, /* ERROR_CTX_PD_NOT_FOUND */
+    7004, /* ERROR_CTX_WD_NOT_FOUND */
+    7005, /* ERROR_CTX_CANNOT_MAKE_EVENTLOG_ENTRY */
+    7006, /* ERROR_CTX_SERVICE_NAME_COLLISION */
+    7007, /* ERROR_CTX_CLOSE_PENDING */
+    7008, /* ERROR_CTX_NO_OUTBUF */
+    7009, /* ERROR_CTX_MODEM_INF_NOT_FOUND */
+    7010, /* ERROR_CTX_INVALID_MODEMNAME */
+    7011, /* ERROR_CTX_MODEM_RESPONSE_ERROR */
+    7012, /* ERROR_CTX_MODEM_RESPONSE_TIMEOUT */
+    7013, /* ERROR_CTX_MODEM_RESPONSE_NO_CARRIER */
+    7014, /* ERROR_CTX_MODEM_RESPONSE_NO_DIALTONE */
+    7015, /* ERROR_CTX_MODEM_RESPONSE_BUSY */
+    7016, /* ERROR_CTX_MODEM_RESPONSE_VOICE */
+    7017, /* ERROR_CTX_TD_ERROR */
+    7022, /* ERROR_CTX_WINSTATION_NOT_FOUND */
+    7023, /* ERROR_CTX_WINSTATION_ALREADY_EXISTS */
+    7024, /* ERROR_CTX_WINSTATION_BUSY */
+    7025, /* ERROR_CTX_BAD_VIDEO_MODE */
+    7035, /* ERROR_CTX_GRAPHICS_INVALID */
+    7037, /* ERROR_CTX_LOGON_DISABLED */
+    7038, /* ERROR_CTX_NOT_CONSOLE */
+    7040, /* ERROR_CTX_CLIENT_QUERY_TIMEOUT */
+    7041, /* ERROR_CTX_CONSOLE_DISCONNECT */
+    7042, /* ERROR_CTX_CONSOLE_CONNECT */
+    7044, /* ERROR_CTX_SHADOW_DENIED */
+    7045, /* ERROR_CTX_WINSTATION_ACCESS_DENIED */
+    7049, /* ERROR_CTX_INVALID_WD */
+    7050, /* ERROR_CTX_SHADOW_INVALID */
+    7051, /* ERROR_CTX_SHADOW_DISABLED */
+    7052, /* ERROR_CTX_CLIENT_LICENSE_IN_USE */
+    7053, /* ERROR_CTX_CLIENT_LICENSE_NOT_SET */
+    7054, /* ERROR_CTX_LICENSE_NOT_AVAILABLE */
+    7055, /* ERROR_CTX_LICENSE_CLIENT_INVALID */
+    7056, /* ERROR_CTX_LICENSE_EXPIRED */
+    7057, /* ERROR_CTX_SHADOW_NOT_RUNNING */
+    7058, /* ERROR_CTX_SHADOW_ENDED_BY_MODE_CHANGE */
+    7059, /* ERROR_ACTIVATION_COUNT_EXCEEDED */
+    7060, /* ERROR_CTX_WINSTATIONS_DISABLED */
+    7061, /* ERROR_CTX_ENCRYPTION_LEVEL_REQUIRED */
+    7062, /* ERROR_CTX_SESSION_IN_USE */
+    7063, /* ERROR_CTX_NO_FORCE_LOGOFF */
+    7064, /* ERROR_CTX_ACCOUNT_RESTRICTION */
+    7065, /* ERROR_RDP_PROTOCOL_ERROR */
+    7066, /* ERROR_CTX_CDM_CONNECT */
+    7067, /* ERROR_CTX_CDM_DISCONNECT */
+    7068, /* ERROR_CTX_SECURITY_LAYER_ERROR */
+    7069, /* ERROR_TS_INCOMPATIBLE_SESSIONS */
+    7070, /* ERROR_TS_VIDEO_SUBSYSTEM_ERROR */
+    8200, /* ERROR_DS_NOT_INSTALLED */
+    8201, /* ERROR_DS_MEMBERSHIP_EVALUATED_LOCALLY */
+    8202, /* ERROR_DS_NO_ATTRIBUTE_OR_VALUE */
+    8203, /* ERROR_DS_INVALID_ATTRIBUTE_SYNTAX */
+    8204, /* ERROR_DS_ATTRIBUTE_TYPE_UNDEFINED */
+    8205, /* ERROR_DS_ATTRIBUTE_OR_VALUE_EXISTS */
+    8206, /* ERROR_DS_BUSY */
+    8207, /* ERROR_DS_UNAVAILABLE */
+    8208, /* ERROR_DS_NO_RIDS_ALLOCATED */
+    8209, /* ERROR_DS_NO_MORE_RIDS */
+    8210, /* ERROR_DS_INCORRECT_ROLE_OWNER */
+    8211, /* ERROR_DS_RIDMGR_INIT_ERROR */
+    8212, /* ERROR_DS_OBJ_CLASS_VIOLATION */
+    8213, /* ERROR_DS_CANT_ON_NON_LEAF */
+    8214, /* ERROR_DS_CANT_ON_RDN */
+    8215, /* ERROR_DS_CANT_MOD_OBJ_CLASS */
+    8216, /* ERROR_DS_CROSS_DOM_MOVE_ERROR */
+    8217, /* ERROR_DS_GC_NOT_AVAILABLE */
+    8218, /* ERROR_SHARED_POLICY */
+    8219, /* ERROR_POLICY_OBJECT_NOT_FOUND */
+    8220, /* ERROR_POLICY_ONLY_IN_DS */
+    8221, /* ERROR_PROMOTION_ACTIVE */
+    8222, /* ERROR_NO_PROMOTION_ACTIVE */
+    8224, /* ERROR_DS_OPERATIONS_ERROR */
+    8225, /* ERROR_DS_PROTOCOL_ERROR */
+    8226, /* ERROR_DS_TIMELIMIT_EXCEEDED */
+    8227, /* ERROR_DS_SIZELIMIT_EXCEEDED */
+    8228, /* ERROR_DS_ADMIN_LIMIT_EXCEEDED */
+    8229, /* ERROR_DS_COMPARE_FALSE */
+    8230, /* ERROR_DS_COMPARE_TRUE */
+    8231, /* ERROR_DS_AUTH_METHOD_NOT_SUPPORTED */
+    8232, /* ERROR_DS_STRONG_AUTH_REQUIRED */
+    8233, /* ERROR_DS_INAPPROPRIATE_AUTH */
+    8234, /* ERROR_DS_AUTH_UNKNOWN */
+    8235, /* ERROR_DS_REFERRAL */
+    8236, /* ERROR_DS_UNAVAILABLE_CRIT_EXTENSION */
+    8237, /* ERROR_DS_CONFIDENTIALITY_REQUIRED */
+    8238, /* ERROR_DS_INAPPROPRIATE_MATCHING */
+    8239, /* ERROR_DS_CONSTRAINT_VIOLATION */
+    8240, /* ERROR_DS_NO_SUCH_OBJECT */
+    8241, /* ERROR_DS_ALIAS_PROBLEM */
+    8242, /* ERROR_DS_INVALID_DN_SYNTAX */
+    8243, /* ERROR_DS_IS_LEAF */
+    8244, /* ERROR_DS_ALIAS_DEREF_PROBLEM */
+    8245, /* ERROR_DS_UNWILLING_TO_PERFORM */
+    8246, /* ERROR_DS_LOOP_DETECT */
+    8247, /* ERROR_DS_NAMING_VIOLATION */
+    8248, /* ERROR_DS_OBJECT_RESULTS_TOO_LARGE */
+    8249, /* ERROR_DS_AFFECTS_MULTIPLE_DSAS */
+    8250, /* ERROR_DS_SERVER_DOWN */
+    8251, /* ERROR_DS_LOCAL_ERROR */
+    8252, /* ERROR_DS_ENCODING_ERROR */
+    8253, /* ERROR_DS_DECODING_ERROR */
+    8254, /* ERROR_DS_FILTER_UNKNOWN */
+    8255, /* ERROR_DS_PARAM_ERROR */
+    8256, /* ERROR_DS_NOT_SUPPORTED */
+    8257, /* ERROR_DS_NO_RESULTS_RETURNED */
+    8258, /* ERROR_DS_CONTROL_NOT_FOUND */
+    8259, /* ERROR_DS_CLIENT_LOOP */
+    8260, /* ERROR_DS_REFERRAL_LIMIT_EXCEEDED */
+    8261, /* ERROR_DS_SORT_CONTROL_MISSING */
+    8262, /* ERROR_DS_OFFSET_RANGE_ERROR */
+    8263, /* ERROR_DS_RIDMGR_DISABLED */
+    8301, /* ERROR_DS_ROOT_MUST_BE_NC */
+    8302, /* ERROR_DS_ADD_REPLICA_INHIBITED */
+    8303, /* ERROR_DS_ATT_NOT_DEF_IN_SCHEMA */
+    8304, /* ERROR_DS_MAX_OBJ_SIZE_EXCEEDED */
+    8305, /* ERROR_DS_OBJ_STRING_NAME_EXISTS */
+    8306, /* ERROR_DS_NO_RDN_DEFINED_IN_SCHEMA */
+    8307, /* ERROR_DS_RDN_DOESNT_MATCH_SCHEMA */
+    8308, /* ERROR_DS_NO_REQUESTED_ATTS_FOUND */
+    8309, /* ERROR_DS_USER_BUFFER_TO_SMALL */
+    8310, /* ERROR_DS_ATT_IS_NOT_ON_OBJ */
+    8311, /* ERROR_DS_ILLEGAL_MOD_OPERATION */
+    8312, /* ERROR_DS_OBJ_TOO_LARGE */
+    8313, /* ERROR_DS_BAD_INSTANCE_TYPE */
+    8314, /* ERROR_DS_MASTERDSA_REQUIRED */
+    8315, /* ERROR_DS_OBJECT_CLASS_REQUIRED */
+    8316, /* ERROR_DS_MISSING_REQUIRED_ATT */
+    8317, /* ERROR_DS_ATT_NOT_DEF_FOR_CLASS */
+    8318, /* ERROR_DS_ATT_ALREADY_EXISTS */
+    8320, /* ERROR_DS_CANT_ADD_ATT_VALUES */
+    8321, /* ERROR_DS_SINGLE_VALUE_CONSTRAINT */
+    8322, /* ERROR_DS_RANGE_CONSTRAINT */
+    8323, /* ERROR_DS_ATT_VAL_ALREADY_EXISTS */
+    8324, /* ERROR_DS_CANT_REM_MISSING_ATT */
+    8325, /* ERROR_DS_CANT_REM_MISSING_ATT_VAL */
+    8326, /* ERROR_DS_ROOT_CANT_BE_SUBREF */
+    8327, /* ERROR_DS_NO_CHAINING */
+    8328, /* ERROR_DS_NO_CHAINED_EVAL */
+    8329, /* ERROR_DS_NO_PARENT_OBJECT */
+    8330, /* ERROR_DS_PARENT_IS_AN_ALIAS */
+    8331, /* ERROR_DS_CANT_MIX_MASTER_AND_REPS */
+    8332, /* ERROR_DS_CHILDREN_EXIST */
+    8333, /* ERROR_DS_OBJ_NOT_FOUND */
+    8334, /* ERROR_DS_ALIASED_OBJ_MISSING */
+    8335, /* ERROR_DS_BAD_NAME_SYNTAX */
+    8336, /* ERROR_DS_ALIAS_POINTS_TO_ALIAS */
+    8337, /* ERROR_DS_CANT_DEREF_ALIAS */
+    8338, /* ERROR_DS_OUT_OF_SCOPE */
+    8339, /* ERROR_DS_OBJECT_BEING_REMOVED */
+    8340, /* ERROR_DS_CANT_DELETE_DSA_OBJ */
+    8341, /* ERROR_DS_GENERIC_ERROR */
+    8342, /* ERROR_DS_DSA_MUST_BE_INT_MASTER */
+    8343, /* ERROR_DS_CLASS_NOT_DSA */
+    8344, /* ERROR_DS_INSUFF_ACCESS_RIGHTS */
+    8345, /* ERROR_DS_ILLEGAL_SUPERIOR */
+    8346, /* ERROR_DS_ATTRIBUTE_OWNED_BY_SAM */
+    8347, /* ERROR_DS_NAME_TOO_MANY_PARTS */
+    8348, /* ERROR_DS_NAME_TOO_LONG */
+    8349, /* ERROR_DS_NAME_VALUE_TOO_LONG */
+    8350, /* ERROR_DS_NAME_UNPARSEABLE */
+    8351, /* ERROR_DS_NAME_TYPE_UNKNOWN */
+    8352, /* ERROR_DS_NOT_AN_OBJECT */
+    8353, /* ERROR_DS_SEC_DESC_TOO_SHORT */
+    8354, /* ERROR_DS_SEC_DESC_INVALID */
+    8355, /* ERROR_DS_NO_DELETED_NAME */
+    8356, /* ERROR_DS_SUBREF_MUST_HAVE_PARENT */
+    8357, /* ERROR_DS_NCNAME_MUST_BE_NC */
+    8358, /* ERROR_DS_CANT_ADD_SYSTEM_ONLY */
+    8359, /* ERROR_DS_CLASS_MUST_BE_CONCRETE */
+    8360, /* ERROR_DS_INVALID_DMD */
+    8361, /* ERROR_DS_OBJ_GUID_EXISTS */
+    8362, /* ERROR_DS_NOT_ON_BACKLINK */
+    8363, /* ERROR_DS_NO_CROSSREF_FOR_NC */
+    8364, /* ERROR_DS_SHUTTING_DOWN */
+    8365, /* ERROR_DS_UNKNOWN_OPERATION */
+    8366, /* ERROR_DS_INVALID_ROLE_OWNER */
+    8367, /* ERROR_DS_COULDNT_CONTACT_FSMO */
+    8368, /* ERROR_DS_CROSS_NC_DN_RENAME */
+    8369, /* ERROR_DS_CANT_MOD_SYSTEM_ONLY */
+    8370, /* ERROR_DS_REPLICATOR_ONLY */
+    8371, /* ERROR_DS_OBJ_CLASS_NOT_DEFINED */
+    8372, /* ERROR_DS_OBJ_CLASS_NOT_SUBCLASS */
+    8373, /* ERROR_DS_NAME_REFERENCE_INVALID */
+    8374, /* ERROR_DS_CROSS_REF_EXISTS */
+    8375, /* ERROR_DS_CANT_DEL_MASTER_CROSSREF */
+    8376, /* ERROR_DS_SUBTREE_NOTIFY_NOT_NC_HEAD */
+    8377, /* ERROR_DS_NOTIFY_FILTER_TOO_COMPLEX */
+    8378, /* ERROR_DS_DUP_RDN */
+    8379, /* ERROR_DS_DUP_OID */
+    8380, /* ERROR_DS_DUP_MAPI_ID */
+    8381, /* ERROR_DS_DUP_SCHEMA_ID_GUID */
+    8382, /* ERROR_DS_DUP_LDAP_DISPLAY_NAME */
+    8383, /* ERROR_DS_SEMANTIC_ATT_TEST */
+    8384, /* ERROR_DS_SYNTAX_MISMATCH */
+    8385, /* ERROR_DS_EXISTS_IN_MUST_HAVE */
+    8386, /* ERROR_DS_EXISTS_IN_MAY_HAVE */
+    8387, /* ERROR_DS_NONEXISTENT_MAY_HAVE */
+    8388, /* ERROR_DS_NONEXISTENT_MUST_HAVE */
+    8389, /* ERROR_DS_AUX_CLS_TEST_FAIL */
+    8390, /* ERROR_DS_NONEXISTENT_POSS_SUP */
+    8391, /* ERROR_DS_SUB_CLS_TEST_FAIL */
+    8392, /* ERROR_DS_BAD_RDN_ATT_ID_SYNTAX */
+    8393, /* ERROR_DS_EXISTS_IN_AUX_CLS */
+    8394, /* ERROR_DS_EXISTS_IN_SUB_CLS */
+    8395, /* ERROR_DS_EXISTS_IN_POSS_SUP */
+    8396, /* ERROR_DS_RECALCSCHEMA_FAILED */
+    8397, /* ERROR_DS_TREE_DELETE_NOT_FINISHED */
+    8398, /* ERROR_DS_CANT_DELETE */
+    8399, /* ERROR_DS_ATT_SCHEMA_REQ_ID */
+    8400, /* ERROR_DS_BAD_ATT_SCHEMA_SYNTAX */
+    8401, /* ERROR_DS_CANT_CACHE_ATT */
+    8402, /* ERROR_DS_CANT_CACHE_CLASS */
+    8403, /* ERROR_DS_CANT_REMOVE_ATT_CACHE */
+    8404, /* ERROR_DS_CANT_REMOVE_CLASS_CACHE */
+    8405, /* ERROR_DS_CANT_RETRIEVE_DN */
+    8406, /* ERROR_DS_MISSING_SUPREF */
+    8407, /* ERROR_DS_CANT_RETRIEVE_INSTANCE */
+    8408, /* ERROR_DS_CODE_INCONSISTENCY */
+    8409, /* ERROR_DS_DATABASE_ERROR */
+    8410, /* ERROR_DS_GOVERNSID_MISSING */
+    8411, /* ERROR_DS_MISSING_EXPECTED_ATT */
+    8412, /* ERROR_DS_NCNAME_MISSING_CR_REF */
+    8413, /* ERROR_DS_SECURITY_CHECKING_ERROR */
+    8414, /* ERROR_DS_SCHEMA_NOT_LOADED */
+    8415, /* ERROR_DS_SCHEMA_ALLOC_FAILED */
+    8416, /* ERROR_DS_ATT_SCHEMA_REQ_SYNTAX */
+    8417, /* ERROR_DS_GCVERIFY_ERROR */
+    8418, /* ERROR_DS_DRA_SCHEMA_MISMATCH */
+    8419, /* ERROR_DS_CANT_FIND_DSA_OBJ */
+    8420, /* ERROR_DS_CANT_FIND_EXPECTED_NC */
+    8421, /* ERROR_DS_CANT_FIND_NC_IN_CACHE */
+    8422, /* ERROR_DS_CANT_RETRIEVE_CHILD */
+    8423, /* ERROR_DS_SECURITY_ILLEGAL_MODIFY */
+    8424, /* ERROR_DS_CANT_REPLACE_HIDDEN_REC */
+    8425, /* ERROR_DS_BAD_HIERARCHY_FILE */
+    8426, /* ERROR_DS_BUILD_HIERARCHY_TABLE_FAILED */
+    8427, /* ERROR_DS_CONFIG_PARAM_MISSING */
+    8428, /* ERROR_DS_COUNTING_AB_INDICES_FAILED */
+    8429, /* ERROR_DS_HIERARCHY_TABLE_MALLOC_FAILED */
+    8430, /* ERROR_DS_INTERNAL_FAILURE */
+    8431, /* ERROR_DS_UNKNOWN_ERROR */
+    8432, /* ERROR_DS_ROOT_REQUIRES_CLASS_TOP */
+    8433, /* ERROR_DS_REFUSING_FSMO_ROLES */
+    8434, /* ERROR_DS_MISSING_FSMO_SETTINGS */
+    8435, /* ERROR_DS_UNABLE_TO_SURRENDER_ROLES */
+    8436, /* ERROR_DS_DRA_GENERIC */
+    8437, /* ERROR_DS_DRA_INVALID_PARAMETER */
+    8438, /* ERROR_DS_DRA_BUSY */
+    8439, /* ERROR_DS_DRA_BAD_DN */
+    8440, /* ERROR_DS_DRA_BAD_NC */
+    8441, /* ERROR_DS_DRA_DN_EXISTS */
+    8442, /* ERROR_DS_DRA_INTERNAL_ERROR */
+    8443, /* ERROR_DS_DRA_INCONSISTENT_DIT */
+    8444, /* ERROR_DS_DRA_CONNECTION_FAILED */
+    8445, /* ERROR_DS_DRA_BAD_INSTANCE_TYPE */
+    8446, /* ERROR_DS_DRA_OUT_OF_MEM */
+    8447, /* ERROR_DS_DRA_MAIL_PROBLEM */
+    8448, /* ERROR_DS_DRA_REF_ALREADY_EXISTS */
+    8449, /* ERROR_DS_DRA_REF_NOT_FOUND */
+    8450, /* ERROR_DS_DRA_OBJ_IS_REP_SOURCE */
+    8451, /* ERROR_DS_DRA_DB_ERROR */
+    8452, /* ERROR_DS_DRA_NO_REPLICA */
+    8453, /* ERROR_DS_DRA_ACCESS_DENIED */
+    8454, /* ERROR_DS_DRA_NOT_SUPPORTED */
+    8455, /* ERROR_DS_DRA_RPC_CANCELLED */
+    8456, /* ERROR_DS_DRA_SOURCE_DISABLED */
+    8457, /* ERROR_DS_DRA_SINK_DISABLED */
+    8458, /* ERROR_DS_DRA_NAME_COLLISION */
+    8459, /* ERROR_DS_DRA_SOURCE_REINSTALLED */
+    8460, /* ERROR_DS_DRA_MISSING_PARENT */
+    8461, /* ERROR_DS_DRA_PREEMPTED */
+    8462, /* ERROR_DS_DRA_ABANDON_SYNC */
+    8463, /* ERROR_DS_DRA_SHUTDOWN */
+    8464, /* ERROR_DS_DRA_INCOMPATIBLE_PARTIAL_SET */
+    8465, /* ERROR_DS_DRA_SOURCE_IS_PARTIAL_REPLICA */
+    8466, /* ERROR_DS_DRA_EXTN_CONNECTION_FAILED */
+    8467, /* ERROR_DS_INSTALL_SCHEMA_MISMATCH */
+    8468, /* ERROR_DS_DUP_LINK_ID */
+    8469, /* ERROR_DS_NAME_ERROR_RESOLVING */
+    8470, /* ERROR_DS_NAME_ERROR_NOT_FOUND */
+    8471, /* ERROR_DS_NAME_ERROR_NOT_UNIQUE */
+    8472, /* ERROR_DS_NAME_ERROR_NO_MAPPING */
+    8473, /* ERROR_DS_NAME_ERROR_DOMAIN_ONLY */
+    8474, /* ERROR_DS_NAME_ERROR_NO_SYNTACTICAL_MAPPING */
+    8475, /* ERROR_DS_CONSTRUCTED_ATT_MOD */
+    8476, /* ERROR_DS_WRONG_OM_OBJ_CLASS */
+    8477, /* ERROR_DS_DRA_REPL_PENDING */
+    8478, /* ERROR_DS_DS_REQUIRED */
+    8479, /* ERROR_DS_INVALID_LDAP_DISPLAY_NAME */
+    8480, /* ERROR_DS_NON_BASE_SEARCH */
+    8481, /* ERROR_DS_CANT_RETRIEVE_ATTS */
+    8482, /* ERROR_DS_BACKLINK_WITHOUT_LINK */
+    8483, /* ERROR_DS_EPOCH_MISMATCH */
+    8484, /* ERROR_DS_SRC_NAME_MISMATCH */
+    8485, /* ERROR_DS_SRC_AND_DST_NC_IDENTICAL */
+    8486, /* ERROR_DS_DST_NC_MISMATCH */
+    8487, /* ERROR_DS_NOT_AUTHORITIVE_FOR_DST_NC */
+    8488, /* ERROR_DS_SRC_GUID_MISMATCH */
+    8489, /* ERROR_DS_CANT_MOVE_DELETED_OBJECT */
+    8490, /* ERROR_DS_PDC_OPERATION_IN_PROGRESS */
+    8491, /* ERROR_DS_CROSS_DOMAIN_CLEANUP_REQD */
+    8492, /* ERROR_DS_ILLEGAL_XDOM_MOVE_OPERATION */
+    8493, /* ERROR_DS_CANT_WITH_ACCT_GROUP_MEMBERSHPS */
+    8494, /* ERROR_DS_NC_MUST_HAVE_NC_PARENT */
+    8495, /* ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE */
+    8496, /* ERROR_DS_DST_DOMAIN_NOT_NATIVE */
+    8497, /* ERROR_DS_MISSING_INFRASTRUCTURE_CONTAINER */
+    8498, /* ERROR_DS_CANT_MOVE_ACCOUNT_GROUP */
+    8499, /* ERROR_DS_CANT_MOVE_RESOURCE_GROUP */
+    8500, /* ERROR_DS_INVALID_SEARCH_FLAG */
+    8501, /* ERROR_DS_NO_TREE_DELETE_ABOVE_NC */
+    8502, /* ERROR_DS_COULDNT_LOCK_TREE_FOR_DELETE */
+    8503, /* ERROR_DS_COULDNT_IDENTIFY_OBJECTS_FOR_TREE_DELETE */
+    8504, /* ERROR_DS_SAM_INIT_FAILURE */
+    8505, /* ERROR_DS_SENSITIVE_GROUP_VIOLATION */
+    8506, /* ERROR_DS_CANT_MOD_PRIMARYGROUPID */
+    8507, /* ERROR_DS_ILLEGAL_BASE_SCHEMA_MOD */
+    8508, /* ERROR_DS_NONSAFE_SCHEMA_CHANGE */
+    8509, /* ERROR_DS_SCHEMA_UPDATE_DISALLOWED */
+    8510, /* ERROR_DS_CANT_CREATE_UNDER_SCHEMA */
+    8511, /* ERROR_DS_INSTALL_NO_SRC_SCH_VERSION */
+    8512, /* ERROR_DS_INSTALL_NO_SCH_VERSION_IN_INIFILE */
+    8513, /* ERROR_DS_INVALID_GROUP_TYPE */
+    8514, /* ERROR_DS_NO_NEST_GLOBALGROUP_IN_MIXEDDOMAIN */
+    8515, /* ERROR_DS_NO_NEST_LOCALGROUP_IN_MIXEDDOMAIN */
+    8516, /* ERROR_DS_GLOBAL_CANT_HAVE_LOCAL_MEMBER */
+    8517, /* ERROR_DS_GLOBAL_CANT_HAVE_UNIVERSAL_MEMBER */
+    8518, /* ERROR_DS_UNIVERSAL_CANT_HAVE_LOCAL_MEMBER */
+    8519, /* ERROR_DS_GLOBAL_CANT_HAVE_CROSSDOMAIN_MEMBER */
+    8520, /* ERROR_DS_LOCAL_CANT_HAVE_CROSSDOMAIN_LOCAL_MEMBER */
+    8521, /* ERROR_DS_HAVE_PRIMARY_MEMBERS */
+    8522, /* ERROR_DS_STRING_SD_CONVERSION_FAILED */
+    8523, /* ERROR_DS_NAMING_MASTER_GC */
+    8524, /* ERROR_DS_DNS_LOOKUP_FAILURE */
+    8525, /* ERROR_DS_COULDNT_UPDATE_SPNS */
+    8526, /* ERROR_DS_CANT_RETRIEVE_SD */
+    8527, /* ERROR_DS_KEY_NOT_UNIQUE */
+    8528, /* ERROR_DS_WRONG_LINKED_ATT_SYNTAX */
+    8529, /* ERROR_DS_SAM_NEED_BOOTKEY_PASSWORD */
+    8530, /* ERROR_DS_SAM_NEED_BOOTKEY_FLOPPY */
+    8531, /* ERROR_DS_CANT_START */
+    8532, /* ERROR_DS_INIT_FAILURE */
+    8533, /* ERROR_DS_NO_PKT_PRIVACY_ON_CONNECTION */
+    8534, /* ERROR_DS_SOURCE_DOMAIN_IN_FOREST */
+    8535, /* ERROR_DS_DESTINATION_DOMAIN_NOT_IN_FOREST */
+    8536, /* ERROR_DS_DESTINATION_AUDITING_NOT_ENABLED */
+    8537, /* ERROR_DS_CANT_FIND_DC_FOR_SRC_DOMAIN */
+    8538, /* ERROR_DS_SRC_OBJ_NOT_GROUP_OR_USER */
+    8539, /* ERROR_DS_SRC_SID_EXISTS_IN_FOREST */
+    8540, /* ERROR_DS_SRC_AND_DST_OBJECT_CLASS_MISMATCH */
+    8541, /* ERROR_SAM_INIT_FAILURE */
+    8542, /* ERROR_DS_DRA_SCHEMA_INFO_SHIP */
+    8543, /* ERROR_DS_DRA_SCHEMA_CONFLICT */
+    8544, /* ERROR_DS_DRA_EARLIER_SCHEMA_CONFLICT */
+    8545, /* ERROR_DS_DRA_OBJ_NC_MISMATCH */
+    8546, /* ERROR_DS_NC_STILL_HAS_DSAS */
+    8547, /* ERROR_DS_GC_REQUIRED */
+    8548, /* ERROR_DS_LOCAL_MEMBER_OF_LOCAL_ONLY */
+    8549, /* ERROR_DS_NO_FPO_IN_UNIVERSAL_GROUPS */
+    8550, /* ERROR_DS_CANT_ADD_TO_GC */
+    8551, /* ERROR_DS_NO_CHECKPOINT_WITH_PDC */
+    8552, /* ERROR_DS_SOURCE_AUDITING_NOT_ENABLED */
+    8553, /* ERROR_DS_CANT_CREATE_IN_NONDOMAIN_NC */
+    8554, /* ERROR_DS_INVALID_NAME_FOR_SPN */
+    8555, /* ERROR_DS_FILTER_USES_CONTRUCTED_ATTRS */
+    8556, /* ERROR_DS_UNICODEPWD_NOT_IN_QUOTES */
+    8557, /* ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED */
+    8558, /* ERROR_DS_MUST_BE_RUN_ON_DST_DC */
+    8559, /* ERROR_DS_SRC_DC_MUST_BE_SP4_OR_GREATER */
+    8560, /* ERROR_DS_CANT_TREE_DELETE_CRITICAL_OBJ */
+    8561, /* ERROR_DS_INIT_FAILURE_CONSOLE */
+    8562, /* ERROR_DS_SAM_INIT_FAILURE_CONSOLE */
+    8563, /* ERROR_DS_FOREST_VERSION_TOO_HIGH */
+    8564, /* ERROR_DS_DOMAIN_VERSION_TOO_HIGH */
+    8565, /* ERROR_DS_FOREST_VERSION_TOO_LOW */
+    8566, /* ERROR_DS_DOMAIN_VERSION_TOO_LOW */
+    8567, /* ERROR_DS_INCOMPATIBLE_VERSION */
+    8568, /* ERROR_DS_LOW_DSA_VERSION */
+    8569, /* ERROR_DS_NO_BEHAVIOR_VERSION_IN_MIXEDDOMAIN */
+    8570, /* ERROR_DS_NOT_SUPPORTED_SORT_ORDER */
+    8571, /* ERROR_DS_NAME_NOT_UNIQUE */
+    8572, /* ERROR_DS_MACHINE_ACCOUNT_CREATED_PRENT4 */
+    8573, /* ERROR_DS_OUT_OF_VERSION_STORE */
+    8574, /* ERROR_DS_INCOMPATIBLE_CONTROLS_USED */
+    8575, /* ERROR_DS_NO_REF_DOMAIN */
+    8576, /* ERROR_DS_RESERVED_LINK_ID */
+    8577, /* ERROR_DS_LINK_ID_NOT_AVAILABLE */
+    8578, /* ERROR_DS_AG_CANT_HAVE_UNIVERSAL_MEMBER */
+    8579, /* ERROR_DS_MODIFYDN_DISALLOWED_BY_INSTANCE_TYPE */
+    8580, /* ERROR_DS_NO_OBJECT_MOVE_IN_SCHEMA_NC */
+    8581, /* ERROR_DS_MODIFYDN_DISALLOWED_BY_FLAG */
+    8582, /* ERROR_DS_MODIFYDN_WRONG_GRANDPARENT */
+    8583, /* ERROR_DS_NAME_ERROR_TRUST_REFERRAL */
+    8584, /* ERROR_NOT_SUPPORTED_ON_STANDARD_SERVER */
+    8585, /* ERROR_DS_CANT_ACCESS_REMOTE_PART_OF_AD */
+    8586, /* ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE_V2 */
+    8587, /* ERROR_DS_THREAD_LIMIT_EXCEEDED */
+    8588, /* ERROR_DS_NOT_CLOSEST */
+    8589, /* ERROR_DS_CANT_DERIVE_SPN_WITHOUT_SERVER_REF */
+    8590, /* ERROR_DS_SINGLE_USER_MODE_FAILED */
+    8591, /* ERROR_DS_NTDSCRIPT_SYNTAX_ERROR */
+    8592, /* ERROR_DS_NTDSCRIPT_PROCESS_ERROR */
+    8593, /* ERROR_DS_DIFFERENT_REPL_EPOCHS */
+    8594, /* ERROR_DS_DRS_EXTENSIONS_CHANGED */
+    8595, /* ERROR_DS_REPLICA_SET_CHANGE_NOT_ALLOWED_ON_DISABLED_CR */
+    8596, /* ERROR_DS_NO_MSDS_INTID */
+    8597, /* ERROR_DS_DUP_MSDS_INTID */
+    8598, /* ERROR_DS_EXISTS_IN_RDNATTID */
+    8599, /* ERROR_DS_AUTHORIZATION_FAILED */
+    8600, /* ERROR_DS_INVALID_SCRIPT */
+    8601, /* ERROR_DS_REMOTE_CROSSREF_OP_FAILED */
+    8602, /* ERROR_DS_CROSS_REF_BUSY */
+    8603, /* ERROR_DS_CANT_DERIVE_SPN_FOR_DELETED_DOMAIN */
+    8604, /* ERROR_DS_CANT_DEMOTE_WITH_WRITEABLE_NC */
+    8605, /* ERROR_DS_DUPLICATE_ID_FOUND */
+    8606, /* ERROR_DS_INSUFFICIENT_ATTR_TO_CREATE_OBJECT */
+    8607, /* ERROR_DS_GROUP_CONVERSION_ERROR */
+    8608, /* ERROR_DS_CANT_MOVE_APP_BASIC_GROUP */
+    8609, /* ERROR_DS_CANT_MOVE_APP_QUERY_GROUP */
+    8610, /* ERROR_DS_ROLE_NOT_VERIFIED */
+    8611, /* ERROR_DS_WKO_CONTAINER_CANNOT_BE_SPECIAL */
+    8612, /* ERROR_DS_DOMAIN_RENAME_IN_PROGRESS */
+    8613, /* ERROR_DS_EXISTING_AD_CHILD_NC */
+    8614, /* ERROR_DS_REPL_LIFETIME_EXCEEDED */
+    8615, /* ERROR_DS_DISALLOWED_IN_SYSTEM_CONTAINER */
+    8616, /* ERROR_DS_LDAP_SEND_QUEUE_FULL */
+    8617, /* ERROR_DS_DRA_OUT_SCHEDULE_WINDOW */
+    8618, /* ERROR_DS_POLICY_NOT_KNOWN */
+    8619, /* ERROR_NO_SITE_SETTINGS_OBJECT */
+    8620, /* ERROR_NO_SECRETS */
+    8621, /* ERROR_NO_WRITABLE_DC_FOUND */
+    8622, /* ERROR_DS_NO_SERVER_OBJECT */
+    8623, /* ERROR_DS_NO_NTDSA_OBJECT */
+    8624, /* ERROR_DS_NON_ASQ_SEARCH */
+    8625, /* ERROR_DS_AUDIT_FAILURE */
+    8626, /* ERROR_DS_INVALID_SEARCH_FLAG_SUBTREE */
+    8627, /* ERROR_DS_INVALID_SEARCH_FLAG_TUPLE */
+    8628, /* ERROR_DS_HIERARCHY_TABLE_TOO_DEEP */
+    8629, /* ERROR_DS_DRA_CORRUPT_UTD_VECTOR */
+    8630, /* ERROR_DS_DRA_SECRETS_DENIED */
+    8631, /* ERROR_DS_RESERVED_MAPI_ID */
+    8632, /* ERROR_DS_MAPI_ID_NOT_AVAILABLE */
+    8633, /* ERROR_DS_DRA_MISSING_KRBTGT_SECRET */
+    8634, /* ERROR_DS_DOMAIN_NAME_EXISTS_IN_FOREST */
+    8635, /* ERROR_DS_FLAT_NAME_EXISTS_IN_FOREST */
+    8636, /* ERROR_INVALID_USER_PRINCIPAL_NAME */
+    8637, /* ERROR_DS_OID_MAPPED_GROUP_CANT_HAVE_MEMBERS */
+    8638, /* ERROR_DS_OID_NOT_FOUND */
+    8639, /* ERROR_DS_DRA_RECYCLED_TARGET */
+    8640, /* ERROR_DS_DISALLOWED_NC_REDIRECT */
+    8641, /* ERROR_DS_HIGH_ADLDS_FFL */
+    8642, /* ERROR_DS_HIGH_DSA_VERSION */
+    8643, /* ERROR_DS_LOW_ADLDS_FFL */
+    8644, /* ERROR_DOMAIN_SID_SAME_AS_LOCAL_WORKSTATION */
+    8645, /* ERROR_DS_UNDELETE_SAM_VALIDATION_FAILED */
+    8646, /* ERROR_INCORRECT_ACCOUNT_TYPE */
+    8647, /* ERROR_DS_SPN_VALUE_NOT_UNIQUE_IN_FOREST */
+    8648, /* ERROR_DS_UPN_VALUE_NOT_UNIQUE_IN_FOREST */
+    8649, /* ERROR_DS_MISSING_FOREST_TRUST */
+    8650, /* ERROR_DS_VALUE_KEY_NOT_UNIQUE */
+    8651, /* ERROR_WEAK_WHFBKEY_BLOCKED */
+    9000, /* DNS_ERROR_MASK */
+    9001, /* DNS_ERROR_RCODE_FORMAT_ERROR */
+    9002, /* DNS_ERROR_RCODE_SERVER_FAILURE */
+    9003, /* DNS_ERROR_RCODE_NAME_ERROR */
+    9004, /* DNS_ERROR_RCODE_NOT_IMPLEMENTED */
+    9005, /* DNS_ERROR_RCODE_REFUSED */
+    9006, /* DNS_ERROR_RCODE_YXDOMAIN */
+    9007, /* DNS_ERROR_RCODE_YXRRSET */
+    9008, /* DNS_ERROR_RCODE_NXRRSET */
+    9009, /* DNS_ERROR_RCODE_NOTAUTH */
+    9010, /* DNS_ERROR_RCODE_NOTZONE */
+    9016, /* DNS_ERROR_RCODE_BADSIG */
+    9017, /* DNS_ERROR_RCODE_BADKEY */
+    9018, /* DNS_ERROR_RCODE_BADTIME */
+    9100, /* DNS_ERROR_DNSSEC_BASE */
+    9101, /* DNS_ERROR_KEYMASTER_REQUIRED */
+    9102, /* DNS_ERROR_NOT_ALLOWED_ON_SIGNED_ZONE */
+    9103, /* DNS_ERROR_NSEC3_INCOMPATIBLE_WITH_RSA_SHA1 */
+    9104, /* DNS_ERROR_NOT_ENOUGH_SIGNING_KEY_DESCRIPTORS */
+    9105, /* DNS_ERROR_UNSUPPORTED_ALGORITHM */
+    9106, /* DNS_ERROR_INVALID_KEY_SIZE */
+    9107, /* DNS_ERROR_SIGNING_KEY_NOT_ACCESSIBLE */
+    9108, /* DNS_ERROR_KSP_DOES_NOT_SUPPORT_PROTECTION */
+    9109, /* DNS_ERROR_UNEXPECTED_DATA_PROTECTION_ERROR */
+    9110, /* DNS_ERROR_UNEXPECTED_CNG_ERROR */
+    9111, /* DNS_ERROR_UNKNOWN_SIGNING_PARAMETER_VERSION */
+    9112, /* DNS_ERROR_KSP_NOT_ACCESSIBLE */
+    9113, /* DNS_ERROR_TOO_MANY_SKDS */
+    9114, /* DNS_ERROR_INVALID_ROLLOVER_PERIOD */
+    9115, /* DNS_ERROR_INVALID_INITIAL_ROLLOVER_OFFSET */
+    9116, /* DNS_ERROR_ROLLOVER_IN_PROGRESS */
+    9117, /* DNS_ERROR_STANDBY_KEY_NOT_PRESENT */
+    9118, /* DNS_ERROR_NOT_ALLOWED_ON_ZSK */
+    9119, /* DNS_ERROR_NOT_ALLOWED_ON_ACTIVE_SKD */
+    9120, /* DNS_ERROR_ROLLOVER_ALREADY_QUEUED */
+    9121, /* DNS_ERROR_NOT_ALLOWED_ON_UNSIGNED_ZONE */
+    9122, /* DNS_ERROR_BAD_KEYMASTER */
+    9123, /* DNS_ERROR_INVALID_SIGNATURE_VALIDITY_PERIOD */
+    9124, /* DNS_ERROR_INVALID_NSEC3_ITERATION_COUNT */
+    9125, /* DNS_ERROR_DNSSEC_IS_DISABLED */
+    9126, /* DNS_ERROR_INVALID_XML */
+    9127, /* DNS_ERROR_NO_VALID_TRUST_ANCHORS */
+    9128, /* DNS_ERROR_ROLLOVER_NOT_POKEABLE */
+    9129, /* DNS_ERROR_NSEC3_NAME_COLLISION */
+    9130, /* DNS_ERROR_NSEC_INCOMPATIBLE_WITH_NSEC3_RSA_SHA1 */
+    9500, /* DNS_ERROR_PACKET_FMT_BASE */
+    9502, /* DNS_ERROR_BAD_PACKET */
+    9503, /* DNS_ERROR_NO_PACKET */
+    9504, /* DNS_ERROR_RCODE */
+    9505, /* DNS_ERROR_UNSECURE_PACKET */
+    9550, /* DNS_ERROR_GENERAL_API_BASE */
+    9551, /* DNS_ERROR_INVALID_TYPE */
+    9552, /* DNS_ERROR_INVALID_IP_ADDRESS */
+    9553, /* DNS_ERROR_INVALID_PROPERTY */
+    9554, /* DNS_ERROR_TRY_AGAIN_LATER */
+    9555, /* DNS_ERROR_NOT_UNIQUE */
+    9556, /* DNS_ERROR_NON_RFC_NAME */
+    9560, /* DNS_ERROR_INVALID_NAME_CHAR */
+    9561, /* DNS_ERROR_NUMERIC_NAME */
+    9562, /* DNS_ERROR_NOT_ALLOWED_ON_ROOT_SERVER */
+    9563, /* DNS_ERROR_NOT_ALLOWED_UNDER_DELEGATION */
+    9564, /* DNS_ERROR_CANNOT_FIND_ROOT_HINTS */
+    9565, /* DNS_ERROR_INCONSISTENT_ROOT_HINTS */
+    9566, /* DNS_ERROR_DWORD_VALUE_TOO_SMALL */
+    9567, /* DNS_ERROR_DWORD_VALUE_TOO_LARGE */
+    9568, /* DNS_ERROR_BACKGROUND_LOADING */
+    9569, /* DNS_ERROR_NOT_ALLOWED_ON_RODC */
+    9570, /* DNS_ERROR_NOT_ALLOWED_UNDER_DNAME */
+    9571, /* DNS_ERROR_DELEGATION_REQUIRED */
+    9572, /* DNS_ERROR_INVALID_POLICY_TABLE */
+    9573, /* DNS_ERROR_ADDRESS_REQUIRED */
+    9600, /* DNS_ERROR_ZONE_BASE */
+    9601, /* DNS_ERROR_ZONE_DOES_NOT_EXIST */
+    9602, /* DNS_ERROR_NO_ZONE_INFO */
+    9603, /* DNS_ERROR_INVALID_ZONE_OPERATION */
+    9604, /* DNS_ERROR_ZONE_CONFIGURATION_ERROR */
+    9605, /* DNS_ERROR_ZONE_HAS_NO_SOA_RECORD */
+    9606, /* DNS_ERROR_ZONE_HAS_NO_NS_RECORDS */
+    9607, /* DNS_ERROR_ZONE_LOCKED */
+    9608, /* DNS_ERROR_ZONE_CREATION_FAILED */
+    9609, /* DNS_ERROR_ZONE_ALREADY_EXISTS */
+    9610, /* DNS_ERROR_AUTOZONE_ALREADY_EXISTS */
+    9611, /* DNS_ERROR_INVALID_ZONE_TYPE */
+    9612, /* DNS_ERROR_SECONDARY_REQUIRES_MASTER_IP */
+    9613, /* DNS_ERROR_ZONE_NOT_SECONDARY */
+    9614, /* DNS_ERROR_NEED_SECONDARY_ADDRESSES */
+    9615, /* DNS_ERROR_WINS_INIT_FAILED */
+    9616, /* DNS_ERROR_NEED_WINS_SERVERS */
+    9617, /* DNS_ERROR_NBSTAT_INIT_FAILED */
+    9618, /* DNS_ERROR_SOA_DELETE_INVALID */
+    9619, /* DNS_ERROR_FORWARDER_ALREADY_EXISTS */
+    9620, /* DNS_ERROR_ZONE_REQUIRES_MASTER_IP */
+    9621, /* DNS_ERROR_ZONE_IS_SHUTDOWN */
+    9622, /* DNS_ERROR_ZONE_LOCKED_FOR_SIGNING */
+    9650, /* DNS_ERROR_DATAFILE_BASE */
+    9651, /* DNS_ERROR_PRIMARY_REQUIRES_DATAFILE */
+    9652, /* DNS_ERROR_INVALID_DATAFILE_NAME */
+    9653, /* DNS_ERROR_DATAFILE_OPEN_FAILURE */
+    9654, /* DNS_ERROR_FILE_WRITEBACK_FAILED */
+    9655, /* DNS_ERROR_DATAFILE_PARSING */
+    9700, /* DNS_ERROR_DATABASE_BASE */
+    9701, /* DNS_ERROR_RECORD_DOES_NOT_EXIST */
+    9702, /* DNS_ERROR_RECORD_FORMAT */
+    9703, /* DNS_ERROR_NODE_CREATION_FAILED */
+    9704, /* DNS_ERROR_UNKNOWN_RECORD_TYPE */
+    9705, /* DNS_ERROR_RECORD_TIMED_OUT */
+    9706, /* DNS_ERROR_NAME_NOT_IN_ZONE */
+    9707, /* DNS_ERROR_CNAME_LOOP */
+    9708, /* DNS_ERROR_NODE_IS_CNAME */
+    9709, /* DNS_ERROR_CNAME_COLLISION */
+    9710, /* DNS_ERROR_RECORD_ONLY_AT_ZONE_ROOT */
+    9711, /* DNS_ERROR_RECORD_ALREADY_EXISTS */
+    9712, /* DNS_ERROR_SECONDARY_DATA */
+    9713, /* DNS_ERROR_NO_CREATE_CACHE_DATA */
+    9714, /* DNS_ERROR_NAME_DOES_NOT_EXIST */
+    9717, /* DNS_ERROR_DS_UNAVAILABLE */
+    9718, /* DNS_ERROR_DS_ZONE_ALREADY_EXISTS */
+    9719, /* DNS_ERROR_NO_BOOTFILE_IF_DS_ZONE */
+    9720, /* DNS_ERROR_NODE_IS_DNAME */
+    9721, /* DNS_ERROR_DNAME_COLLISION */
+    9722, /* DNS_ERROR_ALIAS_LOOP */
+    9750, /* DNS_ERROR_OPERATION_BASE */
+    9752, /* DNS_ERROR_AXFR */
+    9800, /* DNS_ERROR_SECURE_BASE */
+    9850, /* DNS_ERROR_SETUP_BASE */
+    9851, /* DNS_ERROR_NO_TCPIP */
+    9852, /* DNS_ERROR_NO_DNS_SERVERS */
+    9900, /* DNS_ERROR_DP_BASE */
+    9901, /* DNS_ERROR_DP_DOES_NOT_EXIST */
+    9902, /* DNS_ERROR_DP_ALREADY_EXISTS */
+    9903, /* DNS_ERROR_DP_NOT_ENLISTED */
+    9904, /* DNS_ERROR_DP_ALREADY_ENLISTED */
+    9905, /* DNS_ERROR_DP_NOT_AVAILABLE */
+    9906, /* DNS_ERROR_DP_FSMO_ERROR */
+    9911, /* DNS_ERROR_RRL_NOT_ENABLED */
+    9912, /* DNS_ERROR_RRL_INVALID_WINDOW_SIZE */
+    9913, /* DNS_ERROR_RRL_INVALID_IPV4_PREFIX */
+    9914, /* DNS_ERROR_RRL_INVALID_IPV6_PREFIX */
+    9915, /* DNS_ERROR_RRL_INVALID_TC_RATE */
+    9916, /* DNS_ERROR_RRL_INVALID_LEAK_RATE */
+    9917, /* DNS_ERROR_RRL_LEAK_RATE_LESSTHAN_TC_RATE */
+    9921, /* DNS_ERROR_VIRTUALIZATION_INSTANCE_ALREADY_EXISTS */
+    9922, /* DNS_ERROR_VIRTUALIZATION_INSTANCE_DOES_NOT_EXIST */
+    9923, /* DNS_ERROR_VIRTUALIZATION_TREE_LOCKED */
+    9924, /* DNS_ERROR_INVAILD_VIRTUALIZATION_INSTANCE_NAME */
+    9925, /* DNS_ERROR_DEFAULT_VIRTUALIZATION_INSTANCE */
+    9951, /* DNS_ERROR_ZONESCOPE_ALREADY_EXISTS */
+    9952, /* DNS_ERROR_ZONESCOPE_DOES_NOT_EXIST */
+    9953, /* DNS_ERROR_DEFAULT_ZONESCOPE */
+    9954, /* DNS_ERROR_INVALID_ZONESCOPE_NAME */
+    9955, /* DNS_ERROR_NOT_ALLOWED_WITH_ZONESCOPES */
+    9956, /* DNS_ERROR_LOAD_ZONESCOPE_FAILED */
+    9957, /* DNS_ERROR_ZONESCOPE_FILE_WRITEBACK_FAILED */
+    9958, /* DNS_ERROR_INVALID_SCOPE_NAME */
+    9959, /* DNS_ERROR_SCOPE_DOES_NOT_EXIST */
+    9960, /* DNS_ERROR_DEFAULT_SCOPE */
+    9961, /* DNS_ERROR_INVALID_SCOPE_OPERATION */
+    9962, /* DNS_ERROR_SCOPE_LOCKED */
+    9963, /* DNS_ERROR_SCOPE_ALREADY_EXISTS */
+    9971, /* DNS_ERROR_POLICY_ALREADY_EXISTS */
+    9972, /* DNS_ERROR_POLICY_DOES_NOT_EXIST */
+    9973, /* DNS_ERROR_POLICY_INVALID_CRITERIA */
+    9974, /* DNS_ERROR_POLICY_INVALID_SETTINGS */
+    9975, /* DNS_ERROR_CLIENT_SUBNET_IS_ACCESSED */
+    9976, /* DNS_ERROR_CLIENT_SUBNET_DOES_NOT_EXIST */
+    9977, /* DNS_ERROR_CLIENT_SUBNET_ALREADY_EXISTS */
+    9978, /* DNS_ERROR_SUBNET_DOES_NOT_EXIST */
+    9979, /* DNS_ERROR_SUBNET_ALREADY_EXISTS */
+    9980, /* DNS_ERROR_POLICY_LOCKED */
+    9981, /* DNS_ERROR_POLICY_INVALID_WEIGHT */
+    9982, /* DNS_ERROR_POLICY_INVALID_NAME */
+    9983, /* DNS_ERROR_POLICY_MISSING_CRITERIA */
+    9984, /* DNS_ERROR_INVALID_CLIENT_SUBNET_NAME */
+    9985, /* DNS_ERROR_POLICY_PROCESSING_ORDER_INVALID */
+    9986, /* DNS_ERROR_POLICY_SCOPE_MISSING */
+    9987, /* DNS_ERROR_POLICY_SCOPE_NOT_ALLOWED */
+    9988, /* DNS_ERROR_SERVERSCOPE_IS_REFERENCED */
+    9989, /* DNS_ERROR_ZONESCOPE_IS_REFERENCED */
+    9990, /* DNS_ERROR_POLICY_INVALID_CRITERIA_CLIENT_SUBNET */
+    9991, /* DNS_ERROR_POLICY_INVALID_CRITERIA_TRANSPORT_PROTOCOL */
+    9992, /* DNS_ERROR_POLICY_INVALID_CRITERIA_NETWORK_PROTOCOL */
+    9993, /* DNS_ERROR_POLICY_INVALID_CRITERIA_INTERFACE */
+    9994, /* DNS_ERROR_POLICY_INVALID_CRITERIA_FQDN */
+    9995, /* DNS_ERROR_POLICY_INVALID_CRITERIA_QUERY_TYPE */
+    9996, /* DNS_ERROR_POLICY_INVALID_CRITERIA_TIME_OF_DAY */
+    13000, /* ERROR_IPSEC_QM_POLICY_EXISTS */
+    13001, /* ERROR_IPSEC_QM_POLICY_NOT_FOUND */
+    13002, /* ERROR_IPSEC_QM_POLICY_IN_USE */
+    13003, /* ERROR_IPSEC_MM_POLICY_EXISTS */
+    13004, /* ERROR_IPSEC_MM_POLICY_NOT_FOUND */
+    13005, /* ERROR_IPSEC_MM_POLICY_IN_USE */
+    13006, /* ERROR_IPSEC_MM_FILTER_EXISTS */
+    13007, /* ERROR_IPSEC_MM_FILTER_NOT_FOUND */
+    13008, /* ERROR_IPSEC_TRANSPORT_FILTER_EXISTS */
+    13009, /* ERROR_IPSEC_TRANSPORT_FILTER_NOT_FOUND */
+    13010, /* ERROR_IPSEC_MM_AUTH_EXISTS */
+    13011, /* ERROR_IPSEC_MM_AUTH_NOT_FOUND */
+    13012, /* ERROR_IPSEC_MM_AUTH_IN_USE */
+    13013, /* ERROR_IPSEC_DEFAULT_MM_POLICY_NOT_FOUND */
+    13014, /* ERROR_IPSEC_DEFAULT_MM_AUTH_NOT_FOUND */
+    13015, /* ERROR_IPSEC_DEFAULT_QM_POLICY_NOT_FOUND */
+    13016, /* ERROR_IPSEC_TUNNEL_FILTER_EXISTS */
+    13017, /* ERROR_IPSEC_TUNNEL_FILTER_NOT_FOUND */
+    13018, /* ERROR_IPSEC_MM_FILTER_PENDING_DELETION */
+    13019, /* ERROR_IPSEC_TRANSPORT_FILTER_PENDING_DELETION */
+    13020, /* ERROR_IPSEC_TUNNEL_FILTER_PENDING_DELETION */
+    13021, /* ERROR_IPSEC_MM_POLICY_PENDING_DELETION */
+    13022, /* ERROR_IPSEC_MM_AUTH_PENDING_DELETION */
+    13023, /* ERROR_IPSEC_QM_POLICY_PENDING_DELETION */
+    13800, /* ERROR_IPSEC_IKE_NEG_STATUS_BEGIN */
+    13801, /* ERROR_IPSEC_IKE_AUTH_FAIL */
+    13802, /* ERROR_IPSEC_IKE_ATTRIB_FAIL */
+    13803, /* ERROR_IPSEC_IKE_NEGOTIATION_PENDING */
+    13804, /* ERROR_IPSEC_IKE_GENERAL_PROCESSING_ERROR */
+    13805, /* ERROR_IPSEC_IKE_TIMED_OUT */
+    13806, /* ERROR_IPSEC_IKE_NO_CERT */
+    13807, /* ERROR_IPSEC_IKE_SA_DELETED */
+    13808, /* ERROR_IPSEC_IKE_SA_REAPED */
+    13809, /* ERROR_IPSEC_IKE_MM_ACQUIRE_DROP */
+    13810, /* ERROR_IPSEC_IKE_QM_ACQUIRE_DROP */
+    13811, /* ERROR_IPSEC_IKE_QUEUE_DROP_MM */
+    13812, /* ERROR_IPSEC_IKE_QUEUE_DROP_NO_MM */
+    13813, /* ERROR_IPSEC_IKE_DROP_NO_RESPONSE */
+    13814, /* ERROR_IPSEC_IKE_MM_DELAY_DROP */
+    13815, /* ERROR_IPSEC_IKE_QM_DELAY_DROP */
+    13816, /* ERROR_IPSEC_IKE_ERROR */
+    13817, /* ERROR_IPSEC_IKE_CRL_FAILED */
+    13818, /* ERROR_IPSEC_IKE_INVALID_KEY_USAGE */
+    13819, /* ERROR_IPSEC_IKE_INVALID_CERT_TYPE */
+    13820, /* ERROR_IPSEC_IKE_NO_PRIVATE_KEY */
+    13821, /* ERROR_IPSEC_IKE_SIMULTANEOUS_REKEY */
+    13822, /* ERROR_IPSEC_IKE_DH_FAIL */
+    13823, /* ERROR_IPSEC_IKE_CRITICAL_PAYLOAD_NOT_RECOGNIZED */
+    13824, /* ERROR_IPSEC_IKE_INVALID_HEADER */
+    13825, /* ERROR_IPSEC_IKE_NO_POLICY */
+    13826, /* ERROR_IPSEC_IKE_INVALID_SIGNATURE */
+    13827, /* ERROR_IPSEC_IKE_KERBEROS_ERROR */
+    13828, /* ERROR_IPSEC_IKE_NO_PUBLIC_KEY */
+    13829, /* ERROR_IPSEC_IKE_PROCESS_ERR */
+    13830, /* ERROR_IPSEC_IKE_PROCESS_ERR_SA */
+    13831, /* ERROR_IPSEC_IKE_PROCESS_ERR_PROP */
+    13832, /* ERROR_IPSEC_IKE_PROCESS_ERR_TRANS */
+    13833, /* ERROR_IPSEC_IKE_PROCESS_ERR_KE */
+    13834, /* ERROR_IPSEC_IKE_PROCESS_ERR_ID */
+    13835, /* ERROR_IPSEC_IKE_PROCESS_ERR_CERT */
+    13836, /* ERROR_IPSEC_IKE_PROCESS_ERR_CERT_REQ */
+    13837, /* ERROR_IPSEC_IKE_PROCESS_ERR_HASH */
+    13838, /* ERROR_IPSEC_IKE_PROCESS_ERR_SIG */
+    13839, /* ERROR_IPSEC_IKE_PROCESS_ERR_NONCE */
+    13840, /* ERROR_IPSEC_IKE_PROCESS_ERR_NOTIFY */
+    13841, /* ERROR_IPSEC_IKE_PROCESS_ERR_DELETE */
+    13842, /* ERROR_IPSEC_IKE_PROCESS_ERR_VENDOR */
+    13843, /* ERROR_IPSEC_IKE_INVALID_PAYLOAD */
+    13844, /* ERROR_IPSEC_IKE_LOAD_SOFT_SA */
+    13845, /* ERROR_IPSEC_IKE_SOFT_SA_TORN_DOWN */
+    13846, /* ERROR_IPSEC_IKE_INVALID_COOKIE */
+    13847, /* ERROR_IPSEC_IKE_NO_PEER_CERT */
+    13848, /* ERROR_IPSEC_IKE_PEER_CRL_FAILED */
+    13849, /* ERROR_IPSEC_IKE_POLICY_CHANGE */
+    13850, /* ERROR_IPSEC_IKE_NO_MM_POLICY */
+    13851, /* ERROR_IPSEC_IKE_NOTCBPRIV */
+    13852, /* ERROR_IPSEC_IKE_SECLOADFAIL */
+    13853, /* ERROR_IPSEC_IKE_FAILSSPINIT */
+    13854, /* ERROR_IPSEC_IKE_FAILQUERYSSP */
+    13855, /* ERROR_IPSEC_IKE_SRVACQFAIL */
+    13856, /* ERROR_IPSEC_IKE_SRVQUERYCRED */
+    13857, /* ERROR_IPSEC_IKE_GETSPIFAIL */
+    13858, /* ERROR_IPSEC_IKE_INVALID_FILTER */
+    13859, /* ERROR_IPSEC_IKE_OUT_OF_MEMORY */
+    13860, /* ERROR_IPSEC_IKE_ADD_UPDATE_KEY_FAILED */
+    13861, /* ERROR_IPSEC_IKE_INVALID_POLICY */
+    13862, /* ERROR_IPSEC_IKE_UNKNOWN_DOI */
+    13863, /* ERROR_IPSEC_IKE_INVALID_SITUATION */
+    13864, /* ERROR_IPSEC_IKE_DH_FAILURE */
+    13865, /* ERROR_IPSEC_IKE_INVALID_GROUP */
+    13866, /* ERROR_IPSEC_IKE_ENCRYPT */
+    13867, /* ERROR_IPSEC_IKE_DECRYPT */
+    13868, /* ERROR_IPSEC_IKE_POLICY_MATCH */
+    13869, /* ERROR_IPSEC_IKE_UNSUPPORTED_ID */
+    13870, /* ERROR_IPSEC_IKE_INVALID_HASH */
+    13871, /* ERROR_IPSEC_IKE_INVALID_HASH_ALG */
+    13872, /* ERROR_IPSEC_IKE_INVALID_HASH_SIZE */
+    13873, /* ERROR_IPSEC_IKE_INVALID_ENCRYPT_ALG */
+    13874, /* ERROR_IPSEC_IKE_INVALID_AUTH_ALG */
+    13875, /* ERROR_IPSEC_IKE_INVALID_SIG */
+    13876, /* ERROR_IPSEC_IKE_LOAD_FAILED */
+    13877, /* ERROR_IPSEC_IKE_RPC_DELETE */
+    13878, /* ERROR_IPSEC_IKE_BENIGN_REINIT */
+    13879, /* ERROR_IPSEC_IKE_INVALID_RESPONDER_LIFETIME_NOTIFY */
+    13880, /* ERROR_IPSEC_IKE_INVALID_MAJOR_VERSION */
+    13881, /* ERROR_IPSEC_IKE_INVALID_CERT_KEYLEN */
+    13882, /* ERROR_IPSEC_IKE_MM_LIMIT */
+    13883, /* ERROR_IPSEC_IKE_NEGOTIATION_DISABLED */
+    13884, /* ERROR_IPSEC_IKE_QM_LIMIT */
+    13885, /* ERROR_IPSEC_IKE_MM_EXPIRED */
+    13886, /* ERROR_IPSEC_IKE_PEER_MM_ASSUMED_INVALID */
+    13887, /* ERROR_IPSEC_IKE_CERT_CHAIN_POLICY_MISMATCH */
+    13888, /* ERROR_IPSEC_IKE_UNEXPECTED_MESSAGE_ID */
+    13889, /* ERROR_IPSEC_IKE_INVALID_AUTH_PAYLOAD */
+    13890, /* ERROR_IPSEC_IKE_DOS_COOKIE_SENT */
+    13891, /* ERROR_IPSEC_IKE_SHUTTING_DOWN */
+    13892, /* ERROR_IPSEC_IKE_CGA_AUTH_FAILED */
+    13893, /* ERROR_IPSEC_IKE_PROCESS_ERR_NATOA */
+    13894, /* ERROR_IPSEC_IKE_INVALID_MM_FOR_QM */
+    13895, /* ERROR_IPSEC_IKE_QM_EXPIRED */
+    13896, /* ERROR_IPSEC_IKE_TOO_MANY_FILTERS */
+    13897, /* ERROR_IPSEC_IKE_NEG_STATUS_END */
+    13898, /* ERROR_IPSEC_IKE_KILL_DUMMY_NAP_TUNNEL */
+    13899, /* ERROR_IPSEC_IKE_INNER_IP_ASSIGNMENT_FAILURE */
+    13900, /* ERROR_IPSEC_IKE_REQUIRE_CP_PAYLOAD_MISSING */
+    13901, /* ERROR_IPSEC_KEY_MODULE_IMPERSONATION_NEGOTIATION_PENDING */
+    13902, /* ERROR_IPSEC_IKE_COEXISTENCE_SUPPRESS */
+    13903, /* ERROR_IPSEC_IKE_RATELIMIT_DROP */
+    13904, /* ERROR_IPSEC_IKE_PEER_DOESNT_SUPPORT_MOBIKE */
+    13905, /* ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE */
+    13906, /* ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_FAILURE */
+    13907, /* ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE_WITH_OPTIONAL_RETRY */
+    13908, /* ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_AND_CERTMAP_FAILURE */
+    13909, /* ERROR_IPSEC_IKE_NEG_STATUS_EXTENDED_END */
+    13910, /* ERROR_IPSEC_BAD_SPI */
+    13911, /* ERROR_IPSEC_SA_LIFETIME_EXPIRED */
+    13912, /* ERROR_IPSEC_WRONG_SA */
+    13913, /* ERROR_IPSEC_REPLAY_CHECK_FAILED */
+    13914, /* ERROR_IPSEC_INVALID_PACKET */
+    13915, /* ERROR_IPSEC_INTEGRITY_CHECK_FAILED */
+    13916, /* ERROR_IPSEC_CLEAR_TEXT_DROP */
+    13917, /* ERROR_IPSEC_AUTH_FIREWALL_DROP */
+    13918, /* ERROR_IPSEC_THROTTLE_DROP */
+    13925, /* ERROR_IPSEC_DOSP_BLOCK */
+    13926, /* ERROR_IPSEC_DOSP_RECEIVED_MULTICAST */
+    13927, /* ERROR_IPSEC_DOSP_INVALID_PACKET */
+    13928, /* ERROR_IPSEC_DOSP_STATE_LOOKUP_FAILED */
+    13929, /* ERROR_IPSEC_DOSP_MAX_ENTRIES */
+    13930, /* ERROR_IPSEC_DOSP_KEYMOD_NOT_ALLOWED */
+    13931, /* ERROR_IPSEC_DOSP_NOT_INSTALLED */
+    13932, /* ERROR_IPSEC_DOSP_MAX_PER_IP_RATELIMIT_QUEUES */
+    14000, /* ERROR_SXS_SECTION_NOT_FOUND */
+    14001, /* ERROR_SXS_CANT_GEN_ACTCTX */
+    14002, /* ERROR_SXS_INVALID_ACTCTXDATA_FORMAT */
+    14003, /* ERROR_SXS_ASSEMBLY_NOT_FOUND */
+    14004, /* ERROR_SXS_MANIFEST_FORMAT_ERROR */
+    14005, /* ERROR_SXS_MANIFEST_PARSE_ERROR */
+    14006, /* ERROR_SXS_ACTIVATION_CONTEXT_DISABLED */
+    14007, /* ERROR_SXS_KEY_NOT_FOUND */
+    14008, /* ERROR_SXS_VERSION_CONFLICT */
+    14009, /* ERROR_SXS_WRONG_SECTION_TYPE */
+    14010, /* ERROR_SXS_THREAD_QUERIES_DISABLED */
+    14011, /* ERROR_SXS_PROCESS_DEFAULT_ALREADY_SET */
+    14012, /* ERROR_SXS_UNKNOWN_ENCODING_GROUP */
+    14013, /* ERROR_SXS_UNKNOWN_ENCODING */
+    14014, /* ERROR_SXS_INVALID_XML_NAMESPACE_URI */
+    14015, /* ERROR_SXS_ROOT_MANIFEST_DEPENDENCY_NOT_INSTALLED */
+    14016, /* ERROR_SXS_LEAF_MANIFEST_DEPENDENCY_NOT_INSTALLED */
+    14017, /* ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE */
+    14018, /* ERROR_SXS_MANIFEST_MISSING_REQUIRED_DEFAULT_NAMESPACE */
+    14019, /* ERROR_SXS_MANIFEST_INVALID_REQUIRED_DEFAULT_NAMESPACE */
+    14020, /* ERROR_SXS_PRIVATE_MANIFEST_CROSS_PATH_WITH_REPARSE_POINT */
+    14021, /* ERROR_SXS_DUPLICATE_DLL_NAME */
+    14022, /* ERROR_SXS_DUPLICATE_WINDOWCLASS_NAME */
+    14023, /* ERROR_SXS_DUPLICATE_CLSID */
+    14024, /* ERROR_SXS_DUPLICATE_IID */
+    14025, /* ERROR_SXS_DUPLICATE_TLBID */
+    14026, /* ERROR_SXS_DUPLICATE_PROGID */
+    14027, /* ERROR_SXS_DUPLICATE_ASSEMBLY_NAME */
+    14028, /* ERROR_SXS_FILE_HASH_MISMATCH */
+    14029, /* ERROR_SXS_POLICY_PARSE_ERROR */
+    14030, /* ERROR_SXS_XML_E_MISSINGQUOTE */
+    14031, /* ERROR_SXS_XML_E_COMMENTSYNTAX */
+    14032, /* ERROR_SXS_XML_E_BADSTARTNAMECHAR */
+    14033, /* ERROR_SXS_XML_E_BADNAMECHAR */
+    14034, /* ERROR_SXS_XML_E_BADCHARINSTRING */
+    14035, /* ERROR_SXS_XML_E_XMLDECLSYNTAX */
+    14036, /* ERROR_SXS_XML_E_BADCHARDATA */
+    14037, /* ERROR_SXS_XML_E_MISSINGWHITESPACE */
+    14038, /* ERROR_SXS_XML_E_EXPECTINGTAGEND */
+    14039, /* ERROR_SXS_XML_E_MISSINGSEMICOLON */
+    14040, /* ERROR_SXS_XML_E_UNBALANCEDPAREN */
+    14041, /* ERROR_SXS_XML_E_INTERNALERROR */
+    14042, /* ERROR_SXS_XML_E_UNEXPECTED_WHITESPACE */
+    14043, /* ERROR_SXS_XML_E_INCOMPLETE_ENCODING */
+    14044, /* ERROR_SXS_XML_E_MISSING_PAREN */
+    14045, /* ERROR_SXS_XML_E_EXPECTINGCLOSEQUOTE */
+    14046, /* ERROR_SXS_XML_E_MULTIPLE_COLONS */
+    14047, /* ERROR_SXS_XML_E_INVALID_DECIMAL */
+    14048, /* ERROR_SXS_XML_E_INVALID_HEXIDECIMAL */
+    14049, /* ERROR_SXS_XML_E_INVALID_UNICODE */
+    14050, /* ERROR_SXS_XML_E_WHITESPACEORQUESTIONMARK */
+    14051, /* ERROR_SXS_XML_E_UNEXPECTEDENDTAG */
+    14052, /* ERROR_SXS_XML_E_UNCLOSEDTAG */
+    14053, /* ERROR_SXS_XML_E_DUPLICATEATTRIBUTE */
+    14054, /* ERROR_SXS_XML_E_MULTIPLEROOTS */
+    14055, /* ERROR_SXS_XML_E_INVALIDATROOTLEVEL */
+    14056, /* ERROR_SXS_XML_E_BADXMLDECL */
+    14057, /* ERROR_SXS_XML_E_MISSINGROOT */
+    14058, /* ERROR_SXS_XML_E_UNEXPECTEDEOF */
+    14059, /* ERROR_SXS_XML_E_BADPEREFINSUBSET */
+    14060, /* ERROR_SXS_XML_E_UNCLOSEDSTARTTAG */
+    14061, /* ERROR_SXS_XML_E_UNCLOSEDENDTAG */
+    14062, /* ERROR_SXS_XML_E_UNCLOSEDSTRING */
+    14063, /* ERROR_SXS_XML_E_UNCLOSEDCOMMENT */
+    14064, /* ERROR_SXS_XML_E_UNCLOSEDDECL */
+    14065, /* ERROR_SXS_XML_E_UNCLOSEDCDATA */
+    14066, /* ERROR_SXS_XML_E_RESERVEDNAMESPACE */
+    14067, /* ERROR_SXS_XML_E_INVALIDENCODING */
+    14068, /* ERROR_SXS_XML_E_INVALIDSWITCH */
+    14069, /* ERROR_SXS_XML_E_BADXMLCASE */
+    14070, /* ERROR_SXS_XML_E_INVALID_STANDALONE */
+    14071, /* ERROR_SXS_XML_E_UNEXPECTED_STANDALONE */
+    14072, /* ERROR_SXS_XML_E_INVALID_VERSION */
+    14073, /* ERROR_SXS_XML_E_MISSINGEQUALS */
+    14074, /* ERROR_SXS_PROTECTION_RECOVERY_FAILED */
+    14075, /* ERROR_SXS_PROTECTION_PUBLIC_KEY_TOO_SHORT */
+    14076, /* ERROR_SXS_PROTECTION_CATALOG_NOT_VALID */
+    14077, /* ERROR_SXS_UNTRANSLATABLE_HRESULT */
+    14078, /* ERROR_SXS_PROTECTION_CATALOG_FILE_MISSING */
+    14079, /* ERROR_SXS_MISSING_ASSEMBLY_IDENTITY_ATTRIBUTE */
+    14080, /* ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE_NAME */
+    14081, /* ERROR_SXS_ASSEMBLY_MISSING */
+    14082, /* ERROR_SXS_CORRUPT_ACTIVATION_STACK */
+    14083, /* ERROR_SXS_CORRUPTION */
+    14084, /* ERROR_SXS_EARLY_DEACTIVATION */
+    14085, /* ERROR_SXS_INVALID_DEACTIVATION */
+    14086, /* ERROR_SXS_MULTIPLE_DEACTIVATION */
+    14087, /* ERROR_SXS_PROCESS_TERMINATION_REQUESTED */
+    14088, /* ERROR_SXS_RELEASE_ACTIVATION_CONTEXT */
+    14089, /* ERROR_SXS_SYSTEM_DEFAULT_ACTIVATION_CONTEXT_EMPTY */
+    14090, /* ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_VALUE */
+    14091, /* ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_NAME */
+    14092, /* ERROR_SXS_IDENTITY_DUPLICATE_ATTRIBUTE */
+    14093, /* ERROR_SXS_IDENTITY_PARSE_ERROR */
+    14094, /* ERROR_MALFORMED_SUBSTITUTION_STRING */
+    14095, /* ERROR_SXS_INCORRECT_PUBLIC_KEY_TOKEN */
+    14096, /* ERROR_UNMAPPED_SUBSTITUTION_STRING */
+    14097, /* ERROR_SXS_ASSEMBLY_NOT_LOCKED */
+    14098, /* ERROR_SXS_COMPONENT_STORE_CORRUPT */
+    14099, /* ERROR_ADVANCED_INSTALLER_FAILED */
+    14100, /* ERROR_XML_ENCODING_MISMATCH */
+    14101, /* ERROR_SXS_MANIFEST_IDENTITY_SAME_BUT_CONTENTS_DIFFERENT */
+    14102, /* ERROR_SXS_IDENTITIES_DIFFERENT */
+    14103, /* ERROR_SXS_ASSEMBLY_IS_NOT_A_DEPLOYMENT */
+    14104, /* ERROR_SXS_FILE_NOT_PART_OF_ASSEMBLY */
+    14105, /* ERROR_SXS_MANIFEST_TOO_BIG */
+    14106, /* ERROR_SXS_SETTING_NOT_REGISTERED */
+    14107, /* ERROR_SXS_TRANSACTION_CLOSURE_INCOMPLETE */
+    14108, /* ERROR_SMI_PRIMITIVE_INSTALLER_FAILED */
+    14109, /* ERROR_GENERIC_COMMAND_FAILED */
+    14110, /* ERROR_SXS_FILE_HASH_MISSING */
+    14111, /* ERROR_SXS_DUPLICATE_ACTIVATABLE_CLASS */
+    15000, /* ERROR_EVT_INVALID_CHANNEL_PATH */
+    15001, /* ERROR_EVT_INVALID_QUERY */
+    15002, /* ERROR_EVT_PUBLISHER_METADATA_NOT_FOUND */
+    15003, /* ERROR_EVT_EVENT_TEMPLATE_NOT_FOUND */
+    15004, /* ERROR_EVT_INVALID_PUBLISHER_NAME */
+    15005, /* ERROR_EVT_INVALID_EVENT_DATA */
+    15007, /* ERROR_EVT_CHANNEL_NOT_FOUND */
+    15008, /* ERROR_EVT_MALFORMED_XML_TEXT */
+    15009, /* ERROR_EVT_SUBSCRIPTION_TO_DIRECT_CHANNEL */
+    15010, /* ERROR_EVT_CONFIGURATION_ERROR */
+    15011, /* ERROR_EVT_QUERY_RESULT_STALE */
+    15012, /* ERROR_EVT_QUERY_RESULT_INVALID_POSITION */
+    15013, /* ERROR_EVT_NON_VALIDATING_MSXML */
+    15014, /* ERROR_EVT_FILTER_ALREADYSCOPED */
+    15015, /* ERROR_EVT_FILTER_NOTELTSET */
+    15016, /* ERROR_EVT_FILTER_INVARG */
+    15017, /* ERROR_EVT_FILTER_INVTEST */
+    15018, /* ERROR_EVT_FILTER_INVTYPE */
+    15019, /* ERROR_EVT_FILTER_PARSEERR */
+    15020, /* ERROR_EVT_FILTER_UNSUPPORTEDOP */
+    15021, /* ERROR_EVT_FILTER_UNEXPECTEDTOKEN */
+    15022, /* ERROR_EVT_INVALID_OPERATION_OVER_ENABLED_DIRECT_CHANNEL */
+    15023, /* ERROR_EVT_INVALID_CHANNEL_PROPERTY_VALUE */
+    15024, /* ERROR_EVT_INVALID_PUBLISHER_PROPERTY_VALUE */
+    15025, /* ERROR_EVT_CHANNEL_CANNOT_ACTIVATE */
+    15026, /* ERROR_EVT_FILTER_TOO_COMPLEX */
+    15027, /* ERROR_EVT_MESSAGE_NOT_FOUND */
+    15028, /* ERROR_EVT_MESSAGE_ID_NOT_FOUND */
+    15029, /* ERROR_EVT_UNRESOLVED_VALUE_INSERT */
+    15030, /* ERROR_EVT_UNRESOLVED_PARAMETER_INSERT */
+    15031, /* ERROR_EVT_MAX_INSERTS_REACHED */
+    15032, /* ERROR_EVT_EVENT_DEFINITION_NOT_FOUND */
+    15033, /* ERROR_EVT_MESSAGE_LOCALE_NOT_FOUND */
+    15034, /* ERROR_EVT_VERSION_TOO_OLD */
+    15035, /* ERROR_EVT_VERSION_TOO_NEW */
+    15036, /* ERROR_EVT_CANNOT_OPEN_CHANNEL_OF_QUERY */
+    15037, /* ERROR_EVT_PUBLISHER_DISABLED */
+    15038, /* ERROR_EVT_FILTER_OUT_OF_RANGE */
+    15080, /* ERROR_EC_SUBSCRIPTION_CANNOT_ACTIVATE */
+    15081, /* ERROR_EC_LOG_DISABLED */
+    15082, /* ERROR_EC_CIRCULAR_FORWARDING */
+    15083, /* ERROR_EC_CREDSTORE_FULL */
+    15084, /* ERROR_EC_CRED_NOT_FOUND */
+    15085, /* ERROR_EC_NO_ACTIVE_CHANNEL */
+    15100, /* ERROR_MUI_FILE_NOT_FOUND */
+    15101, /* ERROR_MUI_INVALID_FILE */
+    15102, /* ERROR_MUI_INVALID_RC_CONFIG */
+    15103, /* ERROR_MUI_INVALID_LOCALE_NAME */
+    15104, /* ERROR_MUI_INVALID_ULTIMATEFALLBACK_NAME */
+    15105, /* ERROR_MUI_FILE_NOT_LOADED */
+    15106, /* ERROR_RESOURCE_ENUM_USER_STOP */
+    15107, /* ERROR_MUI_INTLSETTINGS_UILANG_NOT_INSTALLED */
+    15108, /* ERROR_MUI_INTLSETTINGS_INVALID_LOCALE_NAME */
+    15110, /* ERROR_MRM_RUNTIME_NO_DEFAULT_OR_NEUTRAL_RESOURCE */
+    15111, /* ERROR_MRM_INVALID_PRICONFIG */
+    15112, /* ERROR_MRM_INVALID_FILE_TYPE */
+    15113, /* ERROR_MRM_UNKNOWN_QUALIFIER */
+    15114, /* ERROR_MRM_INVALID_QUALIFIER_VALUE */
+    15115, /* ERROR_MRM_NO_CANDIDATE */
+    15116, /* ERROR_MRM_NO_MATCH_OR_DEFAULT_CANDIDATE */
+    15117, /* ERROR_MRM_RESOURCE_TYPE_MISMATCH */
+    15118, /* ERROR_MRM_DUPLICATE_MAP_NAME */
+    15119, /* ERROR_MRM_DUPLICATE_ENTRY */
+    15120, /* ERROR_MRM_INVALID_RESOURCE_IDENTIFIER */
+    15121, /* ERROR_MRM_FILEPATH_TOO_LONG */
+    15122, /* ERROR_MRM_UNSUPPORTED_DIRECTORY_TYPE */
+    15126, /* ERROR_MRM_INVALID_PRI_FILE */
+    15127, /* ERROR_MRM_NAMED_RESOURCE_NOT_FOUND */
+    15135, /* ERROR_MRM_MAP_NOT_FOUND */
+    15136, /* ERROR_MRM_UNSUPPORTED_PROFILE_TYPE */
+    15137, /* ERROR_MRM_INVALID_QUALIFIER_OPERATOR */
+    15138, /* ERROR_MRM_INDETERMINATE_QUALIFIER_VALUE */
+    15139, /* ERROR_MRM_AUTOMERGE_ENABLED */
+    15140, /* ERROR_MRM_TOO_MANY_RESOURCES */
+    15141, /* ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_MERGE */
+    15142, /* ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_LOAD_UNLOAD_PRI_FILE */
+    15143, /* ERROR_MRM_NO_CURRENT_VIEW_ON_THREAD */
+    15144, /* ERROR_DIFFERENT_PROFILE_RESOURCE_MANAGER_EXIST */
+    15145, /* ERROR_OPERATION_NOT_ALLOWED_FROM_SYSTEM_COMPONENT */
+    15146, /* ERROR_MRM_DIRECT_REF_TO_NON_DEFAULT_RESOURCE */
+    15147, /* ERROR_MRM_GENERATION_COUNT_MISMATCH */
+    15148, /* ERROR_PRI_MERGE_VERSION_MISMATCH */
+    15149, /* ERROR_PRI_MERGE_MISSING_SCHEMA */
+    15150, /* ERROR_PRI_MERGE_LOAD_FILE_FAILED */
+    15151, /* ERROR_PRI_MERGE_ADD_FILE_FAILED */
+    15152, /* ERROR_PRI_MERGE_WRITE_FILE_FAILED */
+    15153, /* ERROR_PRI_MERGE_MULTIPLE_PACKAGE_FAMILIES_NOT_ALLOWED */
+    15154, /* ERROR_PRI_MERGE_MULTIPLE_MAIN_PACKAGES_NOT_ALLOWED */
+    15155, /* ERROR_PRI_MERGE_BUNDLE_PACKAGES_NOT_ALLOWED */
+    15156, /* ERROR_PRI_MERGE_MAIN_PACKAGE_REQUIRED */
+    15157, /* ERROR_PRI_MERGE_RESOURCE_PACKAGE_REQUIRED */
+    15158, /* ERROR_PRI_MERGE_INVALID_FILE_NAME */
+    15159, /* ERROR_MRM_PACKAGE_NOT_FOUND */
+    15160, /* ERROR_MRM_MISSING_DEFAULT_LANGUAGE */
+    15200, /* ERROR_MCA_INVALID_CAPABILITIES_STRING */
+    15201, /* ERROR_MCA_INVALID_VCP_VERSION */
+    15202, /* ERROR_MCA_MONITOR_VIOLATES_MCCS_SPECIFICATION */
+    15203, /* ERROR_MCA_MCCS_VERSION_MISMATCH */
+    15204, /* ERROR_MCA_UNSUPPORTED_MCCS_VERSION */
+    15205, /* ERROR_MCA_INTERNAL_ERROR */
+    15206, /* ERROR_MCA_INVALID_TECHNOLOGY_TYPE_RETURNED */
+    15207, /* ERROR_MCA_UNSUPPORTED_COLOR_TEMPERATURE */
+    15250, /* ERROR_AMBIGUOUS_SYSTEM_DEVICE */
+    15299, /* ERROR_SYSTEM_DEVICE_NOT_FOUND */
+    15300, /* ERROR_HASH_NOT_SUPPORTED */
+    15301, /* ERROR_HASH_NOT_PRESENT */
+    15321, /* ERROR_SECONDARY_IC_PROVIDER_NOT_REGISTERED */
+    15322, /* ERROR_GPIO_CLIENT_INFORMATION_INVALID */
+    15323, /* ERROR_GPIO_VERSION_NOT_SUPPORTED */
+    15324, /* ERROR_GPIO_INVALID_REGISTRATION_PACKET */
+    15325, /* ERROR_GPIO_OPERATION_DENIED */
+    15326, /* ERROR_GPIO_INCOMPATIBLE_CONNECT_MODE */
+    15327, /* ERROR_GPIO_INTERRUPT_ALREADY_UNMASKED */
+    15400, /* ERROR_CANNOT_SWITCH_RUNLEVEL */
+    15401, /* ERROR_INVALID_RUNLEVEL_SETTING */
+    15402, /* ERROR_RUNLEVEL_SWITCH_TIMEOUT */
+    15403, /* ERROR_RUNLEVEL_SWITCH_AGENT_TIMEOUT */
+    15404, /* ERROR_RUNLEVEL_SWITCH_IN_PROGRESS */
+    15405, /* ERROR_SERVICES_FAILED_AUTOSTART */
+    15501, /* ERROR_COM_TASK_STOP_PENDING */
+    15600, /* ERROR_INSTALL_OPEN_PACKAGE_FAILED */
+    15601, /* ERROR_INSTALL_PACKAGE_NOT_FOUND */
+    15602, /* ERROR_INSTALL_INVALID_PACKAGE */
+    15603, /* ERROR_INSTALL_RESOLVE_DEPENDENCY_FAILED */
+    15604, /* ERROR_INSTALL_OUT_OF_DISK_SPACE */
+    15605, /* ERROR_INSTALL_NETWORK_FAILURE */
+    15606, /* ERROR_INSTALL_REGISTRATION_FAILURE */
+    15607, /* ERROR_INSTALL_DEREGISTRATION_FAILURE */
+    15608, /* ERROR_INSTALL_CANCEL */
+    15609, /* ERROR_INSTALL_FAILED */
+    15610, /* ERROR_REMOVE_FAILED */
+    15611, /* ERROR_PACKAGE_ALREADY_EXISTS */
+    15612, /* ERROR_NEEDS_REMEDIATION */
+    15613, /* ERROR_INSTALL_PREREQUISITE_FAILED */
+    15614, /* ERROR_PACKAGE_REPOSITORY_CORRUPTED */
+    15615, /* ERROR_INSTALL_POLICY_FAILURE */
+    15616, /* ERROR_PACKAGE_UPDATING */
+    15617, /* ERROR_DEPLOYMENT_BLOCKED_BY_POLICY */
+    15618, /* ERROR_PACKAGES_IN_USE */
+    15619, /* ERROR_RECOVERY_FILE_CORRUPT */
+    15620, /* ERROR_INVALID_STAGED_SIGNATURE */
+    15621, /* ERROR_DELETING_EXISTING_APPLICATIONDATA_STORE_FAILED */
+    15622, /* ERROR_INSTALL_PACKAGE_DOWNGRADE */
+    15623, /* ERROR_SYSTEM_NEEDS_REMEDIATION */
+    15624, /* ERROR_APPX_INTEGRITY_FAILURE_CLR_NGEN */
+    15625, /* ERROR_RESILIENCY_FILE_CORRUPT */
+    15626, /* ERROR_INSTALL_FIREWALL_SERVICE_NOT_RUNNING */
+    15627, /* ERROR_PACKAGE_MOVE_FAILED */
+    15628, /* ERROR_INSTALL_VOLUME_NOT_EMPTY */
+    15629, /* ERROR_INSTALL_VOLUME_OFFLINE */
+    15630, /* ERROR_INSTALL_VOLUME_CORRUPT */
+    15631, /* ERROR_NEEDS_REGISTRATION */
+    15632, /* ERROR_INSTALL_WRONG_PROCESSOR_ARCHITECTURE */
+    15633, /* ERROR_DEV_SIDELOAD_LIMIT_EXCEEDED */
+    15634, /* ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE */
+    15635, /* ERROR_PACKAGE_NOT_SUPPORTED_ON_FILESYSTEM */
+    15636, /* ERROR_PACKAGE_MOVE_BLOCKED_BY_STREAMING */
+    15637, /* ERROR_INSTALL_OPTIONAL_PACKAGE_APPLICATIONID_NOT_UNIQUE */
+    15638, /* ERROR_PACKAGE_STAGING_ONHOLD */
+    15639, /* ERROR_INSTALL_INVALID_RELATED_SET_UPDATE */
+    15640, /* ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY */
+    15641, /* ERROR_DEPLOYMENT_BLOCKED_BY_USER_LOG_OFF */
+    15642, /* ERROR_PROVISION_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_PROVISIONED */
+    15643, /* ERROR_PACKAGES_REPUTATION_CHECK_FAILED */
+    15644, /* ERROR_PACKAGES_REPUTATION_CHECK_TIMEDOUT */
+    15645, /* ERROR_DEPLOYMENT_OPTION_NOT_SUPPORTED */
+    15646, /* ERROR_APPINSTALLER_ACTIVATION_BLOCKED */
+    15647, /* ERROR_REGISTRATION_FROM_REMOTE_DRIVE_NOT_SUPPORTED */
+    15648, /* ERROR_APPX_RAW_DATA_WRITE_FAILED */
+    15649, /* ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_PACKAGE */
+    15650, /* ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_MACHINE */
+    15651, /* ERROR_DEPLOYMENT_BLOCKED_BY_PROFILE_POLICY */
+    15652, /* ERROR_DEPLOYMENT_FAILED_CONFLICTING_MUTABLE_PACKAGE_DIRECTORY */
+    15653, /* ERROR_SINGLETON_RESOURCE_INSTALLED_IN_ACTIVE_USER */
+    15654, /* ERROR_DIFFERENT_VERSION_OF_PACKAGED_SERVICE_INSTALLED */
+    15655, /* ERROR_SERVICE_EXISTS_AS_NON_PACKAGED_SERVICE */
+    15656, /* ERROR_PACKAGED_SERVICE_REQUIRES_ADMIN_PRIVILEGES */
+    15657, /* ERROR_REDIRECTION_TO_DEFAULT_ACCOUNT_NOT_ALLOWED */
+    15658, /* ERROR_PACKAGE_LACKS_CAPABILITY_TO_DEPLOY_ON_HOST */
+    15659, /* ERROR_UNSIGNED_PACKAGE_INVALID_CONTENT */
+    15660, /* ERROR_UNSIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE */
+    15661, /* ERROR_SIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE */
+    15662, /* ERROR_PACKAGE_EXTERNAL_LOCATION_NOT_ALLOWED */
+    15663, /* ERROR_INSTALL_FULLTRUST_HOSTRUNTIME_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY */
+    15664, /* ERROR_PACKAGE_LACKS_CAPABILITY_FOR_MANDATORY_STARTUPTASKS */
+    15665, /* ERROR_INSTALL_RESOLVE_HOSTRUNTIME_DEPENDENCY_FAILED */
+    15666, /* ERROR_MACHINE_SCOPE_NOT_ALLOWED */
+    15667, /* ERROR_CLASSIC_COMPAT_MODE_NOT_ALLOWED */
+    15668, /* ERROR_STAGEFROMUPDATEAGENT_PACKAGE_NOT_APPLICABLE */
+    15669, /* ERROR_PACKAGE_NOT_REGISTERED_FOR_USER */
+    15800, /* ERROR_STATE_LOAD_STORE_FAILED */
+    15801, /* ERROR_STATE_GET_VERSION_FAILED */
+    15802, /* ERROR_STATE_SET_VERSION_FAILED */
+    15803, /* ERROR_STATE_STRUCTURED_RESET_FAILED */
+    15804, /* ERROR_STATE_OPEN_CONTAINER_FAILED */
+    15805, /* ERROR_STATE_CREATE_CONTAINER_FAILED */
+    15806, /* ERROR_STATE_DELETE_CONTAINER_FAILED */
+    15807, /* ERROR_STATE_READ_SETTING_FAILED */
+    15808, /* ERROR_STATE_WRITE_SETTING_FAILED */
+    15809, /* ERROR_STATE_DELETE_SETTING_FAILED */
+    15810, /* ERROR_STATE_QUERY_SETTING_FAILED */
+    15811, /* ERROR_STATE_READ_COMPOSITE_SETTING_FAILED */
+    15812, /* ERROR_STATE_WRITE_COMPOSITE_SETTING_FAILED */
+    15813, /* ERROR_STATE_ENUMERATE_CONTAINER_FAILED */
+    15814, /* ERROR_STATE_ENUMERATE_SETTINGS_FAILED */
+    15815, /* ERROR_STATE_COMPOSITE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED */
+    15816, /* ERROR_STATE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED */
+    15817, /* ERROR_STATE_SETTING_NAME_SIZE_LIMIT_EXCEEDED */
+    15818, /* ERROR_STATE_CONTAINER_NAME_SIZE_LIMIT_EXCEEDED */
+    15841, /* ERROR_API_UNAVAILABLE */
+    3407873, /* ERROR_NDIS_INDICATION_REQUIRED */
+    3473497, /* ERROR_HV_PENDING_PAGE_REQUESTS */
+    2150891522, /* ERROR_NDIS_INTERFACE_CLOSING */
+    2150891524, /* ERROR_NDIS_BAD_VERSION */
+    2150891525, /* ERROR_NDIS_BAD_CHARACTERISTICS */
+    2150891526, /* ERROR_NDIS_ADAPTER_NOT_FOUND */
+    2150891527, /* ERROR_NDIS_OPEN_FAILED */
+    2150891528, /* ERROR_NDIS_DEVICE_FAILED */
+    2150891529, /* ERROR_NDIS_MULTICAST_FULL */
+    2150891530, /* ERROR_NDIS_MULTICAST_EXISTS */
+    2150891531, /* ERROR_NDIS_MULTICAST_NOT_FOUND */
+    2150891532, /* ERROR_NDIS_REQUEST_ABORTED */
+    2150891533, /* ERROR_NDIS_RESET_IN_PROGRESS */
+    2150891535, /* ERROR_NDIS_INVALID_PACKET */
+    2150891536, /* ERROR_NDIS_INVALID_DEVICE_REQUEST */
+    2150891537, /* ERROR_NDIS_ADAPTER_NOT_READY */
+    2150891540, /* ERROR_NDIS_INVALID_LENGTH */
+    2150891541, /* ERROR_NDIS_INVALID_DATA */
+    2150891542, /* ERROR_NDIS_BUFFER_TOO_SHORT */
+    2150891543, /* ERROR_NDIS_INVALID_OID */
+    2150891544, /* ERROR_NDIS_ADAPTER_REMOVED */
+    2150891545, /* ERROR_NDIS_UNSUPPORTED_MEDIA */
+    2150891546, /* ERROR_NDIS_GROUP_ADDRESS_IN_USE */
+    2150891547, /* ERROR_NDIS_FILE_NOT_FOUND */
+    2150891548, /* ERROR_NDIS_ERROR_READING_FILE */
+    2150891549, /* ERROR_NDIS_ALREADY_MAPPED */
+    2150891550, /* ERROR_NDIS_RESOURCE_CONFLICT */
+    2150891551, /* ERROR_NDIS_MEDIA_DISCONNECTED */
+    2150891554, /* ERROR_NDIS_INVALID_ADDRESS */
+    2150891562, /* ERROR_NDIS_PAUSED */
+    2150891563, /* ERROR_NDIS_INTERFACE_NOT_FOUND */
+    2150891564, /* ERROR_NDIS_UNSUPPORTED_REVISION */
+    2150891565, /* ERROR_NDIS_INVALID_PORT */
+    2150891566, /* ERROR_NDIS_INVALID_PORT_STATE */
+    2150891567, /* ERROR_NDIS_LOW_POWER_STATE */
+    2150891568, /* ERROR_NDIS_REINIT_REQUIRED */
+    2150891569, /* ERROR_NDIS_NO_QUEUES */
+    2150891707, /* ERROR_NDIS_NOT_SUPPORTED */
+    2150899712, /* ERROR_NDIS_DOT11_AUTO_CONFIG_ENABLED */
+    2150899713, /* ERROR_NDIS_DOT11_MEDIA_IN_USE */
+    2150899714, /* ERROR_NDIS_DOT11_POWER_STATE_INVALID */
+    2150899715, /* ERROR_NDIS_PM_WOL_PATTERN_LIST_FULL */
+    2150899716, /* ERROR_NDIS_PM_PROTOCOL_OFFLOAD_LIST_FULL */
+    2150899717, /* ERROR_NDIS_DOT11_AP_CHANNEL_CURRENTLY_NOT_AVAILABLE */
+    2150899718, /* ERROR_NDIS_DOT11_AP_BAND_CURRENTLY_NOT_AVAILABLE */
+    2150899719, /* ERROR_NDIS_DOT11_AP_CHANNEL_NOT_ALLOWED */
+    2150899720, /* ERROR_NDIS_DOT11_AP_BAND_NOT_ALLOWED */
+    2151088129, /* ERROR_VID_REMOTE_NODE_PARENT_GPA_PAGES_USED */
+    2151153665, /* ERROR_VOLMGR_INCOMPLETE_REGENERATION */
+    2151153666, /* ERROR_VOLMGR_INCOMPLETE_DISK_MIGRATION */
+    2151219201, /* ERROR_BCD_NOT_ALL_ENTRIES_IMPORTED */
+    2151219203, /* ERROR_BCD_NOT_ALL_ENTRIES_SYNCHRONIZED */
+    2151284737, /* ERROR_QUERY_STORAGE_ERROR */
+    3224637455, /* ERROR_NDIS_OFFLOAD_POLICY */
+    3224637458, /* ERROR_NDIS_OFFLOAD_CONNECTION_REJECTED */
+    3224637459, /* ERROR_NDIS_OFFLOAD_PATH_REJECTED */
+    3224698882, /* ERROR_HV_INVALID_HYPERCALL_CODE */
+    3224698883, /* ERROR_HV_INVALID_HYPERCALL_INPUT */
+    3224698884, /* ERROR_HV_INVALID_ALIGNMENT */
+    3224698885, /* ERROR_HV_INVALID_PARAMETER */
+    3224698886, /* ERROR_HV_ACCESS_DENIED */
+    3224698887, /* ERROR_HV_INVALID_PARTITION_STATE */
+    3224698888, /* ERROR_HV_OPERATION_DENIED */
+    3224698889, /* ERROR_HV_UNKNOWN_PROPERTY */
+    3224698890, /* ERROR_HV_PROPERTY_VALUE_OUT_OF_RANGE */
+    3224698891, /* ERROR_HV_INSUFFICIENT_MEMORY */
+    3224698892, /* ERROR_HV_PARTITION_TOO_DEEP */
+    3224698893, /* ERROR_HV_INVALID_PARTITION_ID */
+    3224698894, /* ERROR_HV_INVALID_VP_INDEX */
+    3224698897, /* ERROR_HV_INVALID_PORT_ID */
+    3224698898, /* ERROR_HV_INVALID_CONNECTION_ID */
+    3224698899, /* ERROR_HV_INSUFFICIENT_BUFFERS */
+    3224698900, /* ERROR_HV_NOT_ACKNOWLEDGED */
+    3224698901, /* ERROR_HV_INVALID_VP_STATE */
+    3224698902, /* ERROR_HV_ACKNOWLEDGED */
+    3224698903, /* ERROR_HV_INVALID_SAVE_RESTORE_STATE */
+    3224698904, /* ERROR_HV_INVALID_SYNIC_STATE */
+    3224698905, /* ERROR_HV_OBJECT_IN_USE */
+    3224698906, /* ERROR_HV_INVALID_PROXIMITY_DOMAIN_INFO */
+    3224698907, /* ERROR_HV_NO_DATA */
+    3224698908, /* ERROR_HV_INACTIVE */
+    3224698909, /* ERROR_HV_NO_RESOURCES */
+    3224698910, /* ERROR_HV_FEATURE_UNAVAILABLE */
+    3224698931, /* ERROR_HV_INSUFFICIENT_BUFFER */
+    3224698936, /* ERROR_HV_INSUFFICIENT_DEVICE_DOMAINS */
+    3224698940, /* ERROR_HV_CPUID_FEATURE_VALIDATION */
+    3224698941, /* ERROR_HV_CPUID_XSAVE_FEATURE_VALIDATION */
+    3224698942, /* ERROR_HV_PROCESSOR_STARTUP_TIMEOUT */
+    3224698943, /* ERROR_HV_SMX_ENABLED */
+    3224698945, /* ERROR_HV_INVALID_LP_INDEX */
+    3224698960, /* ERROR_HV_INVALID_REGISTER_VALUE */
+    3224698961, /* ERROR_HV_INVALID_VTL_STATE */
+    3224698965, /* ERROR_HV_NX_NOT_DETECTED */
+    3224698967, /* ERROR_HV_INVALID_DEVICE_ID */
+    3224698968, /* ERROR_HV_INVALID_DEVICE_STATE */
+    3224698976, /* ERROR_HV_PAGE_REQUEST_INVALID */
+    3224698991, /* ERROR_HV_INVALID_CPU_GROUP_ID */
+    3224698992, /* ERROR_HV_INVALID_CPU_GROUP_STATE */
+    3224698993, /* ERROR_HV_OPERATION_FAILED */
+    3224698994, /* ERROR_HV_NOT_ALLOWED_WITH_NESTED_VIRT_ACTIVE */
+    3224698995, /* ERROR_HV_INSUFFICIENT_ROOT_MEMORY */
+    3224698996, /* ERROR_HV_EVENT_BUFFER_ALREADY_FREED */
+    3224698997, /* ERROR_HV_INSUFFICIENT_CONTIGUOUS_MEMORY */
+    3224698998, /* ERROR_HV_DEVICE_NOT_IN_DOMAIN */
+    3224698999, /* ERROR_HV_NESTED_VM_EXIT */
+    3224699008, /* ERROR_HV_MSR_ACCESS_FAILED */
+    3224702976, /* ERROR_HV_NOT_PRESENT */
+    3224829953, /* ERROR_VID_DUPLICATE_HANDLER */
+    3224829954, /* ERROR_VID_TOO_MANY_HANDLERS */
+    3224829955, /* ERROR_VID_QUEUE_FULL */
+    3224829956, /* ERROR_VID_HANDLER_NOT_PRESENT */
+    3224829957, /* ERROR_VID_INVALID_OBJECT_NAME */
+    3224829958, /* ERROR_VID_PARTITION_NAME_TOO_LONG */
+    3224829959, /* ERROR_VID_MESSAGE_QUEUE_NAME_TOO_LONG */
+    3224829960, /* ERROR_VID_PARTITION_ALREADY_EXISTS */
+    3224829961, /* ERROR_VID_PARTITION_DOES_NOT_EXIST */
+    3224829962, /* ERROR_VID_PARTITION_NAME_NOT_FOUND */
+    3224829963, /* ERROR_VID_MESSAGE_QUEUE_ALREADY_EXISTS */
+    3224829964, /* ERROR_VID_EXCEEDED_MBP_ENTRY_MAP_LIMIT */
+    3224829965, /* ERROR_VID_MB_STILL_REFERENCED */
+    3224829966, /* ERROR_VID_CHILD_GPA_PAGE_SET_CORRUPTED */
+    3224829967, /* ERROR_VID_INVALID_NUMA_SETTINGS */
+    3224829968, /* ERROR_VID_INVALID_NUMA_NODE_INDEX */
+    3224829969, /* ERROR_VID_NOTIFICATION_QUEUE_ALREADY_ASSOCIATED */
+    3224829970, /* ERROR_VID_INVALID_MEMORY_BLOCK_HANDLE */
+    3224829971, /* ERROR_VID_PAGE_RANGE_OVERFLOW */
+    3224829972, /* ERROR_VID_INVALID_MESSAGE_QUEUE_HANDLE */
+    3224829973, /* ERROR_VID_INVALID_GPA_RANGE_HANDLE */
+    3224829974, /* ERROR_VID_NO_MEMORY_BLOCK_NOTIFICATION_QUEUE */
+    3224829975, /* ERROR_VID_MEMORY_BLOCK_LOCK_COUNT_EXCEEDED */
+    3224829976, /* ERROR_VID_INVALID_PPM_HANDLE */
+    3224829977, /* ERROR_VID_MBPS_ARE_LOCKED */
+    3224829978, /* ERROR_VID_MESSAGE_QUEUE_CLOSED */
+    3224829979, /* ERROR_VID_VIRTUAL_PROCESSOR_LIMIT_EXCEEDED */
+    3224829980, /* ERROR_VID_STOP_PENDING */
+    3224829981, /* ERROR_VID_INVALID_PROCESSOR_STATE */
+    3224829982, /* ERROR_VID_EXCEEDED_KM_CONTEXT_COUNT_LIMIT */
+    3224829983, /* ERROR_VID_KM_INTERFACE_ALREADY_INITIALIZED */
+    3224829984, /* ERROR_VID_MB_PROPERTY_ALREADY_SET_RESET */
+    3224829985, /* ERROR_VID_MMIO_RANGE_DESTROYED */
+    3224829986, /* ERROR_VID_INVALID_CHILD_GPA_PAGE_SET */
+    3224829987, /* ERROR_VID_RESERVE_PAGE_SET_IS_BEING_USED */
+    3224829988, /* ERROR_VID_RESERVE_PAGE_SET_TOO_SMALL */
+    3224829989, /* ERROR_VID_MBP_ALREADY_LOCKED_USING_RESERVED_PAGE */
+    3224829990, /* ERROR_VID_MBP_COUNT_EXCEEDED_LIMIT */
+    3224829991, /* ERROR_VID_SAVED_STATE_CORRUPT */
+    3224829992, /* ERROR_VID_SAVED_STATE_UNRECOGNIZED_ITEM */
+    3224829993, /* ERROR_VID_SAVED_STATE_INCOMPATIBLE */
+    3224829994, /* ERROR_VID_VTL_ACCESS_DENIED */
+    3224830208, /* ERROR_VMCOMPUTE_TERMINATED_DURING_START */
+    3224830209, /* ERROR_VMCOMPUTE_IMAGE_MISMATCH */
+    3224830210, /* ERROR_VMCOMPUTE_HYPERV_NOT_INSTALLED */
+    3224830211, /* ERROR_VMCOMPUTE_OPERATION_PENDING */
+    3224830212, /* ERROR_VMCOMPUTE_TOO_MANY_NOTIFICATIONS */
+    3224830213, /* ERROR_VMCOMPUTE_INVALID_STATE */
+    3224830214, /* ERROR_VMCOMPUTE_UNEXPECTED_EXIT */
+    3224830215, /* ERROR_VMCOMPUTE_TERMINATED */
+    3224830216, /* ERROR_VMCOMPUTE_CONNECT_FAILED */
+    3224830217, /* ERROR_VMCOMPUTE_TIMEOUT */
+    3224830218, /* ERROR_VMCOMPUTE_CONNECTION_CLOSED */
+    3224830219, /* ERROR_VMCOMPUTE_UNKNOWN_MESSAGE */
+    3224830220, /* ERROR_VMCOMPUTE_UNSUPPORTED_PROTOCOL_VERSION */
+    3224830221, /* ERROR_VMCOMPUTE_INVALID_JSON */
+    3224830222, /* ERROR_VMCOMPUTE_SYSTEM_NOT_FOUND */
+    3224830223, /* ERROR_VMCOMPUTE_SYSTEM_ALREADY_EXISTS */
+    3224830224, /* ERROR_VMCOMPUTE_SYSTEM_ALREADY_STOPPED */
+    3224830225, /* ERROR_VMCOMPUTE_PROTOCOL_ERROR */
+    3224830226, /* ERROR_VMCOMPUTE_INVALID_LAYER */
+    3224830227, /* ERROR_VMCOMPUTE_WINDOWS_INSIDER_REQUIRED */
+    3224830464, /* ERROR_VNET_VIRTUAL_SWITCH_NAME_NOT_FOUND */
+    3224830976, /* ERROR_VSMB_SAVED_STATE_FILE_NOT_FOUND */
+    3224830977, /* ERROR_VSMB_SAVED_STATE_CORRUPT */
+    3224895489, /* ERROR_VOLMGR_DATABASE_FULL */
+    3224895490, /* ERROR_VOLMGR_DISK_CONFIGURATION_CORRUPTED */
+    3224895491, /* ERROR_VOLMGR_DISK_CONFIGURATION_NOT_IN_SYNC */
+    3224895492, /* ERROR_VOLMGR_PACK_CONFIG_UPDATE_FAILED */
+    3224895493, /* ERROR_VOLMGR_DISK_CONTAINS_NON_SIMPLE_VOLUME */
+    3224895494, /* ERROR_VOLMGR_DISK_DUPLICATE */
+    3224895495, /* ERROR_VOLMGR_DISK_DYNAMIC */
+    3224895496, /* ERROR_VOLMGR_DISK_ID_INVALID */
+    3224895497, /* ERROR_VOLMGR_DISK_INVALID */
+    3224895498, /* ERROR_VOLMGR_DISK_LAST_VOTER */
+    3224895499, /* ERROR_VOLMGR_DISK_LAYOUT_INVALID */
+    3224895500, /* ERROR_VOLMGR_DISK_LAYOUT_NON_BASIC_BETWEEN_BASIC_PARTITIONS */
+    3224895501, /* ERROR_VOLMGR_DISK_LAYOUT_NOT_CYLINDER_ALIGNED */
+    3224895502, /* ERROR_VOLMGR_DISK_LAYOUT_PARTITIONS_TOO_SMALL */
+    3224895503, /* ERROR_VOLMGR_DISK_LAYOUT_PRIMARY_BETWEEN_LOGICAL_PARTITIONS */
+    3224895504, /* ERROR_VOLMGR_DISK_LAYOUT_TOO_MANY_PARTITIONS */
+    3224895505, /* ERROR_VOLMGR_DISK_MISSING */
+    3224895506, /* ERROR_VOLMGR_DISK_NOT_EMPTY */
+    3224895507, /* ERROR_VOLMGR_DISK_NOT_ENOUGH_SPACE */
+    3224895508, /* ERROR_VOLMGR_DISK_REVECTORING_FAILED */
+    3224895509, /* ERROR_VOLMGR_DISK_SECTOR_SIZE_INVALID */
+    3224895510, /* ERROR_VOLMGR_DISK_SET_NOT_CONTAINED */
+    3224895511, /* ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_MEMBERS */
+    3224895512, /* ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_PLEXES */
+    3224895513, /* ERROR_VOLMGR_DYNAMIC_DISK_NOT_SUPPORTED */
+    3224895514, /* ERROR_VOLMGR_EXTENT_ALREADY_USED */
+    3224895515, /* ERROR_VOLMGR_EXTENT_NOT_CONTIGUOUS */
+    3224895516, /* ERROR_VOLMGR_EXTENT_NOT_IN_PUBLIC_REGION */
+    3224895517, /* ERROR_VOLMGR_EXTENT_NOT_SECTOR_ALIGNED */
+    3224895518, /* ERROR_VOLMGR_EXTENT_OVERLAPS_EBR_PARTITION */
+    3224895519, /* ERROR_VOLMGR_EXTENT_VOLUME_LENGTHS_DO_NOT_MATCH */
+    3224895520, /* ERROR_VOLMGR_FAULT_TOLERANT_NOT_SUPPORTED */
+    3224895521, /* ERROR_VOLMGR_INTERLEAVE_LENGTH_INVALID */
+    3224895522, /* ERROR_VOLMGR_MAXIMUM_REGISTERED_USERS */
+    3224895523, /* ERROR_VOLMGR_MEMBER_IN_SYNC */
+    3224895524, /* ERROR_VOLMGR_MEMBER_INDEX_DUPLICATE */
+    3224895525, /* ERROR_VOLMGR_MEMBER_INDEX_INVALID */
+    3224895526, /* ERROR_VOLMGR_MEMBER_MISSING */
+    3224895527, /* ERROR_VOLMGR_MEMBER_NOT_DETACHED */
+    3224895528, /* ERROR_VOLMGR_MEMBER_REGENERATING */
+    3224895529, /* ERROR_VOLMGR_ALL_DISKS_FAILED */
+    3224895530, /* ERROR_VOLMGR_NO_REGISTERED_USERS */
+    3224895531, /* ERROR_VOLMGR_NO_SUCH_USER */
+    3224895532, /* ERROR_VOLMGR_NOTIFICATION_RESET */
+    3224895533, /* ERROR_VOLMGR_NUMBER_OF_MEMBERS_INVALID */
+    3224895534, /* ERROR_VOLMGR_NUMBER_OF_PLEXES_INVALID */
+    3224895535, /* ERROR_VOLMGR_PACK_DUPLICATE */
+    3224895536, /* ERROR_VOLMGR_PACK_ID_INVALID */
+    3224895537, /* ERROR_VOLMGR_PACK_INVALID */
+    3224895538, /* ERROR_VOLMGR_PACK_NAME_INVALID */
+    3224895539, /* ERROR_VOLMGR_PACK_OFFLINE */
+    3224895540, /* ERROR_VOLMGR_PACK_HAS_QUORUM */
+    3224895541, /* ERROR_VOLMGR_PACK_WITHOUT_QUORUM */
+    3224895542, /* ERROR_VOLMGR_PARTITION_STYLE_INVALID */
+    3224895543, /* ERROR_VOLMGR_PARTITION_UPDATE_FAILED */
+    3224895544, /* ERROR_VOLMGR_PLEX_IN_SYNC */
+    3224895545, /* ERROR_VOLMGR_PLEX_INDEX_DUPLICATE */
+    3224895546, /* ERROR_VOLMGR_PLEX_INDEX_INVALID */
+    3224895547, /* ERROR_VOLMGR_PLEX_LAST_ACTIVE */
+    3224895548, /* ERROR_VOLMGR_PLEX_MISSING */
+    3224895549, /* ERROR_VOLMGR_PLEX_REGENERATING */
+    3224895550, /* ERROR_VOLMGR_PLEX_TYPE_INVALID */
+    3224895551, /* ERROR_VOLMGR_PLEX_NOT_RAID5 */
+    3224895552, /* ERROR_VOLMGR_PLEX_NOT_SIMPLE */
+    3224895553, /* ERROR_VOLMGR_STRUCTURE_SIZE_INVALID */
+    3224895554, /* ERROR_VOLMGR_TOO_MANY_NOTIFICATION_REQUESTS */
+    3224895555, /* ERROR_VOLMGR_TRANSACTION_IN_PROGRESS */
+    3224895556, /* ERROR_VOLMGR_UNEXPECTED_DISK_LAYOUT_CHANGE */
+    3224895557, /* ERROR_VOLMGR_VOLUME_CONTAINS_MISSING_DISK */
+    3224895558, /* ERROR_VOLMGR_VOLUME_ID_INVALID */
+    3224895559, /* ERROR_VOLMGR_VOLUME_LENGTH_INVALID */
+    3224895560, /* ERROR_VOLMGR_VOLUME_LENGTH_NOT_SECTOR_SIZE_MULTIPLE */
+    3224895561, /* ERROR_VOLMGR_VOLUME_NOT_MIRRORED */
+    3224895562, /* ERROR_VOLMGR_VOLUME_NOT_RETAINED */
+    3224895563, /* ERROR_VOLMGR_VOLUME_OFFLINE */
+    3224895564, /* ERROR_VOLMGR_VOLUME_RETAINED */
+    3224895565, /* ERROR_VOLMGR_NUMBER_OF_EXTENTS_INVALID */
+    3224895566, /* ERROR_VOLMGR_DIFFERENT_SECTOR_SIZE */
+    3224895567, /* ERROR_VOLMGR_BAD_BOOT_DISK */
+    3224895568, /* ERROR_VOLMGR_PACK_CONFIG_OFFLINE */
+    3224895569, /* ERROR_VOLMGR_PACK_CONFIG_ONLINE */
+    3224895570, /* ERROR_VOLMGR_NOT_PRIMARY_PACK */
+    3224895571, /* ERROR_VOLMGR_PACK_LOG_UPDATE_FAILED */
+    3224895572, /* ERROR_VOLMGR_NUMBER_OF_DISKS_IN_PLEX_INVALID */
+    3224895573, /* ERROR_VOLMGR_NUMBER_OF_DISKS_IN_MEMBER_INVALID */
+    3224895574, /* ERROR_VOLMGR_VOLUME_MIRRORED */
+    3224895575, /* ERROR_VOLMGR_PLEX_NOT_SIMPLE_SPANNED */
+    3224895576, /* ERROR_VOLMGR_NO_VALID_LOG_COPIES */
+    3224895577, /* ERROR_VOLMGR_PRIMARY_PACK_PRESENT */
+    3224895578, /* ERROR_VOLMGR_NUMBER_OF_DISKS_INVALID */
+    3224895579, /* ERROR_VOLMGR_MIRROR_NOT_SUPPORTED */
+    3224895580, /* ERROR_VOLMGR_RAID5_NOT_SUPPORTED */
+    3224961026, /* ERROR_BCD_TOO_MANY_ELEMENTS */
+    3225026561, /* ERROR_VHD_DRIVE_FOOTER_MISSING */
+    3225026562, /* ERROR_VHD_DRIVE_FOOTER_CHECKSUM_MISMATCH */
+    3225026563, /* ERROR_VHD_DRIVE_FOOTER_CORRUPT */
+    3225026564, /* ERROR_VHD_FORMAT_UNKNOWN */
+    3225026565, /* ERROR_VHD_FORMAT_UNSUPPORTED_VERSION */
+    3225026566, /* ERROR_VHD_SPARSE_HEADER_CHECKSUM_MISMATCH */
+    3225026567, /* ERROR_VHD_SPARSE_HEADER_UNSUPPORTED_VERSION */
+    3225026568, /* ERROR_VHD_SPARSE_HEADER_CORRUPT */
+    3225026569, /* ERROR_VHD_BLOCK_ALLOCATION_FAILURE */
+    3225026570, /* ERROR_VHD_BLOCK_ALLOCATION_TABLE_CORRUPT */
+    3225026571, /* ERROR_VHD_INVALID_BLOCK_SIZE */
+    3225026572, /* ERROR_VHD_BITMAP_MISMATCH */
+    3225026573, /* ERROR_VHD_PARENT_VHD_NOT_FOUND */
+    3225026574, /* ERROR_VHD_CHILD_PARENT_ID_MISMATCH */
+    3225026575, /* ERROR_VHD_CHILD_PARENT_TIMESTAMP_MISMATCH */
+    3225026576, /* ERROR_VHD_METADATA_READ_FAILURE */
+    3225026577, /* ERROR_VHD_METADATA_WRITE_FAILURE */
+    3225026578, /* ERROR_VHD_INVALID_SIZE */
+    3225026579, /* ERROR_VHD_INVALID_FILE_SIZE */
+    3225026580, /* ERROR_VIRTDISK_PROVIDER_NOT_FOUND */
+    3225026581, /* ERROR_VIRTDISK_NOT_VIRTUAL_DISK */
+    3225026582, /* ERROR_VHD_PARENT_VHD_ACCESS_DENIED */
+    3225026583, /* ERROR_VHD_CHILD_PARENT_SIZE_MISMATCH */
+    3225026584, /* ERROR_VHD_DIFFERENCING_CHAIN_CYCLE_DETECTED */
+    3225026585, /* ERROR_VHD_DIFFERENCING_CHAIN_ERROR_IN_PARENT */
+    3225026586, /* ERROR_VIRTUAL_DISK_LIMITATION */
+    3225026587, /* ERROR_VHD_INVALID_TYPE */
+    3225026588, /* ERROR_VHD_INVALID_STATE */
+    3225026589, /* ERROR_VIRTDISK_UNSUPPORTED_DISK_SECTOR_SIZE */
+    3225026590, /* ERROR_VIRTDISK_DISK_ALREADY_OWNED */
+    3225026591, /* ERROR_VIRTDISK_DISK_ONLINE_AND_WRITABLE */
+    3225026592, /* ERROR_CTLOG_TRACKING_NOT_INITIALIZED */
+    3225026593, /* ERROR_CTLOG_LOGFILE_SIZE_EXCEEDED_MAXSIZE */
+    3225026594, /* ERROR_CTLOG_VHD_CHANGED_OFFLINE */
+    3225026595, /* ERROR_CTLOG_INVALID_TRACKING_STATE */
+    3225026596, /* ERROR_CTLOG_INCONSISTENT_TRACKING_FILE */
+    3225026597, /* ERROR_VHD_RESIZE_WOULD_TRUNCATE_DATA */
+    3225026598, /* ERROR_VHD_COULD_NOT_COMPUTE_MINIMUM_VIRTUAL_SIZE */
+    3225026599, /* ERROR_VHD_ALREADY_AT_OR_BELOW_MINIMUM_VIRTUAL_SIZE */
+    3225026600, /* ERROR_VHD_METADATA_FULL */
+    3225026601, /* ERROR_VHD_INVALID_CHANGE_TRACKING_ID */
+    3225026602, /* ERROR_VHD_CHANGE_TRACKING_DISABLED */
+    3225026608, /* ERROR_VHD_MISSING_CHANGE_TRACKING_INFORMATION */
+    4294967295, /* WAIT_FAILED */
+};
+
+static const unsigned int gWinErrorSymOffsets[] = {
+    0, 14, 37, 58, 79, 105, 125, 146, 166, 190,
+    210, 232, 249, 270, 289, 307, 327, 351, 373, 393,
+    413, 428, 444, 462, 472, 489, 500, 519, 542, 561,
+    579, 596, 614, 638, 659, 676, 706, 723, 746, 766,
+    785, 800, 818, 837, 857, 877, 896, 915, 935, 954,
+    972, 993, 1015, 1037, 1065, 1084, 1103, 1124, 1144, 1165,
+    1185, 1204, 1222, 1240, 1255, 1279, 1302, 1325, 1349, 1371,
+    1391, 1417, 1446, 1463, 1491, 1523, 1544, 1565, 1583, 1602,
+    1620, 1638, 1660, 1676, 1705, 1733, 1756, 1784, 1807, 1834,
+    1852, 1878, 1897, 1917, 1939, 1959, 1980, 2003, 2028, 2055,
+    2075, 2096, 2117, 2133, 2150, 2167, 2185, 2204, 2225, 2245,
+    2265, 2282, 2299, 2318, 2338, 2358, 2377, 2393, 2415, 2434,
+    2460, 2486, 2512, 2533, 2553, 2574, 2590, 2607, 2631, 2651,
+    2670, 2691, 2715, 2733, 2744, 2777, 2800, 2833, 2862, 2884,
+    2905, 2931, 2951, 2982, 3005, 3030, 3058, 3083, 3104, 3136,
+    3163, 3195, 3218, 3239, 3269, 3300, 3331, 3360, 3383, 3404,
+    3431, 3456, 3486, 3514, 3538, 3551, 3574, 3600, 3632, 3670,
+    3715, 3738, 3762, 3782, 3803, 3829, 3850, 3870, 3887, 3902,
+    3918, 3932, 3957, 3973, 3992, 4014, 4036, 4063, 4076, 4096,
+    4114, 4130, 4150, 4172, 4192, 4216, 4240, 4256, 4277, 4296,
+    4321, 4351, 4377, 4398, 4457, 4497, 4535, 4560, 4594, 4634,
+    4666, 4693, 4719, 4752, 4783, 4803, 4838, 4861, 4883, 4905,
+    4923, 4948, 4974, 5000, 5037, 5073, 5106, 5144, 5172, 5194,
+    5221, 5247, 5275, 5309, 5345, 5375, 5400, 5423, 5449, 5483,
+    5514, 5549, 5589, 5622, 5657, 5692, 5724, 5756, 5778, 5805,
+    5825, 5844, 5871, 5903, 5943, 5977, 6016, 6060, 6088, 6115,
+    6140, 6178, 6212, 6248, 6289, 6338, 6366, 6402, 6447, 6497,
+    6535, 6585, 6607, 6648, 6696, 6719, 6748, 6783, 6814, 6847,
+    6881, 6922, 6957, 6982, 7033, 7072, 7112, 7149, 7179, 7216,
+    7240, 7264, 7297, 7331, 7362, 7402, 7442, 7476, 7512, 7549,
+    7582, 7620, 7654, 7691, 7719, 7750, 7783, 7828, 7858, 7899,
+    7950, 8000, 8050, 8084, 8106, 8139, 8176, 8213, 8245, 8268,
+    8291, 8319, 8352, 8386, 8411, 8444, 8464, 8494, 8523, 8549,
+    8586, 8619, 8640, 8680, 8708, 8751, 8788, 8823, 8856, 8890,
+    8921, 8947, 8985, 9023, 9064, 9098, 9130, 9158, 9189, 9220,
+    9247, 9278, 9308, 9333, 9361, 9397, 9432, 9464, 9502, 9542,
+    9568, 9608, 9642, 9684, 9710, 9748, 9794, 9842, 9870, 9892,
+    9924, 9959, 9991, 10020, 10047, 10081, 10114, 10150, 10187, 10224,
+    10263, 10297, 10321, 10349, 10377, 10413, 10447, 10487, 10520, 10548,
+    10581, 10607, 10628, 10649, 10669, 10687, 10706, 10723, 10748, 10761,
+    10777, 10805, 10835, 10863, 10889, 10919, 10950, 10978, 11006, 11032,
+    11057, 11073, 11099, 11130, 11160, 11191, 11216, 11242, 11265, 11290,
+    11319, 11342, 11370, 11400, 11428, 11459, 11481, 11507, 11528, 11553,
+    11579, 11602, 11631, 11656, 11674, 11702, 11722, 11754, 11778, 11804,
+    11824, 11863, 11887, 11915, 11940, 11972, 11998, 12030, 12054, 12075,
+    12103, 12132, 12160, 12199, 12221, 12247, 12270, 12295, 12317, 12341,
+    12363, 12392, 12411, 12442, 12472, 12497, 12526, 12553, 12580, 12607,
+    12632, 12652, 12673, 12700, 12730, 12755, 12790, 12820, 12848, 12877,
+    12906, 12930, 12952, 12978, 13004, 13032, 13060, 13087, 13105, 13131,
+    13157, 13182, 13212, 13245, 13271, 13296, 13327, 13349, 13368, 13399,
+    13421, 13448, 13474, 13505, 13536, 13574, 13592, 13620, 13648, 13681,
+    13713, 13739, 13758, 13787, 13811, 13828, 13848, 13872, 13901, 13934,
+    13955, 13982, 14003, 14032, 14061, 14079, 14108, 14133, 14148, 14176,
+    14201, 14231, 14259, 14291, 14323, 14345, 14380, 14407, 14435, 14455,
+    14482, 14505, 14529, 14557, 14582, 14609, 14633, 14659, 14686, 14714,
+    14749, 14773, 14807, 14829, 14853, 14885, 14902, 14922, 14949, 14970,
+    14994, 15013, 15040, 15057, 15078, 15098, 15136, 15161, 15188, 15216,
+    15244, 15272, 15289, 15314, 15337, 15372, 15390, 15403, 15416, 15429,
+    15443, 15466, 15490, 15505, 15522, 15536, 15561, 15575, 15606, 15627,
+    15649, 15670, 15709, 15737, 15766, 15797, 15825, 15854, 15878, 15895,
+    15918, 15939, 15975, 16002, 16029, 16054, 16075, 16105, 16146, 16187,
+    16219, 16241, 16269, 16288, 16313, 16340, 16365, 16391, 16413, 16438,
+    16463, 16481, 16511, 16537, 16560, 16582, 16609, 16671, 16706, 16749,
+    16769, 16798, 16842, 16866, 16915, 16964, 17009, 17030, 17059, 17090,
+    17117, 17145, 17175, 17206, 17232, 17260, 17296, 17332, 17358, 17385,
+    17408, 17436, 17462, 17492, 17524, 17569, 17590, 17611, 17640, 17662,
+    17691, 17715, 17747, 17796, 17828, 17858, 17881, 17905, 17925, 17942,
+    17957, 17973, 17994, 18016, 18039, 18059, 18085, 18104, 18126, 18141,
+    18153, 18166, 18181, 18196, 18212, 18237, 18260, 18285, 18309, 18327,
+    18346, 18369, 18398, 18420, 18453, 18483, 18513, 18537, 18567, 18597,
+    18627, 18650, 18676, 18705, 18738, 18763, 18803, 18830, 18860, 18889,
+    18911, 18941, 18968, 18993, 19020, 19052, 19073, 19099, 19132, 19160,
+    19188, 19217, 19249, 19284, 19318, 19344, 19369, 19396, 19415, 19439,
+    19464, 19487, 19510, 19534, 19561, 19590, 19617, 19646, 19666, 19682,
+    19706, 19735, 19757, 19784, 19814, 19830, 19853, 19868, 19886, 19908,
+    19939, 19967, 19994, 20021, 20051, 20079, 20103, 20122, 20153, 20177,
+    20200, 20229, 20258, 20279, 20301, 20320, 20346, 20362, 20380, 20401,
+    20416, 20436, 20463, 20487, 20514, 20545, 20575, 20602, 20639, 20670,
+    20693, 20720, 20736, 20751, 20771, 20793, 20819, 20838, 20870, 20903,
+    20938, 20971, 20996, 21023, 21051, 21079, 21107, 21138, 21183, 21200,
+    21225, 21257, 21282, 21301, 21327, 21345, 21365, 21386, 21410, 21437,
+    21461, 21486, 21512, 21534, 21558, 21585, 21611, 21637, 21671, 21707,
+    21728, 21745, 21761, 21784, 21809, 21835, 21868, 21897, 21922, 21946,
+    21972, 21995, 22022, 22045, 22067, 22092, 22104, 22133, 22162, 22192,
+    22216, 22241, 22265, 22289, 22309, 22324, 22350, 22372, 22391, 22422,
+    22446, 22471, 22494, 22521, 22555, 22571, 22593, 22614, 22634, 22666,
+    22692, 22715, 22736, 22770, 22795, 22816, 22846, 22883, 22922, 22943,
+    22975, 23006, 23044, 23067, 23087, 23108, 23135, 23166, 23190, 23214,
+    23235, 23260, 23293, 23310, 23346, 23378, 23405, 23432, 23468, 23494,
+    23516, 23553, 23568, 23588, 23611, 23633, 23661, 23690, 23713, 23736,
+    23760, 23780, 23808, 23837, 23866, 23889, 23917, 23941, 23966, 23993,
+    24011, 24030, 24049, 24069, 24091, 24117, 24134, 24155, 24181, 24208,
+    24228, 24254, 24280, 24306, 24329, 24352, 24370, 24401, 24423, 24451,
+    24469, 24487, 24516, 24542, 24564, 24590, 24617, 24647, 24678, 24708,
+    24734, 24761, 24782, 24810, 24840, 24867, 24894, 24920, 24941, 24961,
+    24989, 25018, 25039, 25064, 25092, 25116, 25143, 25165, 25195, 25225,
+    25250, 25275, 25301, 25328, 25350, 25370, 25389, 25417, 25444, 25464,
+    25490, 25512, 25531, 25555, 25578, 25600, 25624, 25651, 25680, 25715,
+    25736, 25757, 25777, 25812, 25833, 25852, 25871, 25897, 25926, 25950,
+    25975, 25991, 26024, 26052, 26078, 26106, 26133, 26159, 26184, 26207,
+    26235, 26264, 26296, 26323, 26350, 26374, 26394, 26420, 26447, 26474,
+    26503, 26528, 26556, 26580, 26607, 26638, 26664, 26690, 26709, 26735,
+    26761, 26783, 26806, 26829, 26854, 26879, 26904, 26930, 26967, 26991,
+    27012, 27039, 27063, 27091, 27120, 27143, 27168, 27192, 27218, 27245,
+    27265, 27295, 27325, 27351, 27383, 27412, 27436, 27457, 27480, 27506,
+    27536, 27564, 27605, 27619, 27648, 27669, 27698, 27726, 27748, 27768,
+    27794, 27818, 27839, 27864, 27886, 27914, 27940, 27960, 27988, 28013,
+    28036, 28060, 28085, 28114, 28144, 28167, 28189, 28211, 28233, 28255,
+    28279, 28302, 28329, 28353, 28372, 28400, 28430, 28456, 28479, 28499,
+    28520, 28550, 28584, 28614, 28639, 28665, 28700, 28732, 28763, 28789,
+    28811, 28831, 28855, 28878, 28898, 28928, 28963, 28985, 29017, 29045,
+    29077, 29099, 29126, 29158, 29189, 29218, 29247, 29280, 29312, 29344,
+    29364, 29388, 29419, 29443, 29482, 29513, 29539, 29562, 29589, 29611,
+    29638, 29663, 29695, 29731, 29757, 29782, 29808, 29835, 29864, 29899,
+    29919, 29946, 29968, 30002, 30041, 30060, 30089, 30118, 30147, 30170,
+    30197, 30226, 30256, 30279, 30305, 30345, 30385, 30420, 30452, 30482,
+    30512, 30542, 30572, 30602, 30625, 30644, 30668, 30692, 30714, 30736,
+    30764, 30791, 30825, 30850, 30868, 30891, 30919, 30943, 30965, 31001,
+    31037, 31076, 31113, 31152, 31171, 31202, 31236, 31263, 31280, 31307,
+    31336, 31366, 31395, 31413, 31435, 31455, 31477, 31497, 31538, 31562,
+    31587, 31609, 31634, 31658, 31684, 31709, 31745, 31776, 31815, 31834,
+    31854, 31871, 31896, 31916, 31944, 31972, 31999, 32021, 32041, 32081,
+    32119, 32147, 32174, 32204, 32234, 32265, 32289, 32317, 32346, 32382,
+    32418, 32445, 32473, 32510, 32543, 32581, 32609, 32630, 32668, 32701,
+    32739, 32785, 32818, 32841, 32872, 32899, 32930, 32964, 33010, 33054,
+    33098, 33136, 33169, 33198, 33237, 33280, 33316, 33350, 33387, 33421,
+    33455, 33493, 33530, 33562, 33603, 33644, 33689, 33720, 33752, 33779,
+    33799, 33828, 33846, 33863, 33881, 33904, 33926, 33954, 33979, 34008,
+    34035, 34055, 34078, 34112, 34138, 34166, 34195, 34215, 34237, 34263,
+    34290, 34310, 34332, 34355, 34383, 34419, 34452, 34472, 34494, 34519,
+    34546, 34566, 34588, 34600, 34616, 34640, 34664, 34686, 34708, 34731,
+    34754, 34774, 34799, 34826, 34850, 34876, 34903, 34925, 34952, 34971,
+    34999, 35027, 35059, 35090, 35126, 35147, 35172, 35208, 35231, 35258,
+    35288, 35310, 35338, 35369, 35401, 35423, 35450, 35484, 35502, 35521,
+    35553, 35586, 35612, 35645, 35672, 35698, 35725, 35757, 35782, 35805,
+    35828, 35858, 35889, 35924, 35958, 35990, 36034, 36069, 36098, 36129,
+    36168, 36200, 36252, 36290, 36332, 36373, 36419, 36452, 36493, 36530,
+    36568, 36606, 36645, 36673, 36711, 36740, 36777, 36815, 36841, 36870,
+    36911, 36951, 36989, 37030, 37071, 37129, 37173, 37211, 37259, 37301,
+    37327, 37363, 37402, 37434, 37478, 37525, 37569, 37604, 37639, 37671,
+    37698, 37730, 37756, 37786, 37815, 37840, 37863, 37892, 37920, 37941,
+    37967, 37989, 38012, 38047, 38079, 38106, 38133, 38155, 38177, 38202,
+    38230, 38250, 38283, 38306, 38326, 38362, 38390, 38415, 38455, 38488,
+    38524, 38558, 38583, 38611, 38636, 38666, 38688, 38715, 38741, 38772,
+    38801, 38836, 38865, 38897, 38931, 38968, 38998, 39037, 39061, 39092,
+    39122, 39157, 39187, 39209, 39237, 39267, 39301, 39336, 39366, 39398,
+    39435, 39473, 39507, 39543, 39580, 39614, 39643, 39669, 39699, 39728,
+    39761, 39788, 39824, 39867, 39903, 39941, 39977, 40009, 40050, 40086,
+    40121, 40148, 40177, 40205, 40235, 40275, 40312, 40340, 40379, 40413,
+    40443, 40478, 40517, 40559, 40595, 40628, 40659, 40690, 40733, 40765,
+    40795, 40843, 40869, 40913, 40943, 40966, 40993, 41026, 41056, 41091,
+    41131, 41169, 41196, 41236, 41277, 41313, 41360, 41411, 41435, 41462,
+    41490, 41526, 41569, 41593, 41628, 41670, 41709, 41743, 41776, 41816,
+    41844, 41900, 41935, 41964, 41998, 42025, 42060, 42096, 42129, 42168,
+    42207, 42250, 42275, 42307, 42349, 42385, 42422, 42455, 42474, 42501,
+    42536, 42590, 42624, 42659, 42697, 42768, 42834, 42861, 42898, 42947,
+    42984, 43017, 43044, 43084, 43123, 43166, 43205, 43278, 43324, 43356,
+    43406, 43450, 43497, 43536, 43570, 43603, 43638, 43673, 43710, 43747,
+    43799, 43836, 43864, 43895, 43942, 43971, 44016, 44049, 44097, 44126,
+    44151, 44179, 44223, 44268, 44317, 44366, 44419, 44467, 44491, 44515,
+    44536, 44561, 44574, 44590, 44609, 44634, 44658, 44679, 44704, 44733,
+    44759, 44786, 44815, 44834, 44864, 44908, 44947, 44991, 45030, 45063,
+    45104, 45132, 45163, 45202, 45227, 45259, 45285, 45312, 45336, 45363,
+    45394, 45420, 45444, 45468, 45496, 45517, 45544, 45571, 45603, 45633,
+    45655, 45690, 45713, 45748, 45779, 45804, 45830, 45860, 45889, 45924,
+    45957, 45980, 45995, 46022, 46044, 46064, 46098, 46128, 46148, 46180,
+    46216, 46248, 46283, 46315, 46348, 46380, 46414, 46438, 46455, 46487,
+    46519, 46551, 46580, 46606, 46635, 46671, 46703, 46737, 46773, 46804,
+    46836, 46865, 46899, 46933, 46970, 46999, 47041, 47077, 47105, 47137,
+    47164, 47199, 47235, 47284, 47311, 47344, 47384, 47418, 47459, 47496,
+    47539, 47578, 47614, 47644, 47676, 47705, 47725, 47751, 47774, 47812,
+    47842, 47872, 47907, 47942, 48000, 48047, 48090, 48125, 48154, 48176,
+    48206, 48242, 48264, 48294, 48320, 48345, 48380, 48422, 48451, 48475,
+    48508, 48526, 48555, 48583, 48620, 48657, 48681, 48725, 48760, 48802,
+    48839, 48880, 48910, 48947, 48973, 49008, 49031, 49071, 49098, 49120,
+    49156, 49188, 49207, 49252, 49271, 49309, 49354, 49375, 49406, 49440,
+    49461, 49484, 49507, 49544, 49577, 49601, 49621, 49651, 49679, 49710,
+    49743, 49779, 49816, 49846, 49877, 49896, 49927, 49963, 49989, 50014,
+    50041, 50066, 50088, 50119, 50148, 50174, 50198, 50233, 50254, 50279,
+    50305, 50337, 50370, 50402, 50435, 50461, 50490, 50528, 50560, 50591,
+    50627, 50652, 50678, 50708, 50733, 50755, 50780, 50811, 50842, 50873,
+    50896, 50934, 50965, 50999, 51033, 51068, 51082, 51103, 51130, 51152,
+    51182, 51209, 51238, 51264, 51285, 51313, 51343, 51369, 51389, 51419,
+    51443, 51466, 51492, 51518, 51542, 51570, 51598, 51628, 51651, 51673,
+    51708, 51738, 51766, 51788, 51806, 51842, 51876, 51908, 51938, 51962,
+    51985, 52012, 52029, 52058, 52088, 52109, 52135, 52169, 52200, 52221,
+    52242, 52266, 52290, 52314, 52335, 52358, 52387, 52414, 52435, 52468,
+    52498, 52526, 52551, 52576, 52607, 52638, 52669, 52701, 52735, 52768,
+    52801, 52831, 52858, 52889, 52912, 52939, 52967, 52998, 53028, 53059,
+    53087, 53116, 53149, 53175, 53207, 53237, 53271, 53300, 53321, 53346,
+    53372, 53400, 53434, 53458, 53481, 53510, 53535, 53566, 53592, 53614,
+    53644, 53673, 53696, 53728, 53751, 53781, 53807, 53839, 53868, 53891,
+    53920, 53946, 53973, 53996, 54024, 54050, 54075, 54108, 54135, 54165,
+    54197, 54218, 54243, 54268, 54296, 54319, 54346, 54374, 54404, 54432,
+    54462, 54487, 54518, 54550, 54582, 54608, 54642, 54678, 54713, 54730,
+    54747, 54768, 54796, 54827, 54854, 54879, 54908, 54936, 54966, 54997,
+    55024, 55054, 55081, 55112, 55139, 55166, 55194, 55223, 55257, 55278,
+    55305, 55336, 55360, 55386, 55417, 55450, 55476, 55500, 55532, 55560,
+    55584, 55611, 55641, 55672, 55705, 55732, 55761, 55792, 55816, 55845,
+    55872, 55903, 55934, 55963, 55996, 56029, 56057, 56095, 56125, 56161,
+    56200, 56226, 56249, 56282, 56311, 56342, 56377, 56398, 56429, 56447,
+    56467, 56487, 56510, 56538, 56568, 56599, 56630, 56654, 56680, 56712,
+    56739, 56770, 56792, 56816, 56843, 56870, 56897, 56926, 56953, 56981,
+    57013, 57041, 57064, 57090, 57112, 57150, 57189, 57225, 57258, 57279,
+    57309, 57339, 57370, 57401, 57433, 57476, 57505, 57533, 57559, 57580,
+    57615, 57640, 57668, 57699, 57723, 57750, 57784, 57809, 57845, 57872,
+    57906, 57941, 57976, 58013, 58054, 58086, 58121, 58152, 58194, 58227,
+    58261, 58290, 58323, 58361, 58411, 58437, 58472, 58505, 58538, 58569,
+    58603, 58637, 58673, 58716, 58744, 58788, 58831, 58870, 58913, 58955,
+    59000, 59050, 59080, 59117, 59143, 59171, 59200, 59226, 59250, 59283,
+    59318, 59351, 59371, 59393, 59431, 59464, 59506, 59548, 59585, 59620,
+    59654, 59697, 59720, 59750, 59779, 59816, 59845, 59872, 59893, 59929,
+    59965, 59989, 60021, 60058, 60095, 60125, 60163, 60197, 60237, 60268,
+    60307, 60346, 60376, 60410, 60443, 60476, 60508, 60540, 60570, 60595,
+    60639, 60673, 60698, 60738, 60768, 60804, 60827, 60853, 60884, 60923,
+    60969, 61006, 61043, 61079, 61114, 61153, 61192, 61230, 61261, 61282,
+    61326, 61359, 61391, 61424, 61455, 61487, 61542, 61565, 61589, 61617,
+    61647, 61671, 61706, 61730, 61774, 61813, 61841, 61885, 61917, 61952,
+    61987, 62014, 62055, 62090, 62120, 62152, 62192, 62222, 62255, 62281,
+    62311, 62328, 62355, 62381, 62406, 62430, 62453, 62490, 62525, 62559,
+    62591, 62619, 62645, 62676, 62711, 62749, 62785, 62819, 62863, 62886,
+    62915, 62947, 62971, 62997, 63020, 63063, 63103, 63132, 63172, 63212,
+    63242, 63272, 63299, 63314, 63343, 63374, 63401, 63433, 63457, 63482,
+    63506, 63530, 63554, 63578, 63601, 63624, 63648, 63670, 63699, 63736,
+    63779, 63824, 63856, 63883, 63920, 63962, 64005, 64036, 64080, 64109,
+    64133, 64167, 64209, 64240, 64274, 64303, 64339, 64373, 64412, 64436,
+    64480, 64520, 64549, 64571, 64604, 64636, 64667, 64715, 64741, 64762,
+    64782, 64798, 64824, 64851, 64874, 64903, 64930, 64956, 64977, 65000,
+    65028, 65051, 65088, 65127, 65160, 65194, 65226, 65258, 65287, 65317,
+    65351, 65381, 65412, 65439, 65459, 65489, 65512, 65545, 65580, 65613,
+    65646, 65668, 65699, 65729, 65763, 65791, 65830, 65859, 65894, 65921,
+    65949, 65978, 66007, 66042, 66076, 66103, 66137, 66161, 66197, 66229,
+    66261, 66293, 66320, 66344, 66376, 66400, 66431, 66461, 66488, 66515,
+    66536, 66560, 66586, 66621, 66653, 66678, 66709, 66739, 66764, 66797,
+    66830, 66854, 66880, 66901, 66926, 66941, 66963, 66984, 67003, 67028,
+    67046, 67074, 67102, 67128, 67158, 67185, 67209, 67235, 67269, 67303,
+    67337, 67367, 67399, 67440, 67489, 67538, 67575, 67622, 67664, 67699,
+    67734, 67762, 67795, 67833, 67865, 67907, 67936, 67967, 67991, 68025,
+    68048, 68079, 68111, 68143, 68177, 68211, 68247, 68286, 68325, 68357,
+    68389, 68413, 68445, 68475, 68509, 68546, 68588, 68619, 68654, 68690,
+    68724, 68772, 68825, 68876, 68920, 68959, 69004, 69050, 69079, 69111,
+    69140, 69169, 69201, 69230, 69259, 69291, 69327, 69366, 69393, 69423,
+    69450, 69490, 69528, 69568, 69601, 69637, 69676, 69722, 69765, 69804,
+    69841, 69880, 69913, 69939, 69967, 70003, 70044, 70070, 70094, 70121,
+    70147, 70179, 70211, 70241, 70274, 70307, 70337, 70367, 70389, 70416,
+    70450, 70484, 70515, 70550, 70574, 70622, 70653, 70679, 70713, 70744,
+    70774, 70802, 70833, 70866, 70900, 70931, 70962, 70995, 71032, 71065,
+    71097, 71131, 71166, 71201, 71236, 71268, 71297, 71331, 71362, 71391,
+    71423, 71453, 71482, 71508, 71536, 71564, 71593, 71620, 71649, 71676,
+    71707, 71737, 71775, 71806, 71834, 71868, 71895, 71925, 71949, 71973,
+    72002, 72033, 72062, 72095, 72129, 72165, 72198, 72226, 72254, 72281,
+    72311, 72361, 72399, 72435, 72460, 72497, 72522, 72549, 72589, 72632,
+    72670, 72707, 72739, 72769, 72801, 72835, 72869, 72896, 72929, 72960,
+    72998, 73042, 73085, 73142, 73179, 73210, 73253, 73291, 73341, 73399,
+    73461, 73501, 73521, 73553, 73574, 73606, 73633, 73668, 73696, 73727,
+    73753, 73776, 73812, 73844, 73881, 73910, 73946, 73977, 74022, 74050,
+    74076, 74112, 74141, 74173, 74204, 74242, 74266, 74293, 74322, 74356,
+    74394, 74427, 74454, 74490, 74539, 74588, 74634, 74688, 74742, 74799,
+    74828, 74865, 74891, 74915, 74941, 74968, 75002, 75031, 75060, 75089,
+    75119, 75152, 75180, 75212, 75242, 75270, 75304, 75336, 75369, 75401,
+    75431, 75469, 75505, 75535, 75571, 75603, 75635, 75671, 75703, 75744,
+    75777, 75805, 75840, 75870, 75905, 75932, 75960, 75990, 76023, 76056,
+    76087, 76118, 76150, 76179, 76209, 76243, 76275, 76305, 76332, 76367,
+    76405, 76437, 76467, 76504, 76546, 76585, 76618, 76660, 76706, 76757,
+    76784, 76819, 76840, 76869, 76900, 76932, 76972, 77009, 77059, 77102,
+    77144, 77183, 77214, 77250, 77287, 77322, 77352, 77386, 77418, 77446,
+    77502, 77533, 77572, 77608, 77635, 77668, 77709, 77746, 77775, 77803,
+    77841, 77872, 77896, 77935, 77970, 78003, 78032, 78060, 78089, 78130,
+    78160, 78189, 78229, 78260, 78291, 78318, 78342, 78367, 78392, 78418,
+    78449, 78482, 78538, 78579, 78622, 78656, 78685, 78713, 78744, 78778,
+    78816, 78846, 78883, 78918, 78944, 78970, 79009, 79038, 79068, 79106,
+    79128, 79157, 79181, 79205, 79232, 79257, 79280, 79308, 79338, 79378,
+    79404, 79434, 79478, 79521, 79570, 79598, 79626, 79654, 79688, 79711,
+    79751, 79784, 79813, 79839, 79877, 79905, 79942, 79969, 80004, 80028,
+    80063, 80100, 80140, 80168, 80197, 80239, 80296, 80332, 80379, 80429,
+    80474, 80510, 80543, 80574, 80607, 80639, 80673, 80727, 80778, 80822,
+    80860, 80902, 80936, 80964, 80999, 81037, 81067, 81113, 81145, 81180,
+    81205, 81248, 81288, 81318, 81348, 81373, 81396, 81439, 81477, 81510,
+    81549, 81577, 81614, 81652, 81681, 81712, 81742, 81778, 81812, 81844,
+    81872, 81906, 81938, 81968, 82008, 82040, 82070, 82105, 82142, 82163,
+    82184, 82204, 82233, 82257, 82291, 82326, 82355, 82378, 82413, 82435,
+    82463, 82494, 82547, 82579, 82610, 82648, 82678, 82721, 82747, 82778,
+    82807, 82836, 82861, 82904, 82938, 82991, 83033, 83073, 83129, 83158,
+    83199, 83273, 83314, 83381, 83420, 83461, 83499, 83537, 83588, 83621,
+    83671, 83721, 83764, 83826, 83876, 83930, 83975, 84024, 84073, 84122,
+    84161, 84212, 84261, 84305, 84384, 84442, 84494, 84526, 84564, 84614,
+    84652, 84682, 84713, 84744, 84780, 84814, 84850, 84886, 84918, 84951,
+    84985, 85018, 85060, 85103, 85142, 85180, 85236, 85282, 85327, 85374,
+    85396, 85427, 85458, 85487, 85510, 85541, 85570, 85593, 85618, 85644,
+    85672, 85703, 85730, 85759, 85785, 85819, 85848, 85874, 85898, 85926,
+    85949, 85976, 86005, 86037, 86063, 86093, 86119, 86148, 86178, 86205,
+    86223, 86254, 86286, 86310, 86340, 86367, 86394, 86415, 86440, 86477,
+    86507, 86544, 86580, 86621, 86673, 86722, 86762, 86799, 86843, 86880,
+    86919, 86954, 86993, 87019, 87045, 87084, 87117, 87149, 87182, 87209,
+    87236, 87259, 87292, 87318, 87344, 87381, 87410, 87438, 87468, 87494,
+    87519, 87550, 87580, 87606, 87632, 87654, 87690, 87719, 87742, 87781,
+    87798, 87816, 87838, 87867, 87896, 87933, 87967, 88007, 88042, 88063,
+    88089, 88121, 88148, 88173, 88200, 88230, 88260, 88290, 88323, 88349,
+    88394, 88428, 88464, 88504, 88534, 88558, 88585, 88606, 88634, 88662,
+    88683, 88713, 88743, 88777, 88815, 88850, 88885, 88920, 88959, 88998,
+    89028, 89067, 89099, 89133, 89181, 89219, 89249, 89288, 89323, 89368,
+    89411, 89440, 89466, 89497, 89540, 89563, 89597, 89639, 89682, 89722,
+    89753, 89790, 89831, 89868, 89917, 89952, 89982, 90022, 90057, 90085,
+    90125, 90156, 90193, 90227, 90266, 90296, 90328, 90355, 90386, 90410,
+    90444, 90476, 90521, 90550, 90583, 90621, 90660, 90691, 90721, 90762,
+    90803, 90841, 90872, 90899, 90941, 90985, 91024, 91069, 91097, 91123,
+    91152, 91178, 91207, 91240, 91300, 91346, 91392, 91452, 91497, 91523,
+    91551, 91586, 91623, 91661, 91697, 91740, 91782, 91822, 91855, 91890,
+    91931, 91970, 92013, 92061, 92103, 92142, 92180, 92208, 92244, 92278,
+    92306, 92339, 92372, 92402, 92435, 92461, 92493, 92532, 92570, 92598,
+    92627, 92653, 92684, 92710, 92739, 92772, 92809, 92846, 92872, 92906,
+    92938, 92968, 92994, 93025, 93056, 93084, 93113, 93149, 93193, 93230,
+    93273, 93315, 93346, 93381, 93433, 93466, 93499, 93527, 93556, 93595,
+    93630, 93657, 93690, 93722, 93752, 93788, 93833, 93880, 93909, 93946,
+    93979, 94013, 94050, 94084, 94117, 94145, 94176, 94217, 94248, 94273,
+    94310, 94352, 94396, 94428, 94463, 94504, 94533, 94559, 94590, 94625,
+    94667, 94699, 94732, 94755, 94783, 94817, 94849, 94884, 94921, 94965,
+    95010, 95040, 95063, 95087, 95131, 95165, 95205, 95242, 95284, 95316,
+    95351, 95390, 95427, 95476, 95527, 95551, 95588, 95623, 95669,
+};
+
+static const char gWinErrorSymBlob[] =
+    "ERROR_SUCCESS\0"
+    "ERROR_INVALID_FUNCTION\0"
+    "ERROR_FILE_NOT_FOUND\0"
+    "ERROR_PATH_NOT_FOUND\0"
+    "ERROR_TOO_MANY_OPEN_FILES\0"
+    "ERROR_ACCESS_DENIED\0"
+    "ERROR_INVALID_HANDLE\0"
+    "ERROR_ARENA_TRASHED\0"
+    "ERROR_NOT_ENOUGH_MEMORY\0"
+    "ERROR_INVALID_BLOCK\0"
+    "ERROR_BAD_ENVIRONMENT\0"
+    "ERROR_BAD_FORMAT\0"
+    "ERROR_INVALID_ACCESS\0"
+    "ERROR_INVALID_DATA\0"
+    "ERROR_OUTOFMEMORY\0"
+    "ERROR_INVALID_DRIVE\0"
+    "ERROR_CURRENT_DIRECTORY\0"
+    "ERROR_NOT_SAME_DEVICE\0"
+    "ERROR_NO_MORE_FILES\0"
+    "ERROR_WRITE_PROTECT\0"
+    "ERROR_BAD_UNIT\0"
+    "ERROR_NOT_READY\0"
+    "ERROR_BAD_COMMAND\0"
+    "ERROR_CRC\0"
+    "ERROR_BAD_LENGTH\0"
+    "ERROR_SEEK\0"
+    "ERROR_NOT_DOS_DISK\0"
+    "ERROR_SECTOR_NOT_FOUND\0"
+    "ERROR_OUT_OF_PAPER\0"
+    "ERROR_WRITE_FAULT\0"
+    "ERROR_READ_FAULT\0"
+    "ERROR_GEN_FAILURE\0"
+    "ERROR_SHARING_VIOLATION\0"
+    "ERROR_LOCK_VIOLATION\0"
+    "ERROR_WRONG_DISK\0"
+    "ERROR_SHARING_BUFFER_EXCEEDED\0"
+    "ERROR_HANDLE_EOF\0"
+    "ERROR_HANDLE_DISK_FULL\0"
+    "ERROR_NOT_SUPPORTED\0"
+    "ERROR_REM_NOT_LIST\0"
+    "ERROR_DUP_NAME\0"
+    "ERROR_BAD_NETPATH\0"
+    "ERROR_NETWORK_BUSY\0"
+    "ERROR_DEV_NOT_EXIST\0"
+    "ERROR_TOO_MANY_CMDS\0"
+    "ERROR_ADAP_HDW_ERR\0"
+    "ERROR_BAD_NET_RESP\0"
+    "ERROR_UNEXP_NET_ERR\0"
+    "ERROR_BAD_REM_ADAP\0"
+    "ERROR_PRINTQ_FULL\0"
+    "ERROR_NO_SPOOL_SPACE\0"
+    "ERROR_PRINT_CANCELLED\0"
+    "ERROR_NETNAME_DELETED\0"
+    "ERROR_NETWORK_ACCESS_DENIED\0"
+    "ERROR_BAD_DEV_TYPE\0"
+    "ERROR_BAD_NET_NAME\0"
+    "ERROR_TOO_MANY_NAMES\0"
+    "ERROR_TOO_MANY_SESS\0"
+    "ERROR_SHARING_PAUSED\0"
+    "ERROR_REQ_NOT_ACCEP\0"
+    "ERROR_REDIR_PAUSED\0"
+    "ERROR_FILE_EXISTS\0"
+    "ERROR_CANNOT_MAKE\0"
+    "ERROR_FAIL_I24\0"
+    "ERROR_OUT_OF_STRUCTURES\0"
+    "ERROR_ALREADY_ASSIGNED\0"
+    "ERROR_INVALID_PASSWORD\0"
+    "ERROR_INVALID_PARAMETER\0"
+    "ERROR_NET_WRITE_FAULT\0"
+    "ERROR_NO_PROC_SLOTS\0"
+    "ERROR_TOO_MANY_SEMAPHORES\0"
+    "ERROR_EXCL_SEM_ALREADY_OWNED\0"
+    "ERROR_SEM_IS_SET\0"
+    "ERROR_TOO_MANY_SEM_REQUESTS\0"
+    "ERROR_INVALID_AT_INTERRUPT_TIME\0"
+    "ERROR_SEM_OWNER_DIED\0"
+    "ERROR_SEM_USER_LIMIT\0"
+    "ERROR_DISK_CHANGE\0"
+    "ERROR_DRIVE_LOCKED\0"
+    "ERROR_BROKEN_PIPE\0"
+    "ERROR_OPEN_FAILED\0"
+    "ERROR_BUFFER_OVERFLOW\0"
+    "ERROR_DISK_FULL\0"
+    "ERROR_NO_MORE_SEARCH_HANDLES\0"
+    "ERROR_INVALID_TARGET_HANDLE\0"
+    "ERROR_INVALID_CATEGORY\0"
+    "ERROR_INVALID_VERIFY_SWITCH\0"
+    "ERROR_BAD_DRIVER_LEVEL\0"
+    "ERROR_CALL_NOT_IMPLEMENTED\0"
+    "ERROR_SEM_TIMEOUT\0"
+    "ERROR_INSUFFICIENT_BUFFER\0"
+    "ERROR_INVALID_NAME\0"
+    "ERROR_INVALID_LEVEL\0"
+    "ERROR_NO_VOLUME_LABEL\0"
+    "ERROR_MOD_NOT_FOUND\0"
+    "ERROR_PROC_NOT_FOUND\0"
+    "ERROR_WAIT_NO_CHILDREN\0"
+    "ERROR_CHILD_NOT_COMPLETE\0"
+    "ERROR_DIRECT_ACCESS_HANDLE\0"
+    "ERROR_NEGATIVE_SEEK\0"
+    "ERROR_SEEK_ON_DEVICE\0"
+    "ERROR_IS_JOIN_TARGET\0"
+    "ERROR_IS_JOINED\0"
+    "ERROR_IS_SUBSTED\0"
+    "ERROR_NOT_JOINED\0"
+    "ERROR_NOT_SUBSTED\0"
+    "ERROR_JOIN_TO_JOIN\0"
+    "ERROR_SUBST_TO_SUBST\0"
+    "ERROR_JOIN_TO_SUBST\0"
+    "ERROR_SUBST_TO_JOIN\0"
+    "ERROR_BUSY_DRIVE\0"
+    "ERROR_SAME_DRIVE\0"
+    "ERROR_DIR_NOT_ROOT\0"
+    "ERROR_DIR_NOT_EMPTY\0"
+    "ERROR_IS_SUBST_PATH\0"
+    "ERROR_IS_JOIN_PATH\0"
+    "ERROR_PATH_BUSY\0"
+    "ERROR_IS_SUBST_TARGET\0"
+    "ERROR_SYSTEM_TRACE\0"
+    "ERROR_INVALID_EVENT_COUNT\0"
+    "ERROR_TOO_MANY_MUXWAITERS\0"
+    "ERROR_INVALID_LIST_FORMAT\0"
+    "ERROR_LABEL_TOO_LONG\0"
+    "ERROR_TOO_MANY_TCBS\0"
+    "ERROR_SIGNAL_REFUSED\0"
+    "ERROR_DISCARDED\0"
+    "ERROR_NOT_LOCKED\0"
+    "ERROR_BAD_THREADID_ADDR\0"
+    "ERROR_BAD_ARGUMENTS\0"
+    "ERROR_BAD_PATHNAME\0"
+    "ERROR_SIGNAL_PENDING\0"
+    "ERROR_MAX_THRDS_REACHED\0"
+    "ERROR_LOCK_FAILED\0"
+    "ERROR_BUSY\0"
+    "ERROR_DEVICE_SUPPORT_IN_PROGRESS\0"
+    "ERROR_CANCEL_VIOLATION\0"
+    "ERROR_ATOMIC_LOCKS_NOT_SUPPORTED\0"
+    "ERROR_INVALID_SEGMENT_NUMBER\0"
+    "ERROR_INVALID_ORDINAL\0"
+    "ERROR_ALREADY_EXISTS\0"
+    "ERROR_INVALID_FLAG_NUMBER\0"
+    "ERROR_SEM_NOT_FOUND\0"
+    "ERROR_INVALID_STARTING_CODESEG\0"
+    "ERROR_INVALID_STACKSEG\0"
+    "ERROR_INVALID_MODULETYPE\0"
+    "ERROR_INVALID_EXE_SIGNATURE\0"
+    "ERROR_EXE_MARKED_INVALID\0"
+    "ERROR_BAD_EXE_FORMAT\0"
+    "ERROR_ITERATED_DATA_EXCEEDS_64k\0"
+    "ERROR_INVALID_MINALLOCSIZE\0"
+    "ERROR_DYNLINK_FROM_INVALID_RING\0"
+    "ERROR_IOPL_NOT_ENABLED\0"
+    "ERROR_INVALID_SEGDPL\0"
+    "ERROR_AUTODATASEG_EXCEEDS_64k\0"
+    "ERROR_RING2SEG_MUST_BE_MOVABLE\0"
+    "ERROR_RELOC_CHAIN_XEEDS_SEGLIM\0"
+    "ERROR_INFLOOP_IN_RELOC_CHAIN\0"
+    "ERROR_ENVVAR_NOT_FOUND\0"
+    "ERROR_NO_SIGNAL_SENT\0"
+    "ERROR_FILENAME_EXCED_RANGE\0"
+    "ERROR_RING2_STACK_IN_USE\0"
+    "ERROR_META_EXPANSION_TOO_LONG\0"
+    "ERROR_INVALID_SIGNAL_NUMBER\0"
+    "ERROR_THREAD_1_INACTIVE\0"
+    "ERROR_LOCKED\0"
+    "ERROR_TOO_MANY_MODULES\0"
+    "ERROR_NESTING_NOT_ALLOWED\0"
+    "ERROR_EXE_MACHINE_TYPE_MISMATCH\0"
+    "ERROR_EXE_CANNOT_MODIFY_SIGNED_BINARY\0"
+    "ERROR_EXE_CANNOT_MODIFY_STRONG_SIGNED_BINARY\0"
+    "ERROR_FILE_CHECKED_OUT\0"
+    "ERROR_CHECKOUT_REQUIRED\0"
+    "ERROR_BAD_FILE_TYPE\0"
+    "ERROR_FILE_TOO_LARGE\0"
+    "ERROR_FORMS_AUTH_REQUIRED\0"
+    "ERROR_VIRUS_INFECTED\0"
+    "ERROR_VIRUS_DELETED\0"
+    "ERROR_PIPE_LOCAL\0"
+    "ERROR_BAD_PIPE\0"
+    "ERROR_PIPE_BUSY\0"
+    "ERROR_NO_DATA\0"
+    "ERROR_PIPE_NOT_CONNECTED\0"
+    "ERROR_MORE_DATA\0"
+    "ERROR_NO_WORK_DONE\0"
+    "ERROR_VC_DISCONNECTED\0"
+    "ERROR_INVALID_EA_NAME\0"
+    "ERROR_EA_LIST_INCONSISTENT\0"
+    "WAIT_TIMEOUT\0"
+    "ERROR_NO_MORE_ITEMS\0"
+    "ERROR_CANNOT_COPY\0"
+    "ERROR_DIRECTORY\0"
+    "ERROR_EAS_DIDNT_FIT\0"
+    "ERROR_EA_FILE_CORRUPT\0"
+    "ERROR_EA_TABLE_FULL\0"
+    "ERROR_INVALID_EA_HANDLE\0"
+    "ERROR_EAS_NOT_SUPPORTED\0"
+    "ERROR_NOT_OWNER\0"
+    "ERROR_TOO_MANY_POSTS\0"
+    "ERROR_PARTIAL_COPY\0"
+    "ERROR_OPLOCK_NOT_GRANTED\0"
+    "ERROR_INVALID_OPLOCK_PROTOCOL\0"
+    "ERROR_DISK_TOO_FRAGMENTED\0"
+    "ERROR_DELETE_PENDING\0"
+    "ERROR_INCOMPATIBLE_WITH_GLOBAL_SHORT_NAME_REGISTRY_SETTING\0"
+    "ERROR_SHORT_NAMES_NOT_ENABLED_ON_VOLUME\0"
+    "ERROR_SECURITY_STREAM_IS_INCONSISTENT\0"
+    "ERROR_INVALID_LOCK_RANGE\0"
+    "ERROR_IMAGE_SUBSYSTEM_NOT_PRESENT\0"
+    "ERROR_NOTIFICATION_GUID_ALREADY_DEFINED\0"
+    "ERROR_INVALID_EXCEPTION_HANDLER\0"
+    "ERROR_DUPLICATE_PRIVILEGES\0"
+    "ERROR_NO_RANGES_PROCESSED\0"
+    "ERROR_NOT_ALLOWED_ON_SYSTEM_FILE\0"
+    "ERROR_DISK_RESOURCES_EXHAUSTED\0"
+    "ERROR_INVALID_TOKEN\0"
+    "ERROR_DEVICE_FEATURE_NOT_SUPPORTED\0"
+    "ERROR_MR_MID_NOT_FOUND\0"
+    "ERROR_SCOPE_NOT_FOUND\0"
+    "ERROR_UNDEFINED_SCOPE\0"
+    "ERROR_INVALID_CAP\0"
+    "ERROR_DEVICE_UNREACHABLE\0"
+    "ERROR_DEVICE_NO_RESOURCES\0"
+    "ERROR_DATA_CHECKSUM_ERROR\0"
+    "ERROR_INTERMIXED_KERNEL_EA_OPERATION\0"
+    "ERROR_FILE_LEVEL_TRIM_NOT_SUPPORTED\0"
+    "ERROR_OFFSET_ALIGNMENT_VIOLATION\0"
+    "ERROR_INVALID_FIELD_IN_PARAMETER_LIST\0"
+    "ERROR_OPERATION_IN_PROGRESS\0"
+    "ERROR_BAD_DEVICE_PATH\0"
+    "ERROR_TOO_MANY_DESCRIPTORS\0"
+    "ERROR_SCRUB_DATA_DISABLED\0"
+    "ERROR_NOT_REDUNDANT_STORAGE\0"
+    "ERROR_RESIDENT_FILE_NOT_SUPPORTED\0"
+    "ERROR_COMPRESSED_FILE_NOT_SUPPORTED\0"
+    "ERROR_DIRECTORY_NOT_SUPPORTED\0"
+    "ERROR_NOT_READ_FROM_COPY\0"
+    "ERROR_FT_WRITE_FAILURE\0"
+    "ERROR_FT_DI_SCAN_REQUIRED\0"
+    "ERROR_INVALID_KERNEL_INFO_VERSION\0"
+    "ERROR_INVALID_PEP_INFO_VERSION\0"
+    "ERROR_OBJECT_NOT_EXTERNALLY_BACKED\0"
+    "ERROR_EXTERNAL_BACKING_PROVIDER_UNKNOWN\0"
+    "ERROR_COMPRESSION_NOT_BENEFICIAL\0"
+    "ERROR_STORAGE_TOPOLOGY_ID_MISMATCH\0"
+    "ERROR_BLOCKED_BY_PARENTAL_CONTROLS\0"
+    "ERROR_BLOCK_TOO_MANY_REFERENCES\0"
+    "ERROR_MARKED_TO_DISALLOW_WRITES\0"
+    "ERROR_ENCLAVE_FAILURE\0"
+    "ERROR_FAIL_NOACTION_REBOOT\0"
+    "ERROR_FAIL_SHUTDOWN\0"
+    "ERROR_FAIL_RESTART\0"
+    "ERROR_MAX_SESSIONS_REACHED\0"
+    "ERROR_NETWORK_ACCESS_DENIED_EDP\0"
+    "ERROR_DEVICE_HINT_NAME_BUFFER_TOO_SMALL\0"
+    "ERROR_EDP_POLICY_DENIES_OPERATION\0"
+    "ERROR_EDP_DPL_POLICY_CANT_BE_SATISFIED\0"
+    "ERROR_CLOUD_FILE_SYNC_ROOT_METADATA_CORRUPT\0"
+    "ERROR_DEVICE_IN_MAINTENANCE\0"
+    "ERROR_NOT_SUPPORTED_ON_DAX\0"
+    "ERROR_DAX_MAPPING_EXISTS\0"
+    "ERROR_CLOUD_FILE_PROVIDER_NOT_RUNNING\0"
+    "ERROR_CLOUD_FILE_METADATA_CORRUPT\0"
+    "ERROR_CLOUD_FILE_METADATA_TOO_LARGE\0"
+    "ERROR_CLOUD_FILE_PROPERTY_BLOB_TOO_LARGE\0"
+    "ERROR_CLOUD_FILE_PROPERTY_BLOB_CHECKSUM_MISMATCH\0"
+    "ERROR_CHILD_PROCESS_BLOCKED\0"
+    "ERROR_STORAGE_LOST_DATA_PERSISTENCE\0"
+    "ERROR_FILE_SYSTEM_VIRTUALIZATION_UNAVAILABLE\0"
+    "ERROR_FILE_SYSTEM_VIRTUALIZATION_METADATA_CORRUPT\0"
+    "ERROR_FILE_SYSTEM_VIRTUALIZATION_BUSY\0"
+    "ERROR_FILE_SYSTEM_VIRTUALIZATION_PROVIDER_UNKNOWN\0"
+    "ERROR_GDI_HANDLE_LEAK\0"
+    "ERROR_CLOUD_FILE_TOO_MANY_PROPERTY_BLOBS\0"
+    "ERROR_CLOUD_FILE_PROPERTY_VERSION_NOT_SUPPORTED\0"
+    "ERROR_NOT_A_CLOUD_FILE\0"
+    "ERROR_CLOUD_FILE_NOT_IN_SYNC\0"
+    "ERROR_CLOUD_FILE_ALREADY_CONNECTED\0"
+    "ERROR_CLOUD_FILE_NOT_SUPPORTED\0"
+    "ERROR_CLOUD_FILE_INVALID_REQUEST\0"
+    "ERROR_CLOUD_FILE_READ_ONLY_VOLUME\0"
+    "ERROR_CLOUD_FILE_CONNECTED_PROVIDER_ONLY\0"
+    "ERROR_CLOUD_FILE_VALIDATION_FAILED\0"
+    "ERROR_SMB1_NOT_AVAILABLE\0"
+    "ERROR_FILE_SYSTEM_VIRTUALIZATION_INVALID_OPERATION\0"
+    "ERROR_CLOUD_FILE_AUTHENTICATION_FAILED\0"
+    "ERROR_CLOUD_FILE_INSUFFICIENT_RESOURCES\0"
+    "ERROR_CLOUD_FILE_NETWORK_UNAVAILABLE\0"
+    "ERROR_CLOUD_FILE_UNSUCCESSFUL\0"
+    "ERROR_CLOUD_FILE_NOT_UNDER_SYNC_ROOT\0"
+    "ERROR_CLOUD_FILE_IN_USE\0"
+    "ERROR_CLOUD_FILE_PINNED\0"
+    "ERROR_CLOUD_FILE_REQUEST_ABORTED\0"
+    "ERROR_CLOUD_FILE_PROPERTY_CORRUPT\0"
+    "ERROR_CLOUD_FILE_ACCESS_DENIED\0"
+    "ERROR_CLOUD_FILE_INCOMPATIBLE_HARDLINKS\0"
+    "ERROR_CLOUD_FILE_PROPERTY_LOCK_CONFLICT\0"
+    "ERROR_CLOUD_FILE_REQUEST_CANCELED\0"
+    "ERROR_EXTERNAL_SYSKEY_NOT_SUPPORTED\0"
+    "ERROR_THREAD_MODE_ALREADY_BACKGROUND\0"
+    "ERROR_THREAD_MODE_NOT_BACKGROUND\0"
+    "ERROR_PROCESS_MODE_ALREADY_BACKGROUND\0"
+    "ERROR_PROCESS_MODE_NOT_BACKGROUND\0"
+    "ERROR_CLOUD_FILE_PROVIDER_TERMINATED\0"
+    "ERROR_NOT_A_CLOUD_SYNC_ROOT\0"
+    "ERROR_FILE_PROTECTED_UNDER_DPL\0"
+    "ERROR_VOLUME_NOT_CLUSTER_ALIGNED\0"
+    "ERROR_NO_PHYSICALLY_ALIGNED_FREE_SPACE_FOUND\0"
+    "ERROR_APPX_FILE_NOT_ENCRYPTED\0"
+    "ERROR_RWRAW_ENCRYPTED_FILE_NOT_ENCRYPTED\0"
+    "ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILEOFFSET\0"
+    "ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILERANGE\0"
+    "ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_PARAMETER\0"
+    "ERROR_LINUX_SUBSYSTEM_NOT_PRESENT\0"
+    "ERROR_FT_READ_FAILURE\0"
+    "ERROR_STORAGE_RESERVE_ID_INVALID\0"
+    "ERROR_STORAGE_RESERVE_DOES_NOT_EXIST\0"
+    "ERROR_STORAGE_RESERVE_ALREADY_EXISTS\0"
+    "ERROR_STORAGE_RESERVE_NOT_EMPTY\0"
+    "ERROR_NOT_A_DAX_VOLUME\0"
+    "ERROR_NOT_DAX_MAPPABLE\0"
+    "ERROR_TIME_SENSITIVE_THREAD\0"
+    "ERROR_DPL_NOT_SUPPORTED_FOR_USER\0"
+    "ERROR_CASE_DIFFERING_NAMES_IN_DIR\0"
+    "ERROR_FILE_NOT_SUPPORTED\0"
+    "ERROR_CLOUD_FILE_REQUEST_TIMEOUT\0"
+    "ERROR_NO_TASK_QUEUE\0"
+    "ERROR_SRC_SRV_DLL_LOAD_FAILED\0"
+    "ERROR_NOT_SUPPORTED_WITH_BTT\0"
+    "ERROR_ENCRYPTION_DISABLED\0"
+    "ERROR_ENCRYPTING_METADATA_DISALLOWED\0"
+    "ERROR_CANT_CLEAR_ENCRYPTION_FLAG\0"
+    "ERROR_NO_SUCH_DEVICE\0"
+    "ERROR_CLOUD_FILE_DEHYDRATION_DISALLOWED\0"
+    "ERROR_FILE_SNAP_IN_PROGRESS\0"
+    "ERROR_FILE_SNAP_USER_SECTION_NOT_SUPPORTED\0"
+    "ERROR_FILE_SNAP_MODIFY_NOT_SUPPORTED\0"
+    "ERROR_FILE_SNAP_IO_NOT_COORDINATED\0"
+    "ERROR_FILE_SNAP_UNEXPECTED_ERROR\0"
+    "ERROR_FILE_SNAP_INVALID_PARAMETER\0"
+    "ERROR_UNSATISFIED_DEPENDENCIES\0"
+    "ERROR_CASE_SENSITIVE_PATH\0"
+    "ERROR_UNEXPECTED_NTCACHEMANAGER_ERROR\0"
+    "ERROR_LINUX_SUBSYSTEM_UPDATE_REQUIRED\0"
+    "ERROR_DLP_POLICY_WARNS_AGAINST_OPERATION\0"
+    "ERROR_DLP_POLICY_DENIES_OPERATION\0"
+    "ERROR_SECURITY_DENIES_OPERATION\0"
+    "ERROR_UNTRUSTED_MOUNT_POINT\0"
+    "ERROR_DLP_POLICY_SILENTLY_FAIL\0"
+    "ERROR_CAPAUTHZ_NOT_DEVUNLOCKED\0"
+    "ERROR_CAPAUTHZ_CHANGE_TYPE\0"
+    "ERROR_CAPAUTHZ_NOT_PROVISIONED\0"
+    "ERROR_CAPAUTHZ_NOT_AUTHORIZED\0"
+    "ERROR_CAPAUTHZ_NO_POLICY\0"
+    "ERROR_CAPAUTHZ_DB_CORRUPTED\0"
+    "ERROR_CAPAUTHZ_SCCD_INVALID_CATALOG\0"
+    "ERROR_CAPAUTHZ_SCCD_NO_AUTH_ENTITY\0"
+    "ERROR_CAPAUTHZ_SCCD_PARSE_ERROR\0"
+    "ERROR_CAPAUTHZ_SCCD_DEV_MODE_REQUIRED\0"
+    "ERROR_CAPAUTHZ_SCCD_NO_CAPABILITY_MATCH\0"
+    "ERROR_CIMFS_IMAGE_CORRUPT\0"
+    "ERROR_CIMFS_IMAGE_VERSION_NOT_SUPPORTED\0"
+    "ERROR_STORAGE_STACK_ACCESS_DENIED\0"
+    "ERROR_INSUFFICIENT_VIRTUAL_ADDR_RESOURCES\0"
+    "ERROR_INDEX_OUT_OF_BOUNDS\0"
+    "ERROR_PNP_QUERY_REMOVE_DEVICE_TIMEOUT\0"
+    "ERROR_PNP_QUERY_REMOVE_RELATED_DEVICE_TIMEOUT\0"
+    "ERROR_PNP_QUERY_REMOVE_UNRELATED_DEVICE_TIMEOUT\0"
+    "ERROR_DEVICE_HARDWARE_ERROR\0"
+    "ERROR_INVALID_ADDRESS\0"
+    "ERROR_HAS_SYSTEM_CRITICAL_FILES\0"
+    "ERROR_ENCRYPTED_FILE_NOT_SUPPORTED\0"
+    "ERROR_SPARSE_FILE_NOT_SUPPORTED\0"
+    "ERROR_PAGEFILE_NOT_SUPPORTED\0"
+    "ERROR_VOLUME_NOT_SUPPORTED\0"
+    "ERROR_NOT_SUPPORTED_WITH_BYPASSIO\0"
+    "ERROR_NO_BYPASSIO_DRIVER_SUPPORT\0"
+    "ERROR_NOT_SUPPORTED_WITH_ENCRYPTION\0"
+    "ERROR_NOT_SUPPORTED_WITH_COMPRESSION\0"
+    "ERROR_NOT_SUPPORTED_WITH_REPLICATION\0"
+    "ERROR_NOT_SUPPORTED_WITH_DEDUPLICATION\0"
+    "ERROR_NOT_SUPPORTED_WITH_AUDITING\0"
+    "ERROR_USER_PROFILE_LOAD\0"
+    "ERROR_SESSION_KEY_TOO_SHORT\0"
+    "ERROR_ACCESS_DENIED_APPDATA\0"
+    "ERROR_NOT_SUPPORTED_WITH_MONITORING\0"
+    "ERROR_NOT_SUPPORTED_WITH_SNAPSHOT\0"
+    "ERROR_NOT_SUPPORTED_WITH_VIRTUALIZATION\0"
+    "ERROR_BYPASSIO_FLT_NOT_SUPPORTED\0"
+    "ERROR_DEVICE_RESET_REQUIRED\0"
+    "ERROR_VOLUME_WRITE_ACCESS_DENIED\0"
+    "ERROR_ARITHMETIC_OVERFLOW\0"
+    "ERROR_PIPE_CONNECTED\0"
+    "ERROR_PIPE_LISTENING\0"
+    "ERROR_VERIFIER_STOP\0"
+    "ERROR_ABIOS_ERROR\0"
+    "ERROR_WX86_WARNING\0"
+    "ERROR_WX86_ERROR\0"
+    "ERROR_TIMER_NOT_CANCELED\0"
+    "ERROR_UNWIND\0"
+    "ERROR_BAD_STACK\0"
+    "ERROR_INVALID_UNWIND_TARGET\0"
+    "ERROR_INVALID_PORT_ATTRIBUTES\0"
+    "ERROR_PORT_MESSAGE_TOO_LONG\0"
+    "ERROR_INVALID_QUOTA_LOWER\0"
+    "ERROR_DEVICE_ALREADY_ATTACHED\0"
+    "ERROR_INSTRUCTION_MISALIGNMENT\0"
+    "ERROR_PROFILING_NOT_STARTED\0"
+    "ERROR_PROFILING_NOT_STOPPED\0"
+    "ERROR_COULD_NOT_INTERPRET\0"
+    "ERROR_PROFILING_AT_LIMIT\0"
+    "ERROR_CANT_WAIT\0"
+    "ERROR_CANT_TERMINATE_SELF\0"
+    "ERROR_UNEXPECTED_MM_CREATE_ERR\0"
+    "ERROR_UNEXPECTED_MM_MAP_ERROR\0"
+    "ERROR_UNEXPECTED_MM_EXTEND_ERR\0"
+    "ERROR_BAD_FUNCTION_TABLE\0"
+    "ERROR_NO_GUID_TRANSLATION\0"
+    "ERROR_INVALID_LDT_SIZE\0"
+    "ERROR_INVALID_LDT_OFFSET\0"
+    "ERROR_INVALID_LDT_DESCRIPTOR\0"
+    "ERROR_TOO_MANY_THREADS\0"
+    "ERROR_THREAD_NOT_IN_PROCESS\0"
+    "ERROR_PAGEFILE_QUOTA_EXCEEDED\0"
+    "ERROR_LOGON_SERVER_CONFLICT\0"
+    "ERROR_SYNCHRONIZATION_REQUIRED\0"
+    "ERROR_NET_OPEN_FAILED\0"
+    "ERROR_IO_PRIVILEGE_FAILED\0"
+    "ERROR_CONTROL_C_EXIT\0"
+    "ERROR_MISSING_SYSTEMFILE\0"
+    "ERROR_UNHANDLED_EXCEPTION\0"
+    "ERROR_APP_INIT_FAILURE\0"
+    "ERROR_PAGEFILE_CREATE_FAILED\0"
+    "ERROR_INVALID_IMAGE_HASH\0"
+    "ERROR_NO_PAGEFILE\0"
+    "ERROR_ILLEGAL_FLOAT_CONTEXT\0"
+    "ERROR_NO_EVENT_PAIR\0"
+    "ERROR_DOMAIN_CTRLR_CONFIG_ERROR\0"
+    "ERROR_ILLEGAL_CHARACTER\0"
+    "ERROR_UNDEFINED_CHARACTER\0"
+    "ERROR_FLOPPY_VOLUME\0"
+    "ERROR_BIOS_FAILED_TO_CONNECT_INTERRUPT\0"
+    "ERROR_BACKUP_CONTROLLER\0"
+    "ERROR_MUTANT_LIMIT_EXCEEDED\0"
+    "ERROR_FS_DRIVER_REQUIRED\0"
+    "ERROR_CANNOT_LOAD_REGISTRY_FILE\0"
+    "ERROR_DEBUG_ATTACH_FAILED\0"
+    "ERROR_SYSTEM_PROCESS_TERMINATED\0"
+    "ERROR_DATA_NOT_ACCEPTED\0"
+    "ERROR_VDM_HARD_ERROR\0"
+    "ERROR_DRIVER_CANCEL_TIMEOUT\0"
+    "ERROR_REPLY_MESSAGE_MISMATCH\0"
+    "ERROR_LOST_WRITEBEHIND_DATA\0"
+    "ERROR_CLIENT_SERVER_PARAMETERS_INVALID\0"
+    "ERROR_NOT_TINY_STREAM\0"
+    "ERROR_STACK_OVERFLOW_READ\0"
+    "ERROR_CONVERT_TO_LARGE\0"
+    "ERROR_FOUND_OUT_OF_SCOPE\0"
+    "ERROR_ALLOCATE_BUCKET\0"
+    "ERROR_MARSHALL_OVERFLOW\0"
+    "ERROR_INVALID_VARIANT\0"
+    "ERROR_BAD_COMPRESSION_BUFFER\0"
+    "ERROR_AUDIT_FAILED\0"
+    "ERROR_TIMER_RESOLUTION_NOT_SET\0"
+    "ERROR_INSUFFICIENT_LOGON_INFO\0"
+    "ERROR_BAD_DLL_ENTRYPOINT\0"
+    "ERROR_BAD_SERVICE_ENTRYPOINT\0"
+    "ERROR_IP_ADDRESS_CONFLICT1\0"
+    "ERROR_IP_ADDRESS_CONFLICT2\0"
+    "ERROR_REGISTRY_QUOTA_LIMIT\0"
+    "ERROR_NO_CALLBACK_ACTIVE\0"
+    "ERROR_PWD_TOO_SHORT\0"
+    "ERROR_PWD_TOO_RECENT\0"
+    "ERROR_PWD_HISTORY_CONFLICT\0"
+    "ERROR_UNSUPPORTED_COMPRESSION\0"
+    "ERROR_INVALID_HW_PROFILE\0"
+    "ERROR_INVALID_PLUGPLAY_DEVICE_PATH\0"
+    "ERROR_QUOTA_LIST_INCONSISTENT\0"
+    "ERROR_EVALUATION_EXPIRATION\0"
+    "ERROR_ILLEGAL_DLL_RELOCATION\0"
+    "ERROR_DLL_INIT_FAILED_LOGOFF\0"
+    "ERROR_VALIDATE_CONTINUE\0"
+    "ERROR_NO_MORE_MATCHES\0"
+    "ERROR_RANGE_LIST_CONFLICT\0"
+    "ERROR_SERVER_SID_MISMATCH\0"
+    "ERROR_CANT_ENABLE_DENY_ONLY\0"
+    "ERROR_FLOAT_MULTIPLE_FAULTS\0"
+    "ERROR_FLOAT_MULTIPLE_TRAPS\0"
+    "ERROR_NOINTERFACE\0"
+    "ERROR_DRIVER_FAILED_SLEEP\0"
+    "ERROR_CORRUPT_SYSTEM_FILE\0"
+    "ERROR_COMMITMENT_MINIMUM\0"
+    "ERROR_PNP_RESTART_ENUMERATION\0"
+    "ERROR_SYSTEM_IMAGE_BAD_SIGNATURE\0"
+    "ERROR_PNP_REBOOT_REQUIRED\0"
+    "ERROR_INSUFFICIENT_POWER\0"
+    "ERROR_MULTIPLE_FAULT_VIOLATION\0"
+    "ERROR_SYSTEM_SHUTDOWN\0"
+    "ERROR_PORT_NOT_SET\0"
+    "ERROR_DS_VERSION_CHECK_FAILURE\0"
+    "ERROR_RANGE_NOT_FOUND\0"
+    "ERROR_NOT_SAFE_MODE_DRIVER\0"
+    "ERROR_FAILED_DRIVER_ENTRY\0"
+    "ERROR_DEVICE_ENUMERATION_ERROR\0"
+    "ERROR_MOUNT_POINT_NOT_RESOLVED\0"
+    "ERROR_INVALID_DEVICE_OBJECT_PARAMETER\0"
+    "ERROR_MCA_OCCURED\0"
+    "ERROR_DRIVER_DATABASE_ERROR\0"
+    "ERROR_SYSTEM_HIVE_TOO_LARGE\0"
+    "ERROR_DRIVER_FAILED_PRIOR_UNLOAD\0"
+    "ERROR_VOLSNAP_PREPARE_HIBERNATE\0"
+    "ERROR_HIBERNATION_FAILURE\0"
+    "ERROR_PWD_TOO_LONG\0"
+    "ERROR_FILE_SYSTEM_LIMITATION\0"
+    "ERROR_ASSERTION_FAILURE\0"
+    "ERROR_ACPI_ERROR\0"
+    "ERROR_WOW_ASSERTION\0"
+    "ERROR_PNP_BAD_MPS_TABLE\0"
+    "ERROR_PNP_TRANSLATION_FAILED\0"
+    "ERROR_PNP_IRQ_TRANSLATION_FAILED\0"
+    "ERROR_PNP_INVALID_ID\0"
+    "ERROR_WAKE_SYSTEM_DEBUGGER\0"
+    "ERROR_HANDLES_CLOSED\0"
+    "ERROR_EXTRANEOUS_INFORMATION\0"
+    "ERROR_RXACT_COMMIT_NECESSARY\0"
+    "ERROR_MEDIA_CHECK\0"
+    "ERROR_GUID_SUBSTITUTION_MADE\0"
+    "ERROR_STOPPED_ON_SYMLINK\0"
+    "ERROR_LONGJUMP\0"
+    "ERROR_PLUGPLAY_QUERY_VETOED\0"
+    "ERROR_UNWIND_CONSOLIDATE\0"
+    "ERROR_REGISTRY_HIVE_RECOVERED\0"
+    "ERROR_DLL_MIGHT_BE_INSECURE\0"
+    "ERROR_DLL_MIGHT_BE_INCOMPATIBLE\0"
+    "ERROR_DBG_EXCEPTION_NOT_HANDLED\0"
+    "ERROR_DBG_REPLY_LATER\0"
+    "ERROR_DBG_UNABLE_TO_PROVIDE_HANDLE\0"
+    "ERROR_DBG_TERMINATE_THREAD\0"
+    "ERROR_DBG_TERMINATE_PROCESS\0"
+    "ERROR_DBG_CONTROL_C\0"
+    "ERROR_DBG_PRINTEXCEPTION_C\0"
+    "ERROR_DBG_RIPEXCEPTION\0"
+    "ERROR_DBG_CONTROL_BREAK\0"
+    "ERROR_DBG_COMMAND_EXCEPTION\0"
+    "ERROR_OBJECT_NAME_EXISTS\0"
+    "ERROR_THREAD_WAS_SUSPENDED\0"
+    "ERROR_IMAGE_NOT_AT_BASE\0"
+    "ERROR_RXACT_STATE_CREATED\0"
+    "ERROR_SEGMENT_NOTIFICATION\0"
+    "ERROR_BAD_CURRENT_DIRECTORY\0"
+    "ERROR_FT_READ_RECOVERY_FROM_BACKUP\0"
+    "ERROR_FT_WRITE_RECOVERY\0"
+    "ERROR_IMAGE_MACHINE_TYPE_MISMATCH\0"
+    "ERROR_RECEIVE_PARTIAL\0"
+    "ERROR_RECEIVE_EXPEDITED\0"
+    "ERROR_RECEIVE_PARTIAL_EXPEDITED\0"
+    "ERROR_EVENT_DONE\0"
+    "ERROR_EVENT_PENDING\0"
+    "ERROR_CHECKING_FILE_SYSTEM\0"
+    "ERROR_FATAL_APP_EXIT\0"
+    "ERROR_PREDEFINED_HANDLE\0"
+    "ERROR_WAS_UNLOCKED\0"
+    "ERROR_SERVICE_NOTIFICATION\0"
+    "ERROR_WAS_LOCKED\0"
+    "ERROR_LOG_HARD_ERROR\0"
+    "ERROR_ALREADY_WIN32\0"
+    "ERROR_IMAGE_MACHINE_TYPE_MISMATCH_EXE\0"
+    "ERROR_NO_YIELD_PERFORMED\0"
+    "ERROR_TIMER_RESUME_IGNORED\0"
+    "ERROR_ARBITRATION_UNHANDLED\0"
+    "ERROR_CARDBUS_NOT_SUPPORTED\0"
+    "ERROR_MP_PROCESSOR_MISMATCH\0"
+    "ERROR_HIBERNATED\0"
+    "ERROR_RESUME_HIBERNATION\0"
+    "ERROR_FIRMWARE_UPDATED\0"
+    "ERROR_DRIVERS_LEAKING_LOCKED_PAGES\0"
+    "ERROR_WAKE_SYSTEM\0"
+    "ERROR_WAIT_1\0"
+    "ERROR_WAIT_2\0"
+    "ERROR_WAIT_3\0"
+    "ERROR_WAIT_63\0"
+    "ERROR_ABANDONED_WAIT_0\0"
+    "ERROR_ABANDONED_WAIT_63\0"
+    "ERROR_USER_APC\0"
+    "ERROR_KERNEL_APC\0"
+    "ERROR_ALERTED\0"
+    "ERROR_ELEVATION_REQUIRED\0"
+    "ERROR_REPARSE\0"
+    "ERROR_OPLOCK_BREAK_IN_PROGRESS\0"
+    "ERROR_VOLUME_MOUNTED\0"
+    "ERROR_RXACT_COMMITTED\0"
+    "ERROR_NOTIFY_CLEANUP\0"
+    "ERROR_PRIMARY_TRANSPORT_CONNECT_FAILED\0"
+    "ERROR_PAGE_FAULT_TRANSITION\0"
+    "ERROR_PAGE_FAULT_DEMAND_ZERO\0"
+    "ERROR_PAGE_FAULT_COPY_ON_WRITE\0"
+    "ERROR_PAGE_FAULT_GUARD_PAGE\0"
+    "ERROR_PAGE_FAULT_PAGING_FILE\0"
+    "ERROR_CACHE_PAGE_LOCKED\0"
+    "ERROR_CRASH_DUMP\0"
+    "ERROR_BUFFER_ALL_ZEROS\0"
+    "ERROR_REPARSE_OBJECT\0"
+    "ERROR_RESOURCE_REQUIREMENTS_CHANGED\0"
+    "ERROR_TRANSLATION_COMPLETE\0"
+    "ERROR_NOTHING_TO_TERMINATE\0"
+    "ERROR_PROCESS_NOT_IN_JOB\0"
+    "ERROR_PROCESS_IN_JOB\0"
+    "ERROR_VOLSNAP_HIBERNATE_READY\0"
+    "ERROR_FSFILTER_OP_COMPLETED_SUCCESSFULLY\0"
+    "ERROR_INTERRUPT_VECTOR_ALREADY_CONNECTED\0"
+    "ERROR_INTERRUPT_STILL_CONNECTED\0"
+    "ERROR_WAIT_FOR_OPLOCK\0"
+    "ERROR_DBG_EXCEPTION_HANDLED\0"
+    "ERROR_DBG_CONTINUE\0"
+    "ERROR_CALLBACK_POP_STACK\0"
+    "ERROR_COMPRESSION_DISABLED\0"
+    "ERROR_CANTFETCHBACKWARDS\0"
+    "ERROR_CANTSCROLLBACKWARDS\0"
+    "ERROR_ROWSNOTRELEASED\0"
+    "ERROR_BAD_ACCESSOR_FLAGS\0"
+    "ERROR_ERRORS_ENCOUNTERED\0"
+    "ERROR_NOT_CAPABLE\0"
+    "ERROR_REQUEST_OUT_OF_SEQUENCE\0"
+    "ERROR_VERSION_PARSE_ERROR\0"
+    "ERROR_BADSTARTPOSITION\0"
+    "ERROR_MEMORY_HARDWARE\0"
+    "ERROR_DISK_REPAIR_DISABLED\0"
+    "ERROR_INSUFFICIENT_RESOURCE_FOR_SPECIFIED_SHARED_SECTION_SIZE\0"
+    "ERROR_SYSTEM_POWERSTATE_TRANSITION\0"
+    "ERROR_SYSTEM_POWERSTATE_COMPLEX_TRANSITION\0"
+    "ERROR_MCA_EXCEPTION\0"
+    "ERROR_ACCESS_AUDIT_BY_POLICY\0"
+    "ERROR_ACCESS_DISABLED_NO_SAFER_UI_BY_POLICY\0"
+    "ERROR_ABANDON_HIBERFILE\0"
+    "ERROR_LOST_WRITEBEHIND_DATA_NETWORK_DISCONNECTED\0"
+    "ERROR_LOST_WRITEBEHIND_DATA_NETWORK_SERVER_ERROR\0"
+    "ERROR_LOST_WRITEBEHIND_DATA_LOCAL_DISK_ERROR\0"
+    "ERROR_BAD_MCFG_TABLE\0"
+    "ERROR_DISK_REPAIR_REDIRECTED\0"
+    "ERROR_DISK_REPAIR_UNSUCCESSFUL\0"
+    "ERROR_CORRUPT_LOG_OVERFULL\0"
+    "ERROR_CORRUPT_LOG_CORRUPTED\0"
+    "ERROR_CORRUPT_LOG_UNAVAILABLE\0"
+    "ERROR_CORRUPT_LOG_DELETED_FULL\0"
+    "ERROR_CORRUPT_LOG_CLEARED\0"
+    "ERROR_ORPHAN_NAME_EXHAUSTED\0"
+    "ERROR_OPLOCK_SWITCHED_TO_NEW_HANDLE\0"
+    "ERROR_CANNOT_GRANT_REQUESTED_OPLOCK\0"
+    "ERROR_CANNOT_BREAK_OPLOCK\0"
+    "ERROR_OPLOCK_HANDLE_CLOSED\0"
+    "ERROR_NO_ACE_CONDITION\0"
+    "ERROR_INVALID_ACE_CONDITION\0"
+    "ERROR_FILE_HANDLE_REVOKED\0"
+    "ERROR_IMAGE_AT_DIFFERENT_BASE\0"
+    "ERROR_ENCRYPTED_IO_NOT_POSSIBLE\0"
+    "ERROR_FILE_METADATA_OPTIMIZATION_IN_PROGRESS\0"
+    "ERROR_QUOTA_ACTIVITY\0"
+    "ERROR_HANDLE_REVOKED\0"
+    "ERROR_CALLBACK_INVOKE_INLINE\0"
+    "ERROR_CPU_SET_INVALID\0"
+    "ERROR_ENCLAVE_NOT_TERMINATED\0"
+    "ERROR_ENCLAVE_VIOLATION\0"
+    "ERROR_SERVER_TRANSPORT_CONFLICT\0"
+    "ERROR_CERTIFICATE_VALIDATION_PREFERENCE_CONFLICT\0"
+    "ERROR_FT_READ_FROM_COPY_FAILURE\0"
+    "ERROR_SECTION_DIRECT_MAP_ONLY\0"
+    "ERROR_EA_ACCESS_DENIED\0"
+    "ERROR_OPERATION_ABORTED\0"
+    "ERROR_IO_INCOMPLETE\0"
+    "ERROR_IO_PENDING\0"
+    "ERROR_NOACCESS\0"
+    "ERROR_SWAPERROR\0"
+    "ERROR_STACK_OVERFLOW\0"
+    "ERROR_INVALID_MESSAGE\0"
+    "ERROR_CAN_NOT_COMPLETE\0"
+    "ERROR_INVALID_FLAGS\0"
+    "ERROR_UNRECOGNIZED_VOLUME\0"
+    "ERROR_FILE_INVALID\0"
+    "ERROR_FULLSCREEN_MODE\0"
+    "ERROR_NO_TOKEN\0"
+    "ERROR_BADDB\0"
+    "ERROR_BADKEY\0"
+    "ERROR_CANTOPEN\0"
+    "ERROR_CANTREAD\0"
+    "ERROR_CANTWRITE\0"
+    "ERROR_REGISTRY_RECOVERED\0"
+    "ERROR_REGISTRY_CORRUPT\0"
+    "ERROR_REGISTRY_IO_FAILED\0"
+    "ERROR_NOT_REGISTRY_FILE\0"
+    "ERROR_KEY_DELETED\0"
+    "ERROR_NO_LOG_SPACE\0"
+    "ERROR_KEY_HAS_CHILDREN\0"
+    "ERROR_CHILD_MUST_BE_VOLATILE\0"
+    "ERROR_NOTIFY_ENUM_DIR\0"
+    "ERROR_DEPENDENT_SERVICES_RUNNING\0"
+    "ERROR_INVALID_SERVICE_CONTROL\0"
+    "ERROR_SERVICE_REQUEST_TIMEOUT\0"
+    "ERROR_SERVICE_NO_THREAD\0"
+    "ERROR_SERVICE_DATABASE_LOCKED\0"
+    "ERROR_SERVICE_ALREADY_RUNNING\0"
+    "ERROR_INVALID_SERVICE_ACCOUNT\0"
+    "ERROR_SERVICE_DISABLED\0"
+    "ERROR_CIRCULAR_DEPENDENCY\0"
+    "ERROR_SERVICE_DOES_NOT_EXIST\0"
+    "ERROR_SERVICE_CANNOT_ACCEPT_CTRL\0"
+    "ERROR_SERVICE_NOT_ACTIVE\0"
+    "ERROR_FAILED_SERVICE_CONTROLLER_CONNECT\0"
+    "ERROR_EXCEPTION_IN_SERVICE\0"
+    "ERROR_DATABASE_DOES_NOT_EXIST\0"
+    "ERROR_SERVICE_SPECIFIC_ERROR\0"
+    "ERROR_PROCESS_ABORTED\0"
+    "ERROR_SERVICE_DEPENDENCY_FAIL\0"
+    "ERROR_SERVICE_LOGON_FAILED\0"
+    "ERROR_SERVICE_START_HANG\0"
+    "ERROR_INVALID_SERVICE_LOCK\0"
+    "ERROR_SERVICE_MARKED_FOR_DELETE\0"
+    "ERROR_SERVICE_EXISTS\0"
+    "ERROR_ALREADY_RUNNING_LKG\0"
+    "ERROR_SERVICE_DEPENDENCY_DELETED\0"
+    "ERROR_BOOT_ALREADY_ACCEPTED\0"
+    "ERROR_SERVICE_NEVER_STARTED\0"
+    "ERROR_DUPLICATE_SERVICE_NAME\0"
+    "ERROR_DIFFERENT_SERVICE_ACCOUNT\0"
+    "ERROR_CANNOT_DETECT_DRIVER_FAILURE\0"
+    "ERROR_CANNOT_DETECT_PROCESS_ABORT\0"
+    "ERROR_NO_RECOVERY_PROGRAM\0"
+    "ERROR_SERVICE_NOT_IN_EXE\0"
+    "ERROR_NOT_SAFEBOOT_SERVICE\0"
+    "ERROR_END_OF_MEDIA\0"
+    "ERROR_FILEMARK_DETECTED\0"
+    "ERROR_BEGINNING_OF_MEDIA\0"
+    "ERROR_SETMARK_DETECTED\0"
+    "ERROR_NO_DATA_DETECTED\0"
+    "ERROR_PARTITION_FAILURE\0"
+    "ERROR_INVALID_BLOCK_LENGTH\0"
+    "ERROR_DEVICE_NOT_PARTITIONED\0"
+    "ERROR_UNABLE_TO_LOCK_MEDIA\0"
+    "ERROR_UNABLE_TO_UNLOAD_MEDIA\0"
+    "ERROR_MEDIA_CHANGED\0"
+    "ERROR_BUS_RESET\0"
+    "ERROR_NO_MEDIA_IN_DRIVE\0"
+    "ERROR_NO_UNICODE_TRANSLATION\0"
+    "ERROR_DLL_INIT_FAILED\0"
+    "ERROR_SHUTDOWN_IN_PROGRESS\0"
+    "ERROR_NO_SHUTDOWN_IN_PROGRESS\0"
+    "ERROR_IO_DEVICE\0"
+    "ERROR_SERIAL_NO_DEVICE\0"
+    "ERROR_IRQ_BUSY\0"
+    "ERROR_MORE_WRITES\0"
+    "ERROR_COUNTER_TIMEOUT\0"
+    "ERROR_FLOPPY_ID_MARK_NOT_FOUND\0"
+    "ERROR_FLOPPY_WRONG_CYLINDER\0"
+    "ERROR_FLOPPY_UNKNOWN_ERROR\0"
+    "ERROR_FLOPPY_BAD_REGISTERS\0"
+    "ERROR_DISK_RECALIBRATE_FAILED\0"
+    "ERROR_DISK_OPERATION_FAILED\0"
+    "ERROR_DISK_RESET_FAILED\0"
+    "ERROR_EOM_OVERFLOW\0"
+    "ERROR_NOT_ENOUGH_SERVER_MEMORY\0"
+    "ERROR_POSSIBLE_DEADLOCK\0"
+    "ERROR_MAPPED_ALIGNMENT\0"
+    "ERROR_SET_POWER_STATE_VETOED\0"
+    "ERROR_SET_POWER_STATE_FAILED\0"
+    "ERROR_TOO_MANY_LINKS\0"
+    "ERROR_OLD_WIN_VERSION\0"
+    "ERROR_APP_WRONG_OS\0"
+    "ERROR_SINGLE_INSTANCE_APP\0"
+    "ERROR_RMODE_APP\0"
+    "ERROR_INVALID_DLL\0"
+    "ERROR_NO_ASSOCIATION\0"
+    "ERROR_DDE_FAIL\0"
+    "ERROR_DLL_NOT_FOUND\0"
+    "ERROR_NO_MORE_USER_HANDLES\0"
+    "ERROR_MESSAGE_SYNC_ONLY\0"
+    "ERROR_SOURCE_ELEMENT_EMPTY\0"
+    "ERROR_DESTINATION_ELEMENT_FULL\0"
+    "ERROR_ILLEGAL_ELEMENT_ADDRESS\0"
+    "ERROR_MAGAZINE_NOT_PRESENT\0"
+    "ERROR_DEVICE_REINITIALIZATION_NEEDED\0"
+    "ERROR_DEVICE_REQUIRES_CLEANING\0"
+    "ERROR_DEVICE_DOOR_OPEN\0"
+    "ERROR_DEVICE_NOT_CONNECTED\0"
+    "ERROR_NOT_FOUND\0"
+    "ERROR_NO_MATCH\0"
+    "ERROR_SET_NOT_FOUND\0"
+    "ERROR_POINT_NOT_FOUND\0"
+    "ERROR_NO_TRACKING_SERVICE\0"
+    "ERROR_NO_VOLUME_ID\0"
+    "ERROR_UNABLE_TO_REMOVE_REPLACED\0"
+    "ERROR_UNABLE_TO_MOVE_REPLACEMENT\0"
+    "ERROR_UNABLE_TO_MOVE_REPLACEMENT_2\0"
+    "ERROR_JOURNAL_DELETE_IN_PROGRESS\0"
+    "ERROR_JOURNAL_NOT_ACTIVE\0"
+    "ERROR_POTENTIAL_FILE_FOUND\0"
+    "ERROR_JOURNAL_ENTRY_DELETED\0"
+    "ERROR_PARTITION_TERMINATING\0"
+    "ERROR_SHUTDOWN_IS_SCHEDULED\0"
+    "ERROR_SHUTDOWN_USERS_LOGGED_ON\0"
+    "ERROR_SHUTDOWN_DISKS_NOT_IN_MAINTENANCE_MODE\0"
+    "ERROR_BAD_DEVICE\0"
+    "ERROR_CONNECTION_UNAVAIL\0"
+    "ERROR_DEVICE_ALREADY_REMEMBERED\0"
+    "ERROR_NO_NET_OR_BAD_PATH\0"
+    "ERROR_BAD_PROVIDER\0"
+    "ERROR_CANNOT_OPEN_PROFILE\0"
+    "ERROR_BAD_PROFILE\0"
+    "ERROR_NOT_CONTAINER\0"
+    "ERROR_EXTENDED_ERROR\0"
+    "ERROR_INVALID_GROUPNAME\0"
+    "ERROR_INVALID_COMPUTERNAME\0"
+    "ERROR_INVALID_EVENTNAME\0"
+    "ERROR_INVALID_DOMAINNAME\0"
+    "ERROR_INVALID_SERVICENAME\0"
+    "ERROR_INVALID_NETNAME\0"
+    "ERROR_INVALID_SHARENAME\0"
+    "ERROR_INVALID_PASSWORDNAME\0"
+    "ERROR_INVALID_MESSAGENAME\0"
+    "ERROR_INVALID_MESSAGEDEST\0"
+    "ERROR_SESSION_CREDENTIAL_CONFLICT\0"
+    "ERROR_REMOTE_SESSION_LIMIT_EXCEEDED\0"
+    "ERROR_DUP_DOMAINNAME\0"
+    "ERROR_NO_NETWORK\0"
+    "ERROR_CANCELLED\0"
+    "ERROR_USER_MAPPED_FILE\0"
+    "ERROR_CONNECTION_REFUSED\0"
+    "ERROR_GRACEFUL_DISCONNECT\0"
+    "ERROR_ADDRESS_ALREADY_ASSOCIATED\0"
+    "ERROR_ADDRESS_NOT_ASSOCIATED\0"
+    "ERROR_CONNECTION_INVALID\0"
+    "ERROR_CONNECTION_ACTIVE\0"
+    "ERROR_NETWORK_UNREACHABLE\0"
+    "ERROR_HOST_UNREACHABLE\0"
+    "ERROR_PROTOCOL_UNREACHABLE\0"
+    "ERROR_PORT_UNREACHABLE\0"
+    "ERROR_REQUEST_ABORTED\0"
+    "ERROR_CONNECTION_ABORTED\0"
+    "ERROR_RETRY\0"
+    "ERROR_CONNECTION_COUNT_LIMIT\0"
+    "ERROR_LOGIN_TIME_RESTRICTION\0"
+    "ERROR_LOGIN_WKSTA_RESTRICTION\0"
+    "ERROR_INCORRECT_ADDRESS\0"
+    "ERROR_ALREADY_REGISTERED\0"
+    "ERROR_SERVICE_NOT_FOUND\0"
+    "ERROR_NOT_AUTHENTICATED\0"
+    "ERROR_NOT_LOGGED_ON\0"
+    "ERROR_CONTINUE\0"
+    "ERROR_ALREADY_INITIALIZED\0"
+    "ERROR_NO_MORE_DEVICES\0"
+    "ERROR_NO_SUCH_SITE\0"
+    "ERROR_DOMAIN_CONTROLLER_EXISTS\0"
+    "ERROR_ONLY_IF_CONNECTED\0"
+    "ERROR_OVERRIDE_NOCHANGES\0"
+    "ERROR_BAD_USER_PROFILE\0"
+    "ERROR_NOT_SUPPORTED_ON_SBS\0"
+    "ERROR_SERVER_SHUTDOWN_IN_PROGRESS\0"
+    "ERROR_HOST_DOWN\0"
+    "ERROR_NON_ACCOUNT_SID\0"
+    "ERROR_NON_DOMAIN_SID\0"
+    "ERROR_APPHELP_BLOCK\0"
+    "ERROR_ACCESS_DISABLED_BY_POLICY\0"
+    "ERROR_REG_NAT_CONSUMPTION\0"
+    "ERROR_CSCSHARE_OFFLINE\0"
+    "ERROR_PKINIT_FAILURE\0"
+    "ERROR_SMARTCARD_SUBSYSTEM_FAILURE\0"
+    "ERROR_DOWNGRADE_DETECTED\0"
+    "ERROR_MACHINE_LOCKED\0"
+    "ERROR_SMB_GUEST_LOGON_BLOCKED\0"
+    "ERROR_CALLBACK_SUPPLIED_INVALID_DATA\0"
+    "ERROR_SYNC_FOREGROUND_REFRESH_REQUIRED\0"
+    "ERROR_DRIVER_BLOCKED\0"
+    "ERROR_INVALID_IMPORT_OF_NON_DLL\0"
+    "ERROR_ACCESS_DISABLED_WEBBLADE\0"
+    "ERROR_ACCESS_DISABLED_WEBBLADE_TAMPER\0"
+    "ERROR_RECOVERY_FAILURE\0"
+    "ERROR_ALREADY_FIBER\0"
+    "ERROR_ALREADY_THREAD\0"
+    "ERROR_STACK_BUFFER_OVERRUN\0"
+    "ERROR_PARAMETER_QUOTA_EXCEEDED\0"
+    "ERROR_DEBUGGER_INACTIVE\0"
+    "ERROR_DELAY_LOAD_FAILED\0"
+    "ERROR_VDM_DISALLOWED\0"
+    "ERROR_UNIDENTIFIED_ERROR\0"
+    "ERROR_INVALID_CRUNTIME_PARAMETER\0"
+    "ERROR_BEYOND_VDL\0"
+    "ERROR_INCOMPATIBLE_SERVICE_SID_TYPE\0"
+    "ERROR_DRIVER_PROCESS_TERMINATED\0"
+    "ERROR_IMPLEMENTATION_LIMIT\0"
+    "ERROR_PROCESS_IS_PROTECTED\0"
+    "ERROR_SERVICE_NOTIFY_CLIENT_LAGGING\0"
+    "ERROR_DISK_QUOTA_EXCEEDED\0"
+    "ERROR_CONTENT_BLOCKED\0"
+    "ERROR_INCOMPATIBLE_SERVICE_PRIVILEGE\0"
+    "ERROR_APP_HANG\0"
+    "ERROR_INVALID_LABEL\0"
+    "ERROR_NOT_ALL_ASSIGNED\0"
+    "ERROR_SOME_NOT_MAPPED\0"
+    "ERROR_NO_QUOTAS_FOR_ACCOUNT\0"
+    "ERROR_LOCAL_USER_SESSION_KEY\0"
+    "ERROR_NULL_LM_PASSWORD\0"
+    "ERROR_UNKNOWN_REVISION\0"
+    "ERROR_REVISION_MISMATCH\0"
+    "ERROR_INVALID_OWNER\0"
+    "ERROR_INVALID_PRIMARY_GROUP\0"
+    "ERROR_NO_IMPERSONATION_TOKEN\0"
+    "ERROR_CANT_DISABLE_MANDATORY\0"
+    "ERROR_NO_LOGON_SERVERS\0"
+    "ERROR_NO_SUCH_LOGON_SESSION\0"
+    "ERROR_NO_SUCH_PRIVILEGE\0"
+    "ERROR_PRIVILEGE_NOT_HELD\0"
+    "ERROR_INVALID_ACCOUNT_NAME\0"
+    "ERROR_USER_EXISTS\0"
+    "ERROR_NO_SUCH_USER\0"
+    "ERROR_GROUP_EXISTS\0"
+    "ERROR_NO_SUCH_GROUP\0"
+    "ERROR_MEMBER_IN_GROUP\0"
+    "ERROR_MEMBER_NOT_IN_GROUP\0"
+    "ERROR_LAST_ADMIN\0"
+    "ERROR_WRONG_PASSWORD\0"
+    "ERROR_ILL_FORMED_PASSWORD\0"
+    "ERROR_PASSWORD_RESTRICTION\0"
+    "ERROR_LOGON_FAILURE\0"
+    "ERROR_ACCOUNT_RESTRICTION\0"
+    "ERROR_INVALID_LOGON_HOURS\0"
+    "ERROR_INVALID_WORKSTATION\0"
+    "ERROR_PASSWORD_EXPIRED\0"
+    "ERROR_ACCOUNT_DISABLED\0"
+    "ERROR_NONE_MAPPED\0"
+    "ERROR_TOO_MANY_LUIDS_REQUESTED\0"
+    "ERROR_LUIDS_EXHAUSTED\0"
+    "ERROR_INVALID_SUB_AUTHORITY\0"
+    "ERROR_INVALID_ACL\0"
+    "ERROR_INVALID_SID\0"
+    "ERROR_INVALID_SECURITY_DESCR\0"
+    "ERROR_BAD_INHERITANCE_ACL\0"
+    "ERROR_SERVER_DISABLED\0"
+    "ERROR_SERVER_NOT_DISABLED\0"
+    "ERROR_INVALID_ID_AUTHORITY\0"
+    "ERROR_ALLOTTED_SPACE_EXCEEDED\0"
+    "ERROR_INVALID_GROUP_ATTRIBUTES\0"
+    "ERROR_BAD_IMPERSONATION_LEVEL\0"
+    "ERROR_CANT_OPEN_ANONYMOUS\0"
+    "ERROR_BAD_VALIDATION_CLASS\0"
+    "ERROR_BAD_TOKEN_TYPE\0"
+    "ERROR_NO_SECURITY_ON_OBJECT\0"
+    "ERROR_CANT_ACCESS_DOMAIN_INFO\0"
+    "ERROR_INVALID_SERVER_STATE\0"
+    "ERROR_INVALID_DOMAIN_STATE\0"
+    "ERROR_INVALID_DOMAIN_ROLE\0"
+    "ERROR_NO_SUCH_DOMAIN\0"
+    "ERROR_DOMAIN_EXISTS\0"
+    "ERROR_DOMAIN_LIMIT_EXCEEDED\0"
+    "ERROR_INTERNAL_DB_CORRUPTION\0"
+    "ERROR_INTERNAL_ERROR\0"
+    "ERROR_GENERIC_NOT_MAPPED\0"
+    "ERROR_BAD_DESCRIPTOR_FORMAT\0"
+    "ERROR_NOT_LOGON_PROCESS\0"
+    "ERROR_LOGON_SESSION_EXISTS\0"
+    "ERROR_NO_SUCH_PACKAGE\0"
+    "ERROR_BAD_LOGON_SESSION_STATE\0"
+    "ERROR_LOGON_SESSION_COLLISION\0"
+    "ERROR_INVALID_LOGON_TYPE\0"
+    "ERROR_CANNOT_IMPERSONATE\0"
+    "ERROR_RXACT_INVALID_STATE\0"
+    "ERROR_RXACT_COMMIT_FAILURE\0"
+    "ERROR_SPECIAL_ACCOUNT\0"
+    "ERROR_SPECIAL_GROUP\0"
+    "ERROR_SPECIAL_USER\0"
+    "ERROR_MEMBERS_PRIMARY_GROUP\0"
+    "ERROR_TOKEN_ALREADY_IN_USE\0"
+    "ERROR_NO_SUCH_ALIAS\0"
+    "ERROR_MEMBER_NOT_IN_ALIAS\0"
+    "ERROR_MEMBER_IN_ALIAS\0"
+    "ERROR_ALIAS_EXISTS\0"
+    "ERROR_LOGON_NOT_GRANTED\0"
+    "ERROR_TOO_MANY_SECRETS\0"
+    "ERROR_SECRET_TOO_LONG\0"
+    "ERROR_INTERNAL_DB_ERROR\0"
+    "ERROR_TOO_MANY_CONTEXT_IDS\0"
+    "ERROR_LOGON_TYPE_NOT_GRANTED\0"
+    "ERROR_NT_CROSS_ENCRYPTION_REQUIRED\0"
+    "ERROR_NO_SUCH_MEMBER\0"
+    "ERROR_INVALID_MEMBER\0"
+    "ERROR_TOO_MANY_SIDS\0"
+    "ERROR_LM_CROSS_ENCRYPTION_REQUIRED\0"
+    "ERROR_NO_INHERITANCE\0"
+    "ERROR_FILE_CORRUPT\0"
+    "ERROR_DISK_CORRUPT\0"
+    "ERROR_NO_USER_SESSION_KEY\0"
+    "ERROR_LICENSE_QUOTA_EXCEEDED\0"
+    "ERROR_WRONG_TARGET_NAME\0"
+    "ERROR_MUTUAL_AUTH_FAILED\0"
+    "ERROR_TIME_SKEW\0"
+    "ERROR_CURRENT_DOMAIN_NOT_ALLOWED\0"
+    "ERROR_INVALID_WINDOW_HANDLE\0"
+    "ERROR_INVALID_MENU_HANDLE\0"
+    "ERROR_INVALID_CURSOR_HANDLE\0"
+    "ERROR_INVALID_ACCEL_HANDLE\0"
+    "ERROR_INVALID_HOOK_HANDLE\0"
+    "ERROR_INVALID_DWP_HANDLE\0"
+    "ERROR_TLW_WITH_WSCHILD\0"
+    "ERROR_CANNOT_FIND_WND_CLASS\0"
+    "ERROR_WINDOW_OF_OTHER_THREAD\0"
+    "ERROR_HOTKEY_ALREADY_REGISTERED\0"
+    "ERROR_CLASS_ALREADY_EXISTS\0"
+    "ERROR_CLASS_DOES_NOT_EXIST\0"
+    "ERROR_CLASS_HAS_WINDOWS\0"
+    "ERROR_INVALID_INDEX\0"
+    "ERROR_INVALID_ICON_HANDLE\0"
+    "ERROR_PRIVATE_DIALOG_INDEX\0"
+    "ERROR_LISTBOX_ID_NOT_FOUND\0"
+    "ERROR_NO_WILDCARD_CHARACTERS\0"
+    "ERROR_CLIPBOARD_NOT_OPEN\0"
+    "ERROR_HOTKEY_NOT_REGISTERED\0"
+    "ERROR_WINDOW_NOT_DIALOG\0"
+    "ERROR_CONTROL_ID_NOT_FOUND\0"
+    "ERROR_INVALID_COMBOBOX_MESSAGE\0"
+    "ERROR_WINDOW_NOT_COMBOBOX\0"
+    "ERROR_INVALID_EDIT_HEIGHT\0"
+    "ERROR_DC_NOT_FOUND\0"
+    "ERROR_INVALID_HOOK_FILTER\0"
+    "ERROR_INVALID_FILTER_PROC\0"
+    "ERROR_HOOK_NEEDS_HMOD\0"
+    "ERROR_GLOBAL_ONLY_HOOK\0"
+    "ERROR_JOURNAL_HOOK_SET\0"
+    "ERROR_HOOK_NOT_INSTALLED\0"
+    "ERROR_INVALID_LB_MESSAGE\0"
+    "ERROR_SETCOUNT_ON_BAD_LB\0"
+    "ERROR_LB_WITHOUT_TABSTOPS\0"
+    "ERROR_DESTROY_OBJECT_OF_OTHER_THREAD\0"
+    "ERROR_CHILD_WINDOW_MENU\0"
+    "ERROR_NO_SYSTEM_MENU\0"
+    "ERROR_INVALID_MSGBOX_STYLE\0"
+    "ERROR_INVALID_SPI_VALUE\0"
+    "ERROR_SCREEN_ALREADY_LOCKED\0"
+    "ERROR_HWNDS_HAVE_DIFF_PARENT\0"
+    "ERROR_NOT_CHILD_WINDOW\0"
+    "ERROR_INVALID_GW_COMMAND\0"
+    "ERROR_INVALID_THREAD_ID\0"
+    "ERROR_NON_MDICHILD_WINDOW\0"
+    "ERROR_POPUP_ALREADY_ACTIVE\0"
+    "ERROR_NO_SCROLLBARS\0"
+    "ERROR_INVALID_SCROLLBAR_RANGE\0"
+    "ERROR_INVALID_SHOWWIN_COMMAND\0"
+    "ERROR_NO_SYSTEM_RESOURCES\0"
+    "ERROR_NONPAGED_SYSTEM_RESOURCES\0"
+    "ERROR_PAGED_SYSTEM_RESOURCES\0"
+    "ERROR_WORKING_SET_QUOTA\0"
+    "ERROR_PAGEFILE_QUOTA\0"
+    "ERROR_COMMITMENT_LIMIT\0"
+    "ERROR_MENU_ITEM_NOT_FOUND\0"
+    "ERROR_INVALID_KEYBOARD_HANDLE\0"
+    "ERROR_HOOK_TYPE_NOT_ALLOWED\0"
+    "ERROR_REQUIRES_INTERACTIVE_WINDOWSTATION\0"
+    "ERROR_TIMEOUT\0"
+    "ERROR_INVALID_MONITOR_HANDLE\0"
+    "ERROR_INCORRECT_SIZE\0"
+    "ERROR_SYMLINK_CLASS_DISABLED\0"
+    "ERROR_SYMLINK_NOT_SUPPORTED\0"
+    "ERROR_XML_PARSE_ERROR\0"
+    "ERROR_XMLDSIG_ERROR\0"
+    "ERROR_RESTART_APPLICATION\0"
+    "ERROR_WRONG_COMPARTMENT\0"
+    "ERROR_AUTHIP_FAILURE\0"
+    "ERROR_NO_NVRAM_RESOURCES\0"
+    "ERROR_NOT_GUI_PROCESS\0"
+    "ERROR_EVENTLOG_FILE_CORRUPT\0"
+    "ERROR_EVENTLOG_CANT_START\0"
+    "ERROR_LOG_FILE_FULL\0"
+    "ERROR_EVENTLOG_FILE_CHANGED\0"
+    "ERROR_CONTAINER_ASSIGNED\0"
+    "ERROR_JOB_NO_CONTAINER\0"
+    "ERROR_INVALID_TASK_NAME\0"
+    "ERROR_INVALID_TASK_INDEX\0"
+    "ERROR_THREAD_ALREADY_IN_TASK\0"
+    "ERROR_INSTALL_SERVICE_FAILURE\0"
+    "ERROR_INSTALL_USEREXIT\0"
+    "ERROR_INSTALL_FAILURE\0"
+    "ERROR_INSTALL_SUSPEND\0"
+    "ERROR_UNKNOWN_PRODUCT\0"
+    "ERROR_UNKNOWN_FEATURE\0"
+    "ERROR_UNKNOWN_COMPONENT\0"
+    "ERROR_UNKNOWN_PROPERTY\0"
+    "ERROR_INVALID_HANDLE_STATE\0"
+    "ERROR_BAD_CONFIGURATION\0"
+    "ERROR_INDEX_ABSENT\0"
+    "ERROR_INSTALL_SOURCE_ABSENT\0"
+    "ERROR_INSTALL_PACKAGE_VERSION\0"
+    "ERROR_PRODUCT_UNINSTALLED\0"
+    "ERROR_BAD_QUERY_SYNTAX\0"
+    "ERROR_INVALID_FIELD\0"
+    "ERROR_DEVICE_REMOVED\0"
+    "ERROR_INSTALL_ALREADY_RUNNING\0"
+    "ERROR_INSTALL_PACKAGE_OPEN_FAILED\0"
+    "ERROR_INSTALL_PACKAGE_INVALID\0"
+    "ERROR_INSTALL_UI_FAILURE\0"
+    "ERROR_INSTALL_LOG_FAILURE\0"
+    "ERROR_INSTALL_LANGUAGE_UNSUPPORTED\0"
+    "ERROR_INSTALL_TRANSFORM_FAILURE\0"
+    "ERROR_INSTALL_PACKAGE_REJECTED\0"
+    "ERROR_FUNCTION_NOT_CALLED\0"
+    "ERROR_FUNCTION_FAILED\0"
+    "ERROR_INVALID_TABLE\0"
+    "ERROR_DATATYPE_MISMATCH\0"
+    "ERROR_UNSUPPORTED_TYPE\0"
+    "ERROR_CREATE_FAILED\0"
+    "ERROR_INSTALL_TEMP_UNWRITABLE\0"
+    "ERROR_INSTALL_PLATFORM_UNSUPPORTED\0"
+    "ERROR_INSTALL_NOTUSED\0"
+    "ERROR_PATCH_PACKAGE_OPEN_FAILED\0"
+    "ERROR_PATCH_PACKAGE_INVALID\0"
+    "ERROR_PATCH_PACKAGE_UNSUPPORTED\0"
+    "ERROR_PRODUCT_VERSION\0"
+    "ERROR_INVALID_COMMAND_LINE\0"
+    "ERROR_INSTALL_REMOTE_DISALLOWED\0"
+    "ERROR_SUCCESS_REBOOT_INITIATED\0"
+    "ERROR_PATCH_TARGET_NOT_FOUND\0"
+    "ERROR_PATCH_PACKAGE_REJECTED\0"
+    "ERROR_INSTALL_TRANSFORM_REJECTED\0"
+    "ERROR_INSTALL_REMOTE_PROHIBITED\0"
+    "ERROR_PATCH_REMOVAL_UNSUPPORTED\0"
+    "ERROR_UNKNOWN_PATCH\0"
+    "ERROR_PATCH_NO_SEQUENCE\0"
+    "ERROR_PATCH_REMOVAL_DISALLOWED\0"
+    "ERROR_INVALID_PATCH_XML\0"
+    "ERROR_PATCH_MANAGED_ADVERTISED_PRODUCT\0"
+    "ERROR_INSTALL_SERVICE_SAFEBOOT\0"
+    "ERROR_FAIL_FAST_EXCEPTION\0"
+    "ERROR_INSTALL_REJECTED\0"
+    "ERROR_DYNAMIC_CODE_BLOCKED\0"
+    "ERROR_NOT_SAME_OBJECT\0"
+    "ERROR_STRICT_CFG_VIOLATION\0"
+    "ERROR_SET_CONTEXT_DENIED\0"
+    "ERROR_CROSS_PARTITION_VIOLATION\0"
+    "ERROR_RETURN_ADDRESS_HIJACK_ATTEMPT\0"
+    "ERROR_INVALID_USER_BUFFER\0"
+    "ERROR_UNRECOGNIZED_MEDIA\0"
+    "ERROR_NO_TRUST_LSA_SECRET\0"
+    "ERROR_NO_TRUST_SAM_ACCOUNT\0"
+    "ERROR_TRUSTED_DOMAIN_FAILURE\0"
+    "ERROR_TRUSTED_RELATIONSHIP_FAILURE\0"
+    "ERROR_TRUST_FAILURE\0"
+    "ERROR_NETLOGON_NOT_STARTED\0"
+    "ERROR_ACCOUNT_EXPIRED\0"
+    "ERROR_REDIRECTOR_HAS_OPEN_HANDLES\0"
+    "ERROR_PRINTER_DRIVER_ALREADY_INSTALLED\0"
+    "ERROR_UNKNOWN_PORT\0"
+    "ERROR_UNKNOWN_PRINTER_DRIVER\0"
+    "ERROR_UNKNOWN_PRINTPROCESSOR\0"
+    "ERROR_INVALID_SEPARATOR_FILE\0"
+    "ERROR_INVALID_PRIORITY\0"
+    "ERROR_INVALID_PRINTER_NAME\0"
+    "ERROR_PRINTER_ALREADY_EXISTS\0"
+    "ERROR_INVALID_PRINTER_COMMAND\0"
+    "ERROR_INVALID_DATATYPE\0"
+    "ERROR_INVALID_ENVIRONMENT\0"
+    "ERROR_NOLOGON_INTERDOMAIN_TRUST_ACCOUNT\0"
+    "ERROR_NOLOGON_WORKSTATION_TRUST_ACCOUNT\0"
+    "ERROR_NOLOGON_SERVER_TRUST_ACCOUNT\0"
+    "ERROR_DOMAIN_TRUST_INCONSISTENT\0"
+    "ERROR_SERVER_HAS_OPEN_HANDLES\0"
+    "ERROR_RESOURCE_DATA_NOT_FOUND\0"
+    "ERROR_RESOURCE_TYPE_NOT_FOUND\0"
+    "ERROR_RESOURCE_NAME_NOT_FOUND\0"
+    "ERROR_RESOURCE_LANG_NOT_FOUND\0"
+    "ERROR_NOT_ENOUGH_QUOTA\0"
+    "ERROR_INVALID_TIME\0"
+    "ERROR_INVALID_FORM_NAME\0"
+    "ERROR_INVALID_FORM_SIZE\0"
+    "ERROR_ALREADY_WAITING\0"
+    "ERROR_PRINTER_DELETED\0"
+    "ERROR_INVALID_PRINTER_STATE\0"
+    "ERROR_PASSWORD_MUST_CHANGE\0"
+    "ERROR_DOMAIN_CONTROLLER_NOT_FOUND\0"
+    "ERROR_ACCOUNT_LOCKED_OUT\0"
+    "ERROR_NO_SITENAME\0"
+    "ERROR_CANT_ACCESS_FILE\0"
+    "ERROR_CANT_RESOLVE_FILENAME\0"
+    "ERROR_KM_DRIVER_BLOCKED\0"
+    "ERROR_CONTEXT_EXPIRED\0"
+    "ERROR_PER_USER_TRUST_QUOTA_EXCEEDED\0"
+    "ERROR_ALL_USER_TRUST_QUOTA_EXCEEDED\0"
+    "ERROR_USER_DELETE_TRUST_QUOTA_EXCEEDED\0"
+    "ERROR_AUTHENTICATION_FIREWALL_FAILED\0"
+    "ERROR_REMOTE_PRINT_CONNECTIONS_BLOCKED\0"
+    "ERROR_NTLM_BLOCKED\0"
+    "ERROR_PASSWORD_CHANGE_REQUIRED\0"
+    "ERROR_LOST_MODE_LOGON_RESTRICTION\0"
+    "ERROR_INVALID_PIXEL_FORMAT\0"
+    "ERROR_BAD_DRIVER\0"
+    "ERROR_INVALID_WINDOW_STYLE\0"
+    "ERROR_METAFILE_NOT_SUPPORTED\0"
+    "ERROR_TRANSFORM_NOT_SUPPORTED\0"
+    "ERROR_CLIPPING_NOT_SUPPORTED\0"
+    "ERROR_INVALID_CMM\0"
+    "ERROR_INVALID_PROFILE\0"
+    "ERROR_TAG_NOT_FOUND\0"
+    "ERROR_TAG_NOT_PRESENT\0"
+    "ERROR_DUPLICATE_TAG\0"
+    "ERROR_PROFILE_NOT_ASSOCIATED_WITH_DEVICE\0"
+    "ERROR_PROFILE_NOT_FOUND\0"
+    "ERROR_INVALID_COLORSPACE\0"
+    "ERROR_ICM_NOT_ENABLED\0"
+    "ERROR_DELETING_ICM_XFORM\0"
+    "ERROR_INVALID_TRANSFORM\0"
+    "ERROR_COLORSPACE_MISMATCH\0"
+    "ERROR_INVALID_COLORINDEX\0"
+    "ERROR_PROFILE_DOES_NOT_MATCH_DEVICE\0"
+    "ERROR_CONNECTED_OTHER_PASSWORD\0"
+    "ERROR_CONNECTED_OTHER_PASSWORD_DEFAULT\0"
+    "ERROR_BAD_USERNAME\0"
+    "ERROR_NOT_CONNECTED\0"
+    "ERROR_OPEN_FILES\0"
+    "ERROR_ACTIVE_CONNECTIONS\0"
+    "ERROR_DEVICE_IN_USE\0"
+    "ERROR_UNKNOWN_PRINT_MONITOR\0"
+    "ERROR_PRINTER_DRIVER_IN_USE\0"
+    "ERROR_SPOOL_FILE_NOT_FOUND\0"
+    "ERROR_SPL_NO_STARTDOC\0"
+    "ERROR_SPL_NO_ADDJOB\0"
+    "ERROR_PRINT_PROCESSOR_ALREADY_INSTALLED\0"
+    "ERROR_PRINT_MONITOR_ALREADY_INSTALLED\0"
+    "ERROR_INVALID_PRINT_MONITOR\0"
+    "ERROR_PRINT_MONITOR_IN_USE\0"
+    "ERROR_PRINTER_HAS_JOBS_QUEUED\0"
+    "ERROR_SUCCESS_REBOOT_REQUIRED\0"
+    "ERROR_SUCCESS_RESTART_REQUIRED\0"
+    "ERROR_PRINTER_NOT_FOUND\0"
+    "ERROR_PRINTER_DRIVER_WARNED\0"
+    "ERROR_PRINTER_DRIVER_BLOCKED\0"
+    "ERROR_PRINTER_DRIVER_PACKAGE_IN_USE\0"
+    "ERROR_CORE_DRIVER_PACKAGE_NOT_FOUND\0"
+    "ERROR_FAIL_REBOOT_REQUIRED\0"
+    "ERROR_FAIL_REBOOT_INITIATED\0"
+    "ERROR_PRINTER_DRIVER_DOWNLOAD_NEEDED\0"
+    "ERROR_PRINT_JOB_RESTART_REQUIRED\0"
+    "ERROR_INVALID_PRINTER_DRIVER_MANIFEST\0"
+    "ERROR_PRINTER_NOT_SHAREABLE\0"
+    "ERROR_REQUEST_PAUSED\0"
+    "ERROR_APPEXEC_CONDITION_NOT_SATISFIED\0"
+    "ERROR_APPEXEC_HANDLE_INVALIDATED\0"
+    "ERROR_APPEXEC_INVALID_HOST_GENERATION\0"
+    "ERROR_APPEXEC_UNEXPECTED_PROCESS_REGISTRATION\0"
+    "ERROR_APPEXEC_INVALID_HOST_STATE\0"
+    "ERROR_APPEXEC_NO_DONOR\0"
+    "ERROR_APPEXEC_HOST_ID_MISMATCH\0"
+    "ERROR_APPEXEC_UNKNOWN_USER\0"
+    "ERROR_APPEXEC_APP_COMPAT_BLOCK\0"
+    "ERROR_APPEXEC_CALLER_WAIT_TIMEOUT\0"
+    "ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_TERMINATION\0"
+    "ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_LICENSING\0"
+    "ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_RESOURCES\0"
+    "ERROR_VRF_VOLATILE_CFG_AND_IO_ENABLED\0"
+    "ERROR_VRF_VOLATILE_NOT_STOPPABLE\0"
+    "ERROR_VRF_VOLATILE_SAFE_MODE\0"
+    "ERROR_VRF_VOLATILE_NOT_RUNNABLE_SYSTEM\0"
+    "ERROR_VRF_VOLATILE_NOT_SUPPORTED_RULECLASS\0"
+    "ERROR_VRF_VOLATILE_PROTECTED_DRIVER\0"
+    "ERROR_VRF_VOLATILE_NMI_REGISTERED\0"
+    "ERROR_VRF_VOLATILE_SETTINGS_CONFLICT\0"
+    "ERROR_DIF_IOCALLBACK_NOT_REPLACED\0"
+    "ERROR_DIF_LIVEDUMP_LIMIT_EXCEEDED\0"
+    "ERROR_DIF_VOLATILE_SECTION_NOT_LOCKED\0"
+    "ERROR_DIF_VOLATILE_DRIVER_HOTPATCHED\0"
+    "ERROR_DIF_VOLATILE_INVALID_INFO\0"
+    "ERROR_DIF_VOLATILE_DRIVER_IS_NOT_RUNNING\0"
+    "ERROR_DIF_VOLATILE_PLUGIN_IS_NOT_RUNNING\0"
+    "ERROR_DIF_VOLATILE_PLUGIN_CHANGE_NOT_ALLOWED\0"
+    "ERROR_DIF_VOLATILE_NOT_ALLOWED\0"
+    "ERROR_DIF_BINDING_API_NOT_FOUND\0"
+    "ERROR_IO_REISSUE_AS_CACHED\0"
+    "ERROR_WINS_INTERNAL\0"
+    "ERROR_CAN_NOT_DEL_LOCAL_WINS\0"
+    "ERROR_STATIC_INIT\0"
+    "ERROR_INC_BACKUP\0"
+    "ERROR_FULL_BACKUP\0"
+    "ERROR_REC_NON_EXISTENT\0"
+    "ERROR_RPL_NOT_ALLOWED\0"
+    "ERROR_DHCP_ADDRESS_CONFLICT\0"
+    "ERROR_WMI_GUID_NOT_FOUND\0"
+    "ERROR_WMI_INSTANCE_NOT_FOUND\0"
+    "ERROR_WMI_ITEMID_NOT_FOUND\0"
+    "ERROR_WMI_TRY_AGAIN\0"
+    "ERROR_WMI_DP_NOT_FOUND\0"
+    "ERROR_WMI_UNRESOLVED_INSTANCE_REF\0"
+    "ERROR_WMI_ALREADY_ENABLED\0"
+    "ERROR_WMI_GUID_DISCONNECTED\0"
+    "ERROR_WMI_SERVER_UNAVAILABLE\0"
+    "ERROR_WMI_DP_FAILED\0"
+    "ERROR_WMI_INVALID_MOF\0"
+    "ERROR_WMI_INVALID_REGINFO\0"
+    "ERROR_WMI_ALREADY_DISABLED\0"
+    "ERROR_WMI_READ_ONLY\0"
+    "ERROR_WMI_SET_FAILURE\0"
+    "ERROR_NOT_APPCONTAINER\0"
+    "ERROR_APPCONTAINER_REQUIRED\0"
+    "ERROR_NOT_SUPPORTED_IN_APPCONTAINER\0"
+    "ERROR_INVALID_PACKAGE_SID_LENGTH\0"
+    "ERROR_INVALID_MEDIA\0"
+    "ERROR_INVALID_LIBRARY\0"
+    "ERROR_INVALID_MEDIA_POOL\0"
+    "ERROR_DRIVE_MEDIA_MISMATCH\0"
+    "ERROR_MEDIA_OFFLINE\0"
+    "ERROR_LIBRARY_OFFLINE\0"
+    "ERROR_EMPTY\0"
+    "ERROR_NOT_EMPTY\0"
+    "ERROR_MEDIA_UNAVAILABLE\0"
+    "ERROR_RESOURCE_DISABLED\0"
+    "ERROR_INVALID_CLEANER\0"
+    "ERROR_UNABLE_TO_CLEAN\0"
+    "ERROR_OBJECT_NOT_FOUND\0"
+    "ERROR_DATABASE_FAILURE\0"
+    "ERROR_DATABASE_FULL\0"
+    "ERROR_MEDIA_INCOMPATIBLE\0"
+    "ERROR_RESOURCE_NOT_PRESENT\0"
+    "ERROR_INVALID_OPERATION\0"
+    "ERROR_MEDIA_NOT_AVAILABLE\0"
+    "ERROR_DEVICE_NOT_AVAILABLE\0"
+    "ERROR_REQUEST_REFUSED\0"
+    "ERROR_INVALID_DRIVE_OBJECT\0"
+    "ERROR_LIBRARY_FULL\0"
+    "ERROR_MEDIUM_NOT_ACCESSIBLE\0"
+    "ERROR_UNABLE_TO_LOAD_MEDIUM\0"
+    "ERROR_UNABLE_TO_INVENTORY_DRIVE\0"
+    "ERROR_UNABLE_TO_INVENTORY_SLOT\0"
+    "ERROR_UNABLE_TO_INVENTORY_TRANSPORT\0"
+    "ERROR_TRANSPORT_FULL\0"
+    "ERROR_CONTROLLING_IEPORT\0"
+    "ERROR_UNABLE_TO_EJECT_MOUNTED_MEDIA\0"
+    "ERROR_CLEANER_SLOT_SET\0"
+    "ERROR_CLEANER_SLOT_NOT_SET\0"
+    "ERROR_CLEANER_CARTRIDGE_SPENT\0"
+    "ERROR_UNEXPECTED_OMID\0"
+    "ERROR_CANT_DELETE_LAST_ITEM\0"
+    "ERROR_MESSAGE_EXCEEDS_MAX_SIZE\0"
+    "ERROR_VOLUME_CONTAINS_SYS_FILES\0"
+    "ERROR_INDIGENOUS_TYPE\0"
+    "ERROR_NO_SUPPORTING_DRIVES\0"
+    "ERROR_CLEANER_CARTRIDGE_INSTALLED\0"
+    "ERROR_IEPORT_FULL\0"
+    "ERROR_FILE_OFFLINE\0"
+    "ERROR_REMOTE_STORAGE_NOT_ACTIVE\0"
+    "ERROR_REMOTE_STORAGE_MEDIA_ERROR\0"
+    "ERROR_NOT_A_REPARSE_POINT\0"
+    "ERROR_REPARSE_ATTRIBUTE_CONFLICT\0"
+    "ERROR_INVALID_REPARSE_DATA\0"
+    "ERROR_REPARSE_TAG_INVALID\0"
+    "ERROR_REPARSE_TAG_MISMATCH\0"
+    "ERROR_REPARSE_POINT_ENCOUNTERED\0"
+    "ERROR_APP_DATA_NOT_FOUND\0"
+    "ERROR_APP_DATA_EXPIRED\0"
+    "ERROR_APP_DATA_CORRUPT\0"
+    "ERROR_APP_DATA_LIMIT_EXCEEDED\0"
+    "ERROR_APP_DATA_REBOOT_REQUIRED\0"
+    "ERROR_SECUREBOOT_ROLLBACK_DETECTED\0"
+    "ERROR_SECUREBOOT_POLICY_VIOLATION\0"
+    "ERROR_SECUREBOOT_INVALID_POLICY\0"
+    "ERROR_SECUREBOOT_POLICY_PUBLISHER_NOT_FOUND\0"
+    "ERROR_SECUREBOOT_POLICY_NOT_SIGNED\0"
+    "ERROR_SECUREBOOT_NOT_ENABLED\0"
+    "ERROR_SECUREBOOT_FILE_REPLACED\0"
+    "ERROR_SECUREBOOT_POLICY_NOT_AUTHORIZED\0"
+    "ERROR_SECUREBOOT_POLICY_UNKNOWN\0"
+    "ERROR_SECUREBOOT_POLICY_MISSING_ANTIROLLBACKVERSION\0"
+    "ERROR_SECUREBOOT_PLATFORM_ID_MISMATCH\0"
+    "ERROR_SECUREBOOT_POLICY_ROLLBACK_DETECTED\0"
+    "ERROR_SECUREBOOT_POLICY_UPGRADE_MISMATCH\0"
+    "ERROR_SECUREBOOT_REQUIRED_POLICY_FILE_MISSING\0"
+    "ERROR_SECUREBOOT_NOT_BASE_POLICY\0"
+    "ERROR_SECUREBOOT_NOT_SUPPLEMENTAL_POLICY\0"
+    "ERROR_OFFLOAD_READ_FLT_NOT_SUPPORTED\0"
+    "ERROR_OFFLOAD_WRITE_FLT_NOT_SUPPORTED\0"
+    "ERROR_OFFLOAD_READ_FILE_NOT_SUPPORTED\0"
+    "ERROR_OFFLOAD_WRITE_FILE_NOT_SUPPORTED\0"
+    "ERROR_ALREADY_HAS_STREAM_ID\0"
+    "ERROR_SMR_GARBAGE_COLLECTION_REQUIRED\0"
+    "ERROR_WOF_WIM_HEADER_CORRUPT\0"
+    "ERROR_WOF_WIM_RESOURCE_TABLE_CORRUPT\0"
+    "ERROR_WOF_FILE_RESOURCE_TABLE_CORRUPT\0"
+    "ERROR_OBJECT_IS_IMMUTABLE\0"
+    "ERROR_VOLUME_NOT_SIS_ENABLED\0"
+    "ERROR_SYSTEM_INTEGRITY_ROLLBACK_DETECTED\0"
+    "ERROR_SYSTEM_INTEGRITY_POLICY_VIOLATION\0"
+    "ERROR_SYSTEM_INTEGRITY_INVALID_POLICY\0"
+    "ERROR_SYSTEM_INTEGRITY_POLICY_NOT_SIGNED\0"
+    "ERROR_SYSTEM_INTEGRITY_TOO_MANY_POLICIES\0"
+    "ERROR_SYSTEM_INTEGRITY_SUPPLEMENTAL_POLICY_NOT_AUTHORIZED\0"
+    "ERROR_SYSTEM_INTEGRITY_REPUTATION_MALICIOUS\0"
+    "ERROR_SYSTEM_INTEGRITY_REPUTATION_PUA\0"
+    "ERROR_SYSTEM_INTEGRITY_REPUTATION_DANGEROUS_EXT\0"
+    "ERROR_SYSTEM_INTEGRITY_REPUTATION_OFFLINE\0"
+    "ERROR_VSM_NOT_INITIALIZED\0"
+    "ERROR_VSM_DMA_PROTECTION_NOT_IN_USE\0"
+    "ERROR_PLATFORM_MANIFEST_NOT_AUTHORIZED\0"
+    "ERROR_PLATFORM_MANIFEST_INVALID\0"
+    "ERROR_PLATFORM_MANIFEST_FILE_NOT_AUTHORIZED\0"
+    "ERROR_PLATFORM_MANIFEST_CATALOG_NOT_AUTHORIZED\0"
+    "ERROR_PLATFORM_MANIFEST_BINARY_ID_NOT_FOUND\0"
+    "ERROR_PLATFORM_MANIFEST_NOT_ACTIVE\0"
+    "ERROR_PLATFORM_MANIFEST_NOT_SIGNED\0"
+    "ERROR_DEPENDENT_RESOURCE_EXISTS\0"
+    "ERROR_DEPENDENCY_NOT_FOUND\0"
+    "ERROR_DEPENDENCY_ALREADY_EXISTS\0"
+    "ERROR_RESOURCE_NOT_ONLINE\0"
+    "ERROR_HOST_NODE_NOT_AVAILABLE\0"
+    "ERROR_RESOURCE_NOT_AVAILABLE\0"
+    "ERROR_RESOURCE_NOT_FOUND\0"
+    "ERROR_SHUTDOWN_CLUSTER\0"
+    "ERROR_CANT_EVICT_ACTIVE_NODE\0"
+    "ERROR_OBJECT_ALREADY_EXISTS\0"
+    "ERROR_OBJECT_IN_LIST\0"
+    "ERROR_GROUP_NOT_AVAILABLE\0"
+    "ERROR_GROUP_NOT_FOUND\0"
+    "ERROR_GROUP_NOT_ONLINE\0"
+    "ERROR_HOST_NODE_NOT_RESOURCE_OWNER\0"
+    "ERROR_HOST_NODE_NOT_GROUP_OWNER\0"
+    "ERROR_RESMON_CREATE_FAILED\0"
+    "ERROR_RESMON_ONLINE_FAILED\0"
+    "ERROR_RESOURCE_ONLINE\0"
+    "ERROR_QUORUM_RESOURCE\0"
+    "ERROR_NOT_QUORUM_CAPABLE\0"
+    "ERROR_CLUSTER_SHUTTING_DOWN\0"
+    "ERROR_INVALID_STATE\0"
+    "ERROR_RESOURCE_PROPERTIES_STORED\0"
+    "ERROR_NOT_QUORUM_CLASS\0"
+    "ERROR_CORE_RESOURCE\0"
+    "ERROR_QUORUM_RESOURCE_ONLINE_FAILED\0"
+    "ERROR_QUORUMLOG_OPEN_FAILED\0"
+    "ERROR_CLUSTERLOG_CORRUPT\0"
+    "ERROR_CLUSTERLOG_RECORD_EXCEEDS_MAXSIZE\0"
+    "ERROR_CLUSTERLOG_EXCEEDS_MAXSIZE\0"
+    "ERROR_CLUSTERLOG_CHKPOINT_NOT_FOUND\0"
+    "ERROR_CLUSTERLOG_NOT_ENOUGH_SPACE\0"
+    "ERROR_QUORUM_OWNER_ALIVE\0"
+    "ERROR_NETWORK_NOT_AVAILABLE\0"
+    "ERROR_NODE_NOT_AVAILABLE\0"
+    "ERROR_ALL_NODES_NOT_AVAILABLE\0"
+    "ERROR_RESOURCE_FAILED\0"
+    "ERROR_CLUSTER_INVALID_NODE\0"
+    "ERROR_CLUSTER_NODE_EXISTS\0"
+    "ERROR_CLUSTER_JOIN_IN_PROGRESS\0"
+    "ERROR_CLUSTER_NODE_NOT_FOUND\0"
+    "ERROR_CLUSTER_LOCAL_NODE_NOT_FOUND\0"
+    "ERROR_CLUSTER_NETWORK_EXISTS\0"
+    "ERROR_CLUSTER_NETWORK_NOT_FOUND\0"
+    "ERROR_CLUSTER_NETINTERFACE_EXISTS\0"
+    "ERROR_CLUSTER_NETINTERFACE_NOT_FOUND\0"
+    "ERROR_CLUSTER_INVALID_REQUEST\0"
+    "ERROR_CLUSTER_INVALID_NETWORK_PROVIDER\0"
+    "ERROR_CLUSTER_NODE_DOWN\0"
+    "ERROR_CLUSTER_NODE_UNREACHABLE\0"
+    "ERROR_CLUSTER_NODE_NOT_MEMBER\0"
+    "ERROR_CLUSTER_JOIN_NOT_IN_PROGRESS\0"
+    "ERROR_CLUSTER_INVALID_NETWORK\0"
+    "ERROR_CLUSTER_NODE_UP\0"
+    "ERROR_CLUSTER_IPADDR_IN_USE\0"
+    "ERROR_CLUSTER_NODE_NOT_PAUSED\0"
+    "ERROR_CLUSTER_NO_SECURITY_CONTEXT\0"
+    "ERROR_CLUSTER_NETWORK_NOT_INTERNAL\0"
+    "ERROR_CLUSTER_NODE_ALREADY_UP\0"
+    "ERROR_CLUSTER_NODE_ALREADY_DOWN\0"
+    "ERROR_CLUSTER_NETWORK_ALREADY_ONLINE\0"
+    "ERROR_CLUSTER_NETWORK_ALREADY_OFFLINE\0"
+    "ERROR_CLUSTER_NODE_ALREADY_MEMBER\0"
+    "ERROR_CLUSTER_LAST_INTERNAL_NETWORK\0"
+    "ERROR_CLUSTER_NETWORK_HAS_DEPENDENTS\0"
+    "ERROR_INVALID_OPERATION_ON_QUORUM\0"
+    "ERROR_DEPENDENCY_NOT_ALLOWED\0"
+    "ERROR_CLUSTER_NODE_PAUSED\0"
+    "ERROR_NODE_CANT_HOST_RESOURCE\0"
+    "ERROR_CLUSTER_NODE_NOT_READY\0"
+    "ERROR_CLUSTER_NODE_SHUTTING_DOWN\0"
+    "ERROR_CLUSTER_JOIN_ABORTED\0"
+    "ERROR_CLUSTER_INCOMPATIBLE_VERSIONS\0"
+    "ERROR_CLUSTER_MAXNUM_OF_RESOURCES_EXCEEDED\0"
+    "ERROR_CLUSTER_SYSTEM_CONFIG_CHANGED\0"
+    "ERROR_CLUSTER_RESOURCE_TYPE_NOT_FOUND\0"
+    "ERROR_CLUSTER_RESTYPE_NOT_SUPPORTED\0"
+    "ERROR_CLUSTER_RESNAME_NOT_FOUND\0"
+    "ERROR_CLUSTER_NO_RPC_PACKAGES_REGISTERED\0"
+    "ERROR_CLUSTER_OWNER_NOT_IN_PREFLIST\0"
+    "ERROR_CLUSTER_DATABASE_SEQMISMATCH\0"
+    "ERROR_RESMON_INVALID_STATE\0"
+    "ERROR_CLUSTER_GUM_NOT_LOCKER\0"
+    "ERROR_QUORUM_DISK_NOT_FOUND\0"
+    "ERROR_DATABASE_BACKUP_CORRUPT\0"
+    "ERROR_CLUSTER_NODE_ALREADY_HAS_DFS_ROOT\0"
+    "ERROR_RESOURCE_PROPERTY_UNCHANGEABLE\0"
+    "ERROR_NO_ADMIN_ACCESS_POINT\0"
+    "ERROR_CLUSTER_MEMBERSHIP_INVALID_STATE\0"
+    "ERROR_CLUSTER_QUORUMLOG_NOT_FOUND\0"
+    "ERROR_CLUSTER_MEMBERSHIP_HALT\0"
+    "ERROR_CLUSTER_INSTANCE_ID_MISMATCH\0"
+    "ERROR_CLUSTER_NETWORK_NOT_FOUND_FOR_IP\0"
+    "ERROR_CLUSTER_PROPERTY_DATA_TYPE_MISMATCH\0"
+    "ERROR_CLUSTER_EVICT_WITHOUT_CLEANUP\0"
+    "ERROR_CLUSTER_PARAMETER_MISMATCH\0"
+    "ERROR_NODE_CANNOT_BE_CLUSTERED\0"
+    "ERROR_CLUSTER_WRONG_OS_VERSION\0"
+    "ERROR_CLUSTER_CANT_CREATE_DUP_CLUSTER_NAME\0"
+    "ERROR_CLUSCFG_ALREADY_COMMITTED\0"
+    "ERROR_CLUSCFG_ROLLBACK_FAILED\0"
+    "ERROR_CLUSCFG_SYSTEM_DISK_DRIVE_LETTER_CONFLICT\0"
+    "ERROR_CLUSTER_OLD_VERSION\0"
+    "ERROR_CLUSTER_MISMATCHED_COMPUTER_ACCT_NAME\0"
+    "ERROR_CLUSTER_NO_NET_ADAPTERS\0"
+    "ERROR_CLUSTER_POISONED\0"
+    "ERROR_CLUSTER_GROUP_MOVING\0"
+    "ERROR_CLUSTER_RESOURCE_TYPE_BUSY\0"
+    "ERROR_RESOURCE_CALL_TIMED_OUT\0"
+    "ERROR_INVALID_CLUSTER_IPV6_ADDRESS\0"
+    "ERROR_CLUSTER_INTERNAL_INVALID_FUNCTION\0"
+    "ERROR_CLUSTER_PARAMETER_OUT_OF_BOUNDS\0"
+    "ERROR_CLUSTER_PARTIAL_SEND\0"
+    "ERROR_CLUSTER_REGISTRY_INVALID_FUNCTION\0"
+    "ERROR_CLUSTER_INVALID_STRING_TERMINATION\0"
+    "ERROR_CLUSTER_INVALID_STRING_FORMAT\0"
+    "ERROR_CLUSTER_DATABASE_TRANSACTION_IN_PROGRESS\0"
+    "ERROR_CLUSTER_DATABASE_TRANSACTION_NOT_IN_PROGRESS\0"
+    "ERROR_CLUSTER_NULL_DATA\0"
+    "ERROR_CLUSTER_PARTIAL_READ\0"
+    "ERROR_CLUSTER_PARTIAL_WRITE\0"
+    "ERROR_CLUSTER_CANT_DESERIALIZE_DATA\0"
+    "ERROR_DEPENDENT_RESOURCE_PROPERTY_CONFLICT\0"
+    "ERROR_CLUSTER_NO_QUORUM\0"
+    "ERROR_CLUSTER_INVALID_IPV6_NETWORK\0"
+    "ERROR_CLUSTER_INVALID_IPV6_TUNNEL_NETWORK\0"
+    "ERROR_QUORUM_NOT_ALLOWED_IN_THIS_GROUP\0"
+    "ERROR_DEPENDENCY_TREE_TOO_COMPLEX\0"
+    "ERROR_EXCEPTION_IN_RESOURCE_CALL\0"
+    "ERROR_CLUSTER_RHS_FAILED_INITIALIZATION\0"
+    "ERROR_CLUSTER_NOT_INSTALLED\0"
+    "ERROR_CLUSTER_RESOURCES_MUST_BE_ONLINE_ON_THE_SAME_NODE\0"
+    "ERROR_CLUSTER_MAX_NODES_IN_CLUSTER\0"
+    "ERROR_CLUSTER_TOO_MANY_NODES\0"
+    "ERROR_CLUSTER_OBJECT_ALREADY_USED\0"
+    "ERROR_NONCORE_GROUPS_FOUND\0"
+    "ERROR_FILE_SHARE_RESOURCE_CONFLICT\0"
+    "ERROR_CLUSTER_EVICT_INVALID_REQUEST\0"
+    "ERROR_CLUSTER_SINGLETON_RESOURCE\0"
+    "ERROR_CLUSTER_GROUP_SINGLETON_RESOURCE\0"
+    "ERROR_CLUSTER_RESOURCE_PROVIDER_FAILED\0"
+    "ERROR_CLUSTER_RESOURCE_CONFIGURATION_ERROR\0"
+    "ERROR_CLUSTER_GROUP_BUSY\0"
+    "ERROR_CLUSTER_NOT_SHARED_VOLUME\0"
+    "ERROR_CLUSTER_INVALID_SECURITY_DESCRIPTOR\0"
+    "ERROR_CLUSTER_SHARED_VOLUMES_IN_USE\0"
+    "ERROR_CLUSTER_USE_SHARED_VOLUMES_API\0"
+    "ERROR_CLUSTER_BACKUP_IN_PROGRESS\0"
+    "ERROR_NON_CSV_PATH\0"
+    "ERROR_CSV_VOLUME_NOT_LOCAL\0"
+    "ERROR_CLUSTER_WATCHDOG_TERMINATING\0"
+    "ERROR_CLUSTER_RESOURCE_VETOED_MOVE_INCOMPATIBLE_NODES\0"
+    "ERROR_CLUSTER_INVALID_NODE_WEIGHT\0"
+    "ERROR_CLUSTER_RESOURCE_VETOED_CALL\0"
+    "ERROR_RESMON_SYSTEM_RESOURCES_LACKING\0"
+    "ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_DESTINATION\0"
+    "ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_SOURCE\0"
+    "ERROR_CLUSTER_GROUP_QUEUED\0"
+    "ERROR_CLUSTER_RESOURCE_LOCKED_STATUS\0"
+    "ERROR_CLUSTER_SHARED_VOLUME_FAILOVER_NOT_ALLOWED\0"
+    "ERROR_CLUSTER_NODE_DRAIN_IN_PROGRESS\0"
+    "ERROR_CLUSTER_DISK_NOT_CONNECTED\0"
+    "ERROR_DISK_NOT_CSV_CAPABLE\0"
+    "ERROR_RESOURCE_NOT_IN_AVAILABLE_STORAGE\0"
+    "ERROR_CLUSTER_SHARED_VOLUME_REDIRECTED\0"
+    "ERROR_CLUSTER_SHARED_VOLUME_NOT_REDIRECTED\0"
+    "ERROR_CLUSTER_CANNOT_RETURN_PROPERTIES\0"
+    "ERROR_CLUSTER_RESOURCE_CONTAINS_UNSUPPORTED_DIFF_AREA_FOR_SHARED_VOLUMES\0"
+    "ERROR_CLUSTER_RESOURCE_IS_IN_MAINTENANCE_MODE\0"
+    "ERROR_CLUSTER_AFFINITY_CONFLICT\0"
+    "ERROR_CLUSTER_RESOURCE_IS_REPLICA_VIRTUAL_MACHINE\0"
+    "ERROR_CLUSTER_UPGRADE_INCOMPATIBLE_VERSIONS\0"
+    "ERROR_CLUSTER_UPGRADE_FIX_QUORUM_NOT_SUPPORTED\0"
+    "ERROR_CLUSTER_UPGRADE_RESTART_REQUIRED\0"
+    "ERROR_CLUSTER_UPGRADE_IN_PROGRESS\0"
+    "ERROR_CLUSTER_UPGRADE_INCOMPLETE\0"
+    "ERROR_CLUSTER_NODE_IN_GRACE_PERIOD\0"
+    "ERROR_CLUSTER_CSV_IO_PAUSE_TIMEOUT\0"
+    "ERROR_NODE_NOT_ACTIVE_CLUSTER_MEMBER\0"
+    "ERROR_CLUSTER_RESOURCE_NOT_MONITORED\0"
+    "ERROR_CLUSTER_RESOURCE_DOES_NOT_SUPPORT_UNMONITORED\0"
+    "ERROR_CLUSTER_RESOURCE_IS_REPLICATED\0"
+    "ERROR_CLUSTER_NODE_ISOLATED\0"
+    "ERROR_CLUSTER_NODE_QUARANTINED\0"
+    "ERROR_CLUSTER_DATABASE_UPDATE_CONDITION_FAILED\0"
+    "ERROR_CLUSTER_SPACE_DEGRADED\0"
+    "ERROR_CLUSTER_TOKEN_DELEGATION_NOT_SUPPORTED\0"
+    "ERROR_CLUSTER_CSV_INVALID_HANDLE\0"
+    "ERROR_CLUSTER_CSV_SUPPORTED_ONLY_ON_COORDINATOR\0"
+    "ERROR_GROUPSET_NOT_AVAILABLE\0"
+    "ERROR_GROUPSET_NOT_FOUND\0"
+    "ERROR_GROUPSET_CANT_PROVIDE\0"
+    "ERROR_CLUSTER_FAULT_DOMAIN_PARENT_NOT_FOUND\0"
+    "ERROR_CLUSTER_FAULT_DOMAIN_INVALID_HIERARCHY\0"
+    "ERROR_CLUSTER_FAULT_DOMAIN_FAILED_S2D_VALIDATION\0"
+    "ERROR_CLUSTER_FAULT_DOMAIN_S2D_CONNECTIVITY_LOSS\0"
+    "ERROR_CLUSTER_INVALID_INFRASTRUCTURE_FILESERVER_NAME\0"
+    "ERROR_CLUSTERSET_MANAGEMENT_CLUSTER_UNREACHABLE\0"
+    "ERROR_ENCRYPTION_FAILED\0"
+    "ERROR_DECRYPTION_FAILED\0"
+    "ERROR_FILE_ENCRYPTED\0"
+    "ERROR_NO_RECOVERY_POLICY\0"
+    "ERROR_NO_EFS\0"
+    "ERROR_WRONG_EFS\0"
+    "ERROR_NO_USER_KEYS\0"
+    "ERROR_FILE_NOT_ENCRYPTED\0"
+    "ERROR_NOT_EXPORT_FORMAT\0"
+    "ERROR_FILE_READ_ONLY\0"
+    "ERROR_DIR_EFS_DISALLOWED\0"
+    "ERROR_EFS_SERVER_NOT_TRUSTED\0"
+    "ERROR_BAD_RECOVERY_POLICY\0"
+    "ERROR_EFS_ALG_BLOB_TOO_BIG\0"
+    "ERROR_VOLUME_NOT_SUPPORT_EFS\0"
+    "ERROR_EFS_DISABLED\0"
+    "ERROR_EFS_VERSION_NOT_SUPPORT\0"
+    "ERROR_CS_ENCRYPTION_INVALID_SERVER_RESPONSE\0"
+    "ERROR_CS_ENCRYPTION_UNSUPPORTED_SERVER\0"
+    "ERROR_CS_ENCRYPTION_EXISTING_ENCRYPTED_FILE\0"
+    "ERROR_CS_ENCRYPTION_NEW_ENCRYPTED_FILE\0"
+    "ERROR_CS_ENCRYPTION_FILE_NOT_CSE\0"
+    "ERROR_ENCRYPTION_POLICY_DENIES_OPERATION\0"
+    "ERROR_WIP_ENCRYPTION_FAILED\0"
+    "ERROR_NO_BROWSER_SERVERS_FOUND\0"
+    "ERROR_CLUSTER_OBJECT_IS_CLUSTER_SET_VM\0"
+    "ERROR_LOG_SECTOR_INVALID\0"
+    "ERROR_LOG_SECTOR_PARITY_INVALID\0"
+    "ERROR_LOG_SECTOR_REMAPPED\0"
+    "ERROR_LOG_BLOCK_INCOMPLETE\0"
+    "ERROR_LOG_INVALID_RANGE\0"
+    "ERROR_LOG_BLOCKS_EXHAUSTED\0"
+    "ERROR_LOG_READ_CONTEXT_INVALID\0"
+    "ERROR_LOG_RESTART_INVALID\0"
+    "ERROR_LOG_BLOCK_VERSION\0"
+    "ERROR_LOG_BLOCK_INVALID\0"
+    "ERROR_LOG_READ_MODE_INVALID\0"
+    "ERROR_LOG_NO_RESTART\0"
+    "ERROR_LOG_METADATA_CORRUPT\0"
+    "ERROR_LOG_METADATA_INVALID\0"
+    "ERROR_LOG_METADATA_INCONSISTENT\0"
+    "ERROR_LOG_RESERVATION_INVALID\0"
+    "ERROR_LOG_CANT_DELETE\0"
+    "ERROR_LOG_CONTAINER_LIMIT_EXCEEDED\0"
+    "ERROR_LOG_START_OF_LOG\0"
+    "ERROR_LOG_POLICY_ALREADY_INSTALLED\0"
+    "ERROR_LOG_POLICY_NOT_INSTALLED\0"
+    "ERROR_LOG_POLICY_INVALID\0"
+    "ERROR_LOG_POLICY_CONFLICT\0"
+    "ERROR_LOG_PINNED_ARCHIVE_TAIL\0"
+    "ERROR_LOG_RECORD_NONEXISTENT\0"
+    "ERROR_LOG_RECORDS_RESERVED_INVALID\0"
+    "ERROR_LOG_SPACE_RESERVED_INVALID\0"
+    "ERROR_LOG_TAIL_INVALID\0"
+    "ERROR_LOG_FULL\0"
+    "ERROR_COULD_NOT_RESIZE_LOG\0"
+    "ERROR_LOG_MULTIPLEXED\0"
+    "ERROR_LOG_DEDICATED\0"
+    "ERROR_LOG_ARCHIVE_NOT_IN_PROGRESS\0"
+    "ERROR_LOG_ARCHIVE_IN_PROGRESS\0"
+    "ERROR_LOG_EPHEMERAL\0"
+    "ERROR_LOG_NOT_ENOUGH_CONTAINERS\0"
+    "ERROR_LOG_CLIENT_ALREADY_REGISTERED\0"
+    "ERROR_LOG_CLIENT_NOT_REGISTERED\0"
+    "ERROR_LOG_FULL_HANDLER_IN_PROGRESS\0"
+    "ERROR_LOG_CONTAINER_READ_FAILED\0"
+    "ERROR_LOG_CONTAINER_WRITE_FAILED\0"
+    "ERROR_LOG_CONTAINER_OPEN_FAILED\0"
+    "ERROR_LOG_CONTAINER_STATE_INVALID\0"
+    "ERROR_LOG_STATE_INVALID\0"
+    "ERROR_LOG_PINNED\0"
+    "ERROR_LOG_METADATA_FLUSH_FAILED\0"
+    "ERROR_LOG_INCONSISTENT_SECURITY\0"
+    "ERROR_LOG_APPENDED_FLUSH_FAILED\0"
+    "ERROR_LOG_PINNED_RESERVATION\0"
+    "ERROR_INVALID_TRANSACTION\0"
+    "ERROR_TRANSACTION_NOT_ACTIVE\0"
+    "ERROR_TRANSACTION_REQUEST_NOT_VALID\0"
+    "ERROR_TRANSACTION_NOT_REQUESTED\0"
+    "ERROR_TRANSACTION_ALREADY_ABORTED\0"
+    "ERROR_TRANSACTION_ALREADY_COMMITTED\0"
+    "ERROR_TM_INITIALIZATION_FAILED\0"
+    "ERROR_RESOURCEMANAGER_READ_ONLY\0"
+    "ERROR_TRANSACTION_NOT_JOINED\0"
+    "ERROR_TRANSACTION_SUPERIOR_EXISTS\0"
+    "ERROR_CRM_PROTOCOL_ALREADY_EXISTS\0"
+    "ERROR_TRANSACTION_PROPAGATION_FAILED\0"
+    "ERROR_CRM_PROTOCOL_NOT_FOUND\0"
+    "ERROR_TRANSACTION_INVALID_MARSHALL_BUFFER\0"
+    "ERROR_CURRENT_TRANSACTION_NOT_VALID\0"
+    "ERROR_TRANSACTION_NOT_FOUND\0"
+    "ERROR_RESOURCEMANAGER_NOT_FOUND\0"
+    "ERROR_ENLISTMENT_NOT_FOUND\0"
+    "ERROR_TRANSACTIONMANAGER_NOT_FOUND\0"
+    "ERROR_TRANSACTIONMANAGER_NOT_ONLINE\0"
+    "ERROR_TRANSACTIONMANAGER_RECOVERY_NAME_COLLISION\0"
+    "ERROR_TRANSACTION_NOT_ROOT\0"
+    "ERROR_TRANSACTION_OBJECT_EXPIRED\0"
+    "ERROR_TRANSACTION_RESPONSE_NOT_ENLISTED\0"
+    "ERROR_TRANSACTION_RECORD_TOO_LONG\0"
+    "ERROR_IMPLICIT_TRANSACTION_NOT_SUPPORTED\0"
+    "ERROR_TRANSACTION_INTEGRITY_VIOLATED\0"
+    "ERROR_TRANSACTIONMANAGER_IDENTITY_MISMATCH\0"
+    "ERROR_RM_CANNOT_BE_FROZEN_FOR_SNAPSHOT\0"
+    "ERROR_TRANSACTION_MUST_WRITETHROUGH\0"
+    "ERROR_TRANSACTION_NO_SUPERIOR\0"
+    "ERROR_HEURISTIC_DAMAGE_POSSIBLE\0"
+    "ERROR_TRANSACTIONAL_CONFLICT\0"
+    "ERROR_RM_NOT_ACTIVE\0"
+    "ERROR_RM_METADATA_CORRUPT\0"
+    "ERROR_DIRECTORY_NOT_RM\0"
+    "ERROR_TRANSACTIONS_UNSUPPORTED_REMOTE\0"
+    "ERROR_LOG_RESIZE_INVALID_SIZE\0"
+    "ERROR_OBJECT_NO_LONGER_EXISTS\0"
+    "ERROR_STREAM_MINIVERSION_NOT_FOUND\0"
+    "ERROR_STREAM_MINIVERSION_NOT_VALID\0"
+    "ERROR_MINIVERSION_INACCESSIBLE_FROM_SPECIFIED_TRANSACTION\0"
+    "ERROR_CANT_OPEN_MINIVERSION_WITH_MODIFY_INTENT\0"
+    "ERROR_CANT_CREATE_MORE_STREAM_MINIVERSIONS\0"
+    "ERROR_REMOTE_FILE_VERSION_MISMATCH\0"
+    "ERROR_HANDLE_NO_LONGER_VALID\0"
+    "ERROR_NO_TXF_METADATA\0"
+    "ERROR_LOG_CORRUPTION_DETECTED\0"
+    "ERROR_CANT_RECOVER_WITH_HANDLE_OPEN\0"
+    "ERROR_RM_DISCONNECTED\0"
+    "ERROR_ENLISTMENT_NOT_SUPERIOR\0"
+    "ERROR_RECOVERY_NOT_NEEDED\0"
+    "ERROR_RM_ALREADY_STARTED\0"
+    "ERROR_FILE_IDENTITY_NOT_PERSISTENT\0"
+    "ERROR_CANT_BREAK_TRANSACTIONAL_DEPENDENCY\0"
+    "ERROR_CANT_CROSS_RM_BOUNDARY\0"
+    "ERROR_TXF_DIR_NOT_EMPTY\0"
+    "ERROR_INDOUBT_TRANSACTIONS_EXIST\0"
+    "ERROR_TM_VOLATILE\0"
+    "ERROR_ROLLBACK_TIMER_EXPIRED\0"
+    "ERROR_TXF_ATTRIBUTE_CORRUPT\0"
+    "ERROR_EFS_NOT_ALLOWED_IN_TRANSACTION\0"
+    "ERROR_TRANSACTIONAL_OPEN_NOT_ALLOWED\0"
+    "ERROR_LOG_GROWTH_FAILED\0"
+    "ERROR_TRANSACTED_MAPPING_UNSUPPORTED_REMOTE\0"
+    "ERROR_TXF_METADATA_ALREADY_PRESENT\0"
+    "ERROR_TRANSACTION_SCOPE_CALLBACKS_NOT_SET\0"
+    "ERROR_TRANSACTION_REQUIRED_PROMOTION\0"
+    "ERROR_CANNOT_EXECUTE_FILE_IN_TRANSACTION\0"
+    "ERROR_TRANSACTIONS_NOT_FROZEN\0"
+    "ERROR_TRANSACTION_FREEZE_IN_PROGRESS\0"
+    "ERROR_NOT_SNAPSHOT_VOLUME\0"
+    "ERROR_NO_SAVEPOINT_WITH_OPEN_FILES\0"
+    "ERROR_DATA_LOST_REPAIR\0"
+    "ERROR_SPARSE_NOT_ALLOWED_IN_TRANSACTION\0"
+    "ERROR_TM_IDENTITY_MISMATCH\0"
+    "ERROR_FLOATED_SECTION\0"
+    "ERROR_CANNOT_ACCEPT_TRANSACTED_WORK\0"
+    "ERROR_CANNOT_ABORT_TRANSACTIONS\0"
+    "ERROR_BAD_CLUSTERS\0"
+    "ERROR_COMPRESSION_NOT_ALLOWED_IN_TRANSACTION\0"
+    "ERROR_VOLUME_DIRTY\0"
+    "ERROR_NO_LINK_TRACKING_IN_TRANSACTION\0"
+    "ERROR_OPERATION_NOT_SUPPORTED_IN_TRANSACTION\0"
+    "ERROR_EXPIRED_HANDLE\0"
+    "ERROR_TRANSACTION_NOT_ENLISTED\0"
+    "ERROR_CTX_WINSTATION_NAME_INVALID\0"
+    "ERROR_CTX_INVALID_PD\0"
+    "ERROR_CTX_PD_NOT_FOUND\0"
+    "ERROR_CTX_WD_NOT_FOUND\0"
+    "ERROR_CTX_CANNOT_MAKE_EVENTLOG_ENTRY\0"
+    "ERROR_CTX_SERVICE_NAME_COLLISION\0"
+    "ERROR_CTX_CLOSE_PENDING\0"
+    "ERROR_CTX_NO_OUTBUF\0"
+    "ERROR_CTX_MODEM_INF_NOT_FOUND\0"
+    "ERROR_CTX_INVALID_MODEMNAME\0"
+    "ERROR_CTX_MODEM_RESPONSE_ERROR\0"
+    "ERROR_CTX_MODEM_RESPONSE_TIMEOUT\0"
+    "ERROR_CTX_MODEM_RESPONSE_NO_CARRIER\0"
+    "ERROR_CTX_MODEM_RESPONSE_NO_DIALTONE\0"
+    "ERROR_CTX_MODEM_RESPONSE_BUSY\0"
+    "ERROR_CTX_MODEM_RESPONSE_VOICE\0"
+    "ERROR_CTX_TD_ERROR\0"
+    "ERROR_CTX_WINSTATION_NOT_FOUND\0"
+    "ERROR_CTX_WINSTATION_ALREADY_EXISTS\0"
+    "ERROR_CTX_WINSTATION_BUSY\0"
+    "ERROR_CTX_BAD_VIDEO_MODE\0"
+    "ERROR_CTX_GRAPHICS_INVALID\0"
+    "ERROR_CTX_LOGON_DISABLED\0"
+    "ERROR_CTX_NOT_CONSOLE\0"
+    "ERROR_CTX_CLIENT_QUERY_TIMEOUT\0"
+    "ERROR_CTX_CONSOLE_DISCONNECT\0"
+    "ERROR_CTX_CONSOLE_CONNECT\0"
+    "ERROR_CTX_SHADOW_DENIED\0"
+    "ERROR_CTX_WINSTATION_ACCESS_DENIED\0"
+    "ERROR_CTX_INVALID_WD\0"
+    "ERROR_CTX_SHADOW_INVALID\0"
+    "ERROR_CTX_SHADOW_DISABLED\0"
+    "ERROR_CTX_CLIENT_LICENSE_IN_USE\0"
+    "ERROR_CTX_CLIENT_LICENSE_NOT_SET\0"
+    "ERROR_CTX_LICENSE_NOT_AVAILABLE\0"
+    "ERROR_CTX_LICENSE_CLIENT_INVALID\0"
+    "ERROR_CTX_LICENSE_EXPIRED\0"
+    "ERROR_CTX_SHADOW_NOT_RUNNING\0"
+    "ERROR_CTX_SHADOW_ENDED_BY_MODE_CHANGE\0"
+    "ERROR_ACTIVATION_COUNT_EXCEEDED\0"
+    "ERROR_CTX_WINSTATIONS_DISABLED\0"
+    "ERROR_CTX_ENCRYPTION_LEVEL_REQUIRED\0"
+    "ERROR_CTX_SESSION_IN_USE\0"
+    "ERROR_CTX_NO_FORCE_LOGOFF\0"
+    "ERROR_CTX_ACCOUNT_RESTRICTION\0"
+    "ERROR_RDP_PROTOCOL_ERROR\0"
+    "ERROR_CTX_CDM_CONNECT\0"
+    "ERROR_CTX_CDM_DISCONNECT\0"
+    "ERROR_CTX_SECURITY_LAYER_ERROR\0"
+    "ERROR_TS_INCOMPATIBLE_SESSIONS\0"
+    "ERROR_TS_VIDEO_SUBSYSTEM_ERROR\0"
+    "ERROR_DS_NOT_INSTALLED\0"
+    "ERROR_DS_MEMBERSHIP_EVALUATED_LOCALLY\0"
+    "ERROR_DS_NO_ATTRIBUTE_OR_VALUE\0"
+    "ERROR_DS_INVALID_ATTRIBUTE_SYNTAX\0"
+    "ERROR_DS_ATTRIBUTE_TYPE_UNDEFINED\0"
+    "ERROR_DS_ATTRIBUTE_OR_VALUE_EXISTS\0"
+    "ERROR_DS_BUSY\0"
+    "ERROR_DS_UNAVAILABLE\0"
+    "ERROR_DS_NO_RIDS_ALLOCATED\0"
+    "ERROR_DS_NO_MORE_RIDS\0"
+    "ERROR_DS_INCORRECT_ROLE_OWNER\0"
+    "ERROR_DS_RIDMGR_INIT_ERROR\0"
+    "ERROR_DS_OBJ_CLASS_VIOLATION\0"
+    "ERROR_DS_CANT_ON_NON_LEAF\0"
+    "ERROR_DS_CANT_ON_RDN\0"
+    "ERROR_DS_CANT_MOD_OBJ_CLASS\0"
+    "ERROR_DS_CROSS_DOM_MOVE_ERROR\0"
+    "ERROR_DS_GC_NOT_AVAILABLE\0"
+    "ERROR_SHARED_POLICY\0"
+    "ERROR_POLICY_OBJECT_NOT_FOUND\0"
+    "ERROR_POLICY_ONLY_IN_DS\0"
+    "ERROR_PROMOTION_ACTIVE\0"
+    "ERROR_NO_PROMOTION_ACTIVE\0"
+    "ERROR_DS_OPERATIONS_ERROR\0"
+    "ERROR_DS_PROTOCOL_ERROR\0"
+    "ERROR_DS_TIMELIMIT_EXCEEDED\0"
+    "ERROR_DS_SIZELIMIT_EXCEEDED\0"
+    "ERROR_DS_ADMIN_LIMIT_EXCEEDED\0"
+    "ERROR_DS_COMPARE_FALSE\0"
+    "ERROR_DS_COMPARE_TRUE\0"
+    "ERROR_DS_AUTH_METHOD_NOT_SUPPORTED\0"
+    "ERROR_DS_STRONG_AUTH_REQUIRED\0"
+    "ERROR_DS_INAPPROPRIATE_AUTH\0"
+    "ERROR_DS_AUTH_UNKNOWN\0"
+    "ERROR_DS_REFERRAL\0"
+    "ERROR_DS_UNAVAILABLE_CRIT_EXTENSION\0"
+    "ERROR_DS_CONFIDENTIALITY_REQUIRED\0"
+    "ERROR_DS_INAPPROPRIATE_MATCHING\0"
+    "ERROR_DS_CONSTRAINT_VIOLATION\0"
+    "ERROR_DS_NO_SUCH_OBJECT\0"
+    "ERROR_DS_ALIAS_PROBLEM\0"
+    "ERROR_DS_INVALID_DN_SYNTAX\0"
+    "ERROR_DS_IS_LEAF\0"
+    "ERROR_DS_ALIAS_DEREF_PROBLEM\0"
+    "ERROR_DS_UNWILLING_TO_PERFORM\0"
+    "ERROR_DS_LOOP_DETECT\0"
+    "ERROR_DS_NAMING_VIOLATION\0"
+    "ERROR_DS_OBJECT_RESULTS_TOO_LARGE\0"
+    "ERROR_DS_AFFECTS_MULTIPLE_DSAS\0"
+    "ERROR_DS_SERVER_DOWN\0"
+    "ERROR_DS_LOCAL_ERROR\0"
+    "ERROR_DS_ENCODING_ERROR\0"
+    "ERROR_DS_DECODING_ERROR\0"
+    "ERROR_DS_FILTER_UNKNOWN\0"
+    "ERROR_DS_PARAM_ERROR\0"
+    "ERROR_DS_NOT_SUPPORTED\0"
+    "ERROR_DS_NO_RESULTS_RETURNED\0"
+    "ERROR_DS_CONTROL_NOT_FOUND\0"
+    "ERROR_DS_CLIENT_LOOP\0"
+    "ERROR_DS_REFERRAL_LIMIT_EXCEEDED\0"
+    "ERROR_DS_SORT_CONTROL_MISSING\0"
+    "ERROR_DS_OFFSET_RANGE_ERROR\0"
+    "ERROR_DS_RIDMGR_DISABLED\0"
+    "ERROR_DS_ROOT_MUST_BE_NC\0"
+    "ERROR_DS_ADD_REPLICA_INHIBITED\0"
+    "ERROR_DS_ATT_NOT_DEF_IN_SCHEMA\0"
+    "ERROR_DS_MAX_OBJ_SIZE_EXCEEDED\0"
+    "ERROR_DS_OBJ_STRING_NAME_EXISTS\0"
+    "ERROR_DS_NO_RDN_DEFINED_IN_SCHEMA\0"
+    "ERROR_DS_RDN_DOESNT_MATCH_SCHEMA\0"
+    "ERROR_DS_NO_REQUESTED_ATTS_FOUND\0"
+    "ERROR_DS_USER_BUFFER_TO_SMALL\0"
+    "ERROR_DS_ATT_IS_NOT_ON_OBJ\0"
+    "ERROR_DS_ILLEGAL_MOD_OPERATION\0"
+    "ERROR_DS_OBJ_TOO_LARGE\0"
+    "ERROR_DS_BAD_INSTANCE_TYPE\0"
+    "ERROR_DS_MASTERDSA_REQUIRED\0"
+    "ERROR_DS_OBJECT_CLASS_REQUIRED\0"
+    "ERROR_DS_MISSING_REQUIRED_ATT\0"
+    "ERROR_DS_ATT_NOT_DEF_FOR_CLASS\0"
+    "ERROR_DS_ATT_ALREADY_EXISTS\0"
+    "ERROR_DS_CANT_ADD_ATT_VALUES\0"
+    "ERROR_DS_SINGLE_VALUE_CONSTRAINT\0"
+    "ERROR_DS_RANGE_CONSTRAINT\0"
+    "ERROR_DS_ATT_VAL_ALREADY_EXISTS\0"
+    "ERROR_DS_CANT_REM_MISSING_ATT\0"
+    "ERROR_DS_CANT_REM_MISSING_ATT_VAL\0"
+    "ERROR_DS_ROOT_CANT_BE_SUBREF\0"
+    "ERROR_DS_NO_CHAINING\0"
+    "ERROR_DS_NO_CHAINED_EVAL\0"
+    "ERROR_DS_NO_PARENT_OBJECT\0"
+    "ERROR_DS_PARENT_IS_AN_ALIAS\0"
+    "ERROR_DS_CANT_MIX_MASTER_AND_REPS\0"
+    "ERROR_DS_CHILDREN_EXIST\0"
+    "ERROR_DS_OBJ_NOT_FOUND\0"
+    "ERROR_DS_ALIASED_OBJ_MISSING\0"
+    "ERROR_DS_BAD_NAME_SYNTAX\0"
+    "ERROR_DS_ALIAS_POINTS_TO_ALIAS\0"
+    "ERROR_DS_CANT_DEREF_ALIAS\0"
+    "ERROR_DS_OUT_OF_SCOPE\0"
+    "ERROR_DS_OBJECT_BEING_REMOVED\0"
+    "ERROR_DS_CANT_DELETE_DSA_OBJ\0"
+    "ERROR_DS_GENERIC_ERROR\0"
+    "ERROR_DS_DSA_MUST_BE_INT_MASTER\0"
+    "ERROR_DS_CLASS_NOT_DSA\0"
+    "ERROR_DS_INSUFF_ACCESS_RIGHTS\0"
+    "ERROR_DS_ILLEGAL_SUPERIOR\0"
+    "ERROR_DS_ATTRIBUTE_OWNED_BY_SAM\0"
+    "ERROR_DS_NAME_TOO_MANY_PARTS\0"
+    "ERROR_DS_NAME_TOO_LONG\0"
+    "ERROR_DS_NAME_VALUE_TOO_LONG\0"
+    "ERROR_DS_NAME_UNPARSEABLE\0"
+    "ERROR_DS_NAME_TYPE_UNKNOWN\0"
+    "ERROR_DS_NOT_AN_OBJECT\0"
+    "ERROR_DS_SEC_DESC_TOO_SHORT\0"
+    "ERROR_DS_SEC_DESC_INVALID\0"
+    "ERROR_DS_NO_DELETED_NAME\0"
+    "ERROR_DS_SUBREF_MUST_HAVE_PARENT\0"
+    "ERROR_DS_NCNAME_MUST_BE_NC\0"
+    "ERROR_DS_CANT_ADD_SYSTEM_ONLY\0"
+    "ERROR_DS_CLASS_MUST_BE_CONCRETE\0"
+    "ERROR_DS_INVALID_DMD\0"
+    "ERROR_DS_OBJ_GUID_EXISTS\0"
+    "ERROR_DS_NOT_ON_BACKLINK\0"
+    "ERROR_DS_NO_CROSSREF_FOR_NC\0"
+    "ERROR_DS_SHUTTING_DOWN\0"
+    "ERROR_DS_UNKNOWN_OPERATION\0"
+    "ERROR_DS_INVALID_ROLE_OWNER\0"
+    "ERROR_DS_COULDNT_CONTACT_FSMO\0"
+    "ERROR_DS_CROSS_NC_DN_RENAME\0"
+    "ERROR_DS_CANT_MOD_SYSTEM_ONLY\0"
+    "ERROR_DS_REPLICATOR_ONLY\0"
+    "ERROR_DS_OBJ_CLASS_NOT_DEFINED\0"
+    "ERROR_DS_OBJ_CLASS_NOT_SUBCLASS\0"
+    "ERROR_DS_NAME_REFERENCE_INVALID\0"
+    "ERROR_DS_CROSS_REF_EXISTS\0"
+    "ERROR_DS_CANT_DEL_MASTER_CROSSREF\0"
+    "ERROR_DS_SUBTREE_NOTIFY_NOT_NC_HEAD\0"
+    "ERROR_DS_NOTIFY_FILTER_TOO_COMPLEX\0"
+    "ERROR_DS_DUP_RDN\0"
+    "ERROR_DS_DUP_OID\0"
+    "ERROR_DS_DUP_MAPI_ID\0"
+    "ERROR_DS_DUP_SCHEMA_ID_GUID\0"
+    "ERROR_DS_DUP_LDAP_DISPLAY_NAME\0"
+    "ERROR_DS_SEMANTIC_ATT_TEST\0"
+    "ERROR_DS_SYNTAX_MISMATCH\0"
+    "ERROR_DS_EXISTS_IN_MUST_HAVE\0"
+    "ERROR_DS_EXISTS_IN_MAY_HAVE\0"
+    "ERROR_DS_NONEXISTENT_MAY_HAVE\0"
+    "ERROR_DS_NONEXISTENT_MUST_HAVE\0"
+    "ERROR_DS_AUX_CLS_TEST_FAIL\0"
+    "ERROR_DS_NONEXISTENT_POSS_SUP\0"
+    "ERROR_DS_SUB_CLS_TEST_FAIL\0"
+    "ERROR_DS_BAD_RDN_ATT_ID_SYNTAX\0"
+    "ERROR_DS_EXISTS_IN_AUX_CLS\0"
+    "ERROR_DS_EXISTS_IN_SUB_CLS\0"
+    "ERROR_DS_EXISTS_IN_POSS_SUP\0"
+    "ERROR_DS_RECALCSCHEMA_FAILED\0"
+    "ERROR_DS_TREE_DELETE_NOT_FINISHED\0"
+    "ERROR_DS_CANT_DELETE\0"
+    "ERROR_DS_ATT_SCHEMA_REQ_ID\0"
+    "ERROR_DS_BAD_ATT_SCHEMA_SYNTAX\0"
+    "ERROR_DS_CANT_CACHE_ATT\0"
+    "ERROR_DS_CANT_CACHE_CLASS\0"
+    "ERROR_DS_CANT_REMOVE_ATT_CACHE\0"
+    "ERROR_DS_CANT_REMOVE_CLASS_CACHE\0"
+    "ERROR_DS_CANT_RETRIEVE_DN\0"
+    "ERROR_DS_MISSING_SUPREF\0"
+    "ERROR_DS_CANT_RETRIEVE_INSTANCE\0"
+    "ERROR_DS_CODE_INCONSISTENCY\0"
+    "ERROR_DS_DATABASE_ERROR\0"
+    "ERROR_DS_GOVERNSID_MISSING\0"
+    "ERROR_DS_MISSING_EXPECTED_ATT\0"
+    "ERROR_DS_NCNAME_MISSING_CR_REF\0"
+    "ERROR_DS_SECURITY_CHECKING_ERROR\0"
+    "ERROR_DS_SCHEMA_NOT_LOADED\0"
+    "ERROR_DS_SCHEMA_ALLOC_FAILED\0"
+    "ERROR_DS_ATT_SCHEMA_REQ_SYNTAX\0"
+    "ERROR_DS_GCVERIFY_ERROR\0"
+    "ERROR_DS_DRA_SCHEMA_MISMATCH\0"
+    "ERROR_DS_CANT_FIND_DSA_OBJ\0"
+    "ERROR_DS_CANT_FIND_EXPECTED_NC\0"
+    "ERROR_DS_CANT_FIND_NC_IN_CACHE\0"
+    "ERROR_DS_CANT_RETRIEVE_CHILD\0"
+    "ERROR_DS_SECURITY_ILLEGAL_MODIFY\0"
+    "ERROR_DS_CANT_REPLACE_HIDDEN_REC\0"
+    "ERROR_DS_BAD_HIERARCHY_FILE\0"
+    "ERROR_DS_BUILD_HIERARCHY_TABLE_FAILED\0"
+    "ERROR_DS_CONFIG_PARAM_MISSING\0"
+    "ERROR_DS_COUNTING_AB_INDICES_FAILED\0"
+    "ERROR_DS_HIERARCHY_TABLE_MALLOC_FAILED\0"
+    "ERROR_DS_INTERNAL_FAILURE\0"
+    "ERROR_DS_UNKNOWN_ERROR\0"
+    "ERROR_DS_ROOT_REQUIRES_CLASS_TOP\0"
+    "ERROR_DS_REFUSING_FSMO_ROLES\0"
+    "ERROR_DS_MISSING_FSMO_SETTINGS\0"
+    "ERROR_DS_UNABLE_TO_SURRENDER_ROLES\0"
+    "ERROR_DS_DRA_GENERIC\0"
+    "ERROR_DS_DRA_INVALID_PARAMETER\0"
+    "ERROR_DS_DRA_BUSY\0"
+    "ERROR_DS_DRA_BAD_DN\0"
+    "ERROR_DS_DRA_BAD_NC\0"
+    "ERROR_DS_DRA_DN_EXISTS\0"
+    "ERROR_DS_DRA_INTERNAL_ERROR\0"
+    "ERROR_DS_DRA_INCONSISTENT_DIT\0"
+    "ERROR_DS_DRA_CONNECTION_FAILED\0"
+    "ERROR_DS_DRA_BAD_INSTANCE_TYPE\0"
+    "ERROR_DS_DRA_OUT_OF_MEM\0"
+    "ERROR_DS_DRA_MAIL_PROBLEM\0"
+    "ERROR_DS_DRA_REF_ALREADY_EXISTS\0"
+    "ERROR_DS_DRA_REF_NOT_FOUND\0"
+    "ERROR_DS_DRA_OBJ_IS_REP_SOURCE\0"
+    "ERROR_DS_DRA_DB_ERROR\0"
+    "ERROR_DS_DRA_NO_REPLICA\0"
+    "ERROR_DS_DRA_ACCESS_DENIED\0"
+    "ERROR_DS_DRA_NOT_SUPPORTED\0"
+    "ERROR_DS_DRA_RPC_CANCELLED\0"
+    "ERROR_DS_DRA_SOURCE_DISABLED\0"
+    "ERROR_DS_DRA_SINK_DISABLED\0"
+    "ERROR_DS_DRA_NAME_COLLISION\0"
+    "ERROR_DS_DRA_SOURCE_REINSTALLED\0"
+    "ERROR_DS_DRA_MISSING_PARENT\0"
+    "ERROR_DS_DRA_PREEMPTED\0"
+    "ERROR_DS_DRA_ABANDON_SYNC\0"
+    "ERROR_DS_DRA_SHUTDOWN\0"
+    "ERROR_DS_DRA_INCOMPATIBLE_PARTIAL_SET\0"
+    "ERROR_DS_DRA_SOURCE_IS_PARTIAL_REPLICA\0"
+    "ERROR_DS_DRA_EXTN_CONNECTION_FAILED\0"
+    "ERROR_DS_INSTALL_SCHEMA_MISMATCH\0"
+    "ERROR_DS_DUP_LINK_ID\0"
+    "ERROR_DS_NAME_ERROR_RESOLVING\0"
+    "ERROR_DS_NAME_ERROR_NOT_FOUND\0"
+    "ERROR_DS_NAME_ERROR_NOT_UNIQUE\0"
+    "ERROR_DS_NAME_ERROR_NO_MAPPING\0"
+    "ERROR_DS_NAME_ERROR_DOMAIN_ONLY\0"
+    "ERROR_DS_NAME_ERROR_NO_SYNTACTICAL_MAPPING\0"
+    "ERROR_DS_CONSTRUCTED_ATT_MOD\0"
+    "ERROR_DS_WRONG_OM_OBJ_CLASS\0"
+    "ERROR_DS_DRA_REPL_PENDING\0"
+    "ERROR_DS_DS_REQUIRED\0"
+    "ERROR_DS_INVALID_LDAP_DISPLAY_NAME\0"
+    "ERROR_DS_NON_BASE_SEARCH\0"
+    "ERROR_DS_CANT_RETRIEVE_ATTS\0"
+    "ERROR_DS_BACKLINK_WITHOUT_LINK\0"
+    "ERROR_DS_EPOCH_MISMATCH\0"
+    "ERROR_DS_SRC_NAME_MISMATCH\0"
+    "ERROR_DS_SRC_AND_DST_NC_IDENTICAL\0"
+    "ERROR_DS_DST_NC_MISMATCH\0"
+    "ERROR_DS_NOT_AUTHORITIVE_FOR_DST_NC\0"
+    "ERROR_DS_SRC_GUID_MISMATCH\0"
+    "ERROR_DS_CANT_MOVE_DELETED_OBJECT\0"
+    "ERROR_DS_PDC_OPERATION_IN_PROGRESS\0"
+    "ERROR_DS_CROSS_DOMAIN_CLEANUP_REQD\0"
+    "ERROR_DS_ILLEGAL_XDOM_MOVE_OPERATION\0"
+    "ERROR_DS_CANT_WITH_ACCT_GROUP_MEMBERSHPS\0"
+    "ERROR_DS_NC_MUST_HAVE_NC_PARENT\0"
+    "ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE\0"
+    "ERROR_DS_DST_DOMAIN_NOT_NATIVE\0"
+    "ERROR_DS_MISSING_INFRASTRUCTURE_CONTAINER\0"
+    "ERROR_DS_CANT_MOVE_ACCOUNT_GROUP\0"
+    "ERROR_DS_CANT_MOVE_RESOURCE_GROUP\0"
+    "ERROR_DS_INVALID_SEARCH_FLAG\0"
+    "ERROR_DS_NO_TREE_DELETE_ABOVE_NC\0"
+    "ERROR_DS_COULDNT_LOCK_TREE_FOR_DELETE\0"
+    "ERROR_DS_COULDNT_IDENTIFY_OBJECTS_FOR_TREE_DELETE\0"
+    "ERROR_DS_SAM_INIT_FAILURE\0"
+    "ERROR_DS_SENSITIVE_GROUP_VIOLATION\0"
+    "ERROR_DS_CANT_MOD_PRIMARYGROUPID\0"
+    "ERROR_DS_ILLEGAL_BASE_SCHEMA_MOD\0"
+    "ERROR_DS_NONSAFE_SCHEMA_CHANGE\0"
+    "ERROR_DS_SCHEMA_UPDATE_DISALLOWED\0"
+    "ERROR_DS_CANT_CREATE_UNDER_SCHEMA\0"
+    "ERROR_DS_INSTALL_NO_SRC_SCH_VERSION\0"
+    "ERROR_DS_INSTALL_NO_SCH_VERSION_IN_INIFILE\0"
+    "ERROR_DS_INVALID_GROUP_TYPE\0"
+    "ERROR_DS_NO_NEST_GLOBALGROUP_IN_MIXEDDOMAIN\0"
+    "ERROR_DS_NO_NEST_LOCALGROUP_IN_MIXEDDOMAIN\0"
+    "ERROR_DS_GLOBAL_CANT_HAVE_LOCAL_MEMBER\0"
+    "ERROR_DS_GLOBAL_CANT_HAVE_UNIVERSAL_MEMBER\0"
+    "ERROR_DS_UNIVERSAL_CANT_HAVE_LOCAL_MEMBER\0"
+    "ERROR_DS_GLOBAL_CANT_HAVE_CROSSDOMAIN_MEMBER\0"
+    "ERROR_DS_LOCAL_CANT_HAVE_CROSSDOMAIN_LOCAL_MEMBER\0"
+    "ERROR_DS_HAVE_PRIMARY_MEMBERS\0"
+    "ERROR_DS_STRING_SD_CONVERSION_FAILED\0"
+    "ERROR_DS_NAMING_MASTER_GC\0"
+    "ERROR_DS_DNS_LOOKUP_FAILURE\0"
+    "ERROR_DS_COULDNT_UPDATE_SPNS\0"
+    "ERROR_DS_CANT_RETRIEVE_SD\0"
+    "ERROR_DS_KEY_NOT_UNIQUE\0"
+    "ERROR_DS_WRONG_LINKED_ATT_SYNTAX\0"
+    "ERROR_DS_SAM_NEED_BOOTKEY_PASSWORD\0"
+    "ERROR_DS_SAM_NEED_BOOTKEY_FLOPPY\0"
+    "ERROR_DS_CANT_START\0"
+    "ERROR_DS_INIT_FAILURE\0"
+    "ERROR_DS_NO_PKT_PRIVACY_ON_CONNECTION\0"
+    "ERROR_DS_SOURCE_DOMAIN_IN_FOREST\0"
+    "ERROR_DS_DESTINATION_DOMAIN_NOT_IN_FOREST\0"
+    "ERROR_DS_DESTINATION_AUDITING_NOT_ENABLED\0"
+    "ERROR_DS_CANT_FIND_DC_FOR_SRC_DOMAIN\0"
+    "ERROR_DS_SRC_OBJ_NOT_GROUP_OR_USER\0"
+    "ERROR_DS_SRC_SID_EXISTS_IN_FOREST\0"
+    "ERROR_DS_SRC_AND_DST_OBJECT_CLASS_MISMATCH\0"
+    "ERROR_SAM_INIT_FAILURE\0"
+    "ERROR_DS_DRA_SCHEMA_INFO_SHIP\0"
+    "ERROR_DS_DRA_SCHEMA_CONFLICT\0"
+    "ERROR_DS_DRA_EARLIER_SCHEMA_CONFLICT\0"
+    "ERROR_DS_DRA_OBJ_NC_MISMATCH\0"
+    "ERROR_DS_NC_STILL_HAS_DSAS\0"
+    "ERROR_DS_GC_REQUIRED\0"
+    "ERROR_DS_LOCAL_MEMBER_OF_LOCAL_ONLY\0"
+    "ERROR_DS_NO_FPO_IN_UNIVERSAL_GROUPS\0"
+    "ERROR_DS_CANT_ADD_TO_GC\0"
+    "ERROR_DS_NO_CHECKPOINT_WITH_PDC\0"
+    "ERROR_DS_SOURCE_AUDITING_NOT_ENABLED\0"
+    "ERROR_DS_CANT_CREATE_IN_NONDOMAIN_NC\0"
+    "ERROR_DS_INVALID_NAME_FOR_SPN\0"
+    "ERROR_DS_FILTER_USES_CONTRUCTED_ATTRS\0"
+    "ERROR_DS_UNICODEPWD_NOT_IN_QUOTES\0"
+    "ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED\0"
+    "ERROR_DS_MUST_BE_RUN_ON_DST_DC\0"
+    "ERROR_DS_SRC_DC_MUST_BE_SP4_OR_GREATER\0"
+    "ERROR_DS_CANT_TREE_DELETE_CRITICAL_OBJ\0"
+    "ERROR_DS_INIT_FAILURE_CONSOLE\0"
+    "ERROR_DS_SAM_INIT_FAILURE_CONSOLE\0"
+    "ERROR_DS_FOREST_VERSION_TOO_HIGH\0"
+    "ERROR_DS_DOMAIN_VERSION_TOO_HIGH\0"
+    "ERROR_DS_FOREST_VERSION_TOO_LOW\0"
+    "ERROR_DS_DOMAIN_VERSION_TOO_LOW\0"
+    "ERROR_DS_INCOMPATIBLE_VERSION\0"
+    "ERROR_DS_LOW_DSA_VERSION\0"
+    "ERROR_DS_NO_BEHAVIOR_VERSION_IN_MIXEDDOMAIN\0"
+    "ERROR_DS_NOT_SUPPORTED_SORT_ORDER\0"
+    "ERROR_DS_NAME_NOT_UNIQUE\0"
+    "ERROR_DS_MACHINE_ACCOUNT_CREATED_PRENT4\0"
+    "ERROR_DS_OUT_OF_VERSION_STORE\0"
+    "ERROR_DS_INCOMPATIBLE_CONTROLS_USED\0"
+    "ERROR_DS_NO_REF_DOMAIN\0"
+    "ERROR_DS_RESERVED_LINK_ID\0"
+    "ERROR_DS_LINK_ID_NOT_AVAILABLE\0"
+    "ERROR_DS_AG_CANT_HAVE_UNIVERSAL_MEMBER\0"
+    "ERROR_DS_MODIFYDN_DISALLOWED_BY_INSTANCE_TYPE\0"
+    "ERROR_DS_NO_OBJECT_MOVE_IN_SCHEMA_NC\0"
+    "ERROR_DS_MODIFYDN_DISALLOWED_BY_FLAG\0"
+    "ERROR_DS_MODIFYDN_WRONG_GRANDPARENT\0"
+    "ERROR_DS_NAME_ERROR_TRUST_REFERRAL\0"
+    "ERROR_NOT_SUPPORTED_ON_STANDARD_SERVER\0"
+    "ERROR_DS_CANT_ACCESS_REMOTE_PART_OF_AD\0"
+    "ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE_V2\0"
+    "ERROR_DS_THREAD_LIMIT_EXCEEDED\0"
+    "ERROR_DS_NOT_CLOSEST\0"
+    "ERROR_DS_CANT_DERIVE_SPN_WITHOUT_SERVER_REF\0"
+    "ERROR_DS_SINGLE_USER_MODE_FAILED\0"
+    "ERROR_DS_NTDSCRIPT_SYNTAX_ERROR\0"
+    "ERROR_DS_NTDSCRIPT_PROCESS_ERROR\0"
+    "ERROR_DS_DIFFERENT_REPL_EPOCHS\0"
+    "ERROR_DS_DRS_EXTENSIONS_CHANGED\0"
+    "ERROR_DS_REPLICA_SET_CHANGE_NOT_ALLOWED_ON_DISABLED_CR\0"
+    "ERROR_DS_NO_MSDS_INTID\0"
+    "ERROR_DS_DUP_MSDS_INTID\0"
+    "ERROR_DS_EXISTS_IN_RDNATTID\0"
+    "ERROR_DS_AUTHORIZATION_FAILED\0"
+    "ERROR_DS_INVALID_SCRIPT\0"
+    "ERROR_DS_REMOTE_CROSSREF_OP_FAILED\0"
+    "ERROR_DS_CROSS_REF_BUSY\0"
+    "ERROR_DS_CANT_DERIVE_SPN_FOR_DELETED_DOMAIN\0"
+    "ERROR_DS_CANT_DEMOTE_WITH_WRITEABLE_NC\0"
+    "ERROR_DS_DUPLICATE_ID_FOUND\0"
+    "ERROR_DS_INSUFFICIENT_ATTR_TO_CREATE_OBJECT\0"
+    "ERROR_DS_GROUP_CONVERSION_ERROR\0"
+    "ERROR_DS_CANT_MOVE_APP_BASIC_GROUP\0"
+    "ERROR_DS_CANT_MOVE_APP_QUERY_GROUP\0"
+    "ERROR_DS_ROLE_NOT_VERIFIED\0"
+    "ERROR_DS_WKO_CONTAINER_CANNOT_BE_SPECIAL\0"
+    "ERROR_DS_DOMAIN_RENAME_IN_PROGRESS\0"
+    "ERROR_DS_EXISTING_AD_CHILD_NC\0"
+    "ERROR_DS_REPL_LIFETIME_EXCEEDED\0"
+    "ERROR_DS_DISALLOWED_IN_SYSTEM_CONTAINER\0"
+    "ERROR_DS_LDAP_SEND_QUEUE_FULL\0"
+    "ERROR_DS_DRA_OUT_SCHEDULE_WINDOW\0"
+    "ERROR_DS_POLICY_NOT_KNOWN\0"
+    "ERROR_NO_SITE_SETTINGS_OBJECT\0"
+    "ERROR_NO_SECRETS\0"
+    "ERROR_NO_WRITABLE_DC_FOUND\0"
+    "ERROR_DS_NO_SERVER_OBJECT\0"
+    "ERROR_DS_NO_NTDSA_OBJECT\0"
+    "ERROR_DS_NON_ASQ_SEARCH\0"
+    "ERROR_DS_AUDIT_FAILURE\0"
+    "ERROR_DS_INVALID_SEARCH_FLAG_SUBTREE\0"
+    "ERROR_DS_INVALID_SEARCH_FLAG_TUPLE\0"
+    "ERROR_DS_HIERARCHY_TABLE_TOO_DEEP\0"
+    "ERROR_DS_DRA_CORRUPT_UTD_VECTOR\0"
+    "ERROR_DS_DRA_SECRETS_DENIED\0"
+    "ERROR_DS_RESERVED_MAPI_ID\0"
+    "ERROR_DS_MAPI_ID_NOT_AVAILABLE\0"
+    "ERROR_DS_DRA_MISSING_KRBTGT_SECRET\0"
+    "ERROR_DS_DOMAIN_NAME_EXISTS_IN_FOREST\0"
+    "ERROR_DS_FLAT_NAME_EXISTS_IN_FOREST\0"
+    "ERROR_INVALID_USER_PRINCIPAL_NAME\0"
+    "ERROR_DS_OID_MAPPED_GROUP_CANT_HAVE_MEMBERS\0"
+    "ERROR_DS_OID_NOT_FOUND\0"
+    "ERROR_DS_DRA_RECYCLED_TARGET\0"
+    "ERROR_DS_DISALLOWED_NC_REDIRECT\0"
+    "ERROR_DS_HIGH_ADLDS_FFL\0"
+    "ERROR_DS_HIGH_DSA_VERSION\0"
+    "ERROR_DS_LOW_ADLDS_FFL\0"
+    "ERROR_DOMAIN_SID_SAME_AS_LOCAL_WORKSTATION\0"
+    "ERROR_DS_UNDELETE_SAM_VALIDATION_FAILED\0"
+    "ERROR_INCORRECT_ACCOUNT_TYPE\0"
+    "ERROR_DS_SPN_VALUE_NOT_UNIQUE_IN_FOREST\0"
+    "ERROR_DS_UPN_VALUE_NOT_UNIQUE_IN_FOREST\0"
+    "ERROR_DS_MISSING_FOREST_TRUST\0"
+    "ERROR_DS_VALUE_KEY_NOT_UNIQUE\0"
+    "ERROR_WEAK_WHFBKEY_BLOCKED\0"
+    "DNS_ERROR_MASK\0"
+    "DNS_ERROR_RCODE_FORMAT_ERROR\0"
+    "DNS_ERROR_RCODE_SERVER_FAILURE\0"
+    "DNS_ERROR_RCODE_NAME_ERROR\0"
+    "DNS_ERROR_RCODE_NOT_IMPLEMENTED\0"
+    "DNS_ERROR_RCODE_REFUSED\0"
+    "DNS_ERROR_RCODE_YXDOMAIN\0"
+    "DNS_ERROR_RCODE_YXRRSET\0"
+    "DNS_ERROR_RCODE_NXRRSET\0"
+    "DNS_ERROR_RCODE_NOTAUTH\0"
+    "DNS_ERROR_RCODE_NOTZONE\0"
+    "DNS_ERROR_RCODE_BADSIG\0"
+    "DNS_ERROR_RCODE_BADKEY\0"
+    "DNS_ERROR_RCODE_BADTIME\0"
+    "DNS_ERROR_DNSSEC_BASE\0"
+    "DNS_ERROR_KEYMASTER_REQUIRED\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_SIGNED_ZONE\0"
+    "DNS_ERROR_NSEC3_INCOMPATIBLE_WITH_RSA_SHA1\0"
+    "DNS_ERROR_NOT_ENOUGH_SIGNING_KEY_DESCRIPTORS\0"
+    "DNS_ERROR_UNSUPPORTED_ALGORITHM\0"
+    "DNS_ERROR_INVALID_KEY_SIZE\0"
+    "DNS_ERROR_SIGNING_KEY_NOT_ACCESSIBLE\0"
+    "DNS_ERROR_KSP_DOES_NOT_SUPPORT_PROTECTION\0"
+    "DNS_ERROR_UNEXPECTED_DATA_PROTECTION_ERROR\0"
+    "DNS_ERROR_UNEXPECTED_CNG_ERROR\0"
+    "DNS_ERROR_UNKNOWN_SIGNING_PARAMETER_VERSION\0"
+    "DNS_ERROR_KSP_NOT_ACCESSIBLE\0"
+    "DNS_ERROR_TOO_MANY_SKDS\0"
+    "DNS_ERROR_INVALID_ROLLOVER_PERIOD\0"
+    "DNS_ERROR_INVALID_INITIAL_ROLLOVER_OFFSET\0"
+    "DNS_ERROR_ROLLOVER_IN_PROGRESS\0"
+    "DNS_ERROR_STANDBY_KEY_NOT_PRESENT\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_ZSK\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_ACTIVE_SKD\0"
+    "DNS_ERROR_ROLLOVER_ALREADY_QUEUED\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_UNSIGNED_ZONE\0"
+    "DNS_ERROR_BAD_KEYMASTER\0"
+    "DNS_ERROR_INVALID_SIGNATURE_VALIDITY_PERIOD\0"
+    "DNS_ERROR_INVALID_NSEC3_ITERATION_COUNT\0"
+    "DNS_ERROR_DNSSEC_IS_DISABLED\0"
+    "DNS_ERROR_INVALID_XML\0"
+    "DNS_ERROR_NO_VALID_TRUST_ANCHORS\0"
+    "DNS_ERROR_ROLLOVER_NOT_POKEABLE\0"
+    "DNS_ERROR_NSEC3_NAME_COLLISION\0"
+    "DNS_ERROR_NSEC_INCOMPATIBLE_WITH_NSEC3_RSA_SHA1\0"
+    "DNS_ERROR_PACKET_FMT_BASE\0"
+    "DNS_ERROR_BAD_PACKET\0"
+    "DNS_ERROR_NO_PACKET\0"
+    "DNS_ERROR_RCODE\0"
+    "DNS_ERROR_UNSECURE_PACKET\0"
+    "DNS_ERROR_GENERAL_API_BASE\0"
+    "DNS_ERROR_INVALID_TYPE\0"
+    "DNS_ERROR_INVALID_IP_ADDRESS\0"
+    "DNS_ERROR_INVALID_PROPERTY\0"
+    "DNS_ERROR_TRY_AGAIN_LATER\0"
+    "DNS_ERROR_NOT_UNIQUE\0"
+    "DNS_ERROR_NON_RFC_NAME\0"
+    "DNS_ERROR_INVALID_NAME_CHAR\0"
+    "DNS_ERROR_NUMERIC_NAME\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_ROOT_SERVER\0"
+    "DNS_ERROR_NOT_ALLOWED_UNDER_DELEGATION\0"
+    "DNS_ERROR_CANNOT_FIND_ROOT_HINTS\0"
+    "DNS_ERROR_INCONSISTENT_ROOT_HINTS\0"
+    "DNS_ERROR_DWORD_VALUE_TOO_SMALL\0"
+    "DNS_ERROR_DWORD_VALUE_TOO_LARGE\0"
+    "DNS_ERROR_BACKGROUND_LOADING\0"
+    "DNS_ERROR_NOT_ALLOWED_ON_RODC\0"
+    "DNS_ERROR_NOT_ALLOWED_UNDER_DNAME\0"
+    "DNS_ERROR_DELEGATION_REQUIRED\0"
+    "DNS_ERROR_INVALID_POLICY_TABLE\0"
+    "DNS_ERROR_ADDRESS_REQUIRED\0"
+    "DNS_ERROR_ZONE_BASE\0"
+    "DNS_ERROR_ZONE_DOES_NOT_EXIST\0"
+    "DNS_ERROR_NO_ZONE_INFO\0"
+    "DNS_ERROR_INVALID_ZONE_OPERATION\0"
+    "DNS_ERROR_ZONE_CONFIGURATION_ERROR\0"
+    "DNS_ERROR_ZONE_HAS_NO_SOA_RECORD\0"
+    "DNS_ERROR_ZONE_HAS_NO_NS_RECORDS\0"
+    "DNS_ERROR_ZONE_LOCKED\0"
+    "DNS_ERROR_ZONE_CREATION_FAILED\0"
+    "DNS_ERROR_ZONE_ALREADY_EXISTS\0"
+    "DNS_ERROR_AUTOZONE_ALREADY_EXISTS\0"
+    "DNS_ERROR_INVALID_ZONE_TYPE\0"
+    "DNS_ERROR_SECONDARY_REQUIRES_MASTER_IP\0"
+    "DNS_ERROR_ZONE_NOT_SECONDARY\0"
+    "DNS_ERROR_NEED_SECONDARY_ADDRESSES\0"
+    "DNS_ERROR_WINS_INIT_FAILED\0"
+    "DNS_ERROR_NEED_WINS_SERVERS\0"
+    "DNS_ERROR_NBSTAT_INIT_FAILED\0"
+    "DNS_ERROR_SOA_DELETE_INVALID\0"
+    "DNS_ERROR_FORWARDER_ALREADY_EXISTS\0"
+    "DNS_ERROR_ZONE_REQUIRES_MASTER_IP\0"
+    "DNS_ERROR_ZONE_IS_SHUTDOWN\0"
+    "DNS_ERROR_ZONE_LOCKED_FOR_SIGNING\0"
+    "DNS_ERROR_DATAFILE_BASE\0"
+    "DNS_ERROR_PRIMARY_REQUIRES_DATAFILE\0"
+    "DNS_ERROR_INVALID_DATAFILE_NAME\0"
+    "DNS_ERROR_DATAFILE_OPEN_FAILURE\0"
+    "DNS_ERROR_FILE_WRITEBACK_FAILED\0"
+    "DNS_ERROR_DATAFILE_PARSING\0"
+    "DNS_ERROR_DATABASE_BASE\0"
+    "DNS_ERROR_RECORD_DOES_NOT_EXIST\0"
+    "DNS_ERROR_RECORD_FORMAT\0"
+    "DNS_ERROR_NODE_CREATION_FAILED\0"
+    "DNS_ERROR_UNKNOWN_RECORD_TYPE\0"
+    "DNS_ERROR_RECORD_TIMED_OUT\0"
+    "DNS_ERROR_NAME_NOT_IN_ZONE\0"
+    "DNS_ERROR_CNAME_LOOP\0"
+    "DNS_ERROR_NODE_IS_CNAME\0"
+    "DNS_ERROR_CNAME_COLLISION\0"
+    "DNS_ERROR_RECORD_ONLY_AT_ZONE_ROOT\0"
+    "DNS_ERROR_RECORD_ALREADY_EXISTS\0"
+    "DNS_ERROR_SECONDARY_DATA\0"
+    "DNS_ERROR_NO_CREATE_CACHE_DATA\0"
+    "DNS_ERROR_NAME_DOES_NOT_EXIST\0"
+    "DNS_ERROR_DS_UNAVAILABLE\0"
+    "DNS_ERROR_DS_ZONE_ALREADY_EXISTS\0"
+    "DNS_ERROR_NO_BOOTFILE_IF_DS_ZONE\0"
+    "DNS_ERROR_NODE_IS_DNAME\0"
+    "DNS_ERROR_DNAME_COLLISION\0"
+    "DNS_ERROR_ALIAS_LOOP\0"
+    "DNS_ERROR_OPERATION_BASE\0"
+    "DNS_ERROR_AXFR\0"
+    "DNS_ERROR_SECURE_BASE\0"
+    "DNS_ERROR_SETUP_BASE\0"
+    "DNS_ERROR_NO_TCPIP\0"
+    "DNS_ERROR_NO_DNS_SERVERS\0"
+    "DNS_ERROR_DP_BASE\0"
+    "DNS_ERROR_DP_DOES_NOT_EXIST\0"
+    "DNS_ERROR_DP_ALREADY_EXISTS\0"
+    "DNS_ERROR_DP_NOT_ENLISTED\0"
+    "DNS_ERROR_DP_ALREADY_ENLISTED\0"
+    "DNS_ERROR_DP_NOT_AVAILABLE\0"
+    "DNS_ERROR_DP_FSMO_ERROR\0"
+    "DNS_ERROR_RRL_NOT_ENABLED\0"
+    "DNS_ERROR_RRL_INVALID_WINDOW_SIZE\0"
+    "DNS_ERROR_RRL_INVALID_IPV4_PREFIX\0"
+    "DNS_ERROR_RRL_INVALID_IPV6_PREFIX\0"
+    "DNS_ERROR_RRL_INVALID_TC_RATE\0"
+    "DNS_ERROR_RRL_INVALID_LEAK_RATE\0"
+    "DNS_ERROR_RRL_LEAK_RATE_LESSTHAN_TC_RATE\0"
+    "DNS_ERROR_VIRTUALIZATION_INSTANCE_ALREADY_EXISTS\0"
+    "DNS_ERROR_VIRTUALIZATION_INSTANCE_DOES_NOT_EXIST\0"
+    "DNS_ERROR_VIRTUALIZATION_TREE_LOCKED\0"
+    "DNS_ERROR_INVAILD_VIRTUALIZATION_INSTANCE_NAME\0"
+    "DNS_ERROR_DEFAULT_VIRTUALIZATION_INSTANCE\0"
+    "DNS_ERROR_ZONESCOPE_ALREADY_EXISTS\0"
+    "DNS_ERROR_ZONESCOPE_DOES_NOT_EXIST\0"
+    "DNS_ERROR_DEFAULT_ZONESCOPE\0"
+    "DNS_ERROR_INVALID_ZONESCOPE_NAME\0"
+    "DNS_ERROR_NOT_ALLOWED_WITH_ZONESCOPES\0"
+    "DNS_ERROR_LOAD_ZONESCOPE_FAILED\0"
+    "DNS_ERROR_ZONESCOPE_FILE_WRITEBACK_FAILED\0"
+    "DNS_ERROR_INVALID_SCOPE_NAME\0"
+    "DNS_ERROR_SCOPE_DOES_NOT_EXIST\0"
+    "DNS_ERROR_DEFAULT_SCOPE\0"
+    "DNS_ERROR_INVALID_SCOPE_OPERATION\0"
+    "DNS_ERROR_SCOPE_LOCKED\0"
+    "DNS_ERROR_SCOPE_ALREADY_EXISTS\0"
+    "DNS_ERROR_POLICY_ALREADY_EXISTS\0"
+    "DNS_ERROR_POLICY_DOES_NOT_EXIST\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA\0"
+    "DNS_ERROR_POLICY_INVALID_SETTINGS\0"
+    "DNS_ERROR_CLIENT_SUBNET_IS_ACCESSED\0"
+    "DNS_ERROR_CLIENT_SUBNET_DOES_NOT_EXIST\0"
+    "DNS_ERROR_CLIENT_SUBNET_ALREADY_EXISTS\0"
+    "DNS_ERROR_SUBNET_DOES_NOT_EXIST\0"
+    "DNS_ERROR_SUBNET_ALREADY_EXISTS\0"
+    "DNS_ERROR_POLICY_LOCKED\0"
+    "DNS_ERROR_POLICY_INVALID_WEIGHT\0"
+    "DNS_ERROR_POLICY_INVALID_NAME\0"
+    "DNS_ERROR_POLICY_MISSING_CRITERIA\0"
+    "DNS_ERROR_INVALID_CLIENT_SUBNET_NAME\0"
+    "DNS_ERROR_POLICY_PROCESSING_ORDER_INVALID\0"
+    "DNS_ERROR_POLICY_SCOPE_MISSING\0"
+    "DNS_ERROR_POLICY_SCOPE_NOT_ALLOWED\0"
+    "DNS_ERROR_SERVERSCOPE_IS_REFERENCED\0"
+    "DNS_ERROR_ZONESCOPE_IS_REFERENCED\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_CLIENT_SUBNET\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_TRANSPORT_PROTOCOL\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_NETWORK_PROTOCOL\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_INTERFACE\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_FQDN\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_QUERY_TYPE\0"
+    "DNS_ERROR_POLICY_INVALID_CRITERIA_TIME_OF_DAY\0"
+    "ERROR_IPSEC_QM_POLICY_EXISTS\0"
+    "ERROR_IPSEC_QM_POLICY_NOT_FOUND\0"
+    "ERROR_IPSEC_QM_POLICY_IN_USE\0"
+    "ERROR_IPSEC_MM_POLICY_EXISTS\0"
+    "ERROR_IPSEC_MM_POLICY_NOT_FOUND\0"
+    "ERROR_IPSEC_MM_POLICY_IN_USE\0"
+    "ERROR_IPSEC_MM_FILTER_EXISTS\0"
+    "ERROR_IPSEC_MM_FILTER_NOT_FOUND\0"
+    "ERROR_IPSEC_TRANSPORT_FILTER_EXISTS\0"
+    "ERROR_IPSEC_TRANSPORT_FILTER_NOT_FOUND\0"
+    "ERROR_IPSEC_MM_AUTH_EXISTS\0"
+    "ERROR_IPSEC_MM_AUTH_NOT_FOUND\0"
+    "ERROR_IPSEC_MM_AUTH_IN_USE\0"
+    "ERROR_IPSEC_DEFAULT_MM_POLICY_NOT_FOUND\0"
+    "ERROR_IPSEC_DEFAULT_MM_AUTH_NOT_FOUND\0"
+    "ERROR_IPSEC_DEFAULT_QM_POLICY_NOT_FOUND\0"
+    "ERROR_IPSEC_TUNNEL_FILTER_EXISTS\0"
+    "ERROR_IPSEC_TUNNEL_FILTER_NOT_FOUND\0"
+    "ERROR_IPSEC_MM_FILTER_PENDING_DELETION\0"
+    "ERROR_IPSEC_TRANSPORT_FILTER_PENDING_DELETION\0"
+    "ERROR_IPSEC_TUNNEL_FILTER_PENDING_DELETION\0"
+    "ERROR_IPSEC_MM_POLICY_PENDING_DELETION\0"
+    "ERROR_IPSEC_MM_AUTH_PENDING_DELETION\0"
+    "ERROR_IPSEC_QM_POLICY_PENDING_DELETION\0"
+    "ERROR_IPSEC_IKE_NEG_STATUS_BEGIN\0"
+    "ERROR_IPSEC_IKE_AUTH_FAIL\0"
+    "ERROR_IPSEC_IKE_ATTRIB_FAIL\0"
+    "ERROR_IPSEC_IKE_NEGOTIATION_PENDING\0"
+    "ERROR_IPSEC_IKE_GENERAL_PROCESSING_ERROR\0"
+    "ERROR_IPSEC_IKE_TIMED_OUT\0"
+    "ERROR_IPSEC_IKE_NO_CERT\0"
+    "ERROR_IPSEC_IKE_SA_DELETED\0"
+    "ERROR_IPSEC_IKE_SA_REAPED\0"
+    "ERROR_IPSEC_IKE_MM_ACQUIRE_DROP\0"
+    "ERROR_IPSEC_IKE_QM_ACQUIRE_DROP\0"
+    "ERROR_IPSEC_IKE_QUEUE_DROP_MM\0"
+    "ERROR_IPSEC_IKE_QUEUE_DROP_NO_MM\0"
+    "ERROR_IPSEC_IKE_DROP_NO_RESPONSE\0"
+    "ERROR_IPSEC_IKE_MM_DELAY_DROP\0"
+    "ERROR_IPSEC_IKE_QM_DELAY_DROP\0"
+    "ERROR_IPSEC_IKE_ERROR\0"
+    "ERROR_IPSEC_IKE_CRL_FAILED\0"
+    "ERROR_IPSEC_IKE_INVALID_KEY_USAGE\0"
+    "ERROR_IPSEC_IKE_INVALID_CERT_TYPE\0"
+    "ERROR_IPSEC_IKE_NO_PRIVATE_KEY\0"
+    "ERROR_IPSEC_IKE_SIMULTANEOUS_REKEY\0"
+    "ERROR_IPSEC_IKE_DH_FAIL\0"
+    "ERROR_IPSEC_IKE_CRITICAL_PAYLOAD_NOT_RECOGNIZED\0"
+    "ERROR_IPSEC_IKE_INVALID_HEADER\0"
+    "ERROR_IPSEC_IKE_NO_POLICY\0"
+    "ERROR_IPSEC_IKE_INVALID_SIGNATURE\0"
+    "ERROR_IPSEC_IKE_KERBEROS_ERROR\0"
+    "ERROR_IPSEC_IKE_NO_PUBLIC_KEY\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_SA\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_PROP\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_TRANS\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_KE\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_ID\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_CERT\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_CERT_REQ\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_HASH\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_SIG\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_NONCE\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_NOTIFY\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_DELETE\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_VENDOR\0"
+    "ERROR_IPSEC_IKE_INVALID_PAYLOAD\0"
+    "ERROR_IPSEC_IKE_LOAD_SOFT_SA\0"
+    "ERROR_IPSEC_IKE_SOFT_SA_TORN_DOWN\0"
+    "ERROR_IPSEC_IKE_INVALID_COOKIE\0"
+    "ERROR_IPSEC_IKE_NO_PEER_CERT\0"
+    "ERROR_IPSEC_IKE_PEER_CRL_FAILED\0"
+    "ERROR_IPSEC_IKE_POLICY_CHANGE\0"
+    "ERROR_IPSEC_IKE_NO_MM_POLICY\0"
+    "ERROR_IPSEC_IKE_NOTCBPRIV\0"
+    "ERROR_IPSEC_IKE_SECLOADFAIL\0"
+    "ERROR_IPSEC_IKE_FAILSSPINIT\0"
+    "ERROR_IPSEC_IKE_FAILQUERYSSP\0"
+    "ERROR_IPSEC_IKE_SRVACQFAIL\0"
+    "ERROR_IPSEC_IKE_SRVQUERYCRED\0"
+    "ERROR_IPSEC_IKE_GETSPIFAIL\0"
+    "ERROR_IPSEC_IKE_INVALID_FILTER\0"
+    "ERROR_IPSEC_IKE_OUT_OF_MEMORY\0"
+    "ERROR_IPSEC_IKE_ADD_UPDATE_KEY_FAILED\0"
+    "ERROR_IPSEC_IKE_INVALID_POLICY\0"
+    "ERROR_IPSEC_IKE_UNKNOWN_DOI\0"
+    "ERROR_IPSEC_IKE_INVALID_SITUATION\0"
+    "ERROR_IPSEC_IKE_DH_FAILURE\0"
+    "ERROR_IPSEC_IKE_INVALID_GROUP\0"
+    "ERROR_IPSEC_IKE_ENCRYPT\0"
+    "ERROR_IPSEC_IKE_DECRYPT\0"
+    "ERROR_IPSEC_IKE_POLICY_MATCH\0"
+    "ERROR_IPSEC_IKE_UNSUPPORTED_ID\0"
+    "ERROR_IPSEC_IKE_INVALID_HASH\0"
+    "ERROR_IPSEC_IKE_INVALID_HASH_ALG\0"
+    "ERROR_IPSEC_IKE_INVALID_HASH_SIZE\0"
+    "ERROR_IPSEC_IKE_INVALID_ENCRYPT_ALG\0"
+    "ERROR_IPSEC_IKE_INVALID_AUTH_ALG\0"
+    "ERROR_IPSEC_IKE_INVALID_SIG\0"
+    "ERROR_IPSEC_IKE_LOAD_FAILED\0"
+    "ERROR_IPSEC_IKE_RPC_DELETE\0"
+    "ERROR_IPSEC_IKE_BENIGN_REINIT\0"
+    "ERROR_IPSEC_IKE_INVALID_RESPONDER_LIFETIME_NOTIFY\0"
+    "ERROR_IPSEC_IKE_INVALID_MAJOR_VERSION\0"
+    "ERROR_IPSEC_IKE_INVALID_CERT_KEYLEN\0"
+    "ERROR_IPSEC_IKE_MM_LIMIT\0"
+    "ERROR_IPSEC_IKE_NEGOTIATION_DISABLED\0"
+    "ERROR_IPSEC_IKE_QM_LIMIT\0"
+    "ERROR_IPSEC_IKE_MM_EXPIRED\0"
+    "ERROR_IPSEC_IKE_PEER_MM_ASSUMED_INVALID\0"
+    "ERROR_IPSEC_IKE_CERT_CHAIN_POLICY_MISMATCH\0"
+    "ERROR_IPSEC_IKE_UNEXPECTED_MESSAGE_ID\0"
+    "ERROR_IPSEC_IKE_INVALID_AUTH_PAYLOAD\0"
+    "ERROR_IPSEC_IKE_DOS_COOKIE_SENT\0"
+    "ERROR_IPSEC_IKE_SHUTTING_DOWN\0"
+    "ERROR_IPSEC_IKE_CGA_AUTH_FAILED\0"
+    "ERROR_IPSEC_IKE_PROCESS_ERR_NATOA\0"
+    "ERROR_IPSEC_IKE_INVALID_MM_FOR_QM\0"
+    "ERROR_IPSEC_IKE_QM_EXPIRED\0"
+    "ERROR_IPSEC_IKE_TOO_MANY_FILTERS\0"
+    "ERROR_IPSEC_IKE_NEG_STATUS_END\0"
+    "ERROR_IPSEC_IKE_KILL_DUMMY_NAP_TUNNEL\0"
+    "ERROR_IPSEC_IKE_INNER_IP_ASSIGNMENT_FAILURE\0"
+    "ERROR_IPSEC_IKE_REQUIRE_CP_PAYLOAD_MISSING\0"
+    "ERROR_IPSEC_KEY_MODULE_IMPERSONATION_NEGOTIATION_PENDING\0"
+    "ERROR_IPSEC_IKE_COEXISTENCE_SUPPRESS\0"
+    "ERROR_IPSEC_IKE_RATELIMIT_DROP\0"
+    "ERROR_IPSEC_IKE_PEER_DOESNT_SUPPORT_MOBIKE\0"
+    "ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE\0"
+    "ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_FAILURE\0"
+    "ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE_WITH_OPTIONAL_RETRY\0"
+    "ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_AND_CERTMAP_FAILURE\0"
+    "ERROR_IPSEC_IKE_NEG_STATUS_EXTENDED_END\0"
+    "ERROR_IPSEC_BAD_SPI\0"
+    "ERROR_IPSEC_SA_LIFETIME_EXPIRED\0"
+    "ERROR_IPSEC_WRONG_SA\0"
+    "ERROR_IPSEC_REPLAY_CHECK_FAILED\0"
+    "ERROR_IPSEC_INVALID_PACKET\0"
+    "ERROR_IPSEC_INTEGRITY_CHECK_FAILED\0"
+    "ERROR_IPSEC_CLEAR_TEXT_DROP\0"
+    "ERROR_IPSEC_AUTH_FIREWALL_DROP\0"
+    "ERROR_IPSEC_THROTTLE_DROP\0"
+    "ERROR_IPSEC_DOSP_BLOCK\0"
+    "ERROR_IPSEC_DOSP_RECEIVED_MULTICAST\0"
+    "ERROR_IPSEC_DOSP_INVALID_PACKET\0"
+    "ERROR_IPSEC_DOSP_STATE_LOOKUP_FAILED\0"
+    "ERROR_IPSEC_DOSP_MAX_ENTRIES\0"
+    "ERROR_IPSEC_DOSP_KEYMOD_NOT_ALLOWED\0"
+    "ERROR_IPSEC_DOSP_NOT_INSTALLED\0"
+    "ERROR_IPSEC_DOSP_MAX_PER_IP_RATELIMIT_QUEUES\0"
+    "ERROR_SXS_SECTION_NOT_FOUND\0"
+    "ERROR_SXS_CANT_GEN_ACTCTX\0"
+    "ERROR_SXS_INVALID_ACTCTXDATA_FORMAT\0"
+    "ERROR_SXS_ASSEMBLY_NOT_FOUND\0"
+    "ERROR_SXS_MANIFEST_FORMAT_ERROR\0"
+    "ERROR_SXS_MANIFEST_PARSE_ERROR\0"
+    "ERROR_SXS_ACTIVATION_CONTEXT_DISABLED\0"
+    "ERROR_SXS_KEY_NOT_FOUND\0"
+    "ERROR_SXS_VERSION_CONFLICT\0"
+    "ERROR_SXS_WRONG_SECTION_TYPE\0"
+    "ERROR_SXS_THREAD_QUERIES_DISABLED\0"
+    "ERROR_SXS_PROCESS_DEFAULT_ALREADY_SET\0"
+    "ERROR_SXS_UNKNOWN_ENCODING_GROUP\0"
+    "ERROR_SXS_UNKNOWN_ENCODING\0"
+    "ERROR_SXS_INVALID_XML_NAMESPACE_URI\0"
+    "ERROR_SXS_ROOT_MANIFEST_DEPENDENCY_NOT_INSTALLED\0"
+    "ERROR_SXS_LEAF_MANIFEST_DEPENDENCY_NOT_INSTALLED\0"
+    "ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE\0"
+    "ERROR_SXS_MANIFEST_MISSING_REQUIRED_DEFAULT_NAMESPACE\0"
+    "ERROR_SXS_MANIFEST_INVALID_REQUIRED_DEFAULT_NAMESPACE\0"
+    "ERROR_SXS_PRIVATE_MANIFEST_CROSS_PATH_WITH_REPARSE_POINT\0"
+    "ERROR_SXS_DUPLICATE_DLL_NAME\0"
+    "ERROR_SXS_DUPLICATE_WINDOWCLASS_NAME\0"
+    "ERROR_SXS_DUPLICATE_CLSID\0"
+    "ERROR_SXS_DUPLICATE_IID\0"
+    "ERROR_SXS_DUPLICATE_TLBID\0"
+    "ERROR_SXS_DUPLICATE_PROGID\0"
+    "ERROR_SXS_DUPLICATE_ASSEMBLY_NAME\0"
+    "ERROR_SXS_FILE_HASH_MISMATCH\0"
+    "ERROR_SXS_POLICY_PARSE_ERROR\0"
+    "ERROR_SXS_XML_E_MISSINGQUOTE\0"
+    "ERROR_SXS_XML_E_COMMENTSYNTAX\0"
+    "ERROR_SXS_XML_E_BADSTARTNAMECHAR\0"
+    "ERROR_SXS_XML_E_BADNAMECHAR\0"
+    "ERROR_SXS_XML_E_BADCHARINSTRING\0"
+    "ERROR_SXS_XML_E_XMLDECLSYNTAX\0"
+    "ERROR_SXS_XML_E_BADCHARDATA\0"
+    "ERROR_SXS_XML_E_MISSINGWHITESPACE\0"
+    "ERROR_SXS_XML_E_EXPECTINGTAGEND\0"
+    "ERROR_SXS_XML_E_MISSINGSEMICOLON\0"
+    "ERROR_SXS_XML_E_UNBALANCEDPAREN\0"
+    "ERROR_SXS_XML_E_INTERNALERROR\0"
+    "ERROR_SXS_XML_E_UNEXPECTED_WHITESPACE\0"
+    "ERROR_SXS_XML_E_INCOMPLETE_ENCODING\0"
+    "ERROR_SXS_XML_E_MISSING_PAREN\0"
+    "ERROR_SXS_XML_E_EXPECTINGCLOSEQUOTE\0"
+    "ERROR_SXS_XML_E_MULTIPLE_COLONS\0"
+    "ERROR_SXS_XML_E_INVALID_DECIMAL\0"
+    "ERROR_SXS_XML_E_INVALID_HEXIDECIMAL\0"
+    "ERROR_SXS_XML_E_INVALID_UNICODE\0"
+    "ERROR_SXS_XML_E_WHITESPACEORQUESTIONMARK\0"
+    "ERROR_SXS_XML_E_UNEXPECTEDENDTAG\0"
+    "ERROR_SXS_XML_E_UNCLOSEDTAG\0"
+    "ERROR_SXS_XML_E_DUPLICATEATTRIBUTE\0"
+    "ERROR_SXS_XML_E_MULTIPLEROOTS\0"
+    "ERROR_SXS_XML_E_INVALIDATROOTLEVEL\0"
+    "ERROR_SXS_XML_E_BADXMLDECL\0"
+    "ERROR_SXS_XML_E_MISSINGROOT\0"
+    "ERROR_SXS_XML_E_UNEXPECTEDEOF\0"
+    "ERROR_SXS_XML_E_BADPEREFINSUBSET\0"
+    "ERROR_SXS_XML_E_UNCLOSEDSTARTTAG\0"
+    "ERROR_SXS_XML_E_UNCLOSEDENDTAG\0"
+    "ERROR_SXS_XML_E_UNCLOSEDSTRING\0"
+    "ERROR_SXS_XML_E_UNCLOSEDCOMMENT\0"
+    "ERROR_SXS_XML_E_UNCLOSEDDECL\0"
+    "ERROR_SXS_XML_E_UNCLOSEDCDATA\0"
+    "ERROR_SXS_XML_E_RESERVEDNAMESPACE\0"
+    "ERROR_SXS_XML_E_INVALIDENCODING\0"
+    "ERROR_SXS_XML_E_INVALIDSWITCH\0"
+    "ERROR_SXS_XML_E_BADXMLCASE\0"
+    "ERROR_SXS_XML_E_INVALID_STANDALONE\0"
+    "ERROR_SXS_XML_E_UNEXPECTED_STANDALONE\0"
+    "ERROR_SXS_XML_E_INVALID_VERSION\0"
+    "ERROR_SXS_XML_E_MISSINGEQUALS\0"
+    "ERROR_SXS_PROTECTION_RECOVERY_FAILED\0"
+    "ERROR_SXS_PROTECTION_PUBLIC_KEY_TOO_SHORT\0"
+    "ERROR_SXS_PROTECTION_CATALOG_NOT_VALID\0"
+    "ERROR_SXS_UNTRANSLATABLE_HRESULT\0"
+    "ERROR_SXS_PROTECTION_CATALOG_FILE_MISSING\0"
+    "ERROR_SXS_MISSING_ASSEMBLY_IDENTITY_ATTRIBUTE\0"
+    "ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE_NAME\0"
+    "ERROR_SXS_ASSEMBLY_MISSING\0"
+    "ERROR_SXS_CORRUPT_ACTIVATION_STACK\0"
+    "ERROR_SXS_CORRUPTION\0"
+    "ERROR_SXS_EARLY_DEACTIVATION\0"
+    "ERROR_SXS_INVALID_DEACTIVATION\0"
+    "ERROR_SXS_MULTIPLE_DEACTIVATION\0"
+    "ERROR_SXS_PROCESS_TERMINATION_REQUESTED\0"
+    "ERROR_SXS_RELEASE_ACTIVATION_CONTEXT\0"
+    "ERROR_SXS_SYSTEM_DEFAULT_ACTIVATION_CONTEXT_EMPTY\0"
+    "ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_VALUE\0"
+    "ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_NAME\0"
+    "ERROR_SXS_IDENTITY_DUPLICATE_ATTRIBUTE\0"
+    "ERROR_SXS_IDENTITY_PARSE_ERROR\0"
+    "ERROR_MALFORMED_SUBSTITUTION_STRING\0"
+    "ERROR_SXS_INCORRECT_PUBLIC_KEY_TOKEN\0"
+    "ERROR_UNMAPPED_SUBSTITUTION_STRING\0"
+    "ERROR_SXS_ASSEMBLY_NOT_LOCKED\0"
+    "ERROR_SXS_COMPONENT_STORE_CORRUPT\0"
+    "ERROR_ADVANCED_INSTALLER_FAILED\0"
+    "ERROR_XML_ENCODING_MISMATCH\0"
+    "ERROR_SXS_MANIFEST_IDENTITY_SAME_BUT_CONTENTS_DIFFERENT\0"
+    "ERROR_SXS_IDENTITIES_DIFFERENT\0"
+    "ERROR_SXS_ASSEMBLY_IS_NOT_A_DEPLOYMENT\0"
+    "ERROR_SXS_FILE_NOT_PART_OF_ASSEMBLY\0"
+    "ERROR_SXS_MANIFEST_TOO_BIG\0"
+    "ERROR_SXS_SETTING_NOT_REGISTERED\0"
+    "ERROR_SXS_TRANSACTION_CLOSURE_INCOMPLETE\0"
+    "ERROR_SMI_PRIMITIVE_INSTALLER_FAILED\0"
+    "ERROR_GENERIC_COMMAND_FAILED\0"
+    "ERROR_SXS_FILE_HASH_MISSING\0"
+    "ERROR_SXS_DUPLICATE_ACTIVATABLE_CLASS\0"
+    "ERROR_EVT_INVALID_CHANNEL_PATH\0"
+    "ERROR_EVT_INVALID_QUERY\0"
+    "ERROR_EVT_PUBLISHER_METADATA_NOT_FOUND\0"
+    "ERROR_EVT_EVENT_TEMPLATE_NOT_FOUND\0"
+    "ERROR_EVT_INVALID_PUBLISHER_NAME\0"
+    "ERROR_EVT_INVALID_EVENT_DATA\0"
+    "ERROR_EVT_CHANNEL_NOT_FOUND\0"
+    "ERROR_EVT_MALFORMED_XML_TEXT\0"
+    "ERROR_EVT_SUBSCRIPTION_TO_DIRECT_CHANNEL\0"
+    "ERROR_EVT_CONFIGURATION_ERROR\0"
+    "ERROR_EVT_QUERY_RESULT_STALE\0"
+    "ERROR_EVT_QUERY_RESULT_INVALID_POSITION\0"
+    "ERROR_EVT_NON_VALIDATING_MSXML\0"
+    "ERROR_EVT_FILTER_ALREADYSCOPED\0"
+    "ERROR_EVT_FILTER_NOTELTSET\0"
+    "ERROR_EVT_FILTER_INVARG\0"
+    "ERROR_EVT_FILTER_INVTEST\0"
+    "ERROR_EVT_FILTER_INVTYPE\0"
+    "ERROR_EVT_FILTER_PARSEERR\0"
+    "ERROR_EVT_FILTER_UNSUPPORTEDOP\0"
+    "ERROR_EVT_FILTER_UNEXPECTEDTOKEN\0"
+    "ERROR_EVT_INVALID_OPERATION_OVER_ENABLED_DIRECT_CHANNEL\0"
+    "ERROR_EVT_INVALID_CHANNEL_PROPERTY_VALUE\0"
+    "ERROR_EVT_INVALID_PUBLISHER_PROPERTY_VALUE\0"
+    "ERROR_EVT_CHANNEL_CANNOT_ACTIVATE\0"
+    "ERROR_EVT_FILTER_TOO_COMPLEX\0"
+    "ERROR_EVT_MESSAGE_NOT_FOUND\0"
+    "ERROR_EVT_MESSAGE_ID_NOT_FOUND\0"
+    "ERROR_EVT_UNRESOLVED_VALUE_INSERT\0"
+    "ERROR_EVT_UNRESOLVED_PARAMETER_INSERT\0"
+    "ERROR_EVT_MAX_INSERTS_REACHED\0"
+    "ERROR_EVT_EVENT_DEFINITION_NOT_FOUND\0"
+    "ERROR_EVT_MESSAGE_LOCALE_NOT_FOUND\0"
+    "ERROR_EVT_VERSION_TOO_OLD\0"
+    "ERROR_EVT_VERSION_TOO_NEW\0"
+    "ERROR_EVT_CANNOT_OPEN_CHANNEL_OF_QUERY\0"
+    "ERROR_EVT_PUBLISHER_DISABLED\0"
+    "ERROR_EVT_FILTER_OUT_OF_RANGE\0"
+    "ERROR_EC_SUBSCRIPTION_CANNOT_ACTIVATE\0"
+    "ERROR_EC_LOG_DISABLED\0"
+    "ERROR_EC_CIRCULAR_FORWARDING\0"
+    "ERROR_EC_CREDSTORE_FULL\0"
+    "ERROR_EC_CRED_NOT_FOUND\0"
+    "ERROR_EC_NO_ACTIVE_CHANNEL\0"
+    "ERROR_MUI_FILE_NOT_FOUND\0"
+    "ERROR_MUI_INVALID_FILE\0"
+    "ERROR_MUI_INVALID_RC_CONFIG\0"
+    "ERROR_MUI_INVALID_LOCALE_NAME\0"
+    "ERROR_MUI_INVALID_ULTIMATEFALLBACK_NAME\0"
+    "ERROR_MUI_FILE_NOT_LOADED\0"
+    "ERROR_RESOURCE_ENUM_USER_STOP\0"
+    "ERROR_MUI_INTLSETTINGS_UILANG_NOT_INSTALLED\0"
+    "ERROR_MUI_INTLSETTINGS_INVALID_LOCALE_NAME\0"
+    "ERROR_MRM_RUNTIME_NO_DEFAULT_OR_NEUTRAL_RESOURCE\0"
+    "ERROR_MRM_INVALID_PRICONFIG\0"
+    "ERROR_MRM_INVALID_FILE_TYPE\0"
+    "ERROR_MRM_UNKNOWN_QUALIFIER\0"
+    "ERROR_MRM_INVALID_QUALIFIER_VALUE\0"
+    "ERROR_MRM_NO_CANDIDATE\0"
+    "ERROR_MRM_NO_MATCH_OR_DEFAULT_CANDIDATE\0"
+    "ERROR_MRM_RESOURCE_TYPE_MISMATCH\0"
+    "ERROR_MRM_DUPLICATE_MAP_NAME\0"
+    "ERROR_MRM_DUPLICATE_ENTRY\0"
+    "ERROR_MRM_INVALID_RESOURCE_IDENTIFIER\0"
+    "ERROR_MRM_FILEPATH_TOO_LONG\0"
+    "ERROR_MRM_UNSUPPORTED_DIRECTORY_TYPE\0"
+    "ERROR_MRM_INVALID_PRI_FILE\0"
+    "ERROR_MRM_NAMED_RESOURCE_NOT_FOUND\0"
+    "ERROR_MRM_MAP_NOT_FOUND\0"
+    "ERROR_MRM_UNSUPPORTED_PROFILE_TYPE\0"
+    "ERROR_MRM_INVALID_QUALIFIER_OPERATOR\0"
+    "ERROR_MRM_INDETERMINATE_QUALIFIER_VALUE\0"
+    "ERROR_MRM_AUTOMERGE_ENABLED\0"
+    "ERROR_MRM_TOO_MANY_RESOURCES\0"
+    "ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_MERGE\0"
+    "ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_LOAD_UNLOAD_PRI_FILE\0"
+    "ERROR_MRM_NO_CURRENT_VIEW_ON_THREAD\0"
+    "ERROR_DIFFERENT_PROFILE_RESOURCE_MANAGER_EXIST\0"
+    "ERROR_OPERATION_NOT_ALLOWED_FROM_SYSTEM_COMPONENT\0"
+    "ERROR_MRM_DIRECT_REF_TO_NON_DEFAULT_RESOURCE\0"
+    "ERROR_MRM_GENERATION_COUNT_MISMATCH\0"
+    "ERROR_PRI_MERGE_VERSION_MISMATCH\0"
+    "ERROR_PRI_MERGE_MISSING_SCHEMA\0"
+    "ERROR_PRI_MERGE_LOAD_FILE_FAILED\0"
+    "ERROR_PRI_MERGE_ADD_FILE_FAILED\0"
+    "ERROR_PRI_MERGE_WRITE_FILE_FAILED\0"
+    "ERROR_PRI_MERGE_MULTIPLE_PACKAGE_FAMILIES_NOT_ALLOWED\0"
+    "ERROR_PRI_MERGE_MULTIPLE_MAIN_PACKAGES_NOT_ALLOWED\0"
+    "ERROR_PRI_MERGE_BUNDLE_PACKAGES_NOT_ALLOWED\0"
+    "ERROR_PRI_MERGE_MAIN_PACKAGE_REQUIRED\0"
+    "ERROR_PRI_MERGE_RESOURCE_PACKAGE_REQUIRED\0"
+    "ERROR_PRI_MERGE_INVALID_FILE_NAME\0"
+    "ERROR_MRM_PACKAGE_NOT_FOUND\0"
+    "ERROR_MRM_MISSING_DEFAULT_LANGUAGE\0"
+    "ERROR_MCA_INVALID_CAPABILITIES_STRING\0"
+    "ERROR_MCA_INVALID_VCP_VERSION\0"
+    "ERROR_MCA_MONITOR_VIOLATES_MCCS_SPECIFICATION\0"
+    "ERROR_MCA_MCCS_VERSION_MISMATCH\0"
+    "ERROR_MCA_UNSUPPORTED_MCCS_VERSION\0"
+    "ERROR_MCA_INTERNAL_ERROR\0"
+    "ERROR_MCA_INVALID_TECHNOLOGY_TYPE_RETURNED\0"
+    "ERROR_MCA_UNSUPPORTED_COLOR_TEMPERATURE\0"
+    "ERROR_AMBIGUOUS_SYSTEM_DEVICE\0"
+    "ERROR_SYSTEM_DEVICE_NOT_FOUND\0"
+    "ERROR_HASH_NOT_SUPPORTED\0"
+    "ERROR_HASH_NOT_PRESENT\0"
+    "ERROR_SECONDARY_IC_PROVIDER_NOT_REGISTERED\0"
+    "ERROR_GPIO_CLIENT_INFORMATION_INVALID\0"
+    "ERROR_GPIO_VERSION_NOT_SUPPORTED\0"
+    "ERROR_GPIO_INVALID_REGISTRATION_PACKET\0"
+    "ERROR_GPIO_OPERATION_DENIED\0"
+    "ERROR_GPIO_INCOMPATIBLE_CONNECT_MODE\0"
+    "ERROR_GPIO_INTERRUPT_ALREADY_UNMASKED\0"
+    "ERROR_CANNOT_SWITCH_RUNLEVEL\0"
+    "ERROR_INVALID_RUNLEVEL_SETTING\0"
+    "ERROR_RUNLEVEL_SWITCH_TIMEOUT\0"
+    "ERROR_RUNLEVEL_SWITCH_AGENT_TIMEOUT\0"
+    "ERROR_RUNLEVEL_SWITCH_IN_PROGRESS\0"
+    "ERROR_SERVICES_FAILED_AUTOSTART\0"
+    "ERROR_COM_TASK_STOP_PENDING\0"
+    "ERROR_INSTALL_OPEN_PACKAGE_FAILED\0"
+    "ERROR_INSTALL_PACKAGE_NOT_FOUND\0"
+    "ERROR_INSTALL_INVALID_PACKAGE\0"
+    "ERROR_INSTALL_RESOLVE_DEPENDENCY_FAILED\0"
+    "ERROR_INSTALL_OUT_OF_DISK_SPACE\0"
+    "ERROR_INSTALL_NETWORK_FAILURE\0"
+    "ERROR_INSTALL_REGISTRATION_FAILURE\0"
+    "ERROR_INSTALL_DEREGISTRATION_FAILURE\0"
+    "ERROR_INSTALL_CANCEL\0"
+    "ERROR_INSTALL_FAILED\0"
+    "ERROR_REMOVE_FAILED\0"
+    "ERROR_PACKAGE_ALREADY_EXISTS\0"
+    "ERROR_NEEDS_REMEDIATION\0"
+    "ERROR_INSTALL_PREREQUISITE_FAILED\0"
+    "ERROR_PACKAGE_REPOSITORY_CORRUPTED\0"
+    "ERROR_INSTALL_POLICY_FAILURE\0"
+    "ERROR_PACKAGE_UPDATING\0"
+    "ERROR_DEPLOYMENT_BLOCKED_BY_POLICY\0"
+    "ERROR_PACKAGES_IN_USE\0"
+    "ERROR_RECOVERY_FILE_CORRUPT\0"
+    "ERROR_INVALID_STAGED_SIGNATURE\0"
+    "ERROR_DELETING_EXISTING_APPLICATIONDATA_STORE_FAILED\0"
+    "ERROR_INSTALL_PACKAGE_DOWNGRADE\0"
+    "ERROR_SYSTEM_NEEDS_REMEDIATION\0"
+    "ERROR_APPX_INTEGRITY_FAILURE_CLR_NGEN\0"
+    "ERROR_RESILIENCY_FILE_CORRUPT\0"
+    "ERROR_INSTALL_FIREWALL_SERVICE_NOT_RUNNING\0"
+    "ERROR_PACKAGE_MOVE_FAILED\0"
+    "ERROR_INSTALL_VOLUME_NOT_EMPTY\0"
+    "ERROR_INSTALL_VOLUME_OFFLINE\0"
+    "ERROR_INSTALL_VOLUME_CORRUPT\0"
+    "ERROR_NEEDS_REGISTRATION\0"
+    "ERROR_INSTALL_WRONG_PROCESSOR_ARCHITECTURE\0"
+    "ERROR_DEV_SIDELOAD_LIMIT_EXCEEDED\0"
+    "ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE\0"
+    "ERROR_PACKAGE_NOT_SUPPORTED_ON_FILESYSTEM\0"
+    "ERROR_PACKAGE_MOVE_BLOCKED_BY_STREAMING\0"
+    "ERROR_INSTALL_OPTIONAL_PACKAGE_APPLICATIONID_NOT_UNIQUE\0"
+    "ERROR_PACKAGE_STAGING_ONHOLD\0"
+    "ERROR_INSTALL_INVALID_RELATED_SET_UPDATE\0"
+    "ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY\0"
+    "ERROR_DEPLOYMENT_BLOCKED_BY_USER_LOG_OFF\0"
+    "ERROR_PROVISION_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_PROVISIONED\0"
+    "ERROR_PACKAGES_REPUTATION_CHECK_FAILED\0"
+    "ERROR_PACKAGES_REPUTATION_CHECK_TIMEDOUT\0"
+    "ERROR_DEPLOYMENT_OPTION_NOT_SUPPORTED\0"
+    "ERROR_APPINSTALLER_ACTIVATION_BLOCKED\0"
+    "ERROR_REGISTRATION_FROM_REMOTE_DRIVE_NOT_SUPPORTED\0"
+    "ERROR_APPX_RAW_DATA_WRITE_FAILED\0"
+    "ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_PACKAGE\0"
+    "ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_MACHINE\0"
+    "ERROR_DEPLOYMENT_BLOCKED_BY_PROFILE_POLICY\0"
+    "ERROR_DEPLOYMENT_FAILED_CONFLICTING_MUTABLE_PACKAGE_DIRECTORY\0"
+    "ERROR_SINGLETON_RESOURCE_INSTALLED_IN_ACTIVE_USER\0"
+    "ERROR_DIFFERENT_VERSION_OF_PACKAGED_SERVICE_INSTALLED\0"
+    "ERROR_SERVICE_EXISTS_AS_NON_PACKAGED_SERVICE\0"
+    "ERROR_PACKAGED_SERVICE_REQUIRES_ADMIN_PRIVILEGES\0"
+    "ERROR_REDIRECTION_TO_DEFAULT_ACCOUNT_NOT_ALLOWED\0"
+    "ERROR_PACKAGE_LACKS_CAPABILITY_TO_DEPLOY_ON_HOST\0"
+    "ERROR_UNSIGNED_PACKAGE_INVALID_CONTENT\0"
+    "ERROR_UNSIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE\0"
+    "ERROR_SIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE\0"
+    "ERROR_PACKAGE_EXTERNAL_LOCATION_NOT_ALLOWED\0"
+    "ERROR_INSTALL_FULLTRUST_HOSTRUNTIME_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY\0"
+    "ERROR_PACKAGE_LACKS_CAPABILITY_FOR_MANDATORY_STARTUPTASKS\0"
+    "ERROR_INSTALL_RESOLVE_HOSTRUNTIME_DEPENDENCY_FAILED\0"
+    "ERROR_MACHINE_SCOPE_NOT_ALLOWED\0"
+    "ERROR_CLASSIC_COMPAT_MODE_NOT_ALLOWED\0"
+    "ERROR_STAGEFROMUPDATEAGENT_PACKAGE_NOT_APPLICABLE\0"
+    "ERROR_PACKAGE_NOT_REGISTERED_FOR_USER\0"
+    "ERROR_STATE_LOAD_STORE_FAILED\0"
+    "ERROR_STATE_GET_VERSION_FAILED\0"
+    "ERROR_STATE_SET_VERSION_FAILED\0"
+    "ERROR_STATE_STRUCTURED_RESET_FAILED\0"
+    "ERROR_STATE_OPEN_CONTAINER_FAILED\0"
+    "ERROR_STATE_CREATE_CONTAINER_FAILED\0"
+    "ERROR_STATE_DELETE_CONTAINER_FAILED\0"
+    "ERROR_STATE_READ_SETTING_FAILED\0"
+    "ERROR_STATE_WRITE_SETTING_FAILED\0"
+    "ERROR_STATE_DELETE_SETTING_FAILED\0"
+    "ERROR_STATE_QUERY_SETTING_FAILED\0"
+    "ERROR_STATE_READ_COMPOSITE_SETTING_FAILED\0"
+    "ERROR_STATE_WRITE_COMPOSITE_SETTING_FAILED\0"
+    "ERROR_STATE_ENUMERATE_CONTAINER_FAILED\0"
+    "ERROR_STATE_ENUMERATE_SETTINGS_FAILED\0"
+    "ERROR_STATE_COMPOSITE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED\0"
+    "ERROR_STATE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED\0"
+    "ERROR_STATE_SETTING_NAME_SIZE_LIMIT_EXCEEDED\0"
+    "ERROR_STATE_CONTAINER_NAME_SIZE_LIMIT_EXCEEDED\0"
+    "ERROR_API_UNAVAILABLE\0"
+    "ERROR_NDIS_INDICATION_REQUIRED\0"
+    "ERROR_HV_PENDING_PAGE_REQUESTS\0"
+    "ERROR_NDIS_INTERFACE_CLOSING\0"
+    "ERROR_NDIS_BAD_VERSION\0"
+    "ERROR_NDIS_BAD_CHARACTERISTICS\0"
+    "ERROR_NDIS_ADAPTER_NOT_FOUND\0"
+    "ERROR_NDIS_OPEN_FAILED\0"
+    "ERROR_NDIS_DEVICE_FAILED\0"
+    "ERROR_NDIS_MULTICAST_FULL\0"
+    "ERROR_NDIS_MULTICAST_EXISTS\0"
+    "ERROR_NDIS_MULTICAST_NOT_FOUND\0"
+    "ERROR_NDIS_REQUEST_ABORTED\0"
+    "ERROR_NDIS_RESET_IN_PROGRESS\0"
+    "ERROR_NDIS_INVALID_PACKET\0"
+    "ERROR_NDIS_INVALID_DEVICE_REQUEST\0"
+    "ERROR_NDIS_ADAPTER_NOT_READY\0"
+    "ERROR_NDIS_INVALID_LENGTH\0"
+    "ERROR_NDIS_INVALID_DATA\0"
+    "ERROR_NDIS_BUFFER_TOO_SHORT\0"
+    "ERROR_NDIS_INVALID_OID\0"
+    "ERROR_NDIS_ADAPTER_REMOVED\0"
+    "ERROR_NDIS_UNSUPPORTED_MEDIA\0"
+    "ERROR_NDIS_GROUP_ADDRESS_IN_USE\0"
+    "ERROR_NDIS_FILE_NOT_FOUND\0"
+    "ERROR_NDIS_ERROR_READING_FILE\0"
+    "ERROR_NDIS_ALREADY_MAPPED\0"
+    "ERROR_NDIS_RESOURCE_CONFLICT\0"
+    "ERROR_NDIS_MEDIA_DISCONNECTED\0"
+    "ERROR_NDIS_INVALID_ADDRESS\0"
+    "ERROR_NDIS_PAUSED\0"
+    "ERROR_NDIS_INTERFACE_NOT_FOUND\0"
+    "ERROR_NDIS_UNSUPPORTED_REVISION\0"
+    "ERROR_NDIS_INVALID_PORT\0"
+    "ERROR_NDIS_INVALID_PORT_STATE\0"
+    "ERROR_NDIS_LOW_POWER_STATE\0"
+    "ERROR_NDIS_REINIT_REQUIRED\0"
+    "ERROR_NDIS_NO_QUEUES\0"
+    "ERROR_NDIS_NOT_SUPPORTED\0"
+    "ERROR_NDIS_DOT11_AUTO_CONFIG_ENABLED\0"
+    "ERROR_NDIS_DOT11_MEDIA_IN_USE\0"
+    "ERROR_NDIS_DOT11_POWER_STATE_INVALID\0"
+    "ERROR_NDIS_PM_WOL_PATTERN_LIST_FULL\0"
+    "ERROR_NDIS_PM_PROTOCOL_OFFLOAD_LIST_FULL\0"
+    "ERROR_NDIS_DOT11_AP_CHANNEL_CURRENTLY_NOT_AVAILABLE\0"
+    "ERROR_NDIS_DOT11_AP_BAND_CURRENTLY_NOT_AVAILABLE\0"
+    "ERROR_NDIS_DOT11_AP_CHANNEL_NOT_ALLOWED\0"
+    "ERROR_NDIS_DOT11_AP_BAND_NOT_ALLOWED\0"
+    "ERROR_VID_REMOTE_NODE_PARENT_GPA_PAGES_USED\0"
+    "ERROR_VOLMGR_INCOMPLETE_REGENERATION\0"
+    "ERROR_VOLMGR_INCOMPLETE_DISK_MIGRATION\0"
+    "ERROR_BCD_NOT_ALL_ENTRIES_IMPORTED\0"
+    "ERROR_BCD_NOT_ALL_ENTRIES_SYNCHRONIZED\0"
+    "ERROR_QUERY_STORAGE_ERROR\0"
+    "ERROR_NDIS_OFFLOAD_POLICY\0"
+    "ERROR_NDIS_OFFLOAD_CONNECTION_REJECTED\0"
+    "ERROR_NDIS_OFFLOAD_PATH_REJECTED\0"
+    "ERROR_HV_INVALID_HYPERCALL_CODE\0"
+    "ERROR_HV_INVALID_HYPERCALL_INPUT\0"
+    "ERROR_HV_INVALID_ALIGNMENT\0"
+    "ERROR_HV_INVALID_PARAMETER\0"
+    "ERROR_HV_ACCESS_DENIED\0"
+    "ERROR_HV_INVALID_PARTITION_STATE\0"
+    "ERROR_HV_OPERATION_DENIED\0"
+    "ERROR_HV_UNKNOWN_PROPERTY\0"
+    "ERROR_HV_PROPERTY_VALUE_OUT_OF_RANGE\0"
+    "ERROR_HV_INSUFFICIENT_MEMORY\0"
+    "ERROR_HV_PARTITION_TOO_DEEP\0"
+    "ERROR_HV_INVALID_PARTITION_ID\0"
+    "ERROR_HV_INVALID_VP_INDEX\0"
+    "ERROR_HV_INVALID_PORT_ID\0"
+    "ERROR_HV_INVALID_CONNECTION_ID\0"
+    "ERROR_HV_INSUFFICIENT_BUFFERS\0"
+    "ERROR_HV_NOT_ACKNOWLEDGED\0"
+    "ERROR_HV_INVALID_VP_STATE\0"
+    "ERROR_HV_ACKNOWLEDGED\0"
+    "ERROR_HV_INVALID_SAVE_RESTORE_STATE\0"
+    "ERROR_HV_INVALID_SYNIC_STATE\0"
+    "ERROR_HV_OBJECT_IN_USE\0"
+    "ERROR_HV_INVALID_PROXIMITY_DOMAIN_INFO\0"
+    "ERROR_HV_NO_DATA\0"
+    "ERROR_HV_INACTIVE\0"
+    "ERROR_HV_NO_RESOURCES\0"
+    "ERROR_HV_FEATURE_UNAVAILABLE\0"
+    "ERROR_HV_INSUFFICIENT_BUFFER\0"
+    "ERROR_HV_INSUFFICIENT_DEVICE_DOMAINS\0"
+    "ERROR_HV_CPUID_FEATURE_VALIDATION\0"
+    "ERROR_HV_CPUID_XSAVE_FEATURE_VALIDATION\0"
+    "ERROR_HV_PROCESSOR_STARTUP_TIMEOUT\0"
+    "ERROR_HV_SMX_ENABLED\0"
+    "ERROR_HV_INVALID_LP_INDEX\0"
+    "ERROR_HV_INVALID_REGISTER_VALUE\0"
+    "ERROR_HV_INVALID_VTL_STATE\0"
+    "ERROR_HV_NX_NOT_DETECTED\0"
+    "ERROR_HV_INVALID_DEVICE_ID\0"
+    "ERROR_HV_INVALID_DEVICE_STATE\0"
+    "ERROR_HV_PAGE_REQUEST_INVALID\0"
+    "ERROR_HV_INVALID_CPU_GROUP_ID\0"
+    "ERROR_HV_INVALID_CPU_GROUP_STATE\0"
+    "ERROR_HV_OPERATION_FAILED\0"
+    "ERROR_HV_NOT_ALLOWED_WITH_NESTED_VIRT_ACTIVE\0"
+    "ERROR_HV_INSUFFICIENT_ROOT_MEMORY\0"
+    "ERROR_HV_EVENT_BUFFER_ALREADY_FREED\0"
+    "ERROR_HV_INSUFFICIENT_CONTIGUOUS_MEMORY\0"
+    "ERROR_HV_DEVICE_NOT_IN_DOMAIN\0"
+    "ERROR_HV_NESTED_VM_EXIT\0"
+    "ERROR_HV_MSR_ACCESS_FAILED\0"
+    "ERROR_HV_NOT_PRESENT\0"
+    "ERROR_VID_DUPLICATE_HANDLER\0"
+    "ERROR_VID_TOO_MANY_HANDLERS\0"
+    "ERROR_VID_QUEUE_FULL\0"
+    "ERROR_VID_HANDLER_NOT_PRESENT\0"
+    "ERROR_VID_INVALID_OBJECT_NAME\0"
+    "ERROR_VID_PARTITION_NAME_TOO_LONG\0"
+    "ERROR_VID_MESSAGE_QUEUE_NAME_TOO_LONG\0"
+    "ERROR_VID_PARTITION_ALREADY_EXISTS\0"
+    "ERROR_VID_PARTITION_DOES_NOT_EXIST\0"
+    "ERROR_VID_PARTITION_NAME_NOT_FOUND\0"
+    "ERROR_VID_MESSAGE_QUEUE_ALREADY_EXISTS\0"
+    "ERROR_VID_EXCEEDED_MBP_ENTRY_MAP_LIMIT\0"
+    "ERROR_VID_MB_STILL_REFERENCED\0"
+    "ERROR_VID_CHILD_GPA_PAGE_SET_CORRUPTED\0"
+    "ERROR_VID_INVALID_NUMA_SETTINGS\0"
+    "ERROR_VID_INVALID_NUMA_NODE_INDEX\0"
+    "ERROR_VID_NOTIFICATION_QUEUE_ALREADY_ASSOCIATED\0"
+    "ERROR_VID_INVALID_MEMORY_BLOCK_HANDLE\0"
+    "ERROR_VID_PAGE_RANGE_OVERFLOW\0"
+    "ERROR_VID_INVALID_MESSAGE_QUEUE_HANDLE\0"
+    "ERROR_VID_INVALID_GPA_RANGE_HANDLE\0"
+    "ERROR_VID_NO_MEMORY_BLOCK_NOTIFICATION_QUEUE\0"
+    "ERROR_VID_MEMORY_BLOCK_LOCK_COUNT_EXCEEDED\0"
+    "ERROR_VID_INVALID_PPM_HANDLE\0"
+    "ERROR_VID_MBPS_ARE_LOCKED\0"
+    "ERROR_VID_MESSAGE_QUEUE_CLOSED\0"
+    "ERROR_VID_VIRTUAL_PROCESSOR_LIMIT_EXCEEDED\0"
+    "ERROR_VID_STOP_PENDING\0"
+    "ERROR_VID_INVALID_PROCESSOR_STATE\0"
+    "ERROR_VID_EXCEEDED_KM_CONTEXT_COUNT_LIMIT\0"
+    "ERROR_VID_KM_INTERFACE_ALREADY_INITIALIZED\0"
+    "ERROR_VID_MB_PROPERTY_ALREADY_SET_RESET\0"
+    "ERROR_VID_MMIO_RANGE_DESTROYED\0"
+    "ERROR_VID_INVALID_CHILD_GPA_PAGE_SET\0"
+    "ERROR_VID_RESERVE_PAGE_SET_IS_BEING_USED\0"
+    "ERROR_VID_RESERVE_PAGE_SET_TOO_SMALL\0"
+    "ERROR_VID_MBP_ALREADY_LOCKED_USING_RESERVED_PAGE\0"
+    "ERROR_VID_MBP_COUNT_EXCEEDED_LIMIT\0"
+    "ERROR_VID_SAVED_STATE_CORRUPT\0"
+    "ERROR_VID_SAVED_STATE_UNRECOGNIZED_ITEM\0"
+    "ERROR_VID_SAVED_STATE_INCOMPATIBLE\0"
+    "ERROR_VID_VTL_ACCESS_DENIED\0"
+    "ERROR_VMCOMPUTE_TERMINATED_DURING_START\0"
+    "ERROR_VMCOMPUTE_IMAGE_MISMATCH\0"
+    "ERROR_VMCOMPUTE_HYPERV_NOT_INSTALLED\0"
+    "ERROR_VMCOMPUTE_OPERATION_PENDING\0"
+    "ERROR_VMCOMPUTE_TOO_MANY_NOTIFICATIONS\0"
+    "ERROR_VMCOMPUTE_INVALID_STATE\0"
+    "ERROR_VMCOMPUTE_UNEXPECTED_EXIT\0"
+    "ERROR_VMCOMPUTE_TERMINATED\0"
+    "ERROR_VMCOMPUTE_CONNECT_FAILED\0"
+    "ERROR_VMCOMPUTE_TIMEOUT\0"
+    "ERROR_VMCOMPUTE_CONNECTION_CLOSED\0"
+    "ERROR_VMCOMPUTE_UNKNOWN_MESSAGE\0"
+    "ERROR_VMCOMPUTE_UNSUPPORTED_PROTOCOL_VERSION\0"
+    "ERROR_VMCOMPUTE_INVALID_JSON\0"
+    "ERROR_VMCOMPUTE_SYSTEM_NOT_FOUND\0"
+    "ERROR_VMCOMPUTE_SYSTEM_ALREADY_EXISTS\0"
+    "ERROR_VMCOMPUTE_SYSTEM_ALREADY_STOPPED\0"
+    "ERROR_VMCOMPUTE_PROTOCOL_ERROR\0"
+    "ERROR_VMCOMPUTE_INVALID_LAYER\0"
+    "ERROR_VMCOMPUTE_WINDOWS_INSIDER_REQUIRED\0"
+    "ERROR_VNET_VIRTUAL_SWITCH_NAME_NOT_FOUND\0"
+    "ERROR_VSMB_SAVED_STATE_FILE_NOT_FOUND\0"
+    "ERROR_VSMB_SAVED_STATE_CORRUPT\0"
+    "ERROR_VOLMGR_DATABASE_FULL\0"
+    "ERROR_VOLMGR_DISK_CONFIGURATION_CORRUPTED\0"
+    "ERROR_VOLMGR_DISK_CONFIGURATION_NOT_IN_SYNC\0"
+    "ERROR_VOLMGR_PACK_CONFIG_UPDATE_FAILED\0"
+    "ERROR_VOLMGR_DISK_CONTAINS_NON_SIMPLE_VOLUME\0"
+    "ERROR_VOLMGR_DISK_DUPLICATE\0"
+    "ERROR_VOLMGR_DISK_DYNAMIC\0"
+    "ERROR_VOLMGR_DISK_ID_INVALID\0"
+    "ERROR_VOLMGR_DISK_INVALID\0"
+    "ERROR_VOLMGR_DISK_LAST_VOTER\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_INVALID\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_NON_BASIC_BETWEEN_BASIC_PARTITIONS\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_NOT_CYLINDER_ALIGNED\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_PARTITIONS_TOO_SMALL\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_PRIMARY_BETWEEN_LOGICAL_PARTITIONS\0"
+    "ERROR_VOLMGR_DISK_LAYOUT_TOO_MANY_PARTITIONS\0"
+    "ERROR_VOLMGR_DISK_MISSING\0"
+    "ERROR_VOLMGR_DISK_NOT_EMPTY\0"
+    "ERROR_VOLMGR_DISK_NOT_ENOUGH_SPACE\0"
+    "ERROR_VOLMGR_DISK_REVECTORING_FAILED\0"
+    "ERROR_VOLMGR_DISK_SECTOR_SIZE_INVALID\0"
+    "ERROR_VOLMGR_DISK_SET_NOT_CONTAINED\0"
+    "ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_MEMBERS\0"
+    "ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_PLEXES\0"
+    "ERROR_VOLMGR_DYNAMIC_DISK_NOT_SUPPORTED\0"
+    "ERROR_VOLMGR_EXTENT_ALREADY_USED\0"
+    "ERROR_VOLMGR_EXTENT_NOT_CONTIGUOUS\0"
+    "ERROR_VOLMGR_EXTENT_NOT_IN_PUBLIC_REGION\0"
+    "ERROR_VOLMGR_EXTENT_NOT_SECTOR_ALIGNED\0"
+    "ERROR_VOLMGR_EXTENT_OVERLAPS_EBR_PARTITION\0"
+    "ERROR_VOLMGR_EXTENT_VOLUME_LENGTHS_DO_NOT_MATCH\0"
+    "ERROR_VOLMGR_FAULT_TOLERANT_NOT_SUPPORTED\0"
+    "ERROR_VOLMGR_INTERLEAVE_LENGTH_INVALID\0"
+    "ERROR_VOLMGR_MAXIMUM_REGISTERED_USERS\0"
+    "ERROR_VOLMGR_MEMBER_IN_SYNC\0"
+    "ERROR_VOLMGR_MEMBER_INDEX_DUPLICATE\0"
+    "ERROR_VOLMGR_MEMBER_INDEX_INVALID\0"
+    "ERROR_VOLMGR_MEMBER_MISSING\0"
+    "ERROR_VOLMGR_MEMBER_NOT_DETACHED\0"
+    "ERROR_VOLMGR_MEMBER_REGENERATING\0"
+    "ERROR_VOLMGR_ALL_DISKS_FAILED\0"
+    "ERROR_VOLMGR_NO_REGISTERED_USERS\0"
+    "ERROR_VOLMGR_NO_SUCH_USER\0"
+    "ERROR_VOLMGR_NOTIFICATION_RESET\0"
+    "ERROR_VOLMGR_NUMBER_OF_MEMBERS_INVALID\0"
+    "ERROR_VOLMGR_NUMBER_OF_PLEXES_INVALID\0"
+    "ERROR_VOLMGR_PACK_DUPLICATE\0"
+    "ERROR_VOLMGR_PACK_ID_INVALID\0"
+    "ERROR_VOLMGR_PACK_INVALID\0"
+    "ERROR_VOLMGR_PACK_NAME_INVALID\0"
+    "ERROR_VOLMGR_PACK_OFFLINE\0"
+    "ERROR_VOLMGR_PACK_HAS_QUORUM\0"
+    "ERROR_VOLMGR_PACK_WITHOUT_QUORUM\0"
+    "ERROR_VOLMGR_PARTITION_STYLE_INVALID\0"
+    "ERROR_VOLMGR_PARTITION_UPDATE_FAILED\0"
+    "ERROR_VOLMGR_PLEX_IN_SYNC\0"
+    "ERROR_VOLMGR_PLEX_INDEX_DUPLICATE\0"
+    "ERROR_VOLMGR_PLEX_INDEX_INVALID\0"
+    "ERROR_VOLMGR_PLEX_LAST_ACTIVE\0"
+    "ERROR_VOLMGR_PLEX_MISSING\0"
+    "ERROR_VOLMGR_PLEX_REGENERATING\0"
+    "ERROR_VOLMGR_PLEX_TYPE_INVALID\0"
+    "ERROR_VOLMGR_PLEX_NOT_RAID5\0"
+    "ERROR_VOLMGR_PLEX_NOT_SIMPLE\0"
+    "ERROR_VOLMGR_STRUCTURE_SIZE_INVALID\0"
+    "ERROR_VOLMGR_TOO_MANY_NOTIFICATION_REQUESTS\0"
+    "ERROR_VOLMGR_TRANSACTION_IN_PROGRESS\0"
+    "ERROR_VOLMGR_UNEXPECTED_DISK_LAYOUT_CHANGE\0"
+    "ERROR_VOLMGR_VOLUME_CONTAINS_MISSING_DISK\0"
+    "ERROR_VOLMGR_VOLUME_ID_INVALID\0"
+    "ERROR_VOLMGR_VOLUME_LENGTH_INVALID\0"
+    "ERROR_VOLMGR_VOLUME_LENGTH_NOT_SECTOR_SIZE_MULTIPLE\0"
+    "ERROR_VOLMGR_VOLUME_NOT_MIRRORED\0"
+    "ERROR_VOLMGR_VOLUME_NOT_RETAINED\0"
+    "ERROR_VOLMGR_VOLUME_OFFLINE\0"
+    "ERROR_VOLMGR_VOLUME_RETAINED\0"
+    "ERROR_VOLMGR_NUMBER_OF_EXTENTS_INVALID\0"
+    "ERROR_VOLMGR_DIFFERENT_SECTOR_SIZE\0"
+    "ERROR_VOLMGR_BAD_BOOT_DISK\0"
+    "ERROR_VOLMGR_PACK_CONFIG_OFFLINE\0"
+    "ERROR_VOLMGR_PACK_CONFIG_ONLINE\0"
+    "ERROR_VOLMGR_NOT_PRIMARY_PACK\0"
+    "ERROR_VOLMGR_PACK_LOG_UPDATE_FAILED\0"
+    "ERROR_VOLMGR_NUMBER_OF_DISKS_IN_PLEX_INVALID\0"
+    "ERROR_VOLMGR_NUMBER_OF_DISKS_IN_MEMBER_INVALID\0"
+    "ERROR_VOLMGR_VOLUME_MIRRORED\0"
+    "ERROR_VOLMGR_PLEX_NOT_SIMPLE_SPANNED\0"
+    "ERROR_VOLMGR_NO_VALID_LOG_COPIES\0"
+    "ERROR_VOLMGR_PRIMARY_PACK_PRESENT\0"
+    "ERROR_VOLMGR_NUMBER_OF_DISKS_INVALID\0"
+    "ERROR_VOLMGR_MIRROR_NOT_SUPPORTED\0"
+    "ERROR_VOLMGR_RAID5_NOT_SUPPORTED\0"
+    "ERROR_BCD_TOO_MANY_ELEMENTS\0"
+    "ERROR_VHD_DRIVE_FOOTER_MISSING\0"
+    "ERROR_VHD_DRIVE_FOOTER_CHECKSUM_MISMATCH\0"
+    "ERROR_VHD_DRIVE_FOOTER_CORRUPT\0"
+    "ERROR_VHD_FORMAT_UNKNOWN\0"
+    "ERROR_VHD_FORMAT_UNSUPPORTED_VERSION\0"
+    "ERROR_VHD_SPARSE_HEADER_CHECKSUM_MISMATCH\0"
+    "ERROR_VHD_SPARSE_HEADER_UNSUPPORTED_VERSION\0"
+    "ERROR_VHD_SPARSE_HEADER_CORRUPT\0"
+    "ERROR_VHD_BLOCK_ALLOCATION_FAILURE\0"
+    "ERROR_VHD_BLOCK_ALLOCATION_TABLE_CORRUPT\0"
+    "ERROR_VHD_INVALID_BLOCK_SIZE\0"
+    "ERROR_VHD_BITMAP_MISMATCH\0"
+    "ERROR_VHD_PARENT_VHD_NOT_FOUND\0"
+    "ERROR_VHD_CHILD_PARENT_ID_MISMATCH\0"
+    "ERROR_VHD_CHILD_PARENT_TIMESTAMP_MISMATCH\0"
+    "ERROR_VHD_METADATA_READ_FAILURE\0"
+    "ERROR_VHD_METADATA_WRITE_FAILURE\0"
+    "ERROR_VHD_INVALID_SIZE\0"
+    "ERROR_VHD_INVALID_FILE_SIZE\0"
+    "ERROR_VIRTDISK_PROVIDER_NOT_FOUND\0"
+    "ERROR_VIRTDISK_NOT_VIRTUAL_DISK\0"
+    "ERROR_VHD_PARENT_VHD_ACCESS_DENIED\0"
+    "ERROR_VHD_CHILD_PARENT_SIZE_MISMATCH\0"
+    "ERROR_VHD_DIFFERENCING_CHAIN_CYCLE_DETECTED\0"
+    "ERROR_VHD_DIFFERENCING_CHAIN_ERROR_IN_PARENT\0"
+    "ERROR_VIRTUAL_DISK_LIMITATION\0"
+    "ERROR_VHD_INVALID_TYPE\0"
+    "ERROR_VHD_INVALID_STATE\0"
+    "ERROR_VIRTDISK_UNSUPPORTED_DISK_SECTOR_SIZE\0"
+    "ERROR_VIRTDISK_DISK_ALREADY_OWNED\0"
+    "ERROR_VIRTDISK_DISK_ONLINE_AND_WRITABLE\0"
+    "ERROR_CTLOG_TRACKING_NOT_INITIALIZED\0"
+    "ERROR_CTLOG_LOGFILE_SIZE_EXCEEDED_MAXSIZE\0"
+    "ERROR_CTLOG_VHD_CHANGED_OFFLINE\0"
+    "ERROR_CTLOG_INVALID_TRACKING_STATE\0"
+    "ERROR_CTLOG_INCONSISTENT_TRACKING_FILE\0"
+    "ERROR_VHD_RESIZE_WOULD_TRUNCATE_DATA\0"
+    "ERROR_VHD_COULD_NOT_COMPUTE_MINIMUM_VIRTUAL_SIZE\0"
+    "ERROR_VHD_ALREADY_AT_OR_BELOW_MINIMUM_VIRTUAL_SIZE\0"
+    "ERROR_VHD_METADATA_FULL\0"
+    "ERROR_VHD_INVALID_CHANGE_TRACKING_ID\0"
+    "ERROR_VHD_CHANGE_TRACKING_DISABLED\0"
+    "ERROR_VHD_MISSING_CHANGE_TRACKING_INFORMATION\0"
+    "WAIT_FAILED\0"
+    ;
+
+static const unsigned short gWinErrorNameOrder[] = {
+    2292, 2342, 2303, 2344, 2287, 2258, 2268, 2283, 2387, 2386,
+    2385, 2331, 2329, 2322, 2316, 2319, 2321, 2377, 2367, 2370,
+    2290, 2341, 2236, 2261, 2353, 2351, 2349, 2350, 2355, 2354,
+    2352, 2337, 2338, 2286, 2285, 2320, 2312, 2272, 2284, 2366,
+    2394, 2318, 2251, 2274, 2242, 2279, 2260, 2291, 2275, 2250,
+    2375, 2378, 2259, 2273, 2262, 2371, 2296, 2304, 2237, 2244,
+    2248, 2373, 2222, 2336, 2328, 2310, 2307, 2309, 2325, 2330,
+    2340, 2278, 2255, 2288, 2281, 2238, 2257, 2254, 2282, 2289,
+    2372, 2240, 2277, 2339, 2335, 2348, 2269, 2347, 2263, 2295,
+    2239, 2265, 2266, 2280, 2343, 2267, 2381, 2382, 2383, 2400,
+    2404, 2403, 2402, 2405, 2406, 2401, 2392, 2384, 2391, 2390,
+    2393, 2395, 2396, 2397, 2317, 2270, 2234, 2233, 2235, 2223,
+    2225, 2231, 2232, 2226, 2230, 2227, 2224, 2228, 2229, 2333,
+    2323, 2324, 2332, 2327, 2256, 2252, 2264, 2358, 2359, 2361,
+    2360, 2357, 2362, 2356, 2380, 2376, 2379, 2334, 2305, 2345,
+    2398, 2346, 2243, 2311, 2253, 2389, 2388, 2249, 2276, 2246,
+    2245, 2326, 2247, 2271, 2241, 2363, 2364, 2365, 2308, 2368,
+    2369, 2374, 2399, 2302, 2293, 2297, 2301, 2294, 2299, 2298,
+    2314, 2300, 2315, 2306, 2313, 580, 581, 632, 394, 630,
+    5, 383, 858, 631, 870, 871, 924, 1141, 1172, 920,
+    514, 1797, 1211, 45, 825, 826, 2657, 584, 971, 457,
+    936, 1434, 1179, 65, 139, 873, 1372, 845, 840, 716,
+    874, 1167, 564, 2772, 2879, 1293, 1245, 1246, 1248, 1249,
+    1247, 1237, 1238, 1243, 1239, 1241, 1242, 1240, 1244, 857,
+    2836, 307, 2814, 2838, 1349, 1348, 1350, 1347, 1351, 891,
+    430, 764, 568, 7, 390, 513, 136, 461, 1181, 1061,
+    153, 441, 679, 680, 623, 618, 128, 1751, 22, 460,
+    1082, 548, 953, 798, 228, 54, 464, 1187, 87, 10,
+    147, 172, 11, 415, 938, 932, 24, 957, 636, 41,
+    55, 46, 129, 178, 804, 802, 1087, 1609, 48, 465,
+    399, 127, 941, 20, 1208, 851, 940, 2930, 2931, 3144,
+    729, 882, 440, 244, 245, 718, 79, 599, 81, 133,
+    110, 738, 387, 597, 657, 613, 866, 88, 821, 135,
+    1750, 1749, 647, 189, 722, 723, 1740, 999, 646, 960,
+    444, 62, 803, 2783, 615, 681, 682, 616, 683, 943,
+    1174, 1726, 330, 1715, 1727, 1331, 903, 484, 1406, 939,
+    1714, 1720, 1175, 411, 410, 673, 1270, 349, 353, 351,
+    348, 350, 352, 357, 354, 355, 358, 356, 569, 322,
+    340, 662, 557, 171, 691, 97, 265, 1028, 359, 360,
+    701, 2857, 1002, 1003, 1004, 1336, 1329, 1328, 1327, 452,
+    1010, 1191, 293, 276, 284, 280, 332, 294, 285, 278,
+    289, 261, 262, 286, 275, 277, 288, 290, 264, 263,
+    292, 295, 273, 260, 302, 279, 291, 296, 324, 256,
+    272, 287, 281, 1498, 1499, 1500, 1429, 1426, 1428, 1430,
+    1427, 1596, 1568, 1546, 1565, 1497, 1520, 1586, 1576, 1587,
+    1479, 1515, 1516, 1583, 1560, 1536, 1493, 1593, 1592, 1591,
+    1594, 1541, 1505, 1556, 1538, 1481, 1471, 1490, 1509, 1595,
+    1523, 1524, 1451, 1446, 1436, 1551, 1445, 1543, 1514, 1513,
+    1453, 1470, 1438, 1450, 1462, 1440, 1472, 1531, 1489, 1487,
+    1502, 1443, 1444, 1460, 1459, 1441, 1463, 1442, 1491, 1456,
+    1458, 1484, 1461, 1457, 1447, 1559, 1437, 1575, 1581, 1439,
+    1449, 1454, 1468, 1466, 1582, 1469, 1448, 1452, 1529, 1542,
+    1503, 1522, 1477, 1455, 1517, 1533, 1622, 1501, 1478, 1494,
+    1510, 1518, 1511, 1519, 1504, 1492, 1488, 1512, 1476, 1530,
+    1540, 1566, 1579, 1567, 1580, 1569, 1557, 1578, 1539, 1506,
+    1474, 1552, 1550, 1554, 1555, 1475, 1528, 1544, 1558, 1564,
+    1563, 1419, 1537, 1584, 1473, 1585, 1532, 1571, 1570, 1574,
+    1573, 1572, 1545, 1549, 1496, 1203, 1047, 490, 233, 614,
+    1752, 242, 2789, 1206, 1207, 834, 828, 836, 827, 823,
+    799, 1068, 889, 1177, 844, 1325, 427, 1013, 455, 1229,
+    1423, 643, 640, 642, 639, 641, 489, 408, 1652, 748,
+    658, 598, 23, 1103, 1682, 1684, 1131, 860, 1548, 1616,
+    1618, 1614, 1617, 1615, 3180, 3179, 3177, 3176, 3178, 1802,
+    1778, 1762, 1804, 1805, 1790, 1791, 1782, 1764, 1784, 1783,
+    1799, 1779, 1767, 1759, 1787, 1793, 1794, 1792, 1780, 1766,
+    1772, 1768, 1770, 1771, 1769, 1773, 1781, 1801, 1765, 1760,
+    1806, 1763, 1800, 1785, 1789, 1796, 1788, 1795, 1774, 1761,
+    1798, 1786, 1776, 1777, 1758, 1775, 16, 991, 1686, 1483,
+    707, 1309, 1310, 1101, 222, 1745, 447, 259, 542, 612,
+    541, 538, 611, 533, 539, 534, 540, 537, 536, 535,
+    1017, 769, 877, 445, 1598, 878, 202, 2811, 1201, 1400,
+    1465, 1399, 1526, 1398, 1521, 693, 2807, 2841, 2831, 2840,
+    2839, 2842, 2835, 774, 1027, 404, 800, 779, 502, 215,
+    367, 253, 257, 1212, 1315, 780, 734, 221, 777, 1089,
+    778, 388, 134, 220, 43, 2823, 1276, 2747, 721, 2844,
+    1267, 1258, 1259, 1261, 1263, 1262, 1266, 1265, 1264, 1260,
+    190, 1707, 234, 98, 1607, 113, 112, 125, 77, 985,
+    82, 1561, 754, 888, 753, 625, 637, 638, 755, 213,
+    201, 741, 479, 532, 531, 770, 344, 347, 343, 848,
+    1171, 436, 948, 949, 2214, 1157, 863, 321, 574, 868,
+    449, 506, 508, 488, 884, 78, 1299, 1873, 1836, 1857,
+    2148, 1904, 1852, 1906, 1849, 1814, 1916, 1813, 1889, 1881,
+    1888, 1874, 1969, 1986, 1893, 2195, 2169, 1839, 1842, 1959,
+    2052, 1970, 1995, 1884, 1905, 1962, 1996, 1815, 2155, 1890,
+    1928, 2120, 1971, 1972, 2123, 2080, 1968, 1910, 1945, 2174,
+    1907, 2173, 2159, 2107, 1989, 1990, 1991, 1901, 1824, 2076,
+    1939, 2068, 2178, 2179, 2059, 2069, 1822, 1823, 1973, 1974,
+    1894, 1895, 1994, 2051, 1992, 1975, 1977, 2096, 2101, 2130,
+    2063, 1902, 1929, 1913, 1867, 1978, 1837, 1838, 1845, 1997,
+    1847, 2045, 1866, 1937, 2073, 2072, 2095, 1998, 2061, 1825,
+    1938, 2172, 1944, 2065, 2156, 1979, 1861, 2106, 2105, 2163,
+    2185, 2210, 2094, 2204, 2182, 2134, 2136, 2032, 2023, 2009,
+    2015, 2010, 2008, 2014, 2199, 2021, 2011, 2114, 2036, 2006,
+    2034, 2013, 2012, 2007, 2017, 2203, 2030, 2028, 2024, 2022,
+    2020, 2115, 2016, 2187, 2031, 2209, 2018, 2019, 2047, 2025,
+    2113, 2112, 1988, 2200, 2033, 2027, 2026, 2035, 2029, 2164,
+    1912, 2066, 2056, 2048, 2175, 1952, 2038, 1950, 2167, 1949,
+    1948, 1951, 1860, 2053, 2183, 1963, 1956, 1955, 1965, 2168,
+    1964, 1862, 2125, 2205, 2133, 2135, 1987, 1826, 2117, 1911,
+    2089, 2086, 2087, 1980, 2177, 2091, 1999, 2198, 2211, 2212,
+    2077, 1882, 1915, 2062, 1841, 1846, 2144, 2137, 1819, 2102,
+    2131, 2082, 2081, 2037, 2176, 1914, 2000, 1812, 1930, 1850,
+    2083, 2049, 2124, 1936, 2170, 2070, 2196, 2197, 1851, 2097,
+    2186, 2147, 2090, 1859, 2118, 1854, 2213, 2138, 2142, 2127,
+    2202, 1885, 1875, 1810, 1981, 2219, 2004, 2067, 1887, 1976,
+    2151, 2149, 2152, 2128, 2043, 2040, 2041, 2042, 2044, 2039,
+    2153, 2141, 1943, 1918, 1917, 1921, 1920, 1919, 2093, 1855,
+    1982, 1927, 2064, 2116, 1957, 1958, 1960, 2078, 2194, 2050,
+    1947, 1922, 2057, 2158, 1809, 1932, 1864, 2140, 1811, 2139,
+    1898, 1897, 2121, 1933, 1925, 2119, 1818, 2166, 2084, 2085,
+    2193, 2150, 1899, 2103, 1877, 2145, 1879, 1865, 1817, 2192,
+    1848, 2071, 2162, 2161, 1909, 1886, 1856, 1941, 1942, 1821,
+    1931, 1903, 1876, 1883, 1870, 2207, 2208, 1832, 1908, 2143,
+    1863, 1900, 2060, 2188, 1833, 1892, 1878, 1966, 1843, 1868,
+    2003, 2171, 1940, 2165, 2184, 2146, 2201, 1871, 1820, 2180,
+    1896, 1872, 2002, 2074, 2132, 2100, 2099, 1985, 1984, 2079,
+    1983, 1993, 1924, 1923, 1953, 2075, 1858, 1934, 2160, 1891,
+    1835, 1869, 2122, 2104, 2217, 2055, 2110, 2129, 2058, 2054,
+    2108, 2109, 2092, 1840, 1926, 1946, 1961, 1954, 2157, 1834,
+    1967, 2005, 1816, 1844, 2215, 2126, 2088, 2001, 1935, 1853,
+    2218, 1880, 2220, 498, 2181, 2098, 2046, 210, 720, 1196,
+    819, 40, 1127, 150, 191, 195, 665, 192, 186, 193,
+    2710, 2711, 2712, 2709, 2713, 2708, 255, 254, 1610, 1612,
+    1733, 1608, 1613, 585, 1302, 247, 659, 660, 370, 653,
+    329, 328, 1597, 1619, 727, 1689, 1722, 157, 756, 619,
+    477, 1065, 1067, 1064, 555, 556, 2705, 2694, 2676, 2679,
+    2701, 2673, 2683, 2685, 2686, 2687, 2684, 2707, 2688, 2695,
+    2690, 2689, 2670, 2692, 2675, 2691, 2674, 2693, 2671, 2677,
+    2700, 2697, 2702, 2696, 2682, 2706, 2672, 2681, 2680, 2678,
+    2699, 2698, 2704, 2703, 1527, 706, 71, 168, 169, 167,
+    146, 1756, 806, 241, 297, 522, 501, 705, 1125, 63,
+    248, 1231, 1230, 250, 249, 558, 728, 159, 170, 984,
+    1599, 61, 651, 1725, 676, 224, 654, 1604, 2, 323,
+    1338, 304, 1606, 1535, 338, 333, 336, 335, 337, 334,
+    512, 269, 283, 268, 270, 267, 173, 573, 1748, 485,
+    486, 752, 749, 751, 439, 750, 174, 456, 607, 443,
+    237, 313, 663, 549, 236, 550, 677, 1273, 1099, 1098,
+    271, 2667, 952, 31, 1021, 2777, 2781, 2782, 2779, 2780,
+    2778, 824, 1590, 1588, 1589, 911, 1409, 1410, 1411, 525,
+    521, 37, 36, 1717, 656, 2775, 2774, 369, 1703, 571,
+    510, 1020, 1023, 1050, 854, 1402, 1413, 1412, 830, 1001,
+    1011, 2940, 2954, 2965, 2966, 2983, 2981, 2962, 2960, 2963,
+    2951, 2982, 2964, 2945, 2980, 2938, 2950, 2976, 2977, 2973,
+    2974, 2936, 2937, 2969, 2939, 2947, 2941, 2949, 2958, 2970,
+    2955, 2956, 2948, 2953, 2971, 2985, 2984, 2952, 2979, 2986,
+    2959, 2961, 2972, 2957, 2942, 2978, 2975, 2946, 2881, 2967,
+    2944, 2968, 2943, 1033, 1200, 1337, 437, 478, 775, 434,
+    917, 652, 551, 565, 545, 207, 885, 1697, 890, 883,
+    203, 2216, 839, 1054, 1272, 1083, 363, 1334, 1729, 156,
+    1090, 2798, 2797, 2799, 1075, 2816, 2853, 2792, 2829, 1095,
+    1094, 2795, 1106, 2790, 2827, 2824, 2830, 2794, 2812, 1092,
+    2791, 1091, 1097, 1085, 1105, 2805, 2803, 2796, 1126, 1112,
+    1117, 2793, 2855, 1073, 1124, 1084, 1076, 1104, 1096, 1116,
+    1093, 1074, 2820, 2818, 2819, 2822, 405, 90, 463, 494,
+    626, 362, 223, 950, 975, 951, 609, 608, 995, 12,
+    908, 650, 929, 368, 74, 9, 733, 219, 85, 1306,
+    1508, 1192, 1204, 1199, 1014, 1111, 808, 881, 994, 13,
+    1152, 504, 767, 810, 946, 945, 15, 1317, 997, 194,
+    185, 1016, 1153, 809, 119, 209, 145, 1088, 226, 1019,
+    674, 140, 1165, 1166, 1, 807, 937, 1035, 6, 1081,
+    1018, 996, 474, 1006, 935, 432, 869, 1005, 238, 1049,
+    892, 1024, 419, 418, 417, 92, 1297, 121, 206, 921,
+    959, 1296, 1298, 980, 993, 672, 816, 815, 149, 144,
+    1053, 1030, 91, 812, 1313, 1464, 200, 138, 900, 1295,
+    67, 66, 814, 1122, 239, 1186, 475, 401, 901, 1151,
+    1234, 1149, 1169, 1220, 1148, 1193, 403, 1343, 2784, 1040,
+    931, 152, 137, 1147, 944, 811, 699, 694, 713, 813,
+    1041, 930, 162, 1031, 143, 2810, 142, 1420, 928, 1100,
+    84, 1071, 1070, 1036, 1164, 214, 1672, 1202, 400, 1133,
+    2206, 459, 86, 992, 1188, 922, 151, 744, 667, 668,
+    426, 1268, 2548, 2541, 2547, 2421, 2420, 2422, 2550, 2552,
+    2555, 2554, 2557, 2556, 2551, 2553, 2491, 2433, 2536, 2538,
+    2432, 2509, 2518, 2523, 2533, 2454, 2448, 2498, 2453, 2495,
+    2521, 2444, 2497, 2447, 2485, 2484, 2435, 2488, 2530, 2505,
+    2520, 2512, 2450, 2477, 2504, 2489, 2496, 2501, 2502, 2503,
+    2455, 2449, 2511, 2525, 2474, 2492, 2510, 2506, 2457, 2494,
+    2458, 2529, 2507, 2475, 2440, 2445, 2516, 2513, 2514, 2434,
+    2431, 2528, 2540, 2482, 2437, 2481, 2478, 2456, 2451, 2459,
+    2490, 2479, 2535, 2517, 2480, 2499, 2460, 2466, 2467, 2472,
+    2468, 2465, 2464, 2524, 2470, 2471, 2462, 2461, 2469, 2463,
+    2473, 2441, 2446, 2526, 2515, 2442, 2443, 2534, 2531, 2508,
+    2438, 2439, 2483, 2522, 2452, 2476, 2486, 2487, 2539, 2537,
+    2436, 2527, 2519, 2493, 2500, 2546, 2545, 2532, 2417, 2419,
+    2418, 2429, 2413, 2414, 2425, 2410, 2412, 2411, 2428, 2407,
+    2409, 2408, 2430, 2544, 2542, 2549, 2415, 2416, 2426, 2423,
+    2424, 2427, 2543, 466, 467, 746, 102, 115, 101, 103,
+    114, 117, 148, 1069, 106, 108, 790, 793, 1022, 791,
+    583, 688, 690, 1176, 122, 915, 1026, 1318, 1301, 987,
+    312, 342, 1008, 982, 896, 164, 132, 33, 837, 838,
+    919, 972, 423, 958, 955, 977, 1670, 1656, 1655, 1628,
+    1626, 1632, 1631, 1639, 1659, 1660, 1640, 1664, 1662, 1665,
+    1663, 1719, 1654, 1657, 1066, 1651, 1661, 1735, 563, 1669,
+    1627, 1635, 1668, 1637, 1636, 1653, 1658, 1634, 1667, 1646,
+    1671, 1642, 1645, 1644, 1643, 1629, 1633, 1648, 1647, 1638,
+    1709, 1630, 1623, 1624, 1625, 1649, 1641, 1666, 1650, 527,
+    1185, 451, 635, 633, 634, 927, 864, 2856, 776, 2652,
+    759, 246, 458, 251, 131, 629, 2769, 2764, 2770, 2765,
+    2767, 2766, 505, 2771, 2768, 737, 524, 1311, 1314, 1300,
+    1304, 1319, 966, 970, 913, 969, 914, 624, 1048, 1332,
+    772, 1189, 161, 1713, 428, 94, 182, 747, 503, 570,
+    2742, 2749, 2732, 2731, 2734, 2750, 2741, 2725, 2724, 2736,
+    2740, 2727, 2733, 2738, 2763, 2737, 2728, 2746, 2729, 2762,
+    2730, 2723, 2743, 2726, 2735, 2745, 2744, 2739, 216, 2714,
+    2719, 2722, 2721, 2715, 2717, 2716, 2718, 495, 442, 989,
+    2885, 2895, 2900, 2905, 2884, 2883, 2898, 2887, 2924, 2926,
+    2923, 2925, 2918, 2919, 2920, 2904, 2903, 2902, 2880, 2882,
+    2910, 2908, 2897, 2894, 2896, 2899, 2893, 2912, 2913, 2914,
+    2907, 2889, 2888, 2890, 2917, 2916, 2934, 2935, 2933, 2886,
+    2909, 2922, 2921, 2915, 2891, 2892, 2906, 2901, 2911, 2821,
+    2802, 99, 166, 1140, 52, 53, 252, 42, 1432, 829,
+    425, 68, 669, 1495, 1467, 1577, 1433, 487, 1154, 1156,
+    1155, 1534, 925, 1043, 855, 1547, 856, 1037, 603, 208,
+    590, 692, 212, 893, 1292, 842, 274, 303, 318, 1341,
+    620, 1034, 1209, 805, 319, 26, 1303, 8, 1163, 757,
+    1605, 781, 1063, 104, 126, 843, 954, 196, 1418, 1422,
+    21, 235, 231, 687, 726, 500, 17, 1128, 1743, 105,
+    38, 1294, 258, 852, 2154, 380, 327, 374, 377, 379,
+    376, 384, 378, 385, 386, 453, 649, 1486, 768, 1621,
+    375, 469, 180, 731, 1601, 435, 416, 902, 983, 1754,
+    904, 689, 782, 739, 846, 18, 188, 481, 83, 771,
+    820, 801, 1062, 433, 306, 69, 1831, 895, 211, 1600,
+    724, 1744, 1039, 2190, 942, 743, 158, 1173, 2189, 50,
+    968, 331, 947, 912, 905, 979, 956, 906, 847, 910,
+    1335, 1029, 1042, 325, 678, 785, 1135, 1136, 1718, 740,
+    1603, 986, 786, 93, 1009, 183, 2191, 566, 1183, 978,
+    897, 1407, 1408, 1377, 543, 240, 1308, 1710, 1370, 1368,
+    1371, 1369, 225, 763, 849, 80, 1210, 666, 227, 2748,
+    1755, 587, 648, 199, 645, 644, 14, 28, 64, 850,
+    2846, 2808, 2833, 2834, 2801, 2852, 2854, 2848, 2826, 2817,
+    2859, 2825, 2804, 2828, 2806, 1044, 431, 372, 1046, 422,
+    594, 593, 595, 596, 592, 876, 198, 732, 794, 1184,
+    923, 1170, 918, 1123, 1120, 1108, 1107, 1115, 1109, 1121,
+    1118, 1114, 116, 3, 1178, 179, 391, 392, 177, 181,
+    861, 1395, 1394, 1393, 1392, 1396, 1391, 1397, 528, 516,
+    519, 518, 364, 365, 366, 493, 491, 517, 784, 1828,
+    1829, 1038, 402, 497, 832, 758, 792, 559, 591, 1150,
+    1168, 1143, 1227, 1232, 1214, 1228, 1226, 1222, 1225, 1235,
+    49, 51, 1233, 1219, 1221, 1218, 1007, 907, 2754, 2758,
+    2761, 2753, 2759, 2752, 2757, 2756, 2760, 2751, 2755, 709,
+    605, 886, 300, 301, 604, 95, 1086, 1110, 1205, 1197,
+    1198, 409, 406, 407, 1830, 831, 2832, 472, 511, 471,
+    470, 2932, 1425, 1482, 1525, 1431, 1417, 1424, 655, 476,
+    482, 499, 1803, 30, 553, 552, 554, 872, 2809, 1723,
+    1274, 2847, 1142, 60, 2837, 685, 530, 686, 468, 684,
+    859, 155, 1716, 1182, 818, 1340, 1339, 2800, 39, 586,
+    1342, 600, 1346, 1344, 1345, 450, 833, 621, 1236, 1316,
+    1051, 59, 232, 2815, 1414, 1480, 1415, 1553, 1688, 1679,
+    1507, 1159, 1305, 2720, 1435, 1162, 1161, 1403, 1404, 1562,
+    1401, 1312, 1416, 1421, 1485, 601, 1160, 1059, 572, 835,
+    1132, 899, 154, 160, 766, 1724, 1700, 1721, 1706, 1705,
+    1731, 617, 1275, 2786, 2787, 2785, 308, 309, 310, 311,
+    589, 962, 523, 961, 546, 111, 2111, 217, 1032, 230,
+    2776, 974, 664, 27, 1358, 1354, 1366, 1357, 1367, 1362,
+    1361, 1359, 1356, 1355, 1363, 1360, 1364, 1353, 1365, 1352,
+    345, 205, 25, 100, 547, 72, 141, 75, 89, 76,
+    745, 933, 1158, 934, 853, 483, 661, 2788, 698, 703,
+    697, 717, 710, 700, 702, 715, 2845, 711, 714, 719,
+    561, 887, 704, 841, 725, 696, 695, 708, 712, 817,
+    382, 1025, 730, 1130, 783, 761, 760, 1827, 35, 58,
+    32, 204, 1405, 797, 742, 795, 796, 130, 124, 2851,
+    2843, 765, 862, 282, 865, 2666, 1373, 894, 773, 371,
+    1746, 963, 964, 965, 1217, 1216, 1215, 326, 875, 671,
+    454, 2858, 2875, 2878, 2865, 2866, 2869, 2873, 2874, 2861,
+    2860, 2864, 2870, 2871, 2867, 2877, 2876, 2862, 2863, 2872,
+    2868, 1271, 526, 266, 316, 315, 314, 317, 361, 243,
+    1711, 1712, 1129, 109, 107, 0, 1113, 1223, 1224, 670,
+    2564, 2661, 2639, 2561, 2655, 2559, 2656, 2641, 2640, 2669,
+    2585, 2581, 2579, 2582, 2584, 2583, 2580, 2642, 2586, 2668,
+    2662, 2660, 2650, 2651, 2653, 2560, 2575, 2638, 2643, 2649,
+    2648, 2572, 2565, 2574, 2562, 2659, 2577, 2576, 2563, 2663,
+    2637, 2644, 2587, 2578, 2569, 2645, 2636, 2634, 2633, 2632,
+    2646, 2573, 2558, 2664, 2647, 2568, 2665, 2571, 2570, 2635,
+    2566, 2567, 2594, 2592, 2591, 2617, 2590, 2627, 2614, 2589,
+    2611, 2603, 2596, 2601, 2599, 2613, 2625, 2626, 2605, 2606,
+    2628, 2607, 2630, 2631, 2588, 2615, 2597, 2595, 2602, 2612,
+    2604, 2624, 2598, 2623, 2621, 2622, 2619, 2618, 2620, 2610,
+    2609, 2616, 2629, 2600, 2608, 2593, 1055, 1056, 424, 867,
+    2773, 507, 492, 1381, 1382, 1380, 1387, 1385, 1388, 1386,
+    1379, 1384, 1383, 2813, 628, 627, 446, 496, 118, 1194,
+    1195, 163, 1072, 298, 299, 421, 544, 1052, 397, 462,
+    567, 320, 990, 998, 1747, 1678, 1730, 967, 44, 976,
+    229, 762, 926, 165, 120, 56, 4, 197, 973, 70,
+    73, 57, 981, 123, 420, 1736, 1704, 1734, 1699, 1690,
+    1691, 1692, 1741, 1708, 1676, 1677, 1742, 1698, 1685, 1701,
+    1673, 1757, 1687, 1680, 1675, 1693, 1702, 1694, 1683, 1696,
+    1674, 1739, 1695, 1738, 1681, 1190, 602, 1324, 1137, 1138,
+    1139, 1807, 1808, 1732, 1728, 1737, 1307, 1326, 1321, 1322,
+    1323, 1320, 735, 788, 789, 787, 736, 438, 218, 412,
+    414, 413, 341, 1330, 47, 429, 880, 1079, 1078, 1119,
+    1144, 1145, 1146, 1213, 1077, 1080, 898, 2654, 1134, 675,
+    339, 2849, 2850, 473, 1102, 346, 398, 529, 582, 1180,
+    909, 822, 381, 480, 184, 879, 448, 393, 622, 3183,
+    3156, 3153, 3154, 3186, 3158, 3167, 3159, 3182, 3168, 3169,
+    3146, 3147, 3145, 3148, 3149, 3155, 3185, 3163, 3162, 3172,
+    3171, 3184, 3160, 3161, 3187, 3166, 3157, 3181, 3150, 3152,
+    3151, 3000, 2987, 3016, 2998, 2990, 3020, 3007, 3004, 3006,
+    3002, 3001, 2991, 3010, 3015, 3017, 3011, 3023, 3024, 3018,
+    2999, 3009, 2997, 3012, 2993, 3019, 3003, 3008, 3005, 2994,
+    2995, 2996, 2992, 2989, 2927, 3021, 3022, 3025, 3027, 3026,
+    3014, 2988, 3013, 3028, 3174, 3175, 3165, 3164, 3173, 3170,
+    176, 175, 3039, 3037, 3031, 3030, 3042, 3047, 3034, 3032,
+    3046, 3044, 3045, 3043, 3036, 3029, 3038, 3033, 3035, 3040,
+    3041, 3048, 3049, 3092, 3130, 3052, 3129, 3053, 3054, 3056,
+    3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066,
+    3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076,
+    3077, 3078, 3079, 3080, 3081, 3082, 3083, 2929, 2928, 3084,
+    3085, 3087, 3088, 3086, 3089, 3090, 3091, 3142, 3095, 3133,
+    3093, 3094, 3139, 3141, 3136, 3135, 3128, 3096, 3097, 3131,
+    3132, 3055, 3098, 3103, 3099, 3100, 3134, 3101, 3102, 3104,
+    3105, 3106, 3108, 3109, 3107, 3110, 3111, 3114, 3115, 3138,
+    3112, 3113, 3140, 3143, 3116, 3117, 3118, 3119, 3120, 3121,
+    3122, 3123, 3137, 3124, 3125, 3126, 3127, 606, 509, 1333,
+    1753, 588, 305, 1378, 373, 1611, 389, 1250, 1256, 1253,
+    1251, 1254, 1255, 1252, 1257, 3051, 3050, 1390, 1389, 576,
+    577, 578, 579, 610, 96, 575, 520, 562, 560, 2221,
+    1015, 1012, 1000, 1269, 1620, 1289, 1283, 1286, 1281, 1284,
+    1277, 1278, 1287, 1288, 1279, 1290, 1285, 1291, 1280, 1282,
+    1376, 1374, 1375, 1045, 515, 29, 19, 1060, 34, 1602,
+    916, 988, 396, 395, 1058, 2658, 1057, 3188, 187,
+};
+
+#define WINERRSYM_COUNT \
+    ((int)(sizeof(gWinErrorCodes) / sizeof(gWinErrorCodes[0])))
 
 const char *winerrsym(DWORD err)
 {
-#define RET_(name, val) case val: return #name
-    switch (err) {
-        RET_(WAIT_TIMEOUT, 258);
-        RET_(WAIT_FAILED, 4294967295);
-        RET_(ERROR_SUCCESS, 0);
-        RET_(ERROR_INVALID_FUNCTION, 1);
-        RET_(ERROR_FILE_NOT_FOUND, 2);
-        RET_(ERROR_PATH_NOT_FOUND, 3);
-        RET_(ERROR_TOO_MANY_OPEN_FILES, 4);
-        RET_(ERROR_ACCESS_DENIED, 5);
-        RET_(ERROR_INVALID_HANDLE, 6);
-        RET_(ERROR_ARENA_TRASHED, 7);
-        RET_(ERROR_NOT_ENOUGH_MEMORY, 8);
-        RET_(ERROR_INVALID_BLOCK, 9);
-        RET_(ERROR_BAD_ENVIRONMENT, 10);
-        RET_(ERROR_BAD_FORMAT, 11);
-        RET_(ERROR_INVALID_ACCESS, 12);
-        RET_(ERROR_INVALID_DATA, 13);
-        RET_(ERROR_OUTOFMEMORY, 14);
-        RET_(ERROR_INVALID_DRIVE, 15);
-        RET_(ERROR_CURRENT_DIRECTORY, 16);
-        RET_(ERROR_NOT_SAME_DEVICE, 17);
-        RET_(ERROR_NO_MORE_FILES, 18);
-        RET_(ERROR_WRITE_PROTECT, 19);
-        RET_(ERROR_BAD_UNIT, 20);
-        RET_(ERROR_NOT_READY, 21);
-        RET_(ERROR_BAD_COMMAND, 22);
-        RET_(ERROR_CRC, 23);
-        RET_(ERROR_BAD_LENGTH, 24);
-        RET_(ERROR_SEEK, 25);
-        RET_(ERROR_NOT_DOS_DISK, 26);
-        RET_(ERROR_SECTOR_NOT_FOUND, 27);
-        RET_(ERROR_OUT_OF_PAPER, 28);
-        RET_(ERROR_WRITE_FAULT, 29);
-        RET_(ERROR_READ_FAULT, 30);
-        RET_(ERROR_GEN_FAILURE, 31);
-        RET_(ERROR_SHARING_VIOLATION, 32);
-        RET_(ERROR_LOCK_VIOLATION, 33);
-        RET_(ERROR_WRONG_DISK, 34);
-        RET_(ERROR_SHARING_BUFFER_EXCEEDED, 36);
-        RET_(ERROR_HANDLE_EOF, 38);
-        RET_(ERROR_HANDLE_DISK_FULL, 39);
-        RET_(ERROR_NOT_SUPPORTED, 50);
-        RET_(ERROR_REM_NOT_LIST, 51);
-        RET_(ERROR_DUP_NAME, 52);
-        RET_(ERROR_BAD_NETPATH, 53);
-        RET_(ERROR_NETWORK_BUSY, 54);
-        RET_(ERROR_DEV_NOT_EXIST, 55);
-        RET_(ERROR_TOO_MANY_CMDS, 56);
-        RET_(ERROR_ADAP_HDW_ERR, 57);
-        RET_(ERROR_BAD_NET_RESP, 58);
-        RET_(ERROR_UNEXP_NET_ERR, 59);
-        RET_(ERROR_BAD_REM_ADAP, 60);
-        RET_(ERROR_PRINTQ_FULL, 61);
-        RET_(ERROR_NO_SPOOL_SPACE, 62);
-        RET_(ERROR_PRINT_CANCELLED, 63);
-        RET_(ERROR_NETNAME_DELETED, 64);
-        RET_(ERROR_NETWORK_ACCESS_DENIED, 65);
-        RET_(ERROR_BAD_DEV_TYPE, 66);
-        RET_(ERROR_BAD_NET_NAME, 67);
-        RET_(ERROR_TOO_MANY_NAMES, 68);
-        RET_(ERROR_TOO_MANY_SESS, 69);
-        RET_(ERROR_SHARING_PAUSED, 70);
-        RET_(ERROR_REQ_NOT_ACCEP, 71);
-        RET_(ERROR_REDIR_PAUSED, 72);
-        RET_(ERROR_FILE_EXISTS, 80);
-        RET_(ERROR_CANNOT_MAKE, 82);
-        RET_(ERROR_FAIL_I24, 83);
-        RET_(ERROR_OUT_OF_STRUCTURES, 84);
-        RET_(ERROR_ALREADY_ASSIGNED, 85);
-        RET_(ERROR_INVALID_PASSWORD, 86);
-        RET_(ERROR_INVALID_PARAMETER, 87);
-        RET_(ERROR_NET_WRITE_FAULT, 88);
-        RET_(ERROR_NO_PROC_SLOTS, 89);
-        RET_(ERROR_TOO_MANY_SEMAPHORES, 100);
-        RET_(ERROR_EXCL_SEM_ALREADY_OWNED, 101);
-        RET_(ERROR_SEM_IS_SET, 102);
-        RET_(ERROR_TOO_MANY_SEM_REQUESTS, 103);
-        RET_(ERROR_INVALID_AT_INTERRUPT_TIME, 104);
-        RET_(ERROR_SEM_OWNER_DIED, 105);
-        RET_(ERROR_SEM_USER_LIMIT, 106);
-        RET_(ERROR_DISK_CHANGE, 107);
-        RET_(ERROR_DRIVE_LOCKED, 108);
-        RET_(ERROR_BROKEN_PIPE, 109);
-        RET_(ERROR_OPEN_FAILED, 110);
-        RET_(ERROR_BUFFER_OVERFLOW, 111);
-        RET_(ERROR_DISK_FULL, 112);
-        RET_(ERROR_NO_MORE_SEARCH_HANDLES, 113);
-        RET_(ERROR_INVALID_TARGET_HANDLE, 114);
-        RET_(ERROR_INVALID_CATEGORY, 117);
-        RET_(ERROR_INVALID_VERIFY_SWITCH, 118);
-        RET_(ERROR_BAD_DRIVER_LEVEL, 119);
-        RET_(ERROR_CALL_NOT_IMPLEMENTED, 120);
-        RET_(ERROR_SEM_TIMEOUT, 121);
-        RET_(ERROR_INSUFFICIENT_BUFFER, 122);
-        RET_(ERROR_INVALID_NAME, 123);
-        RET_(ERROR_INVALID_LEVEL, 124);
-        RET_(ERROR_NO_VOLUME_LABEL, 125);
-        RET_(ERROR_MOD_NOT_FOUND, 126);
-        RET_(ERROR_PROC_NOT_FOUND, 127);
-        RET_(ERROR_WAIT_NO_CHILDREN, 128);
-        RET_(ERROR_CHILD_NOT_COMPLETE, 129);
-        RET_(ERROR_DIRECT_ACCESS_HANDLE, 130);
-        RET_(ERROR_NEGATIVE_SEEK, 131);
-        RET_(ERROR_SEEK_ON_DEVICE, 132);
-        RET_(ERROR_IS_JOIN_TARGET, 133);
-        RET_(ERROR_IS_JOINED, 134);
-        RET_(ERROR_IS_SUBSTED, 135);
-        RET_(ERROR_NOT_JOINED, 136);
-        RET_(ERROR_NOT_SUBSTED, 137);
-        RET_(ERROR_JOIN_TO_JOIN, 138);
-        RET_(ERROR_SUBST_TO_SUBST, 139);
-        RET_(ERROR_JOIN_TO_SUBST, 140);
-        RET_(ERROR_SUBST_TO_JOIN, 141);
-        RET_(ERROR_BUSY_DRIVE, 142);
-        RET_(ERROR_SAME_DRIVE, 143);
-        RET_(ERROR_DIR_NOT_ROOT, 144);
-        RET_(ERROR_DIR_NOT_EMPTY, 145);
-        RET_(ERROR_IS_SUBST_PATH, 146);
-        RET_(ERROR_IS_JOIN_PATH, 147);
-        RET_(ERROR_PATH_BUSY, 148);
-        RET_(ERROR_IS_SUBST_TARGET, 149);
-        RET_(ERROR_SYSTEM_TRACE, 150);
-        RET_(ERROR_INVALID_EVENT_COUNT, 151);
-        RET_(ERROR_TOO_MANY_MUXWAITERS, 152);
-        RET_(ERROR_INVALID_LIST_FORMAT, 153);
-        RET_(ERROR_LABEL_TOO_LONG, 154);
-        RET_(ERROR_TOO_MANY_TCBS, 155);
-        RET_(ERROR_SIGNAL_REFUSED, 156);
-        RET_(ERROR_DISCARDED, 157);
-        RET_(ERROR_NOT_LOCKED, 158);
-        RET_(ERROR_BAD_THREADID_ADDR, 159);
-        RET_(ERROR_BAD_ARGUMENTS, 160);
-        RET_(ERROR_BAD_PATHNAME, 161);
-        RET_(ERROR_SIGNAL_PENDING, 162);
-        RET_(ERROR_MAX_THRDS_REACHED, 164);
-        RET_(ERROR_LOCK_FAILED, 167);
-        RET_(ERROR_BUSY, 170);
-        RET_(ERROR_DEVICE_SUPPORT_IN_PROGRESS, 171);
-        RET_(ERROR_CANCEL_VIOLATION, 173);
-        RET_(ERROR_ATOMIC_LOCKS_NOT_SUPPORTED, 174);
-        RET_(ERROR_INVALID_SEGMENT_NUMBER, 180);
-        RET_(ERROR_INVALID_ORDINAL, 182);
-        RET_(ERROR_ALREADY_EXISTS, 183);
-        RET_(ERROR_INVALID_FLAG_NUMBER, 186);
-        RET_(ERROR_SEM_NOT_FOUND, 187);
-        RET_(ERROR_INVALID_STARTING_CODESEG, 188);
-        RET_(ERROR_INVALID_STACKSEG, 189);
-        RET_(ERROR_INVALID_MODULETYPE, 190);
-        RET_(ERROR_INVALID_EXE_SIGNATURE, 191);
-        RET_(ERROR_EXE_MARKED_INVALID, 192);
-        RET_(ERROR_BAD_EXE_FORMAT, 193);
-        RET_(ERROR_ITERATED_DATA_EXCEEDS_64k, 194);
-        RET_(ERROR_INVALID_MINALLOCSIZE, 195);
-        RET_(ERROR_DYNLINK_FROM_INVALID_RING, 196);
-        RET_(ERROR_IOPL_NOT_ENABLED, 197);
-        RET_(ERROR_INVALID_SEGDPL, 198);
-        RET_(ERROR_AUTODATASEG_EXCEEDS_64k, 199);
-        RET_(ERROR_RING2SEG_MUST_BE_MOVABLE, 200);
-        RET_(ERROR_RELOC_CHAIN_XEEDS_SEGLIM, 201);
-        RET_(ERROR_INFLOOP_IN_RELOC_CHAIN, 202);
-        RET_(ERROR_ENVVAR_NOT_FOUND, 203);
-        RET_(ERROR_NO_SIGNAL_SENT, 205);
-        RET_(ERROR_FILENAME_EXCED_RANGE, 206);
-        RET_(ERROR_RING2_STACK_IN_USE, 207);
-        RET_(ERROR_META_EXPANSION_TOO_LONG, 208);
-        RET_(ERROR_INVALID_SIGNAL_NUMBER, 209);
-        RET_(ERROR_THREAD_1_INACTIVE, 210);
-        RET_(ERROR_LOCKED, 212);
-        RET_(ERROR_TOO_MANY_MODULES, 214);
-        RET_(ERROR_NESTING_NOT_ALLOWED, 215);
-        RET_(ERROR_EXE_MACHINE_TYPE_MISMATCH, 216);
-        RET_(ERROR_EXE_CANNOT_MODIFY_SIGNED_BINARY, 217);
-        RET_(ERROR_EXE_CANNOT_MODIFY_STRONG_SIGNED_BINARY, 218);
-        RET_(ERROR_FILE_CHECKED_OUT, 220);
-        RET_(ERROR_CHECKOUT_REQUIRED, 221);
-        RET_(ERROR_BAD_FILE_TYPE, 222);
-        RET_(ERROR_FILE_TOO_LARGE, 223);
-        RET_(ERROR_FORMS_AUTH_REQUIRED, 224);
-        RET_(ERROR_VIRUS_INFECTED, 225);
-        RET_(ERROR_VIRUS_DELETED, 226);
-        RET_(ERROR_PIPE_LOCAL, 229);
-        RET_(ERROR_BAD_PIPE, 230);
-        RET_(ERROR_PIPE_BUSY, 231);
-        RET_(ERROR_NO_DATA, 232);
-        RET_(ERROR_PIPE_NOT_CONNECTED, 233);
-        RET_(ERROR_MORE_DATA, 234);
-        RET_(ERROR_NO_WORK_DONE, 235);
-        RET_(ERROR_VC_DISCONNECTED, 240);
-        RET_(ERROR_INVALID_EA_NAME, 254);
-        RET_(ERROR_EA_LIST_INCONSISTENT, 255);
-        RET_(ERROR_NO_MORE_ITEMS, 259);
-        RET_(ERROR_CANNOT_COPY, 266);
-        RET_(ERROR_DIRECTORY, 267);
-        RET_(ERROR_EAS_DIDNT_FIT, 275);
-        RET_(ERROR_EA_FILE_CORRUPT, 276);
-        RET_(ERROR_EA_TABLE_FULL, 277);
-        RET_(ERROR_INVALID_EA_HANDLE, 278);
-        RET_(ERROR_EAS_NOT_SUPPORTED, 282);
-        RET_(ERROR_NOT_OWNER, 288);
-        RET_(ERROR_TOO_MANY_POSTS, 298);
-        RET_(ERROR_PARTIAL_COPY, 299);
-        RET_(ERROR_OPLOCK_NOT_GRANTED, 300);
-        RET_(ERROR_INVALID_OPLOCK_PROTOCOL, 301);
-        RET_(ERROR_DISK_TOO_FRAGMENTED, 302);
-        RET_(ERROR_DELETE_PENDING, 303);
-        RET_(ERROR_INCOMPATIBLE_WITH_GLOBAL_SHORT_NAME_REGISTRY_SETTING, 304);
-        RET_(ERROR_SHORT_NAMES_NOT_ENABLED_ON_VOLUME, 305);
-        RET_(ERROR_SECURITY_STREAM_IS_INCONSISTENT, 306);
-        RET_(ERROR_INVALID_LOCK_RANGE, 307);
-        RET_(ERROR_IMAGE_SUBSYSTEM_NOT_PRESENT, 308);
-        RET_(ERROR_NOTIFICATION_GUID_ALREADY_DEFINED, 309);
-        RET_(ERROR_INVALID_EXCEPTION_HANDLER, 310);
-        RET_(ERROR_DUPLICATE_PRIVILEGES, 311);
-        RET_(ERROR_NO_RANGES_PROCESSED, 312);
-        RET_(ERROR_NOT_ALLOWED_ON_SYSTEM_FILE, 313);
-        RET_(ERROR_DISK_RESOURCES_EXHAUSTED, 314);
-        RET_(ERROR_INVALID_TOKEN, 315);
-        RET_(ERROR_DEVICE_FEATURE_NOT_SUPPORTED, 316);
-        RET_(ERROR_MR_MID_NOT_FOUND, 317);
-        RET_(ERROR_SCOPE_NOT_FOUND, 318);
-        RET_(ERROR_UNDEFINED_SCOPE, 319);
-        RET_(ERROR_INVALID_CAP, 320);
-        RET_(ERROR_DEVICE_UNREACHABLE, 321);
-        RET_(ERROR_DEVICE_NO_RESOURCES, 322);
-        RET_(ERROR_DATA_CHECKSUM_ERROR, 323);
-        RET_(ERROR_INTERMIXED_KERNEL_EA_OPERATION, 324);
-        RET_(ERROR_FILE_LEVEL_TRIM_NOT_SUPPORTED, 326);
-        RET_(ERROR_OFFSET_ALIGNMENT_VIOLATION, 327);
-        RET_(ERROR_INVALID_FIELD_IN_PARAMETER_LIST, 328);
-        RET_(ERROR_OPERATION_IN_PROGRESS, 329);
-        RET_(ERROR_BAD_DEVICE_PATH, 330);
-        RET_(ERROR_TOO_MANY_DESCRIPTORS, 331);
-        RET_(ERROR_SCRUB_DATA_DISABLED, 332);
-        RET_(ERROR_NOT_REDUNDANT_STORAGE, 333);
-        RET_(ERROR_RESIDENT_FILE_NOT_SUPPORTED, 334);
-        RET_(ERROR_COMPRESSED_FILE_NOT_SUPPORTED, 335);
-        RET_(ERROR_DIRECTORY_NOT_SUPPORTED, 336);
-        RET_(ERROR_NOT_READ_FROM_COPY, 337);
-        RET_(ERROR_FT_WRITE_FAILURE, 338);
-        RET_(ERROR_FT_DI_SCAN_REQUIRED, 339);
-        RET_(ERROR_INVALID_KERNEL_INFO_VERSION, 340);
-        RET_(ERROR_INVALID_PEP_INFO_VERSION, 341);
-        RET_(ERROR_OBJECT_NOT_EXTERNALLY_BACKED, 342);
-        RET_(ERROR_EXTERNAL_BACKING_PROVIDER_UNKNOWN, 343);
-        RET_(ERROR_COMPRESSION_NOT_BENEFICIAL, 344);
-        RET_(ERROR_STORAGE_TOPOLOGY_ID_MISMATCH, 345);
-        RET_(ERROR_BLOCKED_BY_PARENTAL_CONTROLS, 346);
-        RET_(ERROR_BLOCK_TOO_MANY_REFERENCES, 347);
-        RET_(ERROR_MARKED_TO_DISALLOW_WRITES, 348);
-        RET_(ERROR_ENCLAVE_FAILURE, 349);
-        RET_(ERROR_FAIL_NOACTION_REBOOT, 350);
-        RET_(ERROR_FAIL_SHUTDOWN, 351);
-        RET_(ERROR_FAIL_RESTART, 352);
-        RET_(ERROR_MAX_SESSIONS_REACHED, 353);
-        RET_(ERROR_NETWORK_ACCESS_DENIED_EDP, 354);
-        RET_(ERROR_DEVICE_HINT_NAME_BUFFER_TOO_SMALL, 355);
-        RET_(ERROR_EDP_POLICY_DENIES_OPERATION, 356);
-        RET_(ERROR_EDP_DPL_POLICY_CANT_BE_SATISFIED, 357);
-        RET_(ERROR_CLOUD_FILE_SYNC_ROOT_METADATA_CORRUPT, 358);
-        RET_(ERROR_DEVICE_IN_MAINTENANCE, 359);
-        RET_(ERROR_NOT_SUPPORTED_ON_DAX, 360);
-        RET_(ERROR_DAX_MAPPING_EXISTS, 361);
-        RET_(ERROR_CLOUD_FILE_PROVIDER_NOT_RUNNING, 362);
-        RET_(ERROR_CLOUD_FILE_METADATA_CORRUPT, 363);
-        RET_(ERROR_CLOUD_FILE_METADATA_TOO_LARGE, 364);
-        RET_(ERROR_CLOUD_FILE_PROPERTY_BLOB_TOO_LARGE, 365);
-        RET_(ERROR_CLOUD_FILE_PROPERTY_BLOB_CHECKSUM_MISMATCH, 366);
-        RET_(ERROR_CHILD_PROCESS_BLOCKED, 367);
-        RET_(ERROR_STORAGE_LOST_DATA_PERSISTENCE, 368);
-        RET_(ERROR_FILE_SYSTEM_VIRTUALIZATION_UNAVAILABLE, 369);
-        RET_(ERROR_FILE_SYSTEM_VIRTUALIZATION_METADATA_CORRUPT, 370);
-        RET_(ERROR_FILE_SYSTEM_VIRTUALIZATION_BUSY, 371);
-        RET_(ERROR_FILE_SYSTEM_VIRTUALIZATION_PROVIDER_UNKNOWN, 372);
-        RET_(ERROR_GDI_HANDLE_LEAK, 373);
-        RET_(ERROR_CLOUD_FILE_TOO_MANY_PROPERTY_BLOBS, 374);
-        RET_(ERROR_CLOUD_FILE_PROPERTY_VERSION_NOT_SUPPORTED, 375);
-        RET_(ERROR_NOT_A_CLOUD_FILE, 376);
-        RET_(ERROR_CLOUD_FILE_NOT_IN_SYNC, 377);
-        RET_(ERROR_CLOUD_FILE_ALREADY_CONNECTED, 378);
-        RET_(ERROR_CLOUD_FILE_NOT_SUPPORTED, 379);
-        RET_(ERROR_CLOUD_FILE_INVALID_REQUEST, 380);
-        RET_(ERROR_CLOUD_FILE_READ_ONLY_VOLUME, 381);
-        RET_(ERROR_CLOUD_FILE_CONNECTED_PROVIDER_ONLY, 382);
-        RET_(ERROR_CLOUD_FILE_VALIDATION_FAILED, 383);
-        RET_(ERROR_SMB1_NOT_AVAILABLE, 384);
-        RET_(ERROR_FILE_SYSTEM_VIRTUALIZATION_INVALID_OPERATION, 385);
-        RET_(ERROR_CLOUD_FILE_AUTHENTICATION_FAILED, 386);
-        RET_(ERROR_CLOUD_FILE_INSUFFICIENT_RESOURCES, 387);
-        RET_(ERROR_CLOUD_FILE_NETWORK_UNAVAILABLE, 388);
-        RET_(ERROR_CLOUD_FILE_UNSUCCESSFUL, 389);
-        RET_(ERROR_CLOUD_FILE_NOT_UNDER_SYNC_ROOT, 390);
-        RET_(ERROR_CLOUD_FILE_IN_USE, 391);
-        RET_(ERROR_CLOUD_FILE_PINNED, 392);
-        RET_(ERROR_CLOUD_FILE_REQUEST_ABORTED, 393);
-        RET_(ERROR_CLOUD_FILE_PROPERTY_CORRUPT, 394);
-        RET_(ERROR_CLOUD_FILE_ACCESS_DENIED, 395);
-        RET_(ERROR_CLOUD_FILE_INCOMPATIBLE_HARDLINKS, 396);
-        RET_(ERROR_CLOUD_FILE_PROPERTY_LOCK_CONFLICT, 397);
-        RET_(ERROR_CLOUD_FILE_REQUEST_CANCELED, 398);
-        RET_(ERROR_EXTERNAL_SYSKEY_NOT_SUPPORTED, 399);
-        RET_(ERROR_THREAD_MODE_ALREADY_BACKGROUND, 400);
-        RET_(ERROR_THREAD_MODE_NOT_BACKGROUND, 401);
-        RET_(ERROR_PROCESS_MODE_ALREADY_BACKGROUND, 402);
-        RET_(ERROR_PROCESS_MODE_NOT_BACKGROUND, 403);
-        RET_(ERROR_CLOUD_FILE_PROVIDER_TERMINATED, 404);
-        RET_(ERROR_NOT_A_CLOUD_SYNC_ROOT, 405);
-        RET_(ERROR_FILE_PROTECTED_UNDER_DPL, 406);
-        RET_(ERROR_VOLUME_NOT_CLUSTER_ALIGNED, 407);
-        RET_(ERROR_NO_PHYSICALLY_ALIGNED_FREE_SPACE_FOUND, 408);
-        RET_(ERROR_APPX_FILE_NOT_ENCRYPTED, 409);
-        RET_(ERROR_RWRAW_ENCRYPTED_FILE_NOT_ENCRYPTED, 410);
-        RET_(ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILEOFFSET, 411);
-        RET_(ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_FILERANGE, 412);
-        RET_(ERROR_RWRAW_ENCRYPTED_INVALID_EDATAINFO_PARAMETER, 413);
-        RET_(ERROR_LINUX_SUBSYSTEM_NOT_PRESENT, 414);
-        RET_(ERROR_FT_READ_FAILURE, 415);
-        RET_(ERROR_STORAGE_RESERVE_ID_INVALID, 416);
-        RET_(ERROR_STORAGE_RESERVE_DOES_NOT_EXIST, 417);
-        RET_(ERROR_STORAGE_RESERVE_ALREADY_EXISTS, 418);
-        RET_(ERROR_STORAGE_RESERVE_NOT_EMPTY, 419);
-        RET_(ERROR_NOT_A_DAX_VOLUME, 420);
-        RET_(ERROR_NOT_DAX_MAPPABLE, 421);
-        RET_(ERROR_TIME_SENSITIVE_THREAD, 422);
-        RET_(ERROR_DPL_NOT_SUPPORTED_FOR_USER, 423);
-        RET_(ERROR_CASE_DIFFERING_NAMES_IN_DIR, 424);
-        RET_(ERROR_FILE_NOT_SUPPORTED, 425);
-        RET_(ERROR_CLOUD_FILE_REQUEST_TIMEOUT, 426);
-        RET_(ERROR_NO_TASK_QUEUE, 427);
-        RET_(ERROR_SRC_SRV_DLL_LOAD_FAILED, 428);
-        RET_(ERROR_NOT_SUPPORTED_WITH_BTT, 429);
-        RET_(ERROR_ENCRYPTION_DISABLED, 430);
-        RET_(ERROR_ENCRYPTING_METADATA_DISALLOWED, 431);
-        RET_(ERROR_CANT_CLEAR_ENCRYPTION_FLAG, 432);
-        RET_(ERROR_NO_SUCH_DEVICE, 433);
-        RET_(ERROR_CLOUD_FILE_DEHYDRATION_DISALLOWED, 434);
-        RET_(ERROR_FILE_SNAP_IN_PROGRESS, 435);
-        RET_(ERROR_FILE_SNAP_USER_SECTION_NOT_SUPPORTED, 436);
-        RET_(ERROR_FILE_SNAP_MODIFY_NOT_SUPPORTED, 437);
-        RET_(ERROR_FILE_SNAP_IO_NOT_COORDINATED, 438);
-        RET_(ERROR_FILE_SNAP_UNEXPECTED_ERROR, 439);
-        RET_(ERROR_FILE_SNAP_INVALID_PARAMETER, 440);
-        RET_(ERROR_UNSATISFIED_DEPENDENCIES, 441);
-        RET_(ERROR_CASE_SENSITIVE_PATH, 442);
-        RET_(ERROR_UNEXPECTED_NTCACHEMANAGER_ERROR, 443);
-        RET_(ERROR_LINUX_SUBSYSTEM_UPDATE_REQUIRED, 444);
-        RET_(ERROR_DLP_POLICY_WARNS_AGAINST_OPERATION, 445);
-        RET_(ERROR_DLP_POLICY_DENIES_OPERATION, 446);
-        RET_(ERROR_SECURITY_DENIES_OPERATION, 447);
-        RET_(ERROR_UNTRUSTED_MOUNT_POINT, 448);
-        RET_(ERROR_DLP_POLICY_SILENTLY_FAIL, 449);
-        RET_(ERROR_CAPAUTHZ_NOT_DEVUNLOCKED, 450);
-        RET_(ERROR_CAPAUTHZ_CHANGE_TYPE, 451);
-        RET_(ERROR_CAPAUTHZ_NOT_PROVISIONED, 452);
-        RET_(ERROR_CAPAUTHZ_NOT_AUTHORIZED, 453);
-        RET_(ERROR_CAPAUTHZ_NO_POLICY, 454);
-        RET_(ERROR_CAPAUTHZ_DB_CORRUPTED, 455);
-        RET_(ERROR_CAPAUTHZ_SCCD_INVALID_CATALOG, 456);
-        RET_(ERROR_CAPAUTHZ_SCCD_NO_AUTH_ENTITY, 457);
-        RET_(ERROR_CAPAUTHZ_SCCD_PARSE_ERROR, 458);
-        RET_(ERROR_CAPAUTHZ_SCCD_DEV_MODE_REQUIRED, 459);
-        RET_(ERROR_CAPAUTHZ_SCCD_NO_CAPABILITY_MATCH, 460);
-        RET_(ERROR_CIMFS_IMAGE_CORRUPT, 470);
-        RET_(ERROR_CIMFS_IMAGE_VERSION_NOT_SUPPORTED, 471);
-        RET_(ERROR_STORAGE_STACK_ACCESS_DENIED, 472);
-        RET_(ERROR_INSUFFICIENT_VIRTUAL_ADDR_RESOURCES, 473);
-        RET_(ERROR_INDEX_OUT_OF_BOUNDS, 474);
-        RET_(ERROR_PNP_QUERY_REMOVE_DEVICE_TIMEOUT, 480);
-        RET_(ERROR_PNP_QUERY_REMOVE_RELATED_DEVICE_TIMEOUT, 481);
-        RET_(ERROR_PNP_QUERY_REMOVE_UNRELATED_DEVICE_TIMEOUT, 482);
-        RET_(ERROR_DEVICE_HARDWARE_ERROR, 483);
-        RET_(ERROR_INVALID_ADDRESS, 487);
-        RET_(ERROR_HAS_SYSTEM_CRITICAL_FILES, 488);
-        RET_(ERROR_ENCRYPTED_FILE_NOT_SUPPORTED, 489);
-        RET_(ERROR_SPARSE_FILE_NOT_SUPPORTED, 490);
-        RET_(ERROR_PAGEFILE_NOT_SUPPORTED, 491);
-        RET_(ERROR_VOLUME_NOT_SUPPORTED, 492);
-        RET_(ERROR_NOT_SUPPORTED_WITH_BYPASSIO, 493);
-        RET_(ERROR_NO_BYPASSIO_DRIVER_SUPPORT, 494);
-        RET_(ERROR_NOT_SUPPORTED_WITH_ENCRYPTION, 495);
-        RET_(ERROR_NOT_SUPPORTED_WITH_COMPRESSION, 496);
-        RET_(ERROR_NOT_SUPPORTED_WITH_REPLICATION, 497);
-        RET_(ERROR_NOT_SUPPORTED_WITH_DEDUPLICATION, 498);
-        RET_(ERROR_NOT_SUPPORTED_WITH_AUDITING, 499);
-        RET_(ERROR_USER_PROFILE_LOAD, 500);
-        RET_(ERROR_SESSION_KEY_TOO_SHORT, 501);
-        RET_(ERROR_ACCESS_DENIED_APPDATA, 502);
-        RET_(ERROR_NOT_SUPPORTED_WITH_MONITORING, 503);
-        RET_(ERROR_NOT_SUPPORTED_WITH_SNAPSHOT, 504);
-        RET_(ERROR_NOT_SUPPORTED_WITH_VIRTUALIZATION, 505);
-        RET_(ERROR_BYPASSIO_FLT_NOT_SUPPORTED, 506);
-        RET_(ERROR_DEVICE_RESET_REQUIRED, 507);
-        RET_(ERROR_VOLUME_WRITE_ACCESS_DENIED, 508);
-        RET_(ERROR_ARITHMETIC_OVERFLOW, 534);
-        RET_(ERROR_PIPE_CONNECTED, 535);
-        RET_(ERROR_PIPE_LISTENING, 536);
-        RET_(ERROR_VERIFIER_STOP, 537);
-        RET_(ERROR_ABIOS_ERROR, 538);
-        RET_(ERROR_WX86_WARNING, 539);
-        RET_(ERROR_WX86_ERROR, 540);
-        RET_(ERROR_TIMER_NOT_CANCELED, 541);
-        RET_(ERROR_UNWIND, 542);
-        RET_(ERROR_BAD_STACK, 543);
-        RET_(ERROR_INVALID_UNWIND_TARGET, 544);
-        RET_(ERROR_INVALID_PORT_ATTRIBUTES, 545);
-        RET_(ERROR_PORT_MESSAGE_TOO_LONG, 546);
-        RET_(ERROR_INVALID_QUOTA_LOWER, 547);
-        RET_(ERROR_DEVICE_ALREADY_ATTACHED, 548);
-        RET_(ERROR_INSTRUCTION_MISALIGNMENT, 549);
-        RET_(ERROR_PROFILING_NOT_STARTED, 550);
-        RET_(ERROR_PROFILING_NOT_STOPPED, 551);
-        RET_(ERROR_COULD_NOT_INTERPRET, 552);
-        RET_(ERROR_PROFILING_AT_LIMIT, 553);
-        RET_(ERROR_CANT_WAIT, 554);
-        RET_(ERROR_CANT_TERMINATE_SELF, 555);
-        RET_(ERROR_UNEXPECTED_MM_CREATE_ERR, 556);
-        RET_(ERROR_UNEXPECTED_MM_MAP_ERROR, 557);
-        RET_(ERROR_UNEXPECTED_MM_EXTEND_ERR, 558);
-        RET_(ERROR_BAD_FUNCTION_TABLE, 559);
-        RET_(ERROR_NO_GUID_TRANSLATION, 560);
-        RET_(ERROR_INVALID_LDT_SIZE, 561);
-        RET_(ERROR_INVALID_LDT_OFFSET, 563);
-        RET_(ERROR_INVALID_LDT_DESCRIPTOR, 564);
-        RET_(ERROR_TOO_MANY_THREADS, 565);
-        RET_(ERROR_THREAD_NOT_IN_PROCESS, 566);
-        RET_(ERROR_PAGEFILE_QUOTA_EXCEEDED, 567);
-        RET_(ERROR_LOGON_SERVER_CONFLICT, 568);
-        RET_(ERROR_SYNCHRONIZATION_REQUIRED, 569);
-        RET_(ERROR_NET_OPEN_FAILED, 570);
-        RET_(ERROR_IO_PRIVILEGE_FAILED, 571);
-        RET_(ERROR_CONTROL_C_EXIT, 572);
-        RET_(ERROR_MISSING_SYSTEMFILE, 573);
-        RET_(ERROR_UNHANDLED_EXCEPTION, 574);
-        RET_(ERROR_APP_INIT_FAILURE, 575);
-        RET_(ERROR_PAGEFILE_CREATE_FAILED, 576);
-        RET_(ERROR_INVALID_IMAGE_HASH, 577);
-        RET_(ERROR_NO_PAGEFILE, 578);
-        RET_(ERROR_ILLEGAL_FLOAT_CONTEXT, 579);
-        RET_(ERROR_NO_EVENT_PAIR, 580);
-        RET_(ERROR_DOMAIN_CTRLR_CONFIG_ERROR, 581);
-        RET_(ERROR_ILLEGAL_CHARACTER, 582);
-        RET_(ERROR_UNDEFINED_CHARACTER, 583);
-        RET_(ERROR_FLOPPY_VOLUME, 584);
-        RET_(ERROR_BIOS_FAILED_TO_CONNECT_INTERRUPT, 585);
-        RET_(ERROR_BACKUP_CONTROLLER, 586);
-        RET_(ERROR_MUTANT_LIMIT_EXCEEDED, 587);
-        RET_(ERROR_FS_DRIVER_REQUIRED, 588);
-        RET_(ERROR_CANNOT_LOAD_REGISTRY_FILE, 589);
-        RET_(ERROR_DEBUG_ATTACH_FAILED, 590);
-        RET_(ERROR_SYSTEM_PROCESS_TERMINATED, 591);
-        RET_(ERROR_DATA_NOT_ACCEPTED, 592);
-        RET_(ERROR_VDM_HARD_ERROR, 593);
-        RET_(ERROR_DRIVER_CANCEL_TIMEOUT, 594);
-        RET_(ERROR_REPLY_MESSAGE_MISMATCH, 595);
-        RET_(ERROR_LOST_WRITEBEHIND_DATA, 596);
-        RET_(ERROR_CLIENT_SERVER_PARAMETERS_INVALID, 597);
-        RET_(ERROR_NOT_TINY_STREAM, 598);
-        RET_(ERROR_STACK_OVERFLOW_READ, 599);
-        RET_(ERROR_CONVERT_TO_LARGE, 600);
-        RET_(ERROR_FOUND_OUT_OF_SCOPE, 601);
-        RET_(ERROR_ALLOCATE_BUCKET, 602);
-        RET_(ERROR_MARSHALL_OVERFLOW, 603);
-        RET_(ERROR_INVALID_VARIANT, 604);
-        RET_(ERROR_BAD_COMPRESSION_BUFFER, 605);
-        RET_(ERROR_AUDIT_FAILED, 606);
-        RET_(ERROR_TIMER_RESOLUTION_NOT_SET, 607);
-        RET_(ERROR_INSUFFICIENT_LOGON_INFO, 608);
-        RET_(ERROR_BAD_DLL_ENTRYPOINT, 609);
-        RET_(ERROR_BAD_SERVICE_ENTRYPOINT, 610);
-        RET_(ERROR_IP_ADDRESS_CONFLICT1, 611);
-        RET_(ERROR_IP_ADDRESS_CONFLICT2, 612);
-        RET_(ERROR_REGISTRY_QUOTA_LIMIT, 613);
-        RET_(ERROR_NO_CALLBACK_ACTIVE, 614);
-        RET_(ERROR_PWD_TOO_SHORT, 615);
-        RET_(ERROR_PWD_TOO_RECENT, 616);
-        RET_(ERROR_PWD_HISTORY_CONFLICT, 617);
-        RET_(ERROR_UNSUPPORTED_COMPRESSION, 618);
-        RET_(ERROR_INVALID_HW_PROFILE, 619);
-        RET_(ERROR_INVALID_PLUGPLAY_DEVICE_PATH, 620);
-        RET_(ERROR_QUOTA_LIST_INCONSISTENT, 621);
-        RET_(ERROR_EVALUATION_EXPIRATION, 622);
-        RET_(ERROR_ILLEGAL_DLL_RELOCATION, 623);
-        RET_(ERROR_DLL_INIT_FAILED_LOGOFF, 624);
-        RET_(ERROR_VALIDATE_CONTINUE, 625);
-        RET_(ERROR_NO_MORE_MATCHES, 626);
-        RET_(ERROR_RANGE_LIST_CONFLICT, 627);
-        RET_(ERROR_SERVER_SID_MISMATCH, 628);
-        RET_(ERROR_CANT_ENABLE_DENY_ONLY, 629);
-        RET_(ERROR_FLOAT_MULTIPLE_FAULTS, 630);
-        RET_(ERROR_FLOAT_MULTIPLE_TRAPS, 631);
-        RET_(ERROR_NOINTERFACE, 632);
-        RET_(ERROR_DRIVER_FAILED_SLEEP, 633);
-        RET_(ERROR_CORRUPT_SYSTEM_FILE, 634);
-        RET_(ERROR_COMMITMENT_MINIMUM, 635);
-        RET_(ERROR_PNP_RESTART_ENUMERATION, 636);
-        RET_(ERROR_SYSTEM_IMAGE_BAD_SIGNATURE, 637);
-        RET_(ERROR_PNP_REBOOT_REQUIRED, 638);
-        RET_(ERROR_INSUFFICIENT_POWER, 639);
-        RET_(ERROR_MULTIPLE_FAULT_VIOLATION, 640);
-        RET_(ERROR_SYSTEM_SHUTDOWN, 641);
-        RET_(ERROR_PORT_NOT_SET, 642);
-        RET_(ERROR_DS_VERSION_CHECK_FAILURE, 643);
-        RET_(ERROR_RANGE_NOT_FOUND, 644);
-        RET_(ERROR_NOT_SAFE_MODE_DRIVER, 646);
-        RET_(ERROR_FAILED_DRIVER_ENTRY, 647);
-        RET_(ERROR_DEVICE_ENUMERATION_ERROR, 648);
-        RET_(ERROR_MOUNT_POINT_NOT_RESOLVED, 649);
-        RET_(ERROR_INVALID_DEVICE_OBJECT_PARAMETER, 650);
-        RET_(ERROR_MCA_OCCURED, 651);
-        RET_(ERROR_DRIVER_DATABASE_ERROR, 652);
-        RET_(ERROR_SYSTEM_HIVE_TOO_LARGE, 653);
-        RET_(ERROR_DRIVER_FAILED_PRIOR_UNLOAD, 654);
-        RET_(ERROR_VOLSNAP_PREPARE_HIBERNATE, 655);
-        RET_(ERROR_HIBERNATION_FAILURE, 656);
-        RET_(ERROR_PWD_TOO_LONG, 657);
-        RET_(ERROR_FILE_SYSTEM_LIMITATION, 665);
-        RET_(ERROR_ASSERTION_FAILURE, 668);
-        RET_(ERROR_ACPI_ERROR, 669);
-        RET_(ERROR_WOW_ASSERTION, 670);
-        RET_(ERROR_PNP_BAD_MPS_TABLE, 671);
-        RET_(ERROR_PNP_TRANSLATION_FAILED, 672);
-        RET_(ERROR_PNP_IRQ_TRANSLATION_FAILED, 673);
-        RET_(ERROR_PNP_INVALID_ID, 674);
-        RET_(ERROR_WAKE_SYSTEM_DEBUGGER, 675);
-        RET_(ERROR_HANDLES_CLOSED, 676);
-        RET_(ERROR_EXTRANEOUS_INFORMATION, 677);
-        RET_(ERROR_RXACT_COMMIT_NECESSARY, 678);
-        RET_(ERROR_MEDIA_CHECK, 679);
-        RET_(ERROR_GUID_SUBSTITUTION_MADE, 680);
-        RET_(ERROR_STOPPED_ON_SYMLINK, 681);
-        RET_(ERROR_LONGJUMP, 682);
-        RET_(ERROR_PLUGPLAY_QUERY_VETOED, 683);
-        RET_(ERROR_UNWIND_CONSOLIDATE, 684);
-        RET_(ERROR_REGISTRY_HIVE_RECOVERED, 685);
-        RET_(ERROR_DLL_MIGHT_BE_INSECURE, 686);
-        RET_(ERROR_DLL_MIGHT_BE_INCOMPATIBLE, 687);
-        RET_(ERROR_DBG_EXCEPTION_NOT_HANDLED, 688);
-        RET_(ERROR_DBG_REPLY_LATER, 689);
-        RET_(ERROR_DBG_UNABLE_TO_PROVIDE_HANDLE, 690);
-        RET_(ERROR_DBG_TERMINATE_THREAD, 691);
-        RET_(ERROR_DBG_TERMINATE_PROCESS, 692);
-        RET_(ERROR_DBG_CONTROL_C, 693);
-        RET_(ERROR_DBG_PRINTEXCEPTION_C, 694);
-        RET_(ERROR_DBG_RIPEXCEPTION, 695);
-        RET_(ERROR_DBG_CONTROL_BREAK, 696);
-        RET_(ERROR_DBG_COMMAND_EXCEPTION, 697);
-        RET_(ERROR_OBJECT_NAME_EXISTS, 698);
-        RET_(ERROR_THREAD_WAS_SUSPENDED, 699);
-        RET_(ERROR_IMAGE_NOT_AT_BASE, 700);
-        RET_(ERROR_RXACT_STATE_CREATED, 701);
-        RET_(ERROR_SEGMENT_NOTIFICATION, 702);
-        RET_(ERROR_BAD_CURRENT_DIRECTORY, 703);
-        RET_(ERROR_FT_READ_RECOVERY_FROM_BACKUP, 704);
-        RET_(ERROR_FT_WRITE_RECOVERY, 705);
-        RET_(ERROR_IMAGE_MACHINE_TYPE_MISMATCH, 706);
-        RET_(ERROR_RECEIVE_PARTIAL, 707);
-        RET_(ERROR_RECEIVE_EXPEDITED, 708);
-        RET_(ERROR_RECEIVE_PARTIAL_EXPEDITED, 709);
-        RET_(ERROR_EVENT_DONE, 710);
-        RET_(ERROR_EVENT_PENDING, 711);
-        RET_(ERROR_CHECKING_FILE_SYSTEM, 712);
-        RET_(ERROR_FATAL_APP_EXIT, 713);
-        RET_(ERROR_PREDEFINED_HANDLE, 714);
-        RET_(ERROR_WAS_UNLOCKED, 715);
-        RET_(ERROR_SERVICE_NOTIFICATION, 716);
-        RET_(ERROR_WAS_LOCKED, 717);
-        RET_(ERROR_LOG_HARD_ERROR, 718);
-        RET_(ERROR_ALREADY_WIN32, 719);
-        RET_(ERROR_IMAGE_MACHINE_TYPE_MISMATCH_EXE, 720);
-        RET_(ERROR_NO_YIELD_PERFORMED, 721);
-        RET_(ERROR_TIMER_RESUME_IGNORED, 722);
-        RET_(ERROR_ARBITRATION_UNHANDLED, 723);
-        RET_(ERROR_CARDBUS_NOT_SUPPORTED, 724);
-        RET_(ERROR_MP_PROCESSOR_MISMATCH, 725);
-        RET_(ERROR_HIBERNATED, 726);
-        RET_(ERROR_RESUME_HIBERNATION, 727);
-        RET_(ERROR_FIRMWARE_UPDATED, 728);
-        RET_(ERROR_DRIVERS_LEAKING_LOCKED_PAGES, 729);
-        RET_(ERROR_WAKE_SYSTEM, 730);
-        RET_(ERROR_WAIT_1, 731);
-        RET_(ERROR_WAIT_2, 732);
-        RET_(ERROR_WAIT_3, 733);
-        RET_(ERROR_WAIT_63, 734);
-        RET_(ERROR_ABANDONED_WAIT_0, 735);
-        RET_(ERROR_ABANDONED_WAIT_63, 736);
-        RET_(ERROR_USER_APC, 737);
-        RET_(ERROR_KERNEL_APC, 738);
-        RET_(ERROR_ALERTED, 739);
-        RET_(ERROR_ELEVATION_REQUIRED, 740);
-        RET_(ERROR_REPARSE, 741);
-        RET_(ERROR_OPLOCK_BREAK_IN_PROGRESS, 742);
-        RET_(ERROR_VOLUME_MOUNTED, 743);
-        RET_(ERROR_RXACT_COMMITTED, 744);
-        RET_(ERROR_NOTIFY_CLEANUP, 745);
-        RET_(ERROR_PRIMARY_TRANSPORT_CONNECT_FAILED, 746);
-        RET_(ERROR_PAGE_FAULT_TRANSITION, 747);
-        RET_(ERROR_PAGE_FAULT_DEMAND_ZERO, 748);
-        RET_(ERROR_PAGE_FAULT_COPY_ON_WRITE, 749);
-        RET_(ERROR_PAGE_FAULT_GUARD_PAGE, 750);
-        RET_(ERROR_PAGE_FAULT_PAGING_FILE, 751);
-        RET_(ERROR_CACHE_PAGE_LOCKED, 752);
-        RET_(ERROR_CRASH_DUMP, 753);
-        RET_(ERROR_BUFFER_ALL_ZEROS, 754);
-        RET_(ERROR_REPARSE_OBJECT, 755);
-        RET_(ERROR_RESOURCE_REQUIREMENTS_CHANGED, 756);
-        RET_(ERROR_TRANSLATION_COMPLETE, 757);
-        RET_(ERROR_NOTHING_TO_TERMINATE, 758);
-        RET_(ERROR_PROCESS_NOT_IN_JOB, 759);
-        RET_(ERROR_PROCESS_IN_JOB, 760);
-        RET_(ERROR_VOLSNAP_HIBERNATE_READY, 761);
-        RET_(ERROR_FSFILTER_OP_COMPLETED_SUCCESSFULLY, 762);
-        RET_(ERROR_INTERRUPT_VECTOR_ALREADY_CONNECTED, 763);
-        RET_(ERROR_INTERRUPT_STILL_CONNECTED, 764);
-        RET_(ERROR_WAIT_FOR_OPLOCK, 765);
-        RET_(ERROR_DBG_EXCEPTION_HANDLED, 766);
-        RET_(ERROR_DBG_CONTINUE, 767);
-        RET_(ERROR_CALLBACK_POP_STACK, 768);
-        RET_(ERROR_COMPRESSION_DISABLED, 769);
-        RET_(ERROR_CANTFETCHBACKWARDS, 770);
-        RET_(ERROR_CANTSCROLLBACKWARDS, 771);
-        RET_(ERROR_ROWSNOTRELEASED, 772);
-        RET_(ERROR_BAD_ACCESSOR_FLAGS, 773);
-        RET_(ERROR_ERRORS_ENCOUNTERED, 774);
-        RET_(ERROR_NOT_CAPABLE, 775);
-        RET_(ERROR_REQUEST_OUT_OF_SEQUENCE, 776);
-        RET_(ERROR_VERSION_PARSE_ERROR, 777);
-        RET_(ERROR_BADSTARTPOSITION, 778);
-        RET_(ERROR_MEMORY_HARDWARE, 779);
-        RET_(ERROR_DISK_REPAIR_DISABLED, 780);
-        RET_(ERROR_INSUFFICIENT_RESOURCE_FOR_SPECIFIED_SHARED_SECTION_SIZE, 781);
-        RET_(ERROR_SYSTEM_POWERSTATE_TRANSITION, 782);
-        RET_(ERROR_SYSTEM_POWERSTATE_COMPLEX_TRANSITION, 783);
-        RET_(ERROR_MCA_EXCEPTION, 784);
-        RET_(ERROR_ACCESS_AUDIT_BY_POLICY, 785);
-        RET_(ERROR_ACCESS_DISABLED_NO_SAFER_UI_BY_POLICY, 786);
-        RET_(ERROR_ABANDON_HIBERFILE, 787);
-        RET_(ERROR_LOST_WRITEBEHIND_DATA_NETWORK_DISCONNECTED, 788);
-        RET_(ERROR_LOST_WRITEBEHIND_DATA_NETWORK_SERVER_ERROR, 789);
-        RET_(ERROR_LOST_WRITEBEHIND_DATA_LOCAL_DISK_ERROR, 790);
-        RET_(ERROR_BAD_MCFG_TABLE, 791);
-        RET_(ERROR_DISK_REPAIR_REDIRECTED, 792);
-        RET_(ERROR_DISK_REPAIR_UNSUCCESSFUL, 793);
-        RET_(ERROR_CORRUPT_LOG_OVERFULL, 794);
-        RET_(ERROR_CORRUPT_LOG_CORRUPTED, 795);
-        RET_(ERROR_CORRUPT_LOG_UNAVAILABLE, 796);
-        RET_(ERROR_CORRUPT_LOG_DELETED_FULL, 797);
-        RET_(ERROR_CORRUPT_LOG_CLEARED, 798);
-        RET_(ERROR_ORPHAN_NAME_EXHAUSTED, 799);
-        RET_(ERROR_OPLOCK_SWITCHED_TO_NEW_HANDLE, 800);
-        RET_(ERROR_CANNOT_GRANT_REQUESTED_OPLOCK, 801);
-        RET_(ERROR_CANNOT_BREAK_OPLOCK, 802);
-        RET_(ERROR_OPLOCK_HANDLE_CLOSED, 803);
-        RET_(ERROR_NO_ACE_CONDITION, 804);
-        RET_(ERROR_INVALID_ACE_CONDITION, 805);
-        RET_(ERROR_FILE_HANDLE_REVOKED, 806);
-        RET_(ERROR_IMAGE_AT_DIFFERENT_BASE, 807);
-        RET_(ERROR_ENCRYPTED_IO_NOT_POSSIBLE, 808);
-        RET_(ERROR_FILE_METADATA_OPTIMIZATION_IN_PROGRESS, 809);
-        RET_(ERROR_QUOTA_ACTIVITY, 810);
-        RET_(ERROR_HANDLE_REVOKED, 811);
-        RET_(ERROR_CALLBACK_INVOKE_INLINE, 812);
-        RET_(ERROR_CPU_SET_INVALID, 813);
-        RET_(ERROR_ENCLAVE_NOT_TERMINATED, 814);
-        RET_(ERROR_ENCLAVE_VIOLATION, 815);
-        RET_(ERROR_SERVER_TRANSPORT_CONFLICT, 816);
-        RET_(ERROR_CERTIFICATE_VALIDATION_PREFERENCE_CONFLICT, 817);
-        RET_(ERROR_FT_READ_FROM_COPY_FAILURE, 818);
-        RET_(ERROR_SECTION_DIRECT_MAP_ONLY, 819);
-        RET_(ERROR_EA_ACCESS_DENIED, 994);
-        RET_(ERROR_OPERATION_ABORTED, 995);
-        RET_(ERROR_IO_INCOMPLETE, 996);
-        RET_(ERROR_IO_PENDING, 997);
-        RET_(ERROR_NOACCESS, 998);
-        RET_(ERROR_SWAPERROR, 999);
-        RET_(ERROR_STACK_OVERFLOW, 1001);
-        RET_(ERROR_INVALID_MESSAGE, 1002);
-        RET_(ERROR_CAN_NOT_COMPLETE, 1003);
-        RET_(ERROR_INVALID_FLAGS, 1004);
-        RET_(ERROR_UNRECOGNIZED_VOLUME, 1005);
-        RET_(ERROR_FILE_INVALID, 1006);
-        RET_(ERROR_FULLSCREEN_MODE, 1007);
-        RET_(ERROR_NO_TOKEN, 1008);
-        RET_(ERROR_BADDB, 1009);
-        RET_(ERROR_BADKEY, 1010);
-        RET_(ERROR_CANTOPEN, 1011);
-        RET_(ERROR_CANTREAD, 1012);
-        RET_(ERROR_CANTWRITE, 1013);
-        RET_(ERROR_REGISTRY_RECOVERED, 1014);
-        RET_(ERROR_REGISTRY_CORRUPT, 1015);
-        RET_(ERROR_REGISTRY_IO_FAILED, 1016);
-        RET_(ERROR_NOT_REGISTRY_FILE, 1017);
-        RET_(ERROR_KEY_DELETED, 1018);
-        RET_(ERROR_NO_LOG_SPACE, 1019);
-        RET_(ERROR_KEY_HAS_CHILDREN, 1020);
-        RET_(ERROR_CHILD_MUST_BE_VOLATILE, 1021);
-        RET_(ERROR_NOTIFY_ENUM_DIR, 1022);
-        RET_(ERROR_DEPENDENT_SERVICES_RUNNING, 1051);
-        RET_(ERROR_INVALID_SERVICE_CONTROL, 1052);
-        RET_(ERROR_SERVICE_REQUEST_TIMEOUT, 1053);
-        RET_(ERROR_SERVICE_NO_THREAD, 1054);
-        RET_(ERROR_SERVICE_DATABASE_LOCKED, 1055);
-        RET_(ERROR_SERVICE_ALREADY_RUNNING, 1056);
-        RET_(ERROR_INVALID_SERVICE_ACCOUNT, 1057);
-        RET_(ERROR_SERVICE_DISABLED, 1058);
-        RET_(ERROR_CIRCULAR_DEPENDENCY, 1059);
-        RET_(ERROR_SERVICE_DOES_NOT_EXIST, 1060);
-        RET_(ERROR_SERVICE_CANNOT_ACCEPT_CTRL, 1061);
-        RET_(ERROR_SERVICE_NOT_ACTIVE, 1062);
-        RET_(ERROR_FAILED_SERVICE_CONTROLLER_CONNECT, 1063);
-        RET_(ERROR_EXCEPTION_IN_SERVICE, 1064);
-        RET_(ERROR_DATABASE_DOES_NOT_EXIST, 1065);
-        RET_(ERROR_SERVICE_SPECIFIC_ERROR, 1066);
-        RET_(ERROR_PROCESS_ABORTED, 1067);
-        RET_(ERROR_SERVICE_DEPENDENCY_FAIL, 1068);
-        RET_(ERROR_SERVICE_LOGON_FAILED, 1069);
-        RET_(ERROR_SERVICE_START_HANG, 1070);
-        RET_(ERROR_INVALID_SERVICE_LOCK, 1071);
-        RET_(ERROR_SERVICE_MARKED_FOR_DELETE, 1072);
-        RET_(ERROR_SERVICE_EXISTS, 1073);
-        RET_(ERROR_ALREADY_RUNNING_LKG, 1074);
-        RET_(ERROR_SERVICE_DEPENDENCY_DELETED, 1075);
-        RET_(ERROR_BOOT_ALREADY_ACCEPTED, 1076);
-        RET_(ERROR_SERVICE_NEVER_STARTED, 1077);
-        RET_(ERROR_DUPLICATE_SERVICE_NAME, 1078);
-        RET_(ERROR_DIFFERENT_SERVICE_ACCOUNT, 1079);
-        RET_(ERROR_CANNOT_DETECT_DRIVER_FAILURE, 1080);
-        RET_(ERROR_CANNOT_DETECT_PROCESS_ABORT, 1081);
-        RET_(ERROR_NO_RECOVERY_PROGRAM, 1082);
-        RET_(ERROR_SERVICE_NOT_IN_EXE, 1083);
-        RET_(ERROR_NOT_SAFEBOOT_SERVICE, 1084);
-        RET_(ERROR_END_OF_MEDIA, 1100);
-        RET_(ERROR_FILEMARK_DETECTED, 1101);
-        RET_(ERROR_BEGINNING_OF_MEDIA, 1102);
-        RET_(ERROR_SETMARK_DETECTED, 1103);
-        RET_(ERROR_NO_DATA_DETECTED, 1104);
-        RET_(ERROR_PARTITION_FAILURE, 1105);
-        RET_(ERROR_INVALID_BLOCK_LENGTH, 1106);
-        RET_(ERROR_DEVICE_NOT_PARTITIONED, 1107);
-        RET_(ERROR_UNABLE_TO_LOCK_MEDIA, 1108);
-        RET_(ERROR_UNABLE_TO_UNLOAD_MEDIA, 1109);
-        RET_(ERROR_MEDIA_CHANGED, 1110);
-        RET_(ERROR_BUS_RESET, 1111);
-        RET_(ERROR_NO_MEDIA_IN_DRIVE, 1112);
-        RET_(ERROR_NO_UNICODE_TRANSLATION, 1113);
-        RET_(ERROR_DLL_INIT_FAILED, 1114);
-        RET_(ERROR_SHUTDOWN_IN_PROGRESS, 1115);
-        RET_(ERROR_NO_SHUTDOWN_IN_PROGRESS, 1116);
-        RET_(ERROR_IO_DEVICE, 1117);
-        RET_(ERROR_SERIAL_NO_DEVICE, 1118);
-        RET_(ERROR_IRQ_BUSY, 1119);
-        RET_(ERROR_MORE_WRITES, 1120);
-        RET_(ERROR_COUNTER_TIMEOUT, 1121);
-        RET_(ERROR_FLOPPY_ID_MARK_NOT_FOUND, 1122);
-        RET_(ERROR_FLOPPY_WRONG_CYLINDER, 1123);
-        RET_(ERROR_FLOPPY_UNKNOWN_ERROR, 1124);
-        RET_(ERROR_FLOPPY_BAD_REGISTERS, 1125);
-        RET_(ERROR_DISK_RECALIBRATE_FAILED, 1126);
-        RET_(ERROR_DISK_OPERATION_FAILED, 1127);
-        RET_(ERROR_DISK_RESET_FAILED, 1128);
-        RET_(ERROR_EOM_OVERFLOW, 1129);
-        RET_(ERROR_NOT_ENOUGH_SERVER_MEMORY, 1130);
-        RET_(ERROR_POSSIBLE_DEADLOCK, 1131);
-        RET_(ERROR_MAPPED_ALIGNMENT, 1132);
-        RET_(ERROR_SET_POWER_STATE_VETOED, 1140);
-        RET_(ERROR_SET_POWER_STATE_FAILED, 1141);
-        RET_(ERROR_TOO_MANY_LINKS, 1142);
-        RET_(ERROR_OLD_WIN_VERSION, 1150);
-        RET_(ERROR_APP_WRONG_OS, 1151);
-        RET_(ERROR_SINGLE_INSTANCE_APP, 1152);
-        RET_(ERROR_RMODE_APP, 1153);
-        RET_(ERROR_INVALID_DLL, 1154);
-        RET_(ERROR_NO_ASSOCIATION, 1155);
-        RET_(ERROR_DDE_FAIL, 1156);
-        RET_(ERROR_DLL_NOT_FOUND, 1157);
-        RET_(ERROR_NO_MORE_USER_HANDLES, 1158);
-        RET_(ERROR_MESSAGE_SYNC_ONLY, 1159);
-        RET_(ERROR_SOURCE_ELEMENT_EMPTY, 1160);
-        RET_(ERROR_DESTINATION_ELEMENT_FULL, 1161);
-        RET_(ERROR_ILLEGAL_ELEMENT_ADDRESS, 1162);
-        RET_(ERROR_MAGAZINE_NOT_PRESENT, 1163);
-        RET_(ERROR_DEVICE_REINITIALIZATION_NEEDED, 1164);
-        RET_(ERROR_DEVICE_REQUIRES_CLEANING, 1165);
-        RET_(ERROR_DEVICE_DOOR_OPEN, 1166);
-        RET_(ERROR_DEVICE_NOT_CONNECTED, 1167);
-        RET_(ERROR_NOT_FOUND, 1168);
-        RET_(ERROR_NO_MATCH, 1169);
-        RET_(ERROR_SET_NOT_FOUND, 1170);
-        RET_(ERROR_POINT_NOT_FOUND, 1171);
-        RET_(ERROR_NO_TRACKING_SERVICE, 1172);
-        RET_(ERROR_NO_VOLUME_ID, 1173);
-        RET_(ERROR_UNABLE_TO_REMOVE_REPLACED, 1175);
-        RET_(ERROR_UNABLE_TO_MOVE_REPLACEMENT, 1176);
-        RET_(ERROR_UNABLE_TO_MOVE_REPLACEMENT_2, 1177);
-        RET_(ERROR_JOURNAL_DELETE_IN_PROGRESS, 1178);
-        RET_(ERROR_JOURNAL_NOT_ACTIVE, 1179);
-        RET_(ERROR_POTENTIAL_FILE_FOUND, 1180);
-        RET_(ERROR_JOURNAL_ENTRY_DELETED, 1181);
-        RET_(ERROR_PARTITION_TERMINATING, 1184);
-        RET_(ERROR_SHUTDOWN_IS_SCHEDULED, 1190);
-        RET_(ERROR_SHUTDOWN_USERS_LOGGED_ON, 1191);
-        RET_(ERROR_SHUTDOWN_DISKS_NOT_IN_MAINTENANCE_MODE, 1192);
-        RET_(ERROR_BAD_DEVICE, 1200);
-        RET_(ERROR_CONNECTION_UNAVAIL, 1201);
-        RET_(ERROR_DEVICE_ALREADY_REMEMBERED, 1202);
-        RET_(ERROR_NO_NET_OR_BAD_PATH, 1203);
-        RET_(ERROR_BAD_PROVIDER, 1204);
-        RET_(ERROR_CANNOT_OPEN_PROFILE, 1205);
-        RET_(ERROR_BAD_PROFILE, 1206);
-        RET_(ERROR_NOT_CONTAINER, 1207);
-        RET_(ERROR_EXTENDED_ERROR, 1208);
-        RET_(ERROR_INVALID_GROUPNAME, 1209);
-        RET_(ERROR_INVALID_COMPUTERNAME, 1210);
-        RET_(ERROR_INVALID_EVENTNAME, 1211);
-        RET_(ERROR_INVALID_DOMAINNAME, 1212);
-        RET_(ERROR_INVALID_SERVICENAME, 1213);
-        RET_(ERROR_INVALID_NETNAME, 1214);
-        RET_(ERROR_INVALID_SHARENAME, 1215);
-        RET_(ERROR_INVALID_PASSWORDNAME, 1216);
-        RET_(ERROR_INVALID_MESSAGENAME, 1217);
-        RET_(ERROR_INVALID_MESSAGEDEST, 1218);
-        RET_(ERROR_SESSION_CREDENTIAL_CONFLICT, 1219);
-        RET_(ERROR_REMOTE_SESSION_LIMIT_EXCEEDED, 1220);
-        RET_(ERROR_DUP_DOMAINNAME, 1221);
-        RET_(ERROR_NO_NETWORK, 1222);
-        RET_(ERROR_CANCELLED, 1223);
-        RET_(ERROR_USER_MAPPED_FILE, 1224);
-        RET_(ERROR_CONNECTION_REFUSED, 1225);
-        RET_(ERROR_GRACEFUL_DISCONNECT, 1226);
-        RET_(ERROR_ADDRESS_ALREADY_ASSOCIATED, 1227);
-        RET_(ERROR_ADDRESS_NOT_ASSOCIATED, 1228);
-        RET_(ERROR_CONNECTION_INVALID, 1229);
-        RET_(ERROR_CONNECTION_ACTIVE, 1230);
-        RET_(ERROR_NETWORK_UNREACHABLE, 1231);
-        RET_(ERROR_HOST_UNREACHABLE, 1232);
-        RET_(ERROR_PROTOCOL_UNREACHABLE, 1233);
-        RET_(ERROR_PORT_UNREACHABLE, 1234);
-        RET_(ERROR_REQUEST_ABORTED, 1235);
-        RET_(ERROR_CONNECTION_ABORTED, 1236);
-        RET_(ERROR_RETRY, 1237);
-        RET_(ERROR_CONNECTION_COUNT_LIMIT, 1238);
-        RET_(ERROR_LOGIN_TIME_RESTRICTION, 1239);
-        RET_(ERROR_LOGIN_WKSTA_RESTRICTION, 1240);
-        RET_(ERROR_INCORRECT_ADDRESS, 1241);
-        RET_(ERROR_ALREADY_REGISTERED, 1242);
-        RET_(ERROR_SERVICE_NOT_FOUND, 1243);
-        RET_(ERROR_NOT_AUTHENTICATED, 1244);
-        RET_(ERROR_NOT_LOGGED_ON, 1245);
-        RET_(ERROR_CONTINUE, 1246);
-        RET_(ERROR_ALREADY_INITIALIZED, 1247);
-        RET_(ERROR_NO_MORE_DEVICES, 1248);
-        RET_(ERROR_NO_SUCH_SITE, 1249);
-        RET_(ERROR_DOMAIN_CONTROLLER_EXISTS, 1250);
-        RET_(ERROR_ONLY_IF_CONNECTED, 1251);
-        RET_(ERROR_OVERRIDE_NOCHANGES, 1252);
-        RET_(ERROR_BAD_USER_PROFILE, 1253);
-        RET_(ERROR_NOT_SUPPORTED_ON_SBS, 1254);
-        RET_(ERROR_SERVER_SHUTDOWN_IN_PROGRESS, 1255);
-        RET_(ERROR_HOST_DOWN, 1256);
-        RET_(ERROR_NON_ACCOUNT_SID, 1257);
-        RET_(ERROR_NON_DOMAIN_SID, 1258);
-        RET_(ERROR_APPHELP_BLOCK, 1259);
-        RET_(ERROR_ACCESS_DISABLED_BY_POLICY, 1260);
-        RET_(ERROR_REG_NAT_CONSUMPTION, 1261);
-        RET_(ERROR_CSCSHARE_OFFLINE, 1262);
-        RET_(ERROR_PKINIT_FAILURE, 1263);
-        RET_(ERROR_SMARTCARD_SUBSYSTEM_FAILURE, 1264);
-        RET_(ERROR_DOWNGRADE_DETECTED, 1265);
-        RET_(ERROR_MACHINE_LOCKED, 1271);
-        RET_(ERROR_SMB_GUEST_LOGON_BLOCKED, 1272);
-        RET_(ERROR_CALLBACK_SUPPLIED_INVALID_DATA, 1273);
-        RET_(ERROR_SYNC_FOREGROUND_REFRESH_REQUIRED, 1274);
-        RET_(ERROR_DRIVER_BLOCKED, 1275);
-        RET_(ERROR_INVALID_IMPORT_OF_NON_DLL, 1276);
-        RET_(ERROR_ACCESS_DISABLED_WEBBLADE, 1277);
-        RET_(ERROR_ACCESS_DISABLED_WEBBLADE_TAMPER, 1278);
-        RET_(ERROR_RECOVERY_FAILURE, 1279);
-        RET_(ERROR_ALREADY_FIBER, 1280);
-        RET_(ERROR_ALREADY_THREAD, 1281);
-        RET_(ERROR_STACK_BUFFER_OVERRUN, 1282);
-        RET_(ERROR_PARAMETER_QUOTA_EXCEEDED, 1283);
-        RET_(ERROR_DEBUGGER_INACTIVE, 1284);
-        RET_(ERROR_DELAY_LOAD_FAILED, 1285);
-        RET_(ERROR_VDM_DISALLOWED, 1286);
-        RET_(ERROR_UNIDENTIFIED_ERROR, 1287);
-        RET_(ERROR_INVALID_CRUNTIME_PARAMETER, 1288);
-        RET_(ERROR_BEYOND_VDL, 1289);
-        RET_(ERROR_INCOMPATIBLE_SERVICE_SID_TYPE, 1290);
-        RET_(ERROR_DRIVER_PROCESS_TERMINATED, 1291);
-        RET_(ERROR_IMPLEMENTATION_LIMIT, 1292);
-        RET_(ERROR_PROCESS_IS_PROTECTED, 1293);
-        RET_(ERROR_SERVICE_NOTIFY_CLIENT_LAGGING, 1294);
-        RET_(ERROR_DISK_QUOTA_EXCEEDED, 1295);
-        RET_(ERROR_CONTENT_BLOCKED, 1296);
-        RET_(ERROR_INCOMPATIBLE_SERVICE_PRIVILEGE, 1297);
-        RET_(ERROR_APP_HANG, 1298);
-        RET_(ERROR_INVALID_LABEL, 1299);
-        RET_(ERROR_NOT_ALL_ASSIGNED, 1300);
-        RET_(ERROR_SOME_NOT_MAPPED, 1301);
-        RET_(ERROR_NO_QUOTAS_FOR_ACCOUNT, 1302);
-        RET_(ERROR_LOCAL_USER_SESSION_KEY, 1303);
-        RET_(ERROR_NULL_LM_PASSWORD, 1304);
-        RET_(ERROR_UNKNOWN_REVISION, 1305);
-        RET_(ERROR_REVISION_MISMATCH, 1306);
-        RET_(ERROR_INVALID_OWNER, 1307);
-        RET_(ERROR_INVALID_PRIMARY_GROUP, 1308);
-        RET_(ERROR_NO_IMPERSONATION_TOKEN, 1309);
-        RET_(ERROR_CANT_DISABLE_MANDATORY, 1310);
-        RET_(ERROR_NO_LOGON_SERVERS, 1311);
-        RET_(ERROR_NO_SUCH_LOGON_SESSION, 1312);
-        RET_(ERROR_NO_SUCH_PRIVILEGE, 1313);
-        RET_(ERROR_PRIVILEGE_NOT_HELD, 1314);
-        RET_(ERROR_INVALID_ACCOUNT_NAME, 1315);
-        RET_(ERROR_USER_EXISTS, 1316);
-        RET_(ERROR_NO_SUCH_USER, 1317);
-        RET_(ERROR_GROUP_EXISTS, 1318);
-        RET_(ERROR_NO_SUCH_GROUP, 1319);
-        RET_(ERROR_MEMBER_IN_GROUP, 1320);
-        RET_(ERROR_MEMBER_NOT_IN_GROUP, 1321);
-        RET_(ERROR_LAST_ADMIN, 1322);
-        RET_(ERROR_WRONG_PASSWORD, 1323);
-        RET_(ERROR_ILL_FORMED_PASSWORD, 1324);
-        RET_(ERROR_PASSWORD_RESTRICTION, 1325);
-        RET_(ERROR_LOGON_FAILURE, 1326);
-        RET_(ERROR_ACCOUNT_RESTRICTION, 1327);
-        RET_(ERROR_INVALID_LOGON_HOURS, 1328);
-        RET_(ERROR_INVALID_WORKSTATION, 1329);
-        RET_(ERROR_PASSWORD_EXPIRED, 1330);
-        RET_(ERROR_ACCOUNT_DISABLED, 1331);
-        RET_(ERROR_NONE_MAPPED, 1332);
-        RET_(ERROR_TOO_MANY_LUIDS_REQUESTED, 1333);
-        RET_(ERROR_LUIDS_EXHAUSTED, 1334);
-        RET_(ERROR_INVALID_SUB_AUTHORITY, 1335);
-        RET_(ERROR_INVALID_ACL, 1336);
-        RET_(ERROR_INVALID_SID, 1337);
-        RET_(ERROR_INVALID_SECURITY_DESCR, 1338);
-        RET_(ERROR_BAD_INHERITANCE_ACL, 1340);
-        RET_(ERROR_SERVER_DISABLED, 1341);
-        RET_(ERROR_SERVER_NOT_DISABLED, 1342);
-        RET_(ERROR_INVALID_ID_AUTHORITY, 1343);
-        RET_(ERROR_ALLOTTED_SPACE_EXCEEDED, 1344);
-        RET_(ERROR_INVALID_GROUP_ATTRIBUTES, 1345);
-        RET_(ERROR_BAD_IMPERSONATION_LEVEL, 1346);
-        RET_(ERROR_CANT_OPEN_ANONYMOUS, 1347);
-        RET_(ERROR_BAD_VALIDATION_CLASS, 1348);
-        RET_(ERROR_BAD_TOKEN_TYPE, 1349);
-        RET_(ERROR_NO_SECURITY_ON_OBJECT, 1350);
-        RET_(ERROR_CANT_ACCESS_DOMAIN_INFO, 1351);
-        RET_(ERROR_INVALID_SERVER_STATE, 1352);
-        RET_(ERROR_INVALID_DOMAIN_STATE, 1353);
-        RET_(ERROR_INVALID_DOMAIN_ROLE, 1354);
-        RET_(ERROR_NO_SUCH_DOMAIN, 1355);
-        RET_(ERROR_DOMAIN_EXISTS, 1356);
-        RET_(ERROR_DOMAIN_LIMIT_EXCEEDED, 1357);
-        RET_(ERROR_INTERNAL_DB_CORRUPTION, 1358);
-        RET_(ERROR_INTERNAL_ERROR, 1359);
-        RET_(ERROR_GENERIC_NOT_MAPPED, 1360);
-        RET_(ERROR_BAD_DESCRIPTOR_FORMAT, 1361);
-        RET_(ERROR_NOT_LOGON_PROCESS, 1362);
-        RET_(ERROR_LOGON_SESSION_EXISTS, 1363);
-        RET_(ERROR_NO_SUCH_PACKAGE, 1364);
-        RET_(ERROR_BAD_LOGON_SESSION_STATE, 1365);
-        RET_(ERROR_LOGON_SESSION_COLLISION, 1366);
-        RET_(ERROR_INVALID_LOGON_TYPE, 1367);
-        RET_(ERROR_CANNOT_IMPERSONATE, 1368);
-        RET_(ERROR_RXACT_INVALID_STATE, 1369);
-        RET_(ERROR_RXACT_COMMIT_FAILURE, 1370);
-        RET_(ERROR_SPECIAL_ACCOUNT, 1371);
-        RET_(ERROR_SPECIAL_GROUP, 1372);
-        RET_(ERROR_SPECIAL_USER, 1373);
-        RET_(ERROR_MEMBERS_PRIMARY_GROUP, 1374);
-        RET_(ERROR_TOKEN_ALREADY_IN_USE, 1375);
-        RET_(ERROR_NO_SUCH_ALIAS, 1376);
-        RET_(ERROR_MEMBER_NOT_IN_ALIAS, 1377);
-        RET_(ERROR_MEMBER_IN_ALIAS, 1378);
-        RET_(ERROR_ALIAS_EXISTS, 1379);
-        RET_(ERROR_LOGON_NOT_GRANTED, 1380);
-        RET_(ERROR_TOO_MANY_SECRETS, 1381);
-        RET_(ERROR_SECRET_TOO_LONG, 1382);
-        RET_(ERROR_INTERNAL_DB_ERROR, 1383);
-        RET_(ERROR_TOO_MANY_CONTEXT_IDS, 1384);
-        RET_(ERROR_LOGON_TYPE_NOT_GRANTED, 1385);
-        RET_(ERROR_NT_CROSS_ENCRYPTION_REQUIRED, 1386);
-        RET_(ERROR_NO_SUCH_MEMBER, 1387);
-        RET_(ERROR_INVALID_MEMBER, 1388);
-        RET_(ERROR_TOO_MANY_SIDS, 1389);
-        RET_(ERROR_LM_CROSS_ENCRYPTION_REQUIRED, 1390);
-        RET_(ERROR_NO_INHERITANCE, 1391);
-        RET_(ERROR_FILE_CORRUPT, 1392);
-        RET_(ERROR_DISK_CORRUPT, 1393);
-        RET_(ERROR_NO_USER_SESSION_KEY, 1394);
-        RET_(ERROR_LICENSE_QUOTA_EXCEEDED, 1395);
-        RET_(ERROR_WRONG_TARGET_NAME, 1396);
-        RET_(ERROR_MUTUAL_AUTH_FAILED, 1397);
-        RET_(ERROR_TIME_SKEW, 1398);
-        RET_(ERROR_CURRENT_DOMAIN_NOT_ALLOWED, 1399);
-        RET_(ERROR_INVALID_WINDOW_HANDLE, 1400);
-        RET_(ERROR_INVALID_MENU_HANDLE, 1401);
-        RET_(ERROR_INVALID_CURSOR_HANDLE, 1402);
-        RET_(ERROR_INVALID_ACCEL_HANDLE, 1403);
-        RET_(ERROR_INVALID_HOOK_HANDLE, 1404);
-        RET_(ERROR_INVALID_DWP_HANDLE, 1405);
-        RET_(ERROR_TLW_WITH_WSCHILD, 1406);
-        RET_(ERROR_CANNOT_FIND_WND_CLASS, 1407);
-        RET_(ERROR_WINDOW_OF_OTHER_THREAD, 1408);
-        RET_(ERROR_HOTKEY_ALREADY_REGISTERED, 1409);
-        RET_(ERROR_CLASS_ALREADY_EXISTS, 1410);
-        RET_(ERROR_CLASS_DOES_NOT_EXIST, 1411);
-        RET_(ERROR_CLASS_HAS_WINDOWS, 1412);
-        RET_(ERROR_INVALID_INDEX, 1413);
-        RET_(ERROR_INVALID_ICON_HANDLE, 1414);
-        RET_(ERROR_PRIVATE_DIALOG_INDEX, 1415);
-        RET_(ERROR_LISTBOX_ID_NOT_FOUND, 1416);
-        RET_(ERROR_NO_WILDCARD_CHARACTERS, 1417);
-        RET_(ERROR_CLIPBOARD_NOT_OPEN, 1418);
-        RET_(ERROR_HOTKEY_NOT_REGISTERED, 1419);
-        RET_(ERROR_WINDOW_NOT_DIALOG, 1420);
-        RET_(ERROR_CONTROL_ID_NOT_FOUND, 1421);
-        RET_(ERROR_INVALID_COMBOBOX_MESSAGE, 1422);
-        RET_(ERROR_WINDOW_NOT_COMBOBOX, 1423);
-        RET_(ERROR_INVALID_EDIT_HEIGHT, 1424);
-        RET_(ERROR_DC_NOT_FOUND, 1425);
-        RET_(ERROR_INVALID_HOOK_FILTER, 1426);
-        RET_(ERROR_INVALID_FILTER_PROC, 1427);
-        RET_(ERROR_HOOK_NEEDS_HMOD, 1428);
-        RET_(ERROR_GLOBAL_ONLY_HOOK, 1429);
-        RET_(ERROR_JOURNAL_HOOK_SET, 1430);
-        RET_(ERROR_HOOK_NOT_INSTALLED, 1431);
-        RET_(ERROR_INVALID_LB_MESSAGE, 1432);
-        RET_(ERROR_SETCOUNT_ON_BAD_LB, 1433);
-        RET_(ERROR_LB_WITHOUT_TABSTOPS, 1434);
-        RET_(ERROR_DESTROY_OBJECT_OF_OTHER_THREAD, 1435);
-        RET_(ERROR_CHILD_WINDOW_MENU, 1436);
-        RET_(ERROR_NO_SYSTEM_MENU, 1437);
-        RET_(ERROR_INVALID_MSGBOX_STYLE, 1438);
-        RET_(ERROR_INVALID_SPI_VALUE, 1439);
-        RET_(ERROR_SCREEN_ALREADY_LOCKED, 1440);
-        RET_(ERROR_HWNDS_HAVE_DIFF_PARENT, 1441);
-        RET_(ERROR_NOT_CHILD_WINDOW, 1442);
-        RET_(ERROR_INVALID_GW_COMMAND, 1443);
-        RET_(ERROR_INVALID_THREAD_ID, 1444);
-        RET_(ERROR_NON_MDICHILD_WINDOW, 1445);
-        RET_(ERROR_POPUP_ALREADY_ACTIVE, 1446);
-        RET_(ERROR_NO_SCROLLBARS, 1447);
-        RET_(ERROR_INVALID_SCROLLBAR_RANGE, 1448);
-        RET_(ERROR_INVALID_SHOWWIN_COMMAND, 1449);
-        RET_(ERROR_NO_SYSTEM_RESOURCES, 1450);
-        RET_(ERROR_NONPAGED_SYSTEM_RESOURCES, 1451);
-        RET_(ERROR_PAGED_SYSTEM_RESOURCES, 1452);
-        RET_(ERROR_WORKING_SET_QUOTA, 1453);
-        RET_(ERROR_PAGEFILE_QUOTA, 1454);
-        RET_(ERROR_COMMITMENT_LIMIT, 1455);
-        RET_(ERROR_MENU_ITEM_NOT_FOUND, 1456);
-        RET_(ERROR_INVALID_KEYBOARD_HANDLE, 1457);
-        RET_(ERROR_HOOK_TYPE_NOT_ALLOWED, 1458);
-        RET_(ERROR_REQUIRES_INTERACTIVE_WINDOWSTATION, 1459);
-        RET_(ERROR_TIMEOUT, 1460);
-        RET_(ERROR_INVALID_MONITOR_HANDLE, 1461);
-        RET_(ERROR_INCORRECT_SIZE, 1462);
-        RET_(ERROR_SYMLINK_CLASS_DISABLED, 1463);
-        RET_(ERROR_SYMLINK_NOT_SUPPORTED, 1464);
-        RET_(ERROR_XML_PARSE_ERROR, 1465);
-        RET_(ERROR_XMLDSIG_ERROR, 1466);
-        RET_(ERROR_RESTART_APPLICATION, 1467);
-        RET_(ERROR_WRONG_COMPARTMENT, 1468);
-        RET_(ERROR_AUTHIP_FAILURE, 1469);
-        RET_(ERROR_NO_NVRAM_RESOURCES, 1470);
-        RET_(ERROR_NOT_GUI_PROCESS, 1471);
-        RET_(ERROR_EVENTLOG_FILE_CORRUPT, 1500);
-        RET_(ERROR_EVENTLOG_CANT_START, 1501);
-        RET_(ERROR_LOG_FILE_FULL, 1502);
-        RET_(ERROR_EVENTLOG_FILE_CHANGED, 1503);
-        RET_(ERROR_CONTAINER_ASSIGNED, 1504);
-        RET_(ERROR_JOB_NO_CONTAINER, 1505);
-        RET_(ERROR_INVALID_TASK_NAME, 1550);
-        RET_(ERROR_INVALID_TASK_INDEX, 1551);
-        RET_(ERROR_THREAD_ALREADY_IN_TASK, 1552);
-        RET_(ERROR_INSTALL_SERVICE_FAILURE, 1601);
-        RET_(ERROR_INSTALL_USEREXIT, 1602);
-        RET_(ERROR_INSTALL_FAILURE, 1603);
-        RET_(ERROR_INSTALL_SUSPEND, 1604);
-        RET_(ERROR_UNKNOWN_PRODUCT, 1605);
-        RET_(ERROR_UNKNOWN_FEATURE, 1606);
-        RET_(ERROR_UNKNOWN_COMPONENT, 1607);
-        RET_(ERROR_UNKNOWN_PROPERTY, 1608);
-        RET_(ERROR_INVALID_HANDLE_STATE, 1609);
-        RET_(ERROR_BAD_CONFIGURATION, 1610);
-        RET_(ERROR_INDEX_ABSENT, 1611);
-        RET_(ERROR_INSTALL_SOURCE_ABSENT, 1612);
-        RET_(ERROR_INSTALL_PACKAGE_VERSION, 1613);
-        RET_(ERROR_PRODUCT_UNINSTALLED, 1614);
-        RET_(ERROR_BAD_QUERY_SYNTAX, 1615);
-        RET_(ERROR_INVALID_FIELD, 1616);
-        RET_(ERROR_DEVICE_REMOVED, 1617);
-        RET_(ERROR_INSTALL_ALREADY_RUNNING, 1618);
-        RET_(ERROR_INSTALL_PACKAGE_OPEN_FAILED, 1619);
-        RET_(ERROR_INSTALL_PACKAGE_INVALID, 1620);
-        RET_(ERROR_INSTALL_UI_FAILURE, 1621);
-        RET_(ERROR_INSTALL_LOG_FAILURE, 1622);
-        RET_(ERROR_INSTALL_LANGUAGE_UNSUPPORTED, 1623);
-        RET_(ERROR_INSTALL_TRANSFORM_FAILURE, 1624);
-        RET_(ERROR_INSTALL_PACKAGE_REJECTED, 1625);
-        RET_(ERROR_FUNCTION_NOT_CALLED, 1626);
-        RET_(ERROR_FUNCTION_FAILED, 1627);
-        RET_(ERROR_INVALID_TABLE, 1628);
-        RET_(ERROR_DATATYPE_MISMATCH, 1629);
-        RET_(ERROR_UNSUPPORTED_TYPE, 1630);
-        RET_(ERROR_CREATE_FAILED, 1631);
-        RET_(ERROR_INSTALL_TEMP_UNWRITABLE, 1632);
-        RET_(ERROR_INSTALL_PLATFORM_UNSUPPORTED, 1633);
-        RET_(ERROR_INSTALL_NOTUSED, 1634);
-        RET_(ERROR_PATCH_PACKAGE_OPEN_FAILED, 1635);
-        RET_(ERROR_PATCH_PACKAGE_INVALID, 1636);
-        RET_(ERROR_PATCH_PACKAGE_UNSUPPORTED, 1637);
-        RET_(ERROR_PRODUCT_VERSION, 1638);
-        RET_(ERROR_INVALID_COMMAND_LINE, 1639);
-        RET_(ERROR_INSTALL_REMOTE_DISALLOWED, 1640);
-        RET_(ERROR_SUCCESS_REBOOT_INITIATED, 1641);
-        RET_(ERROR_PATCH_TARGET_NOT_FOUND, 1642);
-        RET_(ERROR_PATCH_PACKAGE_REJECTED, 1643);
-        RET_(ERROR_INSTALL_TRANSFORM_REJECTED, 1644);
-        RET_(ERROR_INSTALL_REMOTE_PROHIBITED, 1645);
-        RET_(ERROR_PATCH_REMOVAL_UNSUPPORTED, 1646);
-        RET_(ERROR_UNKNOWN_PATCH, 1647);
-        RET_(ERROR_PATCH_NO_SEQUENCE, 1648);
-        RET_(ERROR_PATCH_REMOVAL_DISALLOWED, 1649);
-        RET_(ERROR_INVALID_PATCH_XML, 1650);
-        RET_(ERROR_PATCH_MANAGED_ADVERTISED_PRODUCT, 1651);
-        RET_(ERROR_INSTALL_SERVICE_SAFEBOOT, 1652);
-        RET_(ERROR_FAIL_FAST_EXCEPTION, 1653);
-        RET_(ERROR_INSTALL_REJECTED, 1654);
-        RET_(ERROR_DYNAMIC_CODE_BLOCKED, 1655);
-        RET_(ERROR_NOT_SAME_OBJECT, 1656);
-        RET_(ERROR_STRICT_CFG_VIOLATION, 1657);
-        RET_(ERROR_SET_CONTEXT_DENIED, 1660);
-        RET_(ERROR_CROSS_PARTITION_VIOLATION, 1661);
-        RET_(ERROR_RETURN_ADDRESS_HIJACK_ATTEMPT, 1662);
-        RET_(ERROR_INVALID_USER_BUFFER, 1784);
-        RET_(ERROR_UNRECOGNIZED_MEDIA, 1785);
-        RET_(ERROR_NO_TRUST_LSA_SECRET, 1786);
-        RET_(ERROR_NO_TRUST_SAM_ACCOUNT, 1787);
-        RET_(ERROR_TRUSTED_DOMAIN_FAILURE, 1788);
-        RET_(ERROR_TRUSTED_RELATIONSHIP_FAILURE, 1789);
-        RET_(ERROR_TRUST_FAILURE, 1790);
-        RET_(ERROR_NETLOGON_NOT_STARTED, 1792);
-        RET_(ERROR_ACCOUNT_EXPIRED, 1793);
-        RET_(ERROR_REDIRECTOR_HAS_OPEN_HANDLES, 1794);
-        RET_(ERROR_PRINTER_DRIVER_ALREADY_INSTALLED, 1795);
-        RET_(ERROR_UNKNOWN_PORT, 1796);
-        RET_(ERROR_UNKNOWN_PRINTER_DRIVER, 1797);
-        RET_(ERROR_UNKNOWN_PRINTPROCESSOR, 1798);
-        RET_(ERROR_INVALID_SEPARATOR_FILE, 1799);
-        RET_(ERROR_INVALID_PRIORITY, 1800);
-        RET_(ERROR_INVALID_PRINTER_NAME, 1801);
-        RET_(ERROR_PRINTER_ALREADY_EXISTS, 1802);
-        RET_(ERROR_INVALID_PRINTER_COMMAND, 1803);
-        RET_(ERROR_INVALID_DATATYPE, 1804);
-        RET_(ERROR_INVALID_ENVIRONMENT, 1805);
-        RET_(ERROR_NOLOGON_INTERDOMAIN_TRUST_ACCOUNT, 1807);
-        RET_(ERROR_NOLOGON_WORKSTATION_TRUST_ACCOUNT, 1808);
-        RET_(ERROR_NOLOGON_SERVER_TRUST_ACCOUNT, 1809);
-        RET_(ERROR_DOMAIN_TRUST_INCONSISTENT, 1810);
-        RET_(ERROR_SERVER_HAS_OPEN_HANDLES, 1811);
-        RET_(ERROR_RESOURCE_DATA_NOT_FOUND, 1812);
-        RET_(ERROR_RESOURCE_TYPE_NOT_FOUND, 1813);
-        RET_(ERROR_RESOURCE_NAME_NOT_FOUND, 1814);
-        RET_(ERROR_RESOURCE_LANG_NOT_FOUND, 1815);
-        RET_(ERROR_NOT_ENOUGH_QUOTA, 1816);
-        RET_(ERROR_INVALID_TIME, 1901);
-        RET_(ERROR_INVALID_FORM_NAME, 1902);
-        RET_(ERROR_INVALID_FORM_SIZE, 1903);
-        RET_(ERROR_ALREADY_WAITING, 1904);
-        RET_(ERROR_PRINTER_DELETED, 1905);
-        RET_(ERROR_INVALID_PRINTER_STATE, 1906);
-        RET_(ERROR_PASSWORD_MUST_CHANGE, 1907);
-        RET_(ERROR_DOMAIN_CONTROLLER_NOT_FOUND, 1908);
-        RET_(ERROR_ACCOUNT_LOCKED_OUT, 1909);
-        RET_(ERROR_NO_SITENAME, 1919);
-        RET_(ERROR_CANT_ACCESS_FILE, 1920);
-        RET_(ERROR_CANT_RESOLVE_FILENAME, 1921);
-        RET_(ERROR_KM_DRIVER_BLOCKED, 1930);
-        RET_(ERROR_CONTEXT_EXPIRED, 1931);
-        RET_(ERROR_PER_USER_TRUST_QUOTA_EXCEEDED, 1932);
-        RET_(ERROR_ALL_USER_TRUST_QUOTA_EXCEEDED, 1933);
-        RET_(ERROR_USER_DELETE_TRUST_QUOTA_EXCEEDED, 1934);
-        RET_(ERROR_AUTHENTICATION_FIREWALL_FAILED, 1935);
-        RET_(ERROR_REMOTE_PRINT_CONNECTIONS_BLOCKED, 1936);
-        RET_(ERROR_NTLM_BLOCKED, 1937);
-        RET_(ERROR_PASSWORD_CHANGE_REQUIRED, 1938);
-        RET_(ERROR_LOST_MODE_LOGON_RESTRICTION, 1939);
-        RET_(ERROR_INVALID_PIXEL_FORMAT, 2000);
-        RET_(ERROR_BAD_DRIVER, 2001);
-        RET_(ERROR_INVALID_WINDOW_STYLE, 2002);
-        RET_(ERROR_METAFILE_NOT_SUPPORTED, 2003);
-        RET_(ERROR_TRANSFORM_NOT_SUPPORTED, 2004);
-        RET_(ERROR_CLIPPING_NOT_SUPPORTED, 2005);
-        RET_(ERROR_INVALID_CMM, 2010);
-        RET_(ERROR_INVALID_PROFILE, 2011);
-        RET_(ERROR_TAG_NOT_FOUND, 2012);
-        RET_(ERROR_TAG_NOT_PRESENT, 2013);
-        RET_(ERROR_DUPLICATE_TAG, 2014);
-        RET_(ERROR_PROFILE_NOT_ASSOCIATED_WITH_DEVICE, 2015);
-        RET_(ERROR_PROFILE_NOT_FOUND, 2016);
-        RET_(ERROR_INVALID_COLORSPACE, 2017);
-        RET_(ERROR_ICM_NOT_ENABLED, 2018);
-        RET_(ERROR_DELETING_ICM_XFORM, 2019);
-        RET_(ERROR_INVALID_TRANSFORM, 2020);
-        RET_(ERROR_COLORSPACE_MISMATCH, 2021);
-        RET_(ERROR_INVALID_COLORINDEX, 2022);
-        RET_(ERROR_PROFILE_DOES_NOT_MATCH_DEVICE, 2023);
-        RET_(ERROR_CONNECTED_OTHER_PASSWORD, 2108);
-        RET_(ERROR_CONNECTED_OTHER_PASSWORD_DEFAULT, 2109);
-        RET_(ERROR_BAD_USERNAME, 2202);
-        RET_(ERROR_NOT_CONNECTED, 2250);
-        RET_(ERROR_OPEN_FILES, 2401);
-        RET_(ERROR_ACTIVE_CONNECTIONS, 2402);
-        RET_(ERROR_DEVICE_IN_USE, 2404);
-        RET_(ERROR_UNKNOWN_PRINT_MONITOR, 3000);
-        RET_(ERROR_PRINTER_DRIVER_IN_USE, 3001);
-        RET_(ERROR_SPOOL_FILE_NOT_FOUND, 3002);
-        RET_(ERROR_SPL_NO_STARTDOC, 3003);
-        RET_(ERROR_SPL_NO_ADDJOB, 3004);
-        RET_(ERROR_PRINT_PROCESSOR_ALREADY_INSTALLED, 3005);
-        RET_(ERROR_PRINT_MONITOR_ALREADY_INSTALLED, 3006);
-        RET_(ERROR_INVALID_PRINT_MONITOR, 3007);
-        RET_(ERROR_PRINT_MONITOR_IN_USE, 3008);
-        RET_(ERROR_PRINTER_HAS_JOBS_QUEUED, 3009);
-        RET_(ERROR_SUCCESS_REBOOT_REQUIRED, 3010);
-        RET_(ERROR_SUCCESS_RESTART_REQUIRED, 3011);
-        RET_(ERROR_PRINTER_NOT_FOUND, 3012);
-        RET_(ERROR_PRINTER_DRIVER_WARNED, 3013);
-        RET_(ERROR_PRINTER_DRIVER_BLOCKED, 3014);
-        RET_(ERROR_PRINTER_DRIVER_PACKAGE_IN_USE, 3015);
-        RET_(ERROR_CORE_DRIVER_PACKAGE_NOT_FOUND, 3016);
-        RET_(ERROR_FAIL_REBOOT_REQUIRED, 3017);
-        RET_(ERROR_FAIL_REBOOT_INITIATED, 3018);
-        RET_(ERROR_PRINTER_DRIVER_DOWNLOAD_NEEDED, 3019);
-        RET_(ERROR_PRINT_JOB_RESTART_REQUIRED, 3020);
-        RET_(ERROR_INVALID_PRINTER_DRIVER_MANIFEST, 3021);
-        RET_(ERROR_PRINTER_NOT_SHAREABLE, 3022);
-        RET_(ERROR_REQUEST_PAUSED, 3050);
-        RET_(ERROR_APPEXEC_CONDITION_NOT_SATISFIED, 3060);
-        RET_(ERROR_APPEXEC_HANDLE_INVALIDATED, 3061);
-        RET_(ERROR_APPEXEC_INVALID_HOST_GENERATION, 3062);
-        RET_(ERROR_APPEXEC_UNEXPECTED_PROCESS_REGISTRATION, 3063);
-        RET_(ERROR_APPEXEC_INVALID_HOST_STATE, 3064);
-        RET_(ERROR_APPEXEC_NO_DONOR, 3065);
-        RET_(ERROR_APPEXEC_HOST_ID_MISMATCH, 3066);
-        RET_(ERROR_APPEXEC_UNKNOWN_USER, 3067);
-        RET_(ERROR_APPEXEC_APP_COMPAT_BLOCK, 3068);
-        RET_(ERROR_APPEXEC_CALLER_WAIT_TIMEOUT, 3069);
-        RET_(ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_TERMINATION, 3070);
-        RET_(ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_LICENSING, 3071);
-        RET_(ERROR_APPEXEC_CALLER_WAIT_TIMEOUT_RESOURCES, 3072);
-        RET_(ERROR_VRF_VOLATILE_CFG_AND_IO_ENABLED, 3080);
-        RET_(ERROR_VRF_VOLATILE_NOT_STOPPABLE, 3081);
-        RET_(ERROR_VRF_VOLATILE_SAFE_MODE, 3082);
-        RET_(ERROR_VRF_VOLATILE_NOT_RUNNABLE_SYSTEM, 3083);
-        RET_(ERROR_VRF_VOLATILE_NOT_SUPPORTED_RULECLASS, 3084);
-        RET_(ERROR_VRF_VOLATILE_PROTECTED_DRIVER, 3085);
-        RET_(ERROR_VRF_VOLATILE_NMI_REGISTERED, 3086);
-        RET_(ERROR_VRF_VOLATILE_SETTINGS_CONFLICT, 3087);
-        RET_(ERROR_DIF_IOCALLBACK_NOT_REPLACED, 3190);
-        RET_(ERROR_DIF_LIVEDUMP_LIMIT_EXCEEDED, 3191);
-        RET_(ERROR_DIF_VOLATILE_SECTION_NOT_LOCKED, 3192);
-        RET_(ERROR_DIF_VOLATILE_DRIVER_HOTPATCHED, 3193);
-        RET_(ERROR_DIF_VOLATILE_INVALID_INFO, 3194);
-        RET_(ERROR_DIF_VOLATILE_DRIVER_IS_NOT_RUNNING, 3195);
-        RET_(ERROR_DIF_VOLATILE_PLUGIN_IS_NOT_RUNNING, 3196);
-        RET_(ERROR_DIF_VOLATILE_PLUGIN_CHANGE_NOT_ALLOWED, 3197);
-        RET_(ERROR_DIF_VOLATILE_NOT_ALLOWED, 3198);
-        RET_(ERROR_DIF_BINDING_API_NOT_FOUND, 3199);
-        RET_(ERROR_IO_REISSUE_AS_CACHED, 3950);
-        RET_(ERROR_WINS_INTERNAL, 4000);
-        RET_(ERROR_CAN_NOT_DEL_LOCAL_WINS, 4001);
-        RET_(ERROR_STATIC_INIT, 4002);
-        RET_(ERROR_INC_BACKUP, 4003);
-        RET_(ERROR_FULL_BACKUP, 4004);
-        RET_(ERROR_REC_NON_EXISTENT, 4005);
-        RET_(ERROR_RPL_NOT_ALLOWED, 4006);
-        RET_(ERROR_DHCP_ADDRESS_CONFLICT, 4100);
-        RET_(ERROR_WMI_GUID_NOT_FOUND, 4200);
-        RET_(ERROR_WMI_INSTANCE_NOT_FOUND, 4201);
-        RET_(ERROR_WMI_ITEMID_NOT_FOUND, 4202);
-        RET_(ERROR_WMI_TRY_AGAIN, 4203);
-        RET_(ERROR_WMI_DP_NOT_FOUND, 4204);
-        RET_(ERROR_WMI_UNRESOLVED_INSTANCE_REF, 4205);
-        RET_(ERROR_WMI_ALREADY_ENABLED, 4206);
-        RET_(ERROR_WMI_GUID_DISCONNECTED, 4207);
-        RET_(ERROR_WMI_SERVER_UNAVAILABLE, 4208);
-        RET_(ERROR_WMI_DP_FAILED, 4209);
-        RET_(ERROR_WMI_INVALID_MOF, 4210);
-        RET_(ERROR_WMI_INVALID_REGINFO, 4211);
-        RET_(ERROR_WMI_ALREADY_DISABLED, 4212);
-        RET_(ERROR_WMI_READ_ONLY, 4213);
-        RET_(ERROR_WMI_SET_FAILURE, 4214);
-        RET_(ERROR_NOT_APPCONTAINER, 4250);
-        RET_(ERROR_APPCONTAINER_REQUIRED, 4251);
-        RET_(ERROR_NOT_SUPPORTED_IN_APPCONTAINER, 4252);
-        RET_(ERROR_INVALID_PACKAGE_SID_LENGTH, 4253);
-        RET_(ERROR_INVALID_MEDIA, 4300);
-        RET_(ERROR_INVALID_LIBRARY, 4301);
-        RET_(ERROR_INVALID_MEDIA_POOL, 4302);
-        RET_(ERROR_DRIVE_MEDIA_MISMATCH, 4303);
-        RET_(ERROR_MEDIA_OFFLINE, 4304);
-        RET_(ERROR_LIBRARY_OFFLINE, 4305);
-        RET_(ERROR_EMPTY, 4306);
-        RET_(ERROR_NOT_EMPTY, 4307);
-        RET_(ERROR_MEDIA_UNAVAILABLE, 4308);
-        RET_(ERROR_RESOURCE_DISABLED, 4309);
-        RET_(ERROR_INVALID_CLEANER, 4310);
-        RET_(ERROR_UNABLE_TO_CLEAN, 4311);
-        RET_(ERROR_OBJECT_NOT_FOUND, 4312);
-        RET_(ERROR_DATABASE_FAILURE, 4313);
-        RET_(ERROR_DATABASE_FULL, 4314);
-        RET_(ERROR_MEDIA_INCOMPATIBLE, 4315);
-        RET_(ERROR_RESOURCE_NOT_PRESENT, 4316);
-        RET_(ERROR_INVALID_OPERATION, 4317);
-        RET_(ERROR_MEDIA_NOT_AVAILABLE, 4318);
-        RET_(ERROR_DEVICE_NOT_AVAILABLE, 4319);
-        RET_(ERROR_REQUEST_REFUSED, 4320);
-        RET_(ERROR_INVALID_DRIVE_OBJECT, 4321);
-        RET_(ERROR_LIBRARY_FULL, 4322);
-        RET_(ERROR_MEDIUM_NOT_ACCESSIBLE, 4323);
-        RET_(ERROR_UNABLE_TO_LOAD_MEDIUM, 4324);
-        RET_(ERROR_UNABLE_TO_INVENTORY_DRIVE, 4325);
-        RET_(ERROR_UNABLE_TO_INVENTORY_SLOT, 4326);
-        RET_(ERROR_UNABLE_TO_INVENTORY_TRANSPORT, 4327);
-        RET_(ERROR_TRANSPORT_FULL, 4328);
-        RET_(ERROR_CONTROLLING_IEPORT, 4329);
-        RET_(ERROR_UNABLE_TO_EJECT_MOUNTED_MEDIA, 4330);
-        RET_(ERROR_CLEANER_SLOT_SET, 4331);
-        RET_(ERROR_CLEANER_SLOT_NOT_SET, 4332);
-        RET_(ERROR_CLEANER_CARTRIDGE_SPENT, 4333);
-        RET_(ERROR_UNEXPECTED_OMID, 4334);
-        RET_(ERROR_CANT_DELETE_LAST_ITEM, 4335);
-        RET_(ERROR_MESSAGE_EXCEEDS_MAX_SIZE, 4336);
-        RET_(ERROR_VOLUME_CONTAINS_SYS_FILES, 4337);
-        RET_(ERROR_INDIGENOUS_TYPE, 4338);
-        RET_(ERROR_NO_SUPPORTING_DRIVES, 4339);
-        RET_(ERROR_CLEANER_CARTRIDGE_INSTALLED, 4340);
-        RET_(ERROR_IEPORT_FULL, 4341);
-        RET_(ERROR_FILE_OFFLINE, 4350);
-        RET_(ERROR_REMOTE_STORAGE_NOT_ACTIVE, 4351);
-        RET_(ERROR_REMOTE_STORAGE_MEDIA_ERROR, 4352);
-        RET_(ERROR_NOT_A_REPARSE_POINT, 4390);
-        RET_(ERROR_REPARSE_ATTRIBUTE_CONFLICT, 4391);
-        RET_(ERROR_INVALID_REPARSE_DATA, 4392);
-        RET_(ERROR_REPARSE_TAG_INVALID, 4393);
-        RET_(ERROR_REPARSE_TAG_MISMATCH, 4394);
-        RET_(ERROR_REPARSE_POINT_ENCOUNTERED, 4395);
-        RET_(ERROR_APP_DATA_NOT_FOUND, 4400);
-        RET_(ERROR_APP_DATA_EXPIRED, 4401);
-        RET_(ERROR_APP_DATA_CORRUPT, 4402);
-        RET_(ERROR_APP_DATA_LIMIT_EXCEEDED, 4403);
-        RET_(ERROR_APP_DATA_REBOOT_REQUIRED, 4404);
-        RET_(ERROR_SECUREBOOT_ROLLBACK_DETECTED, 4420);
-        RET_(ERROR_SECUREBOOT_POLICY_VIOLATION, 4421);
-        RET_(ERROR_SECUREBOOT_INVALID_POLICY, 4422);
-        RET_(ERROR_SECUREBOOT_POLICY_PUBLISHER_NOT_FOUND, 4423);
-        RET_(ERROR_SECUREBOOT_POLICY_NOT_SIGNED, 4424);
-        RET_(ERROR_SECUREBOOT_NOT_ENABLED, 4425);
-        RET_(ERROR_SECUREBOOT_FILE_REPLACED, 4426);
-        RET_(ERROR_SECUREBOOT_POLICY_NOT_AUTHORIZED, 4427);
-        RET_(ERROR_SECUREBOOT_POLICY_UNKNOWN, 4428);
-        RET_(ERROR_SECUREBOOT_POLICY_MISSING_ANTIROLLBACKVERSION, 4429);
-        RET_(ERROR_SECUREBOOT_PLATFORM_ID_MISMATCH, 4430);
-        RET_(ERROR_SECUREBOOT_POLICY_ROLLBACK_DETECTED, 4431);
-        RET_(ERROR_SECUREBOOT_POLICY_UPGRADE_MISMATCH, 4432);
-        RET_(ERROR_SECUREBOOT_REQUIRED_POLICY_FILE_MISSING, 4433);
-        RET_(ERROR_SECUREBOOT_NOT_BASE_POLICY, 4434);
-        RET_(ERROR_SECUREBOOT_NOT_SUPPLEMENTAL_POLICY, 4435);
-        RET_(ERROR_OFFLOAD_READ_FLT_NOT_SUPPORTED, 4440);
-        RET_(ERROR_OFFLOAD_WRITE_FLT_NOT_SUPPORTED, 4441);
-        RET_(ERROR_OFFLOAD_READ_FILE_NOT_SUPPORTED, 4442);
-        RET_(ERROR_OFFLOAD_WRITE_FILE_NOT_SUPPORTED, 4443);
-        RET_(ERROR_ALREADY_HAS_STREAM_ID, 4444);
-        RET_(ERROR_SMR_GARBAGE_COLLECTION_REQUIRED, 4445);
-        RET_(ERROR_WOF_WIM_HEADER_CORRUPT, 4446);
-        RET_(ERROR_WOF_WIM_RESOURCE_TABLE_CORRUPT, 4447);
-        RET_(ERROR_WOF_FILE_RESOURCE_TABLE_CORRUPT, 4448);
-        RET_(ERROR_OBJECT_IS_IMMUTABLE, 4449);
-        RET_(ERROR_VOLUME_NOT_SIS_ENABLED, 4500);
-        RET_(ERROR_SYSTEM_INTEGRITY_ROLLBACK_DETECTED, 4550);
-        RET_(ERROR_SYSTEM_INTEGRITY_POLICY_VIOLATION, 4551);
-        RET_(ERROR_SYSTEM_INTEGRITY_INVALID_POLICY, 4552);
-        RET_(ERROR_SYSTEM_INTEGRITY_POLICY_NOT_SIGNED, 4553);
-        RET_(ERROR_SYSTEM_INTEGRITY_TOO_MANY_POLICIES, 4554);
-        RET_(ERROR_SYSTEM_INTEGRITY_SUPPLEMENTAL_POLICY_NOT_AUTHORIZED, 4555);
-        RET_(ERROR_SYSTEM_INTEGRITY_REPUTATION_MALICIOUS, 4556);
-        RET_(ERROR_SYSTEM_INTEGRITY_REPUTATION_PUA, 4557);
-        RET_(ERROR_SYSTEM_INTEGRITY_REPUTATION_DANGEROUS_EXT, 4558);
-        RET_(ERROR_SYSTEM_INTEGRITY_REPUTATION_OFFLINE, 4559);
-        RET_(ERROR_VSM_NOT_INITIALIZED, 4560);
-        RET_(ERROR_VSM_DMA_PROTECTION_NOT_IN_USE, 4561);
-        RET_(ERROR_PLATFORM_MANIFEST_NOT_AUTHORIZED, 4570);
-        RET_(ERROR_PLATFORM_MANIFEST_INVALID, 4571);
-        RET_(ERROR_PLATFORM_MANIFEST_FILE_NOT_AUTHORIZED, 4572);
-        RET_(ERROR_PLATFORM_MANIFEST_CATALOG_NOT_AUTHORIZED, 4573);
-        RET_(ERROR_PLATFORM_MANIFEST_BINARY_ID_NOT_FOUND, 4574);
-        RET_(ERROR_PLATFORM_MANIFEST_NOT_ACTIVE, 4575);
-        RET_(ERROR_PLATFORM_MANIFEST_NOT_SIGNED, 4576);
-        RET_(ERROR_DEPENDENT_RESOURCE_EXISTS, 5001);
-        RET_(ERROR_DEPENDENCY_NOT_FOUND, 5002);
-        RET_(ERROR_DEPENDENCY_ALREADY_EXISTS, 5003);
-        RET_(ERROR_RESOURCE_NOT_ONLINE, 5004);
-        RET_(ERROR_HOST_NODE_NOT_AVAILABLE, 5005);
-        RET_(ERROR_RESOURCE_NOT_AVAILABLE, 5006);
-        RET_(ERROR_RESOURCE_NOT_FOUND, 5007);
-        RET_(ERROR_SHUTDOWN_CLUSTER, 5008);
-        RET_(ERROR_CANT_EVICT_ACTIVE_NODE, 5009);
-        RET_(ERROR_OBJECT_ALREADY_EXISTS, 5010);
-        RET_(ERROR_OBJECT_IN_LIST, 5011);
-        RET_(ERROR_GROUP_NOT_AVAILABLE, 5012);
-        RET_(ERROR_GROUP_NOT_FOUND, 5013);
-        RET_(ERROR_GROUP_NOT_ONLINE, 5014);
-        RET_(ERROR_HOST_NODE_NOT_RESOURCE_OWNER, 5015);
-        RET_(ERROR_HOST_NODE_NOT_GROUP_OWNER, 5016);
-        RET_(ERROR_RESMON_CREATE_FAILED, 5017);
-        RET_(ERROR_RESMON_ONLINE_FAILED, 5018);
-        RET_(ERROR_RESOURCE_ONLINE, 5019);
-        RET_(ERROR_QUORUM_RESOURCE, 5020);
-        RET_(ERROR_NOT_QUORUM_CAPABLE, 5021);
-        RET_(ERROR_CLUSTER_SHUTTING_DOWN, 5022);
-        RET_(ERROR_INVALID_STATE, 5023);
-        RET_(ERROR_RESOURCE_PROPERTIES_STORED, 5024);
-        RET_(ERROR_NOT_QUORUM_CLASS, 5025);
-        RET_(ERROR_CORE_RESOURCE, 5026);
-        RET_(ERROR_QUORUM_RESOURCE_ONLINE_FAILED, 5027);
-        RET_(ERROR_QUORUMLOG_OPEN_FAILED, 5028);
-        RET_(ERROR_CLUSTERLOG_CORRUPT, 5029);
-        RET_(ERROR_CLUSTERLOG_RECORD_EXCEEDS_MAXSIZE, 5030);
-        RET_(ERROR_CLUSTERLOG_EXCEEDS_MAXSIZE, 5031);
-        RET_(ERROR_CLUSTERLOG_CHKPOINT_NOT_FOUND, 5032);
-        RET_(ERROR_CLUSTERLOG_NOT_ENOUGH_SPACE, 5033);
-        RET_(ERROR_QUORUM_OWNER_ALIVE, 5034);
-        RET_(ERROR_NETWORK_NOT_AVAILABLE, 5035);
-        RET_(ERROR_NODE_NOT_AVAILABLE, 5036);
-        RET_(ERROR_ALL_NODES_NOT_AVAILABLE, 5037);
-        RET_(ERROR_RESOURCE_FAILED, 5038);
-        RET_(ERROR_CLUSTER_INVALID_NODE, 5039);
-        RET_(ERROR_CLUSTER_NODE_EXISTS, 5040);
-        RET_(ERROR_CLUSTER_JOIN_IN_PROGRESS, 5041);
-        RET_(ERROR_CLUSTER_NODE_NOT_FOUND, 5042);
-        RET_(ERROR_CLUSTER_LOCAL_NODE_NOT_FOUND, 5043);
-        RET_(ERROR_CLUSTER_NETWORK_EXISTS, 5044);
-        RET_(ERROR_CLUSTER_NETWORK_NOT_FOUND, 5045);
-        RET_(ERROR_CLUSTER_NETINTERFACE_EXISTS, 5046);
-        RET_(ERROR_CLUSTER_NETINTERFACE_NOT_FOUND, 5047);
-        RET_(ERROR_CLUSTER_INVALID_REQUEST, 5048);
-        RET_(ERROR_CLUSTER_INVALID_NETWORK_PROVIDER, 5049);
-        RET_(ERROR_CLUSTER_NODE_DOWN, 5050);
-        RET_(ERROR_CLUSTER_NODE_UNREACHABLE, 5051);
-        RET_(ERROR_CLUSTER_NODE_NOT_MEMBER, 5052);
-        RET_(ERROR_CLUSTER_JOIN_NOT_IN_PROGRESS, 5053);
-        RET_(ERROR_CLUSTER_INVALID_NETWORK, 5054);
-        RET_(ERROR_CLUSTER_NODE_UP, 5056);
-        RET_(ERROR_CLUSTER_IPADDR_IN_USE, 5057);
-        RET_(ERROR_CLUSTER_NODE_NOT_PAUSED, 5058);
-        RET_(ERROR_CLUSTER_NO_SECURITY_CONTEXT, 5059);
-        RET_(ERROR_CLUSTER_NETWORK_NOT_INTERNAL, 5060);
-        RET_(ERROR_CLUSTER_NODE_ALREADY_UP, 5061);
-        RET_(ERROR_CLUSTER_NODE_ALREADY_DOWN, 5062);
-        RET_(ERROR_CLUSTER_NETWORK_ALREADY_ONLINE, 5063);
-        RET_(ERROR_CLUSTER_NETWORK_ALREADY_OFFLINE, 5064);
-        RET_(ERROR_CLUSTER_NODE_ALREADY_MEMBER, 5065);
-        RET_(ERROR_CLUSTER_LAST_INTERNAL_NETWORK, 5066);
-        RET_(ERROR_CLUSTER_NETWORK_HAS_DEPENDENTS, 5067);
-        RET_(ERROR_INVALID_OPERATION_ON_QUORUM, 5068);
-        RET_(ERROR_DEPENDENCY_NOT_ALLOWED, 5069);
-        RET_(ERROR_CLUSTER_NODE_PAUSED, 5070);
-        RET_(ERROR_NODE_CANT_HOST_RESOURCE, 5071);
-        RET_(ERROR_CLUSTER_NODE_NOT_READY, 5072);
-        RET_(ERROR_CLUSTER_NODE_SHUTTING_DOWN, 5073);
-        RET_(ERROR_CLUSTER_JOIN_ABORTED, 5074);
-        RET_(ERROR_CLUSTER_INCOMPATIBLE_VERSIONS, 5075);
-        RET_(ERROR_CLUSTER_MAXNUM_OF_RESOURCES_EXCEEDED, 5076);
-        RET_(ERROR_CLUSTER_SYSTEM_CONFIG_CHANGED, 5077);
-        RET_(ERROR_CLUSTER_RESOURCE_TYPE_NOT_FOUND, 5078);
-        RET_(ERROR_CLUSTER_RESTYPE_NOT_SUPPORTED, 5079);
-        RET_(ERROR_CLUSTER_RESNAME_NOT_FOUND, 5080);
-        RET_(ERROR_CLUSTER_NO_RPC_PACKAGES_REGISTERED, 5081);
-        RET_(ERROR_CLUSTER_OWNER_NOT_IN_PREFLIST, 5082);
-        RET_(ERROR_CLUSTER_DATABASE_SEQMISMATCH, 5083);
-        RET_(ERROR_RESMON_INVALID_STATE, 5084);
-        RET_(ERROR_CLUSTER_GUM_NOT_LOCKER, 5085);
-        RET_(ERROR_QUORUM_DISK_NOT_FOUND, 5086);
-        RET_(ERROR_DATABASE_BACKUP_CORRUPT, 5087);
-        RET_(ERROR_CLUSTER_NODE_ALREADY_HAS_DFS_ROOT, 5088);
-        RET_(ERROR_RESOURCE_PROPERTY_UNCHANGEABLE, 5089);
-        RET_(ERROR_NO_ADMIN_ACCESS_POINT, 5090);
-        RET_(ERROR_CLUSTER_MEMBERSHIP_INVALID_STATE, 5890);
-        RET_(ERROR_CLUSTER_QUORUMLOG_NOT_FOUND, 5891);
-        RET_(ERROR_CLUSTER_MEMBERSHIP_HALT, 5892);
-        RET_(ERROR_CLUSTER_INSTANCE_ID_MISMATCH, 5893);
-        RET_(ERROR_CLUSTER_NETWORK_NOT_FOUND_FOR_IP, 5894);
-        RET_(ERROR_CLUSTER_PROPERTY_DATA_TYPE_MISMATCH, 5895);
-        RET_(ERROR_CLUSTER_EVICT_WITHOUT_CLEANUP, 5896);
-        RET_(ERROR_CLUSTER_PARAMETER_MISMATCH, 5897);
-        RET_(ERROR_NODE_CANNOT_BE_CLUSTERED, 5898);
-        RET_(ERROR_CLUSTER_WRONG_OS_VERSION, 5899);
-        RET_(ERROR_CLUSTER_CANT_CREATE_DUP_CLUSTER_NAME, 5900);
-        RET_(ERROR_CLUSCFG_ALREADY_COMMITTED, 5901);
-        RET_(ERROR_CLUSCFG_ROLLBACK_FAILED, 5902);
-        RET_(ERROR_CLUSCFG_SYSTEM_DISK_DRIVE_LETTER_CONFLICT, 5903);
-        RET_(ERROR_CLUSTER_OLD_VERSION, 5904);
-        RET_(ERROR_CLUSTER_MISMATCHED_COMPUTER_ACCT_NAME, 5905);
-        RET_(ERROR_CLUSTER_NO_NET_ADAPTERS, 5906);
-        RET_(ERROR_CLUSTER_POISONED, 5907);
-        RET_(ERROR_CLUSTER_GROUP_MOVING, 5908);
-        RET_(ERROR_CLUSTER_RESOURCE_TYPE_BUSY, 5909);
-        RET_(ERROR_RESOURCE_CALL_TIMED_OUT, 5910);
-        RET_(ERROR_INVALID_CLUSTER_IPV6_ADDRESS, 5911);
-        RET_(ERROR_CLUSTER_INTERNAL_INVALID_FUNCTION, 5912);
-        RET_(ERROR_CLUSTER_PARAMETER_OUT_OF_BOUNDS, 5913);
-        RET_(ERROR_CLUSTER_PARTIAL_SEND, 5914);
-        RET_(ERROR_CLUSTER_REGISTRY_INVALID_FUNCTION, 5915);
-        RET_(ERROR_CLUSTER_INVALID_STRING_TERMINATION, 5916);
-        RET_(ERROR_CLUSTER_INVALID_STRING_FORMAT, 5917);
-        RET_(ERROR_CLUSTER_DATABASE_TRANSACTION_IN_PROGRESS, 5918);
-        RET_(ERROR_CLUSTER_DATABASE_TRANSACTION_NOT_IN_PROGRESS, 5919);
-        RET_(ERROR_CLUSTER_NULL_DATA, 5920);
-        RET_(ERROR_CLUSTER_PARTIAL_READ, 5921);
-        RET_(ERROR_CLUSTER_PARTIAL_WRITE, 5922);
-        RET_(ERROR_CLUSTER_CANT_DESERIALIZE_DATA, 5923);
-        RET_(ERROR_DEPENDENT_RESOURCE_PROPERTY_CONFLICT, 5924);
-        RET_(ERROR_CLUSTER_NO_QUORUM, 5925);
-        RET_(ERROR_CLUSTER_INVALID_IPV6_NETWORK, 5926);
-        RET_(ERROR_CLUSTER_INVALID_IPV6_TUNNEL_NETWORK, 5927);
-        RET_(ERROR_QUORUM_NOT_ALLOWED_IN_THIS_GROUP, 5928);
-        RET_(ERROR_DEPENDENCY_TREE_TOO_COMPLEX, 5929);
-        RET_(ERROR_EXCEPTION_IN_RESOURCE_CALL, 5930);
-        RET_(ERROR_CLUSTER_RHS_FAILED_INITIALIZATION, 5931);
-        RET_(ERROR_CLUSTER_NOT_INSTALLED, 5932);
-        RET_(ERROR_CLUSTER_RESOURCES_MUST_BE_ONLINE_ON_THE_SAME_NODE, 5933);
-        RET_(ERROR_CLUSTER_MAX_NODES_IN_CLUSTER, 5934);
-        RET_(ERROR_CLUSTER_TOO_MANY_NODES, 5935);
-        RET_(ERROR_CLUSTER_OBJECT_ALREADY_USED, 5936);
-        RET_(ERROR_NONCORE_GROUPS_FOUND, 5937);
-        RET_(ERROR_FILE_SHARE_RESOURCE_CONFLICT, 5938);
-        RET_(ERROR_CLUSTER_EVICT_INVALID_REQUEST, 5939);
-        RET_(ERROR_CLUSTER_SINGLETON_RESOURCE, 5940);
-        RET_(ERROR_CLUSTER_GROUP_SINGLETON_RESOURCE, 5941);
-        RET_(ERROR_CLUSTER_RESOURCE_PROVIDER_FAILED, 5942);
-        RET_(ERROR_CLUSTER_RESOURCE_CONFIGURATION_ERROR, 5943);
-        RET_(ERROR_CLUSTER_GROUP_BUSY, 5944);
-        RET_(ERROR_CLUSTER_NOT_SHARED_VOLUME, 5945);
-        RET_(ERROR_CLUSTER_INVALID_SECURITY_DESCRIPTOR, 5946);
-        RET_(ERROR_CLUSTER_SHARED_VOLUMES_IN_USE, 5947);
-        RET_(ERROR_CLUSTER_USE_SHARED_VOLUMES_API, 5948);
-        RET_(ERROR_CLUSTER_BACKUP_IN_PROGRESS, 5949);
-        RET_(ERROR_NON_CSV_PATH, 5950);
-        RET_(ERROR_CSV_VOLUME_NOT_LOCAL, 5951);
-        RET_(ERROR_CLUSTER_WATCHDOG_TERMINATING, 5952);
-        RET_(ERROR_CLUSTER_RESOURCE_VETOED_MOVE_INCOMPATIBLE_NODES, 5953);
-        RET_(ERROR_CLUSTER_INVALID_NODE_WEIGHT, 5954);
-        RET_(ERROR_CLUSTER_RESOURCE_VETOED_CALL, 5955);
-        RET_(ERROR_RESMON_SYSTEM_RESOURCES_LACKING, 5956);
-        RET_(ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_DESTINATION, 5957);
-        RET_(ERROR_CLUSTER_RESOURCE_VETOED_MOVE_NOT_ENOUGH_RESOURCES_ON_SOURCE, 5958);
-        RET_(ERROR_CLUSTER_GROUP_QUEUED, 5959);
-        RET_(ERROR_CLUSTER_RESOURCE_LOCKED_STATUS, 5960);
-        RET_(ERROR_CLUSTER_SHARED_VOLUME_FAILOVER_NOT_ALLOWED, 5961);
-        RET_(ERROR_CLUSTER_NODE_DRAIN_IN_PROGRESS, 5962);
-        RET_(ERROR_CLUSTER_DISK_NOT_CONNECTED, 5963);
-        RET_(ERROR_DISK_NOT_CSV_CAPABLE, 5964);
-        RET_(ERROR_RESOURCE_NOT_IN_AVAILABLE_STORAGE, 5965);
-        RET_(ERROR_CLUSTER_SHARED_VOLUME_REDIRECTED, 5966);
-        RET_(ERROR_CLUSTER_SHARED_VOLUME_NOT_REDIRECTED, 5967);
-        RET_(ERROR_CLUSTER_CANNOT_RETURN_PROPERTIES, 5968);
-        RET_(ERROR_CLUSTER_RESOURCE_CONTAINS_UNSUPPORTED_DIFF_AREA_FOR_SHARED_VOLUMES, 5969);
-        RET_(ERROR_CLUSTER_RESOURCE_IS_IN_MAINTENANCE_MODE, 5970);
-        RET_(ERROR_CLUSTER_AFFINITY_CONFLICT, 5971);
-        RET_(ERROR_CLUSTER_RESOURCE_IS_REPLICA_VIRTUAL_MACHINE, 5972);
-        RET_(ERROR_CLUSTER_UPGRADE_INCOMPATIBLE_VERSIONS, 5973);
-        RET_(ERROR_CLUSTER_UPGRADE_FIX_QUORUM_NOT_SUPPORTED, 5974);
-        RET_(ERROR_CLUSTER_UPGRADE_RESTART_REQUIRED, 5975);
-        RET_(ERROR_CLUSTER_UPGRADE_IN_PROGRESS, 5976);
-        RET_(ERROR_CLUSTER_UPGRADE_INCOMPLETE, 5977);
-        RET_(ERROR_CLUSTER_NODE_IN_GRACE_PERIOD, 5978);
-        RET_(ERROR_CLUSTER_CSV_IO_PAUSE_TIMEOUT, 5979);
-        RET_(ERROR_NODE_NOT_ACTIVE_CLUSTER_MEMBER, 5980);
-        RET_(ERROR_CLUSTER_RESOURCE_NOT_MONITORED, 5981);
-        RET_(ERROR_CLUSTER_RESOURCE_DOES_NOT_SUPPORT_UNMONITORED, 5982);
-        RET_(ERROR_CLUSTER_RESOURCE_IS_REPLICATED, 5983);
-        RET_(ERROR_CLUSTER_NODE_ISOLATED, 5984);
-        RET_(ERROR_CLUSTER_NODE_QUARANTINED, 5985);
-        RET_(ERROR_CLUSTER_DATABASE_UPDATE_CONDITION_FAILED, 5986);
-        RET_(ERROR_CLUSTER_SPACE_DEGRADED, 5987);
-        RET_(ERROR_CLUSTER_TOKEN_DELEGATION_NOT_SUPPORTED, 5988);
-        RET_(ERROR_CLUSTER_CSV_INVALID_HANDLE, 5989);
-        RET_(ERROR_CLUSTER_CSV_SUPPORTED_ONLY_ON_COORDINATOR, 5990);
-        RET_(ERROR_GROUPSET_NOT_AVAILABLE, 5991);
-        RET_(ERROR_GROUPSET_NOT_FOUND, 5992);
-        RET_(ERROR_GROUPSET_CANT_PROVIDE, 5993);
-        RET_(ERROR_CLUSTER_FAULT_DOMAIN_PARENT_NOT_FOUND, 5994);
-        RET_(ERROR_CLUSTER_FAULT_DOMAIN_INVALID_HIERARCHY, 5995);
-        RET_(ERROR_CLUSTER_FAULT_DOMAIN_FAILED_S2D_VALIDATION, 5996);
-        RET_(ERROR_CLUSTER_FAULT_DOMAIN_S2D_CONNECTIVITY_LOSS, 5997);
-        RET_(ERROR_CLUSTER_INVALID_INFRASTRUCTURE_FILESERVER_NAME, 5998);
-        RET_(ERROR_CLUSTERSET_MANAGEMENT_CLUSTER_UNREACHABLE, 5999);
-        RET_(ERROR_ENCRYPTION_FAILED, 6000);
-        RET_(ERROR_DECRYPTION_FAILED, 6001);
-        RET_(ERROR_FILE_ENCRYPTED, 6002);
-        RET_(ERROR_NO_RECOVERY_POLICY, 6003);
-        RET_(ERROR_NO_EFS, 6004);
-        RET_(ERROR_WRONG_EFS, 6005);
-        RET_(ERROR_NO_USER_KEYS, 6006);
-        RET_(ERROR_FILE_NOT_ENCRYPTED, 6007);
-        RET_(ERROR_NOT_EXPORT_FORMAT, 6008);
-        RET_(ERROR_FILE_READ_ONLY, 6009);
-        RET_(ERROR_DIR_EFS_DISALLOWED, 6010);
-        RET_(ERROR_EFS_SERVER_NOT_TRUSTED, 6011);
-        RET_(ERROR_BAD_RECOVERY_POLICY, 6012);
-        RET_(ERROR_EFS_ALG_BLOB_TOO_BIG, 6013);
-        RET_(ERROR_VOLUME_NOT_SUPPORT_EFS, 6014);
-        RET_(ERROR_EFS_DISABLED, 6015);
-        RET_(ERROR_EFS_VERSION_NOT_SUPPORT, 6016);
-        RET_(ERROR_CS_ENCRYPTION_INVALID_SERVER_RESPONSE, 6017);
-        RET_(ERROR_CS_ENCRYPTION_UNSUPPORTED_SERVER, 6018);
-        RET_(ERROR_CS_ENCRYPTION_EXISTING_ENCRYPTED_FILE, 6019);
-        RET_(ERROR_CS_ENCRYPTION_NEW_ENCRYPTED_FILE, 6020);
-        RET_(ERROR_CS_ENCRYPTION_FILE_NOT_CSE, 6021);
-        RET_(ERROR_ENCRYPTION_POLICY_DENIES_OPERATION, 6022);
-        RET_(ERROR_WIP_ENCRYPTION_FAILED, 6023);
-        RET_(ERROR_NO_BROWSER_SERVERS_FOUND, 6118);
-        RET_(ERROR_CLUSTER_OBJECT_IS_CLUSTER_SET_VM, 6250);
-        RET_(ERROR_LOG_SECTOR_INVALID, 6600);
-        RET_(ERROR_LOG_SECTOR_PARITY_INVALID, 6601);
-        RET_(ERROR_LOG_SECTOR_REMAPPED, 6602);
-        RET_(ERROR_LOG_BLOCK_INCOMPLETE, 6603);
-        RET_(ERROR_LOG_INVALID_RANGE, 6604);
-        RET_(ERROR_LOG_BLOCKS_EXHAUSTED, 6605);
-        RET_(ERROR_LOG_READ_CONTEXT_INVALID, 6606);
-        RET_(ERROR_LOG_RESTART_INVALID, 6607);
-        RET_(ERROR_LOG_BLOCK_VERSION, 6608);
-        RET_(ERROR_LOG_BLOCK_INVALID, 6609);
-        RET_(ERROR_LOG_READ_MODE_INVALID, 6610);
-        RET_(ERROR_LOG_NO_RESTART, 6611);
-        RET_(ERROR_LOG_METADATA_CORRUPT, 6612);
-        RET_(ERROR_LOG_METADATA_INVALID, 6613);
-        RET_(ERROR_LOG_METADATA_INCONSISTENT, 6614);
-        RET_(ERROR_LOG_RESERVATION_INVALID, 6615);
-        RET_(ERROR_LOG_CANT_DELETE, 6616);
-        RET_(ERROR_LOG_CONTAINER_LIMIT_EXCEEDED, 6617);
-        RET_(ERROR_LOG_START_OF_LOG, 6618);
-        RET_(ERROR_LOG_POLICY_ALREADY_INSTALLED, 6619);
-        RET_(ERROR_LOG_POLICY_NOT_INSTALLED, 6620);
-        RET_(ERROR_LOG_POLICY_INVALID, 6621);
-        RET_(ERROR_LOG_POLICY_CONFLICT, 6622);
-        RET_(ERROR_LOG_PINNED_ARCHIVE_TAIL, 6623);
-        RET_(ERROR_LOG_RECORD_NONEXISTENT, 6624);
-        RET_(ERROR_LOG_RECORDS_RESERVED_INVALID, 6625);
-        RET_(ERROR_LOG_SPACE_RESERVED_INVALID, 6626);
-        RET_(ERROR_LOG_TAIL_INVALID, 6627);
-        RET_(ERROR_LOG_FULL, 6628);
-        RET_(ERROR_COULD_NOT_RESIZE_LOG, 6629);
-        RET_(ERROR_LOG_MULTIPLEXED, 6630);
-        RET_(ERROR_LOG_DEDICATED, 6631);
-        RET_(ERROR_LOG_ARCHIVE_NOT_IN_PROGRESS, 6632);
-        RET_(ERROR_LOG_ARCHIVE_IN_PROGRESS, 6633);
-        RET_(ERROR_LOG_EPHEMERAL, 6634);
-        RET_(ERROR_LOG_NOT_ENOUGH_CONTAINERS, 6635);
-        RET_(ERROR_LOG_CLIENT_ALREADY_REGISTERED, 6636);
-        RET_(ERROR_LOG_CLIENT_NOT_REGISTERED, 6637);
-        RET_(ERROR_LOG_FULL_HANDLER_IN_PROGRESS, 6638);
-        RET_(ERROR_LOG_CONTAINER_READ_FAILED, 6639);
-        RET_(ERROR_LOG_CONTAINER_WRITE_FAILED, 6640);
-        RET_(ERROR_LOG_CONTAINER_OPEN_FAILED, 6641);
-        RET_(ERROR_LOG_CONTAINER_STATE_INVALID, 6642);
-        RET_(ERROR_LOG_STATE_INVALID, 6643);
-        RET_(ERROR_LOG_PINNED, 6644);
-        RET_(ERROR_LOG_METADATA_FLUSH_FAILED, 6645);
-        RET_(ERROR_LOG_INCONSISTENT_SECURITY, 6646);
-        RET_(ERROR_LOG_APPENDED_FLUSH_FAILED, 6647);
-        RET_(ERROR_LOG_PINNED_RESERVATION, 6648);
-        RET_(ERROR_INVALID_TRANSACTION, 6700);
-        RET_(ERROR_TRANSACTION_NOT_ACTIVE, 6701);
-        RET_(ERROR_TRANSACTION_REQUEST_NOT_VALID, 6702);
-        RET_(ERROR_TRANSACTION_NOT_REQUESTED, 6703);
-        RET_(ERROR_TRANSACTION_ALREADY_ABORTED, 6704);
-        RET_(ERROR_TRANSACTION_ALREADY_COMMITTED, 6705);
-        RET_(ERROR_TM_INITIALIZATION_FAILED, 6706);
-        RET_(ERROR_RESOURCEMANAGER_READ_ONLY, 6707);
-        RET_(ERROR_TRANSACTION_NOT_JOINED, 6708);
-        RET_(ERROR_TRANSACTION_SUPERIOR_EXISTS, 6709);
-        RET_(ERROR_CRM_PROTOCOL_ALREADY_EXISTS, 6710);
-        RET_(ERROR_TRANSACTION_PROPAGATION_FAILED, 6711);
-        RET_(ERROR_CRM_PROTOCOL_NOT_FOUND, 6712);
-        RET_(ERROR_TRANSACTION_INVALID_MARSHALL_BUFFER, 6713);
-        RET_(ERROR_CURRENT_TRANSACTION_NOT_VALID, 6714);
-        RET_(ERROR_TRANSACTION_NOT_FOUND, 6715);
-        RET_(ERROR_RESOURCEMANAGER_NOT_FOUND, 6716);
-        RET_(ERROR_ENLISTMENT_NOT_FOUND, 6717);
-        RET_(ERROR_TRANSACTIONMANAGER_NOT_FOUND, 6718);
-        RET_(ERROR_TRANSACTIONMANAGER_NOT_ONLINE, 6719);
-        RET_(ERROR_TRANSACTIONMANAGER_RECOVERY_NAME_COLLISION, 6720);
-        RET_(ERROR_TRANSACTION_NOT_ROOT, 6721);
-        RET_(ERROR_TRANSACTION_OBJECT_EXPIRED, 6722);
-        RET_(ERROR_TRANSACTION_RESPONSE_NOT_ENLISTED, 6723);
-        RET_(ERROR_TRANSACTION_RECORD_TOO_LONG, 6724);
-        RET_(ERROR_IMPLICIT_TRANSACTION_NOT_SUPPORTED, 6725);
-        RET_(ERROR_TRANSACTION_INTEGRITY_VIOLATED, 6726);
-        RET_(ERROR_TRANSACTIONMANAGER_IDENTITY_MISMATCH, 6727);
-        RET_(ERROR_RM_CANNOT_BE_FROZEN_FOR_SNAPSHOT, 6728);
-        RET_(ERROR_TRANSACTION_MUST_WRITETHROUGH, 6729);
-        RET_(ERROR_TRANSACTION_NO_SUPERIOR, 6730);
-        RET_(ERROR_HEURISTIC_DAMAGE_POSSIBLE, 6731);
-        RET_(ERROR_TRANSACTIONAL_CONFLICT, 6800);
-        RET_(ERROR_RM_NOT_ACTIVE, 6801);
-        RET_(ERROR_RM_METADATA_CORRUPT, 6802);
-        RET_(ERROR_DIRECTORY_NOT_RM, 6803);
-        RET_(ERROR_TRANSACTIONS_UNSUPPORTED_REMOTE, 6805);
-        RET_(ERROR_LOG_RESIZE_INVALID_SIZE, 6806);
-        RET_(ERROR_OBJECT_NO_LONGER_EXISTS, 6807);
-        RET_(ERROR_STREAM_MINIVERSION_NOT_FOUND, 6808);
-        RET_(ERROR_STREAM_MINIVERSION_NOT_VALID, 6809);
-        RET_(ERROR_MINIVERSION_INACCESSIBLE_FROM_SPECIFIED_TRANSACTION, 6810);
-        RET_(ERROR_CANT_OPEN_MINIVERSION_WITH_MODIFY_INTENT, 6811);
-        RET_(ERROR_CANT_CREATE_MORE_STREAM_MINIVERSIONS, 6812);
-        RET_(ERROR_REMOTE_FILE_VERSION_MISMATCH, 6814);
-        RET_(ERROR_HANDLE_NO_LONGER_VALID, 6815);
-        RET_(ERROR_NO_TXF_METADATA, 6816);
-        RET_(ERROR_LOG_CORRUPTION_DETECTED, 6817);
-        RET_(ERROR_CANT_RECOVER_WITH_HANDLE_OPEN, 6818);
-        RET_(ERROR_RM_DISCONNECTED, 6819);
-        RET_(ERROR_ENLISTMENT_NOT_SUPERIOR, 6820);
-        RET_(ERROR_RECOVERY_NOT_NEEDED, 6821);
-        RET_(ERROR_RM_ALREADY_STARTED, 6822);
-        RET_(ERROR_FILE_IDENTITY_NOT_PERSISTENT, 6823);
-        RET_(ERROR_CANT_BREAK_TRANSACTIONAL_DEPENDENCY, 6824);
-        RET_(ERROR_CANT_CROSS_RM_BOUNDARY, 6825);
-        RET_(ERROR_TXF_DIR_NOT_EMPTY, 6826);
-        RET_(ERROR_INDOUBT_TRANSACTIONS_EXIST, 6827);
-        RET_(ERROR_TM_VOLATILE, 6828);
-        RET_(ERROR_ROLLBACK_TIMER_EXPIRED, 6829);
-        RET_(ERROR_TXF_ATTRIBUTE_CORRUPT, 6830);
-        RET_(ERROR_EFS_NOT_ALLOWED_IN_TRANSACTION, 6831);
-        RET_(ERROR_TRANSACTIONAL_OPEN_NOT_ALLOWED, 6832);
-        RET_(ERROR_LOG_GROWTH_FAILED, 6833);
-        RET_(ERROR_TRANSACTED_MAPPING_UNSUPPORTED_REMOTE, 6834);
-        RET_(ERROR_TXF_METADATA_ALREADY_PRESENT, 6835);
-        RET_(ERROR_TRANSACTION_SCOPE_CALLBACKS_NOT_SET, 6836);
-        RET_(ERROR_TRANSACTION_REQUIRED_PROMOTION, 6837);
-        RET_(ERROR_CANNOT_EXECUTE_FILE_IN_TRANSACTION, 6838);
-        RET_(ERROR_TRANSACTIONS_NOT_FROZEN, 6839);
-        RET_(ERROR_TRANSACTION_FREEZE_IN_PROGRESS, 6840);
-        RET_(ERROR_NOT_SNAPSHOT_VOLUME, 6841);
-        RET_(ERROR_NO_SAVEPOINT_WITH_OPEN_FILES, 6842);
-        RET_(ERROR_DATA_LOST_REPAIR, 6843);
-        RET_(ERROR_SPARSE_NOT_ALLOWED_IN_TRANSACTION, 6844);
-        RET_(ERROR_TM_IDENTITY_MISMATCH, 6845);
-        RET_(ERROR_FLOATED_SECTION, 6846);
-        RET_(ERROR_CANNOT_ACCEPT_TRANSACTED_WORK, 6847);
-        RET_(ERROR_CANNOT_ABORT_TRANSACTIONS, 6848);
-        RET_(ERROR_BAD_CLUSTERS, 6849);
-        RET_(ERROR_COMPRESSION_NOT_ALLOWED_IN_TRANSACTION, 6850);
-        RET_(ERROR_VOLUME_DIRTY, 6851);
-        RET_(ERROR_NO_LINK_TRACKING_IN_TRANSACTION, 6852);
-        RET_(ERROR_OPERATION_NOT_SUPPORTED_IN_TRANSACTION, 6853);
-        RET_(ERROR_EXPIRED_HANDLE, 6854);
-        RET_(ERROR_TRANSACTION_NOT_ENLISTED, 6855);
-        RET_(ERROR_CTX_WINSTATION_NAME_INVALID, 7001);
-        RET_(ERROR_CTX_INVALID_PD, 7002);
-        RET_(ERROR_CTX_PD_NOT_FOUND, 7003);
-        RET_(ERROR_CTX_WD_NOT_FOUND, 7004);
-        RET_(ERROR_CTX_CANNOT_MAKE_EVENTLOG_ENTRY, 7005);
-        RET_(ERROR_CTX_SERVICE_NAME_COLLISION, 7006);
-        RET_(ERROR_CTX_CLOSE_PENDING, 7007);
-        RET_(ERROR_CTX_NO_OUTBUF, 7008);
-        RET_(ERROR_CTX_MODEM_INF_NOT_FOUND, 7009);
-        RET_(ERROR_CTX_INVALID_MODEMNAME, 7010);
-        RET_(ERROR_CTX_MODEM_RESPONSE_ERROR, 7011);
-        RET_(ERROR_CTX_MODEM_RESPONSE_TIMEOUT, 7012);
-        RET_(ERROR_CTX_MODEM_RESPONSE_NO_CARRIER, 7013);
-        RET_(ERROR_CTX_MODEM_RESPONSE_NO_DIALTONE, 7014);
-        RET_(ERROR_CTX_MODEM_RESPONSE_BUSY, 7015);
-        RET_(ERROR_CTX_MODEM_RESPONSE_VOICE, 7016);
-        RET_(ERROR_CTX_TD_ERROR, 7017);
-        RET_(ERROR_CTX_WINSTATION_NOT_FOUND, 7022);
-        RET_(ERROR_CTX_WINSTATION_ALREADY_EXISTS, 7023);
-        RET_(ERROR_CTX_WINSTATION_BUSY, 7024);
-        RET_(ERROR_CTX_BAD_VIDEO_MODE, 7025);
-        RET_(ERROR_CTX_GRAPHICS_INVALID, 7035);
-        RET_(ERROR_CTX_LOGON_DISABLED, 7037);
-        RET_(ERROR_CTX_NOT_CONSOLE, 7038);
-        RET_(ERROR_CTX_CLIENT_QUERY_TIMEOUT, 7040);
-        RET_(ERROR_CTX_CONSOLE_DISCONNECT, 7041);
-        RET_(ERROR_CTX_CONSOLE_CONNECT, 7042);
-        RET_(ERROR_CTX_SHADOW_DENIED, 7044);
-        RET_(ERROR_CTX_WINSTATION_ACCESS_DENIED, 7045);
-        RET_(ERROR_CTX_INVALID_WD, 7049);
-        RET_(ERROR_CTX_SHADOW_INVALID, 7050);
-        RET_(ERROR_CTX_SHADOW_DISABLED, 7051);
-        RET_(ERROR_CTX_CLIENT_LICENSE_IN_USE, 7052);
-        RET_(ERROR_CTX_CLIENT_LICENSE_NOT_SET, 7053);
-        RET_(ERROR_CTX_LICENSE_NOT_AVAILABLE, 7054);
-        RET_(ERROR_CTX_LICENSE_CLIENT_INVALID, 7055);
-        RET_(ERROR_CTX_LICENSE_EXPIRED, 7056);
-        RET_(ERROR_CTX_SHADOW_NOT_RUNNING, 7057);
-        RET_(ERROR_CTX_SHADOW_ENDED_BY_MODE_CHANGE, 7058);
-        RET_(ERROR_ACTIVATION_COUNT_EXCEEDED, 7059);
-        RET_(ERROR_CTX_WINSTATIONS_DISABLED, 7060);
-        RET_(ERROR_CTX_ENCRYPTION_LEVEL_REQUIRED, 7061);
-        RET_(ERROR_CTX_SESSION_IN_USE, 7062);
-        RET_(ERROR_CTX_NO_FORCE_LOGOFF, 7063);
-        RET_(ERROR_CTX_ACCOUNT_RESTRICTION, 7064);
-        RET_(ERROR_RDP_PROTOCOL_ERROR, 7065);
-        RET_(ERROR_CTX_CDM_CONNECT, 7066);
-        RET_(ERROR_CTX_CDM_DISCONNECT, 7067);
-        RET_(ERROR_CTX_SECURITY_LAYER_ERROR, 7068);
-        RET_(ERROR_TS_INCOMPATIBLE_SESSIONS, 7069);
-        RET_(ERROR_TS_VIDEO_SUBSYSTEM_ERROR, 7070);
-        RET_(ERROR_DS_NOT_INSTALLED, 8200);
-        RET_(ERROR_DS_MEMBERSHIP_EVALUATED_LOCALLY, 8201);
-        RET_(ERROR_DS_NO_ATTRIBUTE_OR_VALUE, 8202);
-        RET_(ERROR_DS_INVALID_ATTRIBUTE_SYNTAX, 8203);
-        RET_(ERROR_DS_ATTRIBUTE_TYPE_UNDEFINED, 8204);
-        RET_(ERROR_DS_ATTRIBUTE_OR_VALUE_EXISTS, 8205);
-        RET_(ERROR_DS_BUSY, 8206);
-        RET_(ERROR_DS_UNAVAILABLE, 8207);
-        RET_(ERROR_DS_NO_RIDS_ALLOCATED, 8208);
-        RET_(ERROR_DS_NO_MORE_RIDS, 8209);
-        RET_(ERROR_DS_INCORRECT_ROLE_OWNER, 8210);
-        RET_(ERROR_DS_RIDMGR_INIT_ERROR, 8211);
-        RET_(ERROR_DS_OBJ_CLASS_VIOLATION, 8212);
-        RET_(ERROR_DS_CANT_ON_NON_LEAF, 8213);
-        RET_(ERROR_DS_CANT_ON_RDN, 8214);
-        RET_(ERROR_DS_CANT_MOD_OBJ_CLASS, 8215);
-        RET_(ERROR_DS_CROSS_DOM_MOVE_ERROR, 8216);
-        RET_(ERROR_DS_GC_NOT_AVAILABLE, 8217);
-        RET_(ERROR_SHARED_POLICY, 8218);
-        RET_(ERROR_POLICY_OBJECT_NOT_FOUND, 8219);
-        RET_(ERROR_POLICY_ONLY_IN_DS, 8220);
-        RET_(ERROR_PROMOTION_ACTIVE, 8221);
-        RET_(ERROR_NO_PROMOTION_ACTIVE, 8222);
-        RET_(ERROR_DS_OPERATIONS_ERROR, 8224);
-        RET_(ERROR_DS_PROTOCOL_ERROR, 8225);
-        RET_(ERROR_DS_TIMELIMIT_EXCEEDED, 8226);
-        RET_(ERROR_DS_SIZELIMIT_EXCEEDED, 8227);
-        RET_(ERROR_DS_ADMIN_LIMIT_EXCEEDED, 8228);
-        RET_(ERROR_DS_COMPARE_FALSE, 8229);
-        RET_(ERROR_DS_COMPARE_TRUE, 8230);
-        RET_(ERROR_DS_AUTH_METHOD_NOT_SUPPORTED, 8231);
-        RET_(ERROR_DS_STRONG_AUTH_REQUIRED, 8232);
-        RET_(ERROR_DS_INAPPROPRIATE_AUTH, 8233);
-        RET_(ERROR_DS_AUTH_UNKNOWN, 8234);
-        RET_(ERROR_DS_REFERRAL, 8235);
-        RET_(ERROR_DS_UNAVAILABLE_CRIT_EXTENSION, 8236);
-        RET_(ERROR_DS_CONFIDENTIALITY_REQUIRED, 8237);
-        RET_(ERROR_DS_INAPPROPRIATE_MATCHING, 8238);
-        RET_(ERROR_DS_CONSTRAINT_VIOLATION, 8239);
-        RET_(ERROR_DS_NO_SUCH_OBJECT, 8240);
-        RET_(ERROR_DS_ALIAS_PROBLEM, 8241);
-        RET_(ERROR_DS_INVALID_DN_SYNTAX, 8242);
-        RET_(ERROR_DS_IS_LEAF, 8243);
-        RET_(ERROR_DS_ALIAS_DEREF_PROBLEM, 8244);
-        RET_(ERROR_DS_UNWILLING_TO_PERFORM, 8245);
-        RET_(ERROR_DS_LOOP_DETECT, 8246);
-        RET_(ERROR_DS_NAMING_VIOLATION, 8247);
-        RET_(ERROR_DS_OBJECT_RESULTS_TOO_LARGE, 8248);
-        RET_(ERROR_DS_AFFECTS_MULTIPLE_DSAS, 8249);
-        RET_(ERROR_DS_SERVER_DOWN, 8250);
-        RET_(ERROR_DS_LOCAL_ERROR, 8251);
-        RET_(ERROR_DS_ENCODING_ERROR, 8252);
-        RET_(ERROR_DS_DECODING_ERROR, 8253);
-        RET_(ERROR_DS_FILTER_UNKNOWN, 8254);
-        RET_(ERROR_DS_PARAM_ERROR, 8255);
-        RET_(ERROR_DS_NOT_SUPPORTED, 8256);
-        RET_(ERROR_DS_NO_RESULTS_RETURNED, 8257);
-        RET_(ERROR_DS_CONTROL_NOT_FOUND, 8258);
-        RET_(ERROR_DS_CLIENT_LOOP, 8259);
-        RET_(ERROR_DS_REFERRAL_LIMIT_EXCEEDED, 8260);
-        RET_(ERROR_DS_SORT_CONTROL_MISSING, 8261);
-        RET_(ERROR_DS_OFFSET_RANGE_ERROR, 8262);
-        RET_(ERROR_DS_RIDMGR_DISABLED, 8263);
-        RET_(ERROR_DS_ROOT_MUST_BE_NC, 8301);
-        RET_(ERROR_DS_ADD_REPLICA_INHIBITED, 8302);
-        RET_(ERROR_DS_ATT_NOT_DEF_IN_SCHEMA, 8303);
-        RET_(ERROR_DS_MAX_OBJ_SIZE_EXCEEDED, 8304);
-        RET_(ERROR_DS_OBJ_STRING_NAME_EXISTS, 8305);
-        RET_(ERROR_DS_NO_RDN_DEFINED_IN_SCHEMA, 8306);
-        RET_(ERROR_DS_RDN_DOESNT_MATCH_SCHEMA, 8307);
-        RET_(ERROR_DS_NO_REQUESTED_ATTS_FOUND, 8308);
-        RET_(ERROR_DS_USER_BUFFER_TO_SMALL, 8309);
-        RET_(ERROR_DS_ATT_IS_NOT_ON_OBJ, 8310);
-        RET_(ERROR_DS_ILLEGAL_MOD_OPERATION, 8311);
-        RET_(ERROR_DS_OBJ_TOO_LARGE, 8312);
-        RET_(ERROR_DS_BAD_INSTANCE_TYPE, 8313);
-        RET_(ERROR_DS_MASTERDSA_REQUIRED, 8314);
-        RET_(ERROR_DS_OBJECT_CLASS_REQUIRED, 8315);
-        RET_(ERROR_DS_MISSING_REQUIRED_ATT, 8316);
-        RET_(ERROR_DS_ATT_NOT_DEF_FOR_CLASS, 8317);
-        RET_(ERROR_DS_ATT_ALREADY_EXISTS, 8318);
-        RET_(ERROR_DS_CANT_ADD_ATT_VALUES, 8320);
-        RET_(ERROR_DS_SINGLE_VALUE_CONSTRAINT, 8321);
-        RET_(ERROR_DS_RANGE_CONSTRAINT, 8322);
-        RET_(ERROR_DS_ATT_VAL_ALREADY_EXISTS, 8323);
-        RET_(ERROR_DS_CANT_REM_MISSING_ATT, 8324);
-        RET_(ERROR_DS_CANT_REM_MISSING_ATT_VAL, 8325);
-        RET_(ERROR_DS_ROOT_CANT_BE_SUBREF, 8326);
-        RET_(ERROR_DS_NO_CHAINING, 8327);
-        RET_(ERROR_DS_NO_CHAINED_EVAL, 8328);
-        RET_(ERROR_DS_NO_PARENT_OBJECT, 8329);
-        RET_(ERROR_DS_PARENT_IS_AN_ALIAS, 8330);
-        RET_(ERROR_DS_CANT_MIX_MASTER_AND_REPS, 8331);
-        RET_(ERROR_DS_CHILDREN_EXIST, 8332);
-        RET_(ERROR_DS_OBJ_NOT_FOUND, 8333);
-        RET_(ERROR_DS_ALIASED_OBJ_MISSING, 8334);
-        RET_(ERROR_DS_BAD_NAME_SYNTAX, 8335);
-        RET_(ERROR_DS_ALIAS_POINTS_TO_ALIAS, 8336);
-        RET_(ERROR_DS_CANT_DEREF_ALIAS, 8337);
-        RET_(ERROR_DS_OUT_OF_SCOPE, 8338);
-        RET_(ERROR_DS_OBJECT_BEING_REMOVED, 8339);
-        RET_(ERROR_DS_CANT_DELETE_DSA_OBJ, 8340);
-        RET_(ERROR_DS_GENERIC_ERROR, 8341);
-        RET_(ERROR_DS_DSA_MUST_BE_INT_MASTER, 8342);
-        RET_(ERROR_DS_CLASS_NOT_DSA, 8343);
-        RET_(ERROR_DS_INSUFF_ACCESS_RIGHTS, 8344);
-        RET_(ERROR_DS_ILLEGAL_SUPERIOR, 8345);
-        RET_(ERROR_DS_ATTRIBUTE_OWNED_BY_SAM, 8346);
-        RET_(ERROR_DS_NAME_TOO_MANY_PARTS, 8347);
-        RET_(ERROR_DS_NAME_TOO_LONG, 8348);
-        RET_(ERROR_DS_NAME_VALUE_TOO_LONG, 8349);
-        RET_(ERROR_DS_NAME_UNPARSEABLE, 8350);
-        RET_(ERROR_DS_NAME_TYPE_UNKNOWN, 8351);
-        RET_(ERROR_DS_NOT_AN_OBJECT, 8352);
-        RET_(ERROR_DS_SEC_DESC_TOO_SHORT, 8353);
-        RET_(ERROR_DS_SEC_DESC_INVALID, 8354);
-        RET_(ERROR_DS_NO_DELETED_NAME, 8355);
-        RET_(ERROR_DS_SUBREF_MUST_HAVE_PARENT, 8356);
-        RET_(ERROR_DS_NCNAME_MUST_BE_NC, 8357);
-        RET_(ERROR_DS_CANT_ADD_SYSTEM_ONLY, 8358);
-        RET_(ERROR_DS_CLASS_MUST_BE_CONCRETE, 8359);
-        RET_(ERROR_DS_INVALID_DMD, 8360);
-        RET_(ERROR_DS_OBJ_GUID_EXISTS, 8361);
-        RET_(ERROR_DS_NOT_ON_BACKLINK, 8362);
-        RET_(ERROR_DS_NO_CROSSREF_FOR_NC, 8363);
-        RET_(ERROR_DS_SHUTTING_DOWN, 8364);
-        RET_(ERROR_DS_UNKNOWN_OPERATION, 8365);
-        RET_(ERROR_DS_INVALID_ROLE_OWNER, 8366);
-        RET_(ERROR_DS_COULDNT_CONTACT_FSMO, 8367);
-        RET_(ERROR_DS_CROSS_NC_DN_RENAME, 8368);
-        RET_(ERROR_DS_CANT_MOD_SYSTEM_ONLY, 8369);
-        RET_(ERROR_DS_REPLICATOR_ONLY, 8370);
-        RET_(ERROR_DS_OBJ_CLASS_NOT_DEFINED, 8371);
-        RET_(ERROR_DS_OBJ_CLASS_NOT_SUBCLASS, 8372);
-        RET_(ERROR_DS_NAME_REFERENCE_INVALID, 8373);
-        RET_(ERROR_DS_CROSS_REF_EXISTS, 8374);
-        RET_(ERROR_DS_CANT_DEL_MASTER_CROSSREF, 8375);
-        RET_(ERROR_DS_SUBTREE_NOTIFY_NOT_NC_HEAD, 8376);
-        RET_(ERROR_DS_NOTIFY_FILTER_TOO_COMPLEX, 8377);
-        RET_(ERROR_DS_DUP_RDN, 8378);
-        RET_(ERROR_DS_DUP_OID, 8379);
-        RET_(ERROR_DS_DUP_MAPI_ID, 8380);
-        RET_(ERROR_DS_DUP_SCHEMA_ID_GUID, 8381);
-        RET_(ERROR_DS_DUP_LDAP_DISPLAY_NAME, 8382);
-        RET_(ERROR_DS_SEMANTIC_ATT_TEST, 8383);
-        RET_(ERROR_DS_SYNTAX_MISMATCH, 8384);
-        RET_(ERROR_DS_EXISTS_IN_MUST_HAVE, 8385);
-        RET_(ERROR_DS_EXISTS_IN_MAY_HAVE, 8386);
-        RET_(ERROR_DS_NONEXISTENT_MAY_HAVE, 8387);
-        RET_(ERROR_DS_NONEXISTENT_MUST_HAVE, 8388);
-        RET_(ERROR_DS_AUX_CLS_TEST_FAIL, 8389);
-        RET_(ERROR_DS_NONEXISTENT_POSS_SUP, 8390);
-        RET_(ERROR_DS_SUB_CLS_TEST_FAIL, 8391);
-        RET_(ERROR_DS_BAD_RDN_ATT_ID_SYNTAX, 8392);
-        RET_(ERROR_DS_EXISTS_IN_AUX_CLS, 8393);
-        RET_(ERROR_DS_EXISTS_IN_SUB_CLS, 8394);
-        RET_(ERROR_DS_EXISTS_IN_POSS_SUP, 8395);
-        RET_(ERROR_DS_RECALCSCHEMA_FAILED, 8396);
-        RET_(ERROR_DS_TREE_DELETE_NOT_FINISHED, 8397);
-        RET_(ERROR_DS_CANT_DELETE, 8398);
-        RET_(ERROR_DS_ATT_SCHEMA_REQ_ID, 8399);
-        RET_(ERROR_DS_BAD_ATT_SCHEMA_SYNTAX, 8400);
-        RET_(ERROR_DS_CANT_CACHE_ATT, 8401);
-        RET_(ERROR_DS_CANT_CACHE_CLASS, 8402);
-        RET_(ERROR_DS_CANT_REMOVE_ATT_CACHE, 8403);
-        RET_(ERROR_DS_CANT_REMOVE_CLASS_CACHE, 8404);
-        RET_(ERROR_DS_CANT_RETRIEVE_DN, 8405);
-        RET_(ERROR_DS_MISSING_SUPREF, 8406);
-        RET_(ERROR_DS_CANT_RETRIEVE_INSTANCE, 8407);
-        RET_(ERROR_DS_CODE_INCONSISTENCY, 8408);
-        RET_(ERROR_DS_DATABASE_ERROR, 8409);
-        RET_(ERROR_DS_GOVERNSID_MISSING, 8410);
-        RET_(ERROR_DS_MISSING_EXPECTED_ATT, 8411);
-        RET_(ERROR_DS_NCNAME_MISSING_CR_REF, 8412);
-        RET_(ERROR_DS_SECURITY_CHECKING_ERROR, 8413);
-        RET_(ERROR_DS_SCHEMA_NOT_LOADED, 8414);
-        RET_(ERROR_DS_SCHEMA_ALLOC_FAILED, 8415);
-        RET_(ERROR_DS_ATT_SCHEMA_REQ_SYNTAX, 8416);
-        RET_(ERROR_DS_GCVERIFY_ERROR, 8417);
-        RET_(ERROR_DS_DRA_SCHEMA_MISMATCH, 8418);
-        RET_(ERROR_DS_CANT_FIND_DSA_OBJ, 8419);
-        RET_(ERROR_DS_CANT_FIND_EXPECTED_NC, 8420);
-        RET_(ERROR_DS_CANT_FIND_NC_IN_CACHE, 8421);
-        RET_(ERROR_DS_CANT_RETRIEVE_CHILD, 8422);
-        RET_(ERROR_DS_SECURITY_ILLEGAL_MODIFY, 8423);
-        RET_(ERROR_DS_CANT_REPLACE_HIDDEN_REC, 8424);
-        RET_(ERROR_DS_BAD_HIERARCHY_FILE, 8425);
-        RET_(ERROR_DS_BUILD_HIERARCHY_TABLE_FAILED, 8426);
-        RET_(ERROR_DS_CONFIG_PARAM_MISSING, 8427);
-        RET_(ERROR_DS_COUNTING_AB_INDICES_FAILED, 8428);
-        RET_(ERROR_DS_HIERARCHY_TABLE_MALLOC_FAILED, 8429);
-        RET_(ERROR_DS_INTERNAL_FAILURE, 8430);
-        RET_(ERROR_DS_UNKNOWN_ERROR, 8431);
-        RET_(ERROR_DS_ROOT_REQUIRES_CLASS_TOP, 8432);
-        RET_(ERROR_DS_REFUSING_FSMO_ROLES, 8433);
-        RET_(ERROR_DS_MISSING_FSMO_SETTINGS, 8434);
-        RET_(ERROR_DS_UNABLE_TO_SURRENDER_ROLES, 8435);
-        RET_(ERROR_DS_DRA_GENERIC, 8436);
-        RET_(ERROR_DS_DRA_INVALID_PARAMETER, 8437);
-        RET_(ERROR_DS_DRA_BUSY, 8438);
-        RET_(ERROR_DS_DRA_BAD_DN, 8439);
-        RET_(ERROR_DS_DRA_BAD_NC, 8440);
-        RET_(ERROR_DS_DRA_DN_EXISTS, 8441);
-        RET_(ERROR_DS_DRA_INTERNAL_ERROR, 8442);
-        RET_(ERROR_DS_DRA_INCONSISTENT_DIT, 8443);
-        RET_(ERROR_DS_DRA_CONNECTION_FAILED, 8444);
-        RET_(ERROR_DS_DRA_BAD_INSTANCE_TYPE, 8445);
-        RET_(ERROR_DS_DRA_OUT_OF_MEM, 8446);
-        RET_(ERROR_DS_DRA_MAIL_PROBLEM, 8447);
-        RET_(ERROR_DS_DRA_REF_ALREADY_EXISTS, 8448);
-        RET_(ERROR_DS_DRA_REF_NOT_FOUND, 8449);
-        RET_(ERROR_DS_DRA_OBJ_IS_REP_SOURCE, 8450);
-        RET_(ERROR_DS_DRA_DB_ERROR, 8451);
-        RET_(ERROR_DS_DRA_NO_REPLICA, 8452);
-        RET_(ERROR_DS_DRA_ACCESS_DENIED, 8453);
-        RET_(ERROR_DS_DRA_NOT_SUPPORTED, 8454);
-        RET_(ERROR_DS_DRA_RPC_CANCELLED, 8455);
-        RET_(ERROR_DS_DRA_SOURCE_DISABLED, 8456);
-        RET_(ERROR_DS_DRA_SINK_DISABLED, 8457);
-        RET_(ERROR_DS_DRA_NAME_COLLISION, 8458);
-        RET_(ERROR_DS_DRA_SOURCE_REINSTALLED, 8459);
-        RET_(ERROR_DS_DRA_MISSING_PARENT, 8460);
-        RET_(ERROR_DS_DRA_PREEMPTED, 8461);
-        RET_(ERROR_DS_DRA_ABANDON_SYNC, 8462);
-        RET_(ERROR_DS_DRA_SHUTDOWN, 8463);
-        RET_(ERROR_DS_DRA_INCOMPATIBLE_PARTIAL_SET, 8464);
-        RET_(ERROR_DS_DRA_SOURCE_IS_PARTIAL_REPLICA, 8465);
-        RET_(ERROR_DS_DRA_EXTN_CONNECTION_FAILED, 8466);
-        RET_(ERROR_DS_INSTALL_SCHEMA_MISMATCH, 8467);
-        RET_(ERROR_DS_DUP_LINK_ID, 8468);
-        RET_(ERROR_DS_NAME_ERROR_RESOLVING, 8469);
-        RET_(ERROR_DS_NAME_ERROR_NOT_FOUND, 8470);
-        RET_(ERROR_DS_NAME_ERROR_NOT_UNIQUE, 8471);
-        RET_(ERROR_DS_NAME_ERROR_NO_MAPPING, 8472);
-        RET_(ERROR_DS_NAME_ERROR_DOMAIN_ONLY, 8473);
-        RET_(ERROR_DS_NAME_ERROR_NO_SYNTACTICAL_MAPPING, 8474);
-        RET_(ERROR_DS_CONSTRUCTED_ATT_MOD, 8475);
-        RET_(ERROR_DS_WRONG_OM_OBJ_CLASS, 8476);
-        RET_(ERROR_DS_DRA_REPL_PENDING, 8477);
-        RET_(ERROR_DS_DS_REQUIRED, 8478);
-        RET_(ERROR_DS_INVALID_LDAP_DISPLAY_NAME, 8479);
-        RET_(ERROR_DS_NON_BASE_SEARCH, 8480);
-        RET_(ERROR_DS_CANT_RETRIEVE_ATTS, 8481);
-        RET_(ERROR_DS_BACKLINK_WITHOUT_LINK, 8482);
-        RET_(ERROR_DS_EPOCH_MISMATCH, 8483);
-        RET_(ERROR_DS_SRC_NAME_MISMATCH, 8484);
-        RET_(ERROR_DS_SRC_AND_DST_NC_IDENTICAL, 8485);
-        RET_(ERROR_DS_DST_NC_MISMATCH, 8486);
-        RET_(ERROR_DS_NOT_AUTHORITIVE_FOR_DST_NC, 8487);
-        RET_(ERROR_DS_SRC_GUID_MISMATCH, 8488);
-        RET_(ERROR_DS_CANT_MOVE_DELETED_OBJECT, 8489);
-        RET_(ERROR_DS_PDC_OPERATION_IN_PROGRESS, 8490);
-        RET_(ERROR_DS_CROSS_DOMAIN_CLEANUP_REQD, 8491);
-        RET_(ERROR_DS_ILLEGAL_XDOM_MOVE_OPERATION, 8492);
-        RET_(ERROR_DS_CANT_WITH_ACCT_GROUP_MEMBERSHPS, 8493);
-        RET_(ERROR_DS_NC_MUST_HAVE_NC_PARENT, 8494);
-        RET_(ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE, 8495);
-        RET_(ERROR_DS_DST_DOMAIN_NOT_NATIVE, 8496);
-        RET_(ERROR_DS_MISSING_INFRASTRUCTURE_CONTAINER, 8497);
-        RET_(ERROR_DS_CANT_MOVE_ACCOUNT_GROUP, 8498);
-        RET_(ERROR_DS_CANT_MOVE_RESOURCE_GROUP, 8499);
-        RET_(ERROR_DS_INVALID_SEARCH_FLAG, 8500);
-        RET_(ERROR_DS_NO_TREE_DELETE_ABOVE_NC, 8501);
-        RET_(ERROR_DS_COULDNT_LOCK_TREE_FOR_DELETE, 8502);
-        RET_(ERROR_DS_COULDNT_IDENTIFY_OBJECTS_FOR_TREE_DELETE, 8503);
-        RET_(ERROR_DS_SAM_INIT_FAILURE, 8504);
-        RET_(ERROR_DS_SENSITIVE_GROUP_VIOLATION, 8505);
-        RET_(ERROR_DS_CANT_MOD_PRIMARYGROUPID, 8506);
-        RET_(ERROR_DS_ILLEGAL_BASE_SCHEMA_MOD, 8507);
-        RET_(ERROR_DS_NONSAFE_SCHEMA_CHANGE, 8508);
-        RET_(ERROR_DS_SCHEMA_UPDATE_DISALLOWED, 8509);
-        RET_(ERROR_DS_CANT_CREATE_UNDER_SCHEMA, 8510);
-        RET_(ERROR_DS_INSTALL_NO_SRC_SCH_VERSION, 8511);
-        RET_(ERROR_DS_INSTALL_NO_SCH_VERSION_IN_INIFILE, 8512);
-        RET_(ERROR_DS_INVALID_GROUP_TYPE, 8513);
-        RET_(ERROR_DS_NO_NEST_GLOBALGROUP_IN_MIXEDDOMAIN, 8514);
-        RET_(ERROR_DS_NO_NEST_LOCALGROUP_IN_MIXEDDOMAIN, 8515);
-        RET_(ERROR_DS_GLOBAL_CANT_HAVE_LOCAL_MEMBER, 8516);
-        RET_(ERROR_DS_GLOBAL_CANT_HAVE_UNIVERSAL_MEMBER, 8517);
-        RET_(ERROR_DS_UNIVERSAL_CANT_HAVE_LOCAL_MEMBER, 8518);
-        RET_(ERROR_DS_GLOBAL_CANT_HAVE_CROSSDOMAIN_MEMBER, 8519);
-        RET_(ERROR_DS_LOCAL_CANT_HAVE_CROSSDOMAIN_LOCAL_MEMBER, 8520);
-        RET_(ERROR_DS_HAVE_PRIMARY_MEMBERS, 8521);
-        RET_(ERROR_DS_STRING_SD_CONVERSION_FAILED, 8522);
-        RET_(ERROR_DS_NAMING_MASTER_GC, 8523);
-        RET_(ERROR_DS_DNS_LOOKUP_FAILURE, 8524);
-        RET_(ERROR_DS_COULDNT_UPDATE_SPNS, 8525);
-        RET_(ERROR_DS_CANT_RETRIEVE_SD, 8526);
-        RET_(ERROR_DS_KEY_NOT_UNIQUE, 8527);
-        RET_(ERROR_DS_WRONG_LINKED_ATT_SYNTAX, 8528);
-        RET_(ERROR_DS_SAM_NEED_BOOTKEY_PASSWORD, 8529);
-        RET_(ERROR_DS_SAM_NEED_BOOTKEY_FLOPPY, 8530);
-        RET_(ERROR_DS_CANT_START, 8531);
-        RET_(ERROR_DS_INIT_FAILURE, 8532);
-        RET_(ERROR_DS_NO_PKT_PRIVACY_ON_CONNECTION, 8533);
-        RET_(ERROR_DS_SOURCE_DOMAIN_IN_FOREST, 8534);
-        RET_(ERROR_DS_DESTINATION_DOMAIN_NOT_IN_FOREST, 8535);
-        RET_(ERROR_DS_DESTINATION_AUDITING_NOT_ENABLED, 8536);
-        RET_(ERROR_DS_CANT_FIND_DC_FOR_SRC_DOMAIN, 8537);
-        RET_(ERROR_DS_SRC_OBJ_NOT_GROUP_OR_USER, 8538);
-        RET_(ERROR_DS_SRC_SID_EXISTS_IN_FOREST, 8539);
-        RET_(ERROR_DS_SRC_AND_DST_OBJECT_CLASS_MISMATCH, 8540);
-        RET_(ERROR_SAM_INIT_FAILURE, 8541);
-        RET_(ERROR_DS_DRA_SCHEMA_INFO_SHIP, 8542);
-        RET_(ERROR_DS_DRA_SCHEMA_CONFLICT, 8543);
-        RET_(ERROR_DS_DRA_EARLIER_SCHEMA_CONFLICT, 8544);
-        RET_(ERROR_DS_DRA_OBJ_NC_MISMATCH, 8545);
-        RET_(ERROR_DS_NC_STILL_HAS_DSAS, 8546);
-        RET_(ERROR_DS_GC_REQUIRED, 8547);
-        RET_(ERROR_DS_LOCAL_MEMBER_OF_LOCAL_ONLY, 8548);
-        RET_(ERROR_DS_NO_FPO_IN_UNIVERSAL_GROUPS, 8549);
-        RET_(ERROR_DS_CANT_ADD_TO_GC, 8550);
-        RET_(ERROR_DS_NO_CHECKPOINT_WITH_PDC, 8551);
-        RET_(ERROR_DS_SOURCE_AUDITING_NOT_ENABLED, 8552);
-        RET_(ERROR_DS_CANT_CREATE_IN_NONDOMAIN_NC, 8553);
-        RET_(ERROR_DS_INVALID_NAME_FOR_SPN, 8554);
-        RET_(ERROR_DS_FILTER_USES_CONTRUCTED_ATTRS, 8555);
-        RET_(ERROR_DS_UNICODEPWD_NOT_IN_QUOTES, 8556);
-        RET_(ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED, 8557);
-        RET_(ERROR_DS_MUST_BE_RUN_ON_DST_DC, 8558);
-        RET_(ERROR_DS_SRC_DC_MUST_BE_SP4_OR_GREATER, 8559);
-        RET_(ERROR_DS_CANT_TREE_DELETE_CRITICAL_OBJ, 8560);
-        RET_(ERROR_DS_INIT_FAILURE_CONSOLE, 8561);
-        RET_(ERROR_DS_SAM_INIT_FAILURE_CONSOLE, 8562);
-        RET_(ERROR_DS_FOREST_VERSION_TOO_HIGH, 8563);
-        RET_(ERROR_DS_DOMAIN_VERSION_TOO_HIGH, 8564);
-        RET_(ERROR_DS_FOREST_VERSION_TOO_LOW, 8565);
-        RET_(ERROR_DS_DOMAIN_VERSION_TOO_LOW, 8566);
-        RET_(ERROR_DS_INCOMPATIBLE_VERSION, 8567);
-        RET_(ERROR_DS_LOW_DSA_VERSION, 8568);
-        RET_(ERROR_DS_NO_BEHAVIOR_VERSION_IN_MIXEDDOMAIN, 8569);
-        RET_(ERROR_DS_NOT_SUPPORTED_SORT_ORDER, 8570);
-        RET_(ERROR_DS_NAME_NOT_UNIQUE, 8571);
-        RET_(ERROR_DS_MACHINE_ACCOUNT_CREATED_PRENT4, 8572);
-        RET_(ERROR_DS_OUT_OF_VERSION_STORE, 8573);
-        RET_(ERROR_DS_INCOMPATIBLE_CONTROLS_USED, 8574);
-        RET_(ERROR_DS_NO_REF_DOMAIN, 8575);
-        RET_(ERROR_DS_RESERVED_LINK_ID, 8576);
-        RET_(ERROR_DS_LINK_ID_NOT_AVAILABLE, 8577);
-        RET_(ERROR_DS_AG_CANT_HAVE_UNIVERSAL_MEMBER, 8578);
-        RET_(ERROR_DS_MODIFYDN_DISALLOWED_BY_INSTANCE_TYPE, 8579);
-        RET_(ERROR_DS_NO_OBJECT_MOVE_IN_SCHEMA_NC, 8580);
-        RET_(ERROR_DS_MODIFYDN_DISALLOWED_BY_FLAG, 8581);
-        RET_(ERROR_DS_MODIFYDN_WRONG_GRANDPARENT, 8582);
-        RET_(ERROR_DS_NAME_ERROR_TRUST_REFERRAL, 8583);
-        RET_(ERROR_NOT_SUPPORTED_ON_STANDARD_SERVER, 8584);
-        RET_(ERROR_DS_CANT_ACCESS_REMOTE_PART_OF_AD, 8585);
-        RET_(ERROR_DS_CR_IMPOSSIBLE_TO_VALIDATE_V2, 8586);
-        RET_(ERROR_DS_THREAD_LIMIT_EXCEEDED, 8587);
-        RET_(ERROR_DS_NOT_CLOSEST, 8588);
-        RET_(ERROR_DS_CANT_DERIVE_SPN_WITHOUT_SERVER_REF, 8589);
-        RET_(ERROR_DS_SINGLE_USER_MODE_FAILED, 8590);
-        RET_(ERROR_DS_NTDSCRIPT_SYNTAX_ERROR, 8591);
-        RET_(ERROR_DS_NTDSCRIPT_PROCESS_ERROR, 8592);
-        RET_(ERROR_DS_DIFFERENT_REPL_EPOCHS, 8593);
-        RET_(ERROR_DS_DRS_EXTENSIONS_CHANGED, 8594);
-        RET_(ERROR_DS_REPLICA_SET_CHANGE_NOT_ALLOWED_ON_DISABLED_CR, 8595);
-        RET_(ERROR_DS_NO_MSDS_INTID, 8596);
-        RET_(ERROR_DS_DUP_MSDS_INTID, 8597);
-        RET_(ERROR_DS_EXISTS_IN_RDNATTID, 8598);
-        RET_(ERROR_DS_AUTHORIZATION_FAILED, 8599);
-        RET_(ERROR_DS_INVALID_SCRIPT, 8600);
-        RET_(ERROR_DS_REMOTE_CROSSREF_OP_FAILED, 8601);
-        RET_(ERROR_DS_CROSS_REF_BUSY, 8602);
-        RET_(ERROR_DS_CANT_DERIVE_SPN_FOR_DELETED_DOMAIN, 8603);
-        RET_(ERROR_DS_CANT_DEMOTE_WITH_WRITEABLE_NC, 8604);
-        RET_(ERROR_DS_DUPLICATE_ID_FOUND, 8605);
-        RET_(ERROR_DS_INSUFFICIENT_ATTR_TO_CREATE_OBJECT, 8606);
-        RET_(ERROR_DS_GROUP_CONVERSION_ERROR, 8607);
-        RET_(ERROR_DS_CANT_MOVE_APP_BASIC_GROUP, 8608);
-        RET_(ERROR_DS_CANT_MOVE_APP_QUERY_GROUP, 8609);
-        RET_(ERROR_DS_ROLE_NOT_VERIFIED, 8610);
-        RET_(ERROR_DS_WKO_CONTAINER_CANNOT_BE_SPECIAL, 8611);
-        RET_(ERROR_DS_DOMAIN_RENAME_IN_PROGRESS, 8612);
-        RET_(ERROR_DS_EXISTING_AD_CHILD_NC, 8613);
-        RET_(ERROR_DS_REPL_LIFETIME_EXCEEDED, 8614);
-        RET_(ERROR_DS_DISALLOWED_IN_SYSTEM_CONTAINER, 8615);
-        RET_(ERROR_DS_LDAP_SEND_QUEUE_FULL, 8616);
-        RET_(ERROR_DS_DRA_OUT_SCHEDULE_WINDOW, 8617);
-        RET_(ERROR_DS_POLICY_NOT_KNOWN, 8618);
-        RET_(ERROR_NO_SITE_SETTINGS_OBJECT, 8619);
-        RET_(ERROR_NO_SECRETS, 8620);
-        RET_(ERROR_NO_WRITABLE_DC_FOUND, 8621);
-        RET_(ERROR_DS_NO_SERVER_OBJECT, 8622);
-        RET_(ERROR_DS_NO_NTDSA_OBJECT, 8623);
-        RET_(ERROR_DS_NON_ASQ_SEARCH, 8624);
-        RET_(ERROR_DS_AUDIT_FAILURE, 8625);
-        RET_(ERROR_DS_INVALID_SEARCH_FLAG_SUBTREE, 8626);
-        RET_(ERROR_DS_INVALID_SEARCH_FLAG_TUPLE, 8627);
-        RET_(ERROR_DS_HIERARCHY_TABLE_TOO_DEEP, 8628);
-        RET_(ERROR_DS_DRA_CORRUPT_UTD_VECTOR, 8629);
-        RET_(ERROR_DS_DRA_SECRETS_DENIED, 8630);
-        RET_(ERROR_DS_RESERVED_MAPI_ID, 8631);
-        RET_(ERROR_DS_MAPI_ID_NOT_AVAILABLE, 8632);
-        RET_(ERROR_DS_DRA_MISSING_KRBTGT_SECRET, 8633);
-        RET_(ERROR_DS_DOMAIN_NAME_EXISTS_IN_FOREST, 8634);
-        RET_(ERROR_DS_FLAT_NAME_EXISTS_IN_FOREST, 8635);
-        RET_(ERROR_INVALID_USER_PRINCIPAL_NAME, 8636);
-        RET_(ERROR_DS_OID_MAPPED_GROUP_CANT_HAVE_MEMBERS, 8637);
-        RET_(ERROR_DS_OID_NOT_FOUND, 8638);
-        RET_(ERROR_DS_DRA_RECYCLED_TARGET, 8639);
-        RET_(ERROR_DS_DISALLOWED_NC_REDIRECT, 8640);
-        RET_(ERROR_DS_HIGH_ADLDS_FFL, 8641);
-        RET_(ERROR_DS_HIGH_DSA_VERSION, 8642);
-        RET_(ERROR_DS_LOW_ADLDS_FFL, 8643);
-        RET_(ERROR_DOMAIN_SID_SAME_AS_LOCAL_WORKSTATION, 8644);
-        RET_(ERROR_DS_UNDELETE_SAM_VALIDATION_FAILED, 8645);
-        RET_(ERROR_INCORRECT_ACCOUNT_TYPE, 8646);
-        RET_(ERROR_DS_SPN_VALUE_NOT_UNIQUE_IN_FOREST, 8647);
-        RET_(ERROR_DS_UPN_VALUE_NOT_UNIQUE_IN_FOREST, 8648);
-        RET_(ERROR_DS_MISSING_FOREST_TRUST, 8649);
-        RET_(ERROR_DS_VALUE_KEY_NOT_UNIQUE, 8650);
-        RET_(ERROR_WEAK_WHFBKEY_BLOCKED, 8651);
-        RET_(DNS_ERROR_MASK, 9000);
-        RET_(DNS_ERROR_RCODE_FORMAT_ERROR, 9001);
-        RET_(DNS_ERROR_RCODE_SERVER_FAILURE, 9002);
-        RET_(DNS_ERROR_RCODE_NAME_ERROR, 9003);
-        RET_(DNS_ERROR_RCODE_NOT_IMPLEMENTED, 9004);
-        RET_(DNS_ERROR_RCODE_REFUSED, 9005);
-        RET_(DNS_ERROR_RCODE_YXDOMAIN, 9006);
-        RET_(DNS_ERROR_RCODE_YXRRSET, 9007);
-        RET_(DNS_ERROR_RCODE_NXRRSET, 9008);
-        RET_(DNS_ERROR_RCODE_NOTAUTH, 9009);
-        RET_(DNS_ERROR_RCODE_NOTZONE, 9010);
-        RET_(DNS_ERROR_RCODE_BADSIG, 9016);
-        RET_(DNS_ERROR_RCODE_BADKEY, 9017);
-        RET_(DNS_ERROR_RCODE_BADTIME, 9018);
-        RET_(DNS_ERROR_DNSSEC_BASE, 9100);
-        RET_(DNS_ERROR_KEYMASTER_REQUIRED, 9101);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_SIGNED_ZONE, 9102);
-        RET_(DNS_ERROR_NSEC3_INCOMPATIBLE_WITH_RSA_SHA1, 9103);
-        RET_(DNS_ERROR_NOT_ENOUGH_SIGNING_KEY_DESCRIPTORS, 9104);
-        RET_(DNS_ERROR_UNSUPPORTED_ALGORITHM, 9105);
-        RET_(DNS_ERROR_INVALID_KEY_SIZE, 9106);
-        RET_(DNS_ERROR_SIGNING_KEY_NOT_ACCESSIBLE, 9107);
-        RET_(DNS_ERROR_KSP_DOES_NOT_SUPPORT_PROTECTION, 9108);
-        RET_(DNS_ERROR_UNEXPECTED_DATA_PROTECTION_ERROR, 9109);
-        RET_(DNS_ERROR_UNEXPECTED_CNG_ERROR, 9110);
-        RET_(DNS_ERROR_UNKNOWN_SIGNING_PARAMETER_VERSION, 9111);
-        RET_(DNS_ERROR_KSP_NOT_ACCESSIBLE, 9112);
-        RET_(DNS_ERROR_TOO_MANY_SKDS, 9113);
-        RET_(DNS_ERROR_INVALID_ROLLOVER_PERIOD, 9114);
-        RET_(DNS_ERROR_INVALID_INITIAL_ROLLOVER_OFFSET, 9115);
-        RET_(DNS_ERROR_ROLLOVER_IN_PROGRESS, 9116);
-        RET_(DNS_ERROR_STANDBY_KEY_NOT_PRESENT, 9117);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_ZSK, 9118);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_ACTIVE_SKD, 9119);
-        RET_(DNS_ERROR_ROLLOVER_ALREADY_QUEUED, 9120);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_UNSIGNED_ZONE, 9121);
-        RET_(DNS_ERROR_BAD_KEYMASTER, 9122);
-        RET_(DNS_ERROR_INVALID_SIGNATURE_VALIDITY_PERIOD, 9123);
-        RET_(DNS_ERROR_INVALID_NSEC3_ITERATION_COUNT, 9124);
-        RET_(DNS_ERROR_DNSSEC_IS_DISABLED, 9125);
-        RET_(DNS_ERROR_INVALID_XML, 9126);
-        RET_(DNS_ERROR_NO_VALID_TRUST_ANCHORS, 9127);
-        RET_(DNS_ERROR_ROLLOVER_NOT_POKEABLE, 9128);
-        RET_(DNS_ERROR_NSEC3_NAME_COLLISION, 9129);
-        RET_(DNS_ERROR_NSEC_INCOMPATIBLE_WITH_NSEC3_RSA_SHA1, 9130);
-        RET_(DNS_ERROR_PACKET_FMT_BASE, 9500);
-        RET_(DNS_ERROR_BAD_PACKET, 9502);
-        RET_(DNS_ERROR_NO_PACKET, 9503);
-        RET_(DNS_ERROR_RCODE, 9504);
-        RET_(DNS_ERROR_UNSECURE_PACKET, 9505);
-        RET_(DNS_ERROR_GENERAL_API_BASE, 9550);
-        RET_(DNS_ERROR_INVALID_TYPE, 9551);
-        RET_(DNS_ERROR_INVALID_IP_ADDRESS, 9552);
-        RET_(DNS_ERROR_INVALID_PROPERTY, 9553);
-        RET_(DNS_ERROR_TRY_AGAIN_LATER, 9554);
-        RET_(DNS_ERROR_NOT_UNIQUE, 9555);
-        RET_(DNS_ERROR_NON_RFC_NAME, 9556);
-        RET_(DNS_ERROR_INVALID_NAME_CHAR, 9560);
-        RET_(DNS_ERROR_NUMERIC_NAME, 9561);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_ROOT_SERVER, 9562);
-        RET_(DNS_ERROR_NOT_ALLOWED_UNDER_DELEGATION, 9563);
-        RET_(DNS_ERROR_CANNOT_FIND_ROOT_HINTS, 9564);
-        RET_(DNS_ERROR_INCONSISTENT_ROOT_HINTS, 9565);
-        RET_(DNS_ERROR_DWORD_VALUE_TOO_SMALL, 9566);
-        RET_(DNS_ERROR_DWORD_VALUE_TOO_LARGE, 9567);
-        RET_(DNS_ERROR_BACKGROUND_LOADING, 9568);
-        RET_(DNS_ERROR_NOT_ALLOWED_ON_RODC, 9569);
-        RET_(DNS_ERROR_NOT_ALLOWED_UNDER_DNAME, 9570);
-        RET_(DNS_ERROR_DELEGATION_REQUIRED, 9571);
-        RET_(DNS_ERROR_INVALID_POLICY_TABLE, 9572);
-        RET_(DNS_ERROR_ADDRESS_REQUIRED, 9573);
-        RET_(DNS_ERROR_ZONE_BASE, 9600);
-        RET_(DNS_ERROR_ZONE_DOES_NOT_EXIST, 9601);
-        RET_(DNS_ERROR_NO_ZONE_INFO, 9602);
-        RET_(DNS_ERROR_INVALID_ZONE_OPERATION, 9603);
-        RET_(DNS_ERROR_ZONE_CONFIGURATION_ERROR, 9604);
-        RET_(DNS_ERROR_ZONE_HAS_NO_SOA_RECORD, 9605);
-        RET_(DNS_ERROR_ZONE_HAS_NO_NS_RECORDS, 9606);
-        RET_(DNS_ERROR_ZONE_LOCKED, 9607);
-        RET_(DNS_ERROR_ZONE_CREATION_FAILED, 9608);
-        RET_(DNS_ERROR_ZONE_ALREADY_EXISTS, 9609);
-        RET_(DNS_ERROR_AUTOZONE_ALREADY_EXISTS, 9610);
-        RET_(DNS_ERROR_INVALID_ZONE_TYPE, 9611);
-        RET_(DNS_ERROR_SECONDARY_REQUIRES_MASTER_IP, 9612);
-        RET_(DNS_ERROR_ZONE_NOT_SECONDARY, 9613);
-        RET_(DNS_ERROR_NEED_SECONDARY_ADDRESSES, 9614);
-        RET_(DNS_ERROR_WINS_INIT_FAILED, 9615);
-        RET_(DNS_ERROR_NEED_WINS_SERVERS, 9616);
-        RET_(DNS_ERROR_NBSTAT_INIT_FAILED, 9617);
-        RET_(DNS_ERROR_SOA_DELETE_INVALID, 9618);
-        RET_(DNS_ERROR_FORWARDER_ALREADY_EXISTS, 9619);
-        RET_(DNS_ERROR_ZONE_REQUIRES_MASTER_IP, 9620);
-        RET_(DNS_ERROR_ZONE_IS_SHUTDOWN, 9621);
-        RET_(DNS_ERROR_ZONE_LOCKED_FOR_SIGNING, 9622);
-        RET_(DNS_ERROR_DATAFILE_BASE, 9650);
-        RET_(DNS_ERROR_PRIMARY_REQUIRES_DATAFILE, 9651);
-        RET_(DNS_ERROR_INVALID_DATAFILE_NAME, 9652);
-        RET_(DNS_ERROR_DATAFILE_OPEN_FAILURE, 9653);
-        RET_(DNS_ERROR_FILE_WRITEBACK_FAILED, 9654);
-        RET_(DNS_ERROR_DATAFILE_PARSING, 9655);
-        RET_(DNS_ERROR_DATABASE_BASE, 9700);
-        RET_(DNS_ERROR_RECORD_DOES_NOT_EXIST, 9701);
-        RET_(DNS_ERROR_RECORD_FORMAT, 9702);
-        RET_(DNS_ERROR_NODE_CREATION_FAILED, 9703);
-        RET_(DNS_ERROR_UNKNOWN_RECORD_TYPE, 9704);
-        RET_(DNS_ERROR_RECORD_TIMED_OUT, 9705);
-        RET_(DNS_ERROR_NAME_NOT_IN_ZONE, 9706);
-        RET_(DNS_ERROR_CNAME_LOOP, 9707);
-        RET_(DNS_ERROR_NODE_IS_CNAME, 9708);
-        RET_(DNS_ERROR_CNAME_COLLISION, 9709);
-        RET_(DNS_ERROR_RECORD_ONLY_AT_ZONE_ROOT, 9710);
-        RET_(DNS_ERROR_RECORD_ALREADY_EXISTS, 9711);
-        RET_(DNS_ERROR_SECONDARY_DATA, 9712);
-        RET_(DNS_ERROR_NO_CREATE_CACHE_DATA, 9713);
-        RET_(DNS_ERROR_NAME_DOES_NOT_EXIST, 9714);
-        RET_(DNS_ERROR_DS_UNAVAILABLE, 9717);
-        RET_(DNS_ERROR_DS_ZONE_ALREADY_EXISTS, 9718);
-        RET_(DNS_ERROR_NO_BOOTFILE_IF_DS_ZONE, 9719);
-        RET_(DNS_ERROR_NODE_IS_DNAME, 9720);
-        RET_(DNS_ERROR_DNAME_COLLISION, 9721);
-        RET_(DNS_ERROR_ALIAS_LOOP, 9722);
-        RET_(DNS_ERROR_OPERATION_BASE, 9750);
-        RET_(DNS_ERROR_AXFR, 9752);
-        RET_(DNS_ERROR_SECURE_BASE, 9800);
-        RET_(DNS_ERROR_SETUP_BASE, 9850);
-        RET_(DNS_ERROR_NO_TCPIP, 9851);
-        RET_(DNS_ERROR_NO_DNS_SERVERS, 9852);
-        RET_(DNS_ERROR_DP_BASE, 9900);
-        RET_(DNS_ERROR_DP_DOES_NOT_EXIST, 9901);
-        RET_(DNS_ERROR_DP_ALREADY_EXISTS, 9902);
-        RET_(DNS_ERROR_DP_NOT_ENLISTED, 9903);
-        RET_(DNS_ERROR_DP_ALREADY_ENLISTED, 9904);
-        RET_(DNS_ERROR_DP_NOT_AVAILABLE, 9905);
-        RET_(DNS_ERROR_DP_FSMO_ERROR, 9906);
-        RET_(DNS_ERROR_RRL_NOT_ENABLED, 9911);
-        RET_(DNS_ERROR_RRL_INVALID_WINDOW_SIZE, 9912);
-        RET_(DNS_ERROR_RRL_INVALID_IPV4_PREFIX, 9913);
-        RET_(DNS_ERROR_RRL_INVALID_IPV6_PREFIX, 9914);
-        RET_(DNS_ERROR_RRL_INVALID_TC_RATE, 9915);
-        RET_(DNS_ERROR_RRL_INVALID_LEAK_RATE, 9916);
-        RET_(DNS_ERROR_RRL_LEAK_RATE_LESSTHAN_TC_RATE, 9917);
-        RET_(DNS_ERROR_VIRTUALIZATION_INSTANCE_ALREADY_EXISTS, 9921);
-        RET_(DNS_ERROR_VIRTUALIZATION_INSTANCE_DOES_NOT_EXIST, 9922);
-        RET_(DNS_ERROR_VIRTUALIZATION_TREE_LOCKED, 9923);
-        RET_(DNS_ERROR_INVAILD_VIRTUALIZATION_INSTANCE_NAME, 9924);
-        RET_(DNS_ERROR_DEFAULT_VIRTUALIZATION_INSTANCE, 9925);
-        RET_(DNS_ERROR_ZONESCOPE_ALREADY_EXISTS, 9951);
-        RET_(DNS_ERROR_ZONESCOPE_DOES_NOT_EXIST, 9952);
-        RET_(DNS_ERROR_DEFAULT_ZONESCOPE, 9953);
-        RET_(DNS_ERROR_INVALID_ZONESCOPE_NAME, 9954);
-        RET_(DNS_ERROR_NOT_ALLOWED_WITH_ZONESCOPES, 9955);
-        RET_(DNS_ERROR_LOAD_ZONESCOPE_FAILED, 9956);
-        RET_(DNS_ERROR_ZONESCOPE_FILE_WRITEBACK_FAILED, 9957);
-        RET_(DNS_ERROR_INVALID_SCOPE_NAME, 9958);
-        RET_(DNS_ERROR_SCOPE_DOES_NOT_EXIST, 9959);
-        RET_(DNS_ERROR_DEFAULT_SCOPE, 9960);
-        RET_(DNS_ERROR_INVALID_SCOPE_OPERATION, 9961);
-        RET_(DNS_ERROR_SCOPE_LOCKED, 9962);
-        RET_(DNS_ERROR_SCOPE_ALREADY_EXISTS, 9963);
-        RET_(DNS_ERROR_POLICY_ALREADY_EXISTS, 9971);
-        RET_(DNS_ERROR_POLICY_DOES_NOT_EXIST, 9972);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA, 9973);
-        RET_(DNS_ERROR_POLICY_INVALID_SETTINGS, 9974);
-        RET_(DNS_ERROR_CLIENT_SUBNET_IS_ACCESSED, 9975);
-        RET_(DNS_ERROR_CLIENT_SUBNET_DOES_NOT_EXIST, 9976);
-        RET_(DNS_ERROR_CLIENT_SUBNET_ALREADY_EXISTS, 9977);
-        RET_(DNS_ERROR_SUBNET_DOES_NOT_EXIST, 9978);
-        RET_(DNS_ERROR_SUBNET_ALREADY_EXISTS, 9979);
-        RET_(DNS_ERROR_POLICY_LOCKED, 9980);
-        RET_(DNS_ERROR_POLICY_INVALID_WEIGHT, 9981);
-        RET_(DNS_ERROR_POLICY_INVALID_NAME, 9982);
-        RET_(DNS_ERROR_POLICY_MISSING_CRITERIA, 9983);
-        RET_(DNS_ERROR_INVALID_CLIENT_SUBNET_NAME, 9984);
-        RET_(DNS_ERROR_POLICY_PROCESSING_ORDER_INVALID, 9985);
-        RET_(DNS_ERROR_POLICY_SCOPE_MISSING, 9986);
-        RET_(DNS_ERROR_POLICY_SCOPE_NOT_ALLOWED, 9987);
-        RET_(DNS_ERROR_SERVERSCOPE_IS_REFERENCED, 9988);
-        RET_(DNS_ERROR_ZONESCOPE_IS_REFERENCED, 9989);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_CLIENT_SUBNET, 9990);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_TRANSPORT_PROTOCOL, 9991);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_NETWORK_PROTOCOL, 9992);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_INTERFACE, 9993);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_FQDN, 9994);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_QUERY_TYPE, 9995);
-        RET_(DNS_ERROR_POLICY_INVALID_CRITERIA_TIME_OF_DAY, 9996);
-        RET_(ERROR_IPSEC_QM_POLICY_EXISTS, 13000);
-        RET_(ERROR_IPSEC_QM_POLICY_NOT_FOUND, 13001);
-        RET_(ERROR_IPSEC_QM_POLICY_IN_USE, 13002);
-        RET_(ERROR_IPSEC_MM_POLICY_EXISTS, 13003);
-        RET_(ERROR_IPSEC_MM_POLICY_NOT_FOUND, 13004);
-        RET_(ERROR_IPSEC_MM_POLICY_IN_USE, 13005);
-        RET_(ERROR_IPSEC_MM_FILTER_EXISTS, 13006);
-        RET_(ERROR_IPSEC_MM_FILTER_NOT_FOUND, 13007);
-        RET_(ERROR_IPSEC_TRANSPORT_FILTER_EXISTS, 13008);
-        RET_(ERROR_IPSEC_TRANSPORT_FILTER_NOT_FOUND, 13009);
-        RET_(ERROR_IPSEC_MM_AUTH_EXISTS, 13010);
-        RET_(ERROR_IPSEC_MM_AUTH_NOT_FOUND, 13011);
-        RET_(ERROR_IPSEC_MM_AUTH_IN_USE, 13012);
-        RET_(ERROR_IPSEC_DEFAULT_MM_POLICY_NOT_FOUND, 13013);
-        RET_(ERROR_IPSEC_DEFAULT_MM_AUTH_NOT_FOUND, 13014);
-        RET_(ERROR_IPSEC_DEFAULT_QM_POLICY_NOT_FOUND, 13015);
-        RET_(ERROR_IPSEC_TUNNEL_FILTER_EXISTS, 13016);
-        RET_(ERROR_IPSEC_TUNNEL_FILTER_NOT_FOUND, 13017);
-        RET_(ERROR_IPSEC_MM_FILTER_PENDING_DELETION, 13018);
-        RET_(ERROR_IPSEC_TRANSPORT_FILTER_PENDING_DELETION, 13019);
-        RET_(ERROR_IPSEC_TUNNEL_FILTER_PENDING_DELETION, 13020);
-        RET_(ERROR_IPSEC_MM_POLICY_PENDING_DELETION, 13021);
-        RET_(ERROR_IPSEC_MM_AUTH_PENDING_DELETION, 13022);
-        RET_(ERROR_IPSEC_QM_POLICY_PENDING_DELETION, 13023);
-        RET_(ERROR_IPSEC_IKE_NEG_STATUS_BEGIN, 13800);
-        RET_(ERROR_IPSEC_IKE_AUTH_FAIL, 13801);
-        RET_(ERROR_IPSEC_IKE_ATTRIB_FAIL, 13802);
-        RET_(ERROR_IPSEC_IKE_NEGOTIATION_PENDING, 13803);
-        RET_(ERROR_IPSEC_IKE_GENERAL_PROCESSING_ERROR, 13804);
-        RET_(ERROR_IPSEC_IKE_TIMED_OUT, 13805);
-        RET_(ERROR_IPSEC_IKE_NO_CERT, 13806);
-        RET_(ERROR_IPSEC_IKE_SA_DELETED, 13807);
-        RET_(ERROR_IPSEC_IKE_SA_REAPED, 13808);
-        RET_(ERROR_IPSEC_IKE_MM_ACQUIRE_DROP, 13809);
-        RET_(ERROR_IPSEC_IKE_QM_ACQUIRE_DROP, 13810);
-        RET_(ERROR_IPSEC_IKE_QUEUE_DROP_MM, 13811);
-        RET_(ERROR_IPSEC_IKE_QUEUE_DROP_NO_MM, 13812);
-        RET_(ERROR_IPSEC_IKE_DROP_NO_RESPONSE, 13813);
-        RET_(ERROR_IPSEC_IKE_MM_DELAY_DROP, 13814);
-        RET_(ERROR_IPSEC_IKE_QM_DELAY_DROP, 13815);
-        RET_(ERROR_IPSEC_IKE_ERROR, 13816);
-        RET_(ERROR_IPSEC_IKE_CRL_FAILED, 13817);
-        RET_(ERROR_IPSEC_IKE_INVALID_KEY_USAGE, 13818);
-        RET_(ERROR_IPSEC_IKE_INVALID_CERT_TYPE, 13819);
-        RET_(ERROR_IPSEC_IKE_NO_PRIVATE_KEY, 13820);
-        RET_(ERROR_IPSEC_IKE_SIMULTANEOUS_REKEY, 13821);
-        RET_(ERROR_IPSEC_IKE_DH_FAIL, 13822);
-        RET_(ERROR_IPSEC_IKE_CRITICAL_PAYLOAD_NOT_RECOGNIZED, 13823);
-        RET_(ERROR_IPSEC_IKE_INVALID_HEADER, 13824);
-        RET_(ERROR_IPSEC_IKE_NO_POLICY, 13825);
-        RET_(ERROR_IPSEC_IKE_INVALID_SIGNATURE, 13826);
-        RET_(ERROR_IPSEC_IKE_KERBEROS_ERROR, 13827);
-        RET_(ERROR_IPSEC_IKE_NO_PUBLIC_KEY, 13828);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR, 13829);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_SA, 13830);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_PROP, 13831);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_TRANS, 13832);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_KE, 13833);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_ID, 13834);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_CERT, 13835);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_CERT_REQ, 13836);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_HASH, 13837);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_SIG, 13838);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_NONCE, 13839);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_NOTIFY, 13840);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_DELETE, 13841);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_VENDOR, 13842);
-        RET_(ERROR_IPSEC_IKE_INVALID_PAYLOAD, 13843);
-        RET_(ERROR_IPSEC_IKE_LOAD_SOFT_SA, 13844);
-        RET_(ERROR_IPSEC_IKE_SOFT_SA_TORN_DOWN, 13845);
-        RET_(ERROR_IPSEC_IKE_INVALID_COOKIE, 13846);
-        RET_(ERROR_IPSEC_IKE_NO_PEER_CERT, 13847);
-        RET_(ERROR_IPSEC_IKE_PEER_CRL_FAILED, 13848);
-        RET_(ERROR_IPSEC_IKE_POLICY_CHANGE, 13849);
-        RET_(ERROR_IPSEC_IKE_NO_MM_POLICY, 13850);
-        RET_(ERROR_IPSEC_IKE_NOTCBPRIV, 13851);
-        RET_(ERROR_IPSEC_IKE_SECLOADFAIL, 13852);
-        RET_(ERROR_IPSEC_IKE_FAILSSPINIT, 13853);
-        RET_(ERROR_IPSEC_IKE_FAILQUERYSSP, 13854);
-        RET_(ERROR_IPSEC_IKE_SRVACQFAIL, 13855);
-        RET_(ERROR_IPSEC_IKE_SRVQUERYCRED, 13856);
-        RET_(ERROR_IPSEC_IKE_GETSPIFAIL, 13857);
-        RET_(ERROR_IPSEC_IKE_INVALID_FILTER, 13858);
-        RET_(ERROR_IPSEC_IKE_OUT_OF_MEMORY, 13859);
-        RET_(ERROR_IPSEC_IKE_ADD_UPDATE_KEY_FAILED, 13860);
-        RET_(ERROR_IPSEC_IKE_INVALID_POLICY, 13861);
-        RET_(ERROR_IPSEC_IKE_UNKNOWN_DOI, 13862);
-        RET_(ERROR_IPSEC_IKE_INVALID_SITUATION, 13863);
-        RET_(ERROR_IPSEC_IKE_DH_FAILURE, 13864);
-        RET_(ERROR_IPSEC_IKE_INVALID_GROUP, 13865);
-        RET_(ERROR_IPSEC_IKE_ENCRYPT, 13866);
-        RET_(ERROR_IPSEC_IKE_DECRYPT, 13867);
-        RET_(ERROR_IPSEC_IKE_POLICY_MATCH, 13868);
-        RET_(ERROR_IPSEC_IKE_UNSUPPORTED_ID, 13869);
-        RET_(ERROR_IPSEC_IKE_INVALID_HASH, 13870);
-        RET_(ERROR_IPSEC_IKE_INVALID_HASH_ALG, 13871);
-        RET_(ERROR_IPSEC_IKE_INVALID_HASH_SIZE, 13872);
-        RET_(ERROR_IPSEC_IKE_INVALID_ENCRYPT_ALG, 13873);
-        RET_(ERROR_IPSEC_IKE_INVALID_AUTH_ALG, 13874);
-        RET_(ERROR_IPSEC_IKE_INVALID_SIG, 13875);
-        RET_(ERROR_IPSEC_IKE_LOAD_FAILED, 13876);
-        RET_(ERROR_IPSEC_IKE_RPC_DELETE, 13877);
-        RET_(ERROR_IPSEC_IKE_BENIGN_REINIT, 13878);
-        RET_(ERROR_IPSEC_IKE_INVALID_RESPONDER_LIFETIME_NOTIFY, 13879);
-        RET_(ERROR_IPSEC_IKE_INVALID_MAJOR_VERSION, 13880);
-        RET_(ERROR_IPSEC_IKE_INVALID_CERT_KEYLEN, 13881);
-        RET_(ERROR_IPSEC_IKE_MM_LIMIT, 13882);
-        RET_(ERROR_IPSEC_IKE_NEGOTIATION_DISABLED, 13883);
-        RET_(ERROR_IPSEC_IKE_QM_LIMIT, 13884);
-        RET_(ERROR_IPSEC_IKE_MM_EXPIRED, 13885);
-        RET_(ERROR_IPSEC_IKE_PEER_MM_ASSUMED_INVALID, 13886);
-        RET_(ERROR_IPSEC_IKE_CERT_CHAIN_POLICY_MISMATCH, 13887);
-        RET_(ERROR_IPSEC_IKE_UNEXPECTED_MESSAGE_ID, 13888);
-        RET_(ERROR_IPSEC_IKE_INVALID_AUTH_PAYLOAD, 13889);
-        RET_(ERROR_IPSEC_IKE_DOS_COOKIE_SENT, 13890);
-        RET_(ERROR_IPSEC_IKE_SHUTTING_DOWN, 13891);
-        RET_(ERROR_IPSEC_IKE_CGA_AUTH_FAILED, 13892);
-        RET_(ERROR_IPSEC_IKE_PROCESS_ERR_NATOA, 13893);
-        RET_(ERROR_IPSEC_IKE_INVALID_MM_FOR_QM, 13894);
-        RET_(ERROR_IPSEC_IKE_QM_EXPIRED, 13895);
-        RET_(ERROR_IPSEC_IKE_TOO_MANY_FILTERS, 13896);
-        RET_(ERROR_IPSEC_IKE_NEG_STATUS_END, 13897);
-        RET_(ERROR_IPSEC_IKE_KILL_DUMMY_NAP_TUNNEL, 13898);
-        RET_(ERROR_IPSEC_IKE_INNER_IP_ASSIGNMENT_FAILURE, 13899);
-        RET_(ERROR_IPSEC_IKE_REQUIRE_CP_PAYLOAD_MISSING, 13900);
-        RET_(ERROR_IPSEC_KEY_MODULE_IMPERSONATION_NEGOTIATION_PENDING, 13901);
-        RET_(ERROR_IPSEC_IKE_COEXISTENCE_SUPPRESS, 13902);
-        RET_(ERROR_IPSEC_IKE_RATELIMIT_DROP, 13903);
-        RET_(ERROR_IPSEC_IKE_PEER_DOESNT_SUPPORT_MOBIKE, 13904);
-        RET_(ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE, 13905);
-        RET_(ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_FAILURE, 13906);
-        RET_(ERROR_IPSEC_IKE_AUTHORIZATION_FAILURE_WITH_OPTIONAL_RETRY, 13907);
-        RET_(ERROR_IPSEC_IKE_STRONG_CRED_AUTHORIZATION_AND_CERTMAP_FAILURE, 13908);
-        RET_(ERROR_IPSEC_IKE_NEG_STATUS_EXTENDED_END, 13909);
-        RET_(ERROR_IPSEC_BAD_SPI, 13910);
-        RET_(ERROR_IPSEC_SA_LIFETIME_EXPIRED, 13911);
-        RET_(ERROR_IPSEC_WRONG_SA, 13912);
-        RET_(ERROR_IPSEC_REPLAY_CHECK_FAILED, 13913);
-        RET_(ERROR_IPSEC_INVALID_PACKET, 13914);
-        RET_(ERROR_IPSEC_INTEGRITY_CHECK_FAILED, 13915);
-        RET_(ERROR_IPSEC_CLEAR_TEXT_DROP, 13916);
-        RET_(ERROR_IPSEC_AUTH_FIREWALL_DROP, 13917);
-        RET_(ERROR_IPSEC_THROTTLE_DROP, 13918);
-        RET_(ERROR_IPSEC_DOSP_BLOCK, 13925);
-        RET_(ERROR_IPSEC_DOSP_RECEIVED_MULTICAST, 13926);
-        RET_(ERROR_IPSEC_DOSP_INVALID_PACKET, 13927);
-        RET_(ERROR_IPSEC_DOSP_STATE_LOOKUP_FAILED, 13928);
-        RET_(ERROR_IPSEC_DOSP_MAX_ENTRIES, 13929);
-        RET_(ERROR_IPSEC_DOSP_KEYMOD_NOT_ALLOWED, 13930);
-        RET_(ERROR_IPSEC_DOSP_NOT_INSTALLED, 13931);
-        RET_(ERROR_IPSEC_DOSP_MAX_PER_IP_RATELIMIT_QUEUES, 13932);
-        RET_(ERROR_SXS_SECTION_NOT_FOUND, 14000);
-        RET_(ERROR_SXS_CANT_GEN_ACTCTX, 14001);
-        RET_(ERROR_SXS_INVALID_ACTCTXDATA_FORMAT, 14002);
-        RET_(ERROR_SXS_ASSEMBLY_NOT_FOUND, 14003);
-        RET_(ERROR_SXS_MANIFEST_FORMAT_ERROR, 14004);
-        RET_(ERROR_SXS_MANIFEST_PARSE_ERROR, 14005);
-        RET_(ERROR_SXS_ACTIVATION_CONTEXT_DISABLED, 14006);
-        RET_(ERROR_SXS_KEY_NOT_FOUND, 14007);
-        RET_(ERROR_SXS_VERSION_CONFLICT, 14008);
-        RET_(ERROR_SXS_WRONG_SECTION_TYPE, 14009);
-        RET_(ERROR_SXS_THREAD_QUERIES_DISABLED, 14010);
-        RET_(ERROR_SXS_PROCESS_DEFAULT_ALREADY_SET, 14011);
-        RET_(ERROR_SXS_UNKNOWN_ENCODING_GROUP, 14012);
-        RET_(ERROR_SXS_UNKNOWN_ENCODING, 14013);
-        RET_(ERROR_SXS_INVALID_XML_NAMESPACE_URI, 14014);
-        RET_(ERROR_SXS_ROOT_MANIFEST_DEPENDENCY_NOT_INSTALLED, 14015);
-        RET_(ERROR_SXS_LEAF_MANIFEST_DEPENDENCY_NOT_INSTALLED, 14016);
-        RET_(ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE, 14017);
-        RET_(ERROR_SXS_MANIFEST_MISSING_REQUIRED_DEFAULT_NAMESPACE, 14018);
-        RET_(ERROR_SXS_MANIFEST_INVALID_REQUIRED_DEFAULT_NAMESPACE, 14019);
-        RET_(ERROR_SXS_PRIVATE_MANIFEST_CROSS_PATH_WITH_REPARSE_POINT, 14020);
-        RET_(ERROR_SXS_DUPLICATE_DLL_NAME, 14021);
-        RET_(ERROR_SXS_DUPLICATE_WINDOWCLASS_NAME, 14022);
-        RET_(ERROR_SXS_DUPLICATE_CLSID, 14023);
-        RET_(ERROR_SXS_DUPLICATE_IID, 14024);
-        RET_(ERROR_SXS_DUPLICATE_TLBID, 14025);
-        RET_(ERROR_SXS_DUPLICATE_PROGID, 14026);
-        RET_(ERROR_SXS_DUPLICATE_ASSEMBLY_NAME, 14027);
-        RET_(ERROR_SXS_FILE_HASH_MISMATCH, 14028);
-        RET_(ERROR_SXS_POLICY_PARSE_ERROR, 14029);
-        RET_(ERROR_SXS_XML_E_MISSINGQUOTE, 14030);
-        RET_(ERROR_SXS_XML_E_COMMENTSYNTAX, 14031);
-        RET_(ERROR_SXS_XML_E_BADSTARTNAMECHAR, 14032);
-        RET_(ERROR_SXS_XML_E_BADNAMECHAR, 14033);
-        RET_(ERROR_SXS_XML_E_BADCHARINSTRING, 14034);
-        RET_(ERROR_SXS_XML_E_XMLDECLSYNTAX, 14035);
-        RET_(ERROR_SXS_XML_E_BADCHARDATA, 14036);
-        RET_(ERROR_SXS_XML_E_MISSINGWHITESPACE, 14037);
-        RET_(ERROR_SXS_XML_E_EXPECTINGTAGEND, 14038);
-        RET_(ERROR_SXS_XML_E_MISSINGSEMICOLON, 14039);
-        RET_(ERROR_SXS_XML_E_UNBALANCEDPAREN, 14040);
-        RET_(ERROR_SXS_XML_E_INTERNALERROR, 14041);
-        RET_(ERROR_SXS_XML_E_UNEXPECTED_WHITESPACE, 14042);
-        RET_(ERROR_SXS_XML_E_INCOMPLETE_ENCODING, 14043);
-        RET_(ERROR_SXS_XML_E_MISSING_PAREN, 14044);
-        RET_(ERROR_SXS_XML_E_EXPECTINGCLOSEQUOTE, 14045);
-        RET_(ERROR_SXS_XML_E_MULTIPLE_COLONS, 14046);
-        RET_(ERROR_SXS_XML_E_INVALID_DECIMAL, 14047);
-        RET_(ERROR_SXS_XML_E_INVALID_HEXIDECIMAL, 14048);
-        RET_(ERROR_SXS_XML_E_INVALID_UNICODE, 14049);
-        RET_(ERROR_SXS_XML_E_WHITESPACEORQUESTIONMARK, 14050);
-        RET_(ERROR_SXS_XML_E_UNEXPECTEDENDTAG, 14051);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDTAG, 14052);
-        RET_(ERROR_SXS_XML_E_DUPLICATEATTRIBUTE, 14053);
-        RET_(ERROR_SXS_XML_E_MULTIPLEROOTS, 14054);
-        RET_(ERROR_SXS_XML_E_INVALIDATROOTLEVEL, 14055);
-        RET_(ERROR_SXS_XML_E_BADXMLDECL, 14056);
-        RET_(ERROR_SXS_XML_E_MISSINGROOT, 14057);
-        RET_(ERROR_SXS_XML_E_UNEXPECTEDEOF, 14058);
-        RET_(ERROR_SXS_XML_E_BADPEREFINSUBSET, 14059);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDSTARTTAG, 14060);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDENDTAG, 14061);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDSTRING, 14062);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDCOMMENT, 14063);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDDECL, 14064);
-        RET_(ERROR_SXS_XML_E_UNCLOSEDCDATA, 14065);
-        RET_(ERROR_SXS_XML_E_RESERVEDNAMESPACE, 14066);
-        RET_(ERROR_SXS_XML_E_INVALIDENCODING, 14067);
-        RET_(ERROR_SXS_XML_E_INVALIDSWITCH, 14068);
-        RET_(ERROR_SXS_XML_E_BADXMLCASE, 14069);
-        RET_(ERROR_SXS_XML_E_INVALID_STANDALONE, 14070);
-        RET_(ERROR_SXS_XML_E_UNEXPECTED_STANDALONE, 14071);
-        RET_(ERROR_SXS_XML_E_INVALID_VERSION, 14072);
-        RET_(ERROR_SXS_XML_E_MISSINGEQUALS, 14073);
-        RET_(ERROR_SXS_PROTECTION_RECOVERY_FAILED, 14074);
-        RET_(ERROR_SXS_PROTECTION_PUBLIC_KEY_TOO_SHORT, 14075);
-        RET_(ERROR_SXS_PROTECTION_CATALOG_NOT_VALID, 14076);
-        RET_(ERROR_SXS_UNTRANSLATABLE_HRESULT, 14077);
-        RET_(ERROR_SXS_PROTECTION_CATALOG_FILE_MISSING, 14078);
-        RET_(ERROR_SXS_MISSING_ASSEMBLY_IDENTITY_ATTRIBUTE, 14079);
-        RET_(ERROR_SXS_INVALID_ASSEMBLY_IDENTITY_ATTRIBUTE_NAME, 14080);
-        RET_(ERROR_SXS_ASSEMBLY_MISSING, 14081);
-        RET_(ERROR_SXS_CORRUPT_ACTIVATION_STACK, 14082);
-        RET_(ERROR_SXS_CORRUPTION, 14083);
-        RET_(ERROR_SXS_EARLY_DEACTIVATION, 14084);
-        RET_(ERROR_SXS_INVALID_DEACTIVATION, 14085);
-        RET_(ERROR_SXS_MULTIPLE_DEACTIVATION, 14086);
-        RET_(ERROR_SXS_PROCESS_TERMINATION_REQUESTED, 14087);
-        RET_(ERROR_SXS_RELEASE_ACTIVATION_CONTEXT, 14088);
-        RET_(ERROR_SXS_SYSTEM_DEFAULT_ACTIVATION_CONTEXT_EMPTY, 14089);
-        RET_(ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_VALUE, 14090);
-        RET_(ERROR_SXS_INVALID_IDENTITY_ATTRIBUTE_NAME, 14091);
-        RET_(ERROR_SXS_IDENTITY_DUPLICATE_ATTRIBUTE, 14092);
-        RET_(ERROR_SXS_IDENTITY_PARSE_ERROR, 14093);
-        RET_(ERROR_MALFORMED_SUBSTITUTION_STRING, 14094);
-        RET_(ERROR_SXS_INCORRECT_PUBLIC_KEY_TOKEN, 14095);
-        RET_(ERROR_UNMAPPED_SUBSTITUTION_STRING, 14096);
-        RET_(ERROR_SXS_ASSEMBLY_NOT_LOCKED, 14097);
-        RET_(ERROR_SXS_COMPONENT_STORE_CORRUPT, 14098);
-        RET_(ERROR_ADVANCED_INSTALLER_FAILED, 14099);
-        RET_(ERROR_XML_ENCODING_MISMATCH, 14100);
-        RET_(ERROR_SXS_MANIFEST_IDENTITY_SAME_BUT_CONTENTS_DIFFERENT, 14101);
-        RET_(ERROR_SXS_IDENTITIES_DIFFERENT, 14102);
-        RET_(ERROR_SXS_ASSEMBLY_IS_NOT_A_DEPLOYMENT, 14103);
-        RET_(ERROR_SXS_FILE_NOT_PART_OF_ASSEMBLY, 14104);
-        RET_(ERROR_SXS_MANIFEST_TOO_BIG, 14105);
-        RET_(ERROR_SXS_SETTING_NOT_REGISTERED, 14106);
-        RET_(ERROR_SXS_TRANSACTION_CLOSURE_INCOMPLETE, 14107);
-        RET_(ERROR_SMI_PRIMITIVE_INSTALLER_FAILED, 14108);
-        RET_(ERROR_GENERIC_COMMAND_FAILED, 14109);
-        RET_(ERROR_SXS_FILE_HASH_MISSING, 14110);
-        RET_(ERROR_SXS_DUPLICATE_ACTIVATABLE_CLASS, 14111);
-        RET_(ERROR_EVT_INVALID_CHANNEL_PATH, 15000);
-        RET_(ERROR_EVT_INVALID_QUERY, 15001);
-        RET_(ERROR_EVT_PUBLISHER_METADATA_NOT_FOUND, 15002);
-        RET_(ERROR_EVT_EVENT_TEMPLATE_NOT_FOUND, 15003);
-        RET_(ERROR_EVT_INVALID_PUBLISHER_NAME, 15004);
-        RET_(ERROR_EVT_INVALID_EVENT_DATA, 15005);
-        RET_(ERROR_EVT_CHANNEL_NOT_FOUND, 15007);
-        RET_(ERROR_EVT_MALFORMED_XML_TEXT, 15008);
-        RET_(ERROR_EVT_SUBSCRIPTION_TO_DIRECT_CHANNEL, 15009);
-        RET_(ERROR_EVT_CONFIGURATION_ERROR, 15010);
-        RET_(ERROR_EVT_QUERY_RESULT_STALE, 15011);
-        RET_(ERROR_EVT_QUERY_RESULT_INVALID_POSITION, 15012);
-        RET_(ERROR_EVT_NON_VALIDATING_MSXML, 15013);
-        RET_(ERROR_EVT_FILTER_ALREADYSCOPED, 15014);
-        RET_(ERROR_EVT_FILTER_NOTELTSET, 15015);
-        RET_(ERROR_EVT_FILTER_INVARG, 15016);
-        RET_(ERROR_EVT_FILTER_INVTEST, 15017);
-        RET_(ERROR_EVT_FILTER_INVTYPE, 15018);
-        RET_(ERROR_EVT_FILTER_PARSEERR, 15019);
-        RET_(ERROR_EVT_FILTER_UNSUPPORTEDOP, 15020);
-        RET_(ERROR_EVT_FILTER_UNEXPECTEDTOKEN, 15021);
-        RET_(ERROR_EVT_INVALID_OPERATION_OVER_ENABLED_DIRECT_CHANNEL, 15022);
-        RET_(ERROR_EVT_INVALID_CHANNEL_PROPERTY_VALUE, 15023);
-        RET_(ERROR_EVT_INVALID_PUBLISHER_PROPERTY_VALUE, 15024);
-        RET_(ERROR_EVT_CHANNEL_CANNOT_ACTIVATE, 15025);
-        RET_(ERROR_EVT_FILTER_TOO_COMPLEX, 15026);
-        RET_(ERROR_EVT_MESSAGE_NOT_FOUND, 15027);
-        RET_(ERROR_EVT_MESSAGE_ID_NOT_FOUND, 15028);
-        RET_(ERROR_EVT_UNRESOLVED_VALUE_INSERT, 15029);
-        RET_(ERROR_EVT_UNRESOLVED_PARAMETER_INSERT, 15030);
-        RET_(ERROR_EVT_MAX_INSERTS_REACHED, 15031);
-        RET_(ERROR_EVT_EVENT_DEFINITION_NOT_FOUND, 15032);
-        RET_(ERROR_EVT_MESSAGE_LOCALE_NOT_FOUND, 15033);
-        RET_(ERROR_EVT_VERSION_TOO_OLD, 15034);
-        RET_(ERROR_EVT_VERSION_TOO_NEW, 15035);
-        RET_(ERROR_EVT_CANNOT_OPEN_CHANNEL_OF_QUERY, 15036);
-        RET_(ERROR_EVT_PUBLISHER_DISABLED, 15037);
-        RET_(ERROR_EVT_FILTER_OUT_OF_RANGE, 15038);
-        RET_(ERROR_EC_SUBSCRIPTION_CANNOT_ACTIVATE, 15080);
-        RET_(ERROR_EC_LOG_DISABLED, 15081);
-        RET_(ERROR_EC_CIRCULAR_FORWARDING, 15082);
-        RET_(ERROR_EC_CREDSTORE_FULL, 15083);
-        RET_(ERROR_EC_CRED_NOT_FOUND, 15084);
-        RET_(ERROR_EC_NO_ACTIVE_CHANNEL, 15085);
-        RET_(ERROR_MUI_FILE_NOT_FOUND, 15100);
-        RET_(ERROR_MUI_INVALID_FILE, 15101);
-        RET_(ERROR_MUI_INVALID_RC_CONFIG, 15102);
-        RET_(ERROR_MUI_INVALID_LOCALE_NAME, 15103);
-        RET_(ERROR_MUI_INVALID_ULTIMATEFALLBACK_NAME, 15104);
-        RET_(ERROR_MUI_FILE_NOT_LOADED, 15105);
-        RET_(ERROR_RESOURCE_ENUM_USER_STOP, 15106);
-        RET_(ERROR_MUI_INTLSETTINGS_UILANG_NOT_INSTALLED, 15107);
-        RET_(ERROR_MUI_INTLSETTINGS_INVALID_LOCALE_NAME, 15108);
-        RET_(ERROR_MRM_RUNTIME_NO_DEFAULT_OR_NEUTRAL_RESOURCE, 15110);
-        RET_(ERROR_MRM_INVALID_PRICONFIG, 15111);
-        RET_(ERROR_MRM_INVALID_FILE_TYPE, 15112);
-        RET_(ERROR_MRM_UNKNOWN_QUALIFIER, 15113);
-        RET_(ERROR_MRM_INVALID_QUALIFIER_VALUE, 15114);
-        RET_(ERROR_MRM_NO_CANDIDATE, 15115);
-        RET_(ERROR_MRM_NO_MATCH_OR_DEFAULT_CANDIDATE, 15116);
-        RET_(ERROR_MRM_RESOURCE_TYPE_MISMATCH, 15117);
-        RET_(ERROR_MRM_DUPLICATE_MAP_NAME, 15118);
-        RET_(ERROR_MRM_DUPLICATE_ENTRY, 15119);
-        RET_(ERROR_MRM_INVALID_RESOURCE_IDENTIFIER, 15120);
-        RET_(ERROR_MRM_FILEPATH_TOO_LONG, 15121);
-        RET_(ERROR_MRM_UNSUPPORTED_DIRECTORY_TYPE, 15122);
-        RET_(ERROR_MRM_INVALID_PRI_FILE, 15126);
-        RET_(ERROR_MRM_NAMED_RESOURCE_NOT_FOUND, 15127);
-        RET_(ERROR_MRM_MAP_NOT_FOUND, 15135);
-        RET_(ERROR_MRM_UNSUPPORTED_PROFILE_TYPE, 15136);
-        RET_(ERROR_MRM_INVALID_QUALIFIER_OPERATOR, 15137);
-        RET_(ERROR_MRM_INDETERMINATE_QUALIFIER_VALUE, 15138);
-        RET_(ERROR_MRM_AUTOMERGE_ENABLED, 15139);
-        RET_(ERROR_MRM_TOO_MANY_RESOURCES, 15140);
-        RET_(ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_MERGE, 15141);
-        RET_(ERROR_MRM_UNSUPPORTED_FILE_TYPE_FOR_LOAD_UNLOAD_PRI_FILE, 15142);
-        RET_(ERROR_MRM_NO_CURRENT_VIEW_ON_THREAD, 15143);
-        RET_(ERROR_DIFFERENT_PROFILE_RESOURCE_MANAGER_EXIST, 15144);
-        RET_(ERROR_OPERATION_NOT_ALLOWED_FROM_SYSTEM_COMPONENT, 15145);
-        RET_(ERROR_MRM_DIRECT_REF_TO_NON_DEFAULT_RESOURCE, 15146);
-        RET_(ERROR_MRM_GENERATION_COUNT_MISMATCH, 15147);
-        RET_(ERROR_PRI_MERGE_VERSION_MISMATCH, 15148);
-        RET_(ERROR_PRI_MERGE_MISSING_SCHEMA, 15149);
-        RET_(ERROR_PRI_MERGE_LOAD_FILE_FAILED, 15150);
-        RET_(ERROR_PRI_MERGE_ADD_FILE_FAILED, 15151);
-        RET_(ERROR_PRI_MERGE_WRITE_FILE_FAILED, 15152);
-        RET_(ERROR_PRI_MERGE_MULTIPLE_PACKAGE_FAMILIES_NOT_ALLOWED, 15153);
-        RET_(ERROR_PRI_MERGE_MULTIPLE_MAIN_PACKAGES_NOT_ALLOWED, 15154);
-        RET_(ERROR_PRI_MERGE_BUNDLE_PACKAGES_NOT_ALLOWED, 15155);
-        RET_(ERROR_PRI_MERGE_MAIN_PACKAGE_REQUIRED, 15156);
-        RET_(ERROR_PRI_MERGE_RESOURCE_PACKAGE_REQUIRED, 15157);
-        RET_(ERROR_PRI_MERGE_INVALID_FILE_NAME, 15158);
-        RET_(ERROR_MRM_PACKAGE_NOT_FOUND, 15159);
-        RET_(ERROR_MRM_MISSING_DEFAULT_LANGUAGE, 15160);
-        RET_(ERROR_MCA_INVALID_CAPABILITIES_STRING, 15200);
-        RET_(ERROR_MCA_INVALID_VCP_VERSION, 15201);
-        RET_(ERROR_MCA_MONITOR_VIOLATES_MCCS_SPECIFICATION, 15202);
-        RET_(ERROR_MCA_MCCS_VERSION_MISMATCH, 15203);
-        RET_(ERROR_MCA_UNSUPPORTED_MCCS_VERSION, 15204);
-        RET_(ERROR_MCA_INTERNAL_ERROR, 15205);
-        RET_(ERROR_MCA_INVALID_TECHNOLOGY_TYPE_RETURNED, 15206);
-        RET_(ERROR_MCA_UNSUPPORTED_COLOR_TEMPERATURE, 15207);
-        RET_(ERROR_AMBIGUOUS_SYSTEM_DEVICE, 15250);
-        RET_(ERROR_SYSTEM_DEVICE_NOT_FOUND, 15299);
-        RET_(ERROR_HASH_NOT_SUPPORTED, 15300);
-        RET_(ERROR_HASH_NOT_PRESENT, 15301);
-        RET_(ERROR_SECONDARY_IC_PROVIDER_NOT_REGISTERED, 15321);
-        RET_(ERROR_GPIO_CLIENT_INFORMATION_INVALID, 15322);
-        RET_(ERROR_GPIO_VERSION_NOT_SUPPORTED, 15323);
-        RET_(ERROR_GPIO_INVALID_REGISTRATION_PACKET, 15324);
-        RET_(ERROR_GPIO_OPERATION_DENIED, 15325);
-        RET_(ERROR_GPIO_INCOMPATIBLE_CONNECT_MODE, 15326);
-        RET_(ERROR_GPIO_INTERRUPT_ALREADY_UNMASKED, 15327);
-        RET_(ERROR_CANNOT_SWITCH_RUNLEVEL, 15400);
-        RET_(ERROR_INVALID_RUNLEVEL_SETTING, 15401);
-        RET_(ERROR_RUNLEVEL_SWITCH_TIMEOUT, 15402);
-        RET_(ERROR_RUNLEVEL_SWITCH_AGENT_TIMEOUT, 15403);
-        RET_(ERROR_RUNLEVEL_SWITCH_IN_PROGRESS, 15404);
-        RET_(ERROR_SERVICES_FAILED_AUTOSTART, 15405);
-        RET_(ERROR_COM_TASK_STOP_PENDING, 15501);
-        RET_(ERROR_INSTALL_OPEN_PACKAGE_FAILED, 15600);
-        RET_(ERROR_INSTALL_PACKAGE_NOT_FOUND, 15601);
-        RET_(ERROR_INSTALL_INVALID_PACKAGE, 15602);
-        RET_(ERROR_INSTALL_RESOLVE_DEPENDENCY_FAILED, 15603);
-        RET_(ERROR_INSTALL_OUT_OF_DISK_SPACE, 15604);
-        RET_(ERROR_INSTALL_NETWORK_FAILURE, 15605);
-        RET_(ERROR_INSTALL_REGISTRATION_FAILURE, 15606);
-        RET_(ERROR_INSTALL_DEREGISTRATION_FAILURE, 15607);
-        RET_(ERROR_INSTALL_CANCEL, 15608);
-        RET_(ERROR_INSTALL_FAILED, 15609);
-        RET_(ERROR_REMOVE_FAILED, 15610);
-        RET_(ERROR_PACKAGE_ALREADY_EXISTS, 15611);
-        RET_(ERROR_NEEDS_REMEDIATION, 15612);
-        RET_(ERROR_INSTALL_PREREQUISITE_FAILED, 15613);
-        RET_(ERROR_PACKAGE_REPOSITORY_CORRUPTED, 15614);
-        RET_(ERROR_INSTALL_POLICY_FAILURE, 15615);
-        RET_(ERROR_PACKAGE_UPDATING, 15616);
-        RET_(ERROR_DEPLOYMENT_BLOCKED_BY_POLICY, 15617);
-        RET_(ERROR_PACKAGES_IN_USE, 15618);
-        RET_(ERROR_RECOVERY_FILE_CORRUPT, 15619);
-        RET_(ERROR_INVALID_STAGED_SIGNATURE, 15620);
-        RET_(ERROR_DELETING_EXISTING_APPLICATIONDATA_STORE_FAILED, 15621);
-        RET_(ERROR_INSTALL_PACKAGE_DOWNGRADE, 15622);
-        RET_(ERROR_SYSTEM_NEEDS_REMEDIATION, 15623);
-        RET_(ERROR_APPX_INTEGRITY_FAILURE_CLR_NGEN, 15624);
-        RET_(ERROR_RESILIENCY_FILE_CORRUPT, 15625);
-        RET_(ERROR_INSTALL_FIREWALL_SERVICE_NOT_RUNNING, 15626);
-        RET_(ERROR_PACKAGE_MOVE_FAILED, 15627);
-        RET_(ERROR_INSTALL_VOLUME_NOT_EMPTY, 15628);
-        RET_(ERROR_INSTALL_VOLUME_OFFLINE, 15629);
-        RET_(ERROR_INSTALL_VOLUME_CORRUPT, 15630);
-        RET_(ERROR_NEEDS_REGISTRATION, 15631);
-        RET_(ERROR_INSTALL_WRONG_PROCESSOR_ARCHITECTURE, 15632);
-        RET_(ERROR_DEV_SIDELOAD_LIMIT_EXCEEDED, 15633);
-        RET_(ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE, 15634);
-        RET_(ERROR_PACKAGE_NOT_SUPPORTED_ON_FILESYSTEM, 15635);
-        RET_(ERROR_PACKAGE_MOVE_BLOCKED_BY_STREAMING, 15636);
-        RET_(ERROR_INSTALL_OPTIONAL_PACKAGE_APPLICATIONID_NOT_UNIQUE, 15637);
-        RET_(ERROR_PACKAGE_STAGING_ONHOLD, 15638);
-        RET_(ERROR_INSTALL_INVALID_RELATED_SET_UPDATE, 15639);
-        RET_(ERROR_INSTALL_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY, 15640);
-        RET_(ERROR_DEPLOYMENT_BLOCKED_BY_USER_LOG_OFF, 15641);
-        RET_(ERROR_PROVISION_OPTIONAL_PACKAGE_REQUIRES_MAIN_PACKAGE_PROVISIONED, 15642);
-        RET_(ERROR_PACKAGES_REPUTATION_CHECK_FAILED, 15643);
-        RET_(ERROR_PACKAGES_REPUTATION_CHECK_TIMEDOUT, 15644);
-        RET_(ERROR_DEPLOYMENT_OPTION_NOT_SUPPORTED, 15645);
-        RET_(ERROR_APPINSTALLER_ACTIVATION_BLOCKED, 15646);
-        RET_(ERROR_REGISTRATION_FROM_REMOTE_DRIVE_NOT_SUPPORTED, 15647);
-        RET_(ERROR_APPX_RAW_DATA_WRITE_FAILED, 15648);
-        RET_(ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_PACKAGE, 15649);
-        RET_(ERROR_DEPLOYMENT_BLOCKED_BY_VOLUME_POLICY_MACHINE, 15650);
-        RET_(ERROR_DEPLOYMENT_BLOCKED_BY_PROFILE_POLICY, 15651);
-        RET_(ERROR_DEPLOYMENT_FAILED_CONFLICTING_MUTABLE_PACKAGE_DIRECTORY, 15652);
-        RET_(ERROR_SINGLETON_RESOURCE_INSTALLED_IN_ACTIVE_USER, 15653);
-        RET_(ERROR_DIFFERENT_VERSION_OF_PACKAGED_SERVICE_INSTALLED, 15654);
-        RET_(ERROR_SERVICE_EXISTS_AS_NON_PACKAGED_SERVICE, 15655);
-        RET_(ERROR_PACKAGED_SERVICE_REQUIRES_ADMIN_PRIVILEGES, 15656);
-        RET_(ERROR_REDIRECTION_TO_DEFAULT_ACCOUNT_NOT_ALLOWED, 15657);
-        RET_(ERROR_PACKAGE_LACKS_CAPABILITY_TO_DEPLOY_ON_HOST, 15658);
-        RET_(ERROR_UNSIGNED_PACKAGE_INVALID_CONTENT, 15659);
-        RET_(ERROR_UNSIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE, 15660);
-        RET_(ERROR_SIGNED_PACKAGE_INVALID_PUBLISHER_NAMESPACE, 15661);
-        RET_(ERROR_PACKAGE_EXTERNAL_LOCATION_NOT_ALLOWED, 15662);
-        RET_(ERROR_INSTALL_FULLTRUST_HOSTRUNTIME_REQUIRES_MAIN_PACKAGE_FULLTRUST_CAPABILITY, 15663);
-        RET_(ERROR_PACKAGE_LACKS_CAPABILITY_FOR_MANDATORY_STARTUPTASKS, 15664);
-        RET_(ERROR_INSTALL_RESOLVE_HOSTRUNTIME_DEPENDENCY_FAILED, 15665);
-        RET_(ERROR_MACHINE_SCOPE_NOT_ALLOWED, 15666);
-        RET_(ERROR_CLASSIC_COMPAT_MODE_NOT_ALLOWED, 15667);
-        RET_(ERROR_STAGEFROMUPDATEAGENT_PACKAGE_NOT_APPLICABLE, 15668);
-        RET_(ERROR_PACKAGE_NOT_REGISTERED_FOR_USER, 15669);
-        RET_(ERROR_STATE_LOAD_STORE_FAILED, 15800);
-        RET_(ERROR_STATE_GET_VERSION_FAILED, 15801);
-        RET_(ERROR_STATE_SET_VERSION_FAILED, 15802);
-        RET_(ERROR_STATE_STRUCTURED_RESET_FAILED, 15803);
-        RET_(ERROR_STATE_OPEN_CONTAINER_FAILED, 15804);
-        RET_(ERROR_STATE_CREATE_CONTAINER_FAILED, 15805);
-        RET_(ERROR_STATE_DELETE_CONTAINER_FAILED, 15806);
-        RET_(ERROR_STATE_READ_SETTING_FAILED, 15807);
-        RET_(ERROR_STATE_WRITE_SETTING_FAILED, 15808);
-        RET_(ERROR_STATE_DELETE_SETTING_FAILED, 15809);
-        RET_(ERROR_STATE_QUERY_SETTING_FAILED, 15810);
-        RET_(ERROR_STATE_READ_COMPOSITE_SETTING_FAILED, 15811);
-        RET_(ERROR_STATE_WRITE_COMPOSITE_SETTING_FAILED, 15812);
-        RET_(ERROR_STATE_ENUMERATE_CONTAINER_FAILED, 15813);
-        RET_(ERROR_STATE_ENUMERATE_SETTINGS_FAILED, 15814);
-        RET_(ERROR_STATE_COMPOSITE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED, 15815);
-        RET_(ERROR_STATE_SETTING_VALUE_SIZE_LIMIT_EXCEEDED, 15816);
-        RET_(ERROR_STATE_SETTING_NAME_SIZE_LIMIT_EXCEEDED, 15817);
-        RET_(ERROR_STATE_CONTAINER_NAME_SIZE_LIMIT_EXCEEDED, 15818);
-        RET_(ERROR_API_UNAVAILABLE, 15841);
-        RET_(ERROR_NDIS_INTERFACE_CLOSING, 2150891522);
-        RET_(ERROR_NDIS_BAD_VERSION, 2150891524);
-        RET_(ERROR_NDIS_BAD_CHARACTERISTICS, 2150891525);
-        RET_(ERROR_NDIS_ADAPTER_NOT_FOUND, 2150891526);
-        RET_(ERROR_NDIS_OPEN_FAILED, 2150891527);
-        RET_(ERROR_NDIS_DEVICE_FAILED, 2150891528);
-        RET_(ERROR_NDIS_MULTICAST_FULL, 2150891529);
-        RET_(ERROR_NDIS_MULTICAST_EXISTS, 2150891530);
-        RET_(ERROR_NDIS_MULTICAST_NOT_FOUND, 2150891531);
-        RET_(ERROR_NDIS_REQUEST_ABORTED, 2150891532);
-        RET_(ERROR_NDIS_RESET_IN_PROGRESS, 2150891533);
-        RET_(ERROR_NDIS_NOT_SUPPORTED, 2150891707);
-        RET_(ERROR_NDIS_INVALID_PACKET, 2150891535);
-        RET_(ERROR_NDIS_ADAPTER_NOT_READY, 2150891537);
-        RET_(ERROR_NDIS_INVALID_LENGTH, 2150891540);
-        RET_(ERROR_NDIS_INVALID_DATA, 2150891541);
-        RET_(ERROR_NDIS_BUFFER_TOO_SHORT, 2150891542);
-        RET_(ERROR_NDIS_INVALID_OID, 2150891543);
-        RET_(ERROR_NDIS_ADAPTER_REMOVED, 2150891544);
-        RET_(ERROR_NDIS_UNSUPPORTED_MEDIA, 2150891545);
-        RET_(ERROR_NDIS_GROUP_ADDRESS_IN_USE, 2150891546);
-        RET_(ERROR_NDIS_FILE_NOT_FOUND, 2150891547);
-        RET_(ERROR_NDIS_ERROR_READING_FILE, 2150891548);
-        RET_(ERROR_NDIS_ALREADY_MAPPED, 2150891549);
-        RET_(ERROR_NDIS_RESOURCE_CONFLICT, 2150891550);
-        RET_(ERROR_NDIS_MEDIA_DISCONNECTED, 2150891551);
-        RET_(ERROR_NDIS_INVALID_ADDRESS, 2150891554);
-        RET_(ERROR_NDIS_INVALID_DEVICE_REQUEST, 2150891536);
-        RET_(ERROR_NDIS_PAUSED, 2150891562);
-        RET_(ERROR_NDIS_INTERFACE_NOT_FOUND, 2150891563);
-        RET_(ERROR_NDIS_UNSUPPORTED_REVISION, 2150891564);
-        RET_(ERROR_NDIS_INVALID_PORT, 2150891565);
-        RET_(ERROR_NDIS_INVALID_PORT_STATE, 2150891566);
-        RET_(ERROR_NDIS_LOW_POWER_STATE, 2150891567);
-        RET_(ERROR_NDIS_REINIT_REQUIRED, 2150891568);
-        RET_(ERROR_NDIS_NO_QUEUES, 2150891569);
-        RET_(ERROR_NDIS_DOT11_AUTO_CONFIG_ENABLED, 2150899712);
-        RET_(ERROR_NDIS_DOT11_MEDIA_IN_USE, 2150899713);
-        RET_(ERROR_NDIS_DOT11_POWER_STATE_INVALID, 2150899714);
-        RET_(ERROR_NDIS_PM_WOL_PATTERN_LIST_FULL, 2150899715);
-        RET_(ERROR_NDIS_PM_PROTOCOL_OFFLOAD_LIST_FULL, 2150899716);
-        RET_(ERROR_NDIS_DOT11_AP_CHANNEL_CURRENTLY_NOT_AVAILABLE, 2150899717);
-        RET_(ERROR_NDIS_DOT11_AP_BAND_CURRENTLY_NOT_AVAILABLE, 2150899718);
-        RET_(ERROR_NDIS_DOT11_AP_CHANNEL_NOT_ALLOWED, 2150899719);
-        RET_(ERROR_NDIS_DOT11_AP_BAND_NOT_ALLOWED, 2150899720);
-        RET_(ERROR_NDIS_INDICATION_REQUIRED, 3407873);
-        RET_(ERROR_NDIS_OFFLOAD_POLICY, 3224637455);
-        RET_(ERROR_NDIS_OFFLOAD_CONNECTION_REJECTED, 3224637458);
-        RET_(ERROR_NDIS_OFFLOAD_PATH_REJECTED, 3224637459);
-        RET_(ERROR_HV_INVALID_HYPERCALL_CODE, 3224698882);
-        RET_(ERROR_HV_INVALID_HYPERCALL_INPUT, 3224698883);
-        RET_(ERROR_HV_INVALID_ALIGNMENT, 3224698884);
-        RET_(ERROR_HV_INVALID_PARAMETER, 3224698885);
-        RET_(ERROR_HV_ACCESS_DENIED, 3224698886);
-        RET_(ERROR_HV_INVALID_PARTITION_STATE, 3224698887);
-        RET_(ERROR_HV_OPERATION_DENIED, 3224698888);
-        RET_(ERROR_HV_UNKNOWN_PROPERTY, 3224698889);
-        RET_(ERROR_HV_PROPERTY_VALUE_OUT_OF_RANGE, 3224698890);
-        RET_(ERROR_HV_INSUFFICIENT_MEMORY, 3224698891);
-        RET_(ERROR_HV_PARTITION_TOO_DEEP, 3224698892);
-        RET_(ERROR_HV_INVALID_PARTITION_ID, 3224698893);
-        RET_(ERROR_HV_INVALID_VP_INDEX, 3224698894);
-        RET_(ERROR_HV_INVALID_PORT_ID, 3224698897);
-        RET_(ERROR_HV_INVALID_CONNECTION_ID, 3224698898);
-        RET_(ERROR_HV_INSUFFICIENT_BUFFERS, 3224698899);
-        RET_(ERROR_HV_NOT_ACKNOWLEDGED, 3224698900);
-        RET_(ERROR_HV_INVALID_VP_STATE, 3224698901);
-        RET_(ERROR_HV_ACKNOWLEDGED, 3224698902);
-        RET_(ERROR_HV_INVALID_SAVE_RESTORE_STATE, 3224698903);
-        RET_(ERROR_HV_INVALID_SYNIC_STATE, 3224698904);
-        RET_(ERROR_HV_OBJECT_IN_USE, 3224698905);
-        RET_(ERROR_HV_INVALID_PROXIMITY_DOMAIN_INFO, 3224698906);
-        RET_(ERROR_HV_NO_DATA, 3224698907);
-        RET_(ERROR_HV_INACTIVE, 3224698908);
-        RET_(ERROR_HV_NO_RESOURCES, 3224698909);
-        RET_(ERROR_HV_FEATURE_UNAVAILABLE, 3224698910);
-        RET_(ERROR_HV_INSUFFICIENT_BUFFER, 3224698931);
-        RET_(ERROR_HV_INSUFFICIENT_DEVICE_DOMAINS, 3224698936);
-        RET_(ERROR_HV_CPUID_FEATURE_VALIDATION, 3224698940);
-        RET_(ERROR_HV_CPUID_XSAVE_FEATURE_VALIDATION, 3224698941);
-        RET_(ERROR_HV_PROCESSOR_STARTUP_TIMEOUT, 3224698942);
-        RET_(ERROR_HV_SMX_ENABLED, 3224698943);
-        RET_(ERROR_HV_INVALID_LP_INDEX, 3224698945);
-        RET_(ERROR_HV_INVALID_REGISTER_VALUE, 3224698960);
-        RET_(ERROR_HV_INVALID_VTL_STATE, 3224698961);
-        RET_(ERROR_HV_NX_NOT_DETECTED, 3224698965);
-        RET_(ERROR_HV_INVALID_DEVICE_ID, 3224698967);
-        RET_(ERROR_HV_INVALID_DEVICE_STATE, 3224698968);
-        RET_(ERROR_HV_PENDING_PAGE_REQUESTS, 3473497);
-        RET_(ERROR_HV_PAGE_REQUEST_INVALID, 3224698976);
-        RET_(ERROR_HV_INVALID_CPU_GROUP_ID, 3224698991);
-        RET_(ERROR_HV_INVALID_CPU_GROUP_STATE, 3224698992);
-        RET_(ERROR_HV_OPERATION_FAILED, 3224698993);
-        RET_(ERROR_HV_NOT_ALLOWED_WITH_NESTED_VIRT_ACTIVE, 3224698994);
-        RET_(ERROR_HV_INSUFFICIENT_ROOT_MEMORY, 3224698995);
-        RET_(ERROR_HV_EVENT_BUFFER_ALREADY_FREED, 3224698996);
-        RET_(ERROR_HV_INSUFFICIENT_CONTIGUOUS_MEMORY, 3224698997);
-        RET_(ERROR_HV_DEVICE_NOT_IN_DOMAIN, 3224698998);
-        RET_(ERROR_HV_NESTED_VM_EXIT, 3224698999);
-        RET_(ERROR_HV_MSR_ACCESS_FAILED, 3224699008);
-        RET_(ERROR_HV_NOT_PRESENT, 3224702976);
-        RET_(ERROR_VID_DUPLICATE_HANDLER, 3224829953);
-        RET_(ERROR_VID_TOO_MANY_HANDLERS, 3224829954);
-        RET_(ERROR_VID_QUEUE_FULL, 3224829955);
-        RET_(ERROR_VID_HANDLER_NOT_PRESENT, 3224829956);
-        RET_(ERROR_VID_INVALID_OBJECT_NAME, 3224829957);
-        RET_(ERROR_VID_PARTITION_NAME_TOO_LONG, 3224829958);
-        RET_(ERROR_VID_MESSAGE_QUEUE_NAME_TOO_LONG, 3224829959);
-        RET_(ERROR_VID_PARTITION_ALREADY_EXISTS, 3224829960);
-        RET_(ERROR_VID_PARTITION_DOES_NOT_EXIST, 3224829961);
-        RET_(ERROR_VID_PARTITION_NAME_NOT_FOUND, 3224829962);
-        RET_(ERROR_VID_MESSAGE_QUEUE_ALREADY_EXISTS, 3224829963);
-        RET_(ERROR_VID_EXCEEDED_MBP_ENTRY_MAP_LIMIT, 3224829964);
-        RET_(ERROR_VID_MB_STILL_REFERENCED, 3224829965);
-        RET_(ERROR_VID_CHILD_GPA_PAGE_SET_CORRUPTED, 3224829966);
-        RET_(ERROR_VID_INVALID_NUMA_SETTINGS, 3224829967);
-        RET_(ERROR_VID_INVALID_NUMA_NODE_INDEX, 3224829968);
-        RET_(ERROR_VID_NOTIFICATION_QUEUE_ALREADY_ASSOCIATED, 3224829969);
-        RET_(ERROR_VID_INVALID_MEMORY_BLOCK_HANDLE, 3224829970);
-        RET_(ERROR_VID_PAGE_RANGE_OVERFLOW, 3224829971);
-        RET_(ERROR_VID_INVALID_MESSAGE_QUEUE_HANDLE, 3224829972);
-        RET_(ERROR_VID_INVALID_GPA_RANGE_HANDLE, 3224829973);
-        RET_(ERROR_VID_NO_MEMORY_BLOCK_NOTIFICATION_QUEUE, 3224829974);
-        RET_(ERROR_VID_MEMORY_BLOCK_LOCK_COUNT_EXCEEDED, 3224829975);
-        RET_(ERROR_VID_INVALID_PPM_HANDLE, 3224829976);
-        RET_(ERROR_VID_MBPS_ARE_LOCKED, 3224829977);
-        RET_(ERROR_VID_MESSAGE_QUEUE_CLOSED, 3224829978);
-        RET_(ERROR_VID_VIRTUAL_PROCESSOR_LIMIT_EXCEEDED, 3224829979);
-        RET_(ERROR_VID_STOP_PENDING, 3224829980);
-        RET_(ERROR_VID_INVALID_PROCESSOR_STATE, 3224829981);
-        RET_(ERROR_VID_EXCEEDED_KM_CONTEXT_COUNT_LIMIT, 3224829982);
-        RET_(ERROR_VID_KM_INTERFACE_ALREADY_INITIALIZED, 3224829983);
-        RET_(ERROR_VID_MB_PROPERTY_ALREADY_SET_RESET, 3224829984);
-        RET_(ERROR_VID_MMIO_RANGE_DESTROYED, 3224829985);
-        RET_(ERROR_VID_INVALID_CHILD_GPA_PAGE_SET, 3224829986);
-        RET_(ERROR_VID_RESERVE_PAGE_SET_IS_BEING_USED, 3224829987);
-        RET_(ERROR_VID_RESERVE_PAGE_SET_TOO_SMALL, 3224829988);
-        RET_(ERROR_VID_MBP_ALREADY_LOCKED_USING_RESERVED_PAGE, 3224829989);
-        RET_(ERROR_VID_MBP_COUNT_EXCEEDED_LIMIT, 3224829990);
-        RET_(ERROR_VID_SAVED_STATE_CORRUPT, 3224829991);
-        RET_(ERROR_VID_SAVED_STATE_UNRECOGNIZED_ITEM, 3224829992);
-        RET_(ERROR_VID_SAVED_STATE_INCOMPATIBLE, 3224829993);
-        RET_(ERROR_VID_VTL_ACCESS_DENIED, 3224829994);
-        RET_(ERROR_VMCOMPUTE_TERMINATED_DURING_START, 3224830208);
-        RET_(ERROR_VMCOMPUTE_IMAGE_MISMATCH, 3224830209);
-        RET_(ERROR_VMCOMPUTE_HYPERV_NOT_INSTALLED, 3224830210);
-        RET_(ERROR_VMCOMPUTE_OPERATION_PENDING, 3224830211);
-        RET_(ERROR_VMCOMPUTE_TOO_MANY_NOTIFICATIONS, 3224830212);
-        RET_(ERROR_VMCOMPUTE_INVALID_STATE, 3224830213);
-        RET_(ERROR_VMCOMPUTE_UNEXPECTED_EXIT, 3224830214);
-        RET_(ERROR_VMCOMPUTE_TERMINATED, 3224830215);
-        RET_(ERROR_VMCOMPUTE_CONNECT_FAILED, 3224830216);
-        RET_(ERROR_VMCOMPUTE_TIMEOUT, 3224830217);
-        RET_(ERROR_VMCOMPUTE_CONNECTION_CLOSED, 3224830218);
-        RET_(ERROR_VMCOMPUTE_UNKNOWN_MESSAGE, 3224830219);
-        RET_(ERROR_VMCOMPUTE_UNSUPPORTED_PROTOCOL_VERSION, 3224830220);
-        RET_(ERROR_VMCOMPUTE_INVALID_JSON, 3224830221);
-        RET_(ERROR_VMCOMPUTE_SYSTEM_NOT_FOUND, 3224830222);
-        RET_(ERROR_VMCOMPUTE_SYSTEM_ALREADY_EXISTS, 3224830223);
-        RET_(ERROR_VMCOMPUTE_SYSTEM_ALREADY_STOPPED, 3224830224);
-        RET_(ERROR_VMCOMPUTE_PROTOCOL_ERROR, 3224830225);
-        RET_(ERROR_VMCOMPUTE_INVALID_LAYER, 3224830226);
-        RET_(ERROR_VMCOMPUTE_WINDOWS_INSIDER_REQUIRED, 3224830227);
-        RET_(ERROR_VNET_VIRTUAL_SWITCH_NAME_NOT_FOUND, 3224830464);
-        RET_(ERROR_VID_REMOTE_NODE_PARENT_GPA_PAGES_USED, 2151088129);
-        RET_(ERROR_VSMB_SAVED_STATE_FILE_NOT_FOUND, 3224830976);
-        RET_(ERROR_VSMB_SAVED_STATE_CORRUPT, 3224830977);
-        RET_(ERROR_VOLMGR_INCOMPLETE_REGENERATION, 2151153665);
-        RET_(ERROR_VOLMGR_INCOMPLETE_DISK_MIGRATION, 2151153666);
-        RET_(ERROR_VOLMGR_DATABASE_FULL, 3224895489);
-        RET_(ERROR_VOLMGR_DISK_CONFIGURATION_CORRUPTED, 3224895490);
-        RET_(ERROR_VOLMGR_DISK_CONFIGURATION_NOT_IN_SYNC, 3224895491);
-        RET_(ERROR_VOLMGR_PACK_CONFIG_UPDATE_FAILED, 3224895492);
-        RET_(ERROR_VOLMGR_DISK_CONTAINS_NON_SIMPLE_VOLUME, 3224895493);
-        RET_(ERROR_VOLMGR_DISK_DUPLICATE, 3224895494);
-        RET_(ERROR_VOLMGR_DISK_DYNAMIC, 3224895495);
-        RET_(ERROR_VOLMGR_DISK_ID_INVALID, 3224895496);
-        RET_(ERROR_VOLMGR_DISK_INVALID, 3224895497);
-        RET_(ERROR_VOLMGR_DISK_LAST_VOTER, 3224895498);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_INVALID, 3224895499);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_NON_BASIC_BETWEEN_BASIC_PARTITIONS, 3224895500);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_NOT_CYLINDER_ALIGNED, 3224895501);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_PARTITIONS_TOO_SMALL, 3224895502);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_PRIMARY_BETWEEN_LOGICAL_PARTITIONS, 3224895503);
-        RET_(ERROR_VOLMGR_DISK_LAYOUT_TOO_MANY_PARTITIONS, 3224895504);
-        RET_(ERROR_VOLMGR_DISK_MISSING, 3224895505);
-        RET_(ERROR_VOLMGR_DISK_NOT_EMPTY, 3224895506);
-        RET_(ERROR_VOLMGR_DISK_NOT_ENOUGH_SPACE, 3224895507);
-        RET_(ERROR_VOLMGR_DISK_REVECTORING_FAILED, 3224895508);
-        RET_(ERROR_VOLMGR_DISK_SECTOR_SIZE_INVALID, 3224895509);
-        RET_(ERROR_VOLMGR_DISK_SET_NOT_CONTAINED, 3224895510);
-        RET_(ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_MEMBERS, 3224895511);
-        RET_(ERROR_VOLMGR_DISK_USED_BY_MULTIPLE_PLEXES, 3224895512);
-        RET_(ERROR_VOLMGR_DYNAMIC_DISK_NOT_SUPPORTED, 3224895513);
-        RET_(ERROR_VOLMGR_EXTENT_ALREADY_USED, 3224895514);
-        RET_(ERROR_VOLMGR_EXTENT_NOT_CONTIGUOUS, 3224895515);
-        RET_(ERROR_VOLMGR_EXTENT_NOT_IN_PUBLIC_REGION, 3224895516);
-        RET_(ERROR_VOLMGR_EXTENT_NOT_SECTOR_ALIGNED, 3224895517);
-        RET_(ERROR_VOLMGR_EXTENT_OVERLAPS_EBR_PARTITION, 3224895518);
-        RET_(ERROR_VOLMGR_EXTENT_VOLUME_LENGTHS_DO_NOT_MATCH, 3224895519);
-        RET_(ERROR_VOLMGR_FAULT_TOLERANT_NOT_SUPPORTED, 3224895520);
-        RET_(ERROR_VOLMGR_INTERLEAVE_LENGTH_INVALID, 3224895521);
-        RET_(ERROR_VOLMGR_MAXIMUM_REGISTERED_USERS, 3224895522);
-        RET_(ERROR_VOLMGR_MEMBER_IN_SYNC, 3224895523);
-        RET_(ERROR_VOLMGR_MEMBER_INDEX_DUPLICATE, 3224895524);
-        RET_(ERROR_VOLMGR_MEMBER_INDEX_INVALID, 3224895525);
-        RET_(ERROR_VOLMGR_MEMBER_MISSING, 3224895526);
-        RET_(ERROR_VOLMGR_MEMBER_NOT_DETACHED, 3224895527);
-        RET_(ERROR_VOLMGR_MEMBER_REGENERATING, 3224895528);
-        RET_(ERROR_VOLMGR_ALL_DISKS_FAILED, 3224895529);
-        RET_(ERROR_VOLMGR_NO_REGISTERED_USERS, 3224895530);
-        RET_(ERROR_VOLMGR_NO_SUCH_USER, 3224895531);
-        RET_(ERROR_VOLMGR_NOTIFICATION_RESET, 3224895532);
-        RET_(ERROR_VOLMGR_NUMBER_OF_MEMBERS_INVALID, 3224895533);
-        RET_(ERROR_VOLMGR_NUMBER_OF_PLEXES_INVALID, 3224895534);
-        RET_(ERROR_VOLMGR_PACK_DUPLICATE, 3224895535);
-        RET_(ERROR_VOLMGR_PACK_ID_INVALID, 3224895536);
-        RET_(ERROR_VOLMGR_PACK_INVALID, 3224895537);
-        RET_(ERROR_VOLMGR_PACK_NAME_INVALID, 3224895538);
-        RET_(ERROR_VOLMGR_PACK_OFFLINE, 3224895539);
-        RET_(ERROR_VOLMGR_PACK_HAS_QUORUM, 3224895540);
-        RET_(ERROR_VOLMGR_PACK_WITHOUT_QUORUM, 3224895541);
-        RET_(ERROR_VOLMGR_PARTITION_STYLE_INVALID, 3224895542);
-        RET_(ERROR_VOLMGR_PARTITION_UPDATE_FAILED, 3224895543);
-        RET_(ERROR_VOLMGR_PLEX_IN_SYNC, 3224895544);
-        RET_(ERROR_VOLMGR_PLEX_INDEX_DUPLICATE, 3224895545);
-        RET_(ERROR_VOLMGR_PLEX_INDEX_INVALID, 3224895546);
-        RET_(ERROR_VOLMGR_PLEX_LAST_ACTIVE, 3224895547);
-        RET_(ERROR_VOLMGR_PLEX_MISSING, 3224895548);
-        RET_(ERROR_VOLMGR_PLEX_REGENERATING, 3224895549);
-        RET_(ERROR_VOLMGR_PLEX_TYPE_INVALID, 3224895550);
-        RET_(ERROR_VOLMGR_PLEX_NOT_RAID5, 3224895551);
-        RET_(ERROR_VOLMGR_PLEX_NOT_SIMPLE, 3224895552);
-        RET_(ERROR_VOLMGR_STRUCTURE_SIZE_INVALID, 3224895553);
-        RET_(ERROR_VOLMGR_TOO_MANY_NOTIFICATION_REQUESTS, 3224895554);
-        RET_(ERROR_VOLMGR_TRANSACTION_IN_PROGRESS, 3224895555);
-        RET_(ERROR_VOLMGR_UNEXPECTED_DISK_LAYOUT_CHANGE, 3224895556);
-        RET_(ERROR_VOLMGR_VOLUME_CONTAINS_MISSING_DISK, 3224895557);
-        RET_(ERROR_VOLMGR_VOLUME_ID_INVALID, 3224895558);
-        RET_(ERROR_VOLMGR_VOLUME_LENGTH_INVALID, 3224895559);
-        RET_(ERROR_VOLMGR_VOLUME_LENGTH_NOT_SECTOR_SIZE_MULTIPLE, 3224895560);
-        RET_(ERROR_VOLMGR_VOLUME_NOT_MIRRORED, 3224895561);
-        RET_(ERROR_VOLMGR_VOLUME_NOT_RETAINED, 3224895562);
-        RET_(ERROR_VOLMGR_VOLUME_OFFLINE, 3224895563);
-        RET_(ERROR_VOLMGR_VOLUME_RETAINED, 3224895564);
-        RET_(ERROR_VOLMGR_NUMBER_OF_EXTENTS_INVALID, 3224895565);
-        RET_(ERROR_VOLMGR_DIFFERENT_SECTOR_SIZE, 3224895566);
-        RET_(ERROR_VOLMGR_BAD_BOOT_DISK, 3224895567);
-        RET_(ERROR_VOLMGR_PACK_CONFIG_OFFLINE, 3224895568);
-        RET_(ERROR_VOLMGR_PACK_CONFIG_ONLINE, 3224895569);
-        RET_(ERROR_VOLMGR_NOT_PRIMARY_PACK, 3224895570);
-        RET_(ERROR_VOLMGR_PACK_LOG_UPDATE_FAILED, 3224895571);
-        RET_(ERROR_VOLMGR_NUMBER_OF_DISKS_IN_PLEX_INVALID, 3224895572);
-        RET_(ERROR_VOLMGR_NUMBER_OF_DISKS_IN_MEMBER_INVALID, 3224895573);
-        RET_(ERROR_VOLMGR_VOLUME_MIRRORED, 3224895574);
-        RET_(ERROR_VOLMGR_PLEX_NOT_SIMPLE_SPANNED, 3224895575);
-        RET_(ERROR_VOLMGR_NO_VALID_LOG_COPIES, 3224895576);
-        RET_(ERROR_VOLMGR_PRIMARY_PACK_PRESENT, 3224895577);
-        RET_(ERROR_VOLMGR_NUMBER_OF_DISKS_INVALID, 3224895578);
-        RET_(ERROR_VOLMGR_MIRROR_NOT_SUPPORTED, 3224895579);
-        RET_(ERROR_VOLMGR_RAID5_NOT_SUPPORTED, 3224895580);
-        RET_(ERROR_BCD_NOT_ALL_ENTRIES_IMPORTED, 2151219201);
-        RET_(ERROR_BCD_TOO_MANY_ELEMENTS, 3224961026);
-        RET_(ERROR_BCD_NOT_ALL_ENTRIES_SYNCHRONIZED, 2151219203);
-        RET_(ERROR_VHD_DRIVE_FOOTER_MISSING, 3225026561);
-        RET_(ERROR_VHD_DRIVE_FOOTER_CHECKSUM_MISMATCH, 3225026562);
-        RET_(ERROR_VHD_DRIVE_FOOTER_CORRUPT, 3225026563);
-        RET_(ERROR_VHD_FORMAT_UNKNOWN, 3225026564);
-        RET_(ERROR_VHD_FORMAT_UNSUPPORTED_VERSION, 3225026565);
-        RET_(ERROR_VHD_SPARSE_HEADER_CHECKSUM_MISMATCH, 3225026566);
-        RET_(ERROR_VHD_SPARSE_HEADER_UNSUPPORTED_VERSION, 3225026567);
-        RET_(ERROR_VHD_SPARSE_HEADER_CORRUPT, 3225026568);
-        RET_(ERROR_VHD_BLOCK_ALLOCATION_FAILURE, 3225026569);
-        RET_(ERROR_VHD_BLOCK_ALLOCATION_TABLE_CORRUPT, 3225026570);
-        RET_(ERROR_VHD_INVALID_BLOCK_SIZE, 3225026571);
-        RET_(ERROR_VHD_BITMAP_MISMATCH, 3225026572);
-        RET_(ERROR_VHD_PARENT_VHD_NOT_FOUND, 3225026573);
-        RET_(ERROR_VHD_CHILD_PARENT_ID_MISMATCH, 3225026574);
-        RET_(ERROR_VHD_CHILD_PARENT_TIMESTAMP_MISMATCH, 3225026575);
-        RET_(ERROR_VHD_METADATA_READ_FAILURE, 3225026576);
-        RET_(ERROR_VHD_METADATA_WRITE_FAILURE, 3225026577);
-        RET_(ERROR_VHD_INVALID_SIZE, 3225026578);
-        RET_(ERROR_VHD_INVALID_FILE_SIZE, 3225026579);
-        RET_(ERROR_VIRTDISK_PROVIDER_NOT_FOUND, 3225026580);
-        RET_(ERROR_VIRTDISK_NOT_VIRTUAL_DISK, 3225026581);
-        RET_(ERROR_VHD_PARENT_VHD_ACCESS_DENIED, 3225026582);
-        RET_(ERROR_VHD_CHILD_PARENT_SIZE_MISMATCH, 3225026583);
-        RET_(ERROR_VHD_DIFFERENCING_CHAIN_CYCLE_DETECTED, 3225026584);
-        RET_(ERROR_VHD_DIFFERENCING_CHAIN_ERROR_IN_PARENT, 3225026585);
-        RET_(ERROR_VIRTUAL_DISK_LIMITATION, 3225026586);
-        RET_(ERROR_VHD_INVALID_TYPE, 3225026587);
-        RET_(ERROR_VHD_INVALID_STATE, 3225026588);
-        RET_(ERROR_VIRTDISK_UNSUPPORTED_DISK_SECTOR_SIZE, 3225026589);
-        RET_(ERROR_VIRTDISK_DISK_ALREADY_OWNED, 3225026590);
-        RET_(ERROR_VIRTDISK_DISK_ONLINE_AND_WRITABLE, 3225026591);
-        RET_(ERROR_CTLOG_TRACKING_NOT_INITIALIZED, 3225026592);
-        RET_(ERROR_CTLOG_LOGFILE_SIZE_EXCEEDED_MAXSIZE, 3225026593);
-        RET_(ERROR_CTLOG_VHD_CHANGED_OFFLINE, 3225026594);
-        RET_(ERROR_CTLOG_INVALID_TRACKING_STATE, 3225026595);
-        RET_(ERROR_CTLOG_INCONSISTENT_TRACKING_FILE, 3225026596);
-        RET_(ERROR_VHD_RESIZE_WOULD_TRUNCATE_DATA, 3225026597);
-        RET_(ERROR_VHD_COULD_NOT_COMPUTE_MINIMUM_VIRTUAL_SIZE, 3225026598);
-        RET_(ERROR_VHD_ALREADY_AT_OR_BELOW_MINIMUM_VIRTUAL_SIZE, 3225026599);
-        RET_(ERROR_VHD_METADATA_FULL, 3225026600);
-        RET_(ERROR_VHD_INVALID_CHANGE_TRACKING_ID, 3225026601);
-        RET_(ERROR_VHD_CHANGE_TRACKING_DISABLED, 3225026602);
-        RET_(ERROR_VHD_MISSING_CHANGE_TRACKING_INFORMATION, 3225026608);
-        RET_(ERROR_QUERY_STORAGE_ERROR, 2151284737);
+    int lo = 0;
+    int hi = WINERRSYM_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (gWinErrorCodes[mid] < err)
+            lo = mid + 1;
+        else if (gWinErrorCodes[mid] > err)
+            hi = mid - 1;
+        else
+            return &gWinErrorSymBlob[gWinErrorSymOffsets[mid]];
     }
     return NULL;
 }
 
+/*
+ * Reverse lookup - symbol name to error code. Returns 1 with *codeP set
+ * if the symbol is known, 0 otherwise.
+ */
+int winerrcode(const char *sym, DWORD *codeP)
+{
+    int lo = 0;
+    int hi = WINERRSYM_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int i   = gWinErrorNameOrder[mid];
+        int cmp = strcmp(&gWinErrorSymBlob[gWinErrorSymOffsets[i]], sym);
+        if (cmp < 0)
+            lo = mid + 1;
+        else if (cmp > 0)
+            hi = mid - 1;
+        else {
+            *codeP = gWinErrorCodes[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
 #endif /* WINERRORSYMS_C */